@@ -8,13 +8,16 @@ greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 TARGET = NRAConnector
 TEMPLATE = app
 
-QMAKE_CXXFLAGS += -msse
+# SSE2 is checked at compile time, AVX2 at run time; other CPUs get the scalar kernels
+contains(QT_ARCH, i386)|contains(QT_ARCH, x86_64): QMAKE_CXXFLAGS += -msse2
 
 SOURCES += \
 	main.cpp\
 	mainwindow.cpp \
 	nraconnector.cpp \
 	rtlserver.cpp \
+	fftfilter.cpp \
+	simd.cpp \
 	sseinterpolator.cpp
 
 HEADERS += \
@@ -22,6 +25,8 @@ HEADERS += \
 	nraconnector.h \
 	rtlserver.h \
 	dsptypes.h \
+	fftfilter.h \
+	simd.h \
 	sseinterpolator.h
 
 FORMS += \
@@ -0,0 +1,260 @@
+/*
+ * This file is part of NRAConnector
+ * written by Christian Daniel 2016 -- <dg2ndk@afuz.org>
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2016 Amateurfunk Unterfranken e.V.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * File contents: overlap-save FFT fast convolution filter
+ */
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <string.h>
+#include "fftfilter.h"
+
+FFTFilter::FFTFilter() :
+	m_size(0),
+	m_block(0),
+	m_keep(0),
+	m_fill(0),
+	m_decimation(1),
+	m_pending(1),
+	m_backend(SIMD::BackendScalar)
+{
+}
+
+std::shared_ptr<const FFTFilter::Spectrum> FFTFilter::createSpectrum(const float* taps, int nTaps, int fftSize)
+{
+	std::shared_ptr<Spectrum> spectrum = std::make_shared<Spectrum>();
+	spectrum->size = fftSize;
+
+	int bits = 0;
+	while((1 << bits) < fftSize)
+		bits++;
+	spectrum->bitReverse.resize(fftSize);
+	for(int i = 0; i < fftSize; ++i) {
+		int r = 0;
+		for(int b = 0; b < bits; ++b) {
+			if(i & (1 << b))
+				r |= 1 << (bits - 1 - b);
+		}
+		spectrum->bitReverse[i] = r;
+	}
+
+	spectrum->twiddleRe.resize(fftSize);
+	spectrum->twiddleIm.resize(fftSize);
+	for(int h = 1; h < fftSize; h *= 2) {
+		for(int j = 0; j < h; ++j) {
+			spectrum->twiddleRe[h + j] = cos(-M_PI * j / h);
+			spectrum->twiddleIm[h + j] = sin(-M_PI * j / h);
+		}
+	}
+
+	// the inverse transform is not scaled, so the filter spectrum carries the 1 / N
+	spectrum->filterRe.assign(fftSize, 0);
+	spectrum->filterIm.assign(fftSize, 0);
+	for(int i = 0; i < nTaps; ++i)
+		spectrum->filterRe[i] = taps[i] / fftSize;
+	transform<SIMD::SSE2>(*spectrum, &spectrum->filterRe[0], &spectrum->filterIm[0]);
+	return spectrum;
+}
+
+void FFTFilter::create(const std::shared_ptr<const Spectrum>& spectrum, int nTaps, int decimation, SIMD::Backend backend)
+{
+	m_spectrum = spectrum;
+	m_size = spectrum->size;
+	m_keep = nTaps - 1;
+	m_block = m_size - m_keep;
+	m_fill = m_keep;
+	m_decimation = decimation;
+	m_pending = decimation;
+	m_backend = backend;
+	qDebug("FFT filter with %d taps, %d point FFT, %d samples per block", nTaps, m_size, m_block);
+
+	m_inputI.assign(m_size, 0);
+	m_inputQ.assign(m_size, 0);
+	m_re.resize(m_size);
+	m_im.resize(m_size);
+}
+
+int FFTFilter::bestSize(int nTaps, int decimation, double* cost)
+{
+	// per block two transforms of N / 2 * log2(N) butterflies (10 flops each) and N complex
+	// multiplies (6 flops), shared by the outputs of its N - nTaps + 1 new samples
+	int best = 0;
+	int size = 2;
+	int bits = 1;
+	while(size < 2 * nTaps) {
+		size *= 2;
+		bits++;
+	}
+	*cost = 0;
+	for(int i = 0; i < 4; ++i, size *= 2, bits++) {
+		double c = (10.0 * size * bits + 6.0 * size) / (size - nTaps + 1) * decimation;
+		if((best == 0) || (c < *cost)) {
+			best = size;
+			*cost = c;
+		}
+	}
+	return best;
+}
+
+int FFTFilter::process(const float* inI, const float* inQ, int count, Complex* output)
+{
+	Complex* out = output;
+
+	while(count > 0) {
+		int todo = m_size - m_fill;
+		if(todo > count)
+			todo = count;
+		memcpy(&m_inputI[m_fill], inI, todo * sizeof(float));
+		memcpy(&m_inputQ[m_fill], inQ, todo * sizeof(float));
+		m_fill += todo;
+		inI += todo;
+		inQ += todo;
+		count -= todo;
+		if(m_fill < m_size)
+			break;
+
+		if(m_backend == SIMD::BackendScalar)
+			filterBlock<SIMD::Scalar>();
+		else filterBlock<SIMD::SSE2>();
+
+		// the first m_keep samples are wrapped around, the rest is the filter output
+		int index = m_keep + m_pending - 1;
+		for(; index < m_size; index += m_decimation)
+			*out++ = Complex(m_re[index], m_im[index]);
+		m_pending = index - m_size + 1;
+
+		memmove(&m_inputI[0], &m_inputI[m_block], m_keep * sizeof(float));
+		memmove(&m_inputQ[0], &m_inputQ[m_block], m_keep * sizeof(float));
+		m_fill = m_keep;
+	}
+
+	return out - output;
+}
+
+// I/Q is one complex signal: transform, multiply with the filter spectrum and transform
+// back; the inverse transform is the forward one with real and imaginary part swapped
+template<class V>
+void FFTFilter::filterBlock()
+{
+	memcpy(&m_re[0], &m_inputI[0], m_size * sizeof(float));
+	memcpy(&m_im[0], &m_inputQ[0], m_size * sizeof(float));
+	const Spectrum& spectrum = *m_spectrum;
+	transform<V>(spectrum, &m_re[0], &m_im[0]);
+	int i = 0;
+	for(; i + V::Lanes <= m_size; i += V::Lanes) {
+		typename V::Float xr = V::load(&m_re[i]);
+		typename V::Float xi = V::load(&m_im[i]);
+		typename V::Float hr = V::load(&spectrum.filterRe[i]);
+		typename V::Float hi = V::load(&spectrum.filterIm[i]);
+		V::store(&m_re[i], V::sub(V::mul(xr, hr), V::mul(xi, hi)));
+		V::store(&m_im[i], V::add(V::mul(xr, hi), V::mul(xi, hr)));
+	}
+	for(; i < m_size; ++i) {
+		float re = m_re[i] * spectrum.filterRe[i] - m_im[i] * spectrum.filterIm[i];
+		m_im[i] = m_re[i] * spectrum.filterIm[i] + m_im[i] * spectrum.filterRe[i];
+		m_re[i] = re;
+	}
+	transform<V>(spectrum, &m_im[0], &m_re[0]);
+}
+
+void FFTFilter::loadHistory(const float* inI, const float* inQ, int count)
+{
+	if(count > m_keep) {
+		inI += count - m_keep;
+		inQ += count - m_keep;
+		count = m_keep;
+	}
+	memcpy(&m_inputI[m_keep - count], inI, count * sizeof(float));
+	memcpy(&m_inputQ[m_keep - count], inQ, count * sizeof(float));
+}
+
+// in place radix 2 decimation in time FFT, the spans from 4 on are split into vectors
+template<class V>
+void FFTFilter::transform(const Spectrum& spectrum, float* re, float* im)
+{
+	static_assert(V::Lanes <= 4, "the smallest vectorised span is 4");
+	const int size = spectrum.size;
+	for(int i = 0; i < size; ++i) {
+		int r = spectrum.bitReverse[i];
+		if(r > i) {
+			float t = re[i];
+			re[i] = re[r];
+			re[r] = t;
+			t = im[i];
+			im[i] = im[r];
+			im[r] = t;
+		}
+	}
+
+	// spans 1 and 2 have trivial twiddles
+	for(int i = 0; i < size; i += 2) {
+		float r = re[i + 1];
+		float m = im[i + 1];
+		re[i + 1] = re[i] - r;
+		im[i + 1] = im[i] - m;
+		re[i] += r;
+		im[i] += m;
+	}
+	for(int i = 0; i < size; i += 4) {
+		// twiddle -j for the second pair
+		float r0 = re[i + 2];
+		float m0 = im[i + 2];
+		float r1 = im[i + 3];
+		float m1 = -re[i + 3];
+		re[i + 2] = re[i] - r0;
+		im[i + 2] = im[i] - m0;
+		re[i] += r0;
+		im[i] += m0;
+		re[i + 3] = re[i + 1] - r1;
+		im[i + 3] = im[i + 1] - m1;
+		re[i + 1] += r1;
+		im[i + 1] += m1;
+	}
+
+	for(int h = 4; h < size; h *= 2) {
+		const float* twRe = &spectrum.twiddleRe[h];
+		const float* twIm = &spectrum.twiddleIm[h];
+		for(int g = 0; g < size; g += 2 * h) {
+			float* aRe = re + g;
+			float* aIm = im + g;
+			float* bRe = re + g + h;
+			float* bIm = im + g + h;
+			for(int j = 0; j < h; j += V::Lanes) {
+				typename V::Float wr = V::load(twRe + j);
+				typename V::Float wi = V::load(twIm + j);
+				typename V::Float xr = V::load(bRe + j);
+				typename V::Float xi = V::load(bIm + j);
+				typename V::Float tr = V::sub(V::mul(xr, wr), V::mul(xi, wi));
+				typename V::Float ti = V::add(V::mul(xr, wi), V::mul(xi, wr));
+				typename V::Float ar = V::load(aRe + j);
+				typename V::Float ai = V::load(aIm + j);
+				V::store(bRe + j, V::sub(ar, tr));
+				V::store(bIm + j, V::sub(ai, ti));
+				V::store(aRe + j, V::add(ar, tr));
+				V::store(aIm + j, V::add(ai, ti));
+			}
+		}
+	}
+}
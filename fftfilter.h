@@ -0,0 +1,89 @@
+/*
+ * This file is part of NRAConnector
+ * written by Christian Daniel 2016 -- <dg2ndk@afuz.org>
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2016 Amateurfunk Unterfranken e.V.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * File contents: overlap-save FFT fast convolution filter
+ */
+
+#ifndef INCLUDE_FFTFILTER_H
+#define INCLUDE_FFTFILTER_H
+
+#include <memory>
+#include <vector>
+#include "dsptypes.h"
+#include "simd.h"
+
+// FIR filter applied block wise in the frequency domain, the cost per sample grows with the
+// logarithm of the filter length instead of linearly; only every decimation-th filtered
+// sample is delivered
+class FFTFilter {
+public:
+	// everything that only depends on the taps and the FFT size, immutable once built so
+	// all filters with the same taps share one copy
+	struct Spectrum {
+		int size;
+		std::vector<int> bitReverse;
+		std::vector<float> twiddleRe; // twiddles of the stage with span h at h .. 2h - 1
+		std::vector<float> twiddleIm;
+		std::vector<float> filterRe; // spectrum of the taps, scaled by 1 / size
+		std::vector<float> filterIm;
+	};
+
+	FFTFilter();
+
+	static std::shared_ptr<const Spectrum> createSpectrum(const float* taps, int nTaps, int fftSize);
+	// the transforms run four lanes wide, AVX2 uses the SSE2 kernels
+	void create(const std::shared_ptr<const Spectrum>& spectrum, int nTaps, int decimation, SIMD::Backend backend);
+
+	// returns the number of output samples, a completed block can deliver up to
+	// blockSize() / decimation samples more than the input alone would suggest
+	int process(const float* inI, const float* inQ, int count, Complex* output);
+	int blockSize() const { return m_block; }
+	// history samples in ascending time order as if they had been filtered before, right
+	// after create()
+	void loadHistory(const float* inI, const float* inQ, int count);
+
+	// FFT size with the lowest cost per output for the given filter, the cost is
+	// counted in float operations just like 2 * nTaps for a direct form filter
+	static int bestSize(int nTaps, int decimation, double* cost);
+
+private:
+	std::shared_ptr<const Spectrum> m_spectrum;
+	int m_size;
+	int m_block; // new input samples per FFT, m_size - m_keep
+	int m_keep; // nTaps - 1 samples carried over from the previous block
+	int m_fill;
+	int m_decimation;
+	int m_pending; // input samples to consume before the next output
+	SIMD::Backend m_backend;
+	std::vector<float> m_inputI;
+	std::vector<float> m_inputQ;
+	std::vector<float> m_re;
+	std::vector<float> m_im;
+
+	template<class V> void filterBlock();
+	template<class V> static void transform(const Spectrum& spectrum, float* re, float* im);
+};
+
+#endif // INCLUDE_FFTFILTER_H
@@ -38,7 +38,17 @@ MainWindow::MainWindow(QWidget* parent) :
 {
 	ui->setupUi(this);
 
+	bool blocked = ui->resamplerQuality->blockSignals(true);
+	ui->resamplerQuality->addItem(tr("Low (16 taps)"));
+	ui->resamplerQuality->addItem(tr("Medium (32 taps)"));
+	ui->resamplerQuality->addItem(tr("High (64 taps)"));
+	ui->resamplerQuality->addItem(tr("Best (128 taps)"));
+	ui->resamplerQuality->addItem(tr("Cubic (waterfall only)"));
+	ui->resamplerQuality->addItem(tr("Extreme (512 taps)"));
+	ui->resamplerQuality->blockSignals(blocked);
+
 	loadSettings();
+	m_nraConnector->setResamplerQuality(ui->resamplerQuality->currentIndex());
 
 	connect(m_nraConnector, &NRAConnector::onStateReport, this, &MainWindow::handleNRAStateReport);
 	connect(m_nraConnector, &NRAConnector::onDeviceInfo, this, &MainWindow::handleNRADeviceInfo);
@@ -46,18 +56,6 @@ MainWindow::MainWindow(QWidget* parent) :
 	connect(m_nraConnector, &NRAConnector::onReferenceLevelList, this, &MainWindow::handleNRAReferenceLevelList);
 	ui->status->setText(tr("Idle"));
 
-	bool blocked = ui->digiAtt->blockSignals(true);
-	ui->digiAtt->addItem(tr("0 dB"));
-	ui->digiAtt->addItem(tr("6 dB"));
-	ui->digiAtt->addItem(tr("12 dB"));
-	ui->digiAtt->addItem(tr("18 dB"));
-	ui->digiAtt->addItem(tr("24 dB"));
-	ui->digiAtt->addItem(tr("30 dB"));
-	ui->digiAtt->addItem(tr("36 dB"));
-	ui->digiAtt->addItem(tr("42 dB"));
-	ui->digiAtt->addItem(tr("48 dB"));
-	ui->digiAtt->blockSignals(blocked);
-
 	resetGUI();
 }
 
@@ -156,9 +154,14 @@ void MainWindow::on_nraRefLvl_currentIndexChanged(int index)
 	m_nraConnector->setReferenceLevel(ui->nraRefLvl->itemData(index).toFloat());
 }
 
-void MainWindow::on_digiAtt_currentIndexChanged(int index)
+void MainWindow::on_digiAtt_valueChanged(double value)
+{
+	m_nraConnector->setDigitalAttenuation(value);
+}
+
+void MainWindow::on_resamplerQuality_currentIndexChanged(int index)
 {
-	m_nraConnector->setDigitalAttenuation(index * 6);
+	m_nraConnector->setResamplerQuality(index);
 }
 
 void MainWindow::handleNRAStateReport(NRAConnector::ConnectorState state, const QString& text)
@@ -238,6 +241,10 @@ void MainWindow::loadSettings()
 	ui->nraStreamPort->setText(settings.value("nrastreamport", "55556").toString());
 	ui->rtlListenIP->setText(settings.value("rtllistenip", "0.0.0.0").toString());
 	ui->rtlListenPort->setText(settings.value("rtllistenport", "1234").toString());
+
+	bool blocked = ui->resamplerQuality->blockSignals(true);
+	ui->resamplerQuality->setCurrentIndex(settings.value("resamplerquality", 2).toInt());
+	ui->resamplerQuality->blockSignals(blocked);
 }
 
 void MainWindow::saveSettings()
@@ -249,4 +256,5 @@ void MainWindow::saveSettings()
 	settings.setValue("nrastreamport", ui->nraStreamPort->text());
 	settings.setValue("rtllistenip", ui->rtlListenIP->text());
 	settings.setValue("rtllistenport", ui->rtlListenPort->text());
+	settings.setValue("resamplerquality", ui->resamplerQuality->currentIndex());
 }
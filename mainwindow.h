@@ -46,7 +46,8 @@ public:
 protected slots:
 	void on_startButton_toggled(bool checked);
 	void on_nraRefLvl_currentIndexChanged(int index);
-	void on_digiAtt_currentIndexChanged(int index);
+	void on_digiAtt_valueChanged(double value);
+	void on_resamplerQuality_currentIndexChanged(int index);
 
 	void handleNRAStateReport(NRAConnector::ConnectorState state, const QString& text);
 	void handleNRADeviceInfo(const QString& productName, const QString& serial);
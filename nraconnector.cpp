@@ -36,8 +36,7 @@ NRAConnector::NRAConnector(QObject* parent) :
 	m_nraPort(),
 	m_nraState(NRAIdle),
 	m_rbwList(),
-	m_rlList(),
-	m_digitalAttenuation(0)
+	m_rlList()
 {
 	connect(&m_nraConnection, &QTcpSocket::stateChanged, this, &NRAConnector::handleNRAConnectionState);
 	connect(&m_nraConnection, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(handleNRAConnectionError(QAbstractSocket::SocketError)));
@@ -116,7 +115,14 @@ void NRAConnector::setAttenuation(float att)
 
 void NRAConnector::setDigitalAttenuation(float att)
 {
-	m_digitalAttenuation = (int)(att / 6.0);
+	m_rtlServer.setDigitalAttenuation(att);
+}
+
+void NRAConnector::setResamplerQuality(int quality)
+{
+	if((quality < SSEInterpolator::QualityLow) || (quality > SSEInterpolator::QualityExtreme))
+		quality = SSEInterpolator::QualityHigh;
+	m_rtlServer.setResamplerQuality((SSEInterpolator::Quality)quality);
 }
 
 const char* NRAConnector::getErrorString(int errorCode)
@@ -487,7 +493,7 @@ bool NRAConnector::handleStreamSamples()
 
 void NRAConnector::relaySamples(uint sampleRate, const IQSampleS16* samples, size_t sampleCount)
 {
-	m_rtlServer.relaySamples(sampleRate, samples, sampleCount, m_digitalAttenuation);
+	m_rtlServer.relaySamples(sampleRate, samples, sampleCount);
 }
 
 void NRAConnector::sendNextCommand()
@@ -78,6 +78,7 @@ public slots:
 	void setReferenceLevel(float rl);
 	void setAttenuation(float att);
 	void setDigitalAttenuation(float att);
+	void setResamplerQuality(int quality);
 
 signals:
 	void onStateReport(ConnectorState state, const QString& text);
@@ -171,7 +172,6 @@ protected:
 	float m_newReferenceLevel;
 	bool m_newAttenuationPending;
 	float m_newAttenuation;
-	int m_digitalAttenuation;
 
 	static const char* getErrorString(int errorCode);
 	int readNRAReturnCode();
@@ -28,7 +28,63 @@
 
 #include <QTcpSocket>
 #include <QtEndian>
+#include <math.h>
+#include <utility>
 #include "rtlserver.h"
+#include "simd.h"
+
+// the AVX2 kernel bodies are only used inlined, see simd.h
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// scale 2 * Lanes I/Q pairs per step in float and store them in the RTL format, returns the
+// pairs converted
+template<class V>
+static SIMD_INLINE size_t quantiseBlock(const IQSampleS16* samples, size_t sampleCount, float gain, quint8* dst)
+{
+	const typename V::Float factor = V::set1(gain);
+	size_t i = 0;
+	for(; i + 2 * V::Lanes <= sampleCount; i += 2 * V::Lanes) {
+		typename V::Float a;
+		typename V::Float b;
+		typename V::Float c;
+		typename V::Float d;
+		V::loadShortFloat((const qint16*)&samples[i], &a, &b);
+		V::loadShortFloat((const qint16*)&samples[i + V::Lanes], &c, &d);
+		V::storeBytes(&dst[i * 2], V::mul(a, factor), V::mul(b, factor), V::mul(c, factor), V::mul(d, factor));
+	}
+	return i;
+}
+
+SIMD_TARGET_AVX2
+static size_t quantiseBlockAVX2(const IQSampleS16* samples, size_t sampleCount, float gain, quint8* dst)
+{
+	return quantiseBlock<SIMD::AVX2>(samples, sampleCount, gain, dst);
+}
+
+// scale and quantise IQ samples straight to the RTL format, the low byte of each rounded
+// value is kept just like the (qint8) cast of the resampler output; the backend is the one
+// of the active interpolator, so a single setting selects the whole data path
+static void quantiseSamples(SIMD::Backend backend, const IQSampleS16* samples, size_t sampleCount, float gain, quint8* dst)
+{
+	size_t i;
+
+	switch(backend) {
+		case SIMD::BackendAVX2:
+			i = quantiseBlockAVX2(samples, sampleCount, gain, dst);
+			break;
+		case SIMD::BackendSSE2:
+			i = quantiseBlock<SIMD::SSE2>(samples, sampleCount, gain, dst);
+			break;
+		default:
+			i = quantiseBlock<SIMD::Scalar>(samples, sampleCount, gain, dst);
+			break;
+	}
+
+	for(; i < sampleCount; ++i) {
+		dst[i * 2] = (quint8)((qint8)lrintf(samples[i].i * gain) + 128);
+		dst[i * 2 + 1] = (quint8)((qint8)lrintf(samples[i].q * gain) + 128);
+	}
+}
 
 RTLServer::RTLServer(QObject* parent) :
 	QObject(parent)
@@ -36,6 +92,15 @@ RTLServer::RTLServer(QObject* parent) :
 	connect(&m_rtlServer, &QTcpServer::newConnection, this, &RTLServer::handleRTLServerNewConnection);
 	m_nraSampleRate = -1;
 	m_rtlSampleRate = 2000000.0;
+	m_resamplerQuality = SSEInterpolator::QualityHigh;
+	m_gain = 1.0f;
+	m_passthrough = false;
+	m_inputHistory.resize(InputHistory);
+	m_inputPos = 0;
+	m_inputFill = 0;
+	m_interpolator = &m_interpolators[0];
+	m_nextInterpolator = &m_interpolators[1];
+	m_switchPending = false;
 }
 
 bool RTLServer::open(const QHostAddress& rtlListenAddress, quint16 rtlListenPort)
@@ -61,73 +126,124 @@ void RTLServer::close()
 	m_rtlServer.close();
 }
 
-void RTLServer::relaySamples(uint sampleRate, const IQSampleS16* samples, size_t sampleCount, int shift)
+void RTLServer::setResamplerQuality(SSEInterpolator::Quality quality)
+{
+	m_resamplerQuality = quality;
+	prepareInterpolator();
+}
+
+void RTLServer::setDigitalAttenuation(float att)
+{
+	m_gain = powf(10.0f, -att / 20.0f);
+	prepareInterpolator();
+}
+
+// build the interpolator for the new RTL rate or quality now, so relaySamples() only has
+// to switch over to it; without a known NRA rate relaySamples() creates it anyway
+void RTLServer::prepareInterpolator()
+{
+	if(m_nraSampleRate <= 0)
+		return;
+
+	if(m_nraSampleRate != m_rtlSampleRate)
+		m_nextInterpolator->create((double)m_nraSampleRate, (double)m_rtlSampleRate, m_resamplerQuality, m_gain);
+	m_switchPending = true;
+}
+
+void RTLServer::relaySamples(uint sampleRate, const IQSampleS16* samples, size_t sampleCount)
 {
 	if(m_rtlSocket == nullptr)
 		return;
 
 	if((Real)sampleRate != m_nraSampleRate) {
+		// new input rate, there is no history to continue from
 		m_nraSampleRate = (Real)sampleRate;
-		/*
-		Real cutoff = m_nraSampleRate * 0.9;
-		if((m_rtlSampleRate * 0.9) < cutoff)
-			cutoff = m_rtlSampleRate * 0.9;
-		m_interpolator.create(16, m_nraSampleRate, cutoff);
-		*/
-		m_interpolator.create((double)m_nraSampleRate, (double)m_rtlSampleRate);
-		if(m_rtlSampleRate > 0.0)
-			m_interpolatorDistance = m_nraSampleRate / m_rtlSampleRate;
-		else m_interpolatorDistance = 1.0;
-		m_interpolatorDistanceRemain = m_interpolatorDistance;
-		qDebug("interpoaltor distance %f", (double)m_interpolatorDistance);
+		m_switchPending = false;
+		m_passthrough = (m_nraSampleRate == m_rtlSampleRate);
+		m_inputFill = 0;
+		if(m_passthrough) {
+			qDebug("RTLServer: sample rates match, passing samples through");
+		} else {
+			m_interpolator->create((double)m_nraSampleRate, (double)m_rtlSampleRate, m_resamplerQuality, m_gain);
+		}
+	} else if(m_switchPending) {
+		// the replacement continues with the raw input, so a longer filter than the active
+		// one gets its whole history as well
+		m_switchPending = false;
+		bool wasPassthrough = m_passthrough;
+		m_passthrough = (m_nraSampleRate == m_rtlSampleRate);
+		if(m_passthrough) {
+			if(!wasPassthrough)
+				qDebug("RTLServer: sample rates match, passing samples through");
+		} else {
+			continueFromInput(m_nextInterpolator);
+			std::swap(m_interpolator, m_nextInterpolator);
+		}
 	}
+	keepInputHistory(samples, sampleCount);
 
-	Complex outputSample;
-	while(sampleCount > 0) {
-		Complex inputSample(samples->i >> shift, samples->q >> shift);
-		for(bool consumed = false; !consumed; ) {
-			if(m_interpolator.interpolate(&m_interpolatorDistanceRemain, inputSample, &consumed, &outputSample)) {
-				m_buffer[m_bufferFill++] = (quint8)((qint8)(outputSample.real()) + 128);
-				m_buffer[m_bufferFill++] = (quint8)((qint8)(outputSample.imag()) + 128);
-
-				if(m_bufferFill >= ((int)sizeof(m_buffer) - 4)) {
-					m_rtlSocket->write((const char*)m_buffer, m_bufferFill);
-					m_bufferFill = 0;
-				}
-				m_interpolatorDistanceRemain += m_interpolatorDistance;
-			}
+	size_t outputCount = sampleCount;
+	if(!m_passthrough) {
+		size_t outputSize = 2 * m_interpolator->outputSize(sampleCount);
+		if(m_resampled.size() < outputSize)
+			m_resampled.resize(outputSize);
+		outputCount = m_interpolator->process(samples, sampleCount, 0, m_resampled.data());
+	}
+
+	const quint8* outputSample = m_resampled.data();
+	while(outputCount > 0) {
+		size_t block = (sizeof(m_buffer) - m_bufferFill) / 2;
+		if(block > outputCount)
+			block = outputCount;
+		if(m_passthrough) {
+			quantiseSamples(m_interpolator->backend(), samples, block, m_gain, &m_buffer[m_bufferFill]);
+			samples += block;
+		} else {
+			::memcpy(&m_buffer[m_bufferFill], outputSample, block * 2);
+			outputSample += block * 2;
+		}
+		m_bufferFill += block * 2;
+		outputCount -= block;
+
+		if(m_bufferFill >= ((int)sizeof(m_buffer) - 4)) {
+			m_rtlSocket->write((const char*)m_buffer, m_bufferFill);
+			m_bufferFill = 0;
 		}
-		++samples;
-		--sampleCount;
 	}
-#if 0
+}
 
-	Real sampleDistance = (Real)sampleRate / m_rtlSampleRate;
+void RTLServer::keepInputHistory(const IQSampleS16* samples, size_t sampleCount)
+{
+	const size_t size = m_inputHistory.size();
+	if(sampleCount > size) {
+		samples += sampleCount - size;
+		sampleCount = size;
+	}
 
 	while(sampleCount > 0) {
-		Real nextI = ((Real)samples->i);
-		Real nextQ = ((Real)samples->q);
-		bool consumed = false;
-
-		while(!consumed) {
-			Real resultI;
-			Real resultQ;
-			if(m_interpolator.next(&m_sampleDistance, nextI, nextQ, &consumed, &resultI, &resultQ)) {
-				m_buffer[m_bufferFill++] = (quint8)(resultI / 1.0) + 128;
-				m_buffer[m_bufferFill++] = (quint8)(resultQ / 1.0) + 128;
-
-				if(m_bufferFill >= ((int)sizeof(m_buffer) - 2)) {
-					m_rtlSocket->write((const char*)m_buffer, m_bufferFill);
-					m_bufferFill = 0;
-				}
-
-				m_sampleDistance += sampleDistance;
-			}
-		}
-		++samples;
-		--sampleCount;
+		size_t count = size - m_inputPos;
+		if(count > sampleCount)
+			count = sampleCount;
+		::memcpy(&m_inputHistory[m_inputPos], samples, count * sizeof(IQSampleS16));
+		m_inputPos = (m_inputPos + count) % size;
+		m_inputFill += count;
+		samples += count;
+		sampleCount -= count;
 	}
-#endif
+	if(m_inputFill > size)
+		m_inputFill = size;
+}
+
+// the ring holds its oldest samples from m_inputPos on once it is full
+void RTLServer::continueFromInput(SSEInterpolator* interpolator)
+{
+	const size_t size = m_inputHistory.size();
+	size_t oldest = (m_inputPos + size - m_inputFill) % size;
+	size_t first = size - oldest;
+	if(first > m_inputFill)
+		first = m_inputFill;
+	interpolator->continueFrom(&m_inputHistory[oldest], first, 0);
+	interpolator->continueFrom(&m_inputHistory[0], m_inputFill - first, 0);
 }
 
 void RTLServer::handleRTLServerNewConnection()
@@ -156,8 +272,6 @@ void RTLServer::handleRTLServerNewConnection()
 
 	m_nraSampleRate = -1;
 	m_bufferFill = 0;
-	m_interpolatorDistance = 1.0;
-	m_interpolatorDistanceRemain = 0.0;
 }
 
 void RTLServer::handleRTLConnectionState(QAbstractSocket::SocketState socketState)
@@ -212,7 +326,7 @@ void RTLServer::handleRTLConnectionReadyRead()
 			case 0x02:
 				qDebug("RTL: set sample rate %u", param);
 				m_rtlSampleRate = param;
-				m_nraSampleRate = -1; // force interpolator re-create
+				prepareInterpolator();
 				//rtlsdr_set_sample_rate(dev, ntohl(param));
 				break;
 			case 0x03:
@@ -31,6 +31,7 @@
 
 #include <QObject>
 #include <QTcpServer>
+#include <vector>
 #include "dsptypes.h"
 #include "sseinterpolator.h"
 
@@ -44,7 +45,10 @@ public:
 	const QString& errorString() const { return m_errorString; }
 	void close();
 
-	void relaySamples(uint sampleRate, const IQSampleS16* samples, size_t sampleCount, int shift);
+	void setResamplerQuality(SSEInterpolator::Quality quality);
+	// attenuation in dB, applied by the resampler filter
+	void setDigitalAttenuation(float att);
+	void relaySamples(uint sampleRate, const IQSampleS16* samples, size_t sampleCount);
 
 signals:
 	void onSetFCenter(quint32 fCenter);
@@ -70,12 +74,29 @@ protected:
 	QString m_errorString;
 	Real m_nraSampleRate;
 	Real m_rtlSampleRate;
-	SSEInterpolator m_interpolator;
-	Real m_interpolatorDistance;
-	Real m_interpolatorDistanceRemain;
+	SSEInterpolator::Quality m_resamplerQuality;
+	float m_gain; // digital attenuation as a factor
+	bool m_passthrough; // NRA and RTL rates match, samples are only scaled and quantised
+	// the newest input as a ring, every new interpolator continues from it; enough for the
+	// history of the longest preset behind its half-band stages
+	enum { InputHistory = 16384 };
+	std::vector<IQSampleS16> m_inputHistory;
+	size_t m_inputPos; // where the next sample goes
+	size_t m_inputFill;
+	// the active interpolator and its replacement, which is built as soon as the RTL rate or
+	// the quality changes and swapped in by relaySamples()
+	SSEInterpolator m_interpolators[2];
+	SSEInterpolator* m_interpolator;
+	SSEInterpolator* m_nextInterpolator;
+	bool m_switchPending;
+	std::vector<quint8> m_resampled; // interleaved 8 bit I/Q
 	quint8 m_buffer[4096];
 	int m_bufferFill;
 
+	void prepareInterpolator();
+	void keepInputHistory(const IQSampleS16* samples, size_t sampleCount);
+	void continueFromInput(SSEInterpolator* interpolator);
+
 protected slots:
 	void handleRTLServerNewConnection();
 	void handleRTLConnectionState(QAbstractSocket::SocketState socketState);
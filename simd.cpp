@@ -0,0 +1,88 @@
+/*
+ * This file is part of NRAConnector
+ * written by Christian Daniel 2016 -- <dg2ndk@afuz.org>
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2016 Amateurfunk Unterfranken e.V.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * File contents: SIMD backend selection
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "simd.h"
+
+bool SIMD::isSupported(Backend backend)
+{
+	switch(backend) {
+		case BackendScalar:
+			return true;
+#ifdef SIMD_HAVE_SSE2
+		case BackendSSE2:
+			return true;
+		case BackendAVX2: {
+			// evaluated once on first use, CPUID does not change while we run
+			static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+			return supported;
+		}
+#endif
+		default:
+			return false;
+	}
+}
+
+static SIMD::Backend chooseBackend()
+{
+	SIMD::Backend backend = SIMD::BackendScalar;
+	if(SIMD::isSupported(SIMD::BackendAVX2))
+		backend = SIMD::BackendAVX2;
+	else if(SIMD::isSupported(SIMD::BackendSSE2))
+		backend = SIMD::BackendSSE2;
+
+	// only a slower backend can be forced, for comparisons against the reference
+	const char* forced = getenv("NRACONNECTOR_SIMD");
+	if(forced != NULL) {
+		for(int b = SIMD::BackendScalar; b < backend; ++b) {
+			if(strcmp(forced, SIMD::backendName((SIMD::Backend)b)) == 0)
+				backend = (SIMD::Backend)b;
+		}
+	}
+	qDebug("SIMD backend %s", SIMD::backendName(backend));
+	return backend;
+}
+
+SIMD::Backend SIMD::defaultBackend()
+{
+	static const Backend backend = chooseBackend();
+	return backend;
+}
+
+const char* SIMD::backendName(Backend backend)
+{
+	switch(backend) {
+		case BackendSSE2:
+			return "sse2";
+		case BackendAVX2:
+			return "avx2";
+		default:
+			return "scalar";
+	}
+}
@@ -0,0 +1,402 @@
+/*
+ * This file is part of NRAConnector
+ * written by Christian Daniel 2016 -- <dg2ndk@afuz.org>
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2016 Amateurfunk Unterfranken e.V.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * File contents: SIMD backends the DSP kernels are written against
+ */
+
+#ifndef INCLUDE_SIMD_H
+#define INCLUDE_SIMD_H
+
+#include <math.h>
+#include "dsptypes.h"
+
+// The kernels are templates on a backend V and only use the operations below, so every
+// kernel runs on every backend. Building with SIMD_SCALAR_ONLY (or for a CPU without SSE2)
+// leaves the scalar backend only, SSE2 and AVX2 then fall back to it.
+#if defined(__SSE2__) && !defined(SIMD_SCALAR_ONLY)
+#define SIMD_HAVE_SSE2 1
+#include <immintrin.h>
+#endif
+
+#define SIMD_INLINE inline __attribute__((always_inline))
+
+// Kernels instantiated for the AVX2 backend need its instruction set enabled. Their bodies
+// are SIMD_INLINE templates without it, so the AVX2 operations cannot be forced inline there;
+// the one entry point per kernel carries SIMD_TARGET_AVX2, which flattens the body and the
+// operations into code built for AVX2. The out of line body copies are never emitted, files
+// instantiating AVX2 kernels silence their ABI warnings about passing AVX vectors (-Wpsabi).
+#ifdef SIMD_HAVE_SSE2
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2,fma"), flatten))
+#define SIMD_INLINE_AVX2 inline __attribute__((target("avx2,fma")))
+#else
+#define SIMD_TARGET_AVX2
+#define SIMD_INLINE_AVX2 SIMD_INLINE
+#endif
+
+class SIMD {
+public:
+	enum Backend {
+		BackendScalar, // plain C++ with the lane layout of SSE2, the reference for the others
+		BackendSSE2,
+		BackendAVX2 // AVX2 and FMA, checked at run time
+	};
+
+	static bool isSupported(Backend backend);
+	// the best supported backend, unless the environment variable NRACONNECTOR_SIMD asks
+	// for another one (scalar, sse2 or avx2)
+	static Backend defaultBackend();
+	static const char* backendName(Backend backend);
+
+	struct Scalar;
+	struct SSE2;
+	struct AVX2;
+};
+
+// Every backend has Lanes floats per Float, Lanes 32 bit integers per Int and 2 * Lanes 16 bit
+// integers per Short. Loads and stores are unaligned unless named otherwise.
+struct SIMD::Scalar {
+	enum { Lanes = 4 };
+	struct Float { float v[Lanes]; };
+	struct Int { qint32 v[Lanes]; };
+	struct Short { qint16 v[2 * Lanes]; };
+
+	static SIMD_INLINE Float zero() { return set1(0.0f); }
+	static SIMD_INLINE Float set1(float x)
+	{
+		Float r;
+		for(int n = 0; n < Lanes; n++)
+			r.v[n] = x;
+		return r;
+	}
+	static SIMD_INLINE Float load(const float* p)
+	{
+		Float r;
+		for(int n = 0; n < Lanes; n++)
+			r.v[n] = p[n];
+		return r;
+	}
+	static SIMD_INLINE Float loadAligned(const float* p) { return load(p); }
+	static SIMD_INLINE void store(float* p, Float a)
+	{
+		for(int n = 0; n < Lanes; n++)
+			p[n] = a.v[n];
+	}
+	static SIMD_INLINE Float add(Float a, Float b)
+	{
+		for(int n = 0; n < Lanes; n++)
+			a.v[n] += b.v[n];
+		return a;
+	}
+	static SIMD_INLINE Float sub(Float a, Float b)
+	{
+		for(int n = 0; n < Lanes; n++)
+			a.v[n] -= b.v[n];
+		return a;
+	}
+	static SIMD_INLINE Float mul(Float a, Float b)
+	{
+		for(int n = 0; n < Lanes; n++)
+			a.v[n] *= b.v[n];
+		return a;
+	}
+	// a * b + c, rounded twice like SSE2
+	static SIMD_INLINE Float madd(Float a, Float b, Float c) { return add(mul(a, b), c); }
+	static SIMD_INLINE Float reverse(Float a)
+	{
+		Float r;
+		for(int n = 0; n < Lanes; n++)
+			r.v[n] = a.v[Lanes - 1 - n];
+		return r;
+	}
+	// even and odd elements of the 2 * Lanes elements a, b
+	static SIMD_INLINE void deinterleave(Float a, Float b, Float* even, Float* odd)
+	{
+		for(int n = 0; n < Lanes / 2; n++) {
+			even->v[n] = a.v[2 * n];
+			even->v[n + Lanes / 2] = b.v[2 * n];
+			odd->v[n] = a.v[2 * n + 1];
+			odd->v[n + Lanes / 2] = b.v[2 * n + 1];
+		}
+	}
+	// sum the lanes of the I and the Q accumulator in the order of SSE2 and store them
+	static SIMD_INLINE void storeSum(Float sumI, Float sumQ, Complex* result)
+	{
+		float i = (sumI.v[0] + sumI.v[2]) + (sumI.v[1] + sumI.v[3]);
+		float q = (sumQ.v[0] + sumQ.v[2]) + (sumQ.v[1] + sumQ.v[3]);
+		*result = Complex(i, q);
+	}
+
+	static SIMD_INLINE Int zeroInt()
+	{
+		Int r;
+		for(int n = 0; n < Lanes; n++)
+			r.v[n] = 0;
+		return r;
+	}
+	static SIMD_INLINE Int addInt(Int a, Int b)
+	{
+		for(int n = 0; n < Lanes; n++)
+			a.v[n] += b.v[n];
+		return a;
+	}
+	static SIMD_INLINE Short loadShort(const qint16* p)
+	{
+		Short r;
+		for(int n = 0; n < 2 * Lanes; n++)
+			r.v[n] = p[n];
+		return r;
+	}
+	static SIMD_INLINE void storeShort(qint16* p, Short a)
+	{
+		for(int n = 0; n < 2 * Lanes; n++)
+			p[n] = a.v[n];
+	}
+	// products of neighbouring 16 bit elements summed pairwise into 32 bit lanes
+	static SIMD_INLINE Int maddShort(Short a, Short b)
+	{
+		Int r;
+		for(int n = 0; n < Lanes; n++)
+			r.v[n] = a.v[2 * n] * b.v[2 * n] + a.v[2 * n + 1] * b.v[2 * n + 1];
+		return r;
+	}
+	static SIMD_INLINE void sumInt(Int sumI, Int sumQ, qint32* i, qint32* q)
+	{
+		*i = 0;
+		*q = 0;
+		for(int n = 0; n < Lanes; n++) {
+			*i += sumI.v[n];
+			*q += sumQ.v[n];
+		}
+	}
+
+	// Lanes I/Q pairs split into I and Q, shifted right by shift
+	static SIMD_INLINE void loadIQ(const IQSampleS16* p, int shift, Float* i, Float* q)
+	{
+		for(int n = 0; n < Lanes; n++) {
+			i->v[n] = p[n].i >> shift;
+			q->v[n] = p[n].q >> shift;
+		}
+	}
+	// 2 * Lanes I/Q pairs, same in 16 bit
+	static SIMD_INLINE void loadIQShort(const IQSampleS16* p, int shift, Short* i, Short* q)
+	{
+		for(int n = 0; n < 2 * Lanes; n++) {
+			i->v[n] = p[n].i >> shift;
+			q->v[n] = p[n].q >> shift;
+		}
+	}
+	// 2 * Lanes 16 bit values as float, the first Lanes in lo
+	static SIMD_INLINE void loadShortFloat(const qint16* p, Float* lo, Float* hi)
+	{
+		for(int n = 0; n < Lanes; n++) {
+			lo->v[n] = p[n];
+			hi->v[n] = p[n + Lanes];
+		}
+	}
+	// round 4 * Lanes values to integers and store their low bytes offset by 128 (the
+	// unsigned 8 bit format of rtl_tcp), values beyond 16 bit saturate first
+	static SIMD_INLINE void storeBytes(quint8* p, Float a, Float b, Float c, Float d)
+	{
+		const Float* values[4] = { &a, &b, &c, &d };
+		for(int k = 0; k < 4; k++) {
+			for(int n = 0; n < Lanes; n++) {
+				long r = lrintf(values[k]->v[n]);
+				if(r > 32767)
+					r = 32767;
+				else if(r < -32768)
+					r = -32768;
+				p[k * Lanes + n] = (quint8)((r & 0xff) ^ 0x80);
+			}
+		}
+	}
+};
+
+#ifdef SIMD_HAVE_SSE2
+
+struct SIMD::SSE2 {
+	enum { Lanes = 4 };
+	typedef __m128 Float;
+	typedef __m128i Int;
+	typedef __m128i Short;
+
+	static SIMD_INLINE Float zero() { return _mm_setzero_ps(); }
+	static SIMD_INLINE Float set1(float x) { return _mm_set1_ps(x); }
+	static SIMD_INLINE Float load(const float* p) { return _mm_loadu_ps(p); }
+	static SIMD_INLINE Float loadAligned(const float* p) { return _mm_load_ps(p); }
+	static SIMD_INLINE void store(float* p, Float a) { _mm_storeu_ps(p, a); }
+	static SIMD_INLINE Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+	static SIMD_INLINE Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+	static SIMD_INLINE Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+	static SIMD_INLINE Float madd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+	static SIMD_INLINE Float reverse(Float a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)); }
+	static SIMD_INLINE void deinterleave(Float a, Float b, Float* even, Float* odd)
+	{
+		*even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		*odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+	static SIMD_INLINE void storeSum(Float sumI, Float sumQ, Complex* result)
+	{
+		// add upper half to lower half of the interleaved I/Q accumulators
+		__m128 sum = _mm_add_ps(_mm_unpacklo_ps(sumI, sumQ), _mm_unpackhi_ps(sumI, sumQ));
+		_mm_storel_pi((__m64*)result, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+	}
+
+	static SIMD_INLINE Int zeroInt() { return _mm_setzero_si128(); }
+	static SIMD_INLINE Int addInt(Int a, Int b) { return _mm_add_epi32(a, b); }
+	static SIMD_INLINE Short loadShort(const qint16* p) { return _mm_loadu_si128((const __m128i*)p); }
+	static SIMD_INLINE void storeShort(qint16* p, Short a) { _mm_storeu_si128((__m128i*)p, a); }
+	static SIMD_INLINE Int maddShort(Short a, Short b) { return _mm_madd_epi16(a, b); }
+	static SIMD_INLINE void sumInt(Int sumI, Int sumQ, qint32* i, qint32* q)
+	{
+		// I in the low, Q in the high 64 bit, then add the neighbouring lanes
+		__m128i sum = _mm_add_epi32(_mm_unpacklo_epi64(sumI, sumQ), _mm_unpackhi_epi64(sumI, sumQ));
+		sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+		*i = _mm_cvtsi128_si32(sum);
+		*q = _mm_cvtsi128_si32(_mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 2, 2, 2)));
+	}
+
+	static SIMD_INLINE void loadIQ(const IQSampleS16* p, int shift, Float* i, Float* q)
+	{
+		// Q is the upper, I the lower half of each 32 bit word
+		const __m128i count = _mm_cvtsi32_si128(16 + shift);
+		__m128i v = _mm_loadu_si128((const __m128i*)p);
+		*i = _mm_cvtepi32_ps(_mm_sra_epi32(_mm_slli_epi32(v, 16), count));
+		*q = _mm_cvtepi32_ps(_mm_sra_epi32(v, count));
+	}
+	static SIMD_INLINE void loadIQShort(const IQSampleS16* p, int shift, Short* i, Short* q)
+	{
+		// split and shifted in 32 bit lanes, then packed back to 16 bit
+		const __m128i count = _mm_cvtsi32_si128(16 + shift);
+		__m128i a = _mm_loadu_si128((const __m128i*)p);
+		__m128i b = _mm_loadu_si128((const __m128i*)(p + 4));
+		*i = _mm_packs_epi32(_mm_sra_epi32(_mm_slli_epi32(a, 16), count), _mm_sra_epi32(_mm_slli_epi32(b, 16), count));
+		*q = _mm_packs_epi32(_mm_sra_epi32(a, count), _mm_sra_epi32(b, count));
+	}
+	static SIMD_INLINE void loadShortFloat(const qint16* p, Float* lo, Float* hi)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)p);
+		*lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+		*hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+	}
+	static SIMD_INLINE void storeBytes(quint8* p, Float a, Float b, Float c, Float d)
+	{
+		const __m128i lowByte = _mm_set1_epi16(0xff);
+		__m128i ab = _mm_and_si128(_mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)), lowByte);
+		__m128i cd = _mm_and_si128(_mm_packs_epi32(_mm_cvtps_epi32(c), _mm_cvtps_epi32(d)), lowByte);
+		_mm_storeu_si128((__m128i*)p, _mm_xor_si128(_mm_packus_epi16(ab, cd), _mm_set1_epi8((char)0x80)));
+	}
+};
+
+// same operations eight lanes wide; results differ from the others in the last bits, the
+// fused multiply-add rounds once and sums run over eight lanes in a different order
+struct SIMD::AVX2 {
+	enum { Lanes = 8 };
+	typedef __m256 Float;
+	typedef __m256i Int;
+	typedef __m256i Short;
+
+	static SIMD_INLINE_AVX2 Float zero() { return _mm256_setzero_ps(); }
+	static SIMD_INLINE_AVX2 Float set1(float x) { return _mm256_set1_ps(x); }
+	static SIMD_INLINE_AVX2 Float load(const float* p) { return _mm256_loadu_ps(p); }
+	static SIMD_INLINE_AVX2 Float loadAligned(const float* p) { return _mm256_load_ps(p); }
+	static SIMD_INLINE_AVX2 void store(float* p, Float a) { _mm256_storeu_ps(p, a); }
+	static SIMD_INLINE_AVX2 Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+	static SIMD_INLINE_AVX2 Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+	static SIMD_INLINE_AVX2 Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+	static SIMD_INLINE_AVX2 Float madd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+	static SIMD_INLINE_AVX2 Float reverse(Float a) { return _mm256_permutevar8x32_ps(a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+	static SIMD_INLINE_AVX2 void deinterleave(Float a, Float b, Float* even, Float* odd)
+	{
+		// the shuffles work per 128 bit half, the 64 bit permute puts the halves in order
+		*even = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0)));
+		*odd = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+	static SIMD_INLINE_AVX2 void storeSum(Float sumI, Float sumQ, Complex* result)
+	{
+		// fold 256 -> 128 bit, then as SSE2
+		__m128 sumI128 = _mm_add_ps(_mm256_castps256_ps128(sumI), _mm256_extractf128_ps(sumI, 1));
+		__m128 sumQ128 = _mm_add_ps(_mm256_castps256_ps128(sumQ), _mm256_extractf128_ps(sumQ, 1));
+		SSE2::storeSum(sumI128, sumQ128, result);
+	}
+
+	static SIMD_INLINE_AVX2 Int zeroInt() { return _mm256_setzero_si256(); }
+	static SIMD_INLINE_AVX2 Int addInt(Int a, Int b) { return _mm256_add_epi32(a, b); }
+	static SIMD_INLINE_AVX2 Short loadShort(const qint16* p) { return _mm256_loadu_si256((const __m256i*)p); }
+	static SIMD_INLINE_AVX2 void storeShort(qint16* p, Short a) { _mm256_storeu_si256((__m256i*)p, a); }
+	static SIMD_INLINE_AVX2 Int maddShort(Short a, Short b) { return _mm256_madd_epi16(a, b); }
+	static SIMD_INLINE_AVX2 void sumInt(Int sumI, Int sumQ, qint32* i, qint32* q)
+	{
+		__m128i sumI128 = _mm_add_epi32(_mm256_castsi256_si128(sumI), _mm256_extracti128_si256(sumI, 1));
+		__m128i sumQ128 = _mm_add_epi32(_mm256_castsi256_si128(sumQ), _mm256_extracti128_si256(sumQ, 1));
+		SSE2::sumInt(sumI128, sumQ128, i, q);
+	}
+
+	static SIMD_INLINE_AVX2 void loadIQ(const IQSampleS16* p, int shift, Float* i, Float* q)
+	{
+		const __m128i count = _mm_cvtsi32_si128(16 + shift);
+		__m256i v = _mm256_loadu_si256((const __m256i*)p);
+		*i = _mm256_cvtepi32_ps(_mm256_sra_epi32(_mm256_slli_epi32(v, 16), count));
+		*q = _mm256_cvtepi32_ps(_mm256_sra_epi32(v, count));
+	}
+	static SIMD_INLINE_AVX2 void loadIQShort(const IQSampleS16* p, int shift, Short* i, Short* q)
+	{
+		// the pack works per 128 bit half, the 64 bit permute puts the halves in order
+		const __m128i count = _mm_cvtsi32_si128(16 + shift);
+		__m256i a = _mm256_loadu_si256((const __m256i*)p);
+		__m256i b = _mm256_loadu_si256((const __m256i*)(p + 8));
+		__m256i valuesI = _mm256_packs_epi32(_mm256_sra_epi32(_mm256_slli_epi32(a, 16), count), _mm256_sra_epi32(_mm256_slli_epi32(b, 16), count));
+		__m256i valuesQ = _mm256_packs_epi32(_mm256_sra_epi32(a, count), _mm256_sra_epi32(b, count));
+		*i = _mm256_permute4x64_epi64(valuesI, _MM_SHUFFLE(3, 1, 2, 0));
+		*q = _mm256_permute4x64_epi64(valuesQ, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+	static SIMD_INLINE_AVX2 void loadShortFloat(const qint16* p, Float* lo, Float* hi)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)p);
+		*lo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(v)));
+		*hi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1)));
+	}
+	static SIMD_INLINE_AVX2 void storeBytes(quint8* p, Float a, Float b, Float c, Float d)
+	{
+		// both packs work per 128 bit half, which leaves the 32 bit groups in the order
+		// a0 b0 c0 d0 a1 b1 c1 d1
+		const __m256i lowByte = _mm256_set1_epi16(0xff);
+		__m256i ab = _mm256_and_si256(_mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b)), lowByte);
+		__m256i cd = _mm256_and_si256(_mm256_packs_epi32(_mm256_cvtps_epi32(c), _mm256_cvtps_epi32(d)), lowByte);
+		__m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(ab, cd), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+		_mm256_storeu_si256((__m256i*)p, _mm256_xor_si256(bytes, _mm256_set1_epi8((char)0x80)));
+	}
+};
+
+#else // SIMD_HAVE_SSE2
+
+struct SIMD::SSE2 : SIMD::Scalar {
+};
+
+struct SIMD::AVX2 : SIMD::Scalar {
+};
+
+#endif // SIMD_HAVE_SSE2
+
+#endif // INCLUDE_SIMD_H
@@ -28,9317 +28,1340 @@
 
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <string.h>
+#include <map>
+#include <mutex>
 #include <vector>
 #include "sseinterpolator.h"
 
-static const float H1[1024] = {
-	-0.0008893331396,-4.732782691e-05,-4.889212505e-05,-4.982238534e-05,-5.138900815e-05,
-	-5.230587703e-05,-5.384958786e-05,-5.472069824e-05,-5.621161108e-05,-5.700842303e-05,
-	-5.843210602e-05,-5.915071233e-05,-6.053416655e-05,-6.121757906e-05,-6.26438341e-05,
-	-6.337016384e-05,-6.493450201e-05,-6.564905198e-05,-6.717541692e-05,-6.660934741e-05,
-	-6.837227556e-05,-6.916497659e-05,-6.999480684e-05,-7.064391684e-05,-7.155059575e-05,
-	-7.205086877e-05,-7.290861686e-05,-7.328718493e-05,-7.407579687e-05,-7.435524458e-05,
-	-7.508703857e-05,-7.529034337e-05,-7.597069634e-05,-7.607858424e-05,-7.665008161e-05,
-	-7.656809612e-05,-7.696734974e-05,-7.672266656e-05,-7.729449862e-05,-7.702710718e-05,
-	-7.707354962e-05,-7.684456796e-05,-7.683815056e-05,-7.638840179e-05,-7.628332241e-05,
-	-7.567814464e-05,-7.545598783e-05,-7.471356366e-05,-7.437010936e-05,-7.34833302e-05,
-	-7.299361459e-05,-7.193328929e-05,-7.127283607e-05,-7.004495274e-05,-6.926165952e-05,
-	-6.792887871e-05,-6.703572581e-05,-6.545301585e-05,-6.429720088e-05,-6.272365863e-05,
-	-6.137101445e-05,-5.956240057e-05,-5.810309449e-05,-5.611186134e-05,-5.450077515e-05,
-	-5.233995034e-05,-5.056077498e-05,-4.821783295e-05,-4.62578646e-05,-4.373426782e-05,
-	-4.160898607e-05,-3.893098983e-05,-3.665355689e-05,-3.380026101e-05,-3.131765698e-05,
-	-2.825454612e-05,-2.56233925e-05,-2.246203439e-05,-1.957759741e-05,-1.623394746e-05,
-	-1.323994729e-05,-9.691357263e-06,-6.53629877e-06,-2.812635785e-06,5.174081252e-07,
-	4.412242106e-06,7.906596693e-06, 1.19565093e-05,1.560121746e-05, 1.98048092e-05,
-	2.36160904e-05,2.799152207e-05,3.196590478e-05,3.647541234e-05,4.057168917e-05,
-	4.522686504e-05,4.951467417e-05,5.426998541e-05,5.866292486e-05,6.359614781e-05,
-	6.809878687e-05,7.315848052e-05,7.778404688e-05,8.295005682e-05,8.768127736e-05,
-	9.294644406e-05,9.778091044e-05,0.0001031489737,0.0001080851507,0.0001135383791,
-	0.0001185456422,0.0001240614947,0.0001291441877, 0.000134740505,0.0001398868772,
-	0.0001455021265,0.0001507079724,0.0001563982805,0.0001616080845,0.0001673334482,
-	0.0001725673501,0.0001782969484,0.0001835443545,0.0001892771543,0.0001945275435,
-	0.0002002502006,0.0002054796496,0.0002111665381,0.0002163586323,0.0002220072929,
-	0.0002271603735,0.0002327513066,  0.00023782895,0.0002433409536,0.0002483608841,
-	0.0002537857217,0.0002586779301,0.0002640138846,0.0002687915985,0.0002739961201,
-	0.0002786552359,0.0002837184293,0.0002882311237,0.0002931314812,0.0002974739182,
-	0.0003021972661,0.0003063617914,0.0003108965175,0.0003148589167,0.0003191762662,
-	0.0003229184949,0.0003270157322,0.0003305277787,0.0003343634889,0.0003376106906,
-	0.000341205392,0.0003441733134,0.0003474818368,0.0003501730098,0.0003531732946,
-	0.0003555571602,0.0003582380305, 0.000360299251,0.0003626508114,0.0003643748641,
-	0.0003663745592,0.0003677377535,0.0003693713807,0.0003703667899,0.0003716209903,
-	0.0003722207912,0.0003730698663,0.0003732742625,0.0003737241786,0.0003734958882,
-	0.0003735201608, 0.000372867391,0.0003724379349,0.0003713437764,0.0003704615519,
-	0.0003689102014,0.0003675634798,0.0003655384935,0.0003637109476,0.0003612036235,
-	0.0003588897234,0.0003558894387,0.0003530718386, 0.000349564536,0.0003462423629,
-	0.0003422315931,0.0003383891017,0.0003338468086,0.0003294868802, 0.000324420078,
-	0.0003195180907,0.0003139296605,0.0003084904165,0.0003023628087,0.0002963831066,
-	0.0002897118393,0.0002831897582,0.0002759770432,0.0002689094399, 0.000261149311,
-	0.0002535349922,0.0002452342305,0.0002370793954,0.0002282343048,0.0002195290872,
-	0.000210143422,0.0002009073942,0.0001909827115,0.0001812073315,0.0001707639312,
-	0.0001604540739,0.0001494852768,0.0001386573131,0.0001271723449,  0.00011583577,
-	0.0001038453702,9.200619388e-05,7.952247688e-05,6.719773228e-05,5.423620314e-05,
-	4.143402111e-05,2.800168841e-05,1.473866359e-05,8.623009649e-07,-1.284179234e-05,
-	-2.715662231e-05,-4.12848276e-05,-5.600685836e-05,-7.054986054e-05,-8.566321776e-05,
-	-0.0001005867234,-0.0001160747997,-0.0001313574321,-0.0001471954747,-0.0001628155005,
-	-0.0001789742382,-0.0001949050493,-0.0002113626979,-0.0002275815496,-0.0002443075064,
-	-0.0002607786155,-0.0002777411719,-0.0002944419684,-0.0003116161097,-0.0003285077109,
-	-0.000345857814,-0.0003629184212,-0.0003804055159,-0.0003975930158,-0.0004151936155,
-	-0.0004324700858,-0.0004501446383,-0.0004674763186,-0.0004851855047,-0.0005025381688,
-	-0.0005202460452,-0.0005375774927,-0.0005552396178,-0.0005725100054,-0.0005900915712,
-	-0.0006072635297,-0.0006247191341,-0.0006417456898,-0.0006590376724,-0.0006758798263,
-	-0.0006929559167,-0.0007095716428,-0.0007263971493,-0.0007427334203,-0.0007592631155,
-	-0.0007752798847,-0.0007914663292,-0.0008071202901,-0.0008229142404,-0.0008381549269,
-	-0.0008535120287,-0.0008682976477,-0.0008831725572,-0.0008974521188,-0.0009117936133,
-	-0.0009255218902,-0.0009392870707,-0.0009524127236,-0.0009655489121,-0.0009780317778,
-	-0.0009904929902,-0.001002275618,-0.001014019712,-0.001025057747,-0.001036031521,
-	-0.001046278747,-0.001056431793,-0.001065841527,-0.001075132401,-0.001083657844,
-	-0.00109203544,-0.001099626999,-0.001107047428,-0.001113662496,-0.001120079192,
-	-0.001125668059,-0.001131037599,-0.001135561382,-0.001139835222,-0.001143246191,
-	-0.001146388822,-0.001148641226,-0.001150605152,-0.001151662203,-0.001152405282,
-	-0.001152228564,-0.001151712378,-0.001150257885,-0.001148442156,-0.001145673916,
-	-0.001142524183,-0.001138405176,-0.001133882673,-0.001128377859,-0.001122452202,
-	-0.001115527819,-0.001108161523,-0.001099788235,-0.001090954524,-0.001081095659,
-	-0.00107076636,  -0.0010594005,-0.001047544996,-0.001034646295,-0.001021238277,
-	-0.001006779494,-0.0009918001015,-0.0009757612133,-0.000959187746,-0.0009415472159,
-	-0.0009233617457,-0.0009041042067, -0.00088429061,-0.0008633978432,-0.000841941277,
-	-0.0008194052498,-0.0007962930831,-0.0007720984868,-0.0007473275182,-0.0007214691723,
-	-0.000695026014,-0.0006675000768,-0.0006393809454,-0.000610184914,-0.0005803929525,
-	-0.0005495243822,-0.0005180581938,-0.0004855211882,-0.0004523872631,-0.0004181870609,
-	-0.0003833896772,-0.0003475338453,-0.0003110854013,-0.0002735868329,-0.0002354963217,
-	-0.0001963684626,-0.0001566562423,-0.0001159123203,-7.459215703e-05,-3.225679393e-05,
-	1.065048309e-05, 5.45550356e-05, 9.90240369e-05,0.0001444769005,0.0001904802048,
-	0.0002374504256,0.0002849594166,0.0003334179637,0.0003824011073, 0.000432312343,
-	0.0004827330704,0.0005340619828,0.0005858847871, 0.000638589845,0.0006917732535,
-	0.0007458175533,0.0008003163966,0.0008556502289,0.0009114227723,0.0009679995128,
-	0.001024996047,  0.00108276878, 0.001140934997, 0.001199851045, 0.001259136712,
-	0.001319140778, 0.001379488152,  0.00144052261, 0.001501874765, 0.001563881407,
-	0.001626177342, 0.001689093071, 0.001752271783, 0.001816034317, 0.001880026073,
-	0.001944569638, 0.002009313554, 0.002074567834, 0.002139993245, 0.002205890371,
-	0.002271924866, 0.002338395687, 0.002404967789,  0.00247193547, 0.002538971603,
-	0.002606363734, 0.002673789626, 0.002741528675, 0.002809266327, 0.002877275692,
-	0.00294524827, 0.003013447626, 0.003081573406, 0.003149887314, 0.003218088299,
-	0.003286431078, 0.003354626708, 0.003422918497, 0.003491025185, 0.003559186356,
-	0.003627119819, 0.003695064923, 0.003762745764, 0.003830392612, 0.003897735616,
-	0.003964999691, 0.004031921271, 0.004098719452, 0.004165136255, 0.004231383558,
-	0.004297212232, 0.004362828098, 0.004427982494, 0.004492880777, 0.004557281733,
-	0.004621378612, 0.004684941377, 0.004748156294, 0.004810796585,  0.00487304898,
-	0.004934688564, 0.004995893687, 0.005056450609, 0.005116530694, 0.005175925791,
-	0.005234800745,  0.00529295532, 0.005350547843, 0.005407385528, 0.005463619251,
-	0.005519061815, 0.005573863164, 0.005627838895, 0.005681131035,  0.00573356729,
-	0.005785281304,  0.00583610544, 0.005886172876,  0.00593531644, 0.005983665586,
-	0.006031064317, 0.006077631842, 0.006123219151, 0.006167940795,  0.00621165568,
-	0.006254470907,   0.0062962519, 0.006337101106, 0.006376891397, 0.006415720563,
-	0.006453464739, 0.006490217522, 0.006525866222, 0.006560492795, 0.006593993865,
-	0.006626447663, 0.006657753605, 0.006687988527, 0.006717059761, 0.006745032966,
-	0.006771826185, 0.006797499955, 0.006821978837, 0.006845317315, 0.006867446005,
-	0.006888416596, 0.006908165757, 0.006926740054, 0.006944080349, 0.006960230414,
-	0.006975140888, 0.006988843903, 0.007001300808, 0.007012539543, 0.007022525184,
-	0.007031283807, 0.007038786076, 0.007045049686, 0.007050057407, 0.007053819485,
-	0.007056324743, 0.007057579234, 0.007057579234, 0.007056324743, 0.007053819485,
-	0.007050057407, 0.007045049686, 0.007038786076, 0.007031283807, 0.007022525184,
-	0.007012539543, 0.007001300808, 0.006988843903, 0.006975140888, 0.006960230414,
-	0.006944080349, 0.006926740054, 0.006908165757, 0.006888416596, 0.006867446005,
-	0.006845317315, 0.006821978837, 0.006797499955, 0.006771826185, 0.006745032966,
-	0.006717059761, 0.006687988527, 0.006657753605, 0.006626447663, 0.006593993865,
-	0.006560492795, 0.006525866222, 0.006490217522, 0.006453464739, 0.006415720563,
-	0.006376891397, 0.006337101106,   0.0062962519, 0.006254470907,  0.00621165568,
-	0.006167940795, 0.006123219151, 0.006077631842, 0.006031064317, 0.005983665586,
-	0.00593531644, 0.005886172876,  0.00583610544, 0.005785281304,  0.00573356729,
-	0.005681131035, 0.005627838895, 0.005573863164, 0.005519061815, 0.005463619251,
-	0.005407385528, 0.005350547843,  0.00529295532, 0.005234800745, 0.005175925791,
-	0.005116530694, 0.005056450609, 0.004995893687, 0.004934688564,  0.00487304898,
-	0.004810796585, 0.004748156294, 0.004684941377, 0.004621378612, 0.004557281733,
-	0.004492880777, 0.004427982494, 0.004362828098, 0.004297212232, 0.004231383558,
-	0.004165136255, 0.004098719452, 0.004031921271, 0.003964999691, 0.003897735616,
-	0.003830392612, 0.003762745764, 0.003695064923, 0.003627119819, 0.003559186356,
-	0.003491025185, 0.003422918497, 0.003354626708, 0.003286431078, 0.003218088299,
-	0.003149887314, 0.003081573406, 0.003013447626,  0.00294524827, 0.002877275692,
-	0.002809266327, 0.002741528675, 0.002673789626, 0.002606363734, 0.002538971603,
-	0.00247193547, 0.002404967789, 0.002338395687, 0.002271924866, 0.002205890371,
-	0.002139993245, 0.002074567834, 0.002009313554, 0.001944569638, 0.001880026073,
-	0.001816034317, 0.001752271783, 0.001689093071, 0.001626177342, 0.001563881407,
-	0.001501874765,  0.00144052261, 0.001379488152, 0.001319140778, 0.001259136712,
-	0.001199851045, 0.001140934997,  0.00108276878, 0.001024996047,0.0009679995128,
-	0.0009114227723,0.0008556502289,0.0008003163966,0.0007458175533,0.0006917732535,
-	0.000638589845,0.0005858847871,0.0005340619828,0.0004827330704, 0.000432312343,
-	0.0003824011073,0.0003334179637,0.0002849594166,0.0002374504256,0.0001904802048,
-	0.0001444769005, 9.90240369e-05, 5.45550356e-05,1.065048309e-05,-3.225679393e-05,
-	-7.459215703e-05,-0.0001159123203,-0.0001566562423,-0.0001963684626,-0.0002354963217,
-	-0.0002735868329,-0.0003110854013,-0.0003475338453,-0.0003833896772,-0.0004181870609,
-	-0.0004523872631,-0.0004855211882,-0.0005180581938,-0.0005495243822,-0.0005803929525,
-	-0.000610184914,-0.0006393809454,-0.0006675000768,-0.000695026014,-0.0007214691723,
-	-0.0007473275182,-0.0007720984868,-0.0007962930831,-0.0008194052498,-0.000841941277,
-	-0.0008633978432, -0.00088429061,-0.0009041042067,-0.0009233617457,-0.0009415472159,
-	-0.000959187746,-0.0009757612133,-0.0009918001015,-0.001006779494,-0.001021238277,
-	-0.001034646295,-0.001047544996,  -0.0010594005, -0.00107076636,-0.001081095659,
-	-0.001090954524,-0.001099788235,-0.001108161523,-0.001115527819,-0.001122452202,
-	-0.001128377859,-0.001133882673,-0.001138405176,-0.001142524183,-0.001145673916,
-	-0.001148442156,-0.001150257885,-0.001151712378,-0.001152228564,-0.001152405282,
-	-0.001151662203,-0.001150605152,-0.001148641226,-0.001146388822,-0.001143246191,
-	-0.001139835222,-0.001135561382,-0.001131037599,-0.001125668059,-0.001120079192,
-	-0.001113662496,-0.001107047428,-0.001099626999, -0.00109203544,-0.001083657844,
-	-0.001075132401,-0.001065841527,-0.001056431793,-0.001046278747,-0.001036031521,
-	-0.001025057747,-0.001014019712,-0.001002275618,-0.0009904929902,-0.0009780317778,
-	-0.0009655489121,-0.0009524127236,-0.0009392870707,-0.0009255218902,-0.0009117936133,
-	-0.0008974521188,-0.0008831725572,-0.0008682976477,-0.0008535120287,-0.0008381549269,
-	-0.0008229142404,-0.0008071202901,-0.0007914663292,-0.0007752798847,-0.0007592631155,
-	-0.0007427334203,-0.0007263971493,-0.0007095716428,-0.0006929559167,-0.0006758798263,
-	-0.0006590376724,-0.0006417456898,-0.0006247191341,-0.0006072635297,-0.0005900915712,
-	-0.0005725100054,-0.0005552396178,-0.0005375774927,-0.0005202460452,-0.0005025381688,
-	-0.0004851855047,-0.0004674763186,-0.0004501446383,-0.0004324700858,-0.0004151936155,
-	-0.0003975930158,-0.0003804055159,-0.0003629184212,-0.000345857814,-0.0003285077109,
-	-0.0003116161097,-0.0002944419684,-0.0002777411719,-0.0002607786155,-0.0002443075064,
-	-0.0002275815496,-0.0002113626979,-0.0001949050493,-0.0001789742382,-0.0001628155005,
-	-0.0001471954747,-0.0001313574321,-0.0001160747997,-0.0001005867234,-8.566321776e-05,
-	-7.054986054e-05,-5.600685836e-05,-4.12848276e-05,-2.715662231e-05,-1.284179234e-05,
-	8.623009649e-07,1.473866359e-05,2.800168841e-05,4.143402111e-05,5.423620314e-05,
-	6.719773228e-05,7.952247688e-05,9.200619388e-05,0.0001038453702,  0.00011583577,
-	0.0001271723449,0.0001386573131,0.0001494852768,0.0001604540739,0.0001707639312,
-	0.0001812073315,0.0001909827115,0.0002009073942, 0.000210143422,0.0002195290872,
-	0.0002282343048,0.0002370793954,0.0002452342305,0.0002535349922, 0.000261149311,
-	0.0002689094399,0.0002759770432,0.0002831897582,0.0002897118393,0.0002963831066,
-	0.0003023628087,0.0003084904165,0.0003139296605,0.0003195180907, 0.000324420078,
-	0.0003294868802,0.0003338468086,0.0003383891017,0.0003422315931,0.0003462423629,
-	0.000349564536,0.0003530718386,0.0003558894387,0.0003588897234,0.0003612036235,
-	0.0003637109476,0.0003655384935,0.0003675634798,0.0003689102014,0.0003704615519,
-	0.0003713437764,0.0003724379349, 0.000372867391,0.0003735201608,0.0003734958882,
-	0.0003737241786,0.0003732742625,0.0003730698663,0.0003722207912,0.0003716209903,
-	0.0003703667899,0.0003693713807,0.0003677377535,0.0003663745592,0.0003643748641,
-	0.0003626508114, 0.000360299251,0.0003582380305,0.0003555571602,0.0003531732946,
-	0.0003501730098,0.0003474818368,0.0003441733134, 0.000341205392,0.0003376106906,
-	0.0003343634889,0.0003305277787,0.0003270157322,0.0003229184949,0.0003191762662,
-	0.0003148589167,0.0003108965175,0.0003063617914,0.0003021972661,0.0002974739182,
-	0.0002931314812,0.0002882311237,0.0002837184293,0.0002786552359,0.0002739961201,
-	0.0002687915985,0.0002640138846,0.0002586779301,0.0002537857217,0.0002483608841,
-	0.0002433409536,  0.00023782895,0.0002327513066,0.0002271603735,0.0002220072929,
-	0.0002163586323,0.0002111665381,0.0002054796496,0.0002002502006,0.0001945275435,
-	0.0001892771543,0.0001835443545,0.0001782969484,0.0001725673501,0.0001673334482,
-	0.0001616080845,0.0001563982805,0.0001507079724,0.0001455021265,0.0001398868772,
-	0.000134740505,0.0001291441877,0.0001240614947,0.0001185456422,0.0001135383791,
-	0.0001080851507,0.0001031489737,9.778091044e-05,9.294644406e-05,8.768127736e-05,
-	8.295005682e-05,7.778404688e-05,7.315848052e-05,6.809878687e-05,6.359614781e-05,
-	5.866292486e-05,5.426998541e-05,4.951467417e-05,4.522686504e-05,4.057168917e-05,
-	3.647541234e-05,3.196590478e-05,2.799152207e-05, 2.36160904e-05, 1.98048092e-05,
-	1.560121746e-05, 1.19565093e-05,7.906596693e-06,4.412242106e-06,5.174081252e-07,
-	-2.812635785e-06,-6.53629877e-06,-9.691357263e-06,-1.323994729e-05,-1.623394746e-05,
-	-1.957759741e-05,-2.246203439e-05,-2.56233925e-05,-2.825454612e-05,-3.131765698e-05,
-	-3.380026101e-05,-3.665355689e-05,-3.893098983e-05,-4.160898607e-05,-4.373426782e-05,
-	-4.62578646e-05,-4.821783295e-05,-5.056077498e-05,-5.233995034e-05,-5.450077515e-05,
-	-5.611186134e-05,-5.810309449e-05,-5.956240057e-05,-6.137101445e-05,-6.272365863e-05,
-	-6.429720088e-05,-6.545301585e-05,-6.703572581e-05,-6.792887871e-05,-6.926165952e-05,
-	-7.004495274e-05,-7.127283607e-05,-7.193328929e-05,-7.299361459e-05,-7.34833302e-05,
-	-7.437010936e-05,-7.471356366e-05,-7.545598783e-05,-7.567814464e-05,-7.628332241e-05,
-	-7.638840179e-05,-7.683815056e-05,-7.684456796e-05,-7.707354962e-05,-7.702710718e-05,
-	-7.729449862e-05,-7.672266656e-05,-7.696734974e-05,-7.656809612e-05,-7.665008161e-05,
-	-7.607858424e-05,-7.597069634e-05,-7.529034337e-05,-7.508703857e-05,-7.435524458e-05,
-	-7.407579687e-05,-7.328718493e-05,-7.290861686e-05,-7.205086877e-05,-7.155059575e-05,
-	-7.064391684e-05,-6.999480684e-05,-6.916497659e-05,-6.837227556e-05,-6.660934741e-05,
-	-6.717541692e-05,-6.564905198e-05,-6.493450201e-05,-6.337016384e-05,-6.26438341e-05,
-	-6.121757906e-05,-6.053416655e-05,-5.915071233e-05,-5.843210602e-05,-5.700842303e-05,
-	-5.621161108e-05,-5.472069824e-05,-5.384958786e-05,-5.230587703e-05,-5.138900815e-05,
-	-4.982238534e-05,-4.889212505e-05,-4.732782691e-05,-0.0008893331396
-};
+// the AVX2 kernel bodies are only used inlined, see simd.h
+#pragma GCC diagnostic ignored "-Wpsabi"
 
-static const float H2[1024] = {
-	0.000770891842,5.974628584e-05,6.160850899e-05,6.387064786e-05,6.552767445e-05,
-	6.75502888e-05,6.892206147e-05,7.062686927e-05,7.163941336e-05,7.297685079e-05,
-	7.360309974e-05,7.458683103e-05,7.486394315e-05,7.556051423e-05,7.551814633e-05,
-	7.590666064e-05,7.532828022e-05,7.507814735e-05,7.335100963e-05,7.315280527e-05,
-	7.204407302e-05,7.030550478e-05,6.869082426e-05,6.674900942e-05,6.448184286e-05,
-	6.21051804e-05, 5.93040204e-05,5.647660146e-05,5.318541298e-05,4.990220623e-05,
-	4.611554687e-05,4.233583604e-05,3.802812353e-05,3.376209133e-05, 2.90320022e-05,
-	2.44361363e-05,1.940052061e-05,1.432877252e-05, 8.64057256e-06,3.489106575e-06,
-	-2.457730488e-06,-8.078138308e-06,-1.418447209e-05,-2.005597707e-05,-2.635623787e-05,
-	-3.240926162e-05,-3.885868136e-05,-4.50326952e-05,-5.155127656e-05,-5.774434248e-05,
-	-6.422665319e-05,-7.035975432e-05,-7.677121175e-05,-8.283357602e-05,-8.910952602e-05,
-	-9.492974641e-05,-0.0001008587715,-0.0001064846074,-0.0001121445166,-0.0001172816046,
-	-0.0001225949527,-0.0001272942609,-0.0001321052987,-0.0001362843177,-0.0001405108051,
-	-0.0001440759661,-0.0001476515172,-0.000150548789,-0.0001534254989,-0.0001555863273,
-	-0.0001576693612,-0.0001589923922,-0.000160223688,-0.0001607095182,-0.0001610874897,
-	-0.000160627882,-0.0001600329415,-0.0001587053994,-0.0001571187167,-0.0001547888678,
-	-0.000152244218,-0.0001489118731,-0.000145389291,-0.0001410738332,-0.0001365681819,
-	-0.0001312646345,-0.0001257755794,-0.0001195078585,-0.0001130864766,-0.0001059134011,
-	-9.859655256e-05,-9.053162648e-05,-8.235563291e-05,-7.349706721e-05,-6.456466508e-05,
-	-5.492102719e-05,-4.529661237e-05,-3.503715561e-05,-2.477841917e-05,-1.397517372e-05,
-	-3.205229177e-06, 8.05673244e-06,1.922035335e-05,3.080876922e-05, 4.22339217e-05,
-	5.402401803e-05, 6.55973563e-05,7.746935444e-05,8.904734568e-05,  0.00010083917,
-	0.0001122742178,0.0001238655677,0.0001350244274,0.0001462271612,0.0001569497254,
-	0.0001676757092, 0.000177795373,0.0001878648472,0.0001972577884,0.0002065053268,
-	0.0002150258515,0.0002233259438,0.0002308395779,0.0002380551596,0.0002444170241,
-	0.000250412384,0.0002555062529, 0.000260177243,0.0002638904552,0.0002671145776,
-	0.0002693464339,0.0002710593981,0.0002717311727,0.0002718139149,0.0002708643733,
-	0.0002692886628,0.0002666459186,0.0002633820404,0.0002590232471,0.0002540306014,
-	0.0002479428076,0.0002412221656,0.0002334228921,0.0002249989775,0.0002155125549,
-	0.0002054190263,0.0001943018142,0.0001826130901,0.0001699359127,0.0001567169675,
-	0.0001425747614,0.0001279620774,0.0001124698101,9.656399925e-05,7.987560821e-05,
-	6.282034155e-05,4.507904669e-05,2.705965744e-05,8.441728824e-06,-1.036168942e-05,
-	-2.966787542e-05,-4.905815877e-05,-6.883981405e-05,-8.859911759e-05,-0.0001086409975,
-	-0.0001285505714,-0.0001486154797,-0.0001684246818,-0.0001882753568,-0.0002077625832,
-	-0.0002271531412,-0.0002460502728,-0.0002647435467,-0.0002828041615,-0.0003005356994,
-	-0.0003175287857,-0.0003340563562,-0.0003497321741,-0.000364817708,-0.0003789396724,
-	-0.0003923579061,-0.0004047034599,-0.0004162315163,-0.0004265867465,-0.0004360300081,
-	-0.0004442131321,-0.0004513848398,-0.0004572072648,-0.0004619470565,-0.0004652740608,
-	-0.0004674369411,-0.0004681386054,-0.0004676287354,-0.0004655968223,-0.0004623259592,
-	-0.0004575028725,-0.000451415719,-0.0004437651369,-0.0004348401271,-0.0004243591975,
-	-0.0004126159474,-0.0003993376158,-0.0003848170163,-0.0003687990829,-0.000351589144,
-	-0.000332943775,-0.0003131609119,-0.0002920125553,-0.0002698149474,-0.0002463397104,
-	-0.0002219015005,-0.0001963090763,-0.0001698578271,-0.0001423727954,-0.0001141639077,
-	-8.505515143e-05,-5.536781464e-05,-2.492866224e-05,5.936132311e-06,3.738669693e-05,
-	6.909121294e-05,0.0001012061548,0.0001334041008,0.0001658317051,0.0001981520763,
-	0.0002305086819,  0.00026257438,0.0002944787557,0.0003258895595,0.0003569503024,
-	0.000387319451,0.0004171307664,0.0004460661439,0.0004742410383,0.0005013485788,
-	0.0005274997675,0.0005523937289,0.0005761469365,0.0005984677118,0.0006194690941,
-	0.000638864236,0.0006567717646,0.0006729204906,0.0006874305545,0.0007000339683,
-	0.0007108628051, 0.000719666481,0.0007265702588,0.0007313418901,0.0007341239252,
-	0.0007346781786,0.0007331674569,0.0007293695235,0.0007234518998,0.0007152128383,
-	0.0007048207917,0.0006920917076,0.0006772064371,0.0006600015913,0.0006406639586,
-	0.0006190433633,0.0005953394575,0.0005694242427,0.0005415027263,0.0005114591913,
-	0.0004795179993,0.0004455784801,0.0004098648496,0.0003723080154,0.0003331375483,
-	0.0002922894782,0.0002500140981,0.0002062540298,0.0001612763299, 0.000115036215,
-	6.780545664e-05,1.954954678e-05,-2.944868174e-05,-7.921076758e-05,-0.0001294495887,
-	-0.0001801811159,-0.0002311088174,-0.0002822367533,-0.0003332716296,-0.0003842101141,
-	-0.0004347487993,-0.0004848899262,-0.0005343297962,-0.0005830543232,-0.0006307718577,
-	-0.0006774627836,-0.0007228400209,-0.000766888028,-0.0008093176875,-0.0008501173579,
-	-0.0008890052559,-0.0009259773651,-0.0009607552201,-0.0009933408583,-0.001023467164,
-	-0.001051148865, -0.00107612391,-0.001098417793,-0.001117787207,-0.001134263119,
-	-0.001147612813, -0.00115789508,-0.001164883724,-0.001168652438,-0.001168996096,
-	-0.001165997935,-0.001159478794,-0.001149537624,-0.001136012608,-0.001119020861,
-	-0.001098423731,-0.001074358821,-0.001046705642,-0.001015619608,-0.0009810053743,
-	-0.000943039835,-0.0009016437689,-0.0008570203208,-0.0008091141353,-0.0007581393002,
-	-0.0007040654891,-0.0006471334491,-0.0005873244954,-0.0005249070236,-0.0004598769883,
-	-0.0003925220517,-0.0003228605783,-0.0002511971688,-0.0001775651181,-0.000102285434,
-	-2.541053254e-05,  5.2722291e-05, 0.000132048357,0.0002122188016, 0.000293151621,
-	0.0003744903079,0.0004561452079,0.0005377419875,0.0006191852153,0.0007001008489,
-	0.0007803785847,0.0008596444386,0.0009377845563, 0.001014419482, 0.001089441008,
-	0.001162466593, 0.001233389252, 0.001301828772, 0.001367686549, 0.001430589007,
-	0.001490443712, 0.001546884421, 0.001599832554, 0.001648931415, 0.001694113365,
-	0.001735042664, 0.001771666575, 0.001803659601, 0.001830994501,  0.00185336615,
-	0.001870763022, 0.001882909215, 0.001889809151, 0.001891215099, 0.001887159422,
-	0.001877421164, 0.001862057019, 0.001840874669, 0.001813961077, 0.001781156054,
-	0.001742574852,  0.00169808988, 0.001647850964, 0.001591758104, 0.001529994188,
-	0.001462499495,  0.00138948427, 0.001310921041, 0.001227059169, 0.001137900981,
-	0.001043732045,0.0009445898468, 0.000840786437,0.0007323959144,0.0006197628682,
-	0.0005029959138,0.0003824667947,0.0002583169844,0.0001309462386,5.272498811e-07,
-	-0.0001325167977,-0.0002679805621,-0.000405416562,-0.0005445991992,-0.0006850550999,
-	-0.0008265313227,-0.0009685427067,-0.001110811951, -0.00125283876,-0.001394331804,
-	-0.001534770709,-0.001673854189,-0.001811053255,-0.001946057193,-0.002078329911,
-	-0.002207554178,-0.002333192853,-0.002454926027,-0.002572217258,-0.002684750594,
-	-0.002791997045, -0.00289364066,-0.002989166882,-0.003078272566,-0.003160452703,
-	-0.00323541835,-0.003302685684,-0.003361979499,-0.003412844148,-0.003455024911,
-	-0.003488089656,-0.003511811141,-0.003525787499,-0.003529821523,-0.003523543477,
-	-0.003506790381,-0.003479229752,-0.003440734232, -0.00339100929, -0.00332997134,
-	-0.003257365664,-0.003173146863,-0.003077110508,-0.002969254972,-0.002849419136,
-	-0.002717652591,-0.002573838225, -0.00241807173,-0.002250291407,-0.002070637885,
-	-0.001879100804,-0.001675868756,-0.001460985164, -0.00123468542,-0.0009970644023,
-	-0.0007484058151,-0.0004888570984,-0.0002187467326,6.172672875e-05,0.0003521840845,
-	0.0006523833727,  0.00096190162, 0.001280445722, 0.001607553684, 0.001942886622,
-	0.002285939176, 0.002636337187, 0.002993534319, 0.003357117064, 0.003726507071,
-	0.004101255909, 0.004480754957, 0.004864523187,  0.00525192637, 0.005642456003,
-	0.0060354569, 0.006430395879, 0.006826606579, 0.007223530672,  0.00762048969,
-	0.008016915992, 0.008412120864,  0.00880552642,  0.00919644814, 0.009584298357,
-	0.009968397208,  0.01034816075,  0.01072291471,  0.01109208167,  0.01145500038,
-	0.0118111074,  0.01215976011,  0.01250040904,  0.01283243764,  0.01315531787,
-	0.01346845645,  0.01377135701,  0.01406346262,  0.01434430014,  0.01461335272,
-	0.01487018447,  0.01511431672,   0.0153453555,  0.01556286775,  0.01576649584,
-	0.01595586538,  0.01613065787,  0.01629055291,  0.01643528044,  0.01656457409,
-	0.01667821407,  0.01677599363,  0.01685774513,  0.01692331955,  0.01697260328,
-	0.0170055069,  0.01702197455,  0.01702197455,   0.0170055069,  0.01697260328,
-	0.01692331955,  0.01685774513,  0.01677599363,  0.01667821407,  0.01656457409,
-	0.01643528044,  0.01629055291,  0.01613065787,  0.01595586538,  0.01576649584,
-	0.01556286775,   0.0153453555,  0.01511431672,  0.01487018447,  0.01461335272,
-	0.01434430014,  0.01406346262,  0.01377135701,  0.01346845645,  0.01315531787,
-	0.01283243764,  0.01250040904,  0.01215976011,   0.0118111074,  0.01145500038,
-	0.01109208167,  0.01072291471,  0.01034816075, 0.009968397208, 0.009584298357,
-	0.00919644814,  0.00880552642, 0.008412120864, 0.008016915992,  0.00762048969,
-	0.007223530672, 0.006826606579, 0.006430395879,   0.0060354569, 0.005642456003,
-	0.00525192637, 0.004864523187, 0.004480754957, 0.004101255909, 0.003726507071,
-	0.003357117064, 0.002993534319, 0.002636337187, 0.002285939176, 0.001942886622,
-	0.001607553684, 0.001280445722,  0.00096190162,0.0006523833727,0.0003521840845,
-	6.172672875e-05,-0.0002187467326,-0.0004888570984,-0.0007484058151,-0.0009970644023,
-	-0.00123468542,-0.001460985164,-0.001675868756,-0.001879100804,-0.002070637885,
-	-0.002250291407, -0.00241807173,-0.002573838225,-0.002717652591,-0.002849419136,
-	-0.002969254972,-0.003077110508,-0.003173146863,-0.003257365664, -0.00332997134,
-	-0.00339100929,-0.003440734232,-0.003479229752,-0.003506790381,-0.003523543477,
-	-0.003529821523,-0.003525787499,-0.003511811141,-0.003488089656,-0.003455024911,
-	-0.003412844148,-0.003361979499,-0.003302685684, -0.00323541835,-0.003160452703,
-	-0.003078272566,-0.002989166882, -0.00289364066,-0.002791997045,-0.002684750594,
-	-0.002572217258,-0.002454926027,-0.002333192853,-0.002207554178,-0.002078329911,
-	-0.001946057193,-0.001811053255,-0.001673854189,-0.001534770709,-0.001394331804,
-	-0.00125283876,-0.001110811951,-0.0009685427067,-0.0008265313227,-0.0006850550999,
-	-0.0005445991992,-0.000405416562,-0.0002679805621,-0.0001325167977,5.272498811e-07,
-	0.0001309462386,0.0002583169844,0.0003824667947,0.0005029959138,0.0006197628682,
-	0.0007323959144, 0.000840786437,0.0009445898468, 0.001043732045, 0.001137900981,
-	0.001227059169, 0.001310921041,  0.00138948427, 0.001462499495, 0.001529994188,
-	0.001591758104, 0.001647850964,  0.00169808988, 0.001742574852, 0.001781156054,
-	0.001813961077, 0.001840874669, 0.001862057019, 0.001877421164, 0.001887159422,
-	0.001891215099, 0.001889809151, 0.001882909215, 0.001870763022,  0.00185336615,
-	0.001830994501, 0.001803659601, 0.001771666575, 0.001735042664, 0.001694113365,
-	0.001648931415, 0.001599832554, 0.001546884421, 0.001490443712, 0.001430589007,
-	0.001367686549, 0.001301828772, 0.001233389252, 0.001162466593, 0.001089441008,
-	0.001014419482,0.0009377845563,0.0008596444386,0.0007803785847,0.0007001008489,
-	0.0006191852153,0.0005377419875,0.0004561452079,0.0003744903079, 0.000293151621,
-	0.0002122188016, 0.000132048357,  5.2722291e-05,-2.541053254e-05,-0.000102285434,
-	-0.0001775651181,-0.0002511971688,-0.0003228605783,-0.0003925220517,-0.0004598769883,
-	-0.0005249070236,-0.0005873244954,-0.0006471334491,-0.0007040654891,-0.0007581393002,
-	-0.0008091141353,-0.0008570203208,-0.0009016437689,-0.000943039835,-0.0009810053743,
-	-0.001015619608,-0.001046705642,-0.001074358821,-0.001098423731,-0.001119020861,
-	-0.001136012608,-0.001149537624,-0.001159478794,-0.001165997935,-0.001168996096,
-	-0.001168652438,-0.001164883724, -0.00115789508,-0.001147612813,-0.001134263119,
-	-0.001117787207,-0.001098417793, -0.00107612391,-0.001051148865,-0.001023467164,
-	-0.0009933408583,-0.0009607552201,-0.0009259773651,-0.0008890052559,-0.0008501173579,
-	-0.0008093176875,-0.000766888028,-0.0007228400209,-0.0006774627836,-0.0006307718577,
-	-0.0005830543232,-0.0005343297962,-0.0004848899262,-0.0004347487993,-0.0003842101141,
-	-0.0003332716296,-0.0002822367533,-0.0002311088174,-0.0001801811159,-0.0001294495887,
-	-7.921076758e-05,-2.944868174e-05,1.954954678e-05,6.780545664e-05, 0.000115036215,
-	0.0001612763299,0.0002062540298,0.0002500140981,0.0002922894782,0.0003331375483,
-	0.0003723080154,0.0004098648496,0.0004455784801,0.0004795179993,0.0005114591913,
-	0.0005415027263,0.0005694242427,0.0005953394575,0.0006190433633,0.0006406639586,
-	0.0006600015913,0.0006772064371,0.0006920917076,0.0007048207917,0.0007152128383,
-	0.0007234518998,0.0007293695235,0.0007331674569,0.0007346781786,0.0007341239252,
-	0.0007313418901,0.0007265702588, 0.000719666481,0.0007108628051,0.0007000339683,
-	0.0006874305545,0.0006729204906,0.0006567717646, 0.000638864236,0.0006194690941,
-	0.0005984677118,0.0005761469365,0.0005523937289,0.0005274997675,0.0005013485788,
-	0.0004742410383,0.0004460661439,0.0004171307664, 0.000387319451,0.0003569503024,
-	0.0003258895595,0.0002944787557,  0.00026257438,0.0002305086819,0.0001981520763,
-	0.0001658317051,0.0001334041008,0.0001012061548,6.909121294e-05,3.738669693e-05,
-	5.936132311e-06,-2.492866224e-05,-5.536781464e-05,-8.505515143e-05,-0.0001141639077,
-	-0.0001423727954,-0.0001698578271,-0.0001963090763,-0.0002219015005,-0.0002463397104,
-	-0.0002698149474,-0.0002920125553,-0.0003131609119,-0.000332943775,-0.000351589144,
-	-0.0003687990829,-0.0003848170163,-0.0003993376158,-0.0004126159474,-0.0004243591975,
-	-0.0004348401271,-0.0004437651369,-0.000451415719,-0.0004575028725,-0.0004623259592,
-	-0.0004655968223,-0.0004676287354,-0.0004681386054,-0.0004674369411,-0.0004652740608,
-	-0.0004619470565,-0.0004572072648,-0.0004513848398,-0.0004442131321,-0.0004360300081,
-	-0.0004265867465,-0.0004162315163,-0.0004047034599,-0.0003923579061,-0.0003789396724,
-	-0.000364817708,-0.0003497321741,-0.0003340563562,-0.0003175287857,-0.0003005356994,
-	-0.0002828041615,-0.0002647435467,-0.0002460502728,-0.0002271531412,-0.0002077625832,
-	-0.0001882753568,-0.0001684246818,-0.0001486154797,-0.0001285505714,-0.0001086409975,
-	-8.859911759e-05,-6.883981405e-05,-4.905815877e-05,-2.966787542e-05,-1.036168942e-05,
-	8.441728824e-06,2.705965744e-05,4.507904669e-05,6.282034155e-05,7.987560821e-05,
-	9.656399925e-05,0.0001124698101,0.0001279620774,0.0001425747614,0.0001567169675,
-	0.0001699359127,0.0001826130901,0.0001943018142,0.0002054190263,0.0002155125549,
-	0.0002249989775,0.0002334228921,0.0002412221656,0.0002479428076,0.0002540306014,
-	0.0002590232471,0.0002633820404,0.0002666459186,0.0002692886628,0.0002708643733,
-	0.0002718139149,0.0002717311727,0.0002710593981,0.0002693464339,0.0002671145776,
-	0.0002638904552, 0.000260177243,0.0002555062529, 0.000250412384,0.0002444170241,
-	0.0002380551596,0.0002308395779,0.0002233259438,0.0002150258515,0.0002065053268,
-	0.0001972577884,0.0001878648472, 0.000177795373,0.0001676757092,0.0001569497254,
-	0.0001462271612,0.0001350244274,0.0001238655677,0.0001122742178,  0.00010083917,
-	8.904734568e-05,7.746935444e-05, 6.55973563e-05,5.402401803e-05, 4.22339217e-05,
-	3.080876922e-05,1.922035335e-05, 8.05673244e-06,-3.205229177e-06,-1.397517372e-05,
-	-2.477841917e-05,-3.503715561e-05,-4.529661237e-05,-5.492102719e-05,-6.456466508e-05,
-	-7.349706721e-05,-8.235563291e-05,-9.053162648e-05,-9.859655256e-05,-0.0001059134011,
-	-0.0001130864766,-0.0001195078585,-0.0001257755794,-0.0001312646345,-0.0001365681819,
-	-0.0001410738332,-0.000145389291,-0.0001489118731,-0.000152244218,-0.0001547888678,
-	-0.0001571187167,-0.0001587053994,-0.0001600329415,-0.000160627882,-0.0001610874897,
-	-0.0001607095182,-0.000160223688,-0.0001589923922,-0.0001576693612,-0.0001555863273,
-	-0.0001534254989,-0.000150548789,-0.0001476515172,-0.0001440759661,-0.0001405108051,
-	-0.0001362843177,-0.0001321052987,-0.0001272942609,-0.0001225949527,-0.0001172816046,
-	-0.0001121445166,-0.0001064846074,-0.0001008587715,-9.492974641e-05,-8.910952602e-05,
-	-8.283357602e-05,-7.677121175e-05,-7.035975432e-05,-6.422665319e-05,-5.774434248e-05,
-	-5.155127656e-05,-4.50326952e-05,-3.885868136e-05,-3.240926162e-05,-2.635623787e-05,
-	-2.005597707e-05,-1.418447209e-05,-8.078138308e-06,-2.457730488e-06,3.489106575e-06,
-	8.64057256e-06,1.432877252e-05,1.940052061e-05, 2.44361363e-05, 2.90320022e-05,
-	3.376209133e-05,3.802812353e-05,4.233583604e-05,4.611554687e-05,4.990220623e-05,
-	5.318541298e-05,5.647660146e-05, 5.93040204e-05, 6.21051804e-05,6.448184286e-05,
-	6.674900942e-05,6.869082426e-05,7.030550478e-05,7.204407302e-05,7.315280527e-05,
-	7.335100963e-05,7.507814735e-05,7.532828022e-05,7.590666064e-05,7.551814633e-05,
-	7.556051423e-05,7.486394315e-05,7.458683103e-05,7.360309974e-05,7.297685079e-05,
-	7.163941336e-05,7.062686927e-05,6.892206147e-05, 6.75502888e-05,6.552767445e-05,
-	6.387064786e-05,6.160850899e-05,5.974628584e-05, 0.000770891842
-};
+// stopband attenuation of the designed filters in dB
+static const double KaiserAttenuation = 80.0;
+// 1.0 in the 32.32 fixed point resampling position
+static const quint64 FixedPointOne = (quint64)1 << 32;
+// largest interpolation factor L of a rational ratio L/M that gets its own L phase bank
+static const quint64 MaxRationalPhases = 256;
+// designed filter banks no interpolator uses any more are kept up to this size for later
+// rate changes
+static const size_t FilterBankCacheBytes = 4 << 20;
+// the direct form kernels get about 2.5 times more done per float operation than the FFT
+// butterflies, the FFT filter is only used when it is cheaper by at least that much
+static const double FFTCostFactor = 2.5;
+// input samples converted into the history per pass
+static const int HistoryChunk = 1024;
 
-static const float H3[1024] = {
-	0.0003954205313,-0.0005542723811,-0.0003138662141,-0.0001955673943,-0.0001376769505,
-	-0.0001103614413,-9.762283298e-05,-9.249936556e-05,-9.043727187e-05,-9.020064317e-05,
-	-9.010238136e-05,-9.034774848e-05,-8.996579709e-05,-8.953249926e-05,-8.825874829e-05,
-	-8.682301268e-05,-8.447881555e-05,-8.194775728e-05,-7.848893438e-05,-7.485201786e-05,
-	-7.029019616e-05,-6.55861586e-05,-5.997795233e-05,-5.428417353e-05,-4.771732347e-05,
-	-4.114789044e-05,-3.374629523e-05, -2.6456255e-05,-1.836176671e-05,-1.054648055e-05,
-	-1.923925083e-06,6.202668828e-06,1.508197784e-05,2.351198964e-05, 3.20134277e-05,
-	4.093452662e-05,4.879548942e-05,5.721540947e-05, 6.53487441e-05,7.253124204e-05,
-	7.981355884e-05,8.676182188e-05,9.299399244e-05,9.834403318e-05,0.0001035719106,
-	0.0001080724833,0.0001118196451,0.0001144444032,0.0001166321817,0.0001179735846,
-	0.0001186387017,0.0001180267063, 0.000116664065,0.0001142875917,0.0001113651233,
-	0.0001073335734,0.0001025145975,9.649946151e-05,8.984707529e-05,8.226025966e-05,
-	7.417951565e-05,6.518124428e-05,5.559631973e-05,4.515646287e-05, 3.42261701e-05,
-	2.276316627e-05,1.100712325e-05,-1.122159688e-06,-1.333521686e-05,-2.607536589e-05,
-	-3.85158055e-05,-5.146520925e-05,-6.392837531e-05,-7.638820534e-05,-8.835940389e-05,
-	-0.0001001226192,-0.0001110432131,-0.0001217866084,-0.0001316336275,-0.0001409410324,
-	-0.0001492024894,-0.0001568903535,-0.0001632521744,-0.000168732382,-0.0001728482166,
-	-0.0001760576852,-0.0001777102298,-0.0001783069456,-0.0001773951662,-0.0001754695986,
-	-0.000171935957,-0.0001672870421,-0.0001610792679,-0.0001538639626,-0.0001451076532,
-	-0.0001353221305,-0.0001240416314,-0.0001119362059,-9.847030742e-05,-8.433478069e-05,
-	-6.889026554e-05,-5.298021279e-05,-3.604754238e-05,-1.882062134e-05,-8.799141256e-07,
-	1.726795381e-05,3.586720413e-05,5.431063255e-05, 7.29959429e-05,9.120581672e-05,
-	0.0001093750252,0.0001269182249,0.0001440891065,0.0001602653938,0.0001758501458,
-	0.000190182298,0.0002036282385,0.0002156466071,0.0002265780204,0.0002357644698,
-	0.0002436268551,0.0002496309462,0.0002541624417,0.0002566575713,0.0002575913386,
-	0.0002564257884,0.0002535790554,0.0002485334408,0.0002418321528,0.0002330078714,
-	0.0002225534554,0.0002100289566,0.0001959537331,0.0001799943857,0.0001625731675,
-	0.000143447789, 0.000123083737,0.0001012823923,7.856646698e-05,5.460587272e-05,
-	3.003101301e-05,4.564267329e-06,-2.120473255e-05,-4.747761341e-05,-7.37039154e-05,
-	-0.0001000837728,-0.0001259524288,-0.0001515702315,-0.0001763527544,-0.0002004904527,
-	-0.000223401541,-0.0002453071065,-0.0002655829303,-0.0002844703558,-0.0003014373942,
-	-0.000316689373,-0.0003296675859,-0.0003406536416,-0.000349164271,-0.000355453376,
-	-0.0003590794222,-0.0003603353107,-0.000358797115,-0.0003547488595,-0.0003478687431,
-	-0.0003385070595,-0.0003263199469,-0.0003116987937,-0.0002943306754,-0.0002747303224,
-	-0.0002525639138,-0.0002283754729,-0.0002019159292,-0.0001737102284,-0.0001435728336,
-	-0.0001120299639,-7.894171722e-05,-4.492660082e-05,-9.807352399e-06,2.581185436e-05,
-	6.202464283e-05,9.823042637e-05,0.0001344996126,0.0001702099544,0.0002054641955,
-	0.0002396334894,0.0002727745159,0.0003043191682,0.0003343544377,0.0003622658551,
-	0.0003881493176,0.0004114574404,0.0004323062603,0.0004501722869,0.0004652304924,
-	0.0004769575899, 0.000485553348,0.0004905582173,0.0004922538064,0.0004901815555,
-	0.0004846606753,0.0004753389803, 0.000462557975,0.0004460320342, 0.000426114013,
-	0.0004026109818,0.0003759213432,0.0003458808351,0.0003129934485,0.0002771365398,
-	0.0002388213325,0.0001979866502,0.0001551758178,0.0001104045296,6.425345782e-05,
-	1.672415965e-05,-3.154688966e-05,-8.049855387e-05,-0.0001295095281,-0.0001784998603,
-	-0.0002268215903,-0.0002744113153,-0.0003206165275,-0.0003653615422,-0.0004080198123,
-	-0.0004485101672,-0.0004862078931,-0.0005210944219,-0.0005526050809,-0.0005807006964,
-	-0.0006048661307,-0.0006251177983,-0.0006410104688,-0.0006525750505,-0.0006594509468,
-	-0.0006617225008,-0.0006590716657,-0.0006516811554,-0.000639290316,-0.000622149324,
-	-0.0006000662106,-0.0005733732833,-0.0005419739173,-0.0005062195705,-0.0004660853883,
-	-0.0004220296396, -0.00037408137,-0.0003227615671,-0.0002681668557,-0.000210859318,
-	-0.0001510073926,-8.921489643e-05,-2.569628668e-05,3.888618448e-05,0.0001042918375,
-	0.0001698682463,0.0002353172022,0.0002999670978,0.0003635330067,0.0004253493389,
-	0.0004851105332,0.0005421747919,0.0005962428986,  0.00064670539,0.0006933260011,
-	0.0007355197449, 0.000773083535,0.0008054868085,0.0008326131501,0.0008539694245,
-	0.0008695073775, 0.000878851919,0.0008820093935,0.0008786848048,0.0008689691313,
-	0.0008526696474,0.0008299749461,0.0008007741417,0.0007653554203,0.0007237074897,
-	0.0006761939148,0.0006229337305,0.0005643749028,0.0005006987485,0.0004324441252,
-	0.0003598910116,0.0002836496569,0.0002040765976,0.0001218387115,3.735831342e-05,
-	-4.863155482e-05,-0.0001356852299,-0.0002230413811,-0.0003102042247,  -0.0003963903,
-	-0.0004811116669,-0.0005635612761,-0.0006432586233,-0.0007194363861,-0.0007916258182,
-	-0.000859094027,-0.0009214090533,-0.0009779102402,-0.001028214465,-0.001071752165,
-	-0.001108205877,-0.001137066982, -0.00115813734,-0.001171024749,-0.001175614656,
-	-0.001171629061,-0.001159074367,-0.001137806685,-0.001107938122,-0.001069443533,
-	-0.001022580778,-0.0009674415924,-0.0009044035687,-0.0008337012841,-0.0007558274665,
-	-0.0006711285096,-0.0005802221713,-0.0004835594737,-0.0003818547993,-0.0002756723843,
-	-0.0001658131368,-5.292234709e-05,6.214144378e-05,0.0001786720823,0.0002957549295,
-	0.0004126139393,0.0005283353385,0.0006421253202,0.0007530490402,0.0008603217429,
-	0.0009630389395, 0.001060445444,   0.0011516714, 0.001236033393,  0.00131272478,
-	0.001381129608, 0.001440551714, 0.001490468043, 0.001530293142, 0.001559641096,
-	0.001578049152, 0.001585266553, 0.001580986427, 0.001565115759, 0.001537502045,
-	0.001498199417, 0.001447248971, 0.001384883886, 0.001311296248, 0.001226878376,
-	0.001132011414, 0.001027244492,0.0009131264524,0.0007903659716, 0.000659658981,
-	0.0005218549049,0.0003777926322,0.0002284422517,7.475346501e-05,-8.219259325e-05,
-	-0.0002413668844,-0.0004016007297,-0.0005618048017,-0.0007207704475,-0.000877365761,
-	-0.001030363492,-0.001178642851,-0.001321004704,-0.001456338214,-0.001583499135,
-	-0.00170146476,-0.001809163135,-0.001905663405,-0.001990019809,-0.002061421517,
-	-0.002119082725,-0.002162357094,-0.002190628788,-0.002203429583,-0.002200343646,
-	-0.002181112999,-0.002145531354,-0.002093563788,-0.002025244292,-0.001940763555,
-	-0.001840374549,-0.001724523609, -0.00159370515,-0.001448584371,-0.001289884676,
-	-0.001118512242,-0.0009354056674,-0.0007416739827,-0.0005384566612,-0.0003270421876,
-	-0.0001087612909,0.0001149428135,0.0003425978648,0.0005726348027,0.0008034682833,
-	0.001033442095, 0.001260899124, 0.001484137261, 0.001701485715, 0.001911238302,
-	0.002111725509,  0.00230130041, 0.002478363458, 0.002641340252,  0.00278875744,
-	0.002919185441, 0.003031305503, 0.003123863833, 0.003195748664, 0.003245931584,
-	0.003273543436, 0.003277818207, 0.003258161712, 0.003214097582, 0.003145341994,
-	0.003051746869, 0.002933338517, 0.002790304366, 0.002623025095, 0.002432039706,
-	0.002218060428, 0.001981989248, 0.001724887872, 0.001447987743, 0.001152690267,
-	0.0008405587869,0.0005133127561,0.0001728114439,-0.0001789423404,-0.0005398156354,
-	-0.000907544978,-0.001279769698,-0.001654030988,-0.002027784241,-0.002398405224,
-	-0.002763231052,-0.003119530622,-0.003464566777,-0.003795581171,-0.004109814297,
-	-0.00440452667, -0.00467702793,-0.004924674518,-0.005144879688,-0.005335154478,
-	-0.005493102595,-0.005616450217,-0.005703041796,-0.005750885233,-0.005758129992,
-	-0.005723108537,-0.005644330289,-0.005520508159,-0.005350553431,-0.005133599043,
-	-0.004869008902,-0.004556355067,-0.004195469432,-0.003786421381,-0.003329525469,
-	-0.002825331176,-0.002274653409,-0.001678546541,-0.001038314658,-0.0003554997093,
-	0.0003681110102, 0.001130504534, 0.001929438789, 0.002762462944, 0.003626920749,
-	0.004519946873, 0.005438516848, 0.006379424594, 0.007339307573, 0.008314664476,
-	0.009301881306,  0.01029723138,  0.01129690371,  0.01229702402,  0.01329365373,
-	0.01428283192,  0.01526059117,  0.01622297429,  0.01716603525,  0.01808589324,
-	0.01897872984,  0.01984082162,  0.02066853642,  0.02145838179,  0.02220700122,
-	0.02291119657,  0.02356795967,  0.02417446487,  0.02472809143,  0.02522644401,
-	0.02566737123,  0.02604894154,  0.02636949904,  0.02662764303,  0.02682224847,
-	0.02695245482,  0.02701770142,  0.02701770142,  0.02695245482,  0.02682224847,
-	0.02662764303,  0.02636949904,  0.02604894154,  0.02566737123,  0.02522644401,
-	0.02472809143,  0.02417446487,  0.02356795967,  0.02291119657,  0.02220700122,
-	0.02145838179,  0.02066853642,  0.01984082162,  0.01897872984,  0.01808589324,
-	0.01716603525,  0.01622297429,  0.01526059117,  0.01428283192,  0.01329365373,
-	0.01229702402,  0.01129690371,  0.01029723138, 0.009301881306, 0.008314664476,
-	0.007339307573, 0.006379424594, 0.005438516848, 0.004519946873, 0.003626920749,
-	0.002762462944, 0.001929438789, 0.001130504534,0.0003681110102,-0.0003554997093,
-	-0.001038314658,-0.001678546541,-0.002274653409,-0.002825331176,-0.003329525469,
-	-0.003786421381,-0.004195469432,-0.004556355067,-0.004869008902,-0.005133599043,
-	-0.005350553431,-0.005520508159,-0.005644330289,-0.005723108537,-0.005758129992,
-	-0.005750885233,-0.005703041796,-0.005616450217,-0.005493102595,-0.005335154478,
-	-0.005144879688,-0.004924674518, -0.00467702793, -0.00440452667,-0.004109814297,
-	-0.003795581171,-0.003464566777,-0.003119530622,-0.002763231052,-0.002398405224,
-	-0.002027784241,-0.001654030988,-0.001279769698,-0.000907544978,-0.0005398156354,
-	-0.0001789423404,0.0001728114439,0.0005133127561,0.0008405587869, 0.001152690267,
-	0.001447987743, 0.001724887872, 0.001981989248, 0.002218060428, 0.002432039706,
-	0.002623025095, 0.002790304366, 0.002933338517, 0.003051746869, 0.003145341994,
-	0.003214097582, 0.003258161712, 0.003277818207, 0.003273543436, 0.003245931584,
-	0.003195748664, 0.003123863833, 0.003031305503, 0.002919185441,  0.00278875744,
-	0.002641340252, 0.002478363458,  0.00230130041, 0.002111725509, 0.001911238302,
-	0.001701485715, 0.001484137261, 0.001260899124, 0.001033442095,0.0008034682833,
-	0.0005726348027,0.0003425978648,0.0001149428135,-0.0001087612909,-0.0003270421876,
-	-0.0005384566612,-0.0007416739827,-0.0009354056674,-0.001118512242,-0.001289884676,
-	-0.001448584371, -0.00159370515,-0.001724523609,-0.001840374549,-0.001940763555,
-	-0.002025244292,-0.002093563788,-0.002145531354,-0.002181112999,-0.002200343646,
-	-0.002203429583,-0.002190628788,-0.002162357094,-0.002119082725,-0.002061421517,
-	-0.001990019809,-0.001905663405,-0.001809163135, -0.00170146476,-0.001583499135,
-	-0.001456338214,-0.001321004704,-0.001178642851,-0.001030363492,-0.000877365761,
-	-0.0007207704475,-0.0005618048017,-0.0004016007297,-0.0002413668844,-8.219259325e-05,
-	7.475346501e-05,0.0002284422517,0.0003777926322,0.0005218549049, 0.000659658981,
-	0.0007903659716,0.0009131264524, 0.001027244492, 0.001132011414, 0.001226878376,
-	0.001311296248, 0.001384883886, 0.001447248971, 0.001498199417, 0.001537502045,
-	0.001565115759, 0.001580986427, 0.001585266553, 0.001578049152, 0.001559641096,
-	0.001530293142, 0.001490468043, 0.001440551714, 0.001381129608,  0.00131272478,
-	0.001236033393,   0.0011516714, 0.001060445444,0.0009630389395,0.0008603217429,
-	0.0007530490402,0.0006421253202,0.0005283353385,0.0004126139393,0.0002957549295,
-	0.0001786720823,6.214144378e-05,-5.292234709e-05,-0.0001658131368,-0.0002756723843,
-	-0.0003818547993,-0.0004835594737,-0.0005802221713,-0.0006711285096,-0.0007558274665,
-	-0.0008337012841,-0.0009044035687,-0.0009674415924,-0.001022580778,-0.001069443533,
-	-0.001107938122,-0.001137806685,-0.001159074367,-0.001171629061,-0.001175614656,
-	-0.001171024749, -0.00115813734,-0.001137066982,-0.001108205877,-0.001071752165,
-	-0.001028214465,-0.0009779102402,-0.0009214090533,-0.000859094027,-0.0007916258182,
-	-0.0007194363861,-0.0006432586233,-0.0005635612761,-0.0004811116669,  -0.0003963903,
-	-0.0003102042247,-0.0002230413811,-0.0001356852299,-4.863155482e-05,3.735831342e-05,
-	0.0001218387115,0.0002040765976,0.0002836496569,0.0003598910116,0.0004324441252,
-	0.0005006987485,0.0005643749028,0.0006229337305,0.0006761939148,0.0007237074897,
-	0.0007653554203,0.0008007741417,0.0008299749461,0.0008526696474,0.0008689691313,
-	0.0008786848048,0.0008820093935, 0.000878851919,0.0008695073775,0.0008539694245,
-	0.0008326131501,0.0008054868085, 0.000773083535,0.0007355197449,0.0006933260011,
-	0.00064670539,0.0005962428986,0.0005421747919,0.0004851105332,0.0004253493389,
-	0.0003635330067,0.0002999670978,0.0002353172022,0.0001698682463,0.0001042918375,
-	3.888618448e-05,-2.569628668e-05,-8.921489643e-05,-0.0001510073926,-0.000210859318,
-	-0.0002681668557,-0.0003227615671, -0.00037408137,-0.0004220296396,-0.0004660853883,
-	-0.0005062195705,-0.0005419739173,-0.0005733732833,-0.0006000662106,-0.000622149324,
-	-0.000639290316,-0.0006516811554,-0.0006590716657,-0.0006617225008,-0.0006594509468,
-	-0.0006525750505,-0.0006410104688,-0.0006251177983,-0.0006048661307,-0.0005807006964,
-	-0.0005526050809,-0.0005210944219,-0.0004862078931,-0.0004485101672,-0.0004080198123,
-	-0.0003653615422,-0.0003206165275,-0.0002744113153,-0.0002268215903,-0.0001784998603,
-	-0.0001295095281,-8.049855387e-05,-3.154688966e-05,1.672415965e-05,6.425345782e-05,
-	0.0001104045296,0.0001551758178,0.0001979866502,0.0002388213325,0.0002771365398,
-	0.0003129934485,0.0003458808351,0.0003759213432,0.0004026109818, 0.000426114013,
-	0.0004460320342, 0.000462557975,0.0004753389803,0.0004846606753,0.0004901815555,
-	0.0004922538064,0.0004905582173, 0.000485553348,0.0004769575899,0.0004652304924,
-	0.0004501722869,0.0004323062603,0.0004114574404,0.0003881493176,0.0003622658551,
-	0.0003343544377,0.0003043191682,0.0002727745159,0.0002396334894,0.0002054641955,
-	0.0001702099544,0.0001344996126,9.823042637e-05,6.202464283e-05,2.581185436e-05,
-	-9.807352399e-06,-4.492660082e-05,-7.894171722e-05,-0.0001120299639,-0.0001435728336,
-	-0.0001737102284,-0.0002019159292,-0.0002283754729,-0.0002525639138,-0.0002747303224,
-	-0.0002943306754,-0.0003116987937,-0.0003263199469,-0.0003385070595,-0.0003478687431,
-	-0.0003547488595,-0.000358797115,-0.0003603353107,-0.0003590794222,-0.000355453376,
-	-0.000349164271,-0.0003406536416,-0.0003296675859,-0.000316689373,-0.0003014373942,
-	-0.0002844703558,-0.0002655829303,-0.0002453071065,-0.000223401541,-0.0002004904527,
-	-0.0001763527544,-0.0001515702315,-0.0001259524288,-0.0001000837728,-7.37039154e-05,
-	-4.747761341e-05,-2.120473255e-05,4.564267329e-06,3.003101301e-05,5.460587272e-05,
-	7.856646698e-05,0.0001012823923, 0.000123083737, 0.000143447789,0.0001625731675,
-	0.0001799943857,0.0001959537331,0.0002100289566,0.0002225534554,0.0002330078714,
-	0.0002418321528,0.0002485334408,0.0002535790554,0.0002564257884,0.0002575913386,
-	0.0002566575713,0.0002541624417,0.0002496309462,0.0002436268551,0.0002357644698,
-	0.0002265780204,0.0002156466071,0.0002036282385, 0.000190182298,0.0001758501458,
-	0.0001602653938,0.0001440891065,0.0001269182249,0.0001093750252,9.120581672e-05,
-	7.29959429e-05,5.431063255e-05,3.586720413e-05,1.726795381e-05,-8.799141256e-07,
-	-1.882062134e-05,-3.604754238e-05,-5.298021279e-05,-6.889026554e-05,-8.433478069e-05,
-	-9.847030742e-05,-0.0001119362059,-0.0001240416314,-0.0001353221305,-0.0001451076532,
-	-0.0001538639626,-0.0001610792679,-0.0001672870421,-0.000171935957,-0.0001754695986,
-	-0.0001773951662,-0.0001783069456,-0.0001777102298,-0.0001760576852,-0.0001728482166,
-	-0.000168732382,-0.0001632521744,-0.0001568903535,-0.0001492024894,-0.0001409410324,
-	-0.0001316336275,-0.0001217866084,-0.0001110432131,-0.0001001226192,-8.835940389e-05,
-	-7.638820534e-05,-6.392837531e-05,-5.146520925e-05,-3.85158055e-05,-2.607536589e-05,
-	-1.333521686e-05,-1.122159688e-06,1.100712325e-05,2.276316627e-05, 3.42261701e-05,
-	4.515646287e-05,5.559631973e-05,6.518124428e-05,7.417951565e-05,8.226025966e-05,
-	8.984707529e-05,9.649946151e-05,0.0001025145975,0.0001073335734,0.0001113651233,
-	0.0001142875917, 0.000116664065,0.0001180267063,0.0001186387017,0.0001179735846,
-	0.0001166321817,0.0001144444032,0.0001118196451,0.0001080724833,0.0001035719106,
-	9.834403318e-05,9.299399244e-05,8.676182188e-05,7.981355884e-05,7.253124204e-05,
-	6.53487441e-05,5.721540947e-05,4.879548942e-05,4.093452662e-05, 3.20134277e-05,
-	2.351198964e-05,1.508197784e-05,6.202668828e-06,-1.923925083e-06,-1.054648055e-05,
-	-1.836176671e-05, -2.6456255e-05,-3.374629523e-05,-4.114789044e-05,-4.771732347e-05,
-	-5.428417353e-05,-5.997795233e-05,-6.55861586e-05,-7.029019616e-05,-7.485201786e-05,
-	-7.848893438e-05,-8.194775728e-05,-8.447881555e-05,-8.682301268e-05,-8.825874829e-05,
-	-8.953249926e-05,-8.996579709e-05,-9.034774848e-05,-9.010238136e-05,-9.020064317e-05,
-	-9.043727187e-05,-9.249936556e-05,-9.762283298e-05,-0.0001103614413,-0.0001376769505,
-	-0.0001955673943,-0.0003138662141,-0.0005542723811,0.0003954205313
+struct QualityPreset {
+	int phases;
+	int tapsPerPhase;
 };
 
-static const float H4[1024] = {
-	-0.0005527109606, 0.000375192205, 0.000281646644,0.0002192356042,0.0001787396177,
-	0.0001519875805,0.0001352679683,0.0001241563587,0.0001175013604,0.0001126200441,
-	0.0001095604021,0.0001064563621,0.0001039275958,0.0001004961741,9.706643323e-05,
-	9.234834579e-05,8.740096382e-05,8.102792344e-05, 7.43892524e-05, 6.63315077e-05,
-	5.809376307e-05,4.853012433e-05,3.896527778e-05,2.822043643e-05,   1.772828e-05,
-	6.277499324e-06,-4.814241493e-06,-1.607853665e-05,-2.769080493e-05,-3.815951277e-05,
-	-4.880327833e-05,-5.929055624e-05,-6.809681508e-05,-7.666956662e-05,-8.42486188e-05,
-	-9.111591498e-05,-9.603439685e-05,-0.000100149955,-0.0001026771643,-0.0001044069722,
-	-0.0001040826101,-0.0001026047321,-9.91161578e-05,-9.477739513e-05,-8.861912647e-05,
-	-8.160310244e-05,-7.26726721e-05,-6.295165076e-05,-5.157124542e-05,-3.981521513e-05,
-	-2.676116674e-05,-1.365246226e-05,5.367834319e-07,1.456116297e-05,2.922914427e-05,
-	4.351627285e-05,5.770399002e-05,7.119278598e-05,8.426103159e-05,9.593343566e-05,
-	0.0001071725928, 0.000116716823,0.0001252709772,0.0001319184375,0.0001374290878,
-	0.0001405872317,0.0001422824134,0.0001416088926,0.0001394832652,0.0001348554943,
-	0.0001287321211,0.0001202652929, 0.000110520923, 9.85425213e-05,8.539490227e-05,
-	7.024554361e-05,5.432538819e-05, 3.67988323e-05,1.889249324e-05,-2.408283137e-07,
-	-1.926593723e-05,-3.89050183e-05,-5.793347009e-05,-7.694081432e-05,-9.495481936e-05,
-	-0.0001124347036,-0.0001283042366,-0.0001432458812,-0.0001560008968,-0.0001673644729,
-	-0.0001762805041,-0.0001834297873,-0.0001877251634,-0.0001900379284,-0.0001893048902,
-	-0.0001863848738,-0.0001803765917,-0.0001722919696,-0.0001612012275,-0.0001481154322,
-	-0.0001322382886,-0.0001147193761,-9.477952699e-05,-7.361114695e-05,-5.051749758e-05,
-	-2.680430043e-05,-1.750099955e-06,2.334165401e-05,4.914039891e-05,7.430479309e-05,
-	9.937436698e-05,  0.00012315817,0.0001461351349,0.0001671410719,0.0001867293468,
-	0.0002036449878,0.0002185945632,0.0002304116351,0.0002397442149,0.0002455182839,
-	0.0002485004661,0.0002476413501,0.0002438383672,0.0002361974184,0.0002256418084,
-	0.0002113131195,0.0001942867384, 0.000173826862,0.0001510562142,0.0001253109222,
-	9.784114809e-05,6.803884025e-05,3.720766472e-05,4.797220754e-06,-2.777430382e-05,
-	-6.103609485e-05,-9.361292905e-05,-0.0001259841229,-0.0001568063453,-0.0001864685619,
-	-0.0002137053816,-0.0002389655419,-0.0002609557705,-0.0002802365343,-0.000295576785,
-	-0.0003075931745,-0.0003151976271,-0.0003190641582,-0.0003181633947,-0.0003133501159,
-	-0.0003037348506,-0.0002902377455,-0.0002720903722,-0.0002503446885,-0.000224325122,
-	-0.0001952066523,-0.0001624641882,-0.0001273672387,-8.944224828e-05,-5.00770002e-05,
-	-8.888493539e-06,3.267664579e-05,7.499685307e-05,0.0001165814465,0.0001577427174,
-	0.0001970348821,0.0002347386035,0.0002694694267,0.0003015348921,0.0003296060313,
-	0.0003541171609,0.0003737752268,0.0003890809312,0.0003989017569,0.0004038534535,
-	0.0004029416014,0.0003969398094,  0.00038496661,0.0003679426445,0.0003451848461,
-	0.0003177474428,0.0002850665769,0.0002483614371,0.0002072227799,0.0001629735489,
-	0.000115318071,6.571437552e-05, 1.39452377e-05,-3.844616731e-05,-9.161860362e-05,
-	-0.000143988058,-0.000195706918,-0.0002452087065,-0.0002925906156,-0.0003363507858,
-	-0.0003766430309,-0.0004120494996,-0.0004428252869,-0.0004676335084,-0.0004868736432,
-	-0.0004993756884,-0.0005056531518,-0.0005047199083,-0.0004972845782,-0.0004825216311,
-	-0.0004613253404,-0.0004330761731,-0.0003988423268,-0.0003582016216,-0.0003124072682,
-	-0.0002611888049,-0.0002059576946,-0.0001466270478,-8.47428455e-05,-2.029332245e-05,
-	4.507195627e-05,0.0001112875107,0.0001766460773,0.0002410544112,0.0003028021601,
-	0.0003617931507,0.0004164033162,0.0004665804445,0.0005107967299,0.0005491325282,
-	0.0005801888183,0.0006042029127,0.0006199523923,0.0006278587971,0.0006269441219,
-	0.0006178308395,0.0005997408298,0.0005735479644,0.0005387257552, 0.000496364024,
-	0.0004461773206,0.0003894736583,0.0003261721286,0.0002577823761,0.0001844186918,
-	0.0001077451161, 2.80206059e-05,-5.295799565e-05,-0.0001348674414,-0.0002158521675,
-	-0.0002955398522,-0.0003720653767,-0.0004450823471,-0.0005128087359,-0.0005749493139,
-	-0.0006298477529,-0.0006773599307,-0.0007159960805,-0.0007458187174,-0.0007655621739,
-	-0.0007755102706,-0.0007746653864,-0.0007635680959,-0.0007415144355,-0.0007093438762,
-	-0.0006666263216,-0.0006144798244,-0.0005527840694,-0.0004829186364,-0.0004050159187,
-	-0.0003207081754,-0.0002303653746,-0.0001358102454,-3.75867603e-05, 6.23408705e-05,
-	0.0001633282809,0.0002633131517,0.0003616026952,0.0004561390379,0.0005462575355,
-	0.00062997645,0.0007067237166,0.0007746852934,0.0008334530285,0.0008814117173,
-	0.0009184093215,0.0009431089275,0.0009556385339,0.0009549837559,0.0009415881359,
-	0.000914796954,0.0008754105656,0.0008231276879,0.0007591040339,0.0006833941443,
-	0.0005974730011,0.0005017332733,0.0003979573376,0.0002868062293,0.0001702997106,
-	4.933466698e-05,-7.389009261e-05,-0.0001983487018,-0.0003217391204,-0.0004429857072,
-	-0.000559777196,-0.0006710654707,-0.0007746315096,-0.0008695479482,-0.0009537786827,
-	-0.001026599202,-0.001086243778,  -0.0011322957,-0.001163306995,-0.001179209561,
-	-0.001178959385,-0.001162883826,-0.001130372984,-0.001082185889, -0.00101815653,
-	-0.0009394827648,-0.0008464279235,-0.0007405959768,-0.0006226707483,-0.0004946283298,
-	-0.0003574945731,-0.000213551175,-6.409808702e-05,8.837186033e-05,0.0002423719416,
-	0.000395270501,0.0005455202772,0.0006904790644,0.0008286309312,0.0009574340074,
-	0.001075519482, 0.001180567779, 0.001271465211, 0.001346212812, 0.001404052484,
-	0.00144338666, 0.001463906141, 0.001464496949, 0.001445332193, 0.001405838644,
-	0.001346725621,  0.00126796728, 0.001170811476, 0.001055773231,0.0009246200207,
-	0.0007783767069,0.0006192653091,0.0004487508559,0.0002694506838,8.317707398e-05,
-	-0.0001071733495,-0.0002995458781,-0.0004908807459,-0.0006790330517,-0.0008609067881,
-	-0.00103439088,-0.001196506433,-0.001345311524,-0.001478081336,-0.001593190012,
-	-0.001688308432,-0.001762245083, -0.00181315979,-0.001840406214,-0.001842738595,
-	-0.001820130157,-0.001772004995,-0.001698991866,-0.001601201948,-0.001479951898,
-	-0.001336037065,-0.001171427779,-0.0009875635151,-0.0007870101254,-0.0005717776949,
-	-0.0003449313517,-0.0001089298094,0.0001327803911,0.0003774164361,0.0006213112501,
-	0.0008615312981, 0.001094338018, 0.001316823065, 0.001525369473,  0.00171726197,
-	0.001889184816, 0.002038796432, 0.002163245808, 0.002260722686, 0.002328992821,
-	0.002366925823, 0.002373021329, 0.002346929861, 0.002287991112, 0.002196696587,
-	0.002073268639, 0.001919077127, 0.001735227765, 0.001523951534, 0.001287195948,
-	0.001027974649,0.0007489892305,0.0004539384681,0.0001461521315,-0.0001701396977,
-	-0.000491161074,-0.0008123450098,-0.001129657845, -0.00143839512, -0.00173450273,
-	-0.002013365272,-0.002271124162,-0.002503500553, -0.00270706974,-0.002878105035,
-	-0.003013830865,-0.003111280268,-0.003168522613,-0.003183522495,-0.003155354643,
-	-0.003083056072,-0.002966802567,-0.002806796925,-0.002604382113,-0.002360945567,
-	-0.002078998834,-0.001761087682, -0.00141083065,-0.001031843596,-0.0006287285942,
-	-0.0002060194383,0.0002308698458,0.0006766914739, 0.001125451294, 0.001571433502,
-	0.002008328913, 0.002430241788, 0.002830838552, 0.003204356879, 0.003544764128,
-	0.00384672638, 0.004104814492, 0.004314450547, 0.004471112974, 0.004571259953,
-	0.004611543845, 0.004589712247, 0.004503815901, 0.004353086464,   0.0041371556,
-	0.00385687314, 0.003513548058, 0.003109720303, 0.002648399677, 0.002133800881,
-	0.001570593799,0.0009645834216,0.0003219692735,-0.0003500262683,-0.001043886645,
-	-0.001751211355,-0.002463436453,-0.003171293531,-0.003865508595,-0.004536296707,
-	-0.005174061283,-0.005768905394,-0.006311313715,-0.006791706197,-0.007201077882,
-	-0.007530578412,-0.007772142068,-0.007918065414,-0.007961614057, -0.00789659936,
-	-0.007717976812,-0.007421418093,-0.007003847044,-0.006463048514,-0.005798145663,
-	-0.005009212531,-0.004097711295,-0.003066099249,-0.001918210997,-0.0006588770775,
-	0.0007057475159,  0.00216856203, 0.003721242771, 0.005354620051, 0.007058450487,
-	0.008821784519,  0.01063279063,    0.012479119,  0.01434774511,  0.01622533798,
-	0.01809815317,  0.01995236613,  0.02177400701,  0.02354926802,  0.02526446618,
-	0.02690632828,   0.0284619648,  0.02991915122,  0.03126628324,  0.03249263763,
-	0.03358834982,  0.03454460949,  0.03535366058,  0.03600895777,  0.03650515899,
-	0.03683822602,  0.03700544313,  0.03700544313,  0.03683822602,  0.03650515899,
-	0.03600895777,  0.03535366058,  0.03454460949,  0.03358834982,  0.03249263763,
-	0.03126628324,  0.02991915122,   0.0284619648,  0.02690632828,  0.02526446618,
-	0.02354926802,  0.02177400701,  0.01995236613,  0.01809815317,  0.01622533798,
-	0.01434774511,    0.012479119,  0.01063279063, 0.008821784519, 0.007058450487,
-	0.005354620051, 0.003721242771,  0.00216856203,0.0007057475159,-0.0006588770775,
-	-0.001918210997,-0.003066099249,-0.004097711295,-0.005009212531,-0.005798145663,
-	-0.006463048514,-0.007003847044,-0.007421418093,-0.007717976812, -0.00789659936,
-	-0.007961614057,-0.007918065414,-0.007772142068,-0.007530578412,-0.007201077882,
-	-0.006791706197,-0.006311313715,-0.005768905394,-0.005174061283,-0.004536296707,
-	-0.003865508595,-0.003171293531,-0.002463436453,-0.001751211355,-0.001043886645,
-	-0.0003500262683,0.0003219692735,0.0009645834216, 0.001570593799, 0.002133800881,
-	0.002648399677, 0.003109720303, 0.003513548058,  0.00385687314,   0.0041371556,
-	0.004353086464, 0.004503815901, 0.004589712247, 0.004611543845, 0.004571259953,
-	0.004471112974, 0.004314450547, 0.004104814492,  0.00384672638, 0.003544764128,
-	0.003204356879, 0.002830838552, 0.002430241788, 0.002008328913, 0.001571433502,
-	0.001125451294,0.0006766914739,0.0002308698458,-0.0002060194383,-0.0006287285942,
-	-0.001031843596, -0.00141083065,-0.001761087682,-0.002078998834,-0.002360945567,
-	-0.002604382113,-0.002806796925,-0.002966802567,-0.003083056072,-0.003155354643,
-	-0.003183522495,-0.003168522613,-0.003111280268,-0.003013830865,-0.002878105035,
-	-0.00270706974,-0.002503500553,-0.002271124162,-0.002013365272, -0.00173450273,
-	-0.00143839512,-0.001129657845,-0.0008123450098,-0.000491161074,-0.0001701396977,
-	0.0001461521315,0.0004539384681,0.0007489892305, 0.001027974649, 0.001287195948,
-	0.001523951534, 0.001735227765, 0.001919077127, 0.002073268639, 0.002196696587,
-	0.002287991112, 0.002346929861, 0.002373021329, 0.002366925823, 0.002328992821,
-	0.002260722686, 0.002163245808, 0.002038796432, 0.001889184816,  0.00171726197,
-	0.001525369473, 0.001316823065, 0.001094338018,0.0008615312981,0.0006213112501,
-	0.0003774164361,0.0001327803911,-0.0001089298094,-0.0003449313517,-0.0005717776949,
-	-0.0007870101254,-0.0009875635151,-0.001171427779,-0.001336037065,-0.001479951898,
-	-0.001601201948,-0.001698991866,-0.001772004995,-0.001820130157,-0.001842738595,
-	-0.001840406214, -0.00181315979,-0.001762245083,-0.001688308432,-0.001593190012,
-	-0.001478081336,-0.001345311524,-0.001196506433, -0.00103439088,-0.0008609067881,
-	-0.0006790330517,-0.0004908807459,-0.0002995458781,-0.0001071733495,8.317707398e-05,
-	0.0002694506838,0.0004487508559,0.0006192653091,0.0007783767069,0.0009246200207,
-	0.001055773231, 0.001170811476,  0.00126796728, 0.001346725621, 0.001405838644,
-	0.001445332193, 0.001464496949, 0.001463906141,  0.00144338666, 0.001404052484,
-	0.001346212812, 0.001271465211, 0.001180567779, 0.001075519482,0.0009574340074,
-	0.0008286309312,0.0006904790644,0.0005455202772, 0.000395270501,0.0002423719416,
-	8.837186033e-05,-6.409808702e-05,-0.000213551175,-0.0003574945731,-0.0004946283298,
-	-0.0006226707483,-0.0007405959768,-0.0008464279235,-0.0009394827648, -0.00101815653,
-	-0.001082185889,-0.001130372984,-0.001162883826,-0.001178959385,-0.001179209561,
-	-0.001163306995,  -0.0011322957,-0.001086243778,-0.001026599202,-0.0009537786827,
-	-0.0008695479482,-0.0007746315096,-0.0006710654707,-0.000559777196,-0.0004429857072,
-	-0.0003217391204,-0.0001983487018,-7.389009261e-05,4.933466698e-05,0.0001702997106,
-	0.0002868062293,0.0003979573376,0.0005017332733,0.0005974730011,0.0006833941443,
-	0.0007591040339,0.0008231276879,0.0008754105656, 0.000914796954,0.0009415881359,
-	0.0009549837559,0.0009556385339,0.0009431089275,0.0009184093215,0.0008814117173,
-	0.0008334530285,0.0007746852934,0.0007067237166,  0.00062997645,0.0005462575355,
-	0.0004561390379,0.0003616026952,0.0002633131517,0.0001633282809, 6.23408705e-05,
-	-3.75867603e-05,-0.0001358102454,-0.0002303653746,-0.0003207081754,-0.0004050159187,
-	-0.0004829186364,-0.0005527840694,-0.0006144798244,-0.0006666263216,-0.0007093438762,
-	-0.0007415144355,-0.0007635680959,-0.0007746653864,-0.0007755102706,-0.0007655621739,
-	-0.0007458187174,-0.0007159960805,-0.0006773599307,-0.0006298477529,-0.0005749493139,
-	-0.0005128087359,-0.0004450823471,-0.0003720653767,-0.0002955398522,-0.0002158521675,
-	-0.0001348674414,-5.295799565e-05, 2.80206059e-05,0.0001077451161,0.0001844186918,
-	0.0002577823761,0.0003261721286,0.0003894736583,0.0004461773206, 0.000496364024,
-	0.0005387257552,0.0005735479644,0.0005997408298,0.0006178308395,0.0006269441219,
-	0.0006278587971,0.0006199523923,0.0006042029127,0.0005801888183,0.0005491325282,
-	0.0005107967299,0.0004665804445,0.0004164033162,0.0003617931507,0.0003028021601,
-	0.0002410544112,0.0001766460773,0.0001112875107,4.507195627e-05,-2.029332245e-05,
-	-8.47428455e-05,-0.0001466270478,-0.0002059576946,-0.0002611888049,-0.0003124072682,
-	-0.0003582016216,-0.0003988423268,-0.0004330761731,-0.0004613253404,-0.0004825216311,
-	-0.0004972845782,-0.0005047199083,-0.0005056531518,-0.0004993756884,-0.0004868736432,
-	-0.0004676335084,-0.0004428252869,-0.0004120494996,-0.0003766430309,-0.0003363507858,
-	-0.0002925906156,-0.0002452087065,-0.000195706918,-0.000143988058,-9.161860362e-05,
-	-3.844616731e-05, 1.39452377e-05,6.571437552e-05, 0.000115318071,0.0001629735489,
-	0.0002072227799,0.0002483614371,0.0002850665769,0.0003177474428,0.0003451848461,
-	0.0003679426445,  0.00038496661,0.0003969398094,0.0004029416014,0.0004038534535,
-	0.0003989017569,0.0003890809312,0.0003737752268,0.0003541171609,0.0003296060313,
-	0.0003015348921,0.0002694694267,0.0002347386035,0.0001970348821,0.0001577427174,
-	0.0001165814465,7.499685307e-05,3.267664579e-05,-8.888493539e-06,-5.00770002e-05,
-	-8.944224828e-05,-0.0001273672387,-0.0001624641882,-0.0001952066523,-0.000224325122,
-	-0.0002503446885,-0.0002720903722,-0.0002902377455,-0.0003037348506,-0.0003133501159,
-	-0.0003181633947,-0.0003190641582,-0.0003151976271,-0.0003075931745,-0.000295576785,
-	-0.0002802365343,-0.0002609557705,-0.0002389655419,-0.0002137053816,-0.0001864685619,
-	-0.0001568063453,-0.0001259841229,-9.361292905e-05,-6.103609485e-05,-2.777430382e-05,
-	4.797220754e-06,3.720766472e-05,6.803884025e-05,9.784114809e-05,0.0001253109222,
-	0.0001510562142, 0.000173826862,0.0001942867384,0.0002113131195,0.0002256418084,
-	0.0002361974184,0.0002438383672,0.0002476413501,0.0002485004661,0.0002455182839,
-	0.0002397442149,0.0002304116351,0.0002185945632,0.0002036449878,0.0001867293468,
-	0.0001671410719,0.0001461351349,  0.00012315817,9.937436698e-05,7.430479309e-05,
-	4.914039891e-05,2.334165401e-05,-1.750099955e-06,-2.680430043e-05,-5.051749758e-05,
-	-7.361114695e-05,-9.477952699e-05,-0.0001147193761,-0.0001322382886,-0.0001481154322,
-	-0.0001612012275,-0.0001722919696,-0.0001803765917,-0.0001863848738,-0.0001893048902,
-	-0.0001900379284,-0.0001877251634,-0.0001834297873,-0.0001762805041,-0.0001673644729,
-	-0.0001560008968,-0.0001432458812,-0.0001283042366,-0.0001124347036,-9.495481936e-05,
-	-7.694081432e-05,-5.793347009e-05,-3.89050183e-05,-1.926593723e-05,-2.408283137e-07,
-	1.889249324e-05, 3.67988323e-05,5.432538819e-05,7.024554361e-05,8.539490227e-05,
-	9.85425213e-05, 0.000110520923,0.0001202652929,0.0001287321211,0.0001348554943,
-	0.0001394832652,0.0001416088926,0.0001422824134,0.0001405872317,0.0001374290878,
-	0.0001319184375,0.0001252709772, 0.000116716823,0.0001071725928,9.593343566e-05,
-	8.426103159e-05,7.119278598e-05,5.770399002e-05,4.351627285e-05,2.922914427e-05,
-	1.456116297e-05,5.367834319e-07,-1.365246226e-05,-2.676116674e-05,-3.981521513e-05,
-	-5.157124542e-05,-6.295165076e-05,-7.26726721e-05,-8.160310244e-05,-8.861912647e-05,
-	-9.477739513e-05,-9.91161578e-05,-0.0001026047321,-0.0001040826101,-0.0001044069722,
-	-0.0001026771643,-0.000100149955,-9.603439685e-05,-9.111591498e-05,-8.42486188e-05,
-	-7.666956662e-05,-6.809681508e-05,-5.929055624e-05,-4.880327833e-05,-3.815951277e-05,
-	-2.769080493e-05,-1.607853665e-05,-4.814241493e-06,6.277499324e-06,   1.772828e-05,
-	2.822043643e-05,3.896527778e-05,4.853012433e-05,5.809376307e-05, 6.63315077e-05,
-	7.43892524e-05,8.102792344e-05,8.740096382e-05,9.234834579e-05,9.706643323e-05,
-	0.0001004961741,0.0001039275958,0.0001064563621,0.0001095604021,0.0001126200441,
-	0.0001175013604,0.0001241563587,0.0001352679683,0.0001519875805,0.0001787396177,
-	0.0002192356042, 0.000281646644, 0.000375192205,-0.0005527109606
+// indexed by SSEInterpolator::Quality
+static const QualityPreset qualityPresets[] = {
+	{ 32, 16 },
+	{ 64, 32 },
+	{ 64, 64 },
+	{ 128, 128 },
+	{ 0, 0 }, // QualityCubic has no polyphase filter
+	{ 128, 512 }
 };
 
-static const float H5[1024] = {
-	0.0006110134418,-0.0002930245828,-0.0002407839929,-0.0002040863765,-0.0001786524226,
-	-0.0001612560591,-0.0001494551398,-0.0001414003054,-0.0001356866269,-0.0001312473178,
-	-0.0001272798399,-0.0001231784699,-0.0001185078509,-0.0001129485609,-0.0001063061063,
-	-9.845154273e-05,  -8.936011e-05,-7.903436199e-05,-6.758052768e-05,-5.509335097e-05,
-	-4.178436939e-05,-2.780028626e-05,-1.346417866e-05,1.170581868e-06,1.530778718e-05,
-	2.991029396e-05, 4.25077742e-05, 5.54125254e-05, 6.67948334e-05,7.612012996e-05,
-	8.420689846e-05,  9.0712776e-05, 9.50248359e-05,9.688896534e-05,9.660072101e-05,
-	9.426387987e-05, 8.98397484e-05,8.315108425e-05, 7.42833945e-05,6.344273424e-05,
-	5.099694317e-05,3.720697714e-05,2.234661588e-05,6.605659564e-06,-9.698015674e-06,
-	-2.62498088e-05,-4.25850194e-05,-5.835518459e-05,-7.303777238e-05,-8.652784163e-05,
-	-9.812985081e-05,-0.0001081390874,-0.0001157505612,-0.0001210564442,-0.000123967402,
-	-0.0001239861158,-0.000121247147,-0.0001158188388,-0.0001076539556,-9.678300557e-05,
-	-8.357512706e-05,-6.828656478e-05,-5.11728831e-05,-3.246845517e-05,-1.264552884e-05,
-	7.88041234e-06,2.864648923e-05,4.931658987e-05,6.939304876e-05,8.843863907e-05,
-	0.0001058953421,0.0001214136719,0.0001345365017,0.0001450712152,0.0001525306579,
-	0.0001568987354,0.0001577117073,0.0001551433088,0.0001490654104,0.0001395331929,
-	0.0001268022315,0.0001109984296,9.232485172e-05,7.126259152e-05,  4.8176993e-05,
-	2.351841795e-05,-2.194934268e-06,-2.833541839e-05,-5.442810289e-05,-7.989791629e-05,
-	-0.0001041824144,-0.0001266366744,-0.000146780556,-0.0001641011331,-0.0001781857281,
-	-0.0001885937963,-0.0001950552542,-0.0001973585458,-0.0001953783212,-0.0001890791318,
-	-0.0001784349879,-0.0001636428497,-0.0001449397241,-0.0001226251916,-9.724462871e-05,
-	-6.911654782e-05,-3.894710972e-05,-7.305102827e-06,2.511007551e-05,5.765300375e-05,
-	8.951059863e-05,0.0001200978295,0.0001486377005,0.0001744895126,0.0001969434379,
-	0.0002155461552,0.0002297261235,0.0002391503658,0.0002434467606,0.0002425269049,
-	0.000236206979,0.0002245976648, 0.000207753561,0.0001860869816, 0.000159854535,
-	0.0001296671689,9.597112512e-05,5.955289453e-05,2.111651156e-05,-1.851302477e-05,
-	-5.848698129e-05,-9.790540207e-05,-0.0001359454764,-0.0001716436527,-0.000204259748,
-	-0.0002329881536,-0.0002571489022,-0.0002760655188,-0.0002892930643,-0.0002963630832,
-	-0.0002970547648,-0.0002912084456,-0.0002788856218,-0.0002601652232,-0.0002353825257,
-	-0.0002049496397,-0.0001694731764,-0.0001296012197,-8.615192201e-05,-4.00170502e-05,
-	7.818016456e-06,5.635889102e-05,0.0001045017852,0.0001512430754,0.0001954314357,
-	0.0002361607912,0.0002724002698,0.0003033117973,0.0003280765959,0.0003460760345,
-	0.0003567376698,0.0003597815521,0.0003549406538,0.0003422173322,0.0003217191552,
-	0.0002938190592, 0.000258933811,0.0002177631686, 0.000171061547, 0.000119808974,
-	6.499663141e-05,7.839850696e-06,-5.050309119e-05,-0.0001087155542,-0.000165580248,
-	-0.0002197434806,-0.000270007964,-0.0003151787969,-0.0003541946353,-0.000386089494,
-	-0.0004100351653,-0.000425355538,-0.0004316030827,-0.0004284342285,-0.0004157926014,
-	-0.0003937835572,-0.0003627449041,-0.0003231935552,-0.0002758831251,-0.0002216898574,
-	-0.0001617210801,-9.719679656e-05,-2.946544009e-05,4.006344898e-05,0.0001098636276,
-	0.0001784076157, 0.000244161376,0.0003056360583,0.0003613991721,0.0004101392115,
-	0.0004506616096,0.0004819504102,0.0005031267647,0.0005136077525, 0.000512941042,
-	0.0005009952001,0.0004778160655,0.0004437536409,0.0003993793798,0.0003455135447,
-	0.0002831492748,0.0002135583054,0.0001381270122, 5.84401605e-05,-2.383126412e-05,
-	-0.0001068973434,-0.0001889741252,-0.0002682040213,-0.0003428251366,-0.0004111012968,
-	-0.0004714477691,-0.0005223687622,-0.0005626325146,-0.0005911596818,-0.0006071570679,
-	-0.000610043935,-0.0005995646934,-0.0005757322651,-0.0005388530553,-0.0004895359743,
-	-0.0004286742478,-0.0003574046132,-0.0002771527797,-0.0001895202877,-9.634445451e-05,
-	4.278293773e-07,9.872599185e-05,0.0001964201074,0.0002913255885,0.0003813367221,
-	0.0004643787688,0.0005385223776,0.0006019844441,0.0006532121333,0.0006908683572,
-	0.0007139330846,0.0007216585218,0.0007136375643,0.0006897844141,0.0006503995392,
-	0.0005960785784,0.0005278087338,0.0004468412953,0.0003548058157,0.0002535070234,
-	0.0001450573327,3.170669879e-05,-8.410561713e-05,-0.0001998902153,-0.0003130716505,
-	-0.0004211526248,-0.0005216403515,-0.0006122431369,-0.0006907838979,-0.0007553652395,
-	-0.0008043239359,-0.0008363812231,-0.000850526907,-0.0008462013793,-0.0008231819374,
-	-0.0007817156147,-0.0007223918801,-0.0006462745951,-0.0005547376932,-0.0004495817993,
-	-0.0003328883904,-0.0002070663177,-7.471796562e-05, 6.13314478e-05,0.0001981598325,
-	0.0003327475861,0.0004621371918,0.0005833661417, 0.000693672162,0.0007904332597,
-	0.0008713337593,0.0009343233542,0.0009777587838, 0.001000350341,  0.00100131135,
-	0.0009802526329,0.0009373165667,0.0008730858681,0.0007886594394,0.0006855431129,
-	0.0005657449947,0.0004316156555,0.0002859023807,0.0001315975242,-2.800918992e-05,
-	-0.0001895295718,-0.0003494007397,-0.0005041207769,-0.0006501712487,-0.0007842439227,
-	-0.0009031656664,-0.001004108228,-0.001084549818, -0.00114242523,-0.001176069141,
-	-0.001184393303,-0.001166779781,-0.001123235212,-0.001054273569,-0.0009610317647,
-	-0.0008451463073,-0.0007088351413,-0.0005547313485,-0.0003859702847,-0.0002060018305,
-	-1.86225916e-05,0.0001721939479,  0.00036227901,0.0005474706995,0.0007236028905,
-	0.0008866703138, 0.001032863744, 0.001158712897, 0.001261108322, 0.001337435097,
-	0.001385569572, 0.001404013252, 0.001391849364, 0.001348870108, 0.001275502029,
-	0.001172865857, 0.001042719581,0.0008874865016,0.0007101440569,0.0005142372684,
-	0.0003037450369,8.306254313e-05,-0.000143139725,-0.0003699754307,-0.0005924876896,
-	-0.0008056958904,-0.001004775637,  -0.0011851046,-0.001342414645,-0.001472840551,
-	-0.001573083922,-0.001640404342,-0.001672776882,-0.001668875804, -0.00162817759,
-	-0.001550927525,-0.001438197098,-0.001291838358,-0.001114489627,-0.0009094908601,
-	-0.0006808756152,-0.0004332325188,-0.0001716729603,9.830873751e-05,0.0003709253215,
-	0.0006402510917,0.0009003040614, 0.001145217102, 0.001369326259, 0.001567340922,
-	0.001734438469, 0.001866389415, 0.001959646353, 0.002011458855, 0.002019922715,
-	0.001984043047, 0.001903787605,  0.00178008934, 0.001614844427,  0.00141090143,
-	0.001172001823,0.0009027273627,0.0006084005581,0.0002950025664,-3.095585271e-05,
-	-0.0003625684767,-0.0006926669157,-0.001013974892,-0.001319274306,-0.001601544791,
-	-0.001854135888,-0.002070916584,-0.002246412449,-0.002375934739,-0.002455711365,
-	-0.002482970944,-0.002456045011,-0.002374397358,-0.002238680143,-0.002050733427,
-	-0.00181359204,-0.001531400834,-0.001209392329,-0.0008537691901,-0.000471602485,
-	-7.068832201e-05,0.0003405897005,0.0007534499746, 0.001158875879, 0.001547825988,
-	0.001911396277, 0.002241054783, 0.002528799232, 0.002767363563, 0.002950375667,
-	0.003072536318, 0.003129726043, 0.003119158093, 0.003039435949, 0.002890634816,
-	0.002674325369, 0.002393586794, 0.002052960685, 0.001658406807, 0.001217189012,
-	0.0007377722068,0.0002296613529,-0.0002967763285,-0.0008305247175,-0.001360098366,
-	-0.001873818692,-0.002360026818,-0.002807357581, -0.00320496154,-0.003542776918,
-	-0.003811739851,-0.004004022572,-0.004113211762,-0.004134515766,-0.004064867273,
-	-0.00390307582,-0.003649877617,-0.003308001673,-0.002882136498, -0.00237893546,
-	-0.001806878368,-0.001176206395,-0.0004987096763,0.0002124223975,0.0009428822668,
-	0.001677449443, 0.002400338184, 0.003095440101, 0.003746706992, 0.004338437226,
-	0.004855640233, 0.005284323823, 0.005611874629, 0.005827298388, 0.005921552423,
-	0.005887743086, 0.005721401423, 0.005420601461, 0.004986140411,  0.00442158198,
-	0.003733333433,  0.00293057668, 0.002025256399, 0.001031906228,-3.24912362e-05,
-	-0.00114875997,-0.002295769984,-0.003450790187,-0.004589799326,-0.005687913857,
-	-0.006719765719,-0.007659961004,-0.008483495563,-0.009166236036,-0.009685323574,
-	-0.01001965255, -0.01015024073, -0.01006064285,-0.009737283923,-0.009169790894,
-	-0.008351224475, -0.00727831712,-0.005951603409,-0.004375541117,-0.002558496781,
-	-0.0005127479089,   0.0017456481, 0.004196995869, 0.006818220019, 0.009583114646,
-	0.01246272866,  0.01542572584,  0.01843884215,  0.02146734111,  0.02447554469,
-	0.02742732503,  0.03028667346,  0.03301820904,  0.03558774665,  0.03796278685,
-	0.04011304304,  0.04201088473,  0.04363178462,  0.04495467618,   0.0459623076,
-	0.04664149508,  0.04698333889,  0.04698333889,  0.04664149508,   0.0459623076,
-	0.04495467618,  0.04363178462,  0.04201088473,  0.04011304304,  0.03796278685,
-	0.03558774665,  0.03301820904,  0.03028667346,  0.02742732503,  0.02447554469,
-	0.02146734111,  0.01843884215,  0.01542572584,  0.01246272866, 0.009583114646,
-	0.006818220019, 0.004196995869,   0.0017456481,-0.0005127479089,-0.002558496781,
-	-0.004375541117,-0.005951603409, -0.00727831712,-0.008351224475,-0.009169790894,
-	-0.009737283923, -0.01006064285, -0.01015024073, -0.01001965255,-0.009685323574,
-	-0.009166236036,-0.008483495563,-0.007659961004,-0.006719765719,-0.005687913857,
-	-0.004589799326,-0.003450790187,-0.002295769984, -0.00114875997,-3.24912362e-05,
-	0.001031906228, 0.002025256399,  0.00293057668, 0.003733333433,  0.00442158198,
-	0.004986140411, 0.005420601461, 0.005721401423, 0.005887743086, 0.005921552423,
-	0.005827298388, 0.005611874629, 0.005284323823, 0.004855640233, 0.004338437226,
-	0.003746706992, 0.003095440101, 0.002400338184, 0.001677449443,0.0009428822668,
-	0.0002124223975,-0.0004987096763,-0.001176206395,-0.001806878368, -0.00237893546,
-	-0.002882136498,-0.003308001673,-0.003649877617, -0.00390307582,-0.004064867273,
-	-0.004134515766,-0.004113211762,-0.004004022572,-0.003811739851,-0.003542776918,
-	-0.00320496154,-0.002807357581,-0.002360026818,-0.001873818692,-0.001360098366,
-	-0.0008305247175,-0.0002967763285,0.0002296613529,0.0007377722068, 0.001217189012,
-	0.001658406807, 0.002052960685, 0.002393586794, 0.002674325369, 0.002890634816,
-	0.003039435949, 0.003119158093, 0.003129726043, 0.003072536318, 0.002950375667,
-	0.002767363563, 0.002528799232, 0.002241054783, 0.001911396277, 0.001547825988,
-	0.001158875879,0.0007534499746,0.0003405897005,-7.068832201e-05,-0.000471602485,
-	-0.0008537691901,-0.001209392329,-0.001531400834, -0.00181359204,-0.002050733427,
-	-0.002238680143,-0.002374397358,-0.002456045011,-0.002482970944,-0.002455711365,
-	-0.002375934739,-0.002246412449,-0.002070916584,-0.001854135888,-0.001601544791,
-	-0.001319274306,-0.001013974892,-0.0006926669157,-0.0003625684767,-3.095585271e-05,
-	0.0002950025664,0.0006084005581,0.0009027273627, 0.001172001823,  0.00141090143,
-	0.001614844427,  0.00178008934, 0.001903787605, 0.001984043047, 0.002019922715,
-	0.002011458855, 0.001959646353, 0.001866389415, 0.001734438469, 0.001567340922,
-	0.001369326259, 0.001145217102,0.0009003040614,0.0006402510917,0.0003709253215,
-	9.830873751e-05,-0.0001716729603,-0.0004332325188,-0.0006808756152,-0.0009094908601,
-	-0.001114489627,-0.001291838358,-0.001438197098,-0.001550927525, -0.00162817759,
-	-0.001668875804,-0.001672776882,-0.001640404342,-0.001573083922,-0.001472840551,
-	-0.001342414645,  -0.0011851046,-0.001004775637,-0.0008056958904,-0.0005924876896,
-	-0.0003699754307,-0.000143139725,8.306254313e-05,0.0003037450369,0.0005142372684,
-	0.0007101440569,0.0008874865016, 0.001042719581, 0.001172865857, 0.001275502029,
-	0.001348870108, 0.001391849364, 0.001404013252, 0.001385569572, 0.001337435097,
-	0.001261108322, 0.001158712897, 0.001032863744,0.0008866703138,0.0007236028905,
-	0.0005474706995,  0.00036227901,0.0001721939479,-1.86225916e-05,-0.0002060018305,
-	-0.0003859702847,-0.0005547313485,-0.0007088351413,-0.0008451463073,-0.0009610317647,
-	-0.001054273569,-0.001123235212,-0.001166779781,-0.001184393303,-0.001176069141,
-	-0.00114242523,-0.001084549818,-0.001004108228,-0.0009031656664,-0.0007842439227,
-	-0.0006501712487,-0.0005041207769,-0.0003494007397,-0.0001895295718,-2.800918992e-05,
-	0.0001315975242,0.0002859023807,0.0004316156555,0.0005657449947,0.0006855431129,
-	0.0007886594394,0.0008730858681,0.0009373165667,0.0009802526329,  0.00100131135,
-	0.001000350341,0.0009777587838,0.0009343233542,0.0008713337593,0.0007904332597,
-	0.000693672162,0.0005833661417,0.0004621371918,0.0003327475861,0.0001981598325,
-	6.13314478e-05,-7.471796562e-05,-0.0002070663177,-0.0003328883904,-0.0004495817993,
-	-0.0005547376932,-0.0006462745951,-0.0007223918801,-0.0007817156147,-0.0008231819374,
-	-0.0008462013793,-0.000850526907,-0.0008363812231,-0.0008043239359,-0.0007553652395,
-	-0.0006907838979,-0.0006122431369,-0.0005216403515,-0.0004211526248,-0.0003130716505,
-	-0.0001998902153,-8.410561713e-05,3.170669879e-05,0.0001450573327,0.0002535070234,
-	0.0003548058157,0.0004468412953,0.0005278087338,0.0005960785784,0.0006503995392,
-	0.0006897844141,0.0007136375643,0.0007216585218,0.0007139330846,0.0006908683572,
-	0.0006532121333,0.0006019844441,0.0005385223776,0.0004643787688,0.0003813367221,
-	0.0002913255885,0.0001964201074,9.872599185e-05,4.278293773e-07,-9.634445451e-05,
-	-0.0001895202877,-0.0002771527797,-0.0003574046132,-0.0004286742478,-0.0004895359743,
-	-0.0005388530553,-0.0005757322651,-0.0005995646934,-0.000610043935,-0.0006071570679,
-	-0.0005911596818,-0.0005626325146,-0.0005223687622,-0.0004714477691,-0.0004111012968,
-	-0.0003428251366,-0.0002682040213,-0.0001889741252,-0.0001068973434,-2.383126412e-05,
-	5.84401605e-05,0.0001381270122,0.0002135583054,0.0002831492748,0.0003455135447,
-	0.0003993793798,0.0004437536409,0.0004778160655,0.0005009952001, 0.000512941042,
-	0.0005136077525,0.0005031267647,0.0004819504102,0.0004506616096,0.0004101392115,
-	0.0003613991721,0.0003056360583, 0.000244161376,0.0001784076157,0.0001098636276,
-	4.006344898e-05,-2.946544009e-05,-9.719679656e-05,-0.0001617210801,-0.0002216898574,
-	-0.0002758831251,-0.0003231935552,-0.0003627449041,-0.0003937835572,-0.0004157926014,
-	-0.0004284342285,-0.0004316030827,-0.000425355538,-0.0004100351653,-0.000386089494,
-	-0.0003541946353,-0.0003151787969,-0.000270007964,-0.0002197434806,-0.000165580248,
-	-0.0001087155542,-5.050309119e-05,7.839850696e-06,6.499663141e-05, 0.000119808974,
-	0.000171061547,0.0002177631686, 0.000258933811,0.0002938190592,0.0003217191552,
-	0.0003422173322,0.0003549406538,0.0003597815521,0.0003567376698,0.0003460760345,
-	0.0003280765959,0.0003033117973,0.0002724002698,0.0002361607912,0.0001954314357,
-	0.0001512430754,0.0001045017852,5.635889102e-05,7.818016456e-06,-4.00170502e-05,
-	-8.615192201e-05,-0.0001296012197,-0.0001694731764,-0.0002049496397,-0.0002353825257,
-	-0.0002601652232,-0.0002788856218,-0.0002912084456,-0.0002970547648,-0.0002963630832,
-	-0.0002892930643,-0.0002760655188,-0.0002571489022,-0.0002329881536,-0.000204259748,
-	-0.0001716436527,-0.0001359454764,-9.790540207e-05,-5.848698129e-05,-1.851302477e-05,
-	2.111651156e-05,5.955289453e-05,9.597112512e-05,0.0001296671689, 0.000159854535,
-	0.0001860869816, 0.000207753561,0.0002245976648, 0.000236206979,0.0002425269049,
-	0.0002434467606,0.0002391503658,0.0002297261235,0.0002155461552,0.0001969434379,
-	0.0001744895126,0.0001486377005,0.0001200978295,8.951059863e-05,5.765300375e-05,
-	2.511007551e-05,-7.305102827e-06,-3.894710972e-05,-6.911654782e-05,-9.724462871e-05,
-	-0.0001226251916,-0.0001449397241,-0.0001636428497,-0.0001784349879,-0.0001890791318,
-	-0.0001953783212,-0.0001973585458,-0.0001950552542,-0.0001885937963,-0.0001781857281,
-	-0.0001641011331,-0.000146780556,-0.0001266366744,-0.0001041824144,-7.989791629e-05,
-	-5.442810289e-05,-2.833541839e-05,-2.194934268e-06,2.351841795e-05,  4.8176993e-05,
-	7.126259152e-05,9.232485172e-05,0.0001109984296,0.0001268022315,0.0001395331929,
-	0.0001490654104,0.0001551433088,0.0001577117073,0.0001568987354,0.0001525306579,
-	0.0001450712152,0.0001345365017,0.0001214136719,0.0001058953421,8.843863907e-05,
-	6.939304876e-05,4.931658987e-05,2.864648923e-05, 7.88041234e-06,-1.264552884e-05,
-	-3.246845517e-05,-5.11728831e-05,-6.828656478e-05,-8.357512706e-05,-9.678300557e-05,
-	-0.0001076539556,-0.0001158188388,-0.000121247147,-0.0001239861158,-0.000123967402,
-	-0.0001210564442,-0.0001157505612,-0.0001081390874,-9.812985081e-05,-8.652784163e-05,
-	-7.303777238e-05,-5.835518459e-05,-4.25850194e-05,-2.62498088e-05,-9.698015674e-06,
-	6.605659564e-06,2.234661588e-05,3.720697714e-05,5.099694317e-05,6.344273424e-05,
-	7.42833945e-05,8.315108425e-05, 8.98397484e-05,9.426387987e-05,9.660072101e-05,
-	9.688896534e-05, 9.50248359e-05,  9.0712776e-05,8.420689846e-05,7.612012996e-05,
-	6.67948334e-05, 5.54125254e-05, 4.25077742e-05,2.991029396e-05,1.530778718e-05,
-	1.170581868e-06,-1.346417866e-05,-2.780028626e-05,-4.178436939e-05,-5.509335097e-05,
-	-6.758052768e-05,-7.903436199e-05,  -8.936011e-05,-9.845154273e-05,-0.0001063061063,
-	-0.0001129485609,-0.0001185078509,-0.0001231784699,-0.0001272798399,-0.0001312473178,
-	-0.0001356866269,-0.0001414003054,-0.0001494551398,-0.0001612560591,-0.0001786524226,
-	-0.0002040863765,-0.0002407839929,-0.0002930245828,0.0006110134418
-};
+static quint64 greatestCommonDivisor(quint64 a, quint64 b)
+{
+	while(b != 0) {
+		quint64 t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
 
-static const float H6[1024] = {
-	-0.0006470394437,0.0002327283873,0.0002030453616,0.0001830419496,0.0001692567166,
-	0.0001608583989,0.0001551579917,0.0001519610669,0.0001490942668,0.0001468122791,
-	0.0001433132275,0.0001392007835,0.0001329622464,0.0001254969247,0.0001155265345,
-	0.000104214254,9.046854393e-05,7.569412264e-05,5.892304762e-05,4.178751988e-05,
-	2.334310375e-05,5.498939117e-06,-1.297531526e-05,-2.938185935e-05,-4.618465755e-05,
-	-5.963993681e-05,-7.165852003e-05,-8.149476344e-05,-8.826978592e-05,-9.14283446e-05,
-	-9.200556815e-05,-8.926481678e-05,-8.374747267e-05,-7.464583905e-05,-6.309697346e-05,
-	-4.875980449e-05,-3.301476318e-05,-1.545555824e-05,2.560194389e-06, 2.14276406e-05,
-	3.962936171e-05,5.746062379e-05,7.330832887e-05,8.756037278e-05,9.867963672e-05,
-	0.0001073339372,  0.00011206005,0.0001138687076,0.0001114477709,0.0001057661211,
-	9.631569992e-05,8.361571963e-05,6.758263771e-05,4.944565808e-05,2.876153121e-05,
-	6.971205494e-06,-1.590672036e-05,-3.830931746e-05,-6.042403766e-05,-8.070270269e-05,
-	-9.923583275e-05,-0.0001144710841,-0.000126728497,-0.0001347253274,-0.000139009062,
-	-0.0001384480856,-0.0001338118018,-0.0001242470898,-0.0001108886645,-9.31884133e-05,
-	-7.254907541e-05,-4.868366523e-05,-2.306109309e-05,4.199524938e-06,3.166613169e-05,
-	5.904918726e-05,8.466807049e-05,0.0001085757976,0.0001290446235,0.0001461531647,
-	0.0001585146238, 0.000166478465,0.0001687759068,0.0001660462149,0.0001574587659,
-	0.0001440326596,0.0001252170478,0.0001023507575,7.526027184e-05,4.561813694e-05,
-	1.346804675e-05,-1.93752694e-05,-5.272405906e-05,-8.466254076e-05,-0.0001149147574,
-	-0.0001416953892,-0.0001647954778,-0.0001826962689,-0.0001954425388,-0.0002016827784,
-	-0.0002019818494,-0.0001952907187,-0.0001825612999,-0.0001632908679,-0.0001387845259,
-	-0.0001088473509, -7.5214768e-05,-3.80618294e-05,6.588032306e-07,4.057072874e-05,
-	7.953176828e-05,0.0001170971373,0.0001512067684,0.0001815371361,0.0002061828272,
-	0.000225040756,0.0002365756081, 0.000241083646,0.0002375008771,0.0002265485964,
-	0.0002076626261,0.0001821142359,0.0001497582853,0.0001124064947,7.025207742e-05,
-	2.543008486e-05,-2.147783744e-05,-6.817420945e-05,-0.0001139771848,-0.0001565202983,
-	-0.0001952274615,-0.0002279578912,-0.0002543539449,-0.0002725944505,-0.0002827829157,
-	-0.0002836204076,-0.0002757175534,-0.0002583400637,-0.0002326995746,-0.0001986653369,
-	-0.0001579768868,-0.0001110237426,-6.002234659e-05,-5.751605386e-06, 4.92648287e-05,
-	0.0001041340583,0.0001562029793,0.0002046103618,0.0002468648017,0.0002823049435,
-	0.0003088656813,0.0003263416875, 0.000333159056,0.0003297466901,0.0003152159625,
-	0.0002906428126,0.0002558353008,0.0002125592873, 0.000161237971,0.0001041891519,
-	4.236628592e-05,-2.150083128e-05,-8.619543951e-05,-0.0001488509879,-0.0002082027349,
-	-0.0002614633995,-0.0003076214925,-0.0003442346351,-0.0003707870492,-0.0003853910603,
-	-0.0003882120363,-0.0003781432752,-0.0003560773039,-0.0003217352787,-0.0002768015838,
-	-0.0002217478032,-0.0001590001921,-8.965199231e-05,-1.660605267e-05,5.861932004e-05,
-	0.0001328351063, 0.000204419237,0.0002702243801,0.0003288004664,0.0003773564531,
-	0.0004149414599,0.0004393663548,0.0004503988312,0.0004466790415,0.0004288772761,
-	0.0003965248761,0.0003512179246,0.0002934062795,0.0002255483851,0.0001488976268,
-	6.653601304e-05,-1.971392339e-05,-0.0001063750169,-0.0001914221211,-0.0002713077993,
-	-0.0003441313165,-0.0004066656402,-0.0004574625636,-0.0004939427017,-0.000515457883,
-	-0.0005203060573,-0.0005087991594,-0.0004802983603,-0.000436198432,-0.0003769158793,
-	-0.0003048718791,-0.0002214384294,-0.0001298749849,-3.225079854e-05,6.761770055e-05,
-	0.000167281818,0.0002627876238,0.0003517109435,0.0004303593305,0.0004967271234,
-	0.000547763193,0.0005823004176,0.0005982256262,0.0005954457447,0.0005730364937,
-	0.0005321134231,0.0004729987995,0.0003980262554,0.0003086469951,0.0002082312567,
-	9.914566908e-05,-1.452562174e-05,-0.0001298960124,-0.0002425504645,-0.0003495065612,
-	-0.0004465189704,-0.0005310005508,-0.0005993242958,-0.0006497204886,-0.0006795974332,
-	-0.0006883337046,-0.0006746455911,-0.0006392905489,-0.0005824034452,-0.0005061564734,
-	-0.0004120188823,-0.0003034310066,-0.0001830094698,-5.511580093e-05,7.689934137e-05,
-	0.0002081715793,0.0003351160558,0.0004528973659,0.0005582260783,0.0006468542269,
-	0.0007163127302,0.0007633963833,0.0007868922548,0.0007850269903,0.0007581060054,
-	0.0007059627096, 0.000630528084,0.0005332464934,0.0004175363865,0.0002862240945,
-	0.000143930185,-5.547025921e-06,-0.0001568594016,-0.0003057807626,-0.0004468326515,
-	-0.0005759638734,-0.0006882101879,-0.0007802919135,-0.0008483004058,-0.0008902858244,
-	-0.0009038728313,-0.0008887897129,-0.0008444700507,-0.0007724904572,-0.0006741399993,
-	-0.0005527894828,-0.0004114007752,-0.0002548129996,-8.72596429e-05,8.543235163e-05,
-	0.0002583500464,0.0004253404913,0.0005814908072,0.0007210108452,0.0008397205966,
-	0.0009328782326,0.0009976582369, 0.001030943706,   0.0010317415, 0.000998952426,
-	0.0009336705552,0.0008369293064,0.0007119291695,0.0005616910639,0.0003912279499,
-	0.0002051753108,9.848988157e-06,-0.0001891456341,-0.0003848943161,-0.0005715747247,
-	-0.0007424746873,-0.0008923590067,-0.001015521819,-0.001108101453,-0.001166092698,
-	-0.001187601476,-0.001170825446,-0.001116235857,-0.001024455647,-0.000898386701,
-	-0.0007410258404,-0.000557475083,-0.0003527237859,-0.000133553418,9.370380576e-05,
-	0.0003213235468,0.0005424817209,0.0007494254969, 0.000935746124, 0.001094599138,
-	0.001220912905, 0.001309581799, 0.001357628615, 0.001362354378, 0.001323389588,
-	0.001240793266, 0.001117002568, 0.000954851741,0.0007594324416,0.0005360271316,
-	0.0002918687242,3.400645801e-05,-0.0002289816766,-0.0004891630961,-0.0007376261638,
-	-0.0009666211554,-0.001167970477,-0.001335174195,-0.001461803447,-0.001543553895,
-	-0.001576573937,-0.001559423865,-0.001491367002,-0.001374181244,-0.001210367307,
-	-0.001004862599,-0.0007631508633,-0.0004928468261,-0.0002017497463, 0.000100668236,
-	0.0004052773875, 0.000701853598,0.0009811174823, 0.001233325806, 0.001450291951,
-	0.001623968361, 0.001748409006, 0.001818320132, 0.001830885303, 0.001784268883,
-	0.001679327805, 0.001518001431, 0.001304889098, 0.001045531826,0.0007478561602,
-	0.0004203841672,7.352607645e-05,-0.0002822695533,-0.0006352944765,-0.0009744894924,
-	-0.001288275351,-0.001566431252,-0.001798936515,-0.001977810403,-0.002095894655,
-	-0.002148598898,-0.002132609952,-0.002047497779,-0.001894318615,-0.001677060965,
-	-0.00140113954,-0.001074661617,-0.0007068245905,-0.0003090330283,0.0001068215715,
-	0.0005273391143,0.0009393843357, 0.001329154009, 0.001683953917, 0.001991302008,
-	0.002240643837, 0.002422410296, 0.002529667923, 0.002557085594, 0.002502425341,
-	0.002365404274, 0.002149016596, 0.001858234056, 0.001501147635, 0.001087537734,
-	0.0006298196968,0.0001414916624,-0.0003620755451,-0.0008652701508,-0.001351569663,
-	-0.001805196283,-0.002210495062,-0.002553578001,-0.002821665956,-0.003004649421,
-	-0.003094366984,-0.003085997887,-0.002977212425,-0.002769376384,-0.002466529841,
-	-0.002076389501,-0.001609124942,-0.001078136731,-0.0004986916902,0.0001115028572,
-	0.0007338170544, 0.001348263002,  0.00193507853, 0.002474396257, 0.002947820816,
-	0.003338105278, 0.003630659543, 0.003813169198, 0.003876945004, 0.003816402052,
-	0.003630207619, 0.003320556832, 0.002894073026, 0.002360870829, 0.001735167578,
-	0.001034131856,0.0002782465599,-0.0005100521958,-0.001306214835,-0.002085083863,
-	-0.002820876893,-0.003488737857,-0.004064800218,-0.004527705256,-0.004858603235,
-	-0.005042545963,-0.005068379454,-0.004929901566,-0.004625536967,-0.004159213044,
-	-0.003539771307,-0.002781507093,-0.001903287484,-0.0009287676075, 0.000114790666,
-	0.001196606318, 0.002283784328, 0.003341656877, 0.004335332196, 0.005230180919,
-	0.00599345332, 0.006594783161, 0.007007736247, 0.007210235577, 0.007185906172,
-	0.00692431815, 0.006422023289, 0.005682495888, 0.004716805182, 0.003543201135,
-	0.002187341917,0.0006814978551,-0.0009356244118,-0.002620055573,-0.004323134664,
-	-0.00599297788,-0.007575342432,-0.009015307762, -0.01025831886, -0.01125193201,
-	-0.01194691658, -0.01229892299, -0.01226947084, -0.01182741113, -0.01094966102,
-	-0.009622320533,-0.007841057144,-0.005611757748,-0.002950478811,0.0001164109708,
-	0.003552757204, 0.007312984671,  0.01134308986,  0.01558149699,  0.01996042952,
-	0.02440715209,  0.02884564176,  0.03319808841,  0.03738668561,  0.04133525863,
-	0.04497104511,  0.04822622985,  0.05103956163,  0.05335767195,   0.0551363416,
-	0.05634146929,   0.0569498986,   0.0569498986,  0.05634146929,   0.0551363416,
-	0.05335767195,  0.05103956163,  0.04822622985,  0.04497104511,  0.04133525863,
-	0.03738668561,  0.03319808841,  0.02884564176,  0.02440715209,  0.01996042952,
-	0.01558149699,  0.01134308986, 0.007312984671, 0.003552757204,0.0001164109708,
-	-0.002950478811,-0.005611757748,-0.007841057144,-0.009622320533, -0.01094966102,
-	-0.01182741113, -0.01226947084, -0.01229892299, -0.01194691658, -0.01125193201,
-	-0.01025831886,-0.009015307762,-0.007575342432, -0.00599297788,-0.004323134664,
-	-0.002620055573,-0.0009356244118,0.0006814978551, 0.002187341917, 0.003543201135,
-	0.004716805182, 0.005682495888, 0.006422023289,  0.00692431815, 0.007185906172,
-	0.007210235577, 0.007007736247, 0.006594783161,  0.00599345332, 0.005230180919,
-	0.004335332196, 0.003341656877, 0.002283784328, 0.001196606318, 0.000114790666,
-	-0.0009287676075,-0.001903287484,-0.002781507093,-0.003539771307,-0.004159213044,
-	-0.004625536967,-0.004929901566,-0.005068379454,-0.005042545963,-0.004858603235,
-	-0.004527705256,-0.004064800218,-0.003488737857,-0.002820876893,-0.002085083863,
-	-0.001306214835,-0.0005100521958,0.0002782465599, 0.001034131856, 0.001735167578,
-	0.002360870829, 0.002894073026, 0.003320556832, 0.003630207619, 0.003816402052,
-	0.003876945004, 0.003813169198, 0.003630659543, 0.003338105278, 0.002947820816,
-	0.002474396257,  0.00193507853, 0.001348263002,0.0007338170544,0.0001115028572,
-	-0.0004986916902,-0.001078136731,-0.001609124942,-0.002076389501,-0.002466529841,
-	-0.002769376384,-0.002977212425,-0.003085997887,-0.003094366984,-0.003004649421,
-	-0.002821665956,-0.002553578001,-0.002210495062,-0.001805196283,-0.001351569663,
-	-0.0008652701508,-0.0003620755451,0.0001414916624,0.0006298196968, 0.001087537734,
-	0.001501147635, 0.001858234056, 0.002149016596, 0.002365404274, 0.002502425341,
-	0.002557085594, 0.002529667923, 0.002422410296, 0.002240643837, 0.001991302008,
-	0.001683953917, 0.001329154009,0.0009393843357,0.0005273391143,0.0001068215715,
-	-0.0003090330283,-0.0007068245905,-0.001074661617, -0.00140113954,-0.001677060965,
-	-0.001894318615,-0.002047497779,-0.002132609952,-0.002148598898,-0.002095894655,
-	-0.001977810403,-0.001798936515,-0.001566431252,-0.001288275351,-0.0009744894924,
-	-0.0006352944765,-0.0002822695533,7.352607645e-05,0.0004203841672,0.0007478561602,
-	0.001045531826, 0.001304889098, 0.001518001431, 0.001679327805, 0.001784268883,
-	0.001830885303, 0.001818320132, 0.001748409006, 0.001623968361, 0.001450291951,
-	0.001233325806,0.0009811174823, 0.000701853598,0.0004052773875, 0.000100668236,
-	-0.0002017497463,-0.0004928468261,-0.0007631508633,-0.001004862599,-0.001210367307,
-	-0.001374181244,-0.001491367002,-0.001559423865,-0.001576573937,-0.001543553895,
-	-0.001461803447,-0.001335174195,-0.001167970477,-0.0009666211554,-0.0007376261638,
-	-0.0004891630961,-0.0002289816766,3.400645801e-05,0.0002918687242,0.0005360271316,
-	0.0007594324416, 0.000954851741, 0.001117002568, 0.001240793266, 0.001323389588,
-	0.001362354378, 0.001357628615, 0.001309581799, 0.001220912905, 0.001094599138,
-	0.000935746124,0.0007494254969,0.0005424817209,0.0003213235468,9.370380576e-05,
-	-0.000133553418,-0.0003527237859,-0.000557475083,-0.0007410258404,-0.000898386701,
-	-0.001024455647,-0.001116235857,-0.001170825446,-0.001187601476,-0.001166092698,
-	-0.001108101453,-0.001015521819,-0.0008923590067,-0.0007424746873,-0.0005715747247,
-	-0.0003848943161,-0.0001891456341,9.848988157e-06,0.0002051753108,0.0003912279499,
-	0.0005616910639,0.0007119291695,0.0008369293064,0.0009336705552, 0.000998952426,
-	0.0010317415, 0.001030943706,0.0009976582369,0.0009328782326,0.0008397205966,
-	0.0007210108452,0.0005814908072,0.0004253404913,0.0002583500464,8.543235163e-05,
-	-8.72596429e-05,-0.0002548129996,-0.0004114007752,-0.0005527894828,-0.0006741399993,
-	-0.0007724904572,-0.0008444700507,-0.0008887897129,-0.0009038728313,-0.0008902858244,
-	-0.0008483004058,-0.0007802919135,-0.0006882101879,-0.0005759638734,-0.0004468326515,
-	-0.0003057807626,-0.0001568594016,-5.547025921e-06, 0.000143930185,0.0002862240945,
-	0.0004175363865,0.0005332464934, 0.000630528084,0.0007059627096,0.0007581060054,
-	0.0007850269903,0.0007868922548,0.0007633963833,0.0007163127302,0.0006468542269,
-	0.0005582260783,0.0004528973659,0.0003351160558,0.0002081715793,7.689934137e-05,
-	-5.511580093e-05,-0.0001830094698,-0.0003034310066,-0.0004120188823,-0.0005061564734,
-	-0.0005824034452,-0.0006392905489,-0.0006746455911,-0.0006883337046,-0.0006795974332,
-	-0.0006497204886,-0.0005993242958,-0.0005310005508,-0.0004465189704,-0.0003495065612,
-	-0.0002425504645,-0.0001298960124,-1.452562174e-05,9.914566908e-05,0.0002082312567,
-	0.0003086469951,0.0003980262554,0.0004729987995,0.0005321134231,0.0005730364937,
-	0.0005954457447,0.0005982256262,0.0005823004176, 0.000547763193,0.0004967271234,
-	0.0004303593305,0.0003517109435,0.0002627876238, 0.000167281818,6.761770055e-05,
-	-3.225079854e-05,-0.0001298749849,-0.0002214384294,-0.0003048718791,-0.0003769158793,
-	-0.000436198432,-0.0004802983603,-0.0005087991594,-0.0005203060573,-0.000515457883,
-	-0.0004939427017,-0.0004574625636,-0.0004066656402,-0.0003441313165,-0.0002713077993,
-	-0.0001914221211,-0.0001063750169,-1.971392339e-05,6.653601304e-05,0.0001488976268,
-	0.0002255483851,0.0002934062795,0.0003512179246,0.0003965248761,0.0004288772761,
-	0.0004466790415,0.0004503988312,0.0004393663548,0.0004149414599,0.0003773564531,
-	0.0003288004664,0.0002702243801, 0.000204419237,0.0001328351063,5.861932004e-05,
-	-1.660605267e-05,-8.965199231e-05,-0.0001590001921,-0.0002217478032,-0.0002768015838,
-	-0.0003217352787,-0.0003560773039,-0.0003781432752,-0.0003882120363,-0.0003853910603,
-	-0.0003707870492,-0.0003442346351,-0.0003076214925,-0.0002614633995,-0.0002082027349,
-	-0.0001488509879,-8.619543951e-05,-2.150083128e-05,4.236628592e-05,0.0001041891519,
-	0.000161237971,0.0002125592873,0.0002558353008,0.0002906428126,0.0003152159625,
-	0.0003297466901, 0.000333159056,0.0003263416875,0.0003088656813,0.0002823049435,
-	0.0002468648017,0.0002046103618,0.0001562029793,0.0001041340583, 4.92648287e-05,
-	-5.751605386e-06,-6.002234659e-05,-0.0001110237426,-0.0001579768868,-0.0001986653369,
-	-0.0002326995746,-0.0002583400637,-0.0002757175534,-0.0002836204076,-0.0002827829157,
-	-0.0002725944505,-0.0002543539449,-0.0002279578912,-0.0001952274615,-0.0001565202983,
-	-0.0001139771848,-6.817420945e-05,-2.147783744e-05,2.543008486e-05,7.025207742e-05,
-	0.0001124064947,0.0001497582853,0.0001821142359,0.0002076626261,0.0002265485964,
-	0.0002375008771, 0.000241083646,0.0002365756081, 0.000225040756,0.0002061828272,
-	0.0001815371361,0.0001512067684,0.0001170971373,7.953176828e-05,4.057072874e-05,
-	6.588032306e-07,-3.80618294e-05, -7.5214768e-05,-0.0001088473509,-0.0001387845259,
-	-0.0001632908679,-0.0001825612999,-0.0001952907187,-0.0002019818494,-0.0002016827784,
-	-0.0001954425388,-0.0001826962689,-0.0001647954778,-0.0001416953892,-0.0001149147574,
-	-8.466254076e-05,-5.272405906e-05,-1.93752694e-05,1.346804675e-05,4.561813694e-05,
-	7.526027184e-05,0.0001023507575,0.0001252170478,0.0001440326596,0.0001574587659,
-	0.0001660462149,0.0001687759068, 0.000166478465,0.0001585146238,0.0001461531647,
-	0.0001290446235,0.0001085757976,8.466807049e-05,5.904918726e-05,3.166613169e-05,
-	4.199524938e-06,-2.306109309e-05,-4.868366523e-05,-7.254907541e-05,-9.31884133e-05,
-	-0.0001108886645,-0.0001242470898,-0.0001338118018,-0.0001384480856,-0.000139009062,
-	-0.0001347253274,-0.000126728497,-0.0001144710841,-9.923583275e-05,-8.070270269e-05,
-	-6.042403766e-05,-3.830931746e-05,-1.590672036e-05,6.971205494e-06,2.876153121e-05,
-	4.944565808e-05,6.758263771e-05,8.361571963e-05,9.631569992e-05,0.0001057661211,
-	0.0001114477709,0.0001138687076,  0.00011206005,0.0001073339372,9.867963672e-05,
-	8.756037278e-05,7.330832887e-05,5.746062379e-05,3.962936171e-05, 2.14276406e-05,
-	2.560194389e-06,-1.545555824e-05,-3.301476318e-05,-4.875980449e-05,-6.309697346e-05,
-	-7.464583905e-05,-8.374747267e-05,-8.926481678e-05,-9.200556815e-05,-9.14283446e-05,
-	-8.826978592e-05,-8.149476344e-05,-7.165852003e-05,-5.963993681e-05,-4.618465755e-05,
-	-2.938185935e-05,-1.297531526e-05,5.498939117e-06,2.334310375e-05,4.178751988e-05,
-	5.892304762e-05,7.569412264e-05,9.046854393e-05, 0.000104214254,0.0001155265345,
-	0.0001254969247,0.0001329622464,0.0001392007835,0.0001433132275,0.0001468122791,
-	0.0001490942668,0.0001519610669,0.0001551579917,0.0001608583989,0.0001692567166,
-	0.0001830419496,0.0002030453616,0.0002327283873,-0.0006470394437
-};
+SSEInterpolator::SSEInterpolator() :
+	m_alignedTaps(NULL),
+	m_fixedTaps(NULL),
+	m_fixedShift(15),
+	m_stages(0),
+	m_historyKeep(0),
+	m_historyRate(0),
+	m_nTaps(0),
+	m_phases(0),
+	m_mode(ModeLinear),
+	m_gain(1.0),
+	m_backend(SIMD::defaultBackend()),
+	m_fixedPoint(false),
+	m_step(FixedPointOne),
+	m_position(FixedPointOne),
+	m_schedulePos(0),
+	m_schedulePending(0),
+	m_decimation(1),
+	m_useFFT(false)
+{
+	selectKernels();
+}
 
-static const float H6_2[1024] = {
-  0.0006533244741,-0.000221319613,-0.0001956919587,-0.0001780518796,-0.000166907208,
-  -0.0001598120725, -0.00015593438,-0.0001533653412,-0.0001517392229,-0.0001495418983,
-  -0.0001467750844,-0.0001422400092,-0.0001362582843,-0.0001278973214,-0.0001177734594,
-  -0.0001051783402,-9.100017633e-05,-7.470243145e-05,-5.742540088e-05,-3.871733861e-05,
-  -1.99779297e-05,-6.44284512e-07,1.737913226e-05,3.549092435e-05,5.058135866e-05,
-  6.469034997e-05,7.630999607e-05,8.427410648e-05,8.933979552e-05,9.149379912e-05,
-  9.011748625e-05,8.518992399e-05,7.675729285e-05,6.553554704e-05,5.169146971e-05,
-  3.588888285e-05,1.824605533e-05,-4.003812251e-07,-1.969667755e-05,-3.859825301e-05,
-  -5.667935693e-05,-7.295644173e-05,-8.712775161e-05,-9.840977145e-05,-0.0001066220284,
-  -0.0001112334503,-0.0001121429304,-0.000109071414,-0.0001023189106,-9.137477173e-05,
-  -7.750718942e-05,-6.011653386e-05,-4.041224383e-05,-1.869154585e-05,3.896397175e-06,
-   2.72036541e-05,4.986948625e-05,7.148085569e-05, 9.07986323e-05,0.0001076530098,
-  0.0001209594047,0.0001305993501,0.0001356504799,0.0001362947514,0.0001319930598,
-   0.000123263264,0.0001098485081,9.253450844e-05,7.136611384e-05,4.742783494e-05,
-  2.112662878e-05,-6.361563464e-06,-3.428268974e-05,-6.157476309e-05,-8.745056402e-05,
-  -0.0001106594282,-0.0001308096398,-0.0001466558315,-0.0001578855299,-0.000163705743,
-  -0.0001641816634,-0.0001587582374,-0.0001478705672,-0.0001314601686,-0.0001103591712,
-  -8.479517419e-05,-5.589898865e-05,-2.425275125e-05,8.713623174e-06,4.224452641e-05,
-  7.483851368e-05,0.0001057243644,0.0001333932159,0.0001572131296,0.0001758317812,
-  0.0001889767154,0.0001956415654,0.0001958528155,   0.0001891672,0.0001758889848,
-   0.000156097376,0.0001306666381,0.0001000144621, 6.54186224e-05,2.773276901e-05,
-  -1.153147059e-05,-5.136369873e-05,-9.007506014e-05,-0.000126561732,-0.0001592383924,
-  -0.0001871972054,-0.0002090878552,-0.0002242954215,-0.0002318990446,-0.0002317632461,
-  -0.0002234898275,-0.0002074288204,-0.0001837396267,-0.0001533418836,-0.0001169079042,
-  -7.589778397e-05,-3.128426761e-05,1.509749836e-05,6.200891949e-05,0.0001075472537,
-  0.0001503550593,  0.00018862875,0.0002212674299,0.0002467222512,0.0002642443869,
-  0.0002728123509,0.0002722381905,0.0002620784217,0.0002427906147,0.0002146174957,
-  0.0001786396024,0.0001356623834,8.731701382e-05,3.491490133e-05,-1.952261482e-05,
-  -7.441899652e-05,-0.0001276357361,-0.0001775191195,-0.0002220712631,-0.0002598426945,
-  -0.0002892110206,-0.0003092336701,-0.0003187766997,-0.0003175900201,-0.000305269321,
-  -0.0002822762763,-0.0002489967155,-0.0002066353481,-0.0001562280668,-9.962421609e-05,
-  -3.844631647e-05,2.503087671e-05,8.889911987e-05,0.0001507024135,0.0002084988955,
-  0.0002599838772,0.0003035066766,0.0003371651401,0.0003598702606,0.0003703899274,
-  0.0003684267867,0.0003535459982,0.0003262991959,0.0002871621982,0.0002375180484,
-  0.0001787022338,0.0001127932701,4.172646368e-05,-3.188438131e-05,-0.0001057750487,
-  -0.0001771700772,-0.0002437666553,-0.0003029647633,-0.0003528074885,-0.0003911772801,
-  -0.0004167643492,-0.0004282665905,-0.0004252611252,-0.0004073840973,-0.000375208765,
-  -0.0003294111229,-0.0002715430164,-0.0002032109187,-0.0001267968764,-4.462248035e-05,
-  4.036597238e-05,0.0001254983363,0.0002075960947,0.0002839958761,0.0003517282312,
-   0.000408518943,0.0004520287621,0.0004807211517,0.0004931462463, 0.000488823629,
-  0.0004674193624,0.0004295943072,0.0003761917178,0.0003090012178,0.0002299140615,
-  0.0001416757295,4.699769488e-05,-5.075840818e-05,-0.0001484599488,-0.0002425171842,
-  -0.0003298068186,-0.0004070131981,-0.0004714880197,-0.0005206195638,-0.0005526161985,
-  -0.0005659392918,-0.0005599821452,-0.0005344689125,-0.0004901483771,-0.0004280700814,
-  -0.0003502802283,-0.0002590442309,-0.0001574596099,-4.871400233e-05,6.336652586e-05,
-  0.0001751338277,0.0002825494448,0.0003819916456, 0.000469727267,0.0005427011056,
-  0.0005979808629,0.0006335397484, 0.000647673558, 0.000639717211,0.0006094171549,
-  0.0005576469121,0.0004856817541,0.0003958726011,0.0002908611204,0.0001742126478,
-  4.962363164e-05,-7.857204037e-05,-0.0002061486884,-0.0003285298881,-0.0004415606381,
-  -0.000541017449,-0.0006234060274,-0.0006854541716,-0.000724840269,-0.0007396975416,
-  -0.0007292892551,-0.0006934241974,-0.0006330881151,-0.0005498370156,-0.0004463398946,
-  -0.0003257132194,-0.000192008054,-4.950522271e-05,9.687153943e-05,0.0002422563557,
-  0.0003814606171, 0.000509716745,0.0006222708034,0.0007151425234,0.0007846488152,
-  0.0008281750488,0.0008436654462,0.0008302895003,0.0007879169425,0.0007177050575,
-  0.0006214991445,0.0005023751874,0.0003639477654,0.0002108435292,4.799052113e-05,
-  -0.0001189859177,-0.0002845241688,-0.0004427319218,-0.000588161638,-0.0007154425257,
-  -0.0008200370939,-0.000897832273,-0.0009458573186,-0.0009618527838,-0.0009448878118,
-  -0.000894911529,-0.000813261373,-0.0007021488855,-0.0005650792154,-0.0004062532389,
-  -0.0002309584233,-4.487096157e-05,0.0001456206373,0.0003341191914,0.0005139550194,
-  0.0006788936444,0.0008228709921,0.0009407075704, 0.001027796301,  0.00108075852,
-   0.001097108703, 0.001075827749, 0.001016937662,0.0009219988133,0.0007936096517,
-  0.0006358045503,0.0004534473701, 0.000252583035,3.973897401e-05,-0.0001777916914,
-  -0.0003926782229,-0.0005973367952,-0.000784638105,-0.0009477250278,-0.001080678892,
-  -0.001178305247,-0.001236780314,-0.001253349707,-0.001226876047,-0.001157481456,
-  -0.001046975609,-0.0008984167362,-0.0007164353156,-0.0005066799349,-0.0002760549251,
-  -3.210186333e-05,0.0002168611536,0.0004624064604,0.0006958967424,0.0009091508109,
-   0.001094378531, 0.001244810876, 0.001354580279, 0.001419323613, 0.001435961691,
-	0.00140323001, 0.001321347663, 0.001192428754, 0.001020061085, 0.000809572055,
-  0.0005675142747,0.0003018296848,2.121001853e-05,-0.000264799397,-0.0005464939168,
-  -0.0008139692945,-0.001057825517,-0.001269142609,-0.001440159394,-0.001564186998,
-  -0.001636225497,-0.001652805251,-0.001612496679,-0.001515624812,-0.001364648924,
-  -0.001163776848,-0.0009191661375,-0.0006384353619,-0.0003307379957,-6.159056284e-06,
-  0.0003242931562,0.0006493833498,0.0009576940793, 0.001238348894,  0.00148107775,
-   0.001676887507, 0.001818093471, 0.001898915041, 0.001915388508, 0.001865857746,
-   0.001750756986, 0.001572947018, 0.001337352209, 0.001051131287, 0.000723164645,
-  0.0003640923824,-1.432535828e-05,-0.0003992868296,-0.0007776938728,-0.001136259874,
-  -0.001462293789,-0.001743831672,-0.001970364014,-0.002132932656,-0.002224753611,
-  -0.002241211012,-0.002180342562,-0.002042663516,-0.001831494388,-0.001552610542,
-  -0.001214370481,-0.0008272150881,-0.0004036081664,4.261167487e-05,0.0004964151303,
-  0.0009423359879, 0.001364737516, 0.001748596551, 0.002079786267, 0.002345816931,
-   0.002536063083, 0.002642396605, 0.002659301274,  0.00258433423, 0.002418038202,
-   0.002164234407, 0.001829717774, 0.001424328075,0.0009604434599,0.0004528390127,
-  -8.198399883e-05,-0.0006261095405,-0.001161006046,-0.001667921897,-0.002128749387,
-  -0.002526436001, -0.00284580607,-0.003073916538,-0.003200752195,-0.003219432198,
-  -0.003126726253,  -0.0029230488,-0.002612732351,-0.002203778829,   -0.001707869,
-	-0.0011398684,-0.0005175797851,0.0001389551908,0.0008079296094, 0.001466618036,
-   0.002091962146, 0.002661512699, 0.003154047299, 0.003550482914, 0.003834423143,
-	0.00399293378, 0.004016935825, 0.003901760094, 0.003647286445, 0.003258222248,
-   0.002743932884, 0.002118406817, 0.001399777364,0.0006099700113,-0.0002260557376,
-  -0.001080919057,-0.001925802906,-0.002731237561,-0.003468209878,-0.004109003115,
-  -0.004628315102,-0.005004035309,-0.005218228325, -0.00525774667,-0.005114943255,
-  -0.004787996877,-0.004281303845,-0.003605421633,-0.002777065383,-0.001818656921,
-  -0.0007579178782, 0.000372950366, 0.001538052689, 0.002698930213, 0.003815614851,
-   0.004847967066,  0.00575686479, 0.006505611818, 0.007061123382, 0.007395226043,
-   0.007485688198,  0.00731726503,  0.00688241329, 0.006181954872, 0.005225355737,
-   0.004030928481, 0.002625591587, 0.001044563251,-0.0006693892065,-0.002466775477,
-  -0.004292579368,-0.006087513641,-0.007789590862,-0.009335664101, -0.01066321414,
-	-0.0117120035, -0.01242589671,  -0.0127544608, -0.01265460066, -0.01209191233,
-   -0.01104196534,-0.009491228499,-0.007437863387,-0.004892087076,-0.001876358525,
-   0.001574867289, 0.005415597931, 0.009589159861,  0.01402927935,  0.01866147853,
-	0.02340466529,  0.02817296982,  0.03287766129,  0.03742923588,  0.04173948988,
-	0.04572363198,  0.04930230603,  0.05240349472,  0.05496428534,  0.05693238974,
-	 0.0582674183,  0.05894188955,  0.05894188955,   0.0582674183,  0.05693238974,
-	0.05496428534,  0.05240349472,  0.04930230603,  0.04572363198,  0.04173948988,
-	0.03742923588,  0.03287766129,  0.02817296982,  0.02340466529,  0.01866147853,
-	0.01402927935, 0.009589159861, 0.005415597931, 0.001574867289,-0.001876358525,
-  -0.004892087076,-0.007437863387,-0.009491228499, -0.01104196534, -0.01209191233,
-   -0.01265460066,  -0.0127544608, -0.01242589671,  -0.0117120035, -0.01066321414,
-  -0.009335664101,-0.007789590862,-0.006087513641,-0.004292579368,-0.002466775477,
-  -0.0006693892065, 0.001044563251, 0.002625591587, 0.004030928481, 0.005225355737,
-   0.006181954872,  0.00688241329,  0.00731726503, 0.007485688198, 0.007395226043,
-   0.007061123382, 0.006505611818,  0.00575686479, 0.004847967066, 0.003815614851,
-   0.002698930213, 0.001538052689, 0.000372950366,-0.0007579178782,-0.001818656921,
-  -0.002777065383,-0.003605421633,-0.004281303845,-0.004787996877,-0.005114943255,
-   -0.00525774667,-0.005218228325,-0.005004035309,-0.004628315102,-0.004109003115,
-  -0.003468209878,-0.002731237561,-0.001925802906,-0.001080919057,-0.0002260557376,
-  0.0006099700113, 0.001399777364, 0.002118406817, 0.002743932884, 0.003258222248,
-   0.003647286445, 0.003901760094, 0.004016935825,  0.00399293378, 0.003834423143,
-   0.003550482914, 0.003154047299, 0.002661512699, 0.002091962146, 0.001466618036,
-  0.0008079296094,0.0001389551908,-0.0005175797851,  -0.0011398684,   -0.001707869,
-  -0.002203778829,-0.002612732351,  -0.0029230488,-0.003126726253,-0.003219432198,
-  -0.003200752195,-0.003073916538, -0.00284580607,-0.002526436001,-0.002128749387,
-  -0.001667921897,-0.001161006046,-0.0006261095405,-8.198399883e-05,0.0004528390127,
-  0.0009604434599, 0.001424328075, 0.001829717774, 0.002164234407, 0.002418038202,
-	0.00258433423, 0.002659301274, 0.002642396605, 0.002536063083, 0.002345816931,
-   0.002079786267, 0.001748596551, 0.001364737516,0.0009423359879,0.0004964151303,
-  4.261167487e-05,-0.0004036081664,-0.0008272150881,-0.001214370481,-0.001552610542,
-  -0.001831494388,-0.002042663516,-0.002180342562,-0.002241211012,-0.002224753611,
-  -0.002132932656,-0.001970364014,-0.001743831672,-0.001462293789,-0.001136259874,
-  -0.0007776938728,-0.0003992868296,-1.432535828e-05,0.0003640923824, 0.000723164645,
-   0.001051131287, 0.001337352209, 0.001572947018, 0.001750756986, 0.001865857746,
-   0.001915388508, 0.001898915041, 0.001818093471, 0.001676887507,  0.00148107775,
-   0.001238348894,0.0009576940793,0.0006493833498,0.0003242931562,-6.159056284e-06,
-  -0.0003307379957,-0.0006384353619,-0.0009191661375,-0.001163776848,-0.001364648924,
-  -0.001515624812,-0.001612496679,-0.001652805251,-0.001636225497,-0.001564186998,
-  -0.001440159394,-0.001269142609,-0.001057825517,-0.0008139692945,-0.0005464939168,
-  -0.000264799397,2.121001853e-05,0.0003018296848,0.0005675142747, 0.000809572055,
-   0.001020061085, 0.001192428754, 0.001321347663,  0.00140323001, 0.001435961691,
-   0.001419323613, 0.001354580279, 0.001244810876, 0.001094378531,0.0009091508109,
-  0.0006958967424,0.0004624064604,0.0002168611536,-3.210186333e-05,-0.0002760549251,
-  -0.0005066799349,-0.0007164353156,-0.0008984167362,-0.001046975609,-0.001157481456,
-  -0.001226876047,-0.001253349707,-0.001236780314,-0.001178305247,-0.001080678892,
-  -0.0009477250278,-0.000784638105,-0.0005973367952,-0.0003926782229,-0.0001777916914,
-  3.973897401e-05, 0.000252583035,0.0004534473701,0.0006358045503,0.0007936096517,
-  0.0009219988133, 0.001016937662, 0.001075827749, 0.001097108703,  0.00108075852,
-   0.001027796301,0.0009407075704,0.0008228709921,0.0006788936444,0.0005139550194,
-  0.0003341191914,0.0001456206373,-4.487096157e-05,-0.0002309584233,-0.0004062532389,
-  -0.0005650792154,-0.0007021488855,-0.000813261373,-0.000894911529,-0.0009448878118,
-  -0.0009618527838,-0.0009458573186,-0.000897832273,-0.0008200370939,-0.0007154425257,
-  -0.000588161638,-0.0004427319218,-0.0002845241688,-0.0001189859177,4.799052113e-05,
-  0.0002108435292,0.0003639477654,0.0005023751874,0.0006214991445,0.0007177050575,
-  0.0007879169425,0.0008302895003,0.0008436654462,0.0008281750488,0.0007846488152,
-  0.0007151425234,0.0006222708034, 0.000509716745,0.0003814606171,0.0002422563557,
-  9.687153943e-05,-4.950522271e-05,-0.000192008054,-0.0003257132194,-0.0004463398946,
-  -0.0005498370156,-0.0006330881151,-0.0006934241974,-0.0007292892551,-0.0007396975416,
-  -0.000724840269,-0.0006854541716,-0.0006234060274,-0.000541017449,-0.0004415606381,
-  -0.0003285298881,-0.0002061486884,-7.857204037e-05,4.962363164e-05,0.0001742126478,
-  0.0002908611204,0.0003958726011,0.0004856817541,0.0005576469121,0.0006094171549,
-   0.000639717211, 0.000647673558,0.0006335397484,0.0005979808629,0.0005427011056,
-   0.000469727267,0.0003819916456,0.0002825494448,0.0001751338277,6.336652586e-05,
-  -4.871400233e-05,-0.0001574596099,-0.0002590442309,-0.0003502802283,-0.0004280700814,
-  -0.0004901483771,-0.0005344689125,-0.0005599821452,-0.0005659392918,-0.0005526161985,
-  -0.0005206195638,-0.0004714880197,-0.0004070131981,-0.0003298068186,-0.0002425171842,
-  -0.0001484599488,-5.075840818e-05,4.699769488e-05,0.0001416757295,0.0002299140615,
-  0.0003090012178,0.0003761917178,0.0004295943072,0.0004674193624, 0.000488823629,
-  0.0004931462463,0.0004807211517,0.0004520287621, 0.000408518943,0.0003517282312,
-  0.0002839958761,0.0002075960947,0.0001254983363,4.036597238e-05,-4.462248035e-05,
-  -0.0001267968764,-0.0002032109187,-0.0002715430164,-0.0003294111229,-0.000375208765,
-  -0.0004073840973,-0.0004252611252,-0.0004282665905,-0.0004167643492,-0.0003911772801,
-  -0.0003528074885,-0.0003029647633,-0.0002437666553,-0.0001771700772,-0.0001057750487,
-  -3.188438131e-05,4.172646368e-05,0.0001127932701,0.0001787022338,0.0002375180484,
-  0.0002871621982,0.0003262991959,0.0003535459982,0.0003684267867,0.0003703899274,
-  0.0003598702606,0.0003371651401,0.0003035066766,0.0002599838772,0.0002084988955,
-  0.0001507024135,8.889911987e-05,2.503087671e-05,-3.844631647e-05,-9.962421609e-05,
-  -0.0001562280668,-0.0002066353481,-0.0002489967155,-0.0002822762763,-0.000305269321,
-  -0.0003175900201,-0.0003187766997,-0.0003092336701,-0.0002892110206,-0.0002598426945,
-  -0.0002220712631,-0.0001775191195,-0.0001276357361,-7.441899652e-05,-1.952261482e-05,
-  3.491490133e-05,8.731701382e-05,0.0001356623834,0.0001786396024,0.0002146174957,
-  0.0002427906147,0.0002620784217,0.0002722381905,0.0002728123509,0.0002642443869,
-  0.0002467222512,0.0002212674299,  0.00018862875,0.0001503550593,0.0001075472537,
-  6.200891949e-05,1.509749836e-05,-3.128426761e-05,-7.589778397e-05,-0.0001169079042,
-  -0.0001533418836,-0.0001837396267,-0.0002074288204,-0.0002234898275,-0.0002317632461,
-  -0.0002318990446,-0.0002242954215,-0.0002090878552,-0.0001871972054,-0.0001592383924,
-  -0.000126561732,-9.007506014e-05,-5.136369873e-05,-1.153147059e-05,2.773276901e-05,
-   6.54186224e-05,0.0001000144621,0.0001306666381, 0.000156097376,0.0001758889848,
-	 0.0001891672,0.0001958528155,0.0001956415654,0.0001889767154,0.0001758317812,
-  0.0001572131296,0.0001333932159,0.0001057243644,7.483851368e-05,4.224452641e-05,
-  8.713623174e-06,-2.425275125e-05,-5.589898865e-05,-8.479517419e-05,-0.0001103591712,
-  -0.0001314601686,-0.0001478705672,-0.0001587582374,-0.0001641816634,-0.000163705743,
-  -0.0001578855299,-0.0001466558315,-0.0001308096398,-0.0001106594282,-8.745056402e-05,
-  -6.157476309e-05,-3.428268974e-05,-6.361563464e-06,2.112662878e-05,4.742783494e-05,
-  7.136611384e-05,9.253450844e-05,0.0001098485081, 0.000123263264,0.0001319930598,
-  0.0001362947514,0.0001356504799,0.0001305993501,0.0001209594047,0.0001076530098,
-   9.07986323e-05,7.148085569e-05,4.986948625e-05, 2.72036541e-05,3.896397175e-06,
-  -1.869154585e-05,-4.041224383e-05,-6.011653386e-05,-7.750718942e-05,-9.137477173e-05,
-  -0.0001023189106,-0.000109071414,-0.0001121429304,-0.0001112334503,-0.0001066220284,
-  -9.840977145e-05,-8.712775161e-05,-7.295644173e-05,-5.667935693e-05,-3.859825301e-05,
-  -1.969667755e-05,-4.003812251e-07,1.824605533e-05,3.588888285e-05,5.169146971e-05,
-  6.553554704e-05,7.675729285e-05,8.518992399e-05,9.011748625e-05,9.149379912e-05,
-  8.933979552e-05,8.427410648e-05,7.630999607e-05,6.469034997e-05,5.058135866e-05,
-  3.549092435e-05,1.737913226e-05,-6.44284512e-07,-1.99779297e-05,-3.871733861e-05,
-  -5.742540088e-05,-7.470243145e-05,-9.100017633e-05,-0.0001051783402,-0.0001177734594,
-  -0.0001278973214,-0.0001362582843,-0.0001422400092,-0.0001467750844,-0.0001495418983,
-  -0.0001517392229,-0.0001533653412, -0.00015593438,-0.0001598120725,-0.000166907208,
-  -0.0001780518796,-0.0001956919587,-0.000221319613,0.0006533244741
-};
+SSEInterpolator::~SSEInterpolator()
+{
+	free();
+}
 
-static const float H6_25[1024] = {
-	0.001675398787,1.244919167e-05,-1.265082301e-05,1.300565418e-05,-1.352463551e-05,
-	1.419634464e-05,-1.502947089e-05,1.600952965e-05,-1.714171958e-05,1.841177254e-05,
-	-1.982545655e-05,2.136947114e-05,-2.304847294e-05,2.484868128e-05,-2.677652628e-05,
-	2.881977343e-05,-3.09836214e-05, 3.32506861e-05,-3.562416532e-05,3.808822294e-05,
-	-4.240580165e-05,4.274157618e-05,-4.553170947e-05,4.837318556e-05,-5.126984615e-05,
-	5.420807065e-05,-5.719270121e-05, 6.02079308e-05,-6.325255526e-05,6.631013093e-05,
-	-6.938075239e-05, 7.24503625e-05,-7.551804447e-05,7.856899902e-05,-8.160285506e-05,
-	8.460623212e-05,-8.757905016e-05,9.050505469e-05,-9.338054952e-05,9.618798504e-05,
-	-9.852655057e-05,0.0001018315452,-0.0001043349039,0.0001067502599,-0.000109073284,
-	0.0001112881364,-0.0001133894912,0.0001153610065,-0.0001171952754,0.0001188778042,
-	-0.0001204026557,0.0001217582249,-0.0001229386689,0.0001239336852,-0.0001247400069,
-	0.0001253501832,-0.0001257604599,0.0001259599812,-0.0001259443961,0.0001257057011,
-	-0.0001253986266,0.0001243988227,-0.000123527876,0.0001223958971,-0.0001210046685,
-	0.0001193550634,-0.0001174495192,0.0001152866025,-0.0001128628428,0.0001101773014,
-	-0.000107228756,0.0001040198113,-0.0001005490412,9.681947995e-05,-9.283127292e-05,
-	8.859050286e-05,-8.409898874e-05,7.936103793e-05,-7.437571912e-05,6.914768164e-05,
-	-6.360508996e-05,5.808253263e-05,-5.210601739e-05,4.593118865e-05,-3.955672219e-05,
-	3.298968659e-05,-2.623116234e-05,1.929072278e-05,-1.216943474e-05,4.879918833e-06,
-	2.574045084e-06,-1.01757978e-05,1.792035073e-05,-2.578920066e-05,3.377440589e-05,
-	-4.18547279e-05,5.002244143e-05,-5.825928019e-05,6.655752077e-05,-7.489666314e-05,
-	8.322500071e-05,-9.171511192e-05,0.0001000485936,-0.0001083849347,0.0001167061564,
-	-0.0001249815105,0.0001331956009,-0.000141323093, 0.000149355983,-0.0001572697802,
-	0.0001650549384,-0.0001726847549,0.0001801506733,-0.0001874269365,0.0001945040422,
-	-0.0002013543708,0.0002079675614,-0.0002143196762,0.0002204044285,-0.0002261989139,
-	0.0002317167236,-0.0002368100104,0.0002416853822,-0.0002461822296,0.0002503027208,
-	-0.0002540306305,0.0002573635429,-0.0002602827153,0.0002627865179,-0.0002648555965,
-	0.00026648739,-0.0002676609438,0.0002683743951,-0.0002686080406,0.0002683596103,
-	-0.0002676100703, 0.000266359566,-0.0002645945933,0.0002623172477,-0.0002595154219,
-	0.0002561763977,-0.000252372236,0.0002479519753,-0.0002430213499,0.0002375745535,
-	-0.0002315960883,0.0002250888938,-0.0002180481097,0.0002104866726,-0.0002024031273,
-	0.0001938105706,-0.0001847077365,0.0001751102973,-0.0001650201593,0.0001544533734,
-	-0.0001434120059,0.0001319127623,-0.0001199640246,0.0001075880718,-9.479581058e-05,
-	8.161525329e-05,-6.800150732e-05,5.409394362e-05,-3.981600821e-05,2.520510134e-05,
-	-1.028506449e-05,-4.915092177e-06,2.037503691e-05,-3.606475366e-05,5.196307393e-05,
-	-6.804041914e-05,8.427639114e-05,-0.0001006404491,0.0001171101612,-0.0001336551213,
-	0.0001502517698,-0.0001668679761,0.0001834754366,-0.0002000410022,0.0002165349433,
-	-0.0002329309791,0.0002491593477,-0.0002652762341,0.0002811705344,-0.0002968245535,
-	0.0003122160851,-0.0003273163456,0.0003420927969,-0.0003565092629,0.0003705328272,
-	-0.0003841303405,0.0003972716513,-0.0004099243088,0.0004220580158,-0.0004336431739,
-	0.0004446525709,-0.0004550589074,0.0004648313916,-0.0004739405122,0.0004823570198,
-	-0.0004900551867,0.0004970360314,-0.0005032079644,0.0005086101592,-0.000513207051,
-	0.0005169680808,-0.0005198743893,0.0005219044397,-0.0005230415263,0.0005232664407,
-	-0.00052256661,0.0005209276569,-0.0005183401518,0.0005147918127,-0.0005102771684,
-	0.0005047873128,-0.0004983198014,0.0004908660194,-0.0004824266944,0.0004729957436,
-	-0.0004625812289,0.0004511619336,-0.0004388011876,0.0004254416563,-0.000411113404,
-	0.0003958299931,-0.0003796103119,0.0003624612582,-0.0003443991591, 0.000325435627,
-	-0.000305593916,0.0002848923032,-0.0002633577969,0.0002410119341,-0.0002178871073,
-	0.0001940105576,-0.0001694187085, 0.000144137317,-0.0001182025153,9.164447692e-05,
-	-6.450683577e-05,3.683733667e-05,-8.639025509e-06,-2.000392669e-05,4.905962123e-05,
-	-7.849372196e-05,0.0001082541203,-0.0001382974879,0.0001685714669,-0.0001990316523,
-	0.0002296229213,-0.0002602963359,0.0002909950272,-0.0003216689511,0.0003522591142,
-	-0.000382713275,0.0004129711597,-0.0004429815745, 0.000472684158,-0.0005020283279,
-	0.0005309510161,-0.0005594087997,0.0005873060436,-0.0006146348896,0.0006413159426,
-	-0.0006672907621,0.0006924984045,-0.0007168901502,0.0007404108183,-0.0007630105247,
-	0.0007846321096,-0.000805224292,0.0008247321239,-0.0008431066526,0.0008602941525,
-	-0.0008762460784,0.0008909119642,-0.0009042511811,0.0009162198403,-0.0009267787682,
-	0.0009358827956,-0.0009434898384,0.0009495872655,-0.0009541081381,0.0009570348775,
-	-0.0009583430947,0.0009580006008,-0.0009559826576,0.0009522665059,-0.0009468347416,
-	0.000939669495,-0.000930755632,0.0009200809291,-0.0009076363058,0.0008934149519,
-	-0.0008774123853,0.0008596275584,-0.0008400639053,0.0008187279454,-0.0007956314366,
-	0.0007707855548,-0.000744209392,0.0007159006782,-0.0006859155837,0.0006542616757,
-	-0.0006209632847,0.0005860535894,-0.0005495700752,0.0005115550011,-0.0004720490251,
-	0.0004310976947,-0.000388745073,0.0003450436052,-0.000300043961,0.0002538039116,
-	-0.0002063783904,0.0001578318333,-0.0001082299277,5.764549496e-05,-6.147113709e-06,
-	-4.61919044e-05,9.929939552e-05,-0.0001530790469,0.0002074777731,-0.0002623936161,
-	0.0003177424951,-0.0003734381462,0.0004293952079,-0.000485517201,0.0005417126813,
-	-0.0005978828412,0.0006539367605,-0.0007097731577,0.0007652982022,-0.0008204086334,
-	0.0008750099805,-0.0009289979935, 0.000982274767,-0.001034732792, 0.001086270786,
-	-0.001136782812, 0.001186170382,-0.001234338968, 0.001281164819,-0.001326559111,
-	0.001370426849,-0.001412661979,  0.00145316706,-0.001491837436, 0.001528581604,
-	-0.001563300495, 0.001595907845,-0.001626307727, 0.001654417254,-0.001680145622,
-	0.001703415997,-0.001724141766, 0.001742246561,-0.001757647842,  0.00177027809,
-	-0.001780065242, 0.001786946901,-0.001790847979, 0.001791731687,-0.001789523521,
-	0.001784177497,-0.001775646349, 0.001763892709,-0.001748870476, 0.001730548451,
-	-0.001708891825,  0.00168388267,-0.001655496424, 0.001623724122,-0.001588551444,
-	0.001549980603,-0.001508008805, 0.001462645829,-0.001413896796,  0.00136177917,
-	-0.001306312159, 0.001247529523,-0.001185466303, 0.001120146248, -0.00105162512,
-	0.0009799567051,-0.0009051907109,0.0008273900603,-0.0007466165698,0.0006629467243,
-	-0.0005764554953,0.0004872324644,-0.000395363284,0.0003009481588,-0.0002040847467,
-	0.0001048851045,-3.457247885e-06,-0.0001000804914,0.0002056103549,-0.0003130009864,
-	0.0004221207346,-0.0005328319385,0.0006449971115,-0.0007584549021,0.0008730689879,
-	-0.0009886781918, 0.001105119009,-0.001222223975, 0.001339829294,-0.001457760809,
-	0.001575843664,-0.001693892176, 0.001811723225,-0.001929145423,  0.00204596878,
-	-0.002161994576, 0.002277025254,-0.002390859881, 0.002503298922,-0.002614138881,
-	0.002723171143,-0.002830180805, 0.002934955759,-0.003037294373, 0.003136968473,
-	-0.003233762458, 0.003327460494,-0.003417844186, 0.003504694439,-0.003587789834,
-	0.003666908713,-0.003741826164, 0.003812319832,-0.003878164105,    0.003939135,
-	-0.003995005973,  0.00404555304,-0.004090553615, 0.004129783716,-0.004163017962,
-	0.004190030508,-0.004210601095,  0.00422450155,-0.004231502302, 0.004231387749,
-	-0.004223929718, 0.004208895378,-0.004186059814, 0.004155195784,-0.004116076976,
-	0.004068469629,-0.004012137651, 0.003946842626,-0.003872344038, 0.003788395552,
-	-0.003694747109, 0.003591140499,-0.003477316583, 0.003353006672,-0.003217937192,
-	0.003071813611,-0.002914332552, 0.002745178295,-0.002564030001, 0.002370523522,
-	-0.002164293546, 0.001944943331,-0.001712052734, 0.001465164591,-0.001203790656,
-	0.0009273947799,-0.0006353971548,0.0003271588648,-1.982700496e-06,-0.0003409059136,
-	0.0007023601793,-0.001083333394, 0.001484882436,-0.001908200327, 0.002354623983,
-	-0.002825672273, 0.003323056735, -0.00384874735, 0.004404985346,-0.004994348623,
-	0.00561982207,-0.006284879986, 0.006993566174,-0.007750639226, 0.008561717346,
-	-0.009433500469,   0.0103740124, -0.01139295939,  0.01250217296, -0.01371623017,
-	0.01505327411, -0.01653618366,  0.01819418557, -0.02006522752,  0.02219945751,
-	-0.02466454171,  0.02755400166, -0.03100080974,  0.03520061448, -0.04045354202,
-	0.04724452645, -0.05641134083,  0.06953664869, -0.09001214802,   0.1266565621,
-	-0.2118059248,   0.6364861727,   0.6364861727,  -0.2118059248,   0.1266565621,
-	-0.09001214802,  0.06953664869, -0.05641134083,  0.04724452645, -0.04045354202,
-	0.03520061448, -0.03100080974,  0.02755400166, -0.02466454171,  0.02219945751,
-	-0.02006522752,  0.01819418557, -0.01653618366,  0.01505327411, -0.01371623017,
-	0.01250217296, -0.01139295939,   0.0103740124,-0.009433500469, 0.008561717346,
-	-0.007750639226, 0.006993566174,-0.006284879986,  0.00561982207,-0.004994348623,
-	0.004404985346, -0.00384874735, 0.003323056735,-0.002825672273, 0.002354623983,
-	-0.001908200327, 0.001484882436,-0.001083333394,0.0007023601793,-0.0003409059136,
-	-1.982700496e-06,0.0003271588648,-0.0006353971548,0.0009273947799,-0.001203790656,
-	0.001465164591,-0.001712052734, 0.001944943331,-0.002164293546, 0.002370523522,
-	-0.002564030001, 0.002745178295,-0.002914332552, 0.003071813611,-0.003217937192,
-	0.003353006672,-0.003477316583, 0.003591140499,-0.003694747109, 0.003788395552,
-	-0.003872344038, 0.003946842626,-0.004012137651, 0.004068469629,-0.004116076976,
-	0.004155195784,-0.004186059814, 0.004208895378,-0.004223929718, 0.004231387749,
-	-0.004231502302,  0.00422450155,-0.004210601095, 0.004190030508,-0.004163017962,
-	0.004129783716,-0.004090553615,  0.00404555304,-0.003995005973,    0.003939135,
-	-0.003878164105, 0.003812319832,-0.003741826164, 0.003666908713,-0.003587789834,
-	0.003504694439,-0.003417844186, 0.003327460494,-0.003233762458, 0.003136968473,
-	-0.003037294373, 0.002934955759,-0.002830180805, 0.002723171143,-0.002614138881,
-	0.002503298922,-0.002390859881, 0.002277025254,-0.002161994576,  0.00204596878,
-	-0.001929145423, 0.001811723225,-0.001693892176, 0.001575843664,-0.001457760809,
-	0.001339829294,-0.001222223975, 0.001105119009,-0.0009886781918,0.0008730689879,
-	-0.0007584549021,0.0006449971115,-0.0005328319385,0.0004221207346,-0.0003130009864,
-	0.0002056103549,-0.0001000804914,-3.457247885e-06,0.0001048851045,-0.0002040847467,
-	0.0003009481588,-0.000395363284,0.0004872324644,-0.0005764554953,0.0006629467243,
-	-0.0007466165698,0.0008273900603,-0.0009051907109,0.0009799567051, -0.00105162512,
-	0.001120146248,-0.001185466303, 0.001247529523,-0.001306312159,  0.00136177917,
-	-0.001413896796, 0.001462645829,-0.001508008805, 0.001549980603,-0.001588551444,
-	0.001623724122,-0.001655496424,  0.00168388267,-0.001708891825, 0.001730548451,
-	-0.001748870476, 0.001763892709,-0.001775646349, 0.001784177497,-0.001789523521,
-	0.001791731687,-0.001790847979, 0.001786946901,-0.001780065242,  0.00177027809,
-	-0.001757647842, 0.001742246561,-0.001724141766, 0.001703415997,-0.001680145622,
-	0.001654417254,-0.001626307727, 0.001595907845,-0.001563300495, 0.001528581604,
-	-0.001491837436,  0.00145316706,-0.001412661979, 0.001370426849,-0.001326559111,
-	0.001281164819,-0.001234338968, 0.001186170382,-0.001136782812, 0.001086270786,
-	-0.001034732792, 0.000982274767,-0.0009289979935,0.0008750099805,-0.0008204086334,
-	0.0007652982022,-0.0007097731577,0.0006539367605,-0.0005978828412,0.0005417126813,
-	-0.000485517201,0.0004293952079,-0.0003734381462,0.0003177424951,-0.0002623936161,
-	0.0002074777731,-0.0001530790469,9.929939552e-05,-4.61919044e-05,-6.147113709e-06,
-	5.764549496e-05,-0.0001082299277,0.0001578318333,-0.0002063783904,0.0002538039116,
-	-0.000300043961,0.0003450436052,-0.000388745073,0.0004310976947,-0.0004720490251,
-	0.0005115550011,-0.0005495700752,0.0005860535894,-0.0006209632847,0.0006542616757,
-	-0.0006859155837,0.0007159006782,-0.000744209392,0.0007707855548,-0.0007956314366,
-	0.0008187279454,-0.0008400639053,0.0008596275584,-0.0008774123853,0.0008934149519,
-	-0.0009076363058,0.0009200809291,-0.000930755632, 0.000939669495,-0.0009468347416,
-	0.0009522665059,-0.0009559826576,0.0009580006008,-0.0009583430947,0.0009570348775,
-	-0.0009541081381,0.0009495872655,-0.0009434898384,0.0009358827956,-0.0009267787682,
-	0.0009162198403,-0.0009042511811,0.0008909119642,-0.0008762460784,0.0008602941525,
-	-0.0008431066526,0.0008247321239,-0.000805224292,0.0007846321096,-0.0007630105247,
-	0.0007404108183,-0.0007168901502,0.0006924984045,-0.0006672907621,0.0006413159426,
-	-0.0006146348896,0.0005873060436,-0.0005594087997,0.0005309510161,-0.0005020283279,
-	0.000472684158,-0.0004429815745,0.0004129711597,-0.000382713275,0.0003522591142,
-	-0.0003216689511,0.0002909950272,-0.0002602963359,0.0002296229213,-0.0001990316523,
-	0.0001685714669,-0.0001382974879,0.0001082541203,-7.849372196e-05,4.905962123e-05,
-	-2.000392669e-05,-8.639025509e-06,3.683733667e-05,-6.450683577e-05,9.164447692e-05,
-	-0.0001182025153, 0.000144137317,-0.0001694187085,0.0001940105576,-0.0002178871073,
-	0.0002410119341,-0.0002633577969,0.0002848923032,-0.000305593916, 0.000325435627,
-	-0.0003443991591,0.0003624612582,-0.0003796103119,0.0003958299931,-0.000411113404,
-	0.0004254416563,-0.0004388011876,0.0004511619336,-0.0004625812289,0.0004729957436,
-	-0.0004824266944,0.0004908660194,-0.0004983198014,0.0005047873128,-0.0005102771684,
-	0.0005147918127,-0.0005183401518,0.0005209276569, -0.00052256661,0.0005232664407,
-	-0.0005230415263,0.0005219044397,-0.0005198743893,0.0005169680808,-0.000513207051,
-	0.0005086101592,-0.0005032079644,0.0004970360314,-0.0004900551867,0.0004823570198,
-	-0.0004739405122,0.0004648313916,-0.0004550589074,0.0004446525709,-0.0004336431739,
-	0.0004220580158,-0.0004099243088,0.0003972716513,-0.0003841303405,0.0003705328272,
-	-0.0003565092629,0.0003420927969,-0.0003273163456,0.0003122160851,-0.0002968245535,
-	0.0002811705344,-0.0002652762341,0.0002491593477,-0.0002329309791,0.0002165349433,
-	-0.0002000410022,0.0001834754366,-0.0001668679761,0.0001502517698,-0.0001336551213,
-	0.0001171101612,-0.0001006404491,8.427639114e-05,-6.804041914e-05,5.196307393e-05,
-	-3.606475366e-05,2.037503691e-05,-4.915092177e-06,-1.028506449e-05,2.520510134e-05,
-	-3.981600821e-05,5.409394362e-05,-6.800150732e-05,8.161525329e-05,-9.479581058e-05,
-	0.0001075880718,-0.0001199640246,0.0001319127623,-0.0001434120059,0.0001544533734,
-	-0.0001650201593,0.0001751102973,-0.0001847077365,0.0001938105706,-0.0002024031273,
-	0.0002104866726,-0.0002180481097,0.0002250888938,-0.0002315960883,0.0002375745535,
-	-0.0002430213499,0.0002479519753,-0.000252372236,0.0002561763977,-0.0002595154219,
-	0.0002623172477,-0.0002645945933, 0.000266359566,-0.0002676100703,0.0002683596103,
-	-0.0002686080406,0.0002683743951,-0.0002676609438,  0.00026648739,-0.0002648555965,
-	0.0002627865179,-0.0002602827153,0.0002573635429,-0.0002540306305,0.0002503027208,
-	-0.0002461822296,0.0002416853822,-0.0002368100104,0.0002317167236,-0.0002261989139,
-	0.0002204044285,-0.0002143196762,0.0002079675614,-0.0002013543708,0.0001945040422,
-	-0.0001874269365,0.0001801506733,-0.0001726847549,0.0001650549384,-0.0001572697802,
-	0.000149355983,-0.000141323093,0.0001331956009,-0.0001249815105,0.0001167061564,
-	-0.0001083849347,0.0001000485936,-9.171511192e-05,8.322500071e-05,-7.489666314e-05,
-	6.655752077e-05,-5.825928019e-05,5.002244143e-05,-4.18547279e-05,3.377440589e-05,
-	-2.578920066e-05,1.792035073e-05,-1.01757978e-05,2.574045084e-06,4.879918833e-06,
-	-1.216943474e-05,1.929072278e-05,-2.623116234e-05,3.298968659e-05,-3.955672219e-05,
-	4.593118865e-05,-5.210601739e-05,5.808253263e-05,-6.360508996e-05,6.914768164e-05,
-	-7.437571912e-05,7.936103793e-05,-8.409898874e-05,8.859050286e-05,-9.283127292e-05,
-	9.681947995e-05,-0.0001005490412,0.0001040198113,-0.000107228756,0.0001101773014,
-	-0.0001128628428,0.0001152866025,-0.0001174495192,0.0001193550634,-0.0001210046685,
-	0.0001223958971,-0.000123527876,0.0001243988227,-0.0001253986266,0.0001257057011,
-	-0.0001259443961,0.0001259599812,-0.0001257604599,0.0001253501832,-0.0001247400069,
-	0.0001239336852,-0.0001229386689,0.0001217582249,-0.0001204026557,0.0001188778042,
-	-0.0001171952754,0.0001153610065,-0.0001133894912,0.0001112881364,-0.000109073284,
-	0.0001067502599,-0.0001043349039,0.0001018315452,-9.852655057e-05,9.618798504e-05,
-	-9.338054952e-05,9.050505469e-05,-8.757905016e-05,8.460623212e-05,-8.160285506e-05,
-	7.856899902e-05,-7.551804447e-05, 7.24503625e-05,-6.938075239e-05,6.631013093e-05,
-	-6.325255526e-05, 6.02079308e-05,-5.719270121e-05,5.420807065e-05,-5.126984615e-05,
-	4.837318556e-05,-4.553170947e-05,4.274157618e-05,-4.240580165e-05,3.808822294e-05,
-	-3.562416532e-05, 3.32506861e-05,-3.09836214e-05,2.881977343e-05,-2.677652628e-05,
-	2.484868128e-05,-2.304847294e-05,2.136947114e-05,-1.982545655e-05,1.841177254e-05,
-	-1.714171958e-05,1.600952965e-05,-1.502947089e-05,1.419634464e-05,-1.352463551e-05,
-	1.300565418e-05,-1.265082301e-05,1.244919167e-05, 0.001675398787
-};
+void SSEInterpolator::create(double inputRate, double outputRate, int phases, int tapsPerPhase, double gain)
+{
+	double minRate;
 
-static const float H7[1024] = {
-	0.0006753480993,-0.0001766396599,-0.0001636194938,-0.0001561122335,-0.0001535189658,
-	-0.0001534203475,-0.0001555135968,-0.0001576548093,-0.000159837582,-0.0001602044795,
-	-0.0001590757311,-0.0001549085137,-0.0001483907545,-0.0001383075578,-0.0001257383119,
-	-0.000109776076,-9.18841688e-05,-7.138950605e-05,-5.011309622e-05,-2.745849997e-05,
-	-5.622492608e-06,1.630631959e-05,  3.5380388e-05,5.339910422e-05,6.769165338e-05,
-	7.7890596e-05,8.489783067e-05,8.766703831e-05,8.557629189e-05,7.919352356e-05,
-	6.868619676e-05,5.500539191e-05,3.818924961e-05,1.935775799e-05,-1.228938459e-06,
-	-2.208811566e-05, -4.2761847e-05,-6.167274114e-05,-7.846559311e-05,-9.174700972e-05,
-	-0.0001014417867,-0.0001064698445,-0.0001071029837,-0.0001026394602,-9.377201059e-05,
-	-8.008477016e-05,-6.301960821e-05,-4.201701813e-05,-1.92799962e-05,5.263148068e-06,
-	2.995152499e-05,5.415603664e-05,7.605139399e-05,9.539166058e-05, 0.000110633111,
-	0.0001215969023,0.0001269718778, 0.000127052801,0.0001211143681,0.0001099643705,
-	9.333080379e-05,7.244184235e-05,4.748764331e-05,2.012458935e-05,-9.06387686e-06,
-	-3.819964695e-05,-6.653421588e-05,-9.227250848e-05,-0.0001146859649,-0.0001322491298,
-	-0.0001446030219,-0.000150359876,-0.0001499700884,-0.0001424568036,-0.0001286966872,
-	-0.000108570006,-8.352214354e-05,-5.38293134e-05,-2.140434481e-05,1.298802999e-05,
-	4.717833508e-05,8.033487393e-05,0.0001103130271,0.0001363524934,0.0001565215935,
-	0.000170446845,0.0001767261856, 0.000175590525,0.0001662694849,0.0001496513578,
-	0.0001256743853,9.585958469e-05,6.089081944e-05,2.270653022e-05,-1.750986121e-05,
-	-5.748667536e-05,-9.606408275e-05,-0.0001308277861,-0.0001607574377,-0.0001838561293,
-	-0.0001995226194,-0.0002062776475,-0.0002042554988,-0.0001928026759,-0.0001728256757,
-	-0.0001444303198,-0.0001093075407,-6.831472274e-05,-2.37569202e-05, 2.30489095e-05,
-	6.94736591e-05,0.0001140287495, 0.000154062669,0.0001883187797,0.0002145235485,
-	0.0002319892083,0.0002391767775,0.0002360901271,0.0002221815375,0.0001983387192,
-	0.0001649116748,0.0001237712277,7.606208965e-05,2.428373409e-05,-2.983134982e-05,
-	-8.338673069e-05,-0.0001345068449,-0.0001803617342,-0.0002192875545,-0.0002489091712,
-	-0.0002682358027,-0.0002757357433,-0.0002713303838,-0.0002545053139,-0.0002262479393,
-	-0.0001871432614,-0.0001392125268,-8.393564349e-05,-2.415283598e-05,3.808347174e-05,
-	9.950411186e-05,0.0001578496303,0.0002100104175,0.0002539838315,0.0002872149344,
-	0.0003084905329,0.0003161740897,0.0003101069888,0.0002898929233,0.0002566173498,
-	0.0002110871428,0.0001555361669,9.185375529e-05,2.314807898e-05,-4.802506373e-05,
-	-0.0001181328698,-0.000184415534,-0.0002434603957,-0.0002928868926,-0.0003299663658,
-	-0.0003531752445,-0.0003608720435,-0.0003528055386,-0.0003286703432,-0.0002896731021,
-	-0.0002368906571,-0.0001728102507,-9.973852866e-05,-2.113747541e-05,5.995681931e-05,
-	0.0001395955333,0.0002145654289,0.0002811004815,0.0003364373697,0.0003775489749,
-	0.0004027112445,0.0004101899103,0.0003996959422,0.0003710372548,0.0003255295742,
-	0.0002645758213,0.0001909656858,0.0001074319225,1.784519372e-05,-7.419309259e-05,
-	-0.0001643329015,-0.000248812401,-0.0003234760079,-0.0003851446963,-0.0004305247858,
-	-0.0004576276406,-0.0004646507732,-0.0004512367886,-0.0004173427296,-0.0003644441604,
-	-0.0002942827123,-0.0002099844569,-0.0001147879375,-1.305232854e-05,9.109110397e-05,
-	0.0001927571866,0.0002876524813,0.0003711401368,0.0004396078875,0.0004894657177,
-	0.0005184855545,0.0005247305962,0.0005078449612,0.0004679266422,0.0004066385445,
-	0.0003261092643,0.0002298686304,0.0001216918245,6.481431683e-06,-0.0001110122175,
-	-0.0002253402781,-0.0003316011571,-0.0004246754397,-0.0005004582345,-0.0005550417118,
-	-0.0005858947407,-0.0005910241744,-0.0005700305919, -0.00052318495,-0.0004523942189,
-	-0.0003602067009,-0.0002506178571,-0.0001279993157,2.161992143e-06,0.0001344203338,
-	0.0002626678324,0.0003813785734,0.0004848691169,0.0005685173091,0.0006280593225,
-	0.0006606741226, 0.000664264604,0.0006384354201,0.0005836441997,0.0005020923563,
-	0.0003967876255,0.0002722581557,0.0001335317793,-1.322393473e-05,-0.0001618007664,
-	-0.0003054090193,-0.0004377707082,-0.0005526088062,-0.0006447282503,-0.0007094849134,
-	-0.0007437446038,-0.0007453201688,-0.0007138058427,-0.0006499149604,-0.0005561694852,
-	-0.0004360846942,-0.000294791942,-0.0001380677131,2.716558447e-05,0.0001938547939,
-	0.0003544240899,0.0005018022493, 0.000629034359,0.0007303151069,0.0008005604614,
-	0.0008363245288,0.0008352997247,0.0007971369196,0.0007227871101,0.0006151658017,
-	0.0004783775657,0.0003182335349, 0.000141331082,-4.454487498e-05,-0.0002314099838,
-	-0.0004107971035,-0.0005747518153,-0.000715587521,-0.0008268149686,-0.0009028634522,
-	-0.0009399558767,-0.0009356774972,-0.0008897248772,-0.0008033463382,-0.0006799034891,
-	-0.0005241692415,-0.0003427306074,-0.0001431158453,6.592411228e-05,0.0002753646113,
-	0.0004757362476,0.0006581229973,0.0008139726706,0.0009360703407, 0.001018302049,
-	0.001056533889, 0.001048217644,0.0009931476088,0.0008928920142,0.0007513554883,
-	0.0005740460474,0.0003684388939,0.0001431141282,-9.206212417e-05,-0.0003269184963,
-	-0.0005508439499,-0.0007538350765,-0.0009263784741,-0.001060443581,-0.001149312826,
-	-0.001188452938,-0.001175186946,-0.001109412173,-0.0009930917295,-0.0008307382232,
-	-0.0006287088036,-0.0003955058928,-0.000140887918,0.0001240160636,0.0003877095587,
-	0.0006382855354,0.0008645160706,  0.00105578755, 0.001203164109, 0.001299226191,
-	0.001339008333, 0.001319692819, 0.001241317019, 0.001106269774,0.0009197912877,
-	0.0006892068195,0.0004242100986,0.0001358992886,-0.000163126635,-0.0004598673258,
-	-0.0007409199607,-0.0009936513379,-0.001206198242,-0.001368568046,-0.001472551259,
-	-0.001512691495,-0.001486001071,-0.001392685343,-0.001235650969,-0.001020960975,
-	-0.0007570704911,-0.0004550444428,-0.0001275479735,0.0002111151698,0.0005461950786,
-	0.0008625655901, 0.001145951683, 0.001383026363, 0.001562579651, 0.001675480395,
-	0.001715689665, 0.001680014888, 0.001568868756, 0.001385745127,  0.00113768992,
-	0.0008344663074,0.0004887514515,0.0001150550888,-0.0002703253413,-0.0006505797501,
-	-0.001008534571,-0.001327983802,-0.001593869063,-0.001793520176,-0.001916709472,
-	-0.001956694992,-0.001910041785,-0.001777382684,-0.001562906196,-0.001274794224,
-	-0.0009243851528,-0.0005262629711,-9.71351983e-05,0.0003443280293,0.0007788250223,
-	0.001186738256,  0.00154952053, 0.001850018511, 0.002073781565,  0.00220922567,
-	0.002248736797, 0.002188560087, 0.002029556548, 0.001776729012, 0.001439618994,
-	0.001031441381,0.0005690866383,7.193647616e-05,-0.0004384382046,-0.0009396905079,
-	-0.001409181277, -0.00182546617,-0.002168773208,-0.002422411693, -0.00257308688,
-	-0.002612035023,-0.002535034204,-0.002343164291,-0.002042390872,-0.001643876312,
-	-0.001163135981,-0.0006198991323,-3.687892604e-05, 0.000560720393, 0.001146711409,
-	0.001694619656, 0.002179277362, 0.002577532781, 0.002869768301, 0.003040396143,
-	0.003079077695, 0.002980870195,  0.00274700392, 0.002384543186, 0.001906631514,
-	0.001331641572,0.0006829124177,-1.259071269e-05,-0.0007249504561,-0.001422959263,
-	-0.00207505445,-0.002651111456,-0.003123391652, -0.00346823805,-0.003666817211,
-	-0.003706473159,-0.003581048688,-0.003291724017,-0.002846767893,-0.002261751564,
-	-0.001558694057,-0.0007656370872,8.479361713e-05,0.0009563049534, 0.001810802496,
-	0.0026096371, 0.003315655515, 0.003894497408, 0.004316540901, 0.004557994194,
-	0.004602459725, 0.004441524856, 0.004075734876, 0.003514502198, 0.002776325215,
-	0.001887932885,0.0008837420028,-0.0001957293571,-0.001305073616,-0.002396127675,
-	-0.003419630928,-0.004327651579, -0.00507536903,-0.005623452831,-0.005939641502,
-	-0.006000697613,-0.005793445744,-0.005316036288,-0.004578166641,-0.003601416713,
-	-0.002418521792,-0.001072737505,0.0003838423581, 0.001891838969, 0.003387042088,
-	0.004802630283, 0.006072117016, 0.007131889928, 0.007924234495, 0.008399768732,
-	0.008520123549, 0.008259819821, 0.007608197629, 0.006570382044, 0.005168124568,
-	0.00343960803, 0.001439048094,-0.000764760538,-0.003090082202,-0.005444822833,
-	-0.007729222067,-0.009839300066, -0.01167021878, -0.01312015019, -0.01409384236,
-	-0.01450641267, -0.01428656746, -0.01337976661, -0.01175062358,-0.009384988807,
-	-0.006291099824,-0.002500254661, 0.001933503547, 0.006934268866,  0.01240610238,
-	0.01823537238,  0.02429392003,  0.03044259548,  0.03653535619,  0.04242353886,
-	0.04796039686,   0.0530055277,  0.05742923915,  0.06111655757,  0.06397084892,
-	0.06591679901,   0.0669028759,   0.0669028759,  0.06591679901,  0.06397084892,
-	0.06111655757,  0.05742923915,   0.0530055277,  0.04796039686,  0.04242353886,
-	0.03653535619,  0.03044259548,  0.02429392003,  0.01823537238,  0.01240610238,
-	0.006934268866, 0.001933503547,-0.002500254661,-0.006291099824,-0.009384988807,
-	-0.01175062358, -0.01337976661, -0.01428656746, -0.01450641267, -0.01409384236,
-	-0.01312015019, -0.01167021878,-0.009839300066,-0.007729222067,-0.005444822833,
-	-0.003090082202,-0.000764760538, 0.001439048094,  0.00343960803, 0.005168124568,
-	0.006570382044, 0.007608197629, 0.008259819821, 0.008520123549, 0.008399768732,
-	0.007924234495, 0.007131889928, 0.006072117016, 0.004802630283, 0.003387042088,
-	0.001891838969,0.0003838423581,-0.001072737505,-0.002418521792,-0.003601416713,
-	-0.004578166641,-0.005316036288,-0.005793445744,-0.006000697613,-0.005939641502,
-	-0.005623452831, -0.00507536903,-0.004327651579,-0.003419630928,-0.002396127675,
-	-0.001305073616,-0.0001957293571,0.0008837420028, 0.001887932885, 0.002776325215,
-	0.003514502198, 0.004075734876, 0.004441524856, 0.004602459725, 0.004557994194,
-	0.004316540901, 0.003894497408, 0.003315655515,   0.0026096371, 0.001810802496,
-	0.0009563049534,8.479361713e-05,-0.0007656370872,-0.001558694057,-0.002261751564,
-	-0.002846767893,-0.003291724017,-0.003581048688,-0.003706473159,-0.003666817211,
-	-0.00346823805,-0.003123391652,-0.002651111456, -0.00207505445,-0.001422959263,
-	-0.0007249504561,-1.259071269e-05,0.0006829124177, 0.001331641572, 0.001906631514,
-	0.002384543186,  0.00274700392, 0.002980870195, 0.003079077695, 0.003040396143,
-	0.002869768301, 0.002577532781, 0.002179277362, 0.001694619656, 0.001146711409,
-	0.000560720393,-3.687892604e-05,-0.0006198991323,-0.001163135981,-0.001643876312,
-	-0.002042390872,-0.002343164291,-0.002535034204,-0.002612035023, -0.00257308688,
-	-0.002422411693,-0.002168773208, -0.00182546617,-0.001409181277,-0.0009396905079,
-	-0.0004384382046,7.193647616e-05,0.0005690866383, 0.001031441381, 0.001439618994,
-	0.001776729012, 0.002029556548, 0.002188560087, 0.002248736797,  0.00220922567,
-	0.002073781565, 0.001850018511,  0.00154952053, 0.001186738256,0.0007788250223,
-	0.0003443280293,-9.71351983e-05,-0.0005262629711,-0.0009243851528,-0.001274794224,
-	-0.001562906196,-0.001777382684,-0.001910041785,-0.001956694992,-0.001916709472,
-	-0.001793520176,-0.001593869063,-0.001327983802,-0.001008534571,-0.0006505797501,
-	-0.0002703253413,0.0001150550888,0.0004887514515,0.0008344663074,  0.00113768992,
-	0.001385745127, 0.001568868756, 0.001680014888, 0.001715689665, 0.001675480395,
-	0.001562579651, 0.001383026363, 0.001145951683,0.0008625655901,0.0005461950786,
-	0.0002111151698,-0.0001275479735,-0.0004550444428,-0.0007570704911,-0.001020960975,
-	-0.001235650969,-0.001392685343,-0.001486001071,-0.001512691495,-0.001472551259,
-	-0.001368568046,-0.001206198242,-0.0009936513379,-0.0007409199607,-0.0004598673258,
-	-0.000163126635,0.0001358992886,0.0004242100986,0.0006892068195,0.0009197912877,
-	0.001106269774, 0.001241317019, 0.001319692819, 0.001339008333, 0.001299226191,
-	0.001203164109,  0.00105578755,0.0008645160706,0.0006382855354,0.0003877095587,
-	0.0001240160636,-0.000140887918,-0.0003955058928,-0.0006287088036,-0.0008307382232,
-	-0.0009930917295,-0.001109412173,-0.001175186946,-0.001188452938,-0.001149312826,
-	-0.001060443581,-0.0009263784741,-0.0007538350765,-0.0005508439499,-0.0003269184963,
-	-9.206212417e-05,0.0001431141282,0.0003684388939,0.0005740460474,0.0007513554883,
-	0.0008928920142,0.0009931476088, 0.001048217644, 0.001056533889, 0.001018302049,
-	0.0009360703407,0.0008139726706,0.0006581229973,0.0004757362476,0.0002753646113,
-	6.592411228e-05,-0.0001431158453,-0.0003427306074,-0.0005241692415,-0.0006799034891,
-	-0.0008033463382,-0.0008897248772,-0.0009356774972,-0.0009399558767,-0.0009028634522,
-	-0.0008268149686,-0.000715587521,-0.0005747518153,-0.0004107971035,-0.0002314099838,
-	-4.454487498e-05, 0.000141331082,0.0003182335349,0.0004783775657,0.0006151658017,
-	0.0007227871101,0.0007971369196,0.0008352997247,0.0008363245288,0.0008005604614,
-	0.0007303151069, 0.000629034359,0.0005018022493,0.0003544240899,0.0001938547939,
-	2.716558447e-05,-0.0001380677131,-0.000294791942,-0.0004360846942,-0.0005561694852,
-	-0.0006499149604,-0.0007138058427,-0.0007453201688,-0.0007437446038,-0.0007094849134,
-	-0.0006447282503,-0.0005526088062,-0.0004377707082,-0.0003054090193,-0.0001618007664,
-	-1.322393473e-05,0.0001335317793,0.0002722581557,0.0003967876255,0.0005020923563,
-	0.0005836441997,0.0006384354201, 0.000664264604,0.0006606741226,0.0006280593225,
-	0.0005685173091,0.0004848691169,0.0003813785734,0.0002626678324,0.0001344203338,
-	2.161992143e-06,-0.0001279993157,-0.0002506178571,-0.0003602067009,-0.0004523942189,
-	-0.00052318495,-0.0005700305919,-0.0005910241744,-0.0005858947407,-0.0005550417118,
-	-0.0005004582345,-0.0004246754397,-0.0003316011571,-0.0002253402781,-0.0001110122175,
-	6.481431683e-06,0.0001216918245,0.0002298686304,0.0003261092643,0.0004066385445,
-	0.0004679266422,0.0005078449612,0.0005247305962,0.0005184855545,0.0004894657177,
-	0.0004396078875,0.0003711401368,0.0002876524813,0.0001927571866,9.109110397e-05,
-	-1.305232854e-05,-0.0001147879375,-0.0002099844569,-0.0002942827123,-0.0003644441604,
-	-0.0004173427296,-0.0004512367886,-0.0004646507732,-0.0004576276406,-0.0004305247858,
-	-0.0003851446963,-0.0003234760079,-0.000248812401,-0.0001643329015,-7.419309259e-05,
-	1.784519372e-05,0.0001074319225,0.0001909656858,0.0002645758213,0.0003255295742,
-	0.0003710372548,0.0003996959422,0.0004101899103,0.0004027112445,0.0003775489749,
-	0.0003364373697,0.0002811004815,0.0002145654289,0.0001395955333,5.995681931e-05,
-	-2.113747541e-05,-9.973852866e-05,-0.0001728102507,-0.0002368906571,-0.0002896731021,
-	-0.0003286703432,-0.0003528055386,-0.0003608720435,-0.0003531752445,-0.0003299663658,
-	-0.0002928868926,-0.0002434603957,-0.000184415534,-0.0001181328698,-4.802506373e-05,
-	2.314807898e-05,9.185375529e-05,0.0001555361669,0.0002110871428,0.0002566173498,
-	0.0002898929233,0.0003101069888,0.0003161740897,0.0003084905329,0.0002872149344,
-	0.0002539838315,0.0002100104175,0.0001578496303,9.950411186e-05,3.808347174e-05,
-	-2.415283598e-05,-8.393564349e-05,-0.0001392125268,-0.0001871432614,-0.0002262479393,
-	-0.0002545053139,-0.0002713303838,-0.0002757357433,-0.0002682358027,-0.0002489091712,
-	-0.0002192875545,-0.0001803617342,-0.0001345068449,-8.338673069e-05,-2.983134982e-05,
-	2.428373409e-05,7.606208965e-05,0.0001237712277,0.0001649116748,0.0001983387192,
-	0.0002221815375,0.0002360901271,0.0002391767775,0.0002319892083,0.0002145235485,
-	0.0001883187797, 0.000154062669,0.0001140287495, 6.94736591e-05, 2.30489095e-05,
-	-2.37569202e-05,-6.831472274e-05,-0.0001093075407,-0.0001444303198,-0.0001728256757,
-	-0.0001928026759,-0.0002042554988,-0.0002062776475,-0.0001995226194,-0.0001838561293,
-	-0.0001607574377,-0.0001308277861,-9.606408275e-05,-5.748667536e-05,-1.750986121e-05,
-	2.270653022e-05,6.089081944e-05,9.585958469e-05,0.0001256743853,0.0001496513578,
-	0.0001662694849, 0.000175590525,0.0001767261856, 0.000170446845,0.0001565215935,
-	0.0001363524934,0.0001103130271,8.033487393e-05,4.717833508e-05,1.298802999e-05,
-	-2.140434481e-05,-5.38293134e-05,-8.352214354e-05,-0.000108570006,-0.0001286966872,
-	-0.0001424568036,-0.0001499700884,-0.000150359876,-0.0001446030219,-0.0001322491298,
-	-0.0001146859649,-9.227250848e-05,-6.653421588e-05,-3.819964695e-05,-9.06387686e-06,
-	2.012458935e-05,4.748764331e-05,7.244184235e-05,9.333080379e-05,0.0001099643705,
-	0.0001211143681, 0.000127052801,0.0001269718778,0.0001215969023, 0.000110633111,
-	9.539166058e-05,7.605139399e-05,5.415603664e-05,2.995152499e-05,5.263148068e-06,
-	-1.92799962e-05,-4.201701813e-05,-6.301960821e-05,-8.008477016e-05,-9.377201059e-05,
-	-0.0001026394602,-0.0001071029837,-0.0001064698445,-0.0001014417867,-9.174700972e-05,
-	-7.846559311e-05,-6.167274114e-05, -4.2761847e-05,-2.208811566e-05,-1.228938459e-06,
-	1.935775799e-05,3.818924961e-05,5.500539191e-05,6.868619676e-05,7.919352356e-05,
-	8.557629189e-05,8.766703831e-05,8.489783067e-05,  7.7890596e-05,6.769165338e-05,
-	5.339910422e-05,  3.5380388e-05,1.630631959e-05,-5.622492608e-06,-2.745849997e-05,
-	-5.011309622e-05,-7.138950605e-05,-9.18841688e-05,-0.000109776076,-0.0001257383119,
-	-0.0001383075578,-0.0001483907545,-0.0001549085137,-0.0001590757311,-0.0001602044795,
-	-0.000159837582,-0.0001576548093,-0.0001555135968,-0.0001534203475,-0.0001535189658,
-	-0.0001561122335,-0.0001636194938,-0.0001766396599,0.0006753480993
-};
+	inputRate = createHalfBands(inputRate, outputRate);
+	m_historyRate = inputRate;
 
-static const float H8[1024] = {
-	-0.0006996328593,0.0001188832975,0.0001175634388,0.0001213917276,0.0001283083839,
-	0.0001377606386,0.0001476509351,0.0001574828057,0.0001652900974,0.0001708259078,
-	0.0001724386966,0.0001703184971,0.0001632759522,0.0001520668739,0.0001360245806,
-	0.0001165091599,9.331485489e-05,6.835057866e-05,4.166381768e-05,  1.5615351e-05,
-	-9.935311027e-06,-3.212900265e-05,-5.139673522e-05,-6.662284432e-05,-7.541214291e-05,
-	-7.916164031e-05,-7.747823111e-05,-7.019649638e-05,-5.778538616e-05,-4.080222789e-05,
-	-2.062384192e-05,1.765793058e-06,2.463414421e-05,4.692142829e-05,6.687926361e-05,
-	8.362640074e-05, 9.56874137e-05,0.0001026144164,0.0001034717206,9.844210581e-05,
-	8.730982518e-05,7.092419401e-05,4.987714055e-05,2.541515641e-05,-1.03529328e-06,
-	-2.795277396e-05,-5.416748536e-05,-7.722574082e-05,-9.657335613e-05,-0.0001104110561,
-	-0.0001183206841,-0.0001190352705,-0.0001129466764,-9.973134001e-05,-8.061450353e-05,
-	-5.602590318e-05,-2.783947275e-05,2.938523494e-06,3.399751949e-05,6.405694876e-05,
-	9.075563139e-05,0.0001129766606,0.0001287561608,0.0001375623688,0.0001381546463,
-	0.0001309471845,0.0001154432175,9.323695849e-05,6.464844046e-05, 3.18703751e-05,
-	-3.731854576e-06,-3.961809489e-05,-7.428682147e-05,-0.000105083338,-0.0001306200138,
-	-0.0001487200789,-0.000158732495,-0.0001593534689,-0.0001508877176,-0.0001330675586,
-	-0.0001072853338,-7.433709834e-05,  -3.658071e-05,4.415820968e-06,4.572976468e-05,
-	8.552211511e-05,0.0001208265385,0.0001500591316,0.0001708330383,0.0001821853948,
-	0.0001828856039,0.0001730377408,0.0001525317639,0.0001228885085,8.516827074e-05,
-	4.188171079e-05,-5.020055141e-06,-5.233387492e-05,-9.776540537e-05,-0.0001381287584,
-	-0.0001714427053,-0.0001951121958,-0.0002080202248,-0.0002087014145,-0.0001973521139,
-	-0.0001739324944,-0.0001400475157,-9.703105752e-05,-4.765303675e-05,5.712077837e-06,
-	5.960551061e-05,0.0001112899554, 0.000157178918,0.0001950027217,0.0002218424052,
-	0.0002363854146, 0.000237080123,0.0002241047041, 0.000197454181,0.0001589036692,
-	0.0001100298832,5.398872963e-05,-6.539725746e-06,-6.762018165e-05,-0.0001261315629,
-	-0.0001781093306,-0.0002208265068,-0.0002511394559,-0.0002674926654, -0.00026820114,
-	-0.0002533982333,-0.0002231617254,-0.0001795014978,-0.000124204802,-6.081789252e-05,
-	7.537120837e-06,7.650801126e-05,0.0001424873772,0.0002010764583,0.0002491550695,
-	0.0002832626342,0.0003015646944,0.0003022433375,0.0002853846818,0.0002512295614,
-	0.0002019062085,0.0001395964937,6.816711539e-05,-8.778512893e-06,-8.637201972e-05,
-	-0.000160507916,-0.0002263242786,-0.0002802427334,-0.0003184473899,-0.0003388079931,
-	-0.0003394359082,-0.000320301624,-0.0002818120702,-0.0002262876224,-0.0001562770049,
-	-7.603669656e-05,1.027448525e-05,9.730279271e-05, 0.000180339397,0.0002540379355,
-	0.0003142787027,0.0003569076653,0.0003795002995,0.0003800000122, 0.000358363759,
-	0.0003151051351,0.0002527639153,0.0001743200119,8.445548156e-05,-1.208343747e-05,
-	-0.0001094029867,-0.0002021288237,-0.000284373411,-0.000351500581,-0.0003989225661,
-	-0.0004238924885,-0.0004242091381,-0.0003997784515,-0.0003512600088,-0.0002814609034,
-	-0.0001937767665,-9.340078395e-05,1.432164754e-05,0.0001228342735,0.0002261127665,
-	0.0003176680766,0.0003922557225, 0.000444872363,0.0004723849124,0.0004724326136,
-	0.0004448937834,0.0003905885387,0.0003126138763,0.0002148043277,0.0001029338819,
-	-1.698682536e-05,-0.0001377292938,  -0.0002525163,-0.0003541933256,-0.0004368896189,
-	-0.0004951136652,-0.0005253470154,-0.000525056792,-0.0004940710496,-0.0004334033001,
-	-0.0003464359324,-0.0002375565527,-0.0001131067474,2.015427344e-05,0.0001542401878,
-	0.0002815799089,0.0003942787298,0.0004857774184,0.0005500703701, 0.000583219924,
-	0.0005825111875,0.0005476918304,0.0004800116876,0.0003831820504,0.0002621561289,
-	0.0001239295816,-2.391215457e-05,-0.0001725819893,-0.0003136105661,-0.0004383287451,
-	-0.0005394070176,-0.0006102837506,-0.0006465602783,-0.0006453045644,-0.0006062420434,
-	-0.0005308279069,-0.0004231547646,-0.0002888043236,-0.0001354783162,2.833128383e-05,
-	0.0001929526625,0.0003489435476,0.0004867828102,0.0005983138108,0.0006763300044,
-	0.0007159582456, 0.000714042224,0.0006702590617,0.0005863086553,0.0004667116737,
-	0.0003177154867,0.0001478270133,-3.350521365e-05,-0.0002156002447,-0.0003879823198,
-	-0.0005401663948,-0.0006630927091,-0.0007488847477,-0.0007921219221, -0.00078940409,
-	-0.0007403693744,-0.0006469766377,-0.0005142274313,-0.0003490970412,-0.0001609872124,
-	3.96088908e-05,0.0002409105364,0.0004312793899,0.0005991851795,0.0007345975027,
-	0.0008288715035,0.0008760074852,0.0008723288192,0.0008174310206,0.0007135683554,
-	0.0005662555923, 0.000383301347,0.0001750623633,-4.678914775e-05,-0.0002692612761,
-	-0.0004794624401,-0.0006646880065,-0.0008138347184,-0.0009174141451,-0.0009687860729,
-	-0.0009639733471,-0.0009025196778,-0.0007870169939,-0.000623542408, -0.00042081016,
-	-0.0001902632503,5.513396172e-05,0.0003010640794,0.0005332215806,0.0007376178401,
-	0.0009019466816, 0.001015793299, 0.001071806764, 0.001065664575,0.0009968805825,
-	0.0008683825727, 0.000686902029,0.0004621500266,0.0002067631576,-6.485013728e-05,
-	-0.0003368864127,-0.0005934738438,-0.0008191892994,-0.001000396907,-0.001125632087,
-	-0.001186769106,-0.001179085579,-0.001102047972,-0.0009589783149,-0.0007573320763,
-	-0.0005079149269,-0.0002247212833,7.624944556e-05,0.0003775049699,0.0006614479935,
-	0.0009110245155, 0.001111116493,  0.00124908518,   0.0013159113,  0.00130643195,
-	0.001220062026, 0.001060542534,0.0008361524087, 0.000558923115,0.0002443801786,
-	-8.969754708e-05,-0.000423915626,-0.0007387220394,-0.001015228685,-0.001236637705,
-	-0.001388956676,-0.001462178887,-0.001450620592,-0.001353629166,-0.001175416168,
-	-0.0009251767769,-0.0006163415965,-0.000266146264,0.0001055941757,0.0004773316032,
-	0.0008272972773, 0.001134489197, 0.001380204922, 0.001548898872, 0.001629418228,
-	0.001615472953, 0.001506320667, 0.001306697377, 0.001026828424,0.0006817264948,
-	0.0002905959846,-0.0001244332816,-0.0005393362371,-0.0009297800716,-0.001272348105,
-	-0.001546120737,-0.001733751153,-0.001822741237,-0.001806072891,-0.001682892442,
-	-0.001458494226,-0.001144298585,-0.0007571163005,-0.0003184221569,0.0001469678245,
-	0.0006121567567, 0.001049832324, 0.001433742349, 0.001740371226, 0.001950233709,
-	0.002049243776, 0.002029482275, 0.001889929408, 0.001636507339, 0.001281996141,
-	0.0008452883339,0.0003505221102,-0.0001743619941,-0.000699063472,-0.001192763215,
-	-0.001625814242,-0.001971608959, -0.00220808899,-0.002319224877,-0.002295983722,
-	-0.00213708519,-0.001849134336,-0.001446493319,-0.0009504854679,-0.0003884055186,
-	0.000208085301,0.0008046005387, 0.001366090728, 0.001858797506, 0.002252332866,
-	0.002521453891, 0.002647723071, 0.002620650921, 0.002438556869, 0.002108784625,
-	0.001647529891, 0.001079018577,0.0004343330802,-0.0002503220749,-0.0009355658549,
-	-0.001581133576,-0.002148142084,-0.002601471497,-0.002911828458,-0.003057660535,
-	-0.003026531311,-0.002816108754,-0.002434506081,-0.001900067786,-0.001240530051,
-	-0.0004916468752,0.0003047387872, 0.001102952869, 0.001856099698, 0.002518734895,
-	0.003049581544, 0.003414016915, 0.003586292733, 0.003551232861, 0.003305417253,
-	0.002857667161, 0.002228877507, 0.001451093121,0.0005659633316,-0.0003774297948,
-	-0.001325230114,-0.002221800387,-0.003012921894,-0.003648975864,-0.004087965935,
-	-0.004298192449,-0.004260369577,-0.003969142213, -0.00343379518,-0.002678169636,
-	-0.001739717554,-0.000667763059,0.0004789918894, 0.001635558438, 0.002734227572,
-	0.003708398901, 0.004496469628,  0.00504555786, 0.005314856302,  0.00527841365,
-	0.004927137401, 0.004269929137, 0.003333826549, 0.002163099591,0.0008173721726,
-	-0.0006312479964,-0.002101790626,-0.003508737776,-0.004766725004,-0.005795421079,
-	-0.006524321623,-0.006897177082,-0.006875795778,-0.006442999467,-0.005604528356,
-	-0.004389750771, -0.00285109831,-0.001062200288,0.0008852356113, 0.002885665279,
-	0.004824899603, 0.006586004514,  0.00805564411, 0.009130497463, 0.009723488241,
-	0.009769434109, 0.009229829535, 0.008096482605, 0.006393739954, 0.004179206677,
-	0.001542765531,-0.001396031585,-0.004492182285,-0.007580892183, -0.01048445702,
-	-0.01302006468, -0.01500818599, -0.01628114842, -0.01669150963, -0.01611980982,
-	-0.0144813275,  -0.0117314849, -0.00786961522,-0.002940885955, 0.002963775536,
-	0.009709809907,  0.01712308824,  0.02499587834,  0.03309434652,   0.0411674194,
-	0.0489565134,  0.05620577559,  0.06267239898,  0.06813646853,   0.0724100098,
-	0.07534475625,  0.07683827728,  0.07683827728,  0.07534475625,   0.0724100098,
-	0.06813646853,  0.06267239898,  0.05620577559,   0.0489565134,   0.0411674194,
-	0.03309434652,  0.02499587834,  0.01712308824, 0.009709809907, 0.002963775536,
-	-0.002940885955, -0.00786961522,  -0.0117314849,  -0.0144813275, -0.01611980982,
-	-0.01669150963, -0.01628114842, -0.01500818599, -0.01302006468, -0.01048445702,
-	-0.007580892183,-0.004492182285,-0.001396031585, 0.001542765531, 0.004179206677,
-	0.006393739954, 0.008096482605, 0.009229829535, 0.009769434109, 0.009723488241,
-	0.009130497463,  0.00805564411, 0.006586004514, 0.004824899603, 0.002885665279,
-	0.0008852356113,-0.001062200288, -0.00285109831,-0.004389750771,-0.005604528356,
-	-0.006442999467,-0.006875795778,-0.006897177082,-0.006524321623,-0.005795421079,
-	-0.004766725004,-0.003508737776,-0.002101790626,-0.0006312479964,0.0008173721726,
-	0.002163099591, 0.003333826549, 0.004269929137, 0.004927137401,  0.00527841365,
-	0.005314856302,  0.00504555786, 0.004496469628, 0.003708398901, 0.002734227572,
-	0.001635558438,0.0004789918894,-0.000667763059,-0.001739717554,-0.002678169636,
-	-0.00343379518,-0.003969142213,-0.004260369577,-0.004298192449,-0.004087965935,
-	-0.003648975864,-0.003012921894,-0.002221800387,-0.001325230114,-0.0003774297948,
-	0.0005659633316, 0.001451093121, 0.002228877507, 0.002857667161, 0.003305417253,
-	0.003551232861, 0.003586292733, 0.003414016915, 0.003049581544, 0.002518734895,
-	0.001856099698, 0.001102952869,0.0003047387872,-0.0004916468752,-0.001240530051,
-	-0.001900067786,-0.002434506081,-0.002816108754,-0.003026531311,-0.003057660535,
-	-0.002911828458,-0.002601471497,-0.002148142084,-0.001581133576,-0.0009355658549,
-	-0.0002503220749,0.0004343330802, 0.001079018577, 0.001647529891, 0.002108784625,
-	0.002438556869, 0.002620650921, 0.002647723071, 0.002521453891, 0.002252332866,
-	0.001858797506, 0.001366090728,0.0008046005387, 0.000208085301,-0.0003884055186,
-	-0.0009504854679,-0.001446493319,-0.001849134336, -0.00213708519,-0.002295983722,
-	-0.002319224877, -0.00220808899,-0.001971608959,-0.001625814242,-0.001192763215,
-	-0.000699063472,-0.0001743619941,0.0003505221102,0.0008452883339, 0.001281996141,
-	0.001636507339, 0.001889929408, 0.002029482275, 0.002049243776, 0.001950233709,
-	0.001740371226, 0.001433742349, 0.001049832324,0.0006121567567,0.0001469678245,
-	-0.0003184221569,-0.0007571163005,-0.001144298585,-0.001458494226,-0.001682892442,
-	-0.001806072891,-0.001822741237,-0.001733751153,-0.001546120737,-0.001272348105,
-	-0.0009297800716,-0.0005393362371,-0.0001244332816,0.0002905959846,0.0006817264948,
-	0.001026828424, 0.001306697377, 0.001506320667, 0.001615472953, 0.001629418228,
-	0.001548898872, 0.001380204922, 0.001134489197,0.0008272972773,0.0004773316032,
-	0.0001055941757,-0.000266146264,-0.0006163415965,-0.0009251767769,-0.001175416168,
-	-0.001353629166,-0.001450620592,-0.001462178887,-0.001388956676,-0.001236637705,
-	-0.001015228685,-0.0007387220394,-0.000423915626,-8.969754708e-05,0.0002443801786,
-	0.000558923115,0.0008361524087, 0.001060542534, 0.001220062026,  0.00130643195,
-	0.0013159113,  0.00124908518, 0.001111116493,0.0009110245155,0.0006614479935,
-	0.0003775049699,7.624944556e-05,-0.0002247212833,-0.0005079149269,-0.0007573320763,
-	-0.0009589783149,-0.001102047972,-0.001179085579,-0.001186769106,-0.001125632087,
-	-0.001000396907,-0.0008191892994,-0.0005934738438,-0.0003368864127,-6.485013728e-05,
-	0.0002067631576,0.0004621500266, 0.000686902029,0.0008683825727,0.0009968805825,
-	0.001065664575, 0.001071806764, 0.001015793299,0.0009019466816,0.0007376178401,
-	0.0005332215806,0.0003010640794,5.513396172e-05,-0.0001902632503, -0.00042081016,
-	-0.000623542408,-0.0007870169939,-0.0009025196778,-0.0009639733471,-0.0009687860729,
-	-0.0009174141451,-0.0008138347184,-0.0006646880065,-0.0004794624401,-0.0002692612761,
-	-4.678914775e-05,0.0001750623633, 0.000383301347,0.0005662555923,0.0007135683554,
-	0.0008174310206,0.0008723288192,0.0008760074852,0.0008288715035,0.0007345975027,
-	0.0005991851795,0.0004312793899,0.0002409105364, 3.96088908e-05,-0.0001609872124,
-	-0.0003490970412,-0.0005142274313,-0.0006469766377,-0.0007403693744, -0.00078940409,
-	-0.0007921219221,-0.0007488847477,-0.0006630927091,-0.0005401663948,-0.0003879823198,
-	-0.0002156002447,-3.350521365e-05,0.0001478270133,0.0003177154867,0.0004667116737,
-	0.0005863086553,0.0006702590617, 0.000714042224,0.0007159582456,0.0006763300044,
-	0.0005983138108,0.0004867828102,0.0003489435476,0.0001929526625,2.833128383e-05,
-	-0.0001354783162,-0.0002888043236,-0.0004231547646,-0.0005308279069,-0.0006062420434,
-	-0.0006453045644,-0.0006465602783,-0.0006102837506,-0.0005394070176,-0.0004383287451,
-	-0.0003136105661,-0.0001725819893,-2.391215457e-05,0.0001239295816,0.0002621561289,
-	0.0003831820504,0.0004800116876,0.0005476918304,0.0005825111875, 0.000583219924,
-	0.0005500703701,0.0004857774184,0.0003942787298,0.0002815799089,0.0001542401878,
-	2.015427344e-05,-0.0001131067474,-0.0002375565527,-0.0003464359324,-0.0004334033001,
-	-0.0004940710496,-0.000525056792,-0.0005253470154,-0.0004951136652,-0.0004368896189,
-	-0.0003541933256,  -0.0002525163,-0.0001377292938,-1.698682536e-05,0.0001029338819,
-	0.0002148043277,0.0003126138763,0.0003905885387,0.0004448937834,0.0004724326136,
-	0.0004723849124, 0.000444872363,0.0003922557225,0.0003176680766,0.0002261127665,
-	0.0001228342735,1.432164754e-05,-9.340078395e-05,-0.0001937767665,-0.0002814609034,
-	-0.0003512600088,-0.0003997784515,-0.0004242091381,-0.0004238924885,-0.0003989225661,
-	-0.000351500581,-0.000284373411,-0.0002021288237,-0.0001094029867,-1.208343747e-05,
-	8.445548156e-05,0.0001743200119,0.0002527639153,0.0003151051351, 0.000358363759,
-	0.0003800000122,0.0003795002995,0.0003569076653,0.0003142787027,0.0002540379355,
-	0.000180339397,9.730279271e-05,1.027448525e-05,-7.603669656e-05,-0.0001562770049,
-	-0.0002262876224,-0.0002818120702,-0.000320301624,-0.0003394359082,-0.0003388079931,
-	-0.0003184473899,-0.0002802427334,-0.0002263242786,-0.000160507916,-8.637201972e-05,
-	-8.778512893e-06,6.816711539e-05,0.0001395964937,0.0002019062085,0.0002512295614,
-	0.0002853846818,0.0003022433375,0.0003015646944,0.0002832626342,0.0002491550695,
-	0.0002010764583,0.0001424873772,7.650801126e-05,7.537120837e-06,-6.081789252e-05,
-	-0.000124204802,-0.0001795014978,-0.0002231617254,-0.0002533982333, -0.00026820114,
-	-0.0002674926654,-0.0002511394559,-0.0002208265068,-0.0001781093306,-0.0001261315629,
-	-6.762018165e-05,-6.539725746e-06,5.398872963e-05,0.0001100298832,0.0001589036692,
-	0.000197454181,0.0002241047041, 0.000237080123,0.0002363854146,0.0002218424052,
-	0.0001950027217, 0.000157178918,0.0001112899554,5.960551061e-05,5.712077837e-06,
-	-4.765303675e-05,-9.703105752e-05,-0.0001400475157,-0.0001739324944,-0.0001973521139,
-	-0.0002087014145,-0.0002080202248,-0.0001951121958,-0.0001714427053,-0.0001381287584,
-	-9.776540537e-05,-5.233387492e-05,-5.020055141e-06,4.188171079e-05,8.516827074e-05,
-	0.0001228885085,0.0001525317639,0.0001730377408,0.0001828856039,0.0001821853948,
-	0.0001708330383,0.0001500591316,0.0001208265385,8.552211511e-05,4.572976468e-05,
-	4.415820968e-06,  -3.658071e-05,-7.433709834e-05,-0.0001072853338,-0.0001330675586,
-	-0.0001508877176,-0.0001593534689,-0.000158732495,-0.0001487200789,-0.0001306200138,
-	-0.000105083338,-7.428682147e-05,-3.961809489e-05,-3.731854576e-06, 3.18703751e-05,
-	6.464844046e-05,9.323695849e-05,0.0001154432175,0.0001309471845,0.0001381546463,
-	0.0001375623688,0.0001287561608,0.0001129766606,9.075563139e-05,6.405694876e-05,
-	3.399751949e-05,2.938523494e-06,-2.783947275e-05,-5.602590318e-05,-8.061450353e-05,
-	-9.973134001e-05,-0.0001129466764,-0.0001190352705,-0.0001183206841,-0.0001104110561,
-	-9.657335613e-05,-7.722574082e-05,-5.416748536e-05,-2.795277396e-05,-1.03529328e-06,
-	2.541515641e-05,4.987714055e-05,7.092419401e-05,8.730982518e-05,9.844210581e-05,
-	0.0001034717206,0.0001026144164, 9.56874137e-05,8.362640074e-05,6.687926361e-05,
-	4.692142829e-05,2.463414421e-05,1.765793058e-06,-2.062384192e-05,-4.080222789e-05,
-	-5.778538616e-05,-7.019649638e-05,-7.747823111e-05,-7.916164031e-05,-7.541214291e-05,
-	-6.662284432e-05,-5.139673522e-05,-3.212900265e-05,-9.935311027e-06,  1.5615351e-05,
-	4.166381768e-05,6.835057866e-05,9.331485489e-05,0.0001165091599,0.0001360245806,
-	0.0001520668739,0.0001632759522,0.0001703184971,0.0001724386966,0.0001708259078,
-	0.0001652900974,0.0001574828057,0.0001476509351,0.0001377606386,0.0001283083839,
-	0.0001213917276,0.0001175634388,0.0001188832975,-0.0006996328593
-};
+	if(inputRate < outputRate)
+		minRate = inputRate;
+	else minRate = outputRate;
 
-static const float H9[1024] = {
-	0.0007273287629,-5.378163041e-05,-6.141335325e-05,-7.354153058e-05,-9.007332119e-05,
-	-0.000108439519,-0.0001281731093,-0.0001464913075,-0.0001629167236,-0.0001748486684,
-	-0.0001822171471,-0.0001829937537,-0.0001778649166,-0.0001656341628,-0.0001479183557,
-	-0.0001243864099,-9.752120968e-05,-6.762013072e-05,-3.775628647e-05,-8.331036042e-06,
-	1.740823973e-05,3.857988122e-05,5.508517279e-05,6.411784125e-05,6.555680011e-05,
-	6.023111564e-05,4.795445057e-05,3.057704089e-05, 8.66380924e-06,-1.513528059e-05,
-	-3.980288238e-05,-6.240704533e-05,-8.201794844e-05,-9.601467173e-05,-0.0001041072319,
-	-0.0001044847231,-9.789612523e-05,-8.360550419e-05,-6.353030767e-05,-3.793595533e-05,
-	-9.756575309e-06,2.015968312e-05,4.857228487e-05,7.387270307e-05,9.386627789e-05,
-	0.0001074698885,0.0001126720454,0.0001097557906,9.791381308e-05,7.875185838e-05,
-	5.265706204e-05,2.236809269e-05,-1.084661835e-05,-4.360457024e-05,-7.436340093e-05,
-	-9.979954484e-05,-0.0001188299721,-0.0001288994681,-0.0001300208824,-0.000120906574,
-	-0.0001030257336,-7.64570359e-05,-4.410828114e-05,-7.222276963e-06,3.067858415e-05,
-	6.742253754e-05,9.948659135e-05,0.0001252438378,0.0001417274034,0.0001483702799,
-	0.000143547979,0.0001282785524, 0.000102568978,6.904451584e-05,2.913207209e-05,
-	-1.337931644e-05,-5.628279541e-05,-9.542571934e-05,-0.0001287269406,-0.0001526107808,
-	-0.0001660370617,-0.0001667991892,-0.0001555770868,-0.0001319114672,-9.835064702e-05,
-	-5.6275112e-05,-9.46576256e-06,  3.9473176e-05,8.601429727e-05,0.0001275163377,
-	0.0001598726376,0.0001813676936,0.0001892557193,0.0001835662551,0.0001635341032,
-	0.0001312782842,  8.8054956e-05,3.779917097e-05,-1.677922228e-05,-7.07518484e-05,
-	-0.0001209791008,-0.0001626873127,-0.0001935141045,-0.0002099604462,-0.0002115028765,
-	-0.0001967200951,-0.000167342776,-0.0001244225859,-7.17542207e-05,-1.219946535e-05,
-	4.900616841e-05,0.0001081881492,0.0001599724928,0.0002012265468,0.0002277574822,
-	0.0002381825325,0.0002305096568,0.0002058558894,0.0001648451434,0.0001111319434,
-	4.760399679e-05,-2.026729817e-05,-8.837196947e-05,-0.0001507022534,-0.0002033962664,
-	-0.0002413650946,-0.0002624474291,-0.0002638058795,-0.0002458395611,-0.0002086806053,
-	-0.0001556338393,-8.948780305e-05,-1.582952973e-05,6.083376138e-05,0.0001339291193,
-	0.0001987827563,0.0002495041408,0.0002829039877,0.0002952854556, 0.000286205468,
-	0.0002550776117,0.0002047019661,0.0001376325963,5.946137753e-05,-2.502654752e-05,
-	-0.0001087259079,-0.0001862599602,-0.0002507757163,-0.0002981162106,-0.0003235510667,
-	-0.0003256263735,-0.0003029042855,-0.0002575178805,-0.0001916041074,-0.0001105938281,
-	-1.942781637e-05,7.438635657e-05,0.0001647181634,  0.00024388163,0.0003065970086,
-	0.0003470253432,0.0003625926911,0.0003508509253,0.0003130437399,0.0002507097961,
-	0.0001689307537,7.264863962e-05,-3.030614971e-05,-0.0001332201209, -0.00022750067,
-	-0.0003067840589,-0.0003640433133,-0.0003954425629,-0.0003973394923,-0.0003699192312,
-	-0.000313906261,-0.0002338405902,-0.0001344836783,-2.377440069e-05,9.100928582e-05,
-	0.000200516035,0.0002972688235,0.0003729857563,0.0004224513541, 0.000440706528,
-	0.0004266629112,0.0003800265258,0.0003045522026,0.0002045869769,8.805222751e-05,
-	-3.744132118e-05,-0.0001618182723,-0.0002765450045,-0.0003720605164,-0.000441704964,
-	-0.0004790236999,-0.0004814860586,-0.0004475274181,-0.0003798909602,-0.0002822931274,
-	-0.000162347962,-2.788066013e-05,0.0001104850671,0.0002432359906,0.0003595512535,
-	0.0004512290761,0.0005102253053, 0.000532356964,0.0005145953037,0.0004584039852,
-	0.0003665704571,0.0002461970726,0.0001050497958,-4.586451178e-05,-0.000196169116,
-	-0.0003338193055,-0.0004490738211,-0.0005321754725,-0.0005771484575,-0.0005792479496,
-	-0.0005383863463,-0.0004561781825,-0.0003388731566,-0.000193945365,-3.255630145e-05,
-	0.0001342155738,0.0002932255156,0.0004331761156,0.0005425550044,  0.00061341119,
-	0.0006390918279,0.0006177049363,0.0005493514473,0.0004391525872,0.0002939665283,
-	0.0001248418121,-5.66697563e-05,-0.0002364364045,-0.0004016948515,-0.0005391141167,
-	-0.0006386914174,-0.0006916529383,-0.0006940192543,-0.0006440987345,-0.0005455228384,
-	-0.0004041965585,-0.0002307435352,-3.694303814e-05,0.0001623110875,0.0003528757079,
-	0.000519656227,0.0006504837656,0.0007342955796,0.0007647906896,0.0007381475298,
-	0.0006561616319,0.0005234197597,0.0003497623256,0.0001468622941,-6.985713844e-05,
-	-0.000285066606,-0.0004819431051,-0.0006461372832,-0.0007641685661,-0.0008271549013,
-	-0.0008288516547,-0.0007688455516,-0.0006500025629,-0.0004809675156,-0.0002729614789,
-	-4.160073149e-05,0.0001967948338,0.0004238415568,0.0006230121362,0.0007783020847,
-	0.0008780548815,0.0009132928681, 0.000881013053,0.0007819398888,0.0006230956642,
-	0.0004148064472,0.0001725340699,-8.67456547e-05,-0.0003432506928,-0.0005783606321,
-	-0.0007735083927,-0.0009140850743,-0.0009880908765,-0.0009895693511,-0.0009166593081,
-	-0.0007742728922,-0.0005713814753,-0.0003228308051,-4.592112964e-05,0.0002384530089,
-	0.0005097242538, 0.000746767153,0.0009318959783, 0.001049841288, 0.001091313432,
-	0.001051410451,0.0009324351558,0.0007414650172,0.0004922568332,0.0002019683889,
-	-0.0001077281559,-0.0004145303101,-0.0006948401569,-0.0009278246434,-0.001094714738,
-	-0.001182539039,-0.001182902604,-0.001094949082,-0.0009233125602,-0.0006800611154,
-	-0.0003817204561,-5.030741886e-05,0.0002904417634,0.0006146137603,0.0008982079453,
-	0.001118797809, 0.001259394805, 0.001307647442, 0.001258990029, 0.001114971237,
-	0.000885368383,0.0005854641786,0.0002371061419,-0.000134929156,-0.0005026438157,
-	-0.000838951848,-0.001117635053,-0.001317397342,-0.001421478111,-0.001421014662,
-	-0.00131382863,-0.001106688054,-0.000812955841,-0.0004537003115,-5.424647316e-05,
-	0.0003556669108,0.0007460018387, 0.001086708275,  0.00135192601, 0.001520043705,
-	0.001577321091, 0.001517121447, 0.001342448173, 0.001063971897,0.0007012639544,
-	0.0002795887995,-0.0001700046123,-0.0006147870445,-0.001020894619,-0.001357700676,
-	-0.001598330098,-0.001723537687,-0.001721497392,-0.001590593485, -0.00133793545,
-	-0.000980757759,-0.0005435466883,-5.807536218e-05,0.0004405723303,0.0009148445097,
-	0.001329200226, 0.001651102444, 0.001855196781, 0.001923652366, 0.001849303837,
-	0.001634715591, 0.001293821842,0.0008494441863,0.0003333894419,-0.0002174045221,
-	-0.0007619079552,-0.001259598183,-0.001671919948,-0.001966762124,-0.002119428944,
-	-0.002116179559,-0.001953910105,-0.001642123447,-0.001200943138,-0.0006613135338,
-	-6.139842299e-05,0.0005546442117, 0.001141324406, 0.001653726562,  0.00205233926,
-	0.002304664114, 0.002389224013, 0.002295955317, 0.002028612886, 0.001603347249,
-	0.001049165963,0.0004046180111,-0.0002835018386,-0.0009648445412,-0.001587854582,
-	-0.002104927553,-0.002474718727,-0.002666690852,-0.002662313869,-0.002457994502,
-	-0.002064391738,-0.001507193898,-0.0008242705371,-6.435386604e-05,0.0007175915525,
-	0.001463114866, 0.002115774667, 0.002624201123, 0.002947233384, 0.003056049813,
-	0.002937772777, 0.002595631871, 0.002050262643, 0.001337429741,0.0005068409373,
-	-0.000382328144,-0.001264532912,-0.002073680516,-0.002746963874,-0.003230696311,
-	-0.003483494977,-0.003480709158,-0.003215661971,-0.002701623365,-0.001970337238,
-	-0.001071128179,-6.671228766e-05, 0.000970149762, 0.001962758834, 0.002835136605,
-	0.003518637968, 0.003956338391, 0.004108528141, 0.003955232445,  0.00349917775,
-	0.002765356796, 0.001800694503,0.0006703573745,-0.0005456890212,-0.001759021427,
-	-0.00287822797,-0.003816422541,-0.004497037735,-0.004860626068,-0.004869048484,
-	-0.004509768449,-0.003796887118,-0.002771737054, -0.00150003063,-6.855909305e-05,
-	0.001421185094, 0.002859295346, 0.004135945812, 0.005148827098, 0.005811654963,
-	0.006060481537, 0.005859919358, 0.005206254311,  0.00412959652, 0.002692450071,
-	0.0009870745707,-0.0008706097142,-0.002747918712,-0.004504925571,-0.006003818009,
-	-0.007119576447,-0.007749160286,-0.007820547558,-0.007298983634,-0.006191826425,
-	-0.00454969611,-0.002465524711,-6.969331298e-05, 0.002476843772, 0.004992770031,
-	0.007287719287,  0.00917564705,  0.01048781071,  0.01108604856,  0.01087398734,
-	0.009806777351, 0.007897251286, 0.005219323095, 0.001906946301,-0.001850210363,
-	-0.005815458484,-0.009716617875, -0.01326088887, -0.01615120843, -0.01810414158,
-	-0.01886732876, -0.01823628135, -0.01606867276, -0.01229595672,-0.006930788513,
-	-7.041360368e-05, 0.008105001412,  0.01733844727,  0.02730694786,  0.03763614595,
-	0.04791832343,  0.05773247406,  0.06666568667,   0.0743342638,  0.08040379733,
-	0.08460661769,  0.08675598353,  0.08675598353,  0.08460661769,  0.08040379733,
-	0.0743342638,  0.06666568667,  0.05773247406,  0.04791832343,  0.03763614595,
-	0.02730694786,  0.01733844727, 0.008105001412,-7.041360368e-05,-0.006930788513,
-	-0.01229595672, -0.01606867276, -0.01823628135, -0.01886732876, -0.01810414158,
-	-0.01615120843, -0.01326088887,-0.009716617875,-0.005815458484,-0.001850210363,
-	0.001906946301, 0.005219323095, 0.007897251286, 0.009806777351,  0.01087398734,
-	0.01108604856,  0.01048781071,  0.00917564705, 0.007287719287, 0.004992770031,
-	0.002476843772,-6.969331298e-05,-0.002465524711, -0.00454969611,-0.006191826425,
-	-0.007298983634,-0.007820547558,-0.007749160286,-0.007119576447,-0.006003818009,
-	-0.004504925571,-0.002747918712,-0.0008706097142,0.0009870745707, 0.002692450071,
-	0.00412959652, 0.005206254311, 0.005859919358, 0.006060481537, 0.005811654963,
-	0.005148827098, 0.004135945812, 0.002859295346, 0.001421185094,-6.855909305e-05,
-	-0.00150003063,-0.002771737054,-0.003796887118,-0.004509768449,-0.004869048484,
-	-0.004860626068,-0.004497037735,-0.003816422541, -0.00287822797,-0.001759021427,
-	-0.0005456890212,0.0006703573745, 0.001800694503, 0.002765356796,  0.00349917775,
-	0.003955232445, 0.004108528141, 0.003956338391, 0.003518637968, 0.002835136605,
-	0.001962758834, 0.000970149762,-6.671228766e-05,-0.001071128179,-0.001970337238,
-	-0.002701623365,-0.003215661971,-0.003480709158,-0.003483494977,-0.003230696311,
-	-0.002746963874,-0.002073680516,-0.001264532912,-0.000382328144,0.0005068409373,
-	0.001337429741, 0.002050262643, 0.002595631871, 0.002937772777, 0.003056049813,
-	0.002947233384, 0.002624201123, 0.002115774667, 0.001463114866,0.0007175915525,
-	-6.435386604e-05,-0.0008242705371,-0.001507193898,-0.002064391738,-0.002457994502,
-	-0.002662313869,-0.002666690852,-0.002474718727,-0.002104927553,-0.001587854582,
-	-0.0009648445412,-0.0002835018386,0.0004046180111, 0.001049165963, 0.001603347249,
-	0.002028612886, 0.002295955317, 0.002389224013, 0.002304664114,  0.00205233926,
-	0.001653726562, 0.001141324406,0.0005546442117,-6.139842299e-05,-0.0006613135338,
-	-0.001200943138,-0.001642123447,-0.001953910105,-0.002116179559,-0.002119428944,
-	-0.001966762124,-0.001671919948,-0.001259598183,-0.0007619079552,-0.0002174045221,
-	0.0003333894419,0.0008494441863, 0.001293821842, 0.001634715591, 0.001849303837,
-	0.001923652366, 0.001855196781, 0.001651102444, 0.001329200226,0.0009148445097,
-	0.0004405723303,-5.807536218e-05,-0.0005435466883,-0.000980757759, -0.00133793545,
-	-0.001590593485,-0.001721497392,-0.001723537687,-0.001598330098,-0.001357700676,
-	-0.001020894619,-0.0006147870445,-0.0001700046123,0.0002795887995,0.0007012639544,
-	0.001063971897, 0.001342448173, 0.001517121447, 0.001577321091, 0.001520043705,
-	0.00135192601, 0.001086708275,0.0007460018387,0.0003556669108,-5.424647316e-05,
-	-0.0004537003115,-0.000812955841,-0.001106688054, -0.00131382863,-0.001421014662,
-	-0.001421478111,-0.001317397342,-0.001117635053,-0.000838951848,-0.0005026438157,
-	-0.000134929156,0.0002371061419,0.0005854641786, 0.000885368383, 0.001114971237,
-	0.001258990029, 0.001307647442, 0.001259394805, 0.001118797809,0.0008982079453,
-	0.0006146137603,0.0002904417634,-5.030741886e-05,-0.0003817204561,-0.0006800611154,
-	-0.0009233125602,-0.001094949082,-0.001182902604,-0.001182539039,-0.001094714738,
-	-0.0009278246434,-0.0006948401569,-0.0004145303101,-0.0001077281559,0.0002019683889,
-	0.0004922568332,0.0007414650172,0.0009324351558, 0.001051410451, 0.001091313432,
-	0.001049841288,0.0009318959783, 0.000746767153,0.0005097242538,0.0002384530089,
-	-4.592112964e-05,-0.0003228308051,-0.0005713814753,-0.0007742728922,-0.0009166593081,
-	-0.0009895693511,-0.0009880908765,-0.0009140850743,-0.0007735083927,-0.0005783606321,
-	-0.0003432506928,-8.67456547e-05,0.0001725340699,0.0004148064472,0.0006230956642,
-	0.0007819398888, 0.000881013053,0.0009132928681,0.0008780548815,0.0007783020847,
-	0.0006230121362,0.0004238415568,0.0001967948338,-4.160073149e-05,-0.0002729614789,
-	-0.0004809675156,-0.0006500025629,-0.0007688455516,-0.0008288516547,-0.0008271549013,
-	-0.0007641685661,-0.0006461372832,-0.0004819431051,-0.000285066606,-6.985713844e-05,
-	0.0001468622941,0.0003497623256,0.0005234197597,0.0006561616319,0.0007381475298,
-	0.0007647906896,0.0007342955796,0.0006504837656, 0.000519656227,0.0003528757079,
-	0.0001623110875,-3.694303814e-05,-0.0002307435352,-0.0004041965585,-0.0005455228384,
-	-0.0006440987345,-0.0006940192543,-0.0006916529383,-0.0006386914174,-0.0005391141167,
-	-0.0004016948515,-0.0002364364045,-5.66697563e-05,0.0001248418121,0.0002939665283,
-	0.0004391525872,0.0005493514473,0.0006177049363,0.0006390918279,  0.00061341119,
-	0.0005425550044,0.0004331761156,0.0002932255156,0.0001342155738,-3.255630145e-05,
-	-0.000193945365,-0.0003388731566,-0.0004561781825,-0.0005383863463,-0.0005792479496,
-	-0.0005771484575,-0.0005321754725,-0.0004490738211,-0.0003338193055,-0.000196169116,
-	-4.586451178e-05,0.0001050497958,0.0002461970726,0.0003665704571,0.0004584039852,
-	0.0005145953037, 0.000532356964,0.0005102253053,0.0004512290761,0.0003595512535,
-	0.0002432359906,0.0001104850671,-2.788066013e-05,-0.000162347962,-0.0002822931274,
-	-0.0003798909602,-0.0004475274181,-0.0004814860586,-0.0004790236999,-0.000441704964,
-	-0.0003720605164,-0.0002765450045,-0.0001618182723,-3.744132118e-05,8.805222751e-05,
-	0.0002045869769,0.0003045522026,0.0003800265258,0.0004266629112, 0.000440706528,
-	0.0004224513541,0.0003729857563,0.0002972688235, 0.000200516035,9.100928582e-05,
-	-2.377440069e-05,-0.0001344836783,-0.0002338405902,-0.000313906261,-0.0003699192312,
-	-0.0003973394923,-0.0003954425629,-0.0003640433133,-0.0003067840589, -0.00022750067,
-	-0.0001332201209,-3.030614971e-05,7.264863962e-05,0.0001689307537,0.0002507097961,
-	0.0003130437399,0.0003508509253,0.0003625926911,0.0003470253432,0.0003065970086,
-	0.00024388163,0.0001647181634,7.438635657e-05,-1.942781637e-05,-0.0001105938281,
-	-0.0001916041074,-0.0002575178805,-0.0003029042855,-0.0003256263735,-0.0003235510667,
-	-0.0002981162106,-0.0002507757163,-0.0001862599602,-0.0001087259079,-2.502654752e-05,
-	5.946137753e-05,0.0001376325963,0.0002047019661,0.0002550776117, 0.000286205468,
-	0.0002952854556,0.0002829039877,0.0002495041408,0.0001987827563,0.0001339291193,
-	6.083376138e-05,-1.582952973e-05,-8.948780305e-05,-0.0001556338393,-0.0002086806053,
-	-0.0002458395611,-0.0002638058795,-0.0002624474291,-0.0002413650946,-0.0002033962664,
-	-0.0001507022534,-8.837196947e-05,-2.026729817e-05,4.760399679e-05,0.0001111319434,
-	0.0001648451434,0.0002058558894,0.0002305096568,0.0002381825325,0.0002277574822,
-	0.0002012265468,0.0001599724928,0.0001081881492,4.900616841e-05,-1.219946535e-05,
-	-7.17542207e-05,-0.0001244225859,-0.000167342776,-0.0001967200951,-0.0002115028765,
-	-0.0002099604462,-0.0001935141045,-0.0001626873127,-0.0001209791008,-7.07518484e-05,
-	-1.677922228e-05,3.779917097e-05,  8.8054956e-05,0.0001312782842,0.0001635341032,
-	0.0001835662551,0.0001892557193,0.0001813676936,0.0001598726376,0.0001275163377,
-	8.601429727e-05,  3.9473176e-05,-9.46576256e-06, -5.6275112e-05,-9.835064702e-05,
-	-0.0001319114672,-0.0001555770868,-0.0001667991892,-0.0001660370617,-0.0001526107808,
-	-0.0001287269406,-9.542571934e-05,-5.628279541e-05,-1.337931644e-05,2.913207209e-05,
-	6.904451584e-05, 0.000102568978,0.0001282785524, 0.000143547979,0.0001483702799,
-	0.0001417274034,0.0001252438378,9.948659135e-05,6.742253754e-05,3.067858415e-05,
-	-7.222276963e-06,-4.410828114e-05,-7.64570359e-05,-0.0001030257336,-0.000120906574,
-	-0.0001300208824,-0.0001288994681,-0.0001188299721,-9.979954484e-05,-7.436340093e-05,
-	-4.360457024e-05,-1.084661835e-05,2.236809269e-05,5.265706204e-05,7.875185838e-05,
-	9.791381308e-05,0.0001097557906,0.0001126720454,0.0001074698885,9.386627789e-05,
-	7.387270307e-05,4.857228487e-05,2.015968312e-05,-9.756575309e-06,-3.793595533e-05,
-	-6.353030767e-05,-8.360550419e-05,-9.789612523e-05,-0.0001044847231,-0.0001041072319,
-	-9.601467173e-05,-8.201794844e-05,-6.240704533e-05,-3.980288238e-05,-1.513528059e-05,
-	8.66380924e-06,3.057704089e-05,4.795445057e-05,6.023111564e-05,6.555680011e-05,
-	6.411784125e-05,5.508517279e-05,3.857988122e-05,1.740823973e-05,-8.331036042e-06,
-	-3.775628647e-05,-6.762013072e-05,-9.752120968e-05,-0.0001243864099,-0.0001479183557,
-	-0.0001656341628,-0.0001778649166,-0.0001829937537,-0.0001822171471,-0.0001748486684,
-	-0.0001629167236,-0.0001464913075,-0.0001281731093,-0.000108439519,-9.007332119e-05,
-	-7.354153058e-05,-6.141335325e-05,-5.378163041e-05,0.0007273287629
-};
+	// exact rational ratio L/M with a small L -> L phase bank and a precomputed phase schedule
+	quint64 interpolation = 0;
+	quint64 decimation = 0;
+	if((inputRate > 0.0) && (outputRate > 0.0) && (inputRate == floor(inputRate)) && (outputRate == floor(outputRate))) {
+		quint64 gcd = greatestCommonDivisor((quint64)inputRate, (quint64)outputRate);
+		interpolation = (quint64)outputRate / gcd;
+		decimation = (quint64)inputRate / gcd;
+	}
 
-static const float H10[1024] = {
-	-0.0007570767193,-2.205422606e-05,-1.132004127e-05,6.208534614e-06,2.937795944e-05,
-	5.653682092e-05,8.565576718e-05,0.0001144627749,0.0001406469673,0.0001620282128,
-	0.0001767864742, 0.000183588083, 0.000181767653,0.0001713261445,0.0001530190784,
-	0.0001281749865,9.871921793e-05,6.681338709e-05,3.495993224e-05,5.380798029e-06,
-	-1.749089461e-05,-3.475742051e-05,-4.355686542e-05,-4.353842087e-05,-3.511066461e-05,
-	-1.917352711e-05,2.469865194e-06,2.765101817e-05,5.370237341e-05,7.799149171e-05,
-	9.790519834e-05,0.0001113401449,0.0001166722432,0.0001131291065,0.0001006466919,
-	8.009950398e-05,5.302010322e-05,2.175093141e-05,-1.098583562e-05,-4.187030572e-05,
-	-6.882050366e-05,-8.869176963e-05,-9.972067346e-05,-0.0001007794999,-9.154409781e-05,
-	-7.275176904e-05,-4.596616054e-05,-1.360781789e-05,2.139820208e-05, 5.57548301e-05,
-	8.622447785e-05,0.0001098013381,0.0001241222053,0.0001275572286,0.0001195264922,
-	0.0001004337755,7.185044524e-05,3.619572453e-05,-3.278320492e-06,-4.330830416e-05,
-	-7.983660907e-05,-0.0001095708503,-0.0001295692782,-0.0001377409644,-0.0001330812811,
-	-0.0001157524675,-8.709808026e-05,-4.956400153e-05,-6.449527064e-06,3.832588845e-05,
-	8.063861605e-05,0.0001164600035,0.0001423132344,0.0001555304043,0.0001546192798,
-	0.000139349635,0.0001108638753,7.149489829e-05,2.459357893e-05,-2.548828706e-05,
-	-7.424139767e-05,-0.0001171176045,-0.0001499199134,-0.0001694636885,-0.0001735725673,
-	-0.0001616150112,-0.0001342972973,-9.39107631e-05,-4.387084846e-05,1.129473003e-05,
-	6.661975203e-05,0.0001168744129,0.0001573381742,0.0001839703036,0.0001940920338,
-	0.0001863414655,0.0001611317566,0.0001203415595,6.762665726e-05,7.481032299e-06,
-	-5.453811536e-05,-0.0001127450232,-0.000161606149,-0.0001964262046,-0.0002136364928,
-	-0.0002113326045,-0.0001892835571,-0.0001492010197,-9.440160648e-05,-2.975711686e-05,
-	3.896112685e-05, 0.000105378509,0.0001633315842,0.0002072093048,0.0002327004477,
-	0.0002370053699,0.0002193643159,0.0001809876558,0.0001250314817,5.634601985e-05,
-	-1.885480924e-05,-9.378811228e-05,-0.0001613866771,-0.0002153072128,-0.000250189245,
-	-0.0002625013876,-0.0002505909652,-0.0002151845401,-0.0001590623579,-8.713213174e-05,
-	-5.71277269e-06,7.773149264e-05, 0.000155549511,0.0002203145996,0.0002658274898,
-	0.0002874308266,0.0002827646385,0.0002516575914,0.0001966261043,0.0001222754654,
-	3.521255348e-05,-5.673729538e-05,-0.0001450700074,-0.000221545808,-0.0002787865233,
-	-0.000311165466,-0.0003151736746,-0.0002899771789,-0.0002373440657,-0.0001617199159,
-	-6.967537774e-05,3.047426253e-05,0.0001295972179,0.0002184131881, 0.000288527779,
-	0.0003330493637,0.0003473951074,0.0003296916839,0.0002810460282,0.0002053833014,
-	0.0001093274841,1.391127739e-06,-0.0001085354816,-0.0002103165316,-0.0002942931897,
-	-0.0003523968044,-0.0003787283204,-0.0003703318653,-0.0003273383772,-0.0002531909849,
-	-0.000154207286,-3.920998643e-05,8.142925071e-05,0.0001965513075,0.0002953949152,
-	0.0003684365365,0.0004085114633,0.0004112747265,0.0003758669191,0.0003049132647,
-	0.0002044223656,8.322330541e-05,-4.774680929e-05,-0.0001764976623,-0.0002910029434,
-	-0.0003804001899,-0.0004359327722,-0.0004518906353,-0.0004261080467,-0.000360308215,
-	-0.0002599213622,-0.0001337185968,7.015964457e-06, 0.000149418498,0.0002802927629,
-	0.0003872845846,0.0004600505345,0.0004912479781,0.0004773206019,0.0004187864834,
-	0.0003203894885,0.0001905911486,4.096854173e-05,-0.000114921233,-0.0002626658243,
-	-0.0003884193138,-0.0004801116593,-0.000528688659,-0.0005289142136,-0.0004800020833,
-	-0.0003856780822,-0.0002539972193,-9.657697228e-05,7.234732038e-05,0.0002372912422,
-	0.000382821192,0.0004951251904,0.0005632172688,0.0005800630315,0.0005432725884,
-	0.0004554095503,0.0003238132631,0.0001600247488,-2.125777428e-05,-0.0002034502249,
-	-0.0003696477215,-0.0005041360273,-0.0005939251278,-0.0006299430388,-0.0006080009625,
-	-0.0005292067653,-0.0003999963519,-0.0002315612364,-3.894479232e-05,0.0001603357086,
-	0.0003478606232,0.0005060339463,0.0006196668255,0.0006775287329,0.0006733321934,
-	0.0006065181806,0.0004822851333,0.0003113015555,0.0001087003329,-0.0001071651932,
-	-0.0003164662339,-0.0004996259231,-0.0006392363575,-0.000721618766,-0.0007382485783,
-	-0.0006865266478,-0.0005702129565,-0.0003990833357,-0.0001882188662,4.344103581e-05,
-	0.0002746652171,0.0004839785979,0.0006515756832,0.0007612433401,0.0008018725784,
-	0.0007686312892,0.0006634389283,0.0004949728609,0.0002778789785,3.159878179e-05,
-	-0.0002214598062,-0.0004578612279,-0.0006554049323,-0.0007951057632,-0.0008631056407,
-	-0.0008519442636,-0.0007614568458,-0.0005987971672,-0.0003779756371,-0.000118586082,
-	0.000155837799,0.0004200662661,0.0006493472611,0.0008218711591,0.0009206885006,
-	0.000935505901,0.0008636073326,0.0007103561074,0.0004886971437,0.0002181945165,
-	-7.680746785e-05,-0.0003692475148,-0.0006319425302,-0.000839985325,-0.0009732240578,
-	-0.001018083538,-0.000969049288, -0.00082917494,-0.0006100774626,-0.000330848241,
-	-1.65191268e-05,0.0003042684111,0.0006017868291,0.0008480466786, 0.001019336516,
-	0.00109858904, 0.001076967572,0.0009549260722,0.0007421986666,0.0004571544705,
-	0.0001251153299,-0.0002237750741,-0.0005573863164,-0.0008444497944, -0.00105758186,
-	-0.001175779034,-0.001186575741,-0.001087245997,-0.0008852961473,-0.0005978337722,
-	-0.0002502475108, 0.000126154162,0.0004968173453,0.0008272342966, 0.001086026081,
-	0.001248021843, 0.001296590781, 0.001225421322, 0.001039179158,0.0007533439784,
-	0.0003928527876,-9.972810403e-06,-0.0004184034187,-0.0007945485995,-0.001102943788,
-	-0.001313801622,-0.001405960415,-0.001368893543,-0.001203951892,-0.0009243588429,
-	-0.0005542285508,-0.0001264657476, 0.000320107938, 0.000744306948, 0.001106316689,
-	0.001371471677, 0.001513497322, 0.001517155557, 0.001379780704, 0.001111796359,
-	0.0007359073497,0.0002852519101,-0.0001995507191,-0.0006739959936,-0.001093814964,
-	-0.001419042819,-0.001617839793,-0.001669553225,-0.001566868974,-0.001316661015,
-	-0.0009396659443,-0.0004687247856, 5.39937646e-05,0.0005808026181,  0.00106278318,
-	0.001454344136, 0.001717483858, 0.001825479441, 0.001765539055, 0.001540262369,
-	0.001167645329,0.0006797114038,0.0001197607198,-0.000461427815,-0.001010197448,
-	-0.001474918565,-0.001810849295,-0.001984391129,-0.001976422267,-0.001784342341,
-	-0.001422605827,-0.0009217056795,-0.000325634639,0.0003119509784,0.0009325231658,
-	0.001478041173, 0.001896331087, 0.002146057552, 0.002200753428, 0.002051574644,
-	0.001708450494, 0.001199531718,0.0005689191166,-0.0001271062501,-0.0008250782266,
-	-0.001460094238,-0.001971814316, -0.00231014099,  -0.0024401017,-0.002345363144,
-	-0.002030161209,-0.001519296784,-0.0008562752628,-9.963874618e-05, 0.000682148675,
-	0.001416852232, 0.002035088837, 0.002476832131, 0.002697175369, 0.002670832211,
-	0.002394891111, 0.001889582374, 0.001196895144,0.0003771683841,-0.000496119319,
-	-0.001342856558,-0.002083598403,-0.002646948677,-0.002976360731,-0.003035733942,
-	-0.002813228406,-0.002322923392,-0.001604130608,-0.0007183231646,0.0002560112043,
-	0.001230272464,   0.0021136906, 0.002821719274, 0.003284002189, 0.003451273311,
-	0.003300427925,  0.00283735618, 0.002097103512, 0.001141401823,5.361636067e-05,
-	-0.001068385202,-0.002120955847,-0.003004069673,-0.003630744061,-0.003935397603,
-	-0.003880566917,-0.003461115761,-0.002705661347,-0.001674854895,-0.0004567178839,
-	0.0008407371351, 0.002098881407, 0.003199166618, 0.004034055863, 0.004517350812,
-	0.004592781886, 0.004240191076, 0.003478499362, 0.002365262713,0.0009925663471,
-	-0.0005202991888,-0.002036974765,-0.003416016698,-0.004523797892,-0.005247083493,
-	-0.005504231434,-0.005253818352,-0.004499977455,-0.003293657908,-0.001729762065,
-	5.99553241e-05, 0.001917510526, 0.003672219114, 0.005155814346, 0.006218039431,
-	0.006741137244, 0.006652081385, 0.005931164604, 0.004616213962, 0.002801689552,
-	0.000632732641,-0.001705745235,-0.004003920127,-0.006044980139,-0.007624405902,
-	-0.008569194935,-0.008755140007,-0.008120707236,-0.006676020101,-0.004506031051,
-	-0.001767221023, 0.001322091208, 0.004497452173, 0.007468804251, 0.009944498539,
-	0.01165680215,  0.01238698605,  0.01198773645,  0.01040107943, 0.007669960614,
-	0.003942379728,-0.0005327378167,-0.005417911336,  -0.0103071956, -0.01475270465,
-	-0.01829587854, -0.02050118893, -0.02098993957, -0.01947144605, -0.01576933265,
-	-0.009840636514,-0.001786197303, 0.008148812689,  0.01958447322,  0.03202547878,
-	0.04488905892,  0.05753972754,  0.06932846457,  0.07963369042,  0.08790112287,
-	0.09367975593,  0.09665134549,  0.09665134549,  0.09367975593,  0.08790112287,
-	0.07963369042,  0.06932846457,  0.05753972754,  0.04488905892,  0.03202547878,
-	0.01958447322, 0.008148812689,-0.001786197303,-0.009840636514, -0.01576933265,
-	-0.01947144605, -0.02098993957, -0.02050118893, -0.01829587854, -0.01475270465,
-	-0.0103071956,-0.005417911336,-0.0005327378167, 0.003942379728, 0.007669960614,
-	0.01040107943,  0.01198773645,  0.01238698605,  0.01165680215, 0.009944498539,
-	0.007468804251, 0.004497452173, 0.001322091208,-0.001767221023,-0.004506031051,
-	-0.006676020101,-0.008120707236,-0.008755140007,-0.008569194935,-0.007624405902,
-	-0.006044980139,-0.004003920127,-0.001705745235, 0.000632732641, 0.002801689552,
-	0.004616213962, 0.005931164604, 0.006652081385, 0.006741137244, 0.006218039431,
-	0.005155814346, 0.003672219114, 0.001917510526, 5.99553241e-05,-0.001729762065,
-	-0.003293657908,-0.004499977455,-0.005253818352,-0.005504231434,-0.005247083493,
-	-0.004523797892,-0.003416016698,-0.002036974765,-0.0005202991888,0.0009925663471,
-	0.002365262713, 0.003478499362, 0.004240191076, 0.004592781886, 0.004517350812,
-	0.004034055863, 0.003199166618, 0.002098881407,0.0008407371351,-0.0004567178839,
-	-0.001674854895,-0.002705661347,-0.003461115761,-0.003880566917,-0.003935397603,
-	-0.003630744061,-0.003004069673,-0.002120955847,-0.001068385202,5.361636067e-05,
-	0.001141401823, 0.002097103512,  0.00283735618, 0.003300427925, 0.003451273311,
-	0.003284002189, 0.002821719274,   0.0021136906, 0.001230272464,0.0002560112043,
-	-0.0007183231646,-0.001604130608,-0.002322923392,-0.002813228406,-0.003035733942,
-	-0.002976360731,-0.002646948677,-0.002083598403,-0.001342856558,-0.000496119319,
-	0.0003771683841, 0.001196895144, 0.001889582374, 0.002394891111, 0.002670832211,
-	0.002697175369, 0.002476832131, 0.002035088837, 0.001416852232, 0.000682148675,
-	-9.963874618e-05,-0.0008562752628,-0.001519296784,-0.002030161209,-0.002345363144,
-	-0.0024401017, -0.00231014099,-0.001971814316,-0.001460094238,-0.0008250782266,
-	-0.0001271062501,0.0005689191166, 0.001199531718, 0.001708450494, 0.002051574644,
-	0.002200753428, 0.002146057552, 0.001896331087, 0.001478041173,0.0009325231658,
-	0.0003119509784,-0.000325634639,-0.0009217056795,-0.001422605827,-0.001784342341,
-	-0.001976422267,-0.001984391129,-0.001810849295,-0.001474918565,-0.001010197448,
-	-0.000461427815,0.0001197607198,0.0006797114038, 0.001167645329, 0.001540262369,
-	0.001765539055, 0.001825479441, 0.001717483858, 0.001454344136,  0.00106278318,
-	0.0005808026181, 5.39937646e-05,-0.0004687247856,-0.0009396659443,-0.001316661015,
-	-0.001566868974,-0.001669553225,-0.001617839793,-0.001419042819,-0.001093814964,
-	-0.0006739959936,-0.0001995507191,0.0002852519101,0.0007359073497, 0.001111796359,
-	0.001379780704, 0.001517155557, 0.001513497322, 0.001371471677, 0.001106316689,
-	0.000744306948, 0.000320107938,-0.0001264657476,-0.0005542285508,-0.0009243588429,
-	-0.001203951892,-0.001368893543,-0.001405960415,-0.001313801622,-0.001102943788,
-	-0.0007945485995,-0.0004184034187,-9.972810403e-06,0.0003928527876,0.0007533439784,
-	0.001039179158, 0.001225421322, 0.001296590781, 0.001248021843, 0.001086026081,
-	0.0008272342966,0.0004968173453, 0.000126154162,-0.0002502475108,-0.0005978337722,
-	-0.0008852961473,-0.001087245997,-0.001186575741,-0.001175779034, -0.00105758186,
-	-0.0008444497944,-0.0005573863164,-0.0002237750741,0.0001251153299,0.0004571544705,
-	0.0007421986666,0.0009549260722, 0.001076967572,  0.00109858904, 0.001019336516,
-	0.0008480466786,0.0006017868291,0.0003042684111,-1.65191268e-05,-0.000330848241,
-	-0.0006100774626, -0.00082917494,-0.000969049288,-0.001018083538,-0.0009732240578,
-	-0.000839985325,-0.0006319425302,-0.0003692475148,-7.680746785e-05,0.0002181945165,
-	0.0004886971437,0.0007103561074,0.0008636073326, 0.000935505901,0.0009206885006,
-	0.0008218711591,0.0006493472611,0.0004200662661, 0.000155837799,-0.000118586082,
-	-0.0003779756371,-0.0005987971672,-0.0007614568458,-0.0008519442636,-0.0008631056407,
-	-0.0007951057632,-0.0006554049323,-0.0004578612279,-0.0002214598062,3.159878179e-05,
-	0.0002778789785,0.0004949728609,0.0006634389283,0.0007686312892,0.0008018725784,
-	0.0007612433401,0.0006515756832,0.0004839785979,0.0002746652171,4.344103581e-05,
-	-0.0001882188662,-0.0003990833357,-0.0005702129565,-0.0006865266478,-0.0007382485783,
-	-0.000721618766,-0.0006392363575,-0.0004996259231,-0.0003164662339,-0.0001071651932,
-	0.0001087003329,0.0003113015555,0.0004822851333,0.0006065181806,0.0006733321934,
-	0.0006775287329,0.0006196668255,0.0005060339463,0.0003478606232,0.0001603357086,
-	-3.894479232e-05,-0.0002315612364,-0.0003999963519,-0.0005292067653,-0.0006080009625,
-	-0.0006299430388,-0.0005939251278,-0.0005041360273,-0.0003696477215,-0.0002034502249,
-	-2.125777428e-05,0.0001600247488,0.0003238132631,0.0004554095503,0.0005432725884,
-	0.0005800630315,0.0005632172688,0.0004951251904, 0.000382821192,0.0002372912422,
-	7.234732038e-05,-9.657697228e-05,-0.0002539972193,-0.0003856780822,-0.0004800020833,
-	-0.0005289142136,-0.000528688659,-0.0004801116593,-0.0003884193138,-0.0002626658243,
-	-0.000114921233,4.096854173e-05,0.0001905911486,0.0003203894885,0.0004187864834,
-	0.0004773206019,0.0004912479781,0.0004600505345,0.0003872845846,0.0002802927629,
-	0.000149418498,7.015964457e-06,-0.0001337185968,-0.0002599213622,-0.000360308215,
-	-0.0004261080467,-0.0004518906353,-0.0004359327722,-0.0003804001899,-0.0002910029434,
-	-0.0001764976623,-4.774680929e-05,8.322330541e-05,0.0002044223656,0.0003049132647,
-	0.0003758669191,0.0004112747265,0.0004085114633,0.0003684365365,0.0002953949152,
-	0.0001965513075,8.142925071e-05,-3.920998643e-05,-0.000154207286,-0.0002531909849,
-	-0.0003273383772,-0.0003703318653,-0.0003787283204,-0.0003523968044,-0.0002942931897,
-	-0.0002103165316,-0.0001085354816,1.391127739e-06,0.0001093274841,0.0002053833014,
-	0.0002810460282,0.0003296916839,0.0003473951074,0.0003330493637, 0.000288527779,
-	0.0002184131881,0.0001295972179,3.047426253e-05,-6.967537774e-05,-0.0001617199159,
-	-0.0002373440657,-0.0002899771789,-0.0003151736746,-0.000311165466,-0.0002787865233,
-	-0.000221545808,-0.0001450700074,-5.673729538e-05,3.521255348e-05,0.0001222754654,
-	0.0001966261043,0.0002516575914,0.0002827646385,0.0002874308266,0.0002658274898,
-	0.0002203145996, 0.000155549511,7.773149264e-05,-5.71277269e-06,-8.713213174e-05,
-	-0.0001590623579,-0.0002151845401,-0.0002505909652,-0.0002625013876,-0.000250189245,
-	-0.0002153072128,-0.0001613866771,-9.378811228e-05,-1.885480924e-05,5.634601985e-05,
-	0.0001250314817,0.0001809876558,0.0002193643159,0.0002370053699,0.0002327004477,
-	0.0002072093048,0.0001633315842, 0.000105378509,3.896112685e-05,-2.975711686e-05,
-	-9.440160648e-05,-0.0001492010197,-0.0001892835571,-0.0002113326045,-0.0002136364928,
-	-0.0001964262046,-0.000161606149,-0.0001127450232,-5.453811536e-05,7.481032299e-06,
-	6.762665726e-05,0.0001203415595,0.0001611317566,0.0001863414655,0.0001940920338,
-	0.0001839703036,0.0001573381742,0.0001168744129,6.661975203e-05,1.129473003e-05,
-	-4.387084846e-05,-9.39107631e-05,-0.0001342972973,-0.0001616150112,-0.0001735725673,
-	-0.0001694636885,-0.0001499199134,-0.0001171176045,-7.424139767e-05,-2.548828706e-05,
-	2.459357893e-05,7.149489829e-05,0.0001108638753, 0.000139349635,0.0001546192798,
-	0.0001555304043,0.0001423132344,0.0001164600035,8.063861605e-05,3.832588845e-05,
-	-6.449527064e-06,-4.956400153e-05,-8.709808026e-05,-0.0001157524675,-0.0001330812811,
-	-0.0001377409644,-0.0001295692782,-0.0001095708503,-7.983660907e-05,-4.330830416e-05,
-	-3.278320492e-06,3.619572453e-05,7.185044524e-05,0.0001004337755,0.0001195264922,
-	0.0001275572286,0.0001241222053,0.0001098013381,8.622447785e-05, 5.57548301e-05,
-	2.139820208e-05,-1.360781789e-05,-4.596616054e-05,-7.275176904e-05,-9.154409781e-05,
-	-0.0001007794999,-9.972067346e-05,-8.869176963e-05,-6.882050366e-05,-4.187030572e-05,
-	-1.098583562e-05,2.175093141e-05,5.302010322e-05,8.009950398e-05,0.0001006466919,
-	0.0001131291065,0.0001166722432,0.0001113401449,9.790519834e-05,7.799149171e-05,
-	5.370237341e-05,2.765101817e-05,2.469865194e-06,-1.917352711e-05,-3.511066461e-05,
-	-4.353842087e-05,-4.355686542e-05,-3.475742051e-05,-1.749089461e-05,5.380798029e-06,
-	3.495993224e-05,6.681338709e-05,9.871921793e-05,0.0001281749865,0.0001530190784,
-	0.0001713261445, 0.000181767653, 0.000183588083,0.0001767864742,0.0001620282128,
-	0.0001406469673,0.0001144627749,8.565576718e-05,5.653682092e-05,2.937795944e-05,
-	6.208534614e-06,-1.132004127e-05,-2.205422606e-05,-0.0007570767193
-};
+	if(interpolation == 1) {
+		// integer decimation -> one phase, an output every M inputs
+		qDebug("decimation by %llu", (unsigned long long)decimation);
+		phases = 1;
+		m_mode = ModeDecimate;
+	} else if((interpolation > 0) && (interpolation <= MaxRationalPhases)) {
+		qDebug("rational resampling %llu/%llu", (unsigned long long)interpolation, (unsigned long long)decimation);
+		phases = (int)interpolation;
+		m_mode = ModeRational;
+	} else {
+		// output blended linearly from the two nearest phases
+		if(phases < 2)
+			phases = 2;
+		m_mode = ModeLinear;
+	}
+	tapsPerPhase = (tapsPerPhase + 15) & ~15;
+	if(tapsPerPhase < 16)
+		tapsPerPhase = 16;
 
-static const float H11[1024] = {
-	0.0007952166488,0.0001165081558,0.0001110209851,9.526514623e-05,7.123197429e-05,
-	3.959187234e-05,3.935613677e-06,-3.389370249e-05,-6.963399937e-05,-0.0001013750953,
-	-0.0001252953371,-0.0001404728682,-0.0001444465452,-0.000138167612,-0.0001213210053,
-	-9.739617963e-05,-6.807966565e-05,-3.80798956e-05,-7.758098036e-06,1.598031668e-05,
-	3.281222598e-05,4.010536213e-05,3.739729436e-05,2.462884913e-05, 3.82209646e-06,
-	-2.324624438e-05,-5.269134635e-05,-8.17422042e-05,-0.0001061307194,-0.0001236842363,
-	-0.0001313445537,-0.0001287579071,-0.0001149310701,-9.197673353e-05,-6.139845937e-05,
-	-2.749931627e-05,7.414468655e-06,3.823437874e-05,6.223266973e-05,7.608749729e-05,
-	7.85639495e-05,6.864679744e-05,4.793168409e-05, 1.79010749e-05,-1.743160283e-05,
-	-5.484174471e-05,-8.924758004e-05,-0.0001173684941,-0.000135020091,-0.0001407220698,
-	-0.0001326370402,-0.0001120673842, -8.0193342e-05,-4.126238127e-05,1.504737043e-06,
-	4.259081106e-05,7.798949082e-05,0.0001030388958,0.0001153240737,0.0001125359559,
-	9.544551722e-05,6.496386777e-05,2.506129749e-05,-2.070168557e-05,-6.643063534e-05,
-	-0.0001076689514,-0.0001387992379,-0.0001568552398,-0.0001586685248,-0.0001443945948,
-	-0.0001144355047,-7.267158071e-05,-2.27125729e-05,2.928162576e-05,7.815792196e-05,
-	0.0001176955338,0.0001439541666,0.0001529370056, 0.000144072008,0.0001172155462,
-	7.586045103e-05,2.359146674e-05,-3.308627129e-05,-8.861794049e-05,-0.0001358449517,
-	-0.0001700332359,-0.0001862363133,-0.0001830037218,-0.0001594429632,-0.000118597156,
-	-6.39279242e-05,-2.031386202e-06,6.096431389e-05,0.0001172455595,0.0001611128391,
-	0.0001865541271,0.0001911501167,0.0001731516822,0.0001349840022,7.975830522e-05,
-	1.419328873e-05,-5.530439375e-05,-0.0001201170016,-0.0001736047125,-0.0002086929744,
-	-0.0002218373847,-0.0002102798608,-0.0001756257698,-0.0001205538938, -5.1615134e-05,
-	2.443254198e-05, 9.83541031e-05,0.0001625884906,0.0002088667825,0.0002324472152,
-	0.0002293990401,0.0002003844129,0.0001473836019,7.674042718e-05,-4.708659617e-06,
-	-8.714750584e-05,-0.0001620577095,-0.0002200243471,-0.000254970364,-0.0002616886632,
-	-0.0002396660275,-0.0001900694187,-0.0001187349262,-3.252023816e-05,5.830067676e-05,
-	0.0001443884394,0.0002151084773,0.0002630139643,0.0002814529871,0.0002686022199,
-	0.000224547417,0.0001544954139,6.508879596e-05,-3.313288471e-05,-0.0001300080912,
-	-0.0002137725241,-0.0002755118767,-0.0003070525709,-0.0003050533996,-0.0002683649655,
-	-0.0002012706245,-0.0001099988149,-5.235149274e-06,0.0001022421784, 0.000199537928,
-	0.000276284467,0.0003226606641,0.0003336633381,0.0003066495119,0.0002447782026,
-	0.0001536502823,4.381080362e-05,-7.342606841e-05,-0.0001841740159,-0.0002765814716,
-	-0.00033911629,-0.0003649433493,-0.0003497488215,-0.0002952974755,-0.0002062657295,
-	-9.289063019e-05,3.322811608e-05,0.0001572969777,0.0002660348546,0.0003461519664,
-	0.0003888530191,0.0003879273136, 0.000343480875,0.0002590465301,0.0001442169014,
-	1.070191956e-05,-0.0001259904384,-0.0002512237988,-0.0003499198356,-0.0004112095921,
-	-0.0004268015327,-0.0003949121456,-0.0003175833263,-0.0002035301586,-6.426989421e-05,
-	8.416205674e-05,0.0002258811001,0.0003440600121,0.0004256770189,0.0004601884866,
-	0.0004436313757,0.0003763129644,0.0002657047007,0.0001228641195,-3.589256448e-05,
-	-0.0001936187182,-0.0003317822702,-0.000435162161,-0.0004907995462,-0.0004923482775,
-	-0.0004380281316,-0.000333764794,-0.0001898103947,-2.24598607e-05,0.0001504574175,
-	0.0003088287776,0.0004352234246,0.0005141646834,0.0005366579862,0.0004985652631,
-	0.0004038909392,0.0002617203863,8.802820957e-05,-9.876672993e-05,-0.0002771126165,
-	-0.0004274171079,-0.000531572965,-0.0005777663901,-0.0005591724766,-0.0004775233683,
-	-0.0003403621668,-0.0001629404578, 3.60097838e-05,0.0002337188198,0.0004085081164,
-	0.0005396214547,0.0006122237537,0.0006165343802,0.0005516405217,0.0004231099156,
-	0.0002451003529,3.627590922e-05,-0.000179632756,-0.0003790164192,-0.0005384536926,
-	-0.0006399649428,-0.0006705365377,-0.0006262348616,-0.0005102530122,-0.0003351796186,
-	-0.0001192216441,0.0001132576654,0.0003369104234,0.0005257186131,0.0006584555376,
-	0.0007186315488,0.0006989495014,0.0005997496191,0.0004316091654,0.0002118108096,
-	-3.502390973e-05,-0.0002820799127,-0.0005008548032,-0.0006668290589,-0.0007598369266,
-	-0.0007688461919, -0.00069093192,-0.0005341324722,-0.0003143167414,-5.591909212e-05,
-	0.0002131038491,0.0004619481042,0.0006628128467,0.0007916822797,0.0008334930171,
-	0.0007815771969,0.0006409271737,0.0004254537635,0.0001589037565,-0.0001300192089,
-	-0.0004084670509,-0.0006454286631,-0.0008129394264,-0.000891585194,-0.0008705392247,
-	-0.0007512004231,-0.0005449370947,-0.0002742593351,3.186109097e-05,0.0003388510377,
-	0.0006126431981,0.0008212503744,0.0009406829486,0.0009555141442,0.0008629998774,
-	0.0006713577895,0.0004012334102,8.133961092e-05,-0.0002524415904,-0.0005631978856,
-	-0.0008149549831,-0.0009789176984,-0.001034671324,-0.000974776689,-0.0008036448271,
-	-0.0005394002073,-0.0002098733094,0.0001482291264,0.0004954665201,0.0007919438649,
-	0.001003929297, 0.001105650328, 0.001084414078,0.0009401676944, 0.000687779393,
-	0.000353519601,-2.565906652e-05,-0.0004081725201,-0.0007503903471,-0.001013555215,
-	-0.001166205271,-0.001189870527,-0.001079325913,-0.0008454293711,-0.0005121247959,
-	-0.0001159515668,0.0002998646232, 0.000688206288, 0.001005283673, 0.001213683281,
-	0.001288622385, 0.001219021273, 0.001010898151,0.0006850457285,0.0002768255072,
-	-0.0001694751991,-0.0006036187988,-0.0009768656455,-0.001245624386,-0.001378327142,
-	-0.001357312896,  -0.0011829125,-0.0008718583849,-0.0004574864579, 1.55629059e-05,
-	0.0004943978856,0.0009254942997, 0.001258952077, 0.001455951249, 0.001491550123,
-	0.001359492075, 0.001071467181, 0.000657830853,0.0001627597958,-0.0003587767715,
-	-0.0008487614105,-0.001250906149,-0.001518748468,-0.001619348535,  -0.0015389279,
-	-0.001283080899,-0.0008781191427,-0.0003668197023,0.0001944949181,0.0007436939632,
-	0.001218145713, 0.001563374535, 0.001737752347, 0.001719007618, 0.001505498425,
-	0.001118319458,0.0005977645633,6.662383498e-07,-0.0006072687684,-0.001157179708,
-	-0.001586298808,-0.001843620674, -0.00189736532,-0.001737433486,-0.001378396992,
-	-0.0008568434278,-0.0002290963312,0.0004362234904, 0.001064280514, 0.001583788311,
-	0.001933687367, 0.002071644645, 0.001977769891,  0.00165867433, 0.001145829912,
-	0.0004938679049,-0.0002265229705,-0.0009349000175,-0.001551315538,-0.002004008973,
-	-0.002238973277,-0.002225097036,-0.001959406072,-0.001466663787,-0.0007983975229,
-	-2.634438169e-05,0.0007639804971, 0.001483917818, 0.002050351119, 0.002396435011,
-	0.002478241688, 0.002281398978, 0.001822108286, 0.001147145987,0.0003280271194,
-	-0.0005453637568,-0.001375697553,-0.002067876281,-0.002540938789,-0.002736374969,
-	-0.002626329893,-0.002216291381,-0.001546308747,-0.0006861281581,0.0002709173132,
-	0.001219009631, 0.002050418407, 0.002668676898, 0.002998666372, 0.002996623982,
-	0.002654766664, 0.002004030161, 0.001110473997,6.966127694e-05, -0.00100440043,
-	-0.001990709687, -0.00277570053,-0.003265284002,-0.003396885935,-0.003146343632,
-	-0.002532529179,-0.001615381567,-0.0004911199794,0.0007185818395, 0.001878757379,
-	0.002856892999, 0.003537061391, 0.003834298812, 0.003704166273, 0.003149710828,
-	0.002221601084, 0.001014569192,-0.0003428256896,-0.001700925175,-0.002906010952,
-	-0.00381671777,-0.004321108572,-0.004349385388,-0.003883794416, -0.00296145957,
-	-0.001672656159,-0.0001515844633, 0.001436623628, 0.002914194716, 0.004109611269,
-	0.004877799191, 0.005116668995, 0.004780717194, 0.003887456143, 0.002518289024,
-	0.0008110204944,-0.001052979496,-0.002868152224,-0.004426324274,-0.005540579557,
-	-0.006066461559,-0.005920427851,-0.005091077182,-0.003643916221, -0.00171666604,
-	0.0004925917601, 0.002745503793, 0.004787831102, 0.006377651356, 0.007312453818,
-	0.007454047911, 0.006746557541, 0.005227096379, 0.003025805345,  0.00035654151,
-	-0.00250295666,-0.005238034297,-0.007530371193,-0.009092550725,-0.009701936506,
-	-0.009228609502,-0.007655597292,-0.005087393802,-0.001746620634, 0.002042798558,
-	0.005883629899, 0.009343462996,  0.01199841406,  0.01347938925,  0.01351525914,
-	0.01196946856, 0.008865062147, 0.004395992495,-0.001078112866, -0.00705313962,
-	-0.01291734166, -0.01800027676, -0.02163060941, -0.02319703996, -0.02220754139,
-	-0.01834077761, -0.01148527022, -0.00176175416,  0.01047334261,  0.02464475483,
-	0.03999424353,  0.05563327298,  0.07060798258,  0.08397142589,  0.09485673904,
-	0.1025452018,   0.1065231934,   0.1065231934,   0.1025452018,  0.09485673904,
-	0.08397142589,  0.07060798258,  0.05563327298,  0.03999424353,  0.02464475483,
-	0.01047334261, -0.00176175416, -0.01148527022, -0.01834077761, -0.02220754139,
-	-0.02319703996, -0.02163060941, -0.01800027676, -0.01291734166, -0.00705313962,
-	-0.001078112866, 0.004395992495, 0.008865062147,  0.01196946856,  0.01351525914,
-	0.01347938925,  0.01199841406, 0.009343462996, 0.005883629899, 0.002042798558,
-	-0.001746620634,-0.005087393802,-0.007655597292,-0.009228609502,-0.009701936506,
-	-0.009092550725,-0.007530371193,-0.005238034297, -0.00250295666,  0.00035654151,
-	0.003025805345, 0.005227096379, 0.006746557541, 0.007454047911, 0.007312453818,
-	0.006377651356, 0.004787831102, 0.002745503793,0.0004925917601, -0.00171666604,
-	-0.003643916221,-0.005091077182,-0.005920427851,-0.006066461559,-0.005540579557,
-	-0.004426324274,-0.002868152224,-0.001052979496,0.0008110204944, 0.002518289024,
-	0.003887456143, 0.004780717194, 0.005116668995, 0.004877799191, 0.004109611269,
-	0.002914194716, 0.001436623628,-0.0001515844633,-0.001672656159, -0.00296145957,
-	-0.003883794416,-0.004349385388,-0.004321108572, -0.00381671777,-0.002906010952,
-	-0.001700925175,-0.0003428256896, 0.001014569192, 0.002221601084, 0.003149710828,
-	0.003704166273, 0.003834298812, 0.003537061391, 0.002856892999, 0.001878757379,
-	0.0007185818395,-0.0004911199794,-0.001615381567,-0.002532529179,-0.003146343632,
-	-0.003396885935,-0.003265284002, -0.00277570053,-0.001990709687, -0.00100440043,
-	6.966127694e-05, 0.001110473997, 0.002004030161, 0.002654766664, 0.002996623982,
-	0.002998666372, 0.002668676898, 0.002050418407, 0.001219009631,0.0002709173132,
-	-0.0006861281581,-0.001546308747,-0.002216291381,-0.002626329893,-0.002736374969,
-	-0.002540938789,-0.002067876281,-0.001375697553,-0.0005453637568,0.0003280271194,
-	0.001147145987, 0.001822108286, 0.002281398978, 0.002478241688, 0.002396435011,
-	0.002050351119, 0.001483917818,0.0007639804971,-2.634438169e-05,-0.0007983975229,
-	-0.001466663787,-0.001959406072,-0.002225097036,-0.002238973277,-0.002004008973,
-	-0.001551315538,-0.0009349000175,-0.0002265229705,0.0004938679049, 0.001145829912,
-	0.00165867433, 0.001977769891, 0.002071644645, 0.001933687367, 0.001583788311,
-	0.001064280514,0.0004362234904,-0.0002290963312,-0.0008568434278,-0.001378396992,
-	-0.001737433486, -0.00189736532,-0.001843620674,-0.001586298808,-0.001157179708,
-	-0.0006072687684,6.662383498e-07,0.0005977645633, 0.001118319458, 0.001505498425,
-	0.001719007618, 0.001737752347, 0.001563374535, 0.001218145713,0.0007436939632,
-	0.0001944949181,-0.0003668197023,-0.0008781191427,-0.001283080899,  -0.0015389279,
-	-0.001619348535,-0.001518748468,-0.001250906149,-0.0008487614105,-0.0003587767715,
-	0.0001627597958, 0.000657830853, 0.001071467181, 0.001359492075, 0.001491550123,
-	0.001455951249, 0.001258952077,0.0009254942997,0.0004943978856, 1.55629059e-05,
-	-0.0004574864579,-0.0008718583849,  -0.0011829125,-0.001357312896,-0.001378327142,
-	-0.001245624386,-0.0009768656455,-0.0006036187988,-0.0001694751991,0.0002768255072,
-	0.0006850457285, 0.001010898151, 0.001219021273, 0.001288622385, 0.001213683281,
-	0.001005283673, 0.000688206288,0.0002998646232,-0.0001159515668,-0.0005121247959,
-	-0.0008454293711,-0.001079325913,-0.001189870527,-0.001166205271,-0.001013555215,
-	-0.0007503903471,-0.0004081725201,-2.565906652e-05, 0.000353519601, 0.000687779393,
-	0.0009401676944, 0.001084414078, 0.001105650328, 0.001003929297,0.0007919438649,
-	0.0004954665201,0.0001482291264,-0.0002098733094,-0.0005394002073,-0.0008036448271,
-	-0.000974776689,-0.001034671324,-0.0009789176984,-0.0008149549831,-0.0005631978856,
-	-0.0002524415904,8.133961092e-05,0.0004012334102,0.0006713577895,0.0008629998774,
-	0.0009555141442,0.0009406829486,0.0008212503744,0.0006126431981,0.0003388510377,
-	3.186109097e-05,-0.0002742593351,-0.0005449370947,-0.0007512004231,-0.0008705392247,
-	-0.000891585194,-0.0008129394264,-0.0006454286631,-0.0004084670509,-0.0001300192089,
-	0.0001589037565,0.0004254537635,0.0006409271737,0.0007815771969,0.0008334930171,
-	0.0007916822797,0.0006628128467,0.0004619481042,0.0002131038491,-5.591909212e-05,
-	-0.0003143167414,-0.0005341324722, -0.00069093192,-0.0007688461919,-0.0007598369266,
-	-0.0006668290589,-0.0005008548032,-0.0002820799127,-3.502390973e-05,0.0002118108096,
-	0.0004316091654,0.0005997496191,0.0006989495014,0.0007186315488,0.0006584555376,
-	0.0005257186131,0.0003369104234,0.0001132576654,-0.0001192216441,-0.0003351796186,
-	-0.0005102530122,-0.0006262348616,-0.0006705365377,-0.0006399649428,-0.0005384536926,
-	-0.0003790164192,-0.000179632756,3.627590922e-05,0.0002451003529,0.0004231099156,
-	0.0005516405217,0.0006165343802,0.0006122237537,0.0005396214547,0.0004085081164,
-	0.0002337188198, 3.60097838e-05,-0.0001629404578,-0.0003403621668,-0.0004775233683,
-	-0.0005591724766,-0.0005777663901,-0.000531572965,-0.0004274171079,-0.0002771126165,
-	-9.876672993e-05,8.802820957e-05,0.0002617203863,0.0004038909392,0.0004985652631,
-	0.0005366579862,0.0005141646834,0.0004352234246,0.0003088287776,0.0001504574175,
-	-2.24598607e-05,-0.0001898103947,-0.000333764794,-0.0004380281316,-0.0004923482775,
-	-0.0004907995462,-0.000435162161,-0.0003317822702,-0.0001936187182,-3.589256448e-05,
-	0.0001228641195,0.0002657047007,0.0003763129644,0.0004436313757,0.0004601884866,
-	0.0004256770189,0.0003440600121,0.0002258811001,8.416205674e-05,-6.426989421e-05,
-	-0.0002035301586,-0.0003175833263,-0.0003949121456,-0.0004268015327,-0.0004112095921,
-	-0.0003499198356,-0.0002512237988,-0.0001259904384,1.070191956e-05,0.0001442169014,
-	0.0002590465301, 0.000343480875,0.0003879273136,0.0003888530191,0.0003461519664,
-	0.0002660348546,0.0001572969777,3.322811608e-05,-9.289063019e-05,-0.0002062657295,
-	-0.0002952974755,-0.0003497488215,-0.0003649433493, -0.00033911629,-0.0002765814716,
-	-0.0001841740159,-7.342606841e-05,4.381080362e-05,0.0001536502823,0.0002447782026,
-	0.0003066495119,0.0003336633381,0.0003226606641, 0.000276284467, 0.000199537928,
-	0.0001022421784,-5.235149274e-06,-0.0001099988149,-0.0002012706245,-0.0002683649655,
-	-0.0003050533996,-0.0003070525709,-0.0002755118767,-0.0002137725241,-0.0001300080912,
-	-3.313288471e-05,6.508879596e-05,0.0001544954139, 0.000224547417,0.0002686022199,
-	0.0002814529871,0.0002630139643,0.0002151084773,0.0001443884394,5.830067676e-05,
-	-3.252023816e-05,-0.0001187349262,-0.0001900694187,-0.0002396660275,-0.0002616886632,
-	-0.000254970364,-0.0002200243471,-0.0001620577095,-8.714750584e-05,-4.708659617e-06,
-	7.674042718e-05,0.0001473836019,0.0002003844129,0.0002293990401,0.0002324472152,
-	0.0002088667825,0.0001625884906, 9.83541031e-05,2.443254198e-05, -5.1615134e-05,
-	-0.0001205538938,-0.0001756257698,-0.0002102798608,-0.0002218373847,-0.0002086929744,
-	-0.0001736047125,-0.0001201170016,-5.530439375e-05,1.419328873e-05,7.975830522e-05,
-	0.0001349840022,0.0001731516822,0.0001911501167,0.0001865541271,0.0001611128391,
-	0.0001172455595,6.096431389e-05,-2.031386202e-06,-6.39279242e-05,-0.000118597156,
-	-0.0001594429632,-0.0001830037218,-0.0001862363133,-0.0001700332359,-0.0001358449517,
-	-8.861794049e-05,-3.308627129e-05,2.359146674e-05,7.586045103e-05,0.0001172155462,
-	0.000144072008,0.0001529370056,0.0001439541666,0.0001176955338,7.815792196e-05,
-	2.928162576e-05,-2.27125729e-05,-7.267158071e-05,-0.0001144355047,-0.0001443945948,
-	-0.0001586685248,-0.0001568552398,-0.0001387992379,-0.0001076689514,-6.643063534e-05,
-	-2.070168557e-05,2.506129749e-05,6.496386777e-05,9.544551722e-05,0.0001125359559,
-	0.0001153240737,0.0001030388958,7.798949082e-05,4.259081106e-05,1.504737043e-06,
-	-4.126238127e-05, -8.0193342e-05,-0.0001120673842,-0.0001326370402,-0.0001407220698,
-	-0.000135020091,-0.0001173684941,-8.924758004e-05,-5.484174471e-05,-1.743160283e-05,
-	1.79010749e-05,4.793168409e-05,6.864679744e-05, 7.85639495e-05,7.608749729e-05,
-	6.223266973e-05,3.823437874e-05,7.414468655e-06,-2.749931627e-05,-6.139845937e-05,
-	-9.197673353e-05,-0.0001149310701,-0.0001287579071,-0.0001313445537,-0.0001236842363,
-	-0.0001061307194,-8.17422042e-05,-5.269134635e-05,-2.324624438e-05, 3.82209646e-06,
-	2.462884913e-05,3.739729436e-05,4.010536213e-05,3.281222598e-05,1.598031668e-05,
-	-7.758098036e-06,-3.80798956e-05,-6.807966565e-05,-9.739617963e-05,-0.0001213210053,
-	-0.000138167612,-0.0001444465452,-0.0001404728682,-0.0001252953371,-0.0001013750953,
-	-6.963399937e-05,-3.389370249e-05,3.935613677e-06,3.959187234e-05,7.123197429e-05,
-	9.526514623e-05,0.0001110209851,0.0001165081558,0.0007952166488
-};
+	double cutoff = designCutoff(inputRate, minRate, tapsPerPhase) / inputRate;
 
-static const float H12[1024] = {
-	-0.0002808560675,-0.0007872336428,3.173635923e-05,-0.0002443848643,-0.0001306293416,
-	-0.0001346379868,-8.682748012e-05,-4.913835073e-05,-6.407876299e-06,3.091301187e-05,
-	6.05210771e-05,7.938630733e-05,8.534504013e-05,7.889192784e-05, 6.07021866e-05,
-	3.42966996e-05, 2.76230594e-06,-2.877614133e-05,-5.668793528e-05,-7.641960838e-05,
-	-8.595125837e-05,-8.32006408e-05,-6.913315156e-05,-4.482271834e-05,-1.417003023e-05,
-	1.942641575e-05,5.065478035e-05,7.586043648e-05,9.071826207e-05,9.371602937e-05,
-	8.353152953e-05,6.207636034e-05,3.134787039e-05,-3.981767804e-06,-4.000540139e-05,
-	-7.114464825e-05,-9.369671898e-05,-0.0001035386449,-9.970951214e-05,-8.183355385e-05,
-	-5.28970013e-05,-1.585228893e-05,2.395542833e-05,6.199585187e-05,9.213076555e-05,
-	0.0001105930423,0.0001140773456,0.0001027741891,7.699611888e-05, 4.02666119e-05,
-	-3.21993366e-06,-4.665879169e-05,-8.511097985e-05,-0.0001128722724,-0.0001262736914,
-	-0.0001222550927,-0.0001021660355,-6.763119018e-05,-2.320790009e-05, 2.56977637e-05,
-	7.161207031e-05,0.0001095159023,0.0001332288812,0.0001394919964,0.0001269024942,
-	9.734896594e-05,5.331677676e-05,1.711502136e-06,-5.151812729e-05,-9.892950766e-05,
-	-0.0001340813615,-0.0001516051852,-0.0001495972974,-0.0001265998435,-8.656515274e-05,
-	-3.363839642e-05,2.488383143e-05,8.132037328e-05,0.0001279300923, 0.000158628085,
-	0.0001679896959,0.0001555474737,0.0001211479394,7.025249943e-05,8.487276318e-06,
-	-5.562053411e-05,-0.0001136192805,-0.0001575122442,-0.0001810973918,-0.0001804997009,
-	-0.0001559964294,-0.0001093417595,-4.766791608e-05,2.253403727e-05,9.026773478e-05,
-	0.0001479655912,0.0001862433855,0.0002007957519,0.0001880352356, 0.000149999003,
-	9.073004912e-05,1.823742605e-05,-5.837767094e-05,-0.0001285303297,-0.0001827913948,
-	-0.000213433872,-0.0002160407894,-0.000189436847,-0.0001368261874,-6.466754712e-05,
-	1.750254705e-05,9.911286179e-05,0.0001687794283,0.0002171702799,0.0002371273731,
-	0.0002256716107,0.0001833183778,0.0001156351937,3.091069448e-05,-5.947364116e-05,
-	-0.0001437372557,-0.0002100103447,-0.0002494931396,-0.0002558970009,-0.0002280413901,
-	-0.0001687763579,-8.583917952e-05,1.047551177e-05,0.0001069474092,0.0001910129504,
-	0.0002507453028,0.0002779122151,0.0002679323952,0.0002219053276,0.0001448537223,
-	4.704218372e-05,-5.908271487e-05,-0.0001590581087,-0.0002395710762,-0.0002890821488,
-	-0.0003007975756,-0.0002719230251,-0.0002060741826,-0.0001111162419,4.029978982e-07,
-	0.0001140318564,0.0002141629229,0.0002874381316,0.0003230339207,0.0003159896296,
-	0.0002660525788,0.0001794805721,6.705513806e-05,-5.626140774e-05,-0.0001743517205,
-	-0.0002708425745,-0.000332768861,-0.0003506934736,-0.000321918109,-0.0002490883635,
-	-0.0001415196894,-1.289385091e-05, 0.000119578981,0.0002384002582,0.0003270051093,
-	0.0003732858167,0.0003698285727,0.0003167246177,0.0002198171278,9.177363972e-05,
-	-5.094366497e-05,-0.0001891527791,-0.000304359186,-0.0003804175358,-0.0004066186084,
-	-0.000378348399,-0.000298822677,-0.000177441354,-3.033406938e-05,0.0001235794771,
-	0.0002632504038,0.0003699760418,0.0004284958704,0.0004304170434,0.0003742788103,
-	0.0002668285742,0.0001215985394,-4.238374822e-05,-0.0002034943609,-0.000339765742,
-	-0.0004326444177,-0.0004686489701,-0.0004422683269,-0.0003556987213,-0.0002199936716,
-	-5.215693818e-05,0.0001252263464,0.0002888769959,0.0004161063407,0.0004895862076,
-	0.0004980880185,0.0004398703459,0.0003212355659,0.0001575823262,-3.014112735e-05,
-	-0.000216696877,-0.000377243472,-0.0004894210142,-0.0005376718473,-0.000514099549,
-	-0.0004210309708, -0.00026963852,-7.959925279e-05,0.0001243661536,0.0003147142997,
-	0.000465889636,0.0005565928295,0.0005739141488,0.0005140838912,0.0003841661965,
-	0.0002003343689,-1.331188651e-05,-0.0002287091775,-0.000416579016,-0.0005514685763,
-	-0.0006141134654,-0.0005951356725,-0.0004955967888,-0.000327829126,-0.0001131457393,
-	0.0001200635888,0.0003409197088,0.0005192151293,0.0006305258139,0.0006585497758,
-	0.000598406361,0.0004566561256,0.0002512446081,8.656595128e-06,-0.0002387912682,
-	-0.0004580793611,-0.0006190012791,-0.0006991939736,-0.0006863562157,-0.000580976659,
-	-0.0003956148576,-0.0001541358215, 0.000111941692,0.0003670299775,0.0005767623079,
-	0.0007119742222,0.0007535346085,0.0006941403262, 0.000540414243,0.0003114259453,
-	3.701887545e-05,-0.0002467302256,-0.0005016013747,-0.0006929354277,-0.0007938516792,
-	-0.0007894975133,-0.0006786403246,-0.0004747713974,-0.0002036691149,9.895702533e-05,
-	0.0003930575622,0.0006387039321,0.0008022073889,0.0008601283771,0.0008031737525,
-	0.0006370933261,0.0003826633329,7.271614595e-05,-0.0002517853281,-0.0005474857171,
-	-0.0007739486173,-0.0008997765253,-0.0009062639438,-0.0007908937987,-0.0005671047256,
-	-0.0002635545097,8.030606114e-05,0.0004185953003,0.0007058437914,0.0009024061146,
-	0.0009805313312,0.0009277652716,0.0007492339355,0.0004669718037,0.0001174571371,
-	-0.0002533663646,-0.0005958060501,-0.0008633576799,-0.001018756418,-0.001039394527,
-	-0.0009203043883,-0.0006754275528,-0.0003356784873,5.451995094e-05,0.0004435718583,
-	0.0007788819494, 0.001014606794,  0.00111728278,  0.00107112492,0.0008798803319,
-	0.0005671783001,0.0001730483054,-0.0002505135199,-0.000647085777,-0.0009626774117,
-	-0.001153640798, -0.00119212782,-0.001070694998,-0.0008030189783,-0.0004229748156,
-	2.018079613e-05,0.0004675747477,0.0008592000231, 0.001141230576, 0.001274077105,
-	0.001237318735, 0.001033317065,0.0006867555203, 0.000242154958,-0.0002423217084,
-	-0.0007018679753,-0.001074346015,-0.001308007748,-0.001369278296,-0.001246950473,
-	-0.0009546748479,-0.000528918521,-2.498966023e-05,0.0004906053655,0.0009484658949,
-	0.001286104089, 0.001455877325, 0.001432329067, 0.001215266995,0.0008308911347,
-	0.0003280770907,-0.0002272561396,-0.0007612765767,-0.001201547915,-0.001487307018,
-	-0.001577306772, -0.00145627209,-0.001136820531,-0.0006587889511,-8.375097241e-05,
-	0.0005122773, 0.001049483428, 0.001454328652, 0.001670100726, 0.001664364594,
-	0.001434172387, 0.001006574486, 0.000435884227,-0.0002035763755,-0.0008266980876,
-	-0.001349329599,-0.001699116779,-0.001826021937,-0.001708832919,-0.001359181828,
-	-0.0008199058939,-0.0001604831632,0.0005325095844, 0.001166109578, 0.001653916552,
-	0.001927448553, 0.001946006669, 0.001702332171, 0.001224575797,0.0005727394018,
-	-0.0001683975715,-0.0009006633773,-0.001525035943,-0.001955411397,-0.002129971515,
-	-0.002020485466, -0.00163616694,-0.001023766119, -0.00026134582,0.0005509839975,
-	0.00130478316, 0.001897084061, 0.002244962612, 0.002296583261, 0.002039220883,
-	0.001501369057,0.0007500967477,-0.0001176276055,-0.0009869901696,-0.001740786945,
-	-0.002274890197,-0.002512781881,-0.002416172531,-0.001991222845,-0.001288340543,
-	-0.0003966358199,0.0005676324363, 0.001475765021, 0.002204066841, 0.002650256967,
-	0.002748056315, 0.002476572059, 0.001864382066,0.0009865303291,-4.431484558e-05,
-	-0.001092493418,-0.002016751096,-0.002689545741,-0.003014127025,-0.002938675694,
-	-0.00246396102,-0.001644767355,-0.0005835062475,0.0005821667146, 0.001697364147,
-	0.002610106254, 0.003192167962, 0.003356607864, 0.003070866689, 0.002362117404,
-	0.00131546089,6.362150452e-05,-0.001229419722,-0.002390012378,-0.003257667646,
-	-0.003707300872, -0.00366676203,-0.003128241282,-0.002150759799,-0.0008543969598,
-	0.0005945540615, 0.002004335402,  0.00318315113, 0.003964691423,  0.00423156051,
-	0.003932210617, 0.003090140643, 0.001802673098, 0.000230392805,-0.001422813511,
-	-0.002935580909,-0.004098613281,-0.004742855672,-0.004763998091,-0.004138161428,
-	-0.002928219037,-0.001277868054,0.0006045771297, 0.002472285181, 0.004071483389,
-	0.005175514612, 0.005616151728, 0.005308496766, 0.004265352152, 0.002599409781,
-	0.0005117512192,-0.001731411554,-0.003832126036,-0.005499148741,-0.006487539504,
-	-0.006633182988, -0.00587861659,-0.004285051953,-0.002029856201,0.0006122126943,
-	0.003300906857, 0.005673123989,   0.0073901047, 0.008184041828, 0.007897293195,
-	0.006509263534, 0.004146393389, 0.001073481981,-0.002333822893,-0.005632316694,
-	-0.008366108872, -0.01012600306, -0.01060657296,-0.009652904235,-0.007291181944,
-	-0.003737361403, 0.000617331767, 0.005244871601, 0.009538265876,  0.01288402732,
-	0.01474009082,  0.01471108664,  0.01261091419, 0.008504916914, 0.002725048689,
-	-0.004144940991, -0.01131484378, -0.01785974391,  -0.0228121765,  -0.0252647195,
-	-0.02447278053, -0.01994575001, -0.01151644345,0.0006199135096,  0.01590222865,
-	0.03343753889,  0.05206998065,   0.0704786554,  0.08729488403,   0.1012274474,
-	0.1111828685,   0.1163686439,   0.1163686439,   0.1111828685,   0.1012274474,
-	0.08729488403,   0.0704786554,  0.05206998065,  0.03343753889,  0.01590222865,
-	0.0006199135096, -0.01151644345, -0.01994575001, -0.02447278053,  -0.0252647195,
-	-0.0228121765, -0.01785974391, -0.01131484378,-0.004144940991, 0.002725048689,
-	0.008504916914,  0.01261091419,  0.01471108664,  0.01474009082,  0.01288402732,
-	0.009538265876, 0.005244871601, 0.000617331767,-0.003737361403,-0.007291181944,
-	-0.009652904235, -0.01060657296, -0.01012600306,-0.008366108872,-0.005632316694,
-	-0.002333822893, 0.001073481981, 0.004146393389, 0.006509263534, 0.007897293195,
-	0.008184041828,   0.0073901047, 0.005673123989, 0.003300906857,0.0006122126943,
-	-0.002029856201,-0.004285051953, -0.00587861659,-0.006633182988,-0.006487539504,
-	-0.005499148741,-0.003832126036,-0.001731411554,0.0005117512192, 0.002599409781,
-	0.004265352152, 0.005308496766, 0.005616151728, 0.005175514612, 0.004071483389,
-	0.002472285181,0.0006045771297,-0.001277868054,-0.002928219037,-0.004138161428,
-	-0.004763998091,-0.004742855672,-0.004098613281,-0.002935580909,-0.001422813511,
-	0.000230392805, 0.001802673098, 0.003090140643, 0.003932210617,  0.00423156051,
-	0.003964691423,  0.00318315113, 0.002004335402,0.0005945540615,-0.0008543969598,
-	-0.002150759799,-0.003128241282, -0.00366676203,-0.003707300872,-0.003257667646,
-	-0.002390012378,-0.001229419722,6.362150452e-05,  0.00131546089, 0.002362117404,
-	0.003070866689, 0.003356607864, 0.003192167962, 0.002610106254, 0.001697364147,
-	0.0005821667146,-0.0005835062475,-0.001644767355, -0.00246396102,-0.002938675694,
-	-0.003014127025,-0.002689545741,-0.002016751096,-0.001092493418,-4.431484558e-05,
-	0.0009865303291, 0.001864382066, 0.002476572059, 0.002748056315, 0.002650256967,
-	0.002204066841, 0.001475765021,0.0005676324363,-0.0003966358199,-0.001288340543,
-	-0.001991222845,-0.002416172531,-0.002512781881,-0.002274890197,-0.001740786945,
-	-0.0009869901696,-0.0001176276055,0.0007500967477, 0.001501369057, 0.002039220883,
-	0.002296583261, 0.002244962612, 0.001897084061,  0.00130478316,0.0005509839975,
-	-0.00026134582,-0.001023766119, -0.00163616694,-0.002020485466,-0.002129971515,
-	-0.001955411397,-0.001525035943,-0.0009006633773,-0.0001683975715,0.0005727394018,
-	0.001224575797, 0.001702332171, 0.001946006669, 0.001927448553, 0.001653916552,
-	0.001166109578,0.0005325095844,-0.0001604831632,-0.0008199058939,-0.001359181828,
-	-0.001708832919,-0.001826021937,-0.001699116779,-0.001349329599,-0.0008266980876,
-	-0.0002035763755, 0.000435884227, 0.001006574486, 0.001434172387, 0.001664364594,
-	0.001670100726, 0.001454328652, 0.001049483428,   0.0005122773,-8.375097241e-05,
-	-0.0006587889511,-0.001136820531, -0.00145627209,-0.001577306772,-0.001487307018,
-	-0.001201547915,-0.0007612765767,-0.0002272561396,0.0003280770907,0.0008308911347,
-	0.001215266995, 0.001432329067, 0.001455877325, 0.001286104089,0.0009484658949,
-	0.0004906053655,-2.498966023e-05,-0.000528918521,-0.0009546748479,-0.001246950473,
-	-0.001369278296,-0.001308007748,-0.001074346015,-0.0007018679753,-0.0002423217084,
-	0.000242154958,0.0006867555203, 0.001033317065, 0.001237318735, 0.001274077105,
-	0.001141230576,0.0008592000231,0.0004675747477,2.018079613e-05,-0.0004229748156,
-	-0.0008030189783,-0.001070694998, -0.00119212782,-0.001153640798,-0.0009626774117,
-	-0.000647085777,-0.0002505135199,0.0001730483054,0.0005671783001,0.0008798803319,
-	0.00107112492,  0.00111728278, 0.001014606794,0.0007788819494,0.0004435718583,
-	5.451995094e-05,-0.0003356784873,-0.0006754275528,-0.0009203043883,-0.001039394527,
-	-0.001018756418,-0.0008633576799,-0.0005958060501,-0.0002533663646,0.0001174571371,
-	0.0004669718037,0.0007492339355,0.0009277652716,0.0009805313312,0.0009024061146,
-	0.0007058437914,0.0004185953003,8.030606114e-05,-0.0002635545097,-0.0005671047256,
-	-0.0007908937987,-0.0009062639438,-0.0008997765253,-0.0007739486173,-0.0005474857171,
-	-0.0002517853281,7.271614595e-05,0.0003826633329,0.0006370933261,0.0008031737525,
-	0.0008601283771,0.0008022073889,0.0006387039321,0.0003930575622,9.895702533e-05,
-	-0.0002036691149,-0.0004747713974,-0.0006786403246,-0.0007894975133,-0.0007938516792,
-	-0.0006929354277,-0.0005016013747,-0.0002467302256,3.701887545e-05,0.0003114259453,
-	0.000540414243,0.0006941403262,0.0007535346085,0.0007119742222,0.0005767623079,
-	0.0003670299775, 0.000111941692,-0.0001541358215,-0.0003956148576,-0.000580976659,
-	-0.0006863562157,-0.0006991939736,-0.0006190012791,-0.0004580793611,-0.0002387912682,
-	8.656595128e-06,0.0002512446081,0.0004566561256, 0.000598406361,0.0006585497758,
-	0.0006305258139,0.0005192151293,0.0003409197088,0.0001200635888,-0.0001131457393,
-	-0.000327829126,-0.0004955967888,-0.0005951356725,-0.0006141134654,-0.0005514685763,
-	-0.000416579016,-0.0002287091775,-1.331188651e-05,0.0002003343689,0.0003841661965,
-	0.0005140838912,0.0005739141488,0.0005565928295, 0.000465889636,0.0003147142997,
-	0.0001243661536,-7.959925279e-05, -0.00026963852,-0.0004210309708,-0.000514099549,
-	-0.0005376718473,-0.0004894210142,-0.000377243472,-0.000216696877,-3.014112735e-05,
-	0.0001575823262,0.0003212355659,0.0004398703459,0.0004980880185,0.0004895862076,
-	0.0004161063407,0.0002888769959,0.0001252263464,-5.215693818e-05,-0.0002199936716,
-	-0.0003556987213,-0.0004422683269,-0.0004686489701,-0.0004326444177,-0.000339765742,
-	-0.0002034943609,-4.238374822e-05,0.0001215985394,0.0002668285742,0.0003742788103,
-	0.0004304170434,0.0004284958704,0.0003699760418,0.0002632504038,0.0001235794771,
-	-3.033406938e-05,-0.000177441354,-0.000298822677,-0.000378348399,-0.0004066186084,
-	-0.0003804175358,-0.000304359186,-0.0001891527791,-5.094366497e-05,9.177363972e-05,
-	0.0002198171278,0.0003167246177,0.0003698285727,0.0003732858167,0.0003270051093,
-	0.0002384002582, 0.000119578981,-1.289385091e-05,-0.0001415196894,-0.0002490883635,
-	-0.000321918109,-0.0003506934736,-0.000332768861,-0.0002708425745,-0.0001743517205,
-	-5.626140774e-05,6.705513806e-05,0.0001794805721,0.0002660525788,0.0003159896296,
-	0.0003230339207,0.0002874381316,0.0002141629229,0.0001140318564,4.029978982e-07,
-	-0.0001111162419,-0.0002060741826,-0.0002719230251,-0.0003007975756,-0.0002890821488,
-	-0.0002395710762,-0.0001590581087,-5.908271487e-05,4.704218372e-05,0.0001448537223,
-	0.0002219053276,0.0002679323952,0.0002779122151,0.0002507453028,0.0001910129504,
-	0.0001069474092,1.047551177e-05,-8.583917952e-05,-0.0001687763579,-0.0002280413901,
-	-0.0002558970009,-0.0002494931396,-0.0002100103447,-0.0001437372557,-5.947364116e-05,
-	3.091069448e-05,0.0001156351937,0.0001833183778,0.0002256716107,0.0002371273731,
-	0.0002171702799,0.0001687794283,9.911286179e-05,1.750254705e-05,-6.466754712e-05,
-	-0.0001368261874,-0.000189436847,-0.0002160407894,-0.000213433872,-0.0001827913948,
-	-0.0001285303297,-5.837767094e-05,1.823742605e-05,9.073004912e-05, 0.000149999003,
-	0.0001880352356,0.0002007957519,0.0001862433855,0.0001479655912,9.026773478e-05,
-	2.253403727e-05,-4.766791608e-05,-0.0001093417595,-0.0001559964294,-0.0001804997009,
-	-0.0001810973918,-0.0001575122442,-0.0001136192805,-5.562053411e-05,8.487276318e-06,
-	7.025249943e-05,0.0001211479394,0.0001555474737,0.0001679896959, 0.000158628085,
-	0.0001279300923,8.132037328e-05,2.488383143e-05,-3.363839642e-05,-8.656515274e-05,
-	-0.0001265998435,-0.0001495972974,-0.0001516051852,-0.0001340813615,-9.892950766e-05,
-	-5.151812729e-05,1.711502136e-06,5.331677676e-05,9.734896594e-05,0.0001269024942,
-	0.0001394919964,0.0001332288812,0.0001095159023,7.161207031e-05, 2.56977637e-05,
-	-2.320790009e-05,-6.763119018e-05,-0.0001021660355,-0.0001222550927,-0.0001262736914,
-	-0.0001128722724,-8.511097985e-05,-4.665879169e-05,-3.21993366e-06, 4.02666119e-05,
-	7.699611888e-05,0.0001027741891,0.0001140773456,0.0001105930423,9.213076555e-05,
-	6.199585187e-05,2.395542833e-05,-1.585228893e-05,-5.28970013e-05,-8.183355385e-05,
-	-9.970951214e-05,-0.0001035386449,-9.369671898e-05,-7.114464825e-05,-4.000540139e-05,
-	-3.981767804e-06,3.134787039e-05,6.207636034e-05,8.353152953e-05,9.371602937e-05,
-	9.071826207e-05,7.586043648e-05,5.065478035e-05,1.942641575e-05,-1.417003023e-05,
-	-4.482271834e-05,-6.913315156e-05,-8.32006408e-05,-8.595125837e-05,-7.641960838e-05,
-	-5.668793528e-05,-2.877614133e-05, 2.76230594e-06, 3.42966996e-05, 6.07021866e-05,
-	7.889192784e-05,8.534504013e-05,7.938630733e-05, 6.05210771e-05,3.091301187e-05,
-	-6.407876299e-06,-4.913835073e-05,-8.682748012e-05,-0.0001346379868,-0.0001306293416,
-	-0.0002443848643,3.173635923e-05,-0.0007872336428,-0.0002808560675
-};
+	// init state
+	double distance = 1.0;
+	if(outputRate > 0.0)
+		distance = inputRate / outputRate;
+	m_step = (quint64)llround(distance * FixedPointOne);
+	if(m_step == 0)
+		m_step = 1;
+	m_position = m_step;
+	qDebug("interpolator distance %f", distance);
+	m_phases = phases;
+	m_nTaps = tapsPerPhase;
+	// the window of phase 0 folded reaches one sample further back, see doInterpolateSymmetric()
+	m_historyKeep = m_nTaps + 1;
+	selectKernels();
+	m_historyI.assign(m_historyKeep + HistoryChunk, 0);
+	m_historyQ.assign(m_historyKeep + HistoryChunk, 0);
 
-static const float H13[1024] = {
-	-0.0001201797568,0.0007891110727,0.0002753733133,0.0002028695599,0.0001803526684,
-	0.0001530983573,0.0001150344251,6.991768169e-05,2.227704863e-05,-2.156572555e-05,
-	-5.700354086e-05,-7.930647553e-05,-8.682721091e-05,-7.873326831e-05,-5.765895548e-05,
-	-2.681901788e-05,7.950244253e-06,4.156300201e-05,6.793666398e-05, 8.34300663e-05,
-	8.488017193e-05,7.262175495e-05,4.791123865e-05,1.527944733e-05,-2.071717972e-05,
-	-5.364829849e-05,-7.878956967e-05,-9.130224498e-05,-8.960731793e-05,-7.305718464e-05,
-	-4.469522901e-05,-8.173182323e-06,3.013873538e-05,6.481810124e-05, 8.95369667e-05,
-	0.0001008105755,9.581708582e-05,7.570081652e-05,4.259546404e-05,2.249377985e-06,
-	-3.980763358e-05,-7.608484157e-05,-0.0001014532754,-0.0001107366625,-0.0001030119456,
-	-7.813228876e-05,-4.081443694e-05,4.479415566e-06, 4.95046952e-05,8.803432138e-05,
-	0.0001136621358,0.0001210577102,0.0001103513423,8.143886953e-05,3.824717714e-05,
-	-1.159201474e-05,-6.053321704e-05,-0.0001009467087,-0.0001265551546,-0.0001324616605,
-	-0.0001175455764,-8.339300257e-05,-3.539980753e-05, 1.94842396e-05,7.230929623e-05,
-	0.0001150325552,0.0001402363705,0.0001439320476,0.0001246419706,8.533721848e-05,
-	3.139878027e-05,-2.850688907e-05,-8.542284922e-05,-0.0001298183342,-0.0001547952561,
-	-0.0001555314666,-0.0001318099821,-8.64337635e-05,-2.656760989e-05,3.902253229e-05,
-	9.961415344e-05,0.0001459059422, 0.000169816587,0.0001674988453,0.0001383465133,
-	8.684078057e-05,2.027390292e-05,-5.070106272e-05,-0.0001153174744,-0.0001627961174,
-	-0.0001856341842,-0.0001793177507,-0.0001445904199,-8.605257608e-05,-1.276780222e-05,
-	6.413264055e-05,0.0001323792239,0.0001810408867,0.0002018719679,0.0001912753942,
-	0.0001497694029,8.411314047e-05,3.356896286e-06,-7.930943684e-05,-0.0001512133749,
-	-0.0002004593116,-0.0002192323736,-0.0002032595512,-0.0001549424487,-8.095810335e-05,
-	7.015829397e-06, 9.58752571e-05,0.0001710712677,0.0002208374353,0.0002363011299,
-	0.0002148204658,0.0001586356957,7.644365542e-05,-1.968350989e-05,-0.0001143171394,
-	-0.0001928690763,-0.0002421240933,-0.0002541571448,-0.0002259076864,-0.0001615315268,
-	-7.011194248e-05, 3.39333892e-05,0.0001347827056,0.0002159544092,0.0002646414796,
-	0.0002720860357,0.0002367587294,0.0001630346378,6.230772124e-05,-5.037653682e-05,
-	-0.0001569543092,-0.0002408340079,-0.0002878789383,-0.0002903699351,-0.0002466820879,
-	-0.0001633087959,-5.232140393e-05,6.875651889e-05,0.0001813839772,0.0002670505783,
-	0.0003122463822,0.0003084691998,0.0002560490102,0.0001618325914,4.048933988e-05,
-	-8.959753904e-05,-0.0002076784731,-0.000295116537,-0.0003371176135,-0.0003267053107,
-	-0.0002641211031,-0.0001587401348,-2.618907274e-05,0.0001126536008,0.0002363319363,
-	0.000324540626,0.0003630103893,0.0003444433096,0.0002712028509,0.0001535412011,
-	9.672802662e-06,-0.0001384245988,-0.0002669651876,-0.0003556066076,-0.0003892526729,
-	-0.0003619943745,-0.0002767338592,-0.0001463441149,9.650851098e-06,0.0001666069584,
-	0.0003000288852,0.0003880129952,0.0004162031109,0.0003787608584,0.0002808611025,
-	0.000136635208,-3.149265831e-05,-0.0001976449857,-0.0003351115447,-0.0004219840339,
-	-0.000443295372,-0.0003949214588,-0.0002830033773, -0.00012456697,5.642724864e-05,
-	0.0002313155128,0.0003726464347,0.0004571328755,0.0004707592016,0.0004099220678,
-	0.0002832585014, 0.000109549037,-8.427303692e-05,-0.0002680582111,-0.0004122488899,
-	-0.0004936830373,-0.0004980814992,-0.0004237977555,-0.0002810552833,-9.157446766e-05,
-	0.0001156393628,0.0003077528672,0.0004544097465,0.0005313598085,0.0005255250144,
-	0.0004362321633,0.0002765644458,7.036867464e-05,-0.0001501829538,-0.0003506218782,
-	-0.0004985996638,-0.0005701280897,-0.0005523966393,-0.0004470245913,-0.0002690253605,
-	-4.569366865e-05,0.0001885685779,0.0003965790384,0.0005452291807, 0.000609782117,
-	0.0005789152347,0.0004557517241,0.0002585708862,1.718860585e-05,-0.0002306291572,
-	-0.0004459650954,-0.0005939731491,-0.0006503695622,-0.0006045511691,-0.000462378026,
-	-0.0002446325088,1.518562112e-05,0.0002767897095,0.0004985901178, 0.000645006483,
-	0.0006914979313,0.0006292979233,0.0004663692089,0.0002271348203,-5.194101323e-05,
-	-0.00032703139,-0.0005547759938,-0.0006981050246,-0.0007332314271,-0.0006527053192,
-	-0.0004676429962,-0.0002055405348,9.309171583e-05,0.0003817630932,0.0006143665523,
-	0.0007533972384,0.0007751986268,0.0006746693398, 0.000465627847,0.0001797051227,
-	-0.0001392135018,-0.0004409685207,-0.0006776737282,-0.000810643076,-0.0008174023824,
-	-0.0006947399816,-0.0004602253321,-0.0001490921277,0.0001903867815,0.0005050629843,
-	0.0007445663214, 0.000869965239,0.0008594539831,0.0007127451245,0.0004508022394,
-	0.000113482849,-0.0002471228945,-0.0005741189816,-0.0008153520175,-0.0009311315371,
-	-0.0009013241506,-0.000728234183,-0.0004371981195,-7.232506323e-05,0.0003096027067,
-	0.0006485156482,0.0008899167296,0.0009942199104,0.0009425997268,0.0007409856189,
-	0.000418780488,2.531454993e-05,-0.0003783802094,-0.0007283802843,-0.000968545326,
-	-0.001059013535,-0.0009832192445,-0.0007504548412,-0.0003952600528,2.817831228e-05,
-	0.0004537159693,0.0008141255821, 0.001051195199, 0.001125536743, 0.001022715238,
-	0.0007563435938,0.0003659054928,-8.859887748e-05,-0.0005362951779,-0.000906070869,
-	-0.001138233347,-0.001193712931,-0.001061039744,-0.0007581447717,-0.0003303918347,
-	0.0001565606217,0.0006264105905, 0.001004570164, 0.001229585498, 0.001263460494,
-	0.001097660512,0.0007553568576, 0.000287846924,-0.0002327366674,-0.000724889338,
-	-0.001110093552,-0.001325692516,-0.001334692934,-0.001132420846,-0.0007473988226,
-	-0.0002377365745,0.0003179500927,0.0008322892827, 0.001223215368, 0.001426680596,
-	0.001407462172, 0.001164865098,0.0007337096613, 0.000179136041,-0.0004129945592,
-	-0.0009495250415,-0.001344486605, -0.00153299165,-0.001481664483,-0.001194694079,
-	-0.0007135171909,-0.000111185218, 0.000518966699, 0.001077512745, 0.001474766061,
-	0.001644995878, 0.001557413489,  0.00122142327,  0.00068608328,3.274436676e-05,
-	-0.0006370404153,-0.001217456535,-0.001614913461, -0.00176329934,-0.001634689281,
-	-0.001244665473,-0.0006504122284,5.743321162e-05,0.0007687368197, 0.001370758284,
-	0.001766167348, 0.001888559549, 0.001713680103,  0.00126384967,0.0006054552505,
-	-0.00016094069,-0.0009157716413,-0.001539193909,-0.001929911552,-0.002021721099,
-	-0.001794510987,-0.001278410316,-0.0005498327082,0.0002796500339, 0.001080424758,
-	0.001724933856, 0.002108021174, 0.002163933124, 0.001877537696, 0.001287655206,
-	0.0004819787864,-0.0004159162054,-0.001265380415,-0.001930751721,-0.002302799607,
-	-0.002316726372,-0.001963131595,-0.001290764892,-0.0003998485336, 0.000572682824,
-	0.001474195626, 0.002160164528, 0.002517313696, 0.002482092706, 0.002051931806,
-	0.001286760671,0.0003009502252,-0.000753737404,-0.001711352495,-0.002417807933,
-	-0.002755475463,-0.002662699204,-0.002144719008,-0.001274353242,-0.0001819195313,
-	0.0009640924982, 0.001982923597, 0.002709856257,  0.00302272453, 0.002862225985,
-	0.002242805669, 0.001252036891,3.850658322e-05,-0.001210320159,-0.002296868013,
-	-0.003044551704,-0.003326220904,-0.003085569013,-0.002347786445,-0.001217609737,
-	0.0001353139523, 0.001501618302, 0.002664434025, 0.003433535341, 0.003676221007,
-	0.00333981961, 0.002462215489, 0.001168212271,-0.0003477944119,-0.001850840636,
-	-0.00310139684,-0.003893301357,-0.004087314941, -0.00363513804,-0.002589700976,
-	-0.001099723275,0.0006110009854, 0.002276815241, 0.003631072352, 0.004448300693,
-	0.004581279121, 0.003986791708, 0.002735814312, 0.001005986822,-0.0009430864011,
-	-0.002808192512,-0.004289094359,-0.005136211868,-0.005191897973,-0.004418653902,
-	-0.002909380244,-0.0008774006274,  0.00137288589, 0.003490756266, 0.005132943857,
-	0.006018250715, 0.005974506959, 0.004970178008, 0.003125132527,0.0006979576428,
-	-0.00194902299,-0.004402555991,-0.006261505652,-0.007200808264,-0.007026273757,
-	-0.005711401347,-0.003409585916,-0.0004387538356, 0.002760561183, 0.005688296165,
-	0.007860497572,  0.00888632983, 0.008534669876, 0.006779414136,  0.00381551194,
-	4.157605872e-05, -0.00399002526,-0.007649791893, -0.01032437664, -0.01151314378,
-	-0.01091385167,-0.008483635262, -0.00446476927,0.0006309419987, 0.006079526618,
-	0.0110382,  0.01466355938,  0.01623914763,  0.01529467199,  0.01169955451,
-	0.005715786014,-0.001999746542, -0.01044708397, -0.01838554069, -0.02447572723,
-	-0.02744491212, -0.02625511028, -0.02025231719,-0.009276755154, 0.006281646434,
-	0.02549194731,  0.04695638269,  0.06894322485,  0.08956384659,   0.1069736481,
-	0.1195730716,   0.1261846572,   0.1261846572,   0.1195730716,   0.1069736481,
-	0.08956384659,  0.06894322485,  0.04695638269,  0.02549194731, 0.006281646434,
-	-0.009276755154, -0.02025231719, -0.02625511028, -0.02744491212, -0.02447572723,
-	-0.01838554069, -0.01044708397,-0.001999746542, 0.005715786014,  0.01169955451,
-	0.01529467199,  0.01623914763,  0.01466355938,      0.0110382, 0.006079526618,
-	0.0006309419987, -0.00446476927,-0.008483635262, -0.01091385167, -0.01151314378,
-	-0.01032437664,-0.007649791893, -0.00399002526,4.157605872e-05,  0.00381551194,
-	0.006779414136, 0.008534669876,  0.00888632983, 0.007860497572, 0.005688296165,
-	0.002760561183,-0.0004387538356,-0.003409585916,-0.005711401347,-0.007026273757,
-	-0.007200808264,-0.006261505652,-0.004402555991, -0.00194902299,0.0006979576428,
-	0.003125132527, 0.004970178008, 0.005974506959, 0.006018250715, 0.005132943857,
-	0.003490756266,  0.00137288589,-0.0008774006274,-0.002909380244,-0.004418653902,
-	-0.005191897973,-0.005136211868,-0.004289094359,-0.002808192512,-0.0009430864011,
-	0.001005986822, 0.002735814312, 0.003986791708, 0.004581279121, 0.004448300693,
-	0.003631072352, 0.002276815241,0.0006110009854,-0.001099723275,-0.002589700976,
-	-0.00363513804,-0.004087314941,-0.003893301357, -0.00310139684,-0.001850840636,
-	-0.0003477944119, 0.001168212271, 0.002462215489,  0.00333981961, 0.003676221007,
-	0.003433535341, 0.002664434025, 0.001501618302,0.0001353139523,-0.001217609737,
-	-0.002347786445,-0.003085569013,-0.003326220904,-0.003044551704,-0.002296868013,
-	-0.001210320159,3.850658322e-05, 0.001252036891, 0.002242805669, 0.002862225985,
-	0.00302272453, 0.002709856257, 0.001982923597,0.0009640924982,-0.0001819195313,
-	-0.001274353242,-0.002144719008,-0.002662699204,-0.002755475463,-0.002417807933,
-	-0.001711352495,-0.000753737404,0.0003009502252, 0.001286760671, 0.002051931806,
-	0.002482092706, 0.002517313696, 0.002160164528, 0.001474195626, 0.000572682824,
-	-0.0003998485336,-0.001290764892,-0.001963131595,-0.002316726372,-0.002302799607,
-	-0.001930751721,-0.001265380415,-0.0004159162054,0.0004819787864, 0.001287655206,
-	0.001877537696, 0.002163933124, 0.002108021174, 0.001724933856, 0.001080424758,
-	0.0002796500339,-0.0005498327082,-0.001278410316,-0.001794510987,-0.002021721099,
-	-0.001929911552,-0.001539193909,-0.0009157716413, -0.00016094069,0.0006054552505,
-	0.00126384967, 0.001713680103, 0.001888559549, 0.001766167348, 0.001370758284,
-	0.0007687368197,5.743321162e-05,-0.0006504122284,-0.001244665473,-0.001634689281,
-	-0.00176329934,-0.001614913461,-0.001217456535,-0.0006370404153,3.274436676e-05,
-	0.00068608328,  0.00122142327, 0.001557413489, 0.001644995878, 0.001474766061,
-	0.001077512745, 0.000518966699,-0.000111185218,-0.0007135171909,-0.001194694079,
-	-0.001481664483, -0.00153299165,-0.001344486605,-0.0009495250415,-0.0004129945592,
-	0.000179136041,0.0007337096613, 0.001164865098, 0.001407462172, 0.001426680596,
-	0.001223215368,0.0008322892827,0.0003179500927,-0.0002377365745,-0.0007473988226,
-	-0.001132420846,-0.001334692934,-0.001325692516,-0.001110093552,-0.000724889338,
-	-0.0002327366674, 0.000287846924,0.0007553568576, 0.001097660512, 0.001263460494,
-	0.001229585498, 0.001004570164,0.0006264105905,0.0001565606217,-0.0003303918347,
-	-0.0007581447717,-0.001061039744,-0.001193712931,-0.001138233347,-0.000906070869,
-	-0.0005362951779,-8.859887748e-05,0.0003659054928,0.0007563435938, 0.001022715238,
-	0.001125536743, 0.001051195199,0.0008141255821,0.0004537159693,2.817831228e-05,
-	-0.0003952600528,-0.0007504548412,-0.0009832192445,-0.001059013535,-0.000968545326,
-	-0.0007283802843,-0.0003783802094,2.531454993e-05, 0.000418780488,0.0007409856189,
-	0.0009425997268,0.0009942199104,0.0008899167296,0.0006485156482,0.0003096027067,
-	-7.232506323e-05,-0.0004371981195,-0.000728234183,-0.0009013241506,-0.0009311315371,
-	-0.0008153520175,-0.0005741189816,-0.0002471228945, 0.000113482849,0.0004508022394,
-	0.0007127451245,0.0008594539831, 0.000869965239,0.0007445663214,0.0005050629843,
-	0.0001903867815,-0.0001490921277,-0.0004602253321,-0.0006947399816,-0.0008174023824,
-	-0.000810643076,-0.0006776737282,-0.0004409685207,-0.0001392135018,0.0001797051227,
-	0.000465627847,0.0006746693398,0.0007751986268,0.0007533972384,0.0006143665523,
-	0.0003817630932,9.309171583e-05,-0.0002055405348,-0.0004676429962,-0.0006527053192,
-	-0.0007332314271,-0.0006981050246,-0.0005547759938, -0.00032703139,-5.194101323e-05,
-	0.0002271348203,0.0004663692089,0.0006292979233,0.0006914979313, 0.000645006483,
-	0.0004985901178,0.0002767897095,1.518562112e-05,-0.0002446325088,-0.000462378026,
-	-0.0006045511691,-0.0006503695622,-0.0005939731491,-0.0004459650954,-0.0002306291572,
-	1.718860585e-05,0.0002585708862,0.0004557517241,0.0005789152347, 0.000609782117,
-	0.0005452291807,0.0003965790384,0.0001885685779,-4.569366865e-05,-0.0002690253605,
-	-0.0004470245913,-0.0005523966393,-0.0005701280897,-0.0004985996638,-0.0003506218782,
-	-0.0001501829538,7.036867464e-05,0.0002765644458,0.0004362321633,0.0005255250144,
-	0.0005313598085,0.0004544097465,0.0003077528672,0.0001156393628,-9.157446766e-05,
-	-0.0002810552833,-0.0004237977555,-0.0004980814992,-0.0004936830373,-0.0004122488899,
-	-0.0002680582111,-8.427303692e-05, 0.000109549037,0.0002832585014,0.0004099220678,
-	0.0004707592016,0.0004571328755,0.0003726464347,0.0002313155128,5.642724864e-05,
-	-0.00012456697,-0.0002830033773,-0.0003949214588,-0.000443295372,-0.0004219840339,
-	-0.0003351115447,-0.0001976449857,-3.149265831e-05, 0.000136635208,0.0002808611025,
-	0.0003787608584,0.0004162031109,0.0003880129952,0.0003000288852,0.0001666069584,
-	9.650851098e-06,-0.0001463441149,-0.0002767338592,-0.0003619943745,-0.0003892526729,
-	-0.0003556066076,-0.0002669651876,-0.0001384245988,9.672802662e-06,0.0001535412011,
-	0.0002712028509,0.0003444433096,0.0003630103893, 0.000324540626,0.0002363319363,
-	0.0001126536008,-2.618907274e-05,-0.0001587401348,-0.0002641211031,-0.0003267053107,
-	-0.0003371176135,-0.000295116537,-0.0002076784731,-8.959753904e-05,4.048933988e-05,
-	0.0001618325914,0.0002560490102,0.0003084691998,0.0003122463822,0.0002670505783,
-	0.0001813839772,6.875651889e-05,-5.232140393e-05,-0.0001633087959,-0.0002466820879,
-	-0.0002903699351,-0.0002878789383,-0.0002408340079,-0.0001569543092,-5.037653682e-05,
-	6.230772124e-05,0.0001630346378,0.0002367587294,0.0002720860357,0.0002646414796,
-	0.0002159544092,0.0001347827056, 3.39333892e-05,-7.011194248e-05,-0.0001615315268,
-	-0.0002259076864,-0.0002541571448,-0.0002421240933,-0.0001928690763,-0.0001143171394,
-	-1.968350989e-05,7.644365542e-05,0.0001586356957,0.0002148204658,0.0002363011299,
-	0.0002208374353,0.0001710712677, 9.58752571e-05,7.015829397e-06,-8.095810335e-05,
-	-0.0001549424487,-0.0002032595512,-0.0002192323736,-0.0002004593116,-0.0001512133749,
-	-7.930943684e-05,3.356896286e-06,8.411314047e-05,0.0001497694029,0.0001912753942,
-	0.0002018719679,0.0001810408867,0.0001323792239,6.413264055e-05,-1.276780222e-05,
-	-8.605257608e-05,-0.0001445904199,-0.0001793177507,-0.0001856341842,-0.0001627961174,
-	-0.0001153174744,-5.070106272e-05,2.027390292e-05,8.684078057e-05,0.0001383465133,
-	0.0001674988453, 0.000169816587,0.0001459059422,9.961415344e-05,3.902253229e-05,
-	-2.656760989e-05,-8.64337635e-05,-0.0001318099821,-0.0001555314666,-0.0001547952561,
-	-0.0001298183342,-8.542284922e-05,-2.850688907e-05,3.139878027e-05,8.533721848e-05,
-	0.0001246419706,0.0001439320476,0.0001402363705,0.0001150325552,7.230929623e-05,
-	1.94842396e-05,-3.539980753e-05,-8.339300257e-05,-0.0001175455764,-0.0001324616605,
-	-0.0001265551546,-0.0001009467087,-6.053321704e-05,-1.159201474e-05,3.824717714e-05,
-	8.143886953e-05,0.0001103513423,0.0001210577102,0.0001136621358,8.803432138e-05,
-	4.95046952e-05,4.479415566e-06,-4.081443694e-05,-7.813228876e-05,-0.0001030119456,
-	-0.0001107366625,-0.0001014532754,-7.608484157e-05,-3.980763358e-05,2.249377985e-06,
-	4.259546404e-05,7.570081652e-05,9.581708582e-05,0.0001008105755, 8.95369667e-05,
-	6.481810124e-05,3.013873538e-05,-8.173182323e-06,-4.469522901e-05,-7.305718464e-05,
-	-8.960731793e-05,-9.130224498e-05,-7.878956967e-05,-5.364829849e-05,-2.071717972e-05,
-	1.527944733e-05,4.791123865e-05,7.262175495e-05,8.488017193e-05, 8.34300663e-05,
-	6.793666398e-05,4.156300201e-05,7.950244253e-06,-2.681901788e-05,-5.765895548e-05,
-	-7.873326831e-05,-8.682721091e-05,-7.930647553e-05,-5.700354086e-05,-2.156572555e-05,
-	2.227704863e-05,6.991768169e-05,0.0001150344251,0.0001530983573,0.0001803526684,
-	0.0002028695599,0.0002753733133,0.0007891110727,-0.0001201797568
-};
+	// one period of the rational schedule: inputs to consume before each output and its phase
+	m_schedule.clear();
+	if(m_mode != ModeLinear) {
+		quint64 pos = decimation;
+		for(int i = 0; i < phases; ++i) {
+			ScheduleEntry entry = { 0, 0, 0 };
+			while(pos >= interpolation) {
+				pos -= interpolation;
+				entry.advance++;
+			}
+			entry.phase = (int)pos;
+			if(entry.phase == 0)
+				entry.mirror = tapsPerPhase;
+			else if(entry.phase * 2 == phases)
+				entry.mirror = tapsPerPhase - 1;
+			m_schedule.push_back(entry);
+			pos += decimation;
+		}
+		m_schedulePos = 0;
+		m_schedulePending = m_schedule[0].advance;
+		m_decimation = (int)decimation;
+	}
 
-static const float H14[1024] = {
-	0.0003086650395,-0.000658625504,-0.0003698029323,-0.0002686109801,-0.0002242006012,
-	-0.0001879219781,-0.0001458262414,-9.526521171e-05,-4.150392124e-05,1.001985856e-05,
-	5.156518819e-05,7.878136239e-05,8.752326539e-05,7.864869985e-05,5.384661563e-05,
-	1.941068695e-05,-1.888787483e-05,-5.273819261e-05,-7.680109411e-05,-8.556901594e-05,
-	-7.841653132e-05,-5.56205996e-05,-2.241138282e-05,1.608220555e-05,5.163188325e-05,
-	7.855970762e-05,9.062155732e-05, 8.63703608e-05,6.523615593e-05,3.194535748e-05,
-	-8.619544133e-06,-4.78996335e-05,-7.968088175e-05,-9.669145948e-05,-9.66297448e-05,
-	-7.798428123e-05,-4.476591857e-05, -2.3400803e-06,4.184074351e-05,7.859776815e-05,
-	0.0001021801945,0.0001073783205,9.197893087e-05,6.009843491e-05,1.596865513e-05,
-	-3.215328979e-05,-7.578430814e-05,-0.0001056352121,-0.0001171457625,-0.0001071206643,
-	-7.754738181e-05,-3.22740816e-05,1.973863982e-05,6.971915718e-05,0.0001073756939,
-	0.0001264499588,0.0001221787534,9.577423771e-05,5.064908328e-05,-4.406640528e-06,
-	-6.040447261e-05,-0.0001060793365,-0.0001336897549,-0.0001367727964,-0.0001151571778,
-	-7.131844905e-05,-1.382108076e-05,4.801055184e-05,0.0001018679468, 0.000138645526,
-	0.000150154563,0.0001347416692,9.364158905e-05,3.482639659e-05,-3.208138878e-05,
-	-9.424847667e-05,-0.0001406003867,-0.0001618455426,-0.0001539962541,-0.0001171664699,
-	-5.850331945e-05,1.274507576e-05,8.274291031e-05,0.0001393104758, 0.000171050182,
-	0.0001724352915,0.0001415456936,8.436139615e-05,1.007587343e-05,-6.720033707e-05,
-	-0.0001342232863,-0.0001774389384,-0.0001892401051,-0.0001659982227,-0.0001122009417,
-	-3.617208858e-05,4.768157305e-05,0.0001249124325,0.0001802099141,0.0002038691164,
-	0.0001900473144,0.0001414407598,  6.5343389e-05,-2.39027886e-05,-0.000111031819,
-	-0.000178978953,-0.0002157660347,-0.000213056308,-0.0001715424441,-9.716333443e-05,
-	-3.882722467e-06,9.237635823e-05, 0.000173152177,0.0002239827299,0.0002342422376,
-	0.0002019224776,0.0001313934335,3.575568917e-05,-6.880217552e-05,-0.0001622650307,
-	-0.0002280715125,-0.0002527925826,-0.0002318593615,-0.0001674040104,-7.137782086e-05,
-	4.005188021e-05,0.0001458347397,0.0002271825651,0.0002678178134, 0.000260402885,
-	0.0002045127476,0.0001103546456,-6.26784049e-06,-0.0001234291267,-0.0002204709017,
-	-0.0002783092787,-0.0002863906848,-0.0002414420451,-0.000151656146,-3.187890616e-05,
-	9.555693396e-05,0.0002082169231,0.0002841835958,0.0003096748551,0.0002782044758,
-	0.0001954434847,7.478914631e-05,-6.138138269e-05,-0.0001891342254,-0.0002839767258,
-	-0.0003286222636,-0.0003132405982,-0.0002403331018,-0.0001215361262,2.132406371e-05,
-	0.0001632441708,0.0002772219595,0.0003426120675,0.0003457227431,0.0002856532228,
-	0.0001715814142,2.437089825e-05,-0.0001303213066,-0.0002633332333,-0.0003506078501,
-	-0.0003745181311,-0.0003303547855,-0.0002242282499,-7.542807725e-05,9.020449943e-05,
-	0.0002417087671,0.0003517645528,0.0003985811491,0.0003732843907,0.0002785027027,
-	0.0001312714012,-4.303819514e-05,-0.0002119843703,-0.0003452081874,-0.0004167902516,
-	-0.0004133473558,-0.000333388045,-0.000191167841,-1.098357097e-05,0.0001738311839,
-	0.0003301843244,0.0004280536377, 0.000449195446,0.0003877019044,0.0002542388102,
-	7.143233961e-05,-0.0001271704386,-0.0003060922027,-0.0004312910896,-0.0004796242574,
-	-0.000440166652, -0.00031947362,-0.000137676383,7.205670408e-05,0.0002723827201,
-	0.0004255177919,0.0005032730405,0.0004893749137,0.0003856153053,0.0002088768233,
-	-8.766085557e-06,-0.0002287237003,-0.0004098422651,-0.0005188958021,-0.0005339191994,
-	-0.0004513724998,-0.0002841039095,-6.224979006e-05,0.0001749905787,0.0003834968666,
-	0.000525223033,0.0005722654751,0.0005151975784,0.0003620902717,0.0001403310307,
-	-0.000111175912,-0.0003458933206,-0.000521121663,-0.0006029513315,-0.0005755695165,
-	-0.0004415725416,-0.0002245782089,3.751453551e-05,0.0002965130261,0.0005054590874,
-	0.0006244129618, 0.000630798575,0.0005209326628,0.0003138753236,4.549227015e-05,
-	-0.0002351435105,-0.0004773258115,-0.0006352083292,-0.0006791287451,-0.0005985191092,
-	-0.0004069228598,-0.0001371614053,0.0001617089729,0.0004358872538,0.0006338815438,
-	0.000718754949,0.0006724660634,0.0005021365359,0.0002364766697,-7.647657185e-05,
-	-0.0003805893066,-0.0006191491266,-0.0007479212363,-0.0007408288657,-0.0005977459368,
-	-0.0003421878791,-2.006877548e-05,0.0003110987018,0.0005898782983,0.0007648728206,
-	0.00080163026,0.0006918719155,0.0004528607242,0.0001271698566,-0.0002272803249,
-	-0.0005451415782,-0.0007680390263,-0.0008528527105,-0.0007824964123,-0.0005668573431,
-	-0.0002439567761,0.0001291273802,0.0004839518515,0.0007556056953,0.0008922163397,
-	0.00086720736,0.0006820366252,0.0003688746365,-1.728931056e-05,-0.0004059686034,
-	-0.0007263474399,-0.0009178413311,-0.0009438445559,-0.0007963965181,-0.0005004968843,
-	-0.0001076611516,0.0003107821976,0.0006788911414,0.0009276046767, 0.001009909553,
-	0.0009074864793,0.0006368863396,0.0002446415601,-0.0001984143746,-0.0006121968618,
-	-0.0009195749881,-0.001062951516,-0.001012803288,-0.0007758892607,-0.0003923036275,
-	6.916772691e-05,0.0005254374119,0.0008919705288, 0.001100501162, 0.001109638833,
-	0.0009151272243,0.0005489639007,7.633337373e-05,-0.0004180584801,-0.0008431042661,
-	-0.001120087225,-0.001195181045,-0.001051913248,-0.0007126232376,-0.0002371372248,
-	0.0002897936211,0.0007715569227,  0.00111935311, 0.001266544452, 0.001183386543,
-	0.000880969048,0.0004119077639,-0.0001407132513,-0.0006760853576,-0.001095971325,
-	-0.001320765121,-0.001306483406,-0.001051379833,-0.0005989770871,-2.877071347e-05,
-	0.0005557454424,  0.00104780402, 0.001354883658, 0.001417973661, 0.001220970182,
-	0.0007963325479,0.0002179501753,-0.0004098451172,-0.0009728383739, -0.00136592635,
-	-0.001514448668, -0.00138654327,-0.001001597731,-0.0004256724787,0.0002380035876,
-	0.0008692577248, 0.001350965002,   0.0015924162, 0.001544673345, 0.001212069998,
-	0.0006505122874,-4.013551006e-05,-0.0007354344707,-0.001307088998,-0.001648218837,
-	-0.001691647456,-0.001424661023,-0.0008905722061,-0.0001834461727, 0.000570012664,
-	0.001231542788, 0.001678202534,  0.00182358094, 0.001636008965, 0.001143685891,
-	0.0004322145542,-0.0003717852815,-0.001121562789,-0.001678550732,-0.001936313114,
-	-0.001842385158,-0.001407256001,-0.0007051900029,0.0001398634486,0.0009745727875,
-	0.001645440934, 0.002025535097,  0.00203982275, 0.001678433386, 0.001001218334,
-	0.0001265299652,-0.0007879405166,-0.001574914204,-0.002086657099,-0.002223977586,
-	-0.001953986008,-0.001318832743,-0.0004280031717,0.0005590852816, 0.001462850487,
-	0.002114821225, 0.002390204929, 0.002230368787, 0.001656304812,0.0007650445332,
-	-0.0002853490878,-0.001304919017,-0.002104840474,-0.002533451887,-0.002503692405,
-	-0.002011719858,-0.001138103427,-3.604355516e-05, 0.001096529071, 0.002051183721,
-	0.002648392459, 0.002769921906, 0.002383195562, 0.001547934604, 0.000408427848,
-	-0.0008323354414,-0.001947549055,-0.002728962805,-0.003024497302,-0.002768647857,
-	-0.00199544616,-0.0008356239996,0.0005063163699, 0.001786873792, 0.002768549835,
-	0.00326265418, 0.003166290699, 0.002482356736, 0.001322653843,-0.0001110104349,
-	-0.001560696517,-0.002759428462,-0.003479118692,-0.003574563889,-0.003011388006,
-	-0.001876240829,-0.000363112631, 0.001258569537, 0.002692415146, 0.003668053076,
-	0.00399251515, 0.003587084124, 0.002505875891,0.0009288429283,-0.0008668741793,
-	-0.002555999439,-0.003822764615,-0.004420196172,-0.004216859583,-0.003225470427,
-	-0.001604211517,0.0003670109145, 0.002335000783, 0.003935204819, 0.004859235138,
-	0.004912818316, 0.004056140315, 0.002415779745,0.0002678714227,-0.002008157317,
-	-0.0039950707,-0.005313991569,-0.005694917869,-0.005031166133,-0.003404642921,
-	-0.001078720321, 0.001543697785, 0.003988120705, 0.005793472286, 0.006596914958,
-	0.006205383223, 0.004637898877, 0.002131992485,-0.000890659343,-0.003892759793,
-	-0.006315230392,-0.007678430062,-0.007674629334,-0.006232727319,-0.003543916391,
-	-3.997568638e-05, 0.003672494087, 0.006913997699, 0.009052038193, 0.009620074183,
-	0.008412365802, 0.005538058933, 0.001420844696,-0.003257310251,-0.007663269527,
-	-0.01095330995, -0.01242575608, -0.01165826432,-0.008605907671,-0.003639085917,
-	0.002488321159, 0.008741047233,  0.01396127045,   0.0170624163,  0.01722684689,
-	0.01407590136, 0.007781418972,-0.000902711472, -0.01070033852, -0.01996018551,
-	-0.02687375806, -0.02973406203, -0.02719867975,  -0.0185171552,-0.003687407356,
-	0.01648589782,   0.0404435657,  0.06603191048,  0.09075132757,   0.1120611206,
-	0.1276990026,   0.1359709948,   0.1359709948,   0.1276990026,   0.1120611206,
-	0.09075132757,  0.06603191048,   0.0404435657,  0.01648589782,-0.003687407356,
-	-0.0185171552, -0.02719867975, -0.02973406203, -0.02687375806, -0.01996018551,
-	-0.01070033852,-0.000902711472, 0.007781418972,  0.01407590136,  0.01722684689,
-	0.0170624163,  0.01396127045, 0.008741047233, 0.002488321159,-0.003639085917,
-	-0.008605907671, -0.01165826432, -0.01242575608, -0.01095330995,-0.007663269527,
-	-0.003257310251, 0.001420844696, 0.005538058933, 0.008412365802, 0.009620074183,
-	0.009052038193, 0.006913997699, 0.003672494087,-3.997568638e-05,-0.003543916391,
-	-0.006232727319,-0.007674629334,-0.007678430062,-0.006315230392,-0.003892759793,
-	-0.000890659343, 0.002131992485, 0.004637898877, 0.006205383223, 0.006596914958,
-	0.005793472286, 0.003988120705, 0.001543697785,-0.001078720321,-0.003404642921,
-	-0.005031166133,-0.005694917869,-0.005313991569,  -0.0039950707,-0.002008157317,
-	0.0002678714227, 0.002415779745, 0.004056140315, 0.004912818316, 0.004859235138,
-	0.003935204819, 0.002335000783,0.0003670109145,-0.001604211517,-0.003225470427,
-	-0.004216859583,-0.004420196172,-0.003822764615,-0.002555999439,-0.0008668741793,
-	0.0009288429283, 0.002505875891, 0.003587084124,  0.00399251515, 0.003668053076,
-	0.002692415146, 0.001258569537,-0.000363112631,-0.001876240829,-0.003011388006,
-	-0.003574563889,-0.003479118692,-0.002759428462,-0.001560696517,-0.0001110104349,
-	0.001322653843, 0.002482356736, 0.003166290699,  0.00326265418, 0.002768549835,
-	0.001786873792,0.0005063163699,-0.0008356239996, -0.00199544616,-0.002768647857,
-	-0.003024497302,-0.002728962805,-0.001947549055,-0.0008323354414, 0.000408427848,
-	0.001547934604, 0.002383195562, 0.002769921906, 0.002648392459, 0.002051183721,
-	0.001096529071,-3.604355516e-05,-0.001138103427,-0.002011719858,-0.002503692405,
-	-0.002533451887,-0.002104840474,-0.001304919017,-0.0002853490878,0.0007650445332,
-	0.001656304812, 0.002230368787, 0.002390204929, 0.002114821225, 0.001462850487,
-	0.0005590852816,-0.0004280031717,-0.001318832743,-0.001953986008,-0.002223977586,
-	-0.002086657099,-0.001574914204,-0.0007879405166,0.0001265299652, 0.001001218334,
-	0.001678433386,  0.00203982275, 0.002025535097, 0.001645440934,0.0009745727875,
-	0.0001398634486,-0.0007051900029,-0.001407256001,-0.001842385158,-0.001936313114,
-	-0.001678550732,-0.001121562789,-0.0003717852815,0.0004322145542, 0.001143685891,
-	0.001636008965,  0.00182358094, 0.001678202534, 0.001231542788, 0.000570012664,
-	-0.0001834461727,-0.0008905722061,-0.001424661023,-0.001691647456,-0.001648218837,
-	-0.001307088998,-0.0007354344707,-4.013551006e-05,0.0006505122874, 0.001212069998,
-	0.001544673345,   0.0015924162, 0.001350965002,0.0008692577248,0.0002380035876,
-	-0.0004256724787,-0.001001597731, -0.00138654327,-0.001514448668, -0.00136592635,
-	-0.0009728383739,-0.0004098451172,0.0002179501753,0.0007963325479, 0.001220970182,
-	0.001417973661, 0.001354883658,  0.00104780402,0.0005557454424,-2.877071347e-05,
-	-0.0005989770871,-0.001051379833,-0.001306483406,-0.001320765121,-0.001095971325,
-	-0.0006760853576,-0.0001407132513,0.0004119077639, 0.000880969048, 0.001183386543,
-	0.001266544452,  0.00111935311,0.0007715569227,0.0002897936211,-0.0002371372248,
-	-0.0007126232376,-0.001051913248,-0.001195181045,-0.001120087225,-0.0008431042661,
-	-0.0004180584801,7.633337373e-05,0.0005489639007,0.0009151272243, 0.001109638833,
-	0.001100501162,0.0008919705288,0.0005254374119,6.916772691e-05,-0.0003923036275,
-	-0.0007758892607,-0.001012803288,-0.001062951516,-0.0009195749881,-0.0006121968618,
-	-0.0001984143746,0.0002446415601,0.0006368863396,0.0009074864793, 0.001009909553,
-	0.0009276046767,0.0006788911414,0.0003107821976,-0.0001076611516,-0.0005004968843,
-	-0.0007963965181,-0.0009438445559,-0.0009178413311,-0.0007263474399,-0.0004059686034,
-	-1.728931056e-05,0.0003688746365,0.0006820366252,  0.00086720736,0.0008922163397,
-	0.0007556056953,0.0004839518515,0.0001291273802,-0.0002439567761,-0.0005668573431,
-	-0.0007824964123,-0.0008528527105,-0.0007680390263,-0.0005451415782,-0.0002272803249,
-	0.0001271698566,0.0004528607242,0.0006918719155,  0.00080163026,0.0007648728206,
-	0.0005898782983,0.0003110987018,-2.006877548e-05,-0.0003421878791,-0.0005977459368,
-	-0.0007408288657,-0.0007479212363,-0.0006191491266,-0.0003805893066,-7.647657185e-05,
-	0.0002364766697,0.0005021365359,0.0006724660634, 0.000718754949,0.0006338815438,
-	0.0004358872538,0.0001617089729,-0.0001371614053,-0.0004069228598,-0.0005985191092,
-	-0.0006791287451,-0.0006352083292,-0.0004773258115,-0.0002351435105,4.549227015e-05,
-	0.0003138753236,0.0005209326628, 0.000630798575,0.0006244129618,0.0005054590874,
-	0.0002965130261,3.751453551e-05,-0.0002245782089,-0.0004415725416,-0.0005755695165,
-	-0.0006029513315,-0.000521121663,-0.0003458933206,-0.000111175912,0.0001403310307,
-	0.0003620902717,0.0005151975784,0.0005722654751, 0.000525223033,0.0003834968666,
-	0.0001749905787,-6.224979006e-05,-0.0002841039095,-0.0004513724998,-0.0005339191994,
-	-0.0005188958021,-0.0004098422651,-0.0002287237003,-8.766085557e-06,0.0002088768233,
-	0.0003856153053,0.0004893749137,0.0005032730405,0.0004255177919,0.0002723827201,
-	7.205670408e-05,-0.000137676383, -0.00031947362,-0.000440166652,-0.0004796242574,
-	-0.0004312910896,-0.0003060922027,-0.0001271704386,7.143233961e-05,0.0002542388102,
-	0.0003877019044, 0.000449195446,0.0004280536377,0.0003301843244,0.0001738311839,
-	-1.098357097e-05,-0.000191167841,-0.000333388045,-0.0004133473558,-0.0004167902516,
-	-0.0003452081874,-0.0002119843703,-4.303819514e-05,0.0001312714012,0.0002785027027,
-	0.0003732843907,0.0003985811491,0.0003517645528,0.0002417087671,9.020449943e-05,
-	-7.542807725e-05,-0.0002242282499,-0.0003303547855,-0.0003745181311,-0.0003506078501,
-	-0.0002633332333,-0.0001303213066,2.437089825e-05,0.0001715814142,0.0002856532228,
-	0.0003457227431,0.0003426120675,0.0002772219595,0.0001632441708,2.132406371e-05,
-	-0.0001215361262,-0.0002403331018,-0.0003132405982,-0.0003286222636,-0.0002839767258,
-	-0.0001891342254,-6.138138269e-05,7.478914631e-05,0.0001954434847,0.0002782044758,
-	0.0003096748551,0.0002841835958,0.0002082169231,9.555693396e-05,-3.187890616e-05,
-	-0.000151656146,-0.0002414420451,-0.0002863906848,-0.0002783092787,-0.0002204709017,
-	-0.0001234291267,-6.26784049e-06,0.0001103546456,0.0002045127476, 0.000260402885,
-	0.0002678178134,0.0002271825651,0.0001458347397,4.005188021e-05,-7.137782086e-05,
-	-0.0001674040104,-0.0002318593615,-0.0002527925826,-0.0002280715125,-0.0001622650307,
-	-6.880217552e-05,3.575568917e-05,0.0001313934335,0.0002019224776,0.0002342422376,
-	0.0002239827299, 0.000173152177,9.237635823e-05,-3.882722467e-06,-9.716333443e-05,
-	-0.0001715424441,-0.000213056308,-0.0002157660347,-0.000178978953,-0.000111031819,
-	-2.39027886e-05,  6.5343389e-05,0.0001414407598,0.0001900473144,0.0002038691164,
-	0.0001802099141,0.0001249124325,4.768157305e-05,-3.617208858e-05,-0.0001122009417,
-	-0.0001659982227,-0.0001892401051,-0.0001774389384,-0.0001342232863,-6.720033707e-05,
-	1.007587343e-05,8.436139615e-05,0.0001415456936,0.0001724352915, 0.000171050182,
-	0.0001393104758,8.274291031e-05,1.274507576e-05,-5.850331945e-05,-0.0001171664699,
-	-0.0001539962541,-0.0001618455426,-0.0001406003867,-9.424847667e-05,-3.208138878e-05,
-	3.482639659e-05,9.364158905e-05,0.0001347416692, 0.000150154563, 0.000138645526,
-	0.0001018679468,4.801055184e-05,-1.382108076e-05,-7.131844905e-05,-0.0001151571778,
-	-0.0001367727964,-0.0001336897549,-0.0001060793365,-6.040447261e-05,-4.406640528e-06,
-	5.064908328e-05,9.577423771e-05,0.0001221787534,0.0001264499588,0.0001073756939,
-	6.971915718e-05,1.973863982e-05,-3.22740816e-05,-7.754738181e-05,-0.0001071206643,
-	-0.0001171457625,-0.0001056352121,-7.578430814e-05,-3.215328979e-05,1.596865513e-05,
-	6.009843491e-05,9.197893087e-05,0.0001073783205,0.0001021801945,7.859776815e-05,
-	4.184074351e-05, -2.3400803e-06,-4.476591857e-05,-7.798428123e-05,-9.66297448e-05,
-	-9.669145948e-05,-7.968088175e-05,-4.78996335e-05,-8.619544133e-06,3.194535748e-05,
-	6.523615593e-05, 8.63703608e-05,9.062155732e-05,7.855970762e-05,5.163188325e-05,
-	1.608220555e-05,-2.241138282e-05,-5.56205996e-05,-7.841653132e-05,-8.556901594e-05,
-	-7.680109411e-05,-5.273819261e-05,-1.888787483e-05,1.941068695e-05,5.384661563e-05,
-	7.864869985e-05,8.752326539e-05,7.878136239e-05,5.156518819e-05,1.001985856e-05,
-	-4.150392124e-05,-9.526521171e-05,-0.0001458262414,-0.0001879219781,-0.0002242006012,
-	-0.0002686109801,-0.0003698029323,-0.000658625504,0.0003086650395
-};
+	// a long single phase filter is cheaper in the frequency domain when the decimation is small
+	m_useFFT = false;
+	int fftSize = 0;
+	if(m_mode == ModeDecimate) {
+		double fftCost;
+		fftSize = FFTFilter::bestSize(m_nTaps, m_decimation, &fftCost);
+		qDebug("direct filter %d flops per output, FFT %.0f", 2 * m_nTaps, fftCost);
+		m_useFFT = (fftCost * FFTCostFactor < 2.0 * m_nTaps);
+	}
 
-static const float H15[1024] = {
-	-0.000425702252,0.0005332338042,0.0003758839157, 0.000305163645,0.0002651238465,
-	0.0002280481276,0.0001824468491,0.0001267333719,6.533176929e-05,5.813406005e-06,
-	-4.353889381e-05,-7.579380326e-05,-8.693894779e-05,-7.677455869e-05,-4.900532804e-05,
-	-1.054709446e-05,2.984289677e-05,6.327849405e-05,8.254904242e-05, 8.35244864e-05,
-	6.602513895e-05,3.378204565e-05,-6.276633485e-06,-4.556309432e-05,-7.55374931e-05,
-	-8.963361324e-05,-8.452647307e-05,-6.106706132e-05,-2.38712928e-05,1.910128231e-05,
-	5.921688353e-05,8.685425564e-05,9.745448187e-05,8.626376075e-05,5.709356628e-05,
-	1.506793524e-05,-3.180094063e-05,-7.258238475e-05,-9.856051474e-05,-0.0001044220917,
-	-8.83429384e-05,-5.276652519e-05,-4.929763691e-06,4.495168105e-05,8.619908476e-05,
-	0.0001100655572,0.0001112226091,8.889277524e-05,4.712733789e-05,-5.709351171e-06,
-	-5.864679406e-05,-0.0001003644502,-0.0001217188037,-0.000117690448,-8.858844376e-05,
-	-4.001599154e-05,1.814461029e-05,7.380240277e-05,0.0001150636162,0.0001329127408,
-	0.0001229240734,8.676273137e-05,3.121286863e-05,-3.19890969e-05,-9.007190238e-05,
-	-0.0001302278833,-0.0001436921739,-0.0001271670335,-8.314528532e-05,-2.060880252e-05,
-	4.7618596e-05,0.0001073519379, 0.000145707003, 0.000153920686,0.0001297725103,
-	7.766396448e-05,7.958406968e-06,-6.503344048e-05,-0.000125765102,-0.0001611530897,
-	-0.0001631833147,-0.0001307935163,-6.998130993e-05,6.953742286e-06,8.408391295e-05,
-	0.0001449723641,0.0001764762419,0.0001712868834,0.0001298218704, 5.99704581e-05,
-	-2.400414451e-05,-0.0001047529731,-0.000164918165,-0.0001915203466, -0.00017800364,
-	-0.0001266638283,-4.740659642e-05,4.346477363e-05,0.0001269616623,0.0001853601716,
-	0.0002057193196,0.0001829383255,0.0001210746268,3.229117283e-05,-6.510665844e-05,
-	-0.0001506645785,-0.0002060551778,-0.0002190265368,-0.0001858761971,-0.0001127649157,
-	-1.436687762e-05,8.898647502e-05,0.0001756141573,0.0002267788077,0.0002309870179,
-	0.0001864165388, 0.000101608086,-6.360608495e-06,-0.000115079165,-0.0002015820355,
-	-0.0002470977488,-0.0002412519534,-0.0001843128121,-8.731724665e-05,2.998635682e-05,
-	0.0001432118297,0.0002282941859,0.0002667000226,0.0002494952641,0.0001791749382,
-	6.974416465e-05,-5.654981578e-05,-0.0001732280361,-0.0002554669045,-0.0002852105536,
-	-0.0002552347723,-0.0001707008341,-4.859620822e-05,8.604672621e-05,0.0002049615578,
-	0.0002827541321,0.0003021627199,0.0002581057488,0.0001586473954,2.385546941e-05,
-	-0.0001184466892,-0.0002382395178,-0.0003098796005,-0.0003172818106,-0.000257769716,
-	-0.0001426602248,4.619909305e-06,0.0001536103955,0.0002727735846,0.0003364746808,
-	0.000330143288, 0.000253981445,0.0001227710309,-3.667571946e-05,-0.0001912126027,
-	-0.00030808468,-0.0003619091003,-0.0003402202565,-0.0002463119454,-9.872285591e-05,
-	7.22345867e-05,0.0002309041301,0.0003435035469,0.0003854362876,0.0003466170165,
-	0.0002338972408, 6.97743526e-05,-0.0001119113222,-0.0002730947162,-0.0003793554788,
-	-0.0004073042655,-0.0003496566496,-0.0002171827509,-3.658422793e-05, 0.000154797046,
-	0.0003167257528,0.0004144681443, 0.000426307728,0.0003482894681,0.0001953640167,
-	-1.411775315e-06,-0.0002011864417,-0.0003617964976,-0.0004486581893,-0.0004422112252,
-	-0.0003422107256,-0.000168285711,4.410471593e-05,0.0002506731835,0.0004077351477,
-	0.0004812640254,0.0004543398099,0.0003309847962,0.0001357045112,-9.147471428e-05,
-	-0.0003030428197,-0.0004540852096,-0.0005116775283,-0.0004621296248,-0.0003141399648,
-	-9.740847599e-05,0.0001434488804,0.0003579198965,0.0005002826802,0.0005392695311,
-	0.0004649981274,0.0002912837081,5.325549864e-05,-0.0001998735388,-0.0004148533335,
-	-0.0005457033403,-0.0005633704714,-0.0004623401328,-0.000262022746,-3.162071607e-06,
-	0.000260520872,0.0004734025861,0.0005896947114,0.0005833072937,0.0004536221968,
-	0.0002260492474,-5.28824603e-05,-0.0003250912123,-0.0005329428823,-0.000631540257,
-	-0.0005983249284,-0.0004382144834,-0.0001830111578,0.0001148664887, 0.000393205788,
-	0.0005928932806,0.0006705187261,0.0006077539292,0.0004156449868,0.0001327185309,
-	-0.0001826710941,-0.0004644434957,-0.0006525584613,-0.0007058110787,-0.0006108281086,
-	-0.0003853589005,-7.497057231e-05,0.0002561108849,0.0005382879754,0.0007111885934,
-	0.0007366135833,0.0006068479852, 0.000346910092,9.631506146e-06,-0.0003349155013,
-	-0.0006141269114,-0.0007679848932,-0.0007620545221,-0.0005950801424,-0.0002998375567,
-	6.334218051e-05,0.0004187814193,0.0006913296529,0.0008220965974,0.0007812923286,
-	0.0005748437834,0.0002437883959,-0.0001439253974,-0.0005072480417,-0.0007691052742,
-	-0.0008725906373,-0.0007934146561,-0.000545431627,-0.0001784197957,0.0002320023777,
-	0.0005997863482,0.0008466329891, 0.000918498321,0.0007975133485,0.0005061915144,
-	0.0001034481393,-0.0003274089831,-0.0006958136801,-0.0009229989955,-0.0009587757522,
-	-0.0007926207618,-0.0004564656701,-1.867680839e-05,0.0004298911663,0.0007946325932,
-	0.0009972427506,0.0009923767066,0.0007778366562,0.0003956453875,-7.607307634e-05,
-	-0.0005391063169,-0.0008954987279,-0.001068338985,-0.001018217416,-0.000752242282,
-	-0.0003231941664,0.0001808481611,0.0006546264631,0.0009975624271, 0.001135186525,
-	0.001035187161,0.0007149527664,0.0002386298875,-0.0002956168319,-0.0007758777938,
-	-0.001099828747,-0.001196593279,-0.001042107004,-0.0006650520954,-0.0001414900617,
-	0.0004202742712,0.0009022164159, 0.001201230916, 0.001251261565, 0.001037732814,
-	0.0006015531835,3.128033131e-05,-0.000554745202,-0.001033007517,-0.001300704083,
-	-0.001297919312,-0.001020846306,-0.0005235967692, 9.23683474e-05,0.0006988198729,
-	0.001167500974, 0.001397123327, 0.001335301087,0.0009903041646,0.0004303966998,
-	-0.0002296647581,-0.0008520421106,-0.001304645557,-0.001489012502,-0.001361764851,
-	-0.0009446076583,-0.0003208775597,0.0003810835187, 0.001014241832, 0.001443651388,
-	0.001575153088, 0.001375945052,0.0008825458353,0.0001942550589,-0.0005467910669,
-	-0.001184866298,-0.001583370031,-0.001653974527,-0.001376151573,-0.0008026224095,
-	-4.950640869e-05,0.0007271215436,  0.00136351015,  0.00172271335, 0.001723952824,
-	0.001360706519,0.0007033533184,-0.0001143285772,-0.0009223204688, -0.00154963322,
-	-0.001860437333,-0.001783359912,-0.001327744918,-0.0005831029848,0.0002983530867,
-	0.001132728532, 0.001742727356, 0.001995279454, 0.001830407884, 0.001275294344,
-	0.0004400918551,-0.0005037579685,-0.001358692651,-0.001942218398,-0.002125817351,
-	-0.00186308939,-0.001201128936,-0.0002723303041,0.0007319481811, 0.001600724878,
-	0.002147580031, 0.002250566613, 0.001879205694, 0.001102757407,7.749117503e-05,
-	-0.0009846016765,-0.001859518816,-0.002358351368,-0.002367952839,-0.001876351191,
-	-0.0009773614584,0.0001471175201, 0.001263736165, 0.002135981806, 0.002574098529,
-	0.002476216527,  0.00185170176,0.0008215565467,-0.0004048023839,-0.001571952598,
-	-0.002431456698,-0.002794573782,-0.002573467325,-0.001802013256,-0.0006313025951,
-	0.0006996755255, 0.001912602806, 0.002747835359, 0.003019726137, 0.002657607431,
-	0.001723388792,0.0004015578306,-0.001036970643,-0.002290113829, -0.00308778719,
-	-0.003249812406,-0.002726232633,-0.001611051965,-0.0001259330602, 0.001423553796,
-	0.002710462548, 0.003455119208, 0.003485501744, 0.002776462585, 0.001458850689,
-	-0.0002040455875,-0.001868713764,-0.003181942739,-0.003855345771,-0.003728144802,
-	-0.002804812742,-0.001258680481,0.0005998872803, 0.002385335974,  0.00371630257,
-	0.004296537954, 0.003980092239,  0.00280679483,0.0009994346183,-0.001077755587,
-	-0.00299184327,-0.004330650438, -0.00479075918,-0.004245242104,-0.002776395064,
-	-0.0006652325974, 0.001661245129,  0.00371552282, 0.005050672684,  0.00535647897,
-	0.004530010745, 0.002705016872,0.0002323179215,-0.002386268927,-0.004598469473,
-	-0.0059165149,-0.006023024209, -0.00484504411,-0.002579582157, 0.000336862955,
-	0.003310498549, 0.005709121004, 0.006994252559, 0.006839347538, 0.005208688788,
-	0.002378669335,-0.001105671749,-0.004532692488, -0.00716626551,-0.008400125429,
-	-0.007892915979,-0.005654623266,-0.002064015483,  0.00219030981, 0.006237067282,
-	0.009195045568,  0.01035816129,  0.00935533829, 0.006250574719, 0.001559012802,
-	-0.003829663852,-0.008810598403, -0.01227893215,  -0.0133605944,   -0.011613084,
-	-0.007153488696,-0.0006828285404, 0.006605978124,  0.01322703809,  0.01767664216,
-	0.0187370386,  0.01575277559, 0.008824847639,-0.001119862311, -0.01240638364,
-	-0.02283299528, -0.03000655025, -0.03173966706, -0.02644409053, -0.01345171966,
-	0.006795673631,  0.03272693977,  0.06180337071,  0.09084258229,   0.1164571866,
-	0.1355405748,   0.1457227468,   0.1457227468,   0.1355405748,   0.1164571866,
-	0.09084258229,  0.06180337071,  0.03272693977, 0.006795673631, -0.01345171966,
-	-0.02644409053, -0.03173966706, -0.03000655025, -0.02283299528, -0.01240638364,
-	-0.001119862311, 0.008824847639,  0.01575277559,   0.0187370386,  0.01767664216,
-	0.01322703809, 0.006605978124,-0.0006828285404,-0.007153488696,   -0.011613084,
-	-0.0133605944, -0.01227893215,-0.008810598403,-0.003829663852, 0.001559012802,
-	0.006250574719,  0.00935533829,  0.01035816129, 0.009195045568, 0.006237067282,
-	0.00219030981,-0.002064015483,-0.005654623266,-0.007892915979,-0.008400125429,
-	-0.00716626551,-0.004532692488,-0.001105671749, 0.002378669335, 0.005208688788,
-	0.006839347538, 0.006994252559, 0.005709121004, 0.003310498549, 0.000336862955,
-	-0.002579582157, -0.00484504411,-0.006023024209,  -0.0059165149,-0.004598469473,
-	-0.002386268927,0.0002323179215, 0.002705016872, 0.004530010745,  0.00535647897,
-	0.005050672684,  0.00371552282, 0.001661245129,-0.0006652325974,-0.002776395064,
-	-0.004245242104, -0.00479075918,-0.004330650438, -0.00299184327,-0.001077755587,
-	0.0009994346183,  0.00280679483, 0.003980092239, 0.004296537954,  0.00371630257,
-	0.002385335974,0.0005998872803,-0.001258680481,-0.002804812742,-0.003728144802,
-	-0.003855345771,-0.003181942739,-0.001868713764,-0.0002040455875, 0.001458850689,
-	0.002776462585, 0.003485501744, 0.003455119208, 0.002710462548, 0.001423553796,
-	-0.0001259330602,-0.001611051965,-0.002726232633,-0.003249812406, -0.00308778719,
-	-0.002290113829,-0.001036970643,0.0004015578306, 0.001723388792, 0.002657607431,
-	0.003019726137, 0.002747835359, 0.001912602806,0.0006996755255,-0.0006313025951,
-	-0.001802013256,-0.002573467325,-0.002794573782,-0.002431456698,-0.001571952598,
-	-0.0004048023839,0.0008215565467,  0.00185170176, 0.002476216527, 0.002574098529,
-	0.002135981806, 0.001263736165,0.0001471175201,-0.0009773614584,-0.001876351191,
-	-0.002367952839,-0.002358351368,-0.001859518816,-0.0009846016765,7.749117503e-05,
-	0.001102757407, 0.001879205694, 0.002250566613, 0.002147580031, 0.001600724878,
-	0.0007319481811,-0.0002723303041,-0.001201128936, -0.00186308939,-0.002125817351,
-	-0.001942218398,-0.001358692651,-0.0005037579685,0.0004400918551, 0.001275294344,
-	0.001830407884, 0.001995279454, 0.001742727356, 0.001132728532,0.0002983530867,
-	-0.0005831029848,-0.001327744918,-0.001783359912,-0.001860437333, -0.00154963322,
-	-0.0009223204688,-0.0001143285772,0.0007033533184, 0.001360706519, 0.001723952824,
-	0.00172271335,  0.00136351015,0.0007271215436,-4.950640869e-05,-0.0008026224095,
-	-0.001376151573,-0.001653974527,-0.001583370031,-0.001184866298,-0.0005467910669,
-	0.0001942550589,0.0008825458353, 0.001375945052, 0.001575153088, 0.001443651388,
-	0.001014241832,0.0003810835187,-0.0003208775597,-0.0009446076583,-0.001361764851,
-	-0.001489012502,-0.001304645557,-0.0008520421106,-0.0002296647581,0.0004303966998,
-	0.0009903041646, 0.001335301087, 0.001397123327, 0.001167500974,0.0006988198729,
-	9.23683474e-05,-0.0005235967692,-0.001020846306,-0.001297919312,-0.001300704083,
-	-0.001033007517,-0.000554745202,3.128033131e-05,0.0006015531835, 0.001037732814,
-	0.001251261565, 0.001201230916,0.0009022164159,0.0004202742712,-0.0001414900617,
-	-0.0006650520954,-0.001042107004,-0.001196593279,-0.001099828747,-0.0007758777938,
-	-0.0002956168319,0.0002386298875,0.0007149527664, 0.001035187161, 0.001135186525,
-	0.0009975624271,0.0006546264631,0.0001808481611,-0.0003231941664,-0.000752242282,
-	-0.001018217416,-0.001068338985,-0.0008954987279,-0.0005391063169,-7.607307634e-05,
-	0.0003956453875,0.0007778366562,0.0009923767066,0.0009972427506,0.0007946325932,
-	0.0004298911663,-1.867680839e-05,-0.0004564656701,-0.0007926207618,-0.0009587757522,
-	-0.0009229989955,-0.0006958136801,-0.0003274089831,0.0001034481393,0.0005061915144,
-	0.0007975133485, 0.000918498321,0.0008466329891,0.0005997863482,0.0002320023777,
-	-0.0001784197957,-0.000545431627,-0.0007934146561,-0.0008725906373,-0.0007691052742,
-	-0.0005072480417,-0.0001439253974,0.0002437883959,0.0005748437834,0.0007812923286,
-	0.0008220965974,0.0006913296529,0.0004187814193,6.334218051e-05,-0.0002998375567,
-	-0.0005950801424,-0.0007620545221,-0.0007679848932,-0.0006141269114,-0.0003349155013,
-	9.631506146e-06, 0.000346910092,0.0006068479852,0.0007366135833,0.0007111885934,
-	0.0005382879754,0.0002561108849,-7.497057231e-05,-0.0003853589005,-0.0006108281086,
-	-0.0007058110787,-0.0006525584613,-0.0004644434957,-0.0001826710941,0.0001327185309,
-	0.0004156449868,0.0006077539292,0.0006705187261,0.0005928932806, 0.000393205788,
-	0.0001148664887,-0.0001830111578,-0.0004382144834,-0.0005983249284,-0.000631540257,
-	-0.0005329428823,-0.0003250912123,-5.28824603e-05,0.0002260492474,0.0004536221968,
-	0.0005833072937,0.0005896947114,0.0004734025861, 0.000260520872,-3.162071607e-06,
-	-0.000262022746,-0.0004623401328,-0.0005633704714,-0.0005457033403,-0.0004148533335,
-	-0.0001998735388,5.325549864e-05,0.0002912837081,0.0004649981274,0.0005392695311,
-	0.0005002826802,0.0003579198965,0.0001434488804,-9.740847599e-05,-0.0003141399648,
-	-0.0004621296248,-0.0005116775283,-0.0004540852096,-0.0003030428197,-9.147471428e-05,
-	0.0001357045112,0.0003309847962,0.0004543398099,0.0004812640254,0.0004077351477,
-	0.0002506731835,4.410471593e-05,-0.000168285711,-0.0003422107256,-0.0004422112252,
-	-0.0004486581893,-0.0003617964976,-0.0002011864417,-1.411775315e-06,0.0001953640167,
-	0.0003482894681, 0.000426307728,0.0004144681443,0.0003167257528, 0.000154797046,
-	-3.658422793e-05,-0.0002171827509,-0.0003496566496,-0.0004073042655,-0.0003793554788,
-	-0.0002730947162,-0.0001119113222, 6.97743526e-05,0.0002338972408,0.0003466170165,
-	0.0003854362876,0.0003435035469,0.0002309041301, 7.22345867e-05,-9.872285591e-05,
-	-0.0002463119454,-0.0003402202565,-0.0003619091003, -0.00030808468,-0.0001912126027,
-	-3.667571946e-05,0.0001227710309, 0.000253981445, 0.000330143288,0.0003364746808,
-	0.0002727735846,0.0001536103955,4.619909305e-06,-0.0001426602248,-0.000257769716,
-	-0.0003172818106,-0.0003098796005,-0.0002382395178,-0.0001184466892,2.385546941e-05,
-	0.0001586473954,0.0002581057488,0.0003021627199,0.0002827541321,0.0002049615578,
-	8.604672621e-05,-4.859620822e-05,-0.0001707008341,-0.0002552347723,-0.0002852105536,
-	-0.0002554669045,-0.0001732280361,-5.654981578e-05,6.974416465e-05,0.0001791749382,
-	0.0002494952641,0.0002667000226,0.0002282941859,0.0001432118297,2.998635682e-05,
-	-8.731724665e-05,-0.0001843128121,-0.0002412519534,-0.0002470977488,-0.0002015820355,
-	-0.000115079165,-6.360608495e-06, 0.000101608086,0.0001864165388,0.0002309870179,
-	0.0002267788077,0.0001756141573,8.898647502e-05,-1.436687762e-05,-0.0001127649157,
-	-0.0001858761971,-0.0002190265368,-0.0002060551778,-0.0001506645785,-6.510665844e-05,
-	3.229117283e-05,0.0001210746268,0.0001829383255,0.0002057193196,0.0001853601716,
-	0.0001269616623,4.346477363e-05,-4.740659642e-05,-0.0001266638283, -0.00017800364,
-	-0.0001915203466,-0.000164918165,-0.0001047529731,-2.400414451e-05, 5.99704581e-05,
-	0.0001298218704,0.0001712868834,0.0001764762419,0.0001449723641,8.408391295e-05,
-	6.953742286e-06,-6.998130993e-05,-0.0001307935163,-0.0001631833147,-0.0001611530897,
-	-0.000125765102,-6.503344048e-05,7.958406968e-06,7.766396448e-05,0.0001297725103,
-	0.000153920686, 0.000145707003,0.0001073519379,  4.7618596e-05,-2.060880252e-05,
-	-8.314528532e-05,-0.0001271670335,-0.0001436921739,-0.0001302278833,-9.007190238e-05,
-	-3.19890969e-05,3.121286863e-05,8.676273137e-05,0.0001229240734,0.0001329127408,
-	0.0001150636162,7.380240277e-05,1.814461029e-05,-4.001599154e-05,-8.858844376e-05,
-	-0.000117690448,-0.0001217188037,-0.0001003644502,-5.864679406e-05,-5.709351171e-06,
-	4.712733789e-05,8.889277524e-05,0.0001112226091,0.0001100655572,8.619908476e-05,
-	4.495168105e-05,-4.929763691e-06,-5.276652519e-05,-8.83429384e-05,-0.0001044220917,
-	-9.856051474e-05,-7.258238475e-05,-3.180094063e-05,1.506793524e-05,5.709356628e-05,
-	8.626376075e-05,9.745448187e-05,8.685425564e-05,5.921688353e-05,1.910128231e-05,
-	-2.38712928e-05,-6.106706132e-05,-8.452647307e-05,-8.963361324e-05,-7.55374931e-05,
-	-4.556309432e-05,-6.276633485e-06,3.378204565e-05,6.602513895e-05, 8.35244864e-05,
-	8.254904242e-05,6.327849405e-05,2.984289677e-05,-1.054709446e-05,-4.900532804e-05,
-	-7.677455869e-05,-8.693894779e-05,-7.579380326e-05,-4.353889381e-05,5.813406005e-06,
-	6.533176929e-05,0.0001267333719,0.0001824468491,0.0002280481276,0.0002651238465,
-	0.000305163645,0.0003758839157,0.0005332338042,-0.000425702252
-};
+	// exact ratios run the 8 bit output in fixed point, see process(); amplifying taps could
+	// overflow its 32 bit accumulators
+	m_fixedPoint = (m_mode != ModeLinear) && (m_stages == 0) && !m_useFFT && (gain <= 1.0);
 
-static const float H16[1024] = {
-	0.0005150511861,-0.0004148345906,-0.0003438273852,-0.0003130997356,-0.0002925412846,
-	-0.0002655026619,-0.0002227080986,-0.0001648709585,-9.668228449e-05,-2.867951298e-05,
-	2.96237522e-05,6.816920359e-05,8.275178698e-05,7.203491987e-05,4.192777124e-05,
-	2.329196747e-07,-4.102096864e-05,-7.240760169e-05,-8.508510655e-05,-7.698727131e-05,
-	-4.900405111e-05,-9.053335816e-06,3.423865564e-05,6.906738417e-05,8.802492812e-05,
-	8.483659622e-05,6.160480552e-05,2.156013761e-05,-2.317654253e-05,-6.452901289e-05,
-	-9.033163951e-05,-9.443127055e-05,-7.59287941e-05,-3.87657783e-05,9.449059689e-06,
-	5.615100963e-05,9.033197421e-05,0.0001028495099,9.118586604e-05, 5.68892392e-05,
-	8.40867051e-06,-4.372416151e-05,-8.615159459e-05,-0.0001091325175,-0.000105782965,
-	-7.714087405e-05,-2.872337063e-05,2.733708425e-05,7.852949057e-05, 0.000111481655,
-	0.0001187212692,9.697287896e-05,5.179869913e-05,-7.459907465e-06,-6.574316649e-05,
-	-0.0001100434383,-0.000128343032,-0.0001164141795,-7.594287308e-05,-1.635204171e-05,
-	4.880846609e-05,0.0001032466098,0.0001345169294,0.0001336807909,0.0001008622639,
-	4.262120274e-05,-2.674418283e-05,-9.16302306e-05,-0.0001355492277,-0.000148149571,
-	-0.0001248606277,-7.134921907e-05,8.905813615e-07,7.406969962e-05,0.0001314299734,
-	0.0001580124372,0.0001475279714,0.0001008399704, 2.92336299e-05,-5.13918967e-05,
-	-0.0001209451802,-0.000163256831,-0.0001667605102,-0.0001305301848,-6.179667253e-05,
-	2.300380038e-05,0.0001043398952,0.0001619356917, 0.000182167787,0.0001585173013,
-	9.661975491e-05, 9.81701487e-06,-8.081761189e-05,-0.0001542641694,-0.0001916653273,
-	-0.0001841019548,-0.0001317107235,-4.691025606e-05,5.132969818e-05,0.0001388096425,
-	0.0001950253209,0.0002050704352,0.0001663789153,8.647278446e-05,-1.547742431e-05,
-	-0.000116128831,-0.0001904406963,-0.0002207818761,-0.0001982487302,-0.000127940526,
-	-2.511911225e-05,8.546155004e-05,0.0001779855666,0.0002291462588,0.0002265389048,
-	0.0001689601486,7.004643703e-05,-4.803107367e-05,-0.0001564605191,-0.0002296944876,
-	-0.0002487130114,-0.0002086663153,-0.0001172473712,3.744317382e-06,0.0001265003666,
-	0.0002207835932,0.0002641365281, 0.000244375231,0.0001658216643,4.553793406e-05,
-	-8.757130126e-05,-0.000202495823,-0.0002704916988,-0.0002750467684,-0.0002131527872,
-	-9.920748562e-05,4.105569315e-05,0.0001736959821, 0.000267364434,0.0002980901918,
-	0.0002580491127,0.0001548144646,1.287169198e-05,-0.0001351618848,-0.0002530039346,
-	-0.0003125211806,-0.0002976058458,-0.0002112085785,-7.207217277e-05,8.650526433e-05,
-	0.0002275048464,0.0003159641637,0.0003303968988,0.0002652821713,0.0001356119901,
-	-2.934057738e-05,-0.0001898063638,-0.0003078330774, -0.00035355828,-0.0003154565638,
-	-0.0002004885755,-3.565941006e-05, 0.000140974691,0.0002864251728,0.0003658945789,
-	0.0003584204824,0.0002650150855,0.0001058889902,-8.105678717e-05,-0.0002521221177,
-	-0.0003651268489,-0.0003926612844,-0.0003259072255,-0.0001799925376,1.206611614e-05,
-	0.0002041496627,0.0003508137015, 0.000415277289,0.0003813696385,0.0002548626508,
-	6.529009261e-05,-0.000143567042,-0.0003210932482,-0.0004247977922,-0.0004278086999,
-	-0.0003284104168,-0.0001480706997,7.050468412e-05,0.0002761236392,0.0004184570571,
-	0.0004629311152,0.0003965100041,0.0002340371138,1.226123914e-05,-0.0002157590352,
-	-0.0003960564209,-0.0004837567394,-0.0004569681769,-0.0003195435565,-0.000103379316,
-	0.0001415450824,0.0003561569611,0.0004890653654,0.0005062734708,0.0004024625523,
-	0.0001999198139,-5.361029616e-05,-0.0002986990148,-0.0004756221606,-0.0005414389889,
-	-0.000477835536,-0.0002986828913,-4.45092337e-05,0.0002241375914, 0.000443609315,
-	0.0005596828414,0.0005434619961,0.0003960463509,0.0001514364412,-0.0001338283473,
-	-0.00039115033,-0.0005589277134,-0.0005947281606,-0.0004885192029,-0.0002628859365,
-	2.920670522e-05,0.0003192492877,0.0005368641578,0.0006292508915,0.0005715639563,
-	0.0003759445681,8.655586134e-05,-0.0002278906904,-0.0004928617855,-0.0006432723021,
-	-0.000641806866,-0.0004857650492,-0.000210853832,0.0001193739663,0.0004258008266,
-	0.0006350449985,0.0006946622743,0.0005886164145,0.0003391483915,4.582188012e-06,
-	-0.0003366464516,-0.0006020035362,-0.0007271785871,-0.0006792692002,-0.0004676966346,
-	-0.0001401289774,0.0002259292087,0.0005437104264,0.0007355111302,  0.00075386354,
-	0.0005910520558,0.0002839887748, -9.6403528e-05,-0.0004592619371,-0.0007177147199,
-	-0.0008074376383,-0.0007048280095,-0.0004309638462,-4.958776481e-05,0.0003499325539,
-	0.0006712858449,0.0008366167895,0.0008031947073,0.0005765460664,0.0002075392404,
-	-0.0002167839848,-0.000595899648,-0.0008374282042,-0.0008817649796,-0.0007146156277,
-	-0.0003734321217,6.306184514e-05,0.0004909188137,0.0008077333914,0.0009351036861,
-	0.0008400170482,  0.00054132269,0.0001081797163,-0.0003579796467,-0.0007450949051,
-	-0.0009594585281,-0.0009463323513,-0.0007058557821,-0.0002917398233,0.0001986694842,
-	0.0006492520333,0.0009505717317, 0.001028427389,0.0008600918227,0.0004826869117,
-	-1.688261364e-05,-0.0005199431907,-0.0009061872261,-0.001080448041,-0.0009980391478,
-	-0.0006742291735,-0.0001835566654, 0.000359187834,0.0008238944574, 0.001098144334,
-	0.001112546423,0.0008600320434,0.0003965826763,-0.0001692519727,-0.0007035960443,
-	-0.001077034976,-0.001197771402,-0.001032293309,-0.0006163030048,-4.532932871e-05,
-	0.0005453876802, 0.001014665817, 0.001247298438, 0.001184070599,0.0008349777781,
-	0.000279812084,-0.0003517553851,-0.0009086881182, -0.00125638186,-0.001307427185,
-	-0.001045232289,-0.0005273103015, 0.000125542676,0.0007590322639, 0.001220120466,
-	0.001395604922, 0.001238216762,0.0007807888323,0.0001279378048,-0.0005661559408,
-	-0.001135759288,-0.001441448694,-0.001405821764,-0.001031373162,-0.0004029426782,
-	0.0003330187465, 0.001000946853, 0.001439533196, 0.001539078075, 0.001270395122,
-	0.0006914915284,-6.325624418e-05,-0.000815741485,-0.001384590403,-0.001630303916,
-	-0.001487901318,-0.0009854087839,-0.0002371070586,0.0005808808492, 0.001273427508,
-	0.001671442646, 0.001674496103, 0.001274613547,0.0005613365793,-0.0002996331314,
-	-0.001103427145,-0.001656105043,-0.001819918747,-0.001548970118,-0.0009003411396,
-	-2.369846516e-05,0.0008745174855,  0.00157826161, 0.001915094093, 0.001796996454,
-	0.001244485378,0.0003822161525,-0.0005876606447,-0.001434110571, -0.00195085723,
-	-0.002007797128, -0.00158234057,-0.0007682044525,0.0002463193669, 0.001220525126,
-	0.001919530798, 0.002169557149, 0.001902179327, 0.001171503332, 0.000144798847,
-	-0.0009368592873,-0.001813844894,-0.002271365141,-0.002190711442, -0.00158099574,
-	-0.0005781801883, 0.000583832094, 0.001628748607, 0.002302299952,  0.00243505463,
-	0.001983704278, 0.001045246259,-0.0001646671153,-0.001359974267,-0.002252758248,
-	-0.002621318679,-0.002366055036, -0.00153489504,-0.0003160092165, 0.001005589496,
-	0.002113421913, 0.002736140043, 0.002712732879, 0.002034773352,0.0008507663733,
-	-0.0005650414387,-0.001876906957,-0.002765957732,-0.003008402651, -0.00253053871,
-	-0.001431001816,3.998509419e-05, 0.001536274212, 0.002697864315, 0.003236283781,
-	0.003006719286, 0.002045448637,0.0005664827186,-0.001086536096,-0.002518914873,
-	-0.003379622707,-0.003446019255,-0.002681692597,-0.001249155262,0.0005232328549,
-	0.00221686624, 0.003420461668,  0.00383022381, 0.003325096797, 0.002001798246,
-	0.0001567462896, -0.00177896081,-0.003340423107, -0.00413919799,-0.003959947266,
-	-0.002816624707,-0.0009567128727,  0.00119217555, 0.003119154368, 0.004351387266,
-	0.004568556324, 0.003685609205, 0.001880133874,-0.0004412706185,-0.002734180074,
-	-0.004442338366,-0.005132097751,-0.004600538872,-0.002933106385,-0.0004925664398,
-	0.002157898154, 0.004383842926,  0.00562935276, 0.005554713309,  0.00412603002,
-	0.00163592922,-0.001354660722,-0.004140452016,-0.006036557723,-0.006544036791,
-	-0.005478744395,-0.003028908977,0.0002732282737, 0.003664726391, 0.006324836984,
-	0.007570703048, 0.007028272375, 0.004738171119, 0.001166434377,-0.002885448281,
-	-0.006456364878,-0.008648139425,-0.008845867589,-0.006881807465, -0.00310243899,
-	0.001684241113,   0.0063740802, 0.009813656099,  0.01107384823, 0.009688549675,
-	0.005798724014,0.0001630804036,-0.005977367051, -0.01115803421, -0.01402246207,
-	-0.01365422085,-0.009833444841,-0.003152166726, 0.005047948565,  0.01291677542,
-	0.01847541332,  0.02006237209,  0.01675297879, 0.008659393527,-0.002963533858,
-	-0.01584405079, -0.02704343572, -0.03347456828, -0.03249680996, -0.02247304469,
-	-0.003177302191,  0.02403537184,  0.05634154007,   0.0898366496,   0.1201354265,
-	0.1430815309,   0.1554389447,   0.1554389447,   0.1430815309,   0.1201354265,
-	0.0898366496,  0.05634154007,  0.02403537184,-0.003177302191, -0.02247304469,
-	-0.03249680996, -0.03347456828, -0.02704343572, -0.01584405079,-0.002963533858,
-	0.008659393527,  0.01675297879,  0.02006237209,  0.01847541332,  0.01291677542,
-	0.005047948565,-0.003152166726,-0.009833444841, -0.01365422085, -0.01402246207,
-	-0.01115803421,-0.005977367051,0.0001630804036, 0.005798724014, 0.009688549675,
-	0.01107384823, 0.009813656099,   0.0063740802, 0.001684241113, -0.00310243899,
-	-0.006881807465,-0.008845867589,-0.008648139425,-0.006456364878,-0.002885448281,
-	0.001166434377, 0.004738171119, 0.007028272375, 0.007570703048, 0.006324836984,
-	0.003664726391,0.0002732282737,-0.003028908977,-0.005478744395,-0.006544036791,
-	-0.006036557723,-0.004140452016,-0.001354660722,  0.00163592922,  0.00412603002,
-	0.005554713309,  0.00562935276, 0.004383842926, 0.002157898154,-0.0004925664398,
-	-0.002933106385,-0.004600538872,-0.005132097751,-0.004442338366,-0.002734180074,
-	-0.0004412706185, 0.001880133874, 0.003685609205, 0.004568556324, 0.004351387266,
-	0.003119154368,  0.00119217555,-0.0009567128727,-0.002816624707,-0.003959947266,
-	-0.00413919799,-0.003340423107, -0.00177896081,0.0001567462896, 0.002001798246,
-	0.003325096797,  0.00383022381, 0.003420461668,  0.00221686624,0.0005232328549,
-	-0.001249155262,-0.002681692597,-0.003446019255,-0.003379622707,-0.002518914873,
-	-0.001086536096,0.0005664827186, 0.002045448637, 0.003006719286, 0.003236283781,
-	0.002697864315, 0.001536274212,3.998509419e-05,-0.001431001816, -0.00253053871,
-	-0.003008402651,-0.002765957732,-0.001876906957,-0.0005650414387,0.0008507663733,
-	0.002034773352, 0.002712732879, 0.002736140043, 0.002113421913, 0.001005589496,
-	-0.0003160092165, -0.00153489504,-0.002366055036,-0.002621318679,-0.002252758248,
-	-0.001359974267,-0.0001646671153, 0.001045246259, 0.001983704278,  0.00243505463,
-	0.002302299952, 0.001628748607, 0.000583832094,-0.0005781801883, -0.00158099574,
-	-0.002190711442,-0.002271365141,-0.001813844894,-0.0009368592873, 0.000144798847,
-	0.001171503332, 0.001902179327, 0.002169557149, 0.001919530798, 0.001220525126,
-	0.0002463193669,-0.0007682044525, -0.00158234057,-0.002007797128, -0.00195085723,
-	-0.001434110571,-0.0005876606447,0.0003822161525, 0.001244485378, 0.001796996454,
-	0.001915094093,  0.00157826161,0.0008745174855,-2.369846516e-05,-0.0009003411396,
-	-0.001548970118,-0.001819918747,-0.001656105043,-0.001103427145,-0.0002996331314,
-	0.0005613365793, 0.001274613547, 0.001674496103, 0.001671442646, 0.001273427508,
-	0.0005808808492,-0.0002371070586,-0.0009854087839,-0.001487901318,-0.001630303916,
-	-0.001384590403,-0.000815741485,-6.325624418e-05,0.0006914915284, 0.001270395122,
-	0.001539078075, 0.001439533196, 0.001000946853,0.0003330187465,-0.0004029426782,
-	-0.001031373162,-0.001405821764,-0.001441448694,-0.001135759288,-0.0005661559408,
-	0.0001279378048,0.0007807888323, 0.001238216762, 0.001395604922, 0.001220120466,
-	0.0007590322639, 0.000125542676,-0.0005273103015,-0.001045232289,-0.001307427185,
-	-0.00125638186,-0.0009086881182,-0.0003517553851, 0.000279812084,0.0008349777781,
-	0.001184070599, 0.001247298438, 0.001014665817,0.0005453876802,-4.532932871e-05,
-	-0.0006163030048,-0.001032293309,-0.001197771402,-0.001077034976,-0.0007035960443,
-	-0.0001692519727,0.0003965826763,0.0008600320434, 0.001112546423, 0.001098144334,
-	0.0008238944574, 0.000359187834,-0.0001835566654,-0.0006742291735,-0.0009980391478,
-	-0.001080448041,-0.0009061872261,-0.0005199431907,-1.688261364e-05,0.0004826869117,
-	0.0008600918227, 0.001028427389,0.0009505717317,0.0006492520333,0.0001986694842,
-	-0.0002917398233,-0.0007058557821,-0.0009463323513,-0.0009594585281,-0.0007450949051,
-	-0.0003579796467,0.0001081797163,  0.00054132269,0.0008400170482,0.0009351036861,
-	0.0008077333914,0.0004909188137,6.306184514e-05,-0.0003734321217,-0.0007146156277,
-	-0.0008817649796,-0.0008374282042,-0.000595899648,-0.0002167839848,0.0002075392404,
-	0.0005765460664,0.0008031947073,0.0008366167895,0.0006712858449,0.0003499325539,
-	-4.958776481e-05,-0.0004309638462,-0.0007048280095,-0.0008074376383,-0.0007177147199,
-	-0.0004592619371, -9.6403528e-05,0.0002839887748,0.0005910520558,  0.00075386354,
-	0.0007355111302,0.0005437104264,0.0002259292087,-0.0001401289774,-0.0004676966346,
-	-0.0006792692002,-0.0007271785871,-0.0006020035362,-0.0003366464516,4.582188012e-06,
-	0.0003391483915,0.0005886164145,0.0006946622743,0.0006350449985,0.0004258008266,
-	0.0001193739663,-0.000210853832,-0.0004857650492,-0.000641806866,-0.0006432723021,
-	-0.0004928617855,-0.0002278906904,8.655586134e-05,0.0003759445681,0.0005715639563,
-	0.0006292508915,0.0005368641578,0.0003192492877,2.920670522e-05,-0.0002628859365,
-	-0.0004885192029,-0.0005947281606,-0.0005589277134, -0.00039115033,-0.0001338283473,
-	0.0001514364412,0.0003960463509,0.0005434619961,0.0005596828414, 0.000443609315,
-	0.0002241375914,-4.45092337e-05,-0.0002986828913,-0.000477835536,-0.0005414389889,
-	-0.0004756221606,-0.0002986990148,-5.361029616e-05,0.0001999198139,0.0004024625523,
-	0.0005062734708,0.0004890653654,0.0003561569611,0.0001415450824,-0.000103379316,
-	-0.0003195435565,-0.0004569681769,-0.0004837567394,-0.0003960564209,-0.0002157590352,
-	1.226123914e-05,0.0002340371138,0.0003965100041,0.0004629311152,0.0004184570571,
-	0.0002761236392,7.050468412e-05,-0.0001480706997,-0.0003284104168,-0.0004278086999,
-	-0.0004247977922,-0.0003210932482,-0.000143567042,6.529009261e-05,0.0002548626508,
-	0.0003813696385, 0.000415277289,0.0003508137015,0.0002041496627,1.206611614e-05,
-	-0.0001799925376,-0.0003259072255,-0.0003926612844,-0.0003651268489,-0.0002521221177,
-	-8.105678717e-05,0.0001058889902,0.0002650150855,0.0003584204824,0.0003658945789,
-	0.0002864251728, 0.000140974691,-3.565941006e-05,-0.0002004885755,-0.0003154565638,
-	-0.00035355828,-0.0003078330774,-0.0001898063638,-2.934057738e-05,0.0001356119901,
-	0.0002652821713,0.0003303968988,0.0003159641637,0.0002275048464,8.650526433e-05,
-	-7.207217277e-05,-0.0002112085785,-0.0002976058458,-0.0003125211806,-0.0002530039346,
-	-0.0001351618848,1.287169198e-05,0.0001548144646,0.0002580491127,0.0002980901918,
-	0.000267364434,0.0001736959821,4.105569315e-05,-9.920748562e-05,-0.0002131527872,
-	-0.0002750467684,-0.0002704916988,-0.000202495823,-8.757130126e-05,4.553793406e-05,
-	0.0001658216643, 0.000244375231,0.0002641365281,0.0002207835932,0.0001265003666,
-	3.744317382e-06,-0.0001172473712,-0.0002086663153,-0.0002487130114,-0.0002296944876,
-	-0.0001564605191,-4.803107367e-05,7.004643703e-05,0.0001689601486,0.0002265389048,
-	0.0002291462588,0.0001779855666,8.546155004e-05,-2.511911225e-05,-0.000127940526,
-	-0.0001982487302,-0.0002207818761,-0.0001904406963,-0.000116128831,-1.547742431e-05,
-	8.647278446e-05,0.0001663789153,0.0002050704352,0.0001950253209,0.0001388096425,
-	5.132969818e-05,-4.691025606e-05,-0.0001317107235,-0.0001841019548,-0.0001916653273,
-	-0.0001542641694,-8.081761189e-05, 9.81701487e-06,9.661975491e-05,0.0001585173013,
-	0.000182167787,0.0001619356917,0.0001043398952,2.300380038e-05,-6.179667253e-05,
-	-0.0001305301848,-0.0001667605102,-0.000163256831,-0.0001209451802,-5.13918967e-05,
-	2.92336299e-05,0.0001008399704,0.0001475279714,0.0001580124372,0.0001314299734,
-	7.406969962e-05,8.905813615e-07,-7.134921907e-05,-0.0001248606277,-0.000148149571,
-	-0.0001355492277,-9.16302306e-05,-2.674418283e-05,4.262120274e-05,0.0001008622639,
-	0.0001336807909,0.0001345169294,0.0001032466098,4.880846609e-05,-1.635204171e-05,
-	-7.594287308e-05,-0.0001164141795,-0.000128343032,-0.0001100434383,-6.574316649e-05,
-	-7.459907465e-06,5.179869913e-05,9.697287896e-05,0.0001187212692, 0.000111481655,
-	7.852949057e-05,2.733708425e-05,-2.872337063e-05,-7.714087405e-05,-0.000105782965,
-	-0.0001091325175,-8.615159459e-05,-4.372416151e-05, 8.40867051e-06, 5.68892392e-05,
-	9.118586604e-05,0.0001028495099,9.033197421e-05,5.615100963e-05,9.449059689e-06,
-	-3.87657783e-05,-7.59287941e-05,-9.443127055e-05,-9.033163951e-05,-6.452901289e-05,
-	-2.317654253e-05,2.156013761e-05,6.160480552e-05,8.483659622e-05,8.802492812e-05,
-	6.906738417e-05,3.423865564e-05,-9.053335816e-06,-4.900405111e-05,-7.698727131e-05,
-	-8.508510655e-05,-7.240760169e-05,-4.102096864e-05,2.329196747e-07,4.192777124e-05,
-	7.203491987e-05,8.275178698e-05,6.816920359e-05, 2.96237522e-05,-2.867951298e-05,
-	-9.668228449e-05,-0.0001648709585,-0.0002227080986,-0.0002655026619,-0.0002925412846,
-	-0.0003130997356,-0.0003438273852,-0.0004148345906,0.0005150511861
-};
+	// the bank is only selected here, it is built once in the layouts the kernels read
+	m_gain = 1.0;
+	m_bank = filterBank(phases, tapsPerPhase, cutoff, gain, m_fixedPoint, m_useFFT ? fftSize : 0);
+	m_alignedTaps = m_bank->taps;
+	m_fixedTaps = m_fixedPoint ? &m_bank->fixedTaps[0] : NULL;
+	m_fixedShift = m_fixedPoint ? m_bank->fixedShift : 15;
 
-static const float H17[1024] = {
-	-0.0005916813971,0.0002950166236,0.0002850610763,0.0002935571247,0.0003014556714,
-	0.0002931949275,0.0002620814194,0.0002071836789, 0.000136393588,6.052008393e-05,
-	-6.015064628e-06,-5.24530551e-05,-7.079247735e-05,-6.144262443e-05,-2.941127423e-05,
-	1.325295216e-05, 5.43333008e-05,8.071245975e-05,8.566612087e-05,6.649934949e-05,
-	2.938868238e-05,-1.675102976e-05,-5.793089076e-05,-8.426898421e-05,-8.636236453e-05,
-	-6.548426609e-05,-2.53112612e-05,2.301010318e-05,6.517373549e-05,9.038155986e-05,
-	9.170422709e-05,6.765870057e-05,2.447603765e-05,-2.67122432e-05,-7.149443263e-05,
-	-9.787458112e-05,-9.775888611e-05,-7.110169099e-05,-2.409496301e-05,3.035190275e-05,
-	7.804886991e-05,0.0001052618682,0.0001046106991,7.508109411e-05,2.460872201e-05,
-	-3.404642484e-05,-8.451881877e-05,-0.0001133843471,-0.0001116878557,-7.986861601e-05,
-	-2.503619544e-05,3.728641241e-05,9.148593381e-05,0.0001216174496,0.0001195221703,
-	8.463609993e-05,2.625855632e-05,-4.101148443e-05,-9.841449355e-05,-0.0001305968035,
-	-0.0001276142575,-9.013254748e-05,-2.700853111e-05,4.458573312e-05,0.0001059686692,
-	0.0001396331209,0.0001363645861,9.564469656e-05,2.828068136e-05,-4.85500932e-05,
-	-0.0001136122955,-0.0001494765893,-0.0001452507131,-0.0001016639508,-2.927689457e-05,
-	5.242909901e-05,0.0001219457263, 0.000159471223,0.0001548726432,0.0001077032721,
-	3.053314867e-05,-5.68510186e-05,-0.0001303570025,-0.0001703513117,-0.0001645826414,
-	-0.0001142292458,-3.147827374e-05,6.123644562e-05,0.0001395468862,0.0001813035487,
-	0.000174982124,0.0001206886664,3.276044663e-05,-6.618559564e-05,-0.0001488929847,
-	-0.0001931422012,-0.0001855406881,-0.0001276727853,-3.367628233e-05,7.113153697e-05,
-	0.0001589666063,0.0002052012715,0.0001968458091,0.0001346086356,3.485306297e-05,
-	-7.666609599e-05,-0.0001693216618,-0.000218076093,-0.0002083316358,-0.0001421014167,
-	-3.569722685e-05,8.224486373e-05,0.0001804186613,0.0002312667202,0.0002205964993,
-	0.0001495816541,3.682174793e-05,-8.839590009e-05,-0.0001917865884,-0.0002453589113,
-	-0.0002330929128,-0.0001575854258,-3.758967796e-05,9.463157039e-05,0.0002039657556,
-	0.0002597610292,0.0002463473938,0.0001656026725,3.858376294e-05,-0.0001015032321,
-	-0.0002164412581,-0.0002750319254,-0.0002598432766,-0.0001740643202,-3.925329656e-05,
-	0.0001084882024, 0.000229747151,0.0002906788141,0.0002740466734,0.0001825330546,
-	4.002601418e-05,-0.0001161545151,-0.000243465809,-0.0003072188993,-0.0002885495487,
-	-0.0001914300956,-4.042037835e-05,0.0001240762795,0.0002580674191,0.0003242278181,
-	0.0003038113646,0.0002003600239,4.090154107e-05,-0.0001326958445,-0.000273195823,
-	-0.0003422353766,-0.0003194558667,-0.0002097908437,-4.107112909e-05,0.0001415916922,
-	0.0002892267075,0.0003608167463,0.0003359566617,0.0002193386026,  4.1344083e-05,
-	-0.0001511327428,-0.0003057885333,-0.0003803512664,-0.0003528727684,-0.0002293586876,
-	-4.134749179e-05,0.0001609526662,0.0003232051677,0.0004004275834,0.0003705064883,
-	0.0002394317562,4.133964831e-05,-0.0001714933896,-0.000341239007,-0.0004214501823,
-	-0.0003885427723,-0.0002498274262,-4.086134868e-05,0.0001825549989,0.0003603690711,
-	0.0004432657151, 0.000407453801,0.0002603736066,4.034922313e-05,-0.0001944544638,
-	-0.0003802975989,-0.0004662353313,-0.0004270155623,-0.0002714864095,-3.960977847e-05,
-	0.0002067087335,0.0004011765704,0.0004899200867,0.0004473973822, 0.000282735622,
-	3.882342207e-05,-0.0002197218419,-0.0004227808968,-0.0005146150943,-0.0004682434956,
-	-0.0002942609717,-3.751995973e-05,0.0002334509336,0.0004456270544,0.0005402680254,
-	0.0004900440108,0.0003059734008,3.605481834e-05,-0.0002481287229,-0.0004695042735,
-	-0.0005672653206,-0.0005126661854,-0.0003182951477,-3.438729982e-05, 0.000263269787,
-	0.0004944226239,0.0005950810737,0.0005361014046,0.0003306877625,3.245456537e-05,
-	-0.0002794320171,-0.0005203938344,-0.0006241626106,-0.0005602128804,-0.0003434208047,
-	-2.994515489e-05,0.0002965241729,0.0005478810635,0.0006545729702,0.0005855706986,
-	0.0003566136293,2.745590245e-05,-0.0003144294606,-0.0005763401859,-0.0006861889851,
-	-0.0006116179866,-0.0003701380629,-2.441705328e-05,0.0003332525957,0.0006062456523,
-	0.000719033822,0.0006387012545,0.0003838199191,2.095079617e-05,-0.0003533899726,
-	-0.0006376849487,-0.0007536377525,-0.0006669937284,-0.000398260192,-1.729139876e-05,
-	0.0003741982218,0.0006703866529,0.0007893071161,0.0006961324834,0.0004126508138,
-	1.292457e-05,-0.0003966267977,-0.0007049461128,-0.0008270207909,-0.0007266915054,
-	-0.0004278612614,-8.317498214e-06,0.0004199097166, 0.000740999938,0.0008660730673,
-	0.0007583117113,0.0004431817506,3.046415486e-06,-0.000444833131,-0.0007789980154,
-	-0.0009072110406,-0.0007913606823,-0.0004592191253,2.670735057e-06,0.0004709403147,
-	0.0008188614156,0.0009500854649,0.0008257973241, 0.000475584704,-8.960078048e-06,
-	-0.0004986920976,-0.0008607583004,-0.0009951293468,-0.0008616857813,-0.0004925801186,
-	1.591897308e-05,0.0005279628094,0.0009049008368, 0.001042276854,0.0008992382209,
-	0.0005100459093,-2.347596092e-05,-0.0005590412766,-0.0009513288969,-0.001091845799,
-	-0.0009384193108,-0.000528161705, 3.18311686e-05,0.0005919264513, 0.001000374788,
-	0.001143894158,0.0009795188671,0.0005468435702,-4.090776201e-05,-0.0006269165897,
-	-0.00105210836,-0.001198762679,-0.001022561337,-0.0005662912154,5.088017133e-05,
-	0.0006640059291, 0.001106871292, 0.001256524003, 0.001067824429,0.0005864100531,
-	-6.170508277e-05,-0.0007035523886,-0.001164808753,-0.001317604096,-0.001115398481,
-	-0.0006074425764,7.355942216e-05,0.0007455727318, 0.001226297463, 0.001382109476,
-	0.001165593276,0.0006292819744,-8.64370304e-05,-0.0007904806989,-0.001291553257,
-	-0.001450523152,-0.001218515914,-0.0006521557225,0.0001005715967,0.0008384222747,
-	0.001361102914, 0.001523113111, 0.001274618204,0.0006760519464,-0.000115928975,
-	-0.0008898213273,-0.001435224898,-0.001600437448,-0.001334067318,-0.0007012084825,
-	0.0001327870268, 0.000944915344, 0.001514569507, 0.001682881499,  0.00139740482,
-	0.0007276557153,-0.0001511274895,-0.001004223712,-0.001599535462, -0.00177113479,
-	-0.001464901026,-0.0007556800847,0.0001712659432, 0.001068068203, 0.001690909034,
-	0.001865718979, 0.001537166419,0.0007852848503,-0.000193314394,-0.001137198065,
-	-0.001789374161, -0.00196759426,-0.001614690758,-0.0008168485365,0.0002176331618,
-	0.001212128322, 0.001895985566, 0.002077590674, 0.001698339591,0.0008505354635,
-	-0.0002443276171,-0.001293721492,-0.002011657692,-0.002196914982,-0.001788788708,
-	-0.0008867677534,0.0002738642797, 0.001382768736, 0.002137806267, 0.002326750429,
-	0.001887145685,0.0009257566417,-0.0003065614437,-0.001480550854,-0.002275901847,
-	-0.002468869556,-0.001994527178,-0.0009681098745,0.0003429961216, 0.001588278566,
-	0.002427971456, 0.002625127556, 0.002112567192, 0.001014310634,-0.0003835862735,
-	-0.001707660151, -0.00259616063,-0.002797983121,-0.002242913703,-0.001065103454,
-	0.0004292183439, 0.001840663725, 0.002783496631, 0.002990341745, 0.002387954621,
-	0.001121226465, -0.00048071114,-0.001989991171,-0.002993545961,-0.003206123598,
-	-0.002550500678,-0.001183927292,0.0005392775056,  0.00215875986, 0.003231024137,
-	0.003450047923,  0.00273434585, 0.001254511764,-0.0006062741159,-0.002351249335,
-	-0.003501795232,-0.003728445852,-0.002944143722,-0.001334871515,0.0006837772089,
-	0.002572931815, 0.003813909367, 0.004049554467, 0.003186393762, 0.001427384792,
-	-0.0007742625312, -0.00283130398,-0.004177922849,-0.004424692132,-0.003469684394,
-	-0.001535519725,0.0008812820888, 0.003136373591, 0.004608530551, 0.004869220313,
-	0.003806055989, 0.001663790317,-0.001009747968,-0.003502597101,-0.005126455799,
-	-0.00540532684,-0.004212630447,-0.001818962162, 0.001166951843, 0.003950836137,
-	0.005762342364, 0.006065635476, 0.004715159535, 0.002011097036, -0.00136348512,
-	-0.004512718413,-0.006562572438,-0.006900320761,-0.005353152752,-0.002255888889,
-	0.001616510679, 0.005238670856, 0.007602132391, 0.007990865968, 0.006191791967,
-	0.002579321386,-0.001954482635,-0.006214272697,-0.009009477682,-0.009479056112,
-	-0.007345727179,-0.003028021893, 0.002429120708, 0.007596940268,    0.011025263,
-	0.01163482387,  0.00903756544, 0.003693986218, -0.00314497482,-0.009712337516,
-	-0.01415879093, -0.01504445728, -0.01176390797,-0.004788879305, 0.004349982366,
-	0.0133595271,  0.01970803365,  0.02126442268,  0.01690430753, 0.006930585485,
-	-0.00680934079, -0.02116412856, -0.03224976733, -0.03624593467, -0.03025250137,
-	-0.0130182663,   0.0146279633,  0.04975550994,  0.08774564415,   0.1230730191,
-	0.1503048688,   0.1651168615,   0.1651168615,   0.1503048688,   0.1230730191,
-	0.08774564415,  0.04975550994,   0.0146279633,  -0.0130182663, -0.03025250137,
-	-0.03624593467, -0.03224976733, -0.02116412856, -0.00680934079, 0.006930585485,
-	0.01690430753,  0.02126442268,  0.01970803365,   0.0133595271, 0.004349982366,
-	-0.004788879305, -0.01176390797, -0.01504445728, -0.01415879093,-0.009712337516,
-	-0.00314497482, 0.003693986218,  0.00903756544,  0.01163482387,    0.011025263,
-	0.007596940268, 0.002429120708,-0.003028021893,-0.007345727179,-0.009479056112,
-	-0.009009477682,-0.006214272697,-0.001954482635, 0.002579321386, 0.006191791967,
-	0.007990865968, 0.007602132391, 0.005238670856, 0.001616510679,-0.002255888889,
-	-0.005353152752,-0.006900320761,-0.006562572438,-0.004512718413, -0.00136348512,
-	0.002011097036, 0.004715159535, 0.006065635476, 0.005762342364, 0.003950836137,
-	0.001166951843,-0.001818962162,-0.004212630447, -0.00540532684,-0.005126455799,
-	-0.003502597101,-0.001009747968, 0.001663790317, 0.003806055989, 0.004869220313,
-	0.004608530551, 0.003136373591,0.0008812820888,-0.001535519725,-0.003469684394,
-	-0.004424692132,-0.004177922849, -0.00283130398,-0.0007742625312, 0.001427384792,
-	0.003186393762, 0.004049554467, 0.003813909367, 0.002572931815,0.0006837772089,
-	-0.001334871515,-0.002944143722,-0.003728445852,-0.003501795232,-0.002351249335,
-	-0.0006062741159, 0.001254511764,  0.00273434585, 0.003450047923, 0.003231024137,
-	0.00215875986,0.0005392775056,-0.001183927292,-0.002550500678,-0.003206123598,
-	-0.002993545961,-0.001989991171, -0.00048071114, 0.001121226465, 0.002387954621,
-	0.002990341745, 0.002783496631, 0.001840663725,0.0004292183439,-0.001065103454,
-	-0.002242913703,-0.002797983121, -0.00259616063,-0.001707660151,-0.0003835862735,
-	0.001014310634, 0.002112567192, 0.002625127556, 0.002427971456, 0.001588278566,
-	0.0003429961216,-0.0009681098745,-0.001994527178,-0.002468869556,-0.002275901847,
-	-0.001480550854,-0.0003065614437,0.0009257566417, 0.001887145685, 0.002326750429,
-	0.002137806267, 0.001382768736,0.0002738642797,-0.0008867677534,-0.001788788708,
-	-0.002196914982,-0.002011657692,-0.001293721492,-0.0002443276171,0.0008505354635,
-	0.001698339591, 0.002077590674, 0.001895985566, 0.001212128322,0.0002176331618,
-	-0.0008168485365,-0.001614690758, -0.00196759426,-0.001789374161,-0.001137198065,
-	-0.000193314394,0.0007852848503, 0.001537166419, 0.001865718979, 0.001690909034,
-	0.001068068203,0.0001712659432,-0.0007556800847,-0.001464901026, -0.00177113479,
-	-0.001599535462,-0.001004223712,-0.0001511274895,0.0007276557153,  0.00139740482,
-	0.001682881499, 0.001514569507, 0.000944915344,0.0001327870268,-0.0007012084825,
-	-0.001334067318,-0.001600437448,-0.001435224898,-0.0008898213273,-0.000115928975,
-	0.0006760519464, 0.001274618204, 0.001523113111, 0.001361102914,0.0008384222747,
-	0.0001005715967,-0.0006521557225,-0.001218515914,-0.001450523152,-0.001291553257,
-	-0.0007904806989,-8.64370304e-05,0.0006292819744, 0.001165593276, 0.001382109476,
-	0.001226297463,0.0007455727318,7.355942216e-05,-0.0006074425764,-0.001115398481,
-	-0.001317604096,-0.001164808753,-0.0007035523886,-6.170508277e-05,0.0005864100531,
-	0.001067824429, 0.001256524003, 0.001106871292,0.0006640059291,5.088017133e-05,
-	-0.0005662912154,-0.001022561337,-0.001198762679, -0.00105210836,-0.0006269165897,
-	-4.090776201e-05,0.0005468435702,0.0009795188671, 0.001143894158, 0.001000374788,
-	0.0005919264513, 3.18311686e-05,-0.000528161705,-0.0009384193108,-0.001091845799,
-	-0.0009513288969,-0.0005590412766,-2.347596092e-05,0.0005100459093,0.0008992382209,
-	0.001042276854,0.0009049008368,0.0005279628094,1.591897308e-05,-0.0004925801186,
-	-0.0008616857813,-0.0009951293468,-0.0008607583004,-0.0004986920976,-8.960078048e-06,
-	0.000475584704,0.0008257973241,0.0009500854649,0.0008188614156,0.0004709403147,
-	2.670735057e-06,-0.0004592191253,-0.0007913606823,-0.0009072110406,-0.0007789980154,
-	-0.000444833131,3.046415486e-06,0.0004431817506,0.0007583117113,0.0008660730673,
-	0.000740999938,0.0004199097166,-8.317498214e-06,-0.0004278612614,-0.0007266915054,
-	-0.0008270207909,-0.0007049461128,-0.0003966267977,   1.292457e-05,0.0004126508138,
-	0.0006961324834,0.0007893071161,0.0006703866529,0.0003741982218,-1.729139876e-05,
-	-0.000398260192,-0.0006669937284,-0.0007536377525,-0.0006376849487,-0.0003533899726,
-	2.095079617e-05,0.0003838199191,0.0006387012545, 0.000719033822,0.0006062456523,
-	0.0003332525957,-2.441705328e-05,-0.0003701380629,-0.0006116179866,-0.0006861889851,
-	-0.0005763401859,-0.0003144294606,2.745590245e-05,0.0003566136293,0.0005855706986,
-	0.0006545729702,0.0005478810635,0.0002965241729,-2.994515489e-05,-0.0003434208047,
-	-0.0005602128804,-0.0006241626106,-0.0005203938344,-0.0002794320171,3.245456537e-05,
-	0.0003306877625,0.0005361014046,0.0005950810737,0.0004944226239, 0.000263269787,
-	-3.438729982e-05,-0.0003182951477,-0.0005126661854,-0.0005672653206,-0.0004695042735,
-	-0.0002481287229,3.605481834e-05,0.0003059734008,0.0004900440108,0.0005402680254,
-	0.0004456270544,0.0002334509336,-3.751995973e-05,-0.0002942609717,-0.0004682434956,
-	-0.0005146150943,-0.0004227808968,-0.0002197218419,3.882342207e-05, 0.000282735622,
-	0.0004473973822,0.0004899200867,0.0004011765704,0.0002067087335,-3.960977847e-05,
-	-0.0002714864095,-0.0004270155623,-0.0004662353313,-0.0003802975989,-0.0001944544638,
-	4.034922313e-05,0.0002603736066, 0.000407453801,0.0004432657151,0.0003603690711,
-	0.0001825549989,-4.086134868e-05,-0.0002498274262,-0.0003885427723,-0.0004214501823,
-	-0.000341239007,-0.0001714933896,4.133964831e-05,0.0002394317562,0.0003705064883,
-	0.0004004275834,0.0003232051677,0.0001609526662,-4.134749179e-05,-0.0002293586876,
-	-0.0003528727684,-0.0003803512664,-0.0003057885333,-0.0001511327428,  4.1344083e-05,
-	0.0002193386026,0.0003359566617,0.0003608167463,0.0002892267075,0.0001415916922,
-	-4.107112909e-05,-0.0002097908437,-0.0003194558667,-0.0003422353766,-0.000273195823,
-	-0.0001326958445,4.090154107e-05,0.0002003600239,0.0003038113646,0.0003242278181,
-	0.0002580674191,0.0001240762795,-4.042037835e-05,-0.0001914300956,-0.0002885495487,
-	-0.0003072188993,-0.000243465809,-0.0001161545151,4.002601418e-05,0.0001825330546,
-	0.0002740466734,0.0002906788141, 0.000229747151,0.0001084882024,-3.925329656e-05,
-	-0.0001740643202,-0.0002598432766,-0.0002750319254,-0.0002164412581,-0.0001015032321,
-	3.858376294e-05,0.0001656026725,0.0002463473938,0.0002597610292,0.0002039657556,
-	9.463157039e-05,-3.758967796e-05,-0.0001575854258,-0.0002330929128,-0.0002453589113,
-	-0.0001917865884,-8.839590009e-05,3.682174793e-05,0.0001495816541,0.0002205964993,
-	0.0002312667202,0.0001804186613,8.224486373e-05,-3.569722685e-05,-0.0001421014167,
-	-0.0002083316358,-0.000218076093,-0.0001693216618,-7.666609599e-05,3.485306297e-05,
-	0.0001346086356,0.0001968458091,0.0002052012715,0.0001589666063,7.113153697e-05,
-	-3.367628233e-05,-0.0001276727853,-0.0001855406881,-0.0001931422012,-0.0001488929847,
-	-6.618559564e-05,3.276044663e-05,0.0001206886664, 0.000174982124,0.0001813035487,
-	0.0001395468862,6.123644562e-05,-3.147827374e-05,-0.0001142292458,-0.0001645826414,
-	-0.0001703513117,-0.0001303570025,-5.68510186e-05,3.053314867e-05,0.0001077032721,
-	0.0001548726432, 0.000159471223,0.0001219457263,5.242909901e-05,-2.927689457e-05,
-	-0.0001016639508,-0.0001452507131,-0.0001494765893,-0.0001136122955,-4.85500932e-05,
-	2.828068136e-05,9.564469656e-05,0.0001363645861,0.0001396331209,0.0001059686692,
-	4.458573312e-05,-2.700853111e-05,-9.013254748e-05,-0.0001276142575,-0.0001305968035,
-	-9.841449355e-05,-4.101148443e-05,2.625855632e-05,8.463609993e-05,0.0001195221703,
-	0.0001216174496,9.148593381e-05,3.728641241e-05,-2.503619544e-05,-7.986861601e-05,
-	-0.0001116878557,-0.0001133843471,-8.451881877e-05,-3.404642484e-05,2.460872201e-05,
-	7.508109411e-05,0.0001046106991,0.0001052618682,7.804886991e-05,3.035190275e-05,
-	-2.409496301e-05,-7.110169099e-05,-9.775888611e-05,-9.787458112e-05,-7.149443263e-05,
-	-2.67122432e-05,2.447603765e-05,6.765870057e-05,9.170422709e-05,9.038155986e-05,
-	6.517373549e-05,2.301010318e-05,-2.53112612e-05,-6.548426609e-05,-8.636236453e-05,
-	-8.426898421e-05,-5.793089076e-05,-1.675102976e-05,2.938868238e-05,6.649934949e-05,
-	8.566612087e-05,8.071245975e-05, 5.43333008e-05,1.325295216e-05,-2.941127423e-05,
-	-6.144262443e-05,-7.079247735e-05,-5.24530551e-05,-6.015064628e-06,6.052008393e-05,
-	0.000136393588,0.0002071836789,0.0002620814194,0.0002931949275,0.0003014556714,
-	0.0002935571247,0.0002850610763,0.0002950166236,-0.0005916813971
-};
+	if(m_useFFT)
+		m_fftFilter.create(m_bank->spectrum, m_nTaps, m_decimation, m_backend);
+	if(m_fixedPoint) {
+		m_fixedHistoryI.assign(m_historyKeep + HistoryChunk, 0);
+		m_fixedHistoryQ.assign(m_historyKeep + HistoryChunk, 0);
+	}
+}
 
-static const float H18[1024] = {
-	0.0006628686679,-0.000166918966,-0.0001975859777,-0.0002423759142,-0.0002822613751,
-	-0.0003020544245,-0.0002910680196,-0.0002484750003,-0.0001805721258,-0.0001018730545,
-	-2.829161167e-05,2.430417044e-05,4.733930109e-05, 3.88361841e-05,6.838096397e-06,
-	-3.612502042e-05,-7.357005234e-05,-9.315693023e-05,-8.678584709e-05,-5.653961125e-05,
-	-9.90233093e-06,3.793432916e-05,7.407699013e-05,8.655404963e-05,7.051186549e-05,
-	3.244152322e-05,-1.696435356e-05,-6.261832459e-05,-9.012443479e-05,-9.069856605e-05,
-	-6.332618796e-05,-1.608543971e-05, 3.72390241e-05,8.008928853e-05,9.942138422e-05,
-	8.844277909e-05,  5.0206585e-05,-4.527234978e-06,-5.898730524e-05,-9.684154065e-05,
-	-0.0001057662885,-8.270439139e-05,-3.366304372e-05,2.674342613e-05,8.041550609e-05,
-	0.0001108398355,0.0001081656083,7.199031097e-05, 1.34143811e-05,-5.092602441e-05,
-	-0.0001009817861,-0.0001216647433,-0.0001054118329,-5.686423901e-05,1.043039538e-05,
-	7.584190462e-05,0.0001198838218,0.0001281104342,9.770247561e-05,3.654373359e-05,
-	-3.690293306e-05,-0.0001010204942,-0.0001355465065,-0.0001297886774,-8.409941074e-05,
-	-1.20123932e-05,6.564473006e-05,0.0001247024338,0.0001474988094,0.0001254706876,
-	6.499578012e-05,-1.681638423e-05,-9.505920025e-05,-0.0001463508816,-0.0001539500663,
-	-0.0001150826283,-4.006785457e-05,4.852812708e-05,0.0001245256135,0.0001640069822,
-	0.000154666297,9.779234097e-05,1.018708645e-05,-8.264110511e-05,-0.0001520338992,
-	-0.0001768860093,-0.0001481699146,-7.402854681e-05,2.447142106e-05, 0.000117335876,
-	0.0001766662026,0.0001833107963,0.0001344668417,4.349551818e-05,-6.233617023e-05,
-	-0.0001516056363,-0.0001963739633,-0.0001825389481,-0.0001126625066,-7.313838978e-06,
-	0.0001026152459,0.0001833264105,0.0002101166319,0.0001733070385, 8.32615915e-05,
-	-3.412739898e-05,-0.0001432533754,-0.0002111844515,-0.0002160142321,-0.0001554410119,
-	-4.620680193e-05,7.904407539e-05,0.0001828866079,0.0002329375566,0.0002133469534,
-	0.0001282254088,2.689151188e-06,-0.000126300889,-0.0002191575477,-0.0002473826462,
-	-0.0002007003932,-9.23014959e-05,4.645681111e-05,0.0001735230617,0.0002504597069,
-	0.0002524895826,0.0001779973099,4.776452261e-05,-9.92392379e-05,-0.0002190449159,
-	-0.0002742975194,-0.0002474023204,-0.0001445822127,3.886978448e-06,0.0001541698584,
-	0.0002601374872,0.0002892302582,0.0002307311806,0.0001012127759,-6.163663056e-05,
-	-0.0002085146843,-0.0002949022164,-0.0002930304909,-0.000202257288,-4.816098954e-05,
-	0.0001231589413,0.0002603318135,0.0003206466499,0.0002847806318,0.0001615128713,
-	-1.285772942e-05,-0.0001866331149,-0.0003065807687,-0.0003356760717,-0.0002630584931,
-	-0.0001093921455,8.044032438e-05,0.0002490082697,0.0003450396471,0.0003377374669,
-	0.0002278268075,4.655243902e-05,-0.0001518673816,-0.0003077857837,-0.0003727311851,
-	-0.0003257272183,-0.0001787532528,2.491400483e-05,0.0002247080556,0.0003595023009,
-	0.0003875585971,0.0002981733414,0.0001168308809,-0.0001032746877,-0.0002955882228,
-	-0.0004015236918,-0.0003870998626,-0.0002549657656,-4.297350824e-05,0.0001855127048,
-	0.0003616490867,0.0004307029594,0.0003702245012,0.0001960617956,-4.044969683e-05,
-	-0.0002687982633,-0.0004191495245,-0.0004448342661,-0.0003356442612,-0.0001228064648,
-	0.0001310512453,0.0003491748066,0.0004650057817,0.0004413530114,0.0002833905164,
-	3.658714922e-05,-0.0002252494305,-0.000423115067,-0.0004955530749,-0.0004187929735,
-	-0.0002134062961,6.000842768e-05,  0.00031981754,0.0004865555675,0.0005083466531,
-	0.0003759229439,0.0001272700756,-0.0001642400312,-0.0004104588879,-0.0005361349322,
-	-0.0005008628941, -0.00031301743,-2.691427471e-05,0.0002718557953,0.0004930087598,
-	0.0005678508314,0.0004715594987,0.0002303679939,-8.452319162e-05,-0.0003789092298,
-	-0.0005627772771,-0.0005787723931,-0.0004190948384,-0.0001296979026, 0.000203823467,
-	0.0004806333745, 0.000615968951, 0.000566244009,0.0003438532585, 1.33620797e-05,
-	-0.0003263220133,-0.0005723934155,-0.0006484050537,-0.0005288076354,-0.000246605865,
-	0.0001148351803,0.0004472046567,0.0006488740328,0.0006567517412,0.0004651822674,
-	0.000129427528,-0.0002510068007,-0.0005610667286,-0.0007056715549,-0.0006381103885,
-	-0.0003757673549, 4.91840683e-06,0.0003899827134,0.0006627424737,0.0007383885095,
-	0.0005910680629,0.0002618405852,-0.000151956323,-0.000526152493,-0.0007462907815,
-	-0.0007433036808,-0.0005144388997,-0.0001258685224,0.0003070624662,0.0006533734268,
-	0.0008067123708,0.0007173306658,0.0004087715934,-2.883173147e-05,-0.0004644092696,
-	-0.0007658072282,-0.0008392292657,-0.0006590070552,-0.0002757567272,0.0001970998128,
-	0.0006175198359,0.0008568369085,0.0008397140773,0.0005672182888,0.0001183008862,
-	-0.0003735909995,-0.0007595673087,-0.0009209053824,-0.0008049657918,-0.000442803459,
-	5.956527821e-05,0.0005515938392,0.0008838251233,0.0009527233196,0.0007334103575,
-	0.0002878679952,-0.0002519626287,-0.0007237322279,-0.0009829527698,-0.0009477196145,
-	-0.000624013308,-0.0001057817281,0.0004527254787,0.0008823844837, 0.001050798455,
-	0.0009026075713,0.0004779954907,-9.85168881e-05,-0.0006540839095, -0.00101974397,
-	-0.001081341296,-0.0008155159885,-0.000297759776,0.0003185098176,0.0008477596566,
-	0.001127749914,   0.0010696135,0.0006855771644,8.725311636e-05,-0.0005470935139,
-	-0.001025245292,-0.001199573744,-0.001012219233,-0.0005144451861,0.0001475604367,
-	0.000775212422,  0.00117739616, 0.001228245441,0.0009067961364,0.0003046656493,
-	-0.000399630866,-0.0009938529693,-0.001295619644,-0.001208635163,-0.0007529851282,
-	-6.123389903e-05,0.0006603533984, 0.001192952273, 0.001371760969, 0.001136638108,
-	0.0005523644504,-0.0002092994837,-0.0009197535692, -0.00136236893,-0.001398195047,
-	-0.001009747153,-0.0003080023453, 0.000498895417, 0.001167563838,   0.0014924641,
-	0.001369225443,0.0008277853485,2.577633677e-05,-0.0007974946056,-0.001392131089,
-	-0.001573643531,-0.001279860269,-0.000592112483,0.0002873000922, 0.001094294828,
-	0.001582423574, 0.001597831957, 0.001127814525,0.0003068577789,-0.0006214798195,
-	-0.001376921195,-0.001726791728,-0.001557753771,-0.0009121224284,2.210897583e-05,
-	0.000966022606, 0.001632788335, 0.001814857009, 0.001448259223,0.0006347616436,
-	-0.0003862938029,-0.001308123232, -0.00184869254,-0.001836728305,-0.001265925472,
-	-0.0002996889816,0.0007753151585, 0.001634194516, 0.002011745935, 0.001784308231,
-	0.001009830972,-8.626550698e-05,-0.001176621648,-0.001929450082,-0.002109425142,
-	-0.001650942722,-0.0006813758519,0.0005140989088, 0.001576084993, 0.002178939758,
-	0.002130330075, 0.001432394027,0.0002847826399,-0.0009721072856,-0.001957976958,
-	-0.002367399866,-0.002064285334,-0.001126564806, 0.000173140812, 0.001446594717,
-	0.00230560964, 0.002480195602, 0.001903049415,0.0007342781173,-0.0006826606696,
-	-0.001921541407,-0.002601381857,-0.002503232099,-0.001640322385,-0.0002589310461,
-	0.001231461763, 0.002379293786, 0.002827370306, 0.002423685044, 0.001272179885,
-	-0.0002931258059,-0.001804685802,-0.002800665097,-0.002965697786,-0.002230208833,
-	-0.0007973320899,0.0009126168443,  0.00238495809, 0.003165157279, 0.002998618176,
-	0.001913080574,0.0002169849467,-0.001587533276,-0.002952825045,-0.003451356431,
-	-0.002908986527,-0.001464433037,0.0004649492621, 0.002303118352, 0.003486679867,
-	0.003636911046,   0.0026800544,0.0008780343924,-0.001242251368,-0.003042215714,
-	-0.003963136114,-0.003698689397,-0.002295519924,-0.0001491427975, 0.002106496599,
-	0.003785326844, 0.004356794525, 0.003612351138, 0.001738870982, -0.00072614901,
-	-0.003047590377,-0.004510713276,-0.004639870953,-0.003351405496,-0.0009921060409,
-	0.001752253505, 0.004054704215, 0.005194650032, 0.004781540018, 0.002885789145,
-	3.387093602e-05,-0.002935768804,-0.005117158871,-0.005810934585,-0.004745868966,
-	-0.002178443596,  0.00116454321, 0.004288990051,  0.00622622855, 0.006330068223,
-	0.004488065373, 0.001179162296,-0.002646395005,-0.005836109631,-0.007378166541,
-	-0.006717401557,-0.003947142977,0.0001872136345, 0.004483077675, 0.007624628954,
-	0.008579131216,  0.00692812074, 0.003029711777,-0.002046294976, -0.00680345716,
-	-0.00975022465,-0.009856099263,-0.006896200124,-0.001573434216, 0.004632596392,
-	0.009862280451,    0.012415573,  0.01128250267, 0.006505237892,-0.0007487577968,
-	-0.008446102962, -0.01422832999, -0.01609689929, -0.01305261441,-0.005498195067,
-	0.004734193441,  0.01477255207,  0.02143909782,  0.02215351351,  0.01576892473,
-	0.003103760304, -0.01300339121,  -0.0281740427, -0.03742578626, -0.03635985032,
-	-0.0223176647, 0.004785568919,  0.04217722639,  0.08459501714,   0.1252516061,
-	0.1571938992,   0.1747532636,   0.1747532636,   0.1571938992,   0.1252516061,
-	0.08459501714,  0.04217722639, 0.004785568919,  -0.0223176647, -0.03635985032,
-	-0.03742578626,  -0.0281740427, -0.01300339121, 0.003103760304,  0.01576892473,
-	0.02215351351,  0.02143909782,  0.01477255207, 0.004734193441,-0.005498195067,
-	-0.01305261441, -0.01609689929, -0.01422832999,-0.008446102962,-0.0007487577968,
-	0.006505237892,  0.01128250267,    0.012415573, 0.009862280451, 0.004632596392,
-	-0.001573434216,-0.006896200124,-0.009856099263, -0.00975022465, -0.00680345716,
-	-0.002046294976, 0.003029711777,  0.00692812074, 0.008579131216, 0.007624628954,
-	0.004483077675,0.0001872136345,-0.003947142977,-0.006717401557,-0.007378166541,
-	-0.005836109631,-0.002646395005, 0.001179162296, 0.004488065373, 0.006330068223,
-	0.00622622855, 0.004288990051,  0.00116454321,-0.002178443596,-0.004745868966,
-	-0.005810934585,-0.005117158871,-0.002935768804,3.387093602e-05, 0.002885789145,
-	0.004781540018, 0.005194650032, 0.004054704215, 0.001752253505,-0.0009921060409,
-	-0.003351405496,-0.004639870953,-0.004510713276,-0.003047590377, -0.00072614901,
-	0.001738870982, 0.003612351138, 0.004356794525, 0.003785326844, 0.002106496599,
-	-0.0001491427975,-0.002295519924,-0.003698689397,-0.003963136114,-0.003042215714,
-	-0.001242251368,0.0008780343924,   0.0026800544, 0.003636911046, 0.003486679867,
-	0.002303118352,0.0004649492621,-0.001464433037,-0.002908986527,-0.003451356431,
-	-0.002952825045,-0.001587533276,0.0002169849467, 0.001913080574, 0.002998618176,
-	0.003165157279,  0.00238495809,0.0009126168443,-0.0007973320899,-0.002230208833,
-	-0.002965697786,-0.002800665097,-0.001804685802,-0.0002931258059, 0.001272179885,
-	0.002423685044, 0.002827370306, 0.002379293786, 0.001231461763,-0.0002589310461,
-	-0.001640322385,-0.002503232099,-0.002601381857,-0.001921541407,-0.0006826606696,
-	0.0007342781173, 0.001903049415, 0.002480195602,  0.00230560964, 0.001446594717,
-	0.000173140812,-0.001126564806,-0.002064285334,-0.002367399866,-0.001957976958,
-	-0.0009721072856,0.0002847826399, 0.001432394027, 0.002130330075, 0.002178939758,
-	0.001576084993,0.0005140989088,-0.0006813758519,-0.001650942722,-0.002109425142,
-	-0.001929450082,-0.001176621648,-8.626550698e-05, 0.001009830972, 0.001784308231,
-	0.002011745935, 0.001634194516,0.0007753151585,-0.0002996889816,-0.001265925472,
-	-0.001836728305, -0.00184869254,-0.001308123232,-0.0003862938029,0.0006347616436,
-	0.001448259223, 0.001814857009, 0.001632788335, 0.000966022606,2.210897583e-05,
-	-0.0009121224284,-0.001557753771,-0.001726791728,-0.001376921195,-0.0006214798195,
-	0.0003068577789, 0.001127814525, 0.001597831957, 0.001582423574, 0.001094294828,
-	0.0002873000922,-0.000592112483,-0.001279860269,-0.001573643531,-0.001392131089,
-	-0.0007974946056,2.577633677e-05,0.0008277853485, 0.001369225443,   0.0014924641,
-	0.001167563838, 0.000498895417,-0.0003080023453,-0.001009747153,-0.001398195047,
-	-0.00136236893,-0.0009197535692,-0.0002092994837,0.0005523644504, 0.001136638108,
-	0.001371760969, 0.001192952273,0.0006603533984,-6.123389903e-05,-0.0007529851282,
-	-0.001208635163,-0.001295619644,-0.0009938529693,-0.000399630866,0.0003046656493,
-	0.0009067961364, 0.001228245441,  0.00117739616, 0.000775212422,0.0001475604367,
-	-0.0005144451861,-0.001012219233,-0.001199573744,-0.001025245292,-0.0005470935139,
-	8.725311636e-05,0.0006855771644,   0.0010696135, 0.001127749914,0.0008477596566,
-	0.0003185098176,-0.000297759776,-0.0008155159885,-0.001081341296, -0.00101974397,
-	-0.0006540839095,-9.85168881e-05,0.0004779954907,0.0009026075713, 0.001050798455,
-	0.0008823844837,0.0004527254787,-0.0001057817281,-0.000624013308,-0.0009477196145,
-	-0.0009829527698,-0.0007237322279,-0.0002519626287,0.0002878679952,0.0007334103575,
-	0.0009527233196,0.0008838251233,0.0005515938392,5.956527821e-05,-0.000442803459,
-	-0.0008049657918,-0.0009209053824,-0.0007595673087,-0.0003735909995,0.0001183008862,
-	0.0005672182888,0.0008397140773,0.0008568369085,0.0006175198359,0.0001970998128,
-	-0.0002757567272,-0.0006590070552,-0.0008392292657,-0.0007658072282,-0.0004644092696,
-	-2.883173147e-05,0.0004087715934,0.0007173306658,0.0008067123708,0.0006533734268,
-	0.0003070624662,-0.0001258685224,-0.0005144388997,-0.0007433036808,-0.0007462907815,
-	-0.000526152493,-0.000151956323,0.0002618405852,0.0005910680629,0.0007383885095,
-	0.0006627424737,0.0003899827134, 4.91840683e-06,-0.0003757673549,-0.0006381103885,
-	-0.0007056715549,-0.0005610667286,-0.0002510068007, 0.000129427528,0.0004651822674,
-	0.0006567517412,0.0006488740328,0.0004472046567,0.0001148351803,-0.000246605865,
-	-0.0005288076354,-0.0006484050537,-0.0005723934155,-0.0003263220133, 1.33620797e-05,
-	0.0003438532585, 0.000566244009, 0.000615968951,0.0004806333745, 0.000203823467,
-	-0.0001296979026,-0.0004190948384,-0.0005787723931,-0.0005627772771,-0.0003789092298,
-	-8.452319162e-05,0.0002303679939,0.0004715594987,0.0005678508314,0.0004930087598,
-	0.0002718557953,-2.691427471e-05, -0.00031301743,-0.0005008628941,-0.0005361349322,
-	-0.0004104588879,-0.0001642400312,0.0001272700756,0.0003759229439,0.0005083466531,
-	0.0004865555675,  0.00031981754,6.000842768e-05,-0.0002134062961,-0.0004187929735,
-	-0.0004955530749,-0.000423115067,-0.0002252494305,3.658714922e-05,0.0002833905164,
-	0.0004413530114,0.0004650057817,0.0003491748066,0.0001310512453,-0.0001228064648,
-	-0.0003356442612,-0.0004448342661,-0.0004191495245,-0.0002687982633,-4.044969683e-05,
-	0.0001960617956,0.0003702245012,0.0004307029594,0.0003616490867,0.0001855127048,
-	-4.297350824e-05,-0.0002549657656,-0.0003870998626,-0.0004015236918,-0.0002955882228,
-	-0.0001032746877,0.0001168308809,0.0002981733414,0.0003875585971,0.0003595023009,
-	0.0002247080556,2.491400483e-05,-0.0001787532528,-0.0003257272183,-0.0003727311851,
-	-0.0003077857837,-0.0001518673816,4.655243902e-05,0.0002278268075,0.0003377374669,
-	0.0003450396471,0.0002490082697,8.044032438e-05,-0.0001093921455,-0.0002630584931,
-	-0.0003356760717,-0.0003065807687,-0.0001866331149,-1.285772942e-05,0.0001615128713,
-	0.0002847806318,0.0003206466499,0.0002603318135,0.0001231589413,-4.816098954e-05,
-	-0.000202257288,-0.0002930304909,-0.0002949022164,-0.0002085146843,-6.163663056e-05,
-	0.0001012127759,0.0002307311806,0.0002892302582,0.0002601374872,0.0001541698584,
-	3.886978448e-06,-0.0001445822127,-0.0002474023204,-0.0002742975194,-0.0002190449159,
-	-9.92392379e-05,4.776452261e-05,0.0001779973099,0.0002524895826,0.0002504597069,
-	0.0001735230617,4.645681111e-05,-9.23014959e-05,-0.0002007003932,-0.0002473826462,
-	-0.0002191575477,-0.000126300889,2.689151188e-06,0.0001282254088,0.0002133469534,
-	0.0002329375566,0.0001828866079,7.904407539e-05,-4.620680193e-05,-0.0001554410119,
-	-0.0002160142321,-0.0002111844515,-0.0001432533754,-3.412739898e-05, 8.32615915e-05,
-	0.0001733070385,0.0002101166319,0.0001833264105,0.0001026152459,-7.313838978e-06,
-	-0.0001126625066,-0.0001825389481,-0.0001963739633,-0.0001516056363,-6.233617023e-05,
-	4.349551818e-05,0.0001344668417,0.0001833107963,0.0001766662026, 0.000117335876,
-	2.447142106e-05,-7.402854681e-05,-0.0001481699146,-0.0001768860093,-0.0001520338992,
-	-8.264110511e-05,1.018708645e-05,9.779234097e-05, 0.000154666297,0.0001640069822,
-	0.0001245256135,4.852812708e-05,-4.006785457e-05,-0.0001150826283,-0.0001539500663,
-	-0.0001463508816,-9.505920025e-05,-1.681638423e-05,6.499578012e-05,0.0001254706876,
-	0.0001474988094,0.0001247024338,6.564473006e-05,-1.20123932e-05,-8.409941074e-05,
-	-0.0001297886774,-0.0001355465065,-0.0001010204942,-3.690293306e-05,3.654373359e-05,
-	9.770247561e-05,0.0001281104342,0.0001198838218,7.584190462e-05,1.043039538e-05,
-	-5.686423901e-05,-0.0001054118329,-0.0001216647433,-0.0001009817861,-5.092602441e-05,
-	1.34143811e-05,7.199031097e-05,0.0001081656083,0.0001108398355,8.041550609e-05,
-	2.674342613e-05,-3.366304372e-05,-8.270439139e-05,-0.0001057662885,-9.684154065e-05,
-	-5.898730524e-05,-4.527234978e-06,  5.0206585e-05,8.844277909e-05,9.942138422e-05,
-	8.008928853e-05, 3.72390241e-05,-1.608543971e-05,-6.332618796e-05,-9.069856605e-05,
-	-9.012443479e-05,-6.261832459e-05,-1.696435356e-05,3.244152322e-05,7.051186549e-05,
-	8.655404963e-05,7.407699013e-05,3.793432916e-05,-9.90233093e-06,-5.653961125e-05,
-	-8.678584709e-05,-9.315693023e-05,-7.357005234e-05,-3.612502042e-05,6.838096397e-06,
-	3.88361841e-05,4.733930109e-05,2.430417044e-05,-2.829161167e-05,-0.0001018730545,
-	-0.0001805721258,-0.0002484750003,-0.0002910680196,-0.0003020544245,-0.0002822613751,
-	-0.0002423759142,-0.0001975859777,-0.000166918966,0.0006628686679
-};
+void SSEInterpolator::create(double inputRate, double outputRate, Quality quality, double gain)
+{
+	// the cubic interpolator has no anti-alias filter of its own, everything between the
+	// output Nyquist frequency and the input one would alias; downsampling runs the Low bank
+	// instead, which costs less per output than a prefilter at the input rate would
+	if(quality == QualityCubic) {
+		if(inputRate <= outputRate) {
+			createCubic(inputRate, outputRate, gain);
+			return;
+		}
+		quality = QualityLow;
+	}
 
-static const float H19[1024] = {
-	-0.0007401077892,1.639863513e-05,6.948468217e-05,0.0001419919281,0.0002157484705,
-	0.0002698065073,0.0002904133871,0.0002708347747,0.0002174812253,0.0001438790932,
-	7.079522766e-05,1.579483433e-05,-7.83437099e-06,7.637481758e-07,3.436718907e-05,
-	7.602092955e-05,0.0001092564053,0.0001189960603,0.0001010705455,5.808706919e-05,
-	3.580177008e-06,-4.388620073e-05,-7.034234295e-05,-6.705369742e-05,-3.511851173e-05,
-	1.352720938e-05,6.258271605e-05,9.389858315e-05, 9.67400556e-05,6.830348866e-05,
-	1.81750238e-05,-3.811134957e-05,-8.076281665e-05,-9.597740427e-05,-7.721639849e-05,
-	-3.125720104e-05,2.763530938e-05,7.864928193e-05,0.0001052397856,9.647732804e-05,
-	5.53485188e-05,-5.413615781e-06,-6.527435471e-05,-0.0001043843367,-0.0001083148527,
-	-7.571362221e-05,-1.605595025e-05,5.017494186e-05,0.0001014460868,0.0001191378542,
-	9.728605801e-05,4.151030953e-05,-2.917212259e-05,-9.196275641e-05,-0.000124476006,
-	-0.0001159075182,-6.735678471e-05,4.725702183e-06,7.743355673e-05,0.0001250328496,
-	0.0001317455899,9.359458636e-05, 2.31776994e-05,-5.705013973e-05,-0.0001193321295,
-	-0.0001429364202,-0.000118183576,-5.321478602e-05,3.167311297e-05, 0.000107310465,
-	0.0001486853143,0.0001401470654,8.433002222e-05,-1.722999968e-06,-8.862518007e-05,
-	-0.00014781348,-0.0001577796502,-0.0001149393865,-3.172382276e-05,6.354627112e-05,
-	0.0001397888554,0.0001699141139,0.0001435071026,6.753186608e-05,-3.252448732e-05,
-	-0.0001240809506,-0.0001751273667,-0.0001683540031,-0.0001040159696,-3.523532087e-06,
-	0.0001006835955,0.0001725484763,0.0001878910116,0.0001395144354,4.334564437e-05,
-	-6.988204404e-05,-0.0001613535424,-0.0002004940761,-0.0001720935106, -8.5334701e-05,
-	3.251278758e-05,0.0001413119317,0.0002048651513,0.0001999328524, 0.000127625055,
-	1.026630252e-05,-0.0001124854025,-0.000200004637,-0.0002211437095,-0.0001682507136,
-	-5.69377662e-05,7.543496758e-05,0.0001852809364,0.0002341453364,0.0002051254269,
-	0.0001056950641,-3.105138603e-05,-0.0001603623386,-0.0002374724427,-0.0002361608204,
-	-0.0001544690604,-1.935190812e-05,0.0001253162627,0.0002299426123,0.0002591630328,
-	0.0002008515148,7.389497478e-05,-8.085373702e-05,-0.0002107535547,-0.0002721931669,
-	-0.0002422906837,  -0.0001302655,2.830491758e-05,0.0001798279263,0.0002737161703,
-	0.0002763319644,0.0001858950709,3.050869418e-05,-0.0001376307773,-0.0002627137874,
-	-0.0003007790365,-0.0002381900413,-9.346209845e-05,8.512922795e-05,0.0002385762782,
-	0.0003137121093,0.0002844989358,0.0001581366523,-2.359290738e-05,-0.0002010086318,
-	-0.0003132263373,-0.0003219119972,-0.0002214948618,-4.478179835e-05,0.0001506067056,
-	0.0002981281141,0.0003478087601,0.0002803572861,0.0001173091805,-8.867527504e-05,
-	-0.0002678665332,-0.0003599976189,-0.0003315829963,-0.0001909159328,1.716400402e-05,
-	0.0002226752695,0.0003568451793,0.0003722858964,0.0002624864283,6.164200749e-05,
-	-0.0001631283376,-0.0003369942424,-0.0003995293227,-0.0003284387058,-0.0001447086252,
-	9.06962523e-05,0.0002997971606,0.0004107079585,0.0003850076173, 0.000228310746,
-	-7.839226782e-06,-0.0002457059163,-0.0004041144857,-0.0004289219214,-0.0003087374498,
-	-8.251804684e-05,0.0001757744903,0.0003785931331,0.0004571757163,0.0003821318969,
-	0.0001770195231,-9.171908459e-05,-0.0003335476213,-0.000466995989,-0.000444409292,
-	-0.0002715824521,-3.748561312e-06,0.0002693931165,0.0004563029506,0.0004916458856,
-	0.0003617258917, 0.000107017644,-0.0001876675233,-0.0004240890557,-0.0005206375499,
-	-0.000443118246,-0.0002141762525,9.053492249e-05,0.0003699540393,0.0005284970393,
-	0.000511332124,0.0003207088157,1.896903268e-05,-0.0002943891741,-0.000512915256,
-	-0.0005619221483,-0.0004214305663,-0.0001365748903,0.0001993492333,0.0004729183856,
-	0.0005913549103,0.0005114430096,0.0002577258856,-8.750367851e-05,-0.0004083189124,
-	-0.000596579921,-0.0005858522491,-0.0003772824421,-3.754724821e-05,0.0003199186758,
-	0.0005752539146,0.0006398606929,0.0004895554739,0.0001710711804,-0.0002099205449,
-	-0.0005263017374,-0.000669451314,-0.0005889057065,-0.0003077154688,8.158407582e-05,
-	0.0004497691989,0.0006714003393,0.0006699291407, 0.000441689248,6.092257172e-05,
-	-0.0003467267961,-0.0006432446535,-0.0007273262017,-0.0005665849894,-0.0002121754515,
-	0.0002197911817,0.0005838825018,0.0007566207205,0.0006759958924,0.0003659524664,
-	-7.293681119e-05,-0.0004937081248,-0.0007544864202,-0.0007640240365,-0.0005158000859,
-	-8.907986194e-05,0.0003740700486,  0.00071830448,0.0008248134982,0.0006545215729,
-	0.0002600666485,-0.0002280999906,-0.0006470512599,-0.0008535077213,-0.0007749989745,
-	-0.0004330269294,6.031885277e-05, 0.000541245623,0.0008464190178,0.0008705699001,
-	0.0006005730247,0.0001237079559,-0.0004026504175,-0.0008007952711,-0.0009347448358,
-	-0.0007545514964,-0.0003168187977, 0.000235083673,0.0007158177905,0.0009623680962,
-	0.0008871846367,0.0005112459767,-4.363410335e-05,-0.0005921312259,-0.0009493279504,
-	-0.0009909481741,-0.0006985689397,-0.0001652458304,0.0004319605068,0.0008927583112,
-	0.001058707829,0.0008696708246,0.0003834431118,-0.0002397333155,-0.0007919007912,
-	-0.001084772521,-0.001015827875,-0.0006021563313,2.129502718e-05,0.0006476196577,
-	0.001064619632,  0.00112857495,0.0008117780089,0.0002158327552,-0.0004627445014,
-	-0.0009953550762,-0.001200164668,-0.001002233243,-0.0004625963047,0.0002422659018,
-	0.000876186532, 0.001224250416,  0.00116372935,0.0007090601721,7.158721928e-06,
-	-0.0007081534131,-0.001195758465,-0.001286669867,-0.000944265048,-0.0002768479171,
-	0.0004946899717, 0.001111661782, 0.001362494542, 0.001156926504,0.0005565785686,
-	-0.0002415091294,-0.000971183239, -0.00138414558,-0.001336054062,-0.0008351502474,
-	-4.384437125e-05,0.0007755385013, 0.001345928642, 0.001470797579, 0.001100099995,
-	0.0003514243872,-0.0005287810345,-0.001244599465,-0.001551653957,-0.001338820439,
-	-0.0006697967765,0.0002372659219, 0.001079174341, 0.001570516499, 0.001538738376,
-	0.0009861291619,9.030009824e-05,-0.0008511863998,-0.001521077007,-0.001687689684,
-	-0.001286412589,-0.0004427466192,0.0005651657702,  0.00139962812, 0.001774914679,
-	0.001556428266,0.0008072586497,-0.0002280882036,-0.001204774715,-0.001790918293,
-	-0.001781637664,-0.001169050811,-0.0001500072249, 0.000938361627, 0.001728632138,
-	0.00194834685, 0.001512393123,0.0005566951004,-0.0006052086246, -0.00158350938,
-	-0.002044065855,-0.001821006299,-0.0009774472564,0.0002130592038, 0.001353691681,
-	0.002057734178,  0.00207820232, 0.001395473373,0.0002268679964,-0.001040968928,
-	-0.001981025562,-0.002268280135,-0.001793036121,-0.0007009095279,0.0006501053576,
-	0.001807939378, 0.002376276068, 0.002151112538,  0.00119238277,-0.0001897329057,
-	-0.001536005409,-0.002389306435,-0.002450688975,-0.001682589296,-0.0003282259568,
-	0.00116612378, 0.002296743216, 0.002673039446, 0.002151020104,0.0008885191055,
-	-0.0007029235712,-0.002090767724,-0.002800349845,-0.002575787716, -0.00147263112,
-	0.000155129921, 0.001767164562, 0.002816728316, 0.002934672637, 0.002059656894,
-	0.0004650093615,-0.001325029181,-0.002708106069,-0.003204982262, -0.00262592989,
-	-0.001140993438,0.0007678907132, 0.002463605953, 0.003365010256, 0.003146317322,
-	0.001853017253,-0.0001031575812,-0.002075391589, -0.00339410454,-0.003594353329,
-	-0.002578007756,-0.0006577187451, 0.001538956771, 0.003273000475, 0.003942436539,
-	0.00328954123,  0.00149880501,-0.0008539527189,-0.002984911203,-0.004163063131,
-	-0.003959070891,-0.002400794765,2.319671148e-05, 0.002514679451, 0.004228024278,
-	0.00455511827, 0.003340163268,0.0009463682072,-0.001849820837, -0.00410959078,
-	-0.005044592079,-0.004290617537,-0.002045277972,0.0009788711322, 0.003778922837,
-	0.005391470157, 0.005222215317, 0.003261137055,0.0001085906042,-0.003206040477,
-	-0.005557119846,-0.006102446001,-0.004580684006,-0.001424796297, 0.002356695011,
-	0.005497781094, 0.006895199418, 0.005990745034, 0.002986602485,-0.001188716153,
-	-0.005161649082,-0.007560315542,-0.007481420878,-0.004822196905,-0.0003565716033,
-	0.004481439013,  0.00805072207,   0.0090502901,  0.00698258169, 0.002370125381,
-	-0.003360117553,-0.008306774311, -0.01071097888,-0.009565460496,-0.005008959211,
-	0.001639342634,  0.00824257452,  0.01251092646,  0.01276883204, 0.008574718609,
-	0.0009766072035,-0.007711357903, -0.01457550935, -0.01703078486, -0.01372708194,
-	-0.005136231426,  0.00640197983,  0.01724102162,  0.02347763069,  0.02220755443,
-	0.01261743531, -0.00343928556, -0.02160655893, -0.03595263511, -0.04045860469,
-	-0.03069086559,-0.005200711545,  0.03375627473,  0.08042213321,   0.1266582161,
-	0.1637348831,   0.1843478978,   0.1843478978,   0.1637348831,   0.1266582161,
-	0.08042213321,  0.03375627473,-0.005200711545, -0.03069086559, -0.04045860469,
-	-0.03595263511, -0.02160655893, -0.00343928556,  0.01261743531,  0.02220755443,
-	0.02347763069,  0.01724102162,  0.00640197983,-0.005136231426, -0.01372708194,
-	-0.01703078486, -0.01457550935,-0.007711357903,0.0009766072035, 0.008574718609,
-	0.01276883204,  0.01251092646,  0.00824257452, 0.001639342634,-0.005008959211,
-	-0.009565460496, -0.01071097888,-0.008306774311,-0.003360117553, 0.002370125381,
-	0.00698258169,   0.0090502901,  0.00805072207, 0.004481439013,-0.0003565716033,
-	-0.004822196905,-0.007481420878,-0.007560315542,-0.005161649082,-0.001188716153,
-	0.002986602485, 0.005990745034, 0.006895199418, 0.005497781094, 0.002356695011,
-	-0.001424796297,-0.004580684006,-0.006102446001,-0.005557119846,-0.003206040477,
-	0.0001085906042, 0.003261137055, 0.005222215317, 0.005391470157, 0.003778922837,
-	0.0009788711322,-0.002045277972,-0.004290617537,-0.005044592079, -0.00410959078,
-	-0.001849820837,0.0009463682072, 0.003340163268,  0.00455511827, 0.004228024278,
-	0.002514679451,2.319671148e-05,-0.002400794765,-0.003959070891,-0.004163063131,
-	-0.002984911203,-0.0008539527189,  0.00149880501,  0.00328954123, 0.003942436539,
-	0.003273000475, 0.001538956771,-0.0006577187451,-0.002578007756,-0.003594353329,
-	-0.00339410454,-0.002075391589,-0.0001031575812, 0.001853017253, 0.003146317322,
-	0.003365010256, 0.002463605953,0.0007678907132,-0.001140993438, -0.00262592989,
-	-0.003204982262,-0.002708106069,-0.001325029181,0.0004650093615, 0.002059656894,
-	0.002934672637, 0.002816728316, 0.001767164562, 0.000155129921, -0.00147263112,
-	-0.002575787716,-0.002800349845,-0.002090767724,-0.0007029235712,0.0008885191055,
-	0.002151020104, 0.002673039446, 0.002296743216,  0.00116612378,-0.0003282259568,
-	-0.001682589296,-0.002450688975,-0.002389306435,-0.001536005409,-0.0001897329057,
-	0.00119238277, 0.002151112538, 0.002376276068, 0.001807939378,0.0006501053576,
-	-0.0007009095279,-0.001793036121,-0.002268280135,-0.001981025562,-0.001040968928,
-	0.0002268679964, 0.001395473373,  0.00207820232, 0.002057734178, 0.001353691681,
-	0.0002130592038,-0.0009774472564,-0.001821006299,-0.002044065855, -0.00158350938,
-	-0.0006052086246,0.0005566951004, 0.001512393123,  0.00194834685, 0.001728632138,
-	0.000938361627,-0.0001500072249,-0.001169050811,-0.001781637664,-0.001790918293,
-	-0.001204774715,-0.0002280882036,0.0008072586497, 0.001556428266, 0.001774914679,
-	0.00139962812,0.0005651657702,-0.0004427466192,-0.001286412589,-0.001687689684,
-	-0.001521077007,-0.0008511863998,9.030009824e-05,0.0009861291619, 0.001538738376,
-	0.001570516499, 0.001079174341,0.0002372659219,-0.0006697967765,-0.001338820439,
-	-0.001551653957,-0.001244599465,-0.0005287810345,0.0003514243872, 0.001100099995,
-	0.001470797579, 0.001345928642,0.0007755385013,-4.384437125e-05,-0.0008351502474,
-	-0.001336054062, -0.00138414558,-0.000971183239,-0.0002415091294,0.0005565785686,
-	0.001156926504, 0.001362494542, 0.001111661782,0.0004946899717,-0.0002768479171,
-	-0.000944265048,-0.001286669867,-0.001195758465,-0.0007081534131,7.158721928e-06,
-	0.0007090601721,  0.00116372935, 0.001224250416, 0.000876186532,0.0002422659018,
-	-0.0004625963047,-0.001002233243,-0.001200164668,-0.0009953550762,-0.0004627445014,
-	0.0002158327552,0.0008117780089,  0.00112857495, 0.001064619632,0.0006476196577,
-	2.129502718e-05,-0.0006021563313,-0.001015827875,-0.001084772521,-0.0007919007912,
-	-0.0002397333155,0.0003834431118,0.0008696708246, 0.001058707829,0.0008927583112,
-	0.0004319605068,-0.0001652458304,-0.0006985689397,-0.0009909481741,-0.0009493279504,
-	-0.0005921312259,-4.363410335e-05,0.0005112459767,0.0008871846367,0.0009623680962,
-	0.0007158177905, 0.000235083673,-0.0003168187977,-0.0007545514964,-0.0009347448358,
-	-0.0008007952711,-0.0004026504175,0.0001237079559,0.0006005730247,0.0008705699001,
-	0.0008464190178, 0.000541245623,6.031885277e-05,-0.0004330269294,-0.0007749989745,
-	-0.0008535077213,-0.0006470512599,-0.0002280999906,0.0002600666485,0.0006545215729,
-	0.0008248134982,  0.00071830448,0.0003740700486,-8.907986194e-05,-0.0005158000859,
-	-0.0007640240365,-0.0007544864202,-0.0004937081248,-7.293681119e-05,0.0003659524664,
-	0.0006759958924,0.0007566207205,0.0005838825018,0.0002197911817,-0.0002121754515,
-	-0.0005665849894,-0.0007273262017,-0.0006432446535,-0.0003467267961,6.092257172e-05,
-	0.000441689248,0.0006699291407,0.0006714003393,0.0004497691989,8.158407582e-05,
-	-0.0003077154688,-0.0005889057065,-0.000669451314,-0.0005263017374,-0.0002099205449,
-	0.0001710711804,0.0004895554739,0.0006398606929,0.0005752539146,0.0003199186758,
-	-3.754724821e-05,-0.0003772824421,-0.0005858522491,-0.000596579921,-0.0004083189124,
-	-8.750367851e-05,0.0002577258856,0.0005114430096,0.0005913549103,0.0004729183856,
-	0.0001993492333,-0.0001365748903,-0.0004214305663,-0.0005619221483,-0.000512915256,
-	-0.0002943891741,1.896903268e-05,0.0003207088157, 0.000511332124,0.0005284970393,
-	0.0003699540393,9.053492249e-05,-0.0002141762525,-0.000443118246,-0.0005206375499,
-	-0.0004240890557,-0.0001876675233, 0.000107017644,0.0003617258917,0.0004916458856,
-	0.0004563029506,0.0002693931165,-3.748561312e-06,-0.0002715824521,-0.000444409292,
-	-0.000466995989,-0.0003335476213,-9.171908459e-05,0.0001770195231,0.0003821318969,
-	0.0004571757163,0.0003785931331,0.0001757744903,-8.251804684e-05,-0.0003087374498,
-	-0.0004289219214,-0.0004041144857,-0.0002457059163,-7.839226782e-06, 0.000228310746,
-	0.0003850076173,0.0004107079585,0.0002997971606, 9.06962523e-05,-0.0001447086252,
-	-0.0003284387058,-0.0003995293227,-0.0003369942424,-0.0001631283376,6.164200749e-05,
-	0.0002624864283,0.0003722858964,0.0003568451793,0.0002226752695,1.716400402e-05,
-	-0.0001909159328,-0.0003315829963,-0.0003599976189,-0.0002678665332,-8.867527504e-05,
-	0.0001173091805,0.0002803572861,0.0003478087601,0.0002981281141,0.0001506067056,
-	-4.478179835e-05,-0.0002214948618,-0.0003219119972,-0.0003132263373,-0.0002010086318,
-	-2.359290738e-05,0.0001581366523,0.0002844989358,0.0003137121093,0.0002385762782,
-	8.512922795e-05,-9.346209845e-05,-0.0002381900413,-0.0003007790365,-0.0002627137874,
-	-0.0001376307773,3.050869418e-05,0.0001858950709,0.0002763319644,0.0002737161703,
-	0.0001798279263,2.830491758e-05,  -0.0001302655,-0.0002422906837,-0.0002721931669,
-	-0.0002107535547,-8.085373702e-05,7.389497478e-05,0.0002008515148,0.0002591630328,
-	0.0002299426123,0.0001253162627,-1.935190812e-05,-0.0001544690604,-0.0002361608204,
-	-0.0002374724427,-0.0001603623386,-3.105138603e-05,0.0001056950641,0.0002051254269,
-	0.0002341453364,0.0001852809364,7.543496758e-05,-5.69377662e-05,-0.0001682507136,
-	-0.0002211437095,-0.000200004637,-0.0001124854025,1.026630252e-05, 0.000127625055,
-	0.0001999328524,0.0002048651513,0.0001413119317,3.251278758e-05, -8.5334701e-05,
-	-0.0001720935106,-0.0002004940761,-0.0001613535424,-6.988204404e-05,4.334564437e-05,
-	0.0001395144354,0.0001878910116,0.0001725484763,0.0001006835955,-3.523532087e-06,
-	-0.0001040159696,-0.0001683540031,-0.0001751273667,-0.0001240809506,-3.252448732e-05,
-	6.753186608e-05,0.0001435071026,0.0001699141139,0.0001397888554,6.354627112e-05,
-	-3.172382276e-05,-0.0001149393865,-0.0001577796502, -0.00014781348,-8.862518007e-05,
-	-1.722999968e-06,8.433002222e-05,0.0001401470654,0.0001486853143, 0.000107310465,
-	3.167311297e-05,-5.321478602e-05,-0.000118183576,-0.0001429364202,-0.0001193321295,
-	-5.705013973e-05, 2.31776994e-05,9.359458636e-05,0.0001317455899,0.0001250328496,
-	7.743355673e-05,4.725702183e-06,-6.735678471e-05,-0.0001159075182,-0.000124476006,
-	-9.196275641e-05,-2.917212259e-05,4.151030953e-05,9.728605801e-05,0.0001191378542,
-	0.0001014460868,5.017494186e-05,-1.605595025e-05,-7.571362221e-05,-0.0001083148527,
-	-0.0001043843367,-6.527435471e-05,-5.413615781e-06, 5.53485188e-05,9.647732804e-05,
-	0.0001052397856,7.864928193e-05,2.763530938e-05,-3.125720104e-05,-7.721639849e-05,
-	-9.597740427e-05,-8.076281665e-05,-3.811134957e-05, 1.81750238e-05,6.830348866e-05,
-	9.67400556e-05,9.389858315e-05,6.258271605e-05,1.352720938e-05,-3.511851173e-05,
-	-6.705369742e-05,-7.034234295e-05,-4.388620073e-05,3.580177008e-06,5.808706919e-05,
-	0.0001010705455,0.0001189960603,0.0001092564053,7.602092955e-05,3.436718907e-05,
-	7.637481758e-07,-7.83437099e-06,1.579483433e-05,7.079522766e-05,0.0001438790932,
-	0.0002174812253,0.0002708347747,0.0002904133871,0.0002698065073,0.0002157484705,
-	0.0001419919281,6.948468217e-05,1.639863513e-05,-0.0007401077892
-};
+	const QualityPreset& preset = qualityPresets[quality];
+	create(inputRate, outputRate, preset.phases, preset.tapsPerPhase, gain);
+}
 
-static const float H20[1024] = {
-	0.0008240168681,0.0001679330599,0.0001217858808,4.146389256e-05,-5.349929052e-05,
-	-0.0001389856625, -0.00019369449,-0.0002057976526,-0.0001767145586,-0.0001204761138,
-	-5.88586845e-05,-1.366535616e-05,7.202099823e-07,-1.807569424e-05,-6.059814405e-05,
-	-0.0001090626247,-0.0001432044228,-0.0001473566663,-0.0001209180627,-7.065550017e-05,
-	-1.540468656e-05,2.513567961e-05,3.642156662e-05,1.457370035e-05,-3.163942893e-05,
-	-8.422428073e-05,-0.0001223258296,-0.0001304532198,-0.0001041847136,-5.210897871e-05,
-	7.489859854e-06,5.285043881e-05,6.700627273e-05,4.451045243e-05,-6.027933978e-06,
-	-6.621636567e-05,-0.0001125229537,-0.0001270347566,-0.000102979815,-4.806155266e-05,
-	1.817039447e-05, 7.14560083e-05,9.176084131e-05,7.108772115e-05,1.660610542e-05,
-	-5.167805284e-05,-0.0001081790397,-0.0001310006483,-0.0001104887997,-5.312892972e-05,
-	2.062024214e-05,8.380957297e-05,0.0001124259215,9.540813335e-05,3.813171861e-05,
-	-3.855974501e-05, -0.00010613833,-0.0001388213132,-0.0001233638322,-6.435367686e-05,
-	1.718927524e-05,9.134307038e-05,0.0001302366582,0.0001185867732,5.976888133e-05,
-	-2.505908742e-05,-0.000104596802,-0.0001487438858,-0.0001400164474,-8.052471821e-05,
-	8.757784599e-06,9.505241906e-05, 0.000146021368,0.0001418760949,8.299229376e-05,
-	-9.612638678e-06,-0.000101968908,-0.0001593451598,-0.0001594637579,-0.0001009329135,
-	-4.451021141e-06,    9.47597e-05, 0.000159568488,0.0001650275954,0.0001078473651,
-	8.276463632e-06,-9.735559433e-05,-0.0001694040839,-0.0001802275947,-0.000124362763,
-	-2.138766831e-05,9.116400179e-05,0.0001713137026,0.0001884205558,0.0001347520738,
-	2.903502718e-05,-9.022097947e-05,-0.0001785631466,-0.0002022777771,-0.0001510971197,
-	-4.273862578e-05, 8.34496459e-05,0.0001805518841,0.0002116360411,0.0001637507085,
-	5.328892803e-05,-7.963798998e-05,-0.0001856197778, -0.00022448253,-0.0001802482002,
-	-6.790930638e-05,7.189327152e-05,0.0001872964785,0.0002346901019,0.0001949239668,
-	8.128901391e-05,-6.515479618e-05,-0.0001901565411,-0.000246557116,-0.0002118340344,
-	-9.73359638e-05, 5.57043677e-05,0.0001906316757,0.0002566743351,0.0002277321328,
-	0.0001129021766,-4.649516632e-05,-0.0001915832108,-0.0002678296296,-0.0002453306806,
-	-0.0001307028142,3.491314783e-05,0.0001904373785,0.0002775312169,0.0002622615721,
-	0.0001485124085,-2.300161213e-05,-0.0001891133143,-0.0002875667997,-0.0002802323434,
-	-0.0001679487905,9.227029295e-06, 0.000186113888,0.0002965769963,0.0002980027348,
-	0.000187939484,5.510085884e-06,-0.0001822565973,-0.0003052575921,-0.0003162405919,
-	-0.0002091456263,-2.190001396e-05, 0.000176809699,0.0003128843964,0.0003342256532,
-	0.0002308841067,3.926224235e-05,-0.0001704329479,-0.000320109044,-0.0003526672081,
-	-0.0002538977133,-5.842430255e-05,0.0001622708951,0.0003260931408,0.0003707310534,
-	0.0002774409077,7.871077833e-05,-0.0001528974535,-0.0003313414054,-0.0003889043292,
-	-0.0003019944415,-0.0001006215825,0.0001418268512,0.0003353715583,0.0004067597038,
-	0.0003272267058,0.0001239224366,-0.0001291632361,-0.0003382374998,-0.0004243104486,
-	-0.0003531342372,-0.000148644438,0.0001148749725,0.0003398813133,0.0004415338335,
-	0.0003797571408,0.0001748939103,-9.87945532e-05,-0.0003401213035,-0.0004582492402,
-	-0.0004069827846,-0.0002026480215, 8.08391851e-05,0.0003387753968,0.0004742508463,
-	0.0004345806956,0.0002316987957,-6.118448073e-05,-0.000336016441,-0.0004897012259,
-	-0.0004627785238,-0.0002623397449,3.947265941e-05, 0.000331455085,0.0005042343982,
-	0.0004912622971,0.0002943630097,-1.580935168e-05,-0.0003250968875,-0.0005178085994,
-	-0.0005200039013,-0.0003277576179,-9.84774033e-06,0.0003168828844,0.0005303743528,
-	0.0005489900941,0.0003626136458,3.767196176e-05,-0.0003065608034,-0.0005416538334,
-	-0.0005779642961,-0.0003987227392,-6.753476919e-05,0.0002941989806,0.0005516738747,
-	0.0006069770316,0.0004361915344,9.960129682e-05,-0.0002795712498, -0.00056020997,
-	-0.0006358294631,-0.0004748989013,-0.000133864145,  0.00026260718,0.0005671308609,
-	0.0006644017412,0.0005147653283,0.0001703002199,-0.0002432765032,-0.0005723978975,
-	-0.0006926899077,-0.0005558875855,-0.0002091154602,0.0002212714608, 0.000575640297,
-	0.0007203281275,0.0005979315611,0.0002500622068,-0.0001967579447,-0.0005769825657,
-	-0.0007474312442,-0.000641070772,-0.0002933716169,0.0001694498205,0.0005761220236,
-	0.0007737418637,0.0006851449725,0.0003390281054,-0.0001392353879,-0.0005728491815,
-	-0.0007990222657,-0.000729944848,-0.0003868752101,0.0001061899238,0.0005672065308,
-	0.0008233273984, 0.000775589142,0.0004371410178,-7.000730693e-05,-0.0005588338245,
-	-0.000846311159,-0.0008218063158,-0.0004896679893,3.071855463e-05,0.0005476812948,
-	0.0008678950253,0.0008685607463,0.0005444907583,1.178375805e-05,-0.0005335907335,
-	-0.0008879489033,-0.0009158008615,-0.000601692067,-5.772295117e-05, 0.000516253931,
-	0.0009061257006,0.0009632250294,0.0006610575365,0.0001069885766,-0.0004957044148,
-	-0.0009224514943,-0.001010915032,-0.0007227781462,-0.0001598718954,0.0004715790856,
-	0.000936560391, 0.001058584428,0.0007866879459,0.0002163552854,-0.0004437961907,
-	-0.0009483449976,-0.001106162905,-0.0008528206381,-0.0002765741665,0.0004121451057,
-	0.000957593089, 0.001153521356,0.0009211860597, 0.000340693281,-0.0003763541463,
-	-0.0009639867931,-0.001200385392,-0.0009916097624,-0.0004086483095,0.0003364022123,
-	0.0009675172041, 0.001246836619, 0.001064326148,0.0004808487429,-0.0002917585953,
-	-0.0009675985784,-0.001292336849,-0.001138912281,-0.0005570056965,0.0002426184074,
-	0.0009644203819,  0.00133715116,  0.00121578353,0.0006376873353,-0.0001883043151,
-	-0.0009572865674,-0.001380686532,-0.001294513349,-0.0007226613816,0.0001288999047,
-	0.0009462308954, 0.001423015841, 0.001375302905,0.0008122678264,-6.397478137e-05,
-	-0.0009308363078, -0.00146384968,-0.001458062558,-0.0009066369967,-6.751789442e-06,
-	0.0009107745718, 0.001502944506,  0.00154273049, 0.001005896251,8.354724559e-05,
-	-0.0008857662324,-0.001540135359,  -0.0016293386,-0.001110301237,-0.0001668089244,
-	0.0008553990046, 0.001575144706, 0.001717842068, 0.001220048638,0.0002568998316,
-	-0.0008192932,-0.001607719692,-0.001808228437,-0.001335373847,-0.0003542055201,
-	0.0007770670345, 0.001637664158, 0.001900587464, 0.001456660219,0.0004593044287,
-	-0.0007281375001, -0.00166457158,-0.001994821476,-0.001584117766,-0.0005725933006,
-	0.0006721236277, 0.001688286779, 0.002091124887, 0.001718298183,0.0006948304945,
-	-0.0006082921172,-0.001708339201,-0.002189443447,-0.001859544311,-0.0008265980287,
-	0.0005360895302, 0.001724474132, 0.002289975528, 0.002008500975,0.0009687810671,
-	-0.0004546970595,-0.001736246864,-0.002392829163,-0.002165800659,-0.001122311456,
-	0.0003632534354, 0.001743213739, 0.002498189453, 0.002332221251, 0.001288274536,
-	-0.0002607791976,-0.001744919922,-0.002606355585,-0.002508765319,-0.001468050061,
-	0.0001460323983, 0.001740739914, 0.002717594383, 0.002696522977, 0.001663147938,
-	-1.768158108e-05,-0.001730105258, -0.00283241435,-0.002896999475,-0.001875574933,
-	-0.0001260504359, 0.001712156227, 0.002951262053, 0.003111829283, 0.002107559703,
-	0.0002871012257,  -0.0016860998,-0.003074938431,-0.003343271092,-0.002362071071,
-	-0.0004680576094,  0.00165077066, 0.003204272594, 0.003593966598, 0.002642651321,
-	0.0006719941157,-0.001604853431,   -0.003340411,-0.003867300693,-0.002953756601,
-	-0.0009027287015, 0.001546817599, 0.003485012101, 0.004167830572, 0.003301373683,
-	0.001165468944,-0.001474343473,-0.003639814444,-0.004501003772,-0.003692760598,
-	-0.001466437476, 0.001385010662, 0.003807732835, 0.004874628503, 0.004138123244,
-	0.001814459451, -0.00127505674,-0.003992175683,-0.005298730452,-0.004650796298,
-	-0.002221091185, 0.001139743836,  0.00419813348, 0.005787358154, 0.005249385722,
-	0.002702469705,-0.0009724576958,-0.004432713147,-0.006360520143,-0.005960548762,
-	-0.003281908575,0.0007634267677, 0.004705939908, 0.007047123276, 0.006823123898,
-	0.003993531223,-0.0004985557753,-0.005033488851,-0.007891686633,-0.007897271775,
-	-0.004890735261,0.0001552715548, 0.005439614877, 0.008964833803, 0.009279680438,
-	0.006060293876,0.0003032128443,-0.005965650082, -0.01038739085, -0.01113798842,
-	-0.007655037101,-0.000943038438, 0.006686255336,  0.01238266844,  0.01378850173,
-	0.009969598614, 0.001894435612,-0.007753159851,  -0.0154159097, -0.01790952496,
-	-0.01365614776,-0.003455949016, 0.009527260438,  0.02064161561,  0.02526470833,
-	0.02050109953, 0.006494702771, -0.01312943548, -0.03193108737, -0.04232110083,
-	-0.03778770193, -0.01503088418,  0.02466286346,  0.07527848333,   0.1272838712,
-	0.1699116379,   0.1938959956,   0.1938959956,   0.1699116379,   0.1272838712,
-	0.07527848333,  0.02466286346, -0.01503088418, -0.03778770193, -0.04232110083,
-	-0.03193108737, -0.01312943548, 0.006494702771,  0.02050109953,  0.02526470833,
-	0.02064161561, 0.009527260438,-0.003455949016, -0.01365614776, -0.01790952496,
-	-0.0154159097,-0.007753159851, 0.001894435612, 0.009969598614,  0.01378850173,
-	0.01238266844, 0.006686255336,-0.000943038438,-0.007655037101, -0.01113798842,
-	-0.01038739085,-0.005965650082,0.0003032128443, 0.006060293876, 0.009279680438,
-	0.008964833803, 0.005439614877,0.0001552715548,-0.004890735261,-0.007897271775,
-	-0.007891686633,-0.005033488851,-0.0004985557753, 0.003993531223, 0.006823123898,
-	0.007047123276, 0.004705939908,0.0007634267677,-0.003281908575,-0.005960548762,
-	-0.006360520143,-0.004432713147,-0.0009724576958, 0.002702469705, 0.005249385722,
-	0.005787358154,  0.00419813348, 0.001139743836,-0.002221091185,-0.004650796298,
-	-0.005298730452,-0.003992175683, -0.00127505674, 0.001814459451, 0.004138123244,
-	0.004874628503, 0.003807732835, 0.001385010662,-0.001466437476,-0.003692760598,
-	-0.004501003772,-0.003639814444,-0.001474343473, 0.001165468944, 0.003301373683,
-	0.004167830572, 0.003485012101, 0.001546817599,-0.0009027287015,-0.002953756601,
-	-0.003867300693,   -0.003340411,-0.001604853431,0.0006719941157, 0.002642651321,
-	0.003593966598, 0.003204272594,  0.00165077066,-0.0004680576094,-0.002362071071,
-	-0.003343271092,-0.003074938431,  -0.0016860998,0.0002871012257, 0.002107559703,
-	0.003111829283, 0.002951262053, 0.001712156227,-0.0001260504359,-0.001875574933,
-	-0.002896999475, -0.00283241435,-0.001730105258,-1.768158108e-05, 0.001663147938,
-	0.002696522977, 0.002717594383, 0.001740739914,0.0001460323983,-0.001468050061,
-	-0.002508765319,-0.002606355585,-0.001744919922,-0.0002607791976, 0.001288274536,
-	0.002332221251, 0.002498189453, 0.001743213739,0.0003632534354,-0.001122311456,
-	-0.002165800659,-0.002392829163,-0.001736246864,-0.0004546970595,0.0009687810671,
-	0.002008500975, 0.002289975528, 0.001724474132,0.0005360895302,-0.0008265980287,
-	-0.001859544311,-0.002189443447,-0.001708339201,-0.0006082921172,0.0006948304945,
-	0.001718298183, 0.002091124887, 0.001688286779,0.0006721236277,-0.0005725933006,
-	-0.001584117766,-0.001994821476, -0.00166457158,-0.0007281375001,0.0004593044287,
-	0.001456660219, 0.001900587464, 0.001637664158,0.0007770670345,-0.0003542055201,
-	-0.001335373847,-0.001808228437,-0.001607719692,  -0.0008192932,0.0002568998316,
-	0.001220048638, 0.001717842068, 0.001575144706,0.0008553990046,-0.0001668089244,
-	-0.001110301237,  -0.0016293386,-0.001540135359,-0.0008857662324,8.354724559e-05,
-	0.001005896251,  0.00154273049, 0.001502944506,0.0009107745718,-6.751789442e-06,
-	-0.0009066369967,-0.001458062558, -0.00146384968,-0.0009308363078,-6.397478137e-05,
-	0.0008122678264, 0.001375302905, 0.001423015841,0.0009462308954,0.0001288999047,
-	-0.0007226613816,-0.001294513349,-0.001380686532,-0.0009572865674,-0.0001883043151,
-	0.0006376873353,  0.00121578353,  0.00133715116,0.0009644203819,0.0002426184074,
-	-0.0005570056965,-0.001138912281,-0.001292336849,-0.0009675985784,-0.0002917585953,
-	0.0004808487429, 0.001064326148, 0.001246836619,0.0009675172041,0.0003364022123,
-	-0.0004086483095,-0.0009916097624,-0.001200385392,-0.0009639867931,-0.0003763541463,
-	0.000340693281,0.0009211860597, 0.001153521356, 0.000957593089,0.0004121451057,
-	-0.0002765741665,-0.0008528206381,-0.001106162905,-0.0009483449976,-0.0004437961907,
-	0.0002163552854,0.0007866879459, 0.001058584428, 0.000936560391,0.0004715790856,
-	-0.0001598718954,-0.0007227781462,-0.001010915032,-0.0009224514943,-0.0004957044148,
-	0.0001069885766,0.0006610575365,0.0009632250294,0.0009061257006, 0.000516253931,
-	-5.772295117e-05,-0.000601692067,-0.0009158008615,-0.0008879489033,-0.0005335907335,
-	1.178375805e-05,0.0005444907583,0.0008685607463,0.0008678950253,0.0005476812948,
-	3.071855463e-05,-0.0004896679893,-0.0008218063158,-0.000846311159,-0.0005588338245,
-	-7.000730693e-05,0.0004371410178, 0.000775589142,0.0008233273984,0.0005672065308,
-	0.0001061899238,-0.0003868752101,-0.000729944848,-0.0007990222657,-0.0005728491815,
-	-0.0001392353879,0.0003390281054,0.0006851449725,0.0007737418637,0.0005761220236,
-	0.0001694498205,-0.0002933716169,-0.000641070772,-0.0007474312442,-0.0005769825657,
-	-0.0001967579447,0.0002500622068,0.0005979315611,0.0007203281275, 0.000575640297,
-	0.0002212714608,-0.0002091154602,-0.0005558875855,-0.0006926899077,-0.0005723978975,
-	-0.0002432765032,0.0001703002199,0.0005147653283,0.0006644017412,0.0005671308609,
-	0.00026260718,-0.000133864145,-0.0004748989013,-0.0006358294631, -0.00056020997,
-	-0.0002795712498,9.960129682e-05,0.0004361915344,0.0006069770316,0.0005516738747,
-	0.0002941989806,-6.753476919e-05,-0.0003987227392,-0.0005779642961,-0.0005416538334,
-	-0.0003065608034,3.767196176e-05,0.0003626136458,0.0005489900941,0.0005303743528,
-	0.0003168828844,-9.84774033e-06,-0.0003277576179,-0.0005200039013,-0.0005178085994,
-	-0.0003250968875,-1.580935168e-05,0.0002943630097,0.0004912622971,0.0005042343982,
-	0.000331455085,3.947265941e-05,-0.0002623397449,-0.0004627785238,-0.0004897012259,
-	-0.000336016441,-6.118448073e-05,0.0002316987957,0.0004345806956,0.0004742508463,
-	0.0003387753968, 8.08391851e-05,-0.0002026480215,-0.0004069827846,-0.0004582492402,
-	-0.0003401213035,-9.87945532e-05,0.0001748939103,0.0003797571408,0.0004415338335,
-	0.0003398813133,0.0001148749725,-0.000148644438,-0.0003531342372,-0.0004243104486,
-	-0.0003382374998,-0.0001291632361,0.0001239224366,0.0003272267058,0.0004067597038,
-	0.0003353715583,0.0001418268512,-0.0001006215825,-0.0003019944415,-0.0003889043292,
-	-0.0003313414054,-0.0001528974535,7.871077833e-05,0.0002774409077,0.0003707310534,
-	0.0003260931408,0.0001622708951,-5.842430255e-05,-0.0002538977133,-0.0003526672081,
-	-0.000320109044,-0.0001704329479,3.926224235e-05,0.0002308841067,0.0003342256532,
-	0.0003128843964, 0.000176809699,-2.190001396e-05,-0.0002091456263,-0.0003162405919,
-	-0.0003052575921,-0.0001822565973,5.510085884e-06, 0.000187939484,0.0002980027348,
-	0.0002965769963, 0.000186113888,9.227029295e-06,-0.0001679487905,-0.0002802323434,
-	-0.0002875667997,-0.0001891133143,-2.300161213e-05,0.0001485124085,0.0002622615721,
-	0.0002775312169,0.0001904373785,3.491314783e-05,-0.0001307028142,-0.0002453306806,
-	-0.0002678296296,-0.0001915832108,-4.649516632e-05,0.0001129021766,0.0002277321328,
-	0.0002566743351,0.0001906316757, 5.57043677e-05,-9.73359638e-05,-0.0002118340344,
-	-0.000246557116,-0.0001901565411,-6.515479618e-05,8.128901391e-05,0.0001949239668,
-	0.0002346901019,0.0001872964785,7.189327152e-05,-6.790930638e-05,-0.0001802482002,
-	-0.00022448253,-0.0001856197778,-7.963798998e-05,5.328892803e-05,0.0001637507085,
-	0.0002116360411,0.0001805518841, 8.34496459e-05,-4.273862578e-05,-0.0001510971197,
-	-0.0002022777771,-0.0001785631466,-9.022097947e-05,2.903502718e-05,0.0001347520738,
-	0.0001884205558,0.0001713137026,9.116400179e-05,-2.138766831e-05,-0.000124362763,
-	-0.0001802275947,-0.0001694040839,-9.735559433e-05,8.276463632e-06,0.0001078473651,
-	0.0001650275954, 0.000159568488,    9.47597e-05,-4.451021141e-06,-0.0001009329135,
-	-0.0001594637579,-0.0001593451598,-0.000101968908,-9.612638678e-06,8.299229376e-05,
-	0.0001418760949, 0.000146021368,9.505241906e-05,8.757784599e-06,-8.052471821e-05,
-	-0.0001400164474,-0.0001487438858,-0.000104596802,-2.505908742e-05,5.976888133e-05,
-	0.0001185867732,0.0001302366582,9.134307038e-05,1.718927524e-05,-6.435367686e-05,
-	-0.0001233638322,-0.0001388213132, -0.00010613833,-3.855974501e-05,3.813171861e-05,
-	9.540813335e-05,0.0001124259215,8.380957297e-05,2.062024214e-05,-5.312892972e-05,
-	-0.0001104887997,-0.0001310006483,-0.0001081790397,-5.167805284e-05,1.660610542e-05,
-	7.108772115e-05,9.176084131e-05, 7.14560083e-05,1.817039447e-05,-4.806155266e-05,
-	-0.000102979815,-0.0001270347566,-0.0001125229537,-6.621636567e-05,-6.027933978e-06,
-	4.451045243e-05,6.700627273e-05,5.285043881e-05,7.489859854e-06,-5.210897871e-05,
-	-0.0001041847136,-0.0001304532198,-0.0001223258296,-8.422428073e-05,-3.163942893e-05,
-	1.457370035e-05,3.642156662e-05,2.513567961e-05,-1.540468656e-05,-7.065550017e-05,
-	-0.0001209180627,-0.0001473566663,-0.0001432044228,-0.0001090626247,-6.059814405e-05,
-	-1.807569424e-05,7.202099823e-07,-1.366535616e-05,-5.88586845e-05,-0.0001204761138,
-	-0.0001767145586,-0.0002057976526, -0.00019369449,-0.0001389856625,-5.349929052e-05,
-	4.146389256e-05,0.0001217858808,0.0001679330599,0.0008240168681
-};
+void SSEInterpolator::setBackend(SIMD::Backend backend)
+{
+	if(!SIMD::isSupported(backend)) {
+		qWarning("SSEInterpolator: SIMD backend %s is not supported", SIMD::backendName(backend));
+		return;
+	}
+	m_backend = backend;
+	selectKernels();
+}
 
-static const float H22[1024] = {
-	0.000100693891,0.0009049997316, 0.000212169427,0.0002423894039,0.0001405156218,
-	3.377647954e-05,-5.476215301e-05,-9.893185052e-05,-8.989333583e-05,-4.026281022e-05,
-	2.421041063e-05,7.276056567e-05, 8.50748911e-05,5.654100823e-05,2.277710792e-06,
-	-5.2853753e-05,-8.273906133e-05,-7.44347708e-05,-3.10987125e-05,2.674452662e-05,
-	7.325474144e-05,8.621933375e-05,5.996334949e-05, 5.29441968e-06,-5.244969725e-05,
-	-8.75763435e-05,-8.292183338e-05,-4.059863568e-05,2.150155888e-05,7.476258179e-05,
-	9.546772344e-05,7.279527927e-05,1.680318746e-05,-4.852228449e-05,-9.297698853e-05,
-	-9.652970039e-05,-5.586837506e-05,1.083634834e-05,7.451701822e-05,0.0001054167587,
-	8.949892072e-05, 3.22951455e-05,-4.045387323e-05,-9.693764878e-05,-0.0001105568881,
-	-7.480133354e-05,-3.833209576e-06,7.027819083e-05,0.0001145637216,0.0001074729807,
-	5.201295426e-05,-2.84575799e-05,-9.765482537e-05, -0.00012490667,-9.574073192e-05,
-	-2.269664401e-05,6.244808174e-05,0.0001207621826,0.0001266050531,7.477377949e-05,
-	-1.200888892e-05,-9.52998671e-05,-0.0001370883547,-0.0001186774607,-4.506157711e-05,
-	4.945983892e-05, 0.000124601167,0.0001446225651,9.994430729e-05,9.035754374e-06,
-	-8.804674144e-05,-0.0001475358877,-0.0001417409367,-7.191208715e-05,3.191463111e-05,
-	0.0001233517978,0.0001610802719,0.0001266242034,3.434870086e-05,-7.564736734e-05,
-	-0.0001536774216,-0.0001641851704,-0.0001005533923,9.662621778e-06,0.0001180827458,
-	0.0001752631506,0.0001547281718,6.370832853e-05,-5.773541852e-05,-0.0001558691001,
-	-0.0001854924049,-0.0001322342578,-1.793563024e-05,0.0001066259792,0.0001858302712,
-	0.0001825247164, 9.69976827e-05,-3.424254828e-05,-0.0001524696563,-0.000204541022,
-	-0.0001651233906,-5.056557347e-05,8.934488869e-05,0.0001914770401,0.0002094694646,
-	0.0001331260573,-4.610359156e-06,-0.0001432739082,-0.0002197838767,-0.0001987855503,
-	-8.750700363e-05,6.520697934e-05,0.0001917733753,0.0002340673673,0.0001717207633,
-	3.053466207e-05,-0.0001269311178,-0.0002304705413,-0.0002317697799,-0.0001286819606,
-	3.455443584e-05,0.0001851818379,0.0002553761879,0.0002114067611,7.153919432e-05,
-	-0.0001034575471,-0.0002349725401,-0.0002630532836,-0.0001729319774,-3.236534894e-06,
-	0.0001713147358,0.0002715678129,0.0002515311644, 0.000117322299,-7.19225136e-05,
-	-0.0002325519163,-0.0002909590839,-0.0002195009147,-4.746826744e-05,0.0001489000133,
-	0.000281935645,0.0002900330292,0.0001677012915,-3.265124906e-05,-0.0002216896246,
-	-0.0003143579524,-0.0002667238005,-9.810479969e-05,0.0001180057152,0.0002846038551,
-	0.0003260565863,0.0002210743405,1.473719658e-05,-0.000202112089,-0.0003315091017,
-	-0.0003138890024,-0.0001542516256,7.754858962e-05,0.0002786327386,0.0003574730654,
-	0.0002766968973,6.957513688e-05,-0.0001723527675,-0.0003409468918,-0.0003586206003,
-	-0.0002150979562,2.808214049e-05,0.0002626494679,0.0003830029746,0.0003326263977,
-	0.0001316134731,-0.000132372079,-0.0003410506761,-0.0003997037129,-0.0002790518047,
-	-3.070315142e-05,0.0002359044447,0.0004005321825, 0.000387550419,0.0001995443745,
-	-8.146851178e-05,-0.0003306454455,-0.0004348202492,-0.0003449430806,-9.792567289e-05,
-	0.0001972584432,0.0004085737455,0.0004391683906,0.0002724583901,-1.997767504e-05,
-	-0.0003081016766,-0.0004623281129,-0.0004105976841,-0.0001730696531,0.0001464708766,
-	0.0004052046279,0.0004856317246,0.0003484718909,5.208762013e-05,-0.0002727281244,
-	-0.000479864364,-0.0004742465389,-0.0002546815667,8.309858094e-05,0.0003890647495,
-	0.0005245436914,0.0004259869165,0.0001337176509,-0.0002234203566,-0.0004857915628,
-	-0.0005333675072,-0.0003415024257,7.468663171e-06,0.0003585855884,0.0005538800033,
-	0.000502588402,0.0002241164329,-0.000159927411,-0.0004779671726,-0.0005858588265,
-	-0.0004313796235,-8.017803339e-05,0.0003128465032,0.0005710584228,0.0005761784269,
-	0.0003216358018,-8.177061682e-05,-0.0004548284342,-0.0006287749275,-0.0005222701584,
-	-0.000178639777,0.0002508177713,0.0005741407513,0.0006437946577,0.0004245599848,
-	1.046745001e-05,-0.0004147608415,-0.0006599125918,-0.0006115105352,-0.0002869004966,
-	0.0001721676817,0.0005607606145,0.0007029042463,0.0005304720253,0.0001164248024,
-	-0.0003566434898,-0.0006763610872,-0.0006964285276,-0.0004029254196,7.659180847e-05,
-	0.0005291901762, 0.000750327541,0.0006369361654,0.0002347329428,-0.0002794351312,
-	-0.0006757874507,-0.0007737439009,-0.000524724659,-3.530491085e-05,0.0004775216221,
-	0.000783289317,0.0007407933008,0.0003639555944,-0.0001827863161,-0.0006555993459,
-	-0.0008404405671,-0.0006494423724,-0.0001629166218,0.0004046153044,0.0007985984557,
-	0.0008389441064,0.0005018750089,-6.649075658e-05,-0.0006137863966,-0.0008929587784,
-	-0.0007742087473,-0.0003047268547,0.0003092725237,0.0007935338654,0.0009277047939,
-	0.0006460452569,6.886803749e-05,-0.0005482346169,-0.0009279874503,-0.0008954452351,
-	-0.0004590068711,0.0001911019062,0.0007651592023, 0.001003462123,0.0007932675071,
-	0.0002224583004,-0.0004575442872,-0.0009419207927,-0.001009500702,-0.0006231823936,
-	4.989434456e-05,0.0007110842853, 0.001062135561, 0.000940147962,0.0003925568599,
-	-0.0003404357412,-0.0009315955103,-0.001112172031,-0.0007944891113,-0.0001137508953,
-	0.0006289084558, 0.001099922112, 0.001082638279,0.0005772782606,-0.0001962756505,
-	-0.0008935358492,-0.001199221821,-0.0009692679159,-0.0002989092027,0.0005168667412,
-	0.001112611499, 0.001216491219,0.0007737105479,-2.476153531e-05,-0.0008249023231,
-	-0.001266019884,-0.001143656904,-0.0005038278177,0.0003733162303, 0.001096386462,
-	0.001336888876,0.0009787711315,0.0001736113045,-0.0007227661554,-0.001307995059,
-	-0.00131307682,-0.0007264270098,0.0001973360922, 0.001047180383, 0.001438964624,
-	0.001188444206, 0.000398107979,-0.0005847882712,-0.001320237177,-0.001472719596,
-	-0.0009637250332,-1.181975495e-05, 0.000961342419, 0.001517274766, 0.001398479566,
-	0.000647090259,-0.0004086704284,-0.001298032817,-0.001617083908,-0.001212424948,
-	-0.0002541033027,0.0008351033903, 0.001566399937, 0.001603793935,0.0009186048992,
-	-0.000192750158,-0.001236356678,-0.001740514999,-0.001468387782,-0.0005292561837,
-	0.000665121479, 0.001580426702, 0.001799035585, 0.001209922601,6.458777352e-05,
-	-0.001130365999,-0.001836695592,-0.001727146097,-0.0008363202214,0.0004478947376,
-	0.00155340007, 0.001978094457, 0.001518032514,0.0003644511162,-0.0009748314042,
-	-0.001899064519, -0.00198338856,-0.001174201258,0.0001801953331, 0.001478758641,
-	0.002134482842,  0.00183913263,0.0007079708157,-0.0007645878941,-0.001920337207,
-	-0.002231571823,-0.001541252248,-0.0001415412989, 0.001349700731, 0.002260940149,
-	0.002169323619, 0.001096121734,-0.0004936964251,-0.001892741886,-0.002465270227,
-	-0.001935940818,-0.0005211007083, 0.001158407074, 0.002349590883, 0.002504060976,
-	0.001530349022,-0.0001556583302, -0.00180727581,-0.002677660901,-0.002356557408,
-	-0.000963291619,0.0008960654959, 0.002391349757, 0.002838771092, 0.002012577374,
-	0.0002576958505,-0.001653688494,-0.002860908629,-0.002802025061,-0.001474204124,
-	0.0005516395904, 0.002375848126, 0.003168466501, 0.002546365373,0.0007567155408,
-	-0.00141914736,-0.003006317187,  -0.0032719234,-0.002062817104,0.0001110467565,
-	0.002290175064, 0.003488318063,  0.00313749793, 0.001356070279,-0.001087178593,
-	-0.003103332361,-0.003767719259,-0.002742430661,-0.0004454885202,  0.00211782055,
-	0.003793257289, 0.003796251025, 0.002077185316,-0.0006346461596,-0.003138919827,
-	-0.004293642472,-0.003534383606,-0.001146996161, 0.001835586387, 0.004078567028,
-	0.004540300462,  0.00295389723,-2.720556949e-05,-0.003095207969,-0.004859460052,
-	-0.004473953974,-0.002039706334, 0.001408730284, 0.004339576699,  0.00540139759,
-	0.004042491317,0.0007908359403,-0.002945658751,-0.005484737456,-0.005623274948,
-	-0.003202173626,0.0007795990678, 0.004572054837, 0.006438161712, 0.005443932489,
-	0.001917283167,-0.002645759378,-0.006209362298, -0.00709910877,-0.004780741408,
-	-0.0001572504261, 0.004772099201, 0.007767591625, 0.007356491871, 0.003543959232,
-	-0.002110586269,-0.007118730806,-0.009145203047, -0.00708115194,-0.001622727956,
-	0.004936398938, 0.009650825523,  0.01022536401,  0.00610589562,-0.001147311996,
-	-0.008421164006, -0.01235635672, -0.01086284593,-0.004175211769, 0.005062121898,
-	0.01279527601,  0.01528529637,  0.01084460225,0.0008083588327, -0.01076269336,
-	-0.01863680966, -0.01865742914,-0.009760603309, 0.005147155374,   0.0199602358,
-	0.02765197493,  0.02326676622, 0.006455825176, -0.01754286885, -0.03905657679,
-	-0.04704168811, -0.03306987882, 0.005190046038,  0.06233599409,    0.126181826,
-	0.1811210066,   0.2128471285,   0.2128471285,   0.1811210066,    0.126181826,
-	0.06233599409, 0.005190046038, -0.03306987882, -0.04704168811, -0.03905657679,
-	-0.01754286885, 0.006455825176,  0.02326676622,  0.02765197493,   0.0199602358,
-	0.005147155374,-0.009760603309, -0.01865742914, -0.01863680966, -0.01076269336,
-	0.0008083588327,  0.01084460225,  0.01528529637,  0.01279527601, 0.005062121898,
-	-0.004175211769, -0.01086284593, -0.01235635672,-0.008421164006,-0.001147311996,
-	0.00610589562,  0.01022536401, 0.009650825523, 0.004936398938,-0.001622727956,
-	-0.00708115194,-0.009145203047,-0.007118730806,-0.002110586269, 0.003543959232,
-	0.007356491871, 0.007767591625, 0.004772099201,-0.0001572504261,-0.004780741408,
-	-0.00709910877,-0.006209362298,-0.002645759378, 0.001917283167, 0.005443932489,
-	0.006438161712, 0.004572054837,0.0007795990678,-0.003202173626,-0.005623274948,
-	-0.005484737456,-0.002945658751,0.0007908359403, 0.004042491317,  0.00540139759,
-	0.004339576699, 0.001408730284,-0.002039706334,-0.004473953974,-0.004859460052,
-	-0.003095207969,-2.720556949e-05,  0.00295389723, 0.004540300462, 0.004078567028,
-	0.001835586387,-0.001146996161,-0.003534383606,-0.004293642472,-0.003138919827,
-	-0.0006346461596, 0.002077185316, 0.003796251025, 0.003793257289,  0.00211782055,
-	-0.0004454885202,-0.002742430661,-0.003767719259,-0.003103332361,-0.001087178593,
-	0.001356070279,  0.00313749793, 0.003488318063, 0.002290175064,0.0001110467565,
-	-0.002062817104,  -0.0032719234,-0.003006317187, -0.00141914736,0.0007567155408,
-	0.002546365373, 0.003168466501, 0.002375848126,0.0005516395904,-0.001474204124,
-	-0.002802025061,-0.002860908629,-0.001653688494,0.0002576958505, 0.002012577374,
-	0.002838771092, 0.002391349757,0.0008960654959,-0.000963291619,-0.002356557408,
-	-0.002677660901, -0.00180727581,-0.0001556583302, 0.001530349022, 0.002504060976,
-	0.002349590883, 0.001158407074,-0.0005211007083,-0.001935940818,-0.002465270227,
-	-0.001892741886,-0.0004936964251, 0.001096121734, 0.002169323619, 0.002260940149,
-	0.001349700731,-0.0001415412989,-0.001541252248,-0.002231571823,-0.001920337207,
-	-0.0007645878941,0.0007079708157,  0.00183913263, 0.002134482842, 0.001478758641,
-	0.0001801953331,-0.001174201258, -0.00198338856,-0.001899064519,-0.0009748314042,
-	0.0003644511162, 0.001518032514, 0.001978094457,  0.00155340007,0.0004478947376,
-	-0.0008363202214,-0.001727146097,-0.001836695592,-0.001130365999,6.458777352e-05,
-	0.001209922601, 0.001799035585, 0.001580426702, 0.000665121479,-0.0005292561837,
-	-0.001468387782,-0.001740514999,-0.001236356678,-0.000192750158,0.0009186048992,
-	0.001603793935, 0.001566399937,0.0008351033903,-0.0002541033027,-0.001212424948,
-	-0.001617083908,-0.001298032817,-0.0004086704284, 0.000647090259, 0.001398479566,
-	0.001517274766, 0.000961342419,-1.181975495e-05,-0.0009637250332,-0.001472719596,
-	-0.001320237177,-0.0005847882712, 0.000398107979, 0.001188444206, 0.001438964624,
-	0.001047180383,0.0001973360922,-0.0007264270098, -0.00131307682,-0.001307995059,
-	-0.0007227661554,0.0001736113045,0.0009787711315, 0.001336888876, 0.001096386462,
-	0.0003733162303,-0.0005038278177,-0.001143656904,-0.001266019884,-0.0008249023231,
-	-2.476153531e-05,0.0007737105479, 0.001216491219, 0.001112611499,0.0005168667412,
-	-0.0002989092027,-0.0009692679159,-0.001199221821,-0.0008935358492,-0.0001962756505,
-	0.0005772782606, 0.001082638279, 0.001099922112,0.0006289084558,-0.0001137508953,
-	-0.0007944891113,-0.001112172031,-0.0009315955103,-0.0003404357412,0.0003925568599,
-	0.000940147962, 0.001062135561,0.0007110842853,4.989434456e-05,-0.0006231823936,
-	-0.001009500702,-0.0009419207927,-0.0004575442872,0.0002224583004,0.0007932675071,
-	0.001003462123,0.0007651592023,0.0001911019062,-0.0004590068711,-0.0008954452351,
-	-0.0009279874503,-0.0005482346169,6.886803749e-05,0.0006460452569,0.0009277047939,
-	0.0007935338654,0.0003092725237,-0.0003047268547,-0.0007742087473,-0.0008929587784,
-	-0.0006137863966,-6.649075658e-05,0.0005018750089,0.0008389441064,0.0007985984557,
-	0.0004046153044,-0.0001629166218,-0.0006494423724,-0.0008404405671,-0.0006555993459,
-	-0.0001827863161,0.0003639555944,0.0007407933008, 0.000783289317,0.0004775216221,
-	-3.530491085e-05,-0.000524724659,-0.0007737439009,-0.0006757874507,-0.0002794351312,
-	0.0002347329428,0.0006369361654, 0.000750327541,0.0005291901762,7.659180847e-05,
-	-0.0004029254196,-0.0006964285276,-0.0006763610872,-0.0003566434898,0.0001164248024,
-	0.0005304720253,0.0007029042463,0.0005607606145,0.0001721676817,-0.0002869004966,
-	-0.0006115105352,-0.0006599125918,-0.0004147608415,1.046745001e-05,0.0004245599848,
-	0.0006437946577,0.0005741407513,0.0002508177713,-0.000178639777,-0.0005222701584,
-	-0.0006287749275,-0.0004548284342,-8.177061682e-05,0.0003216358018,0.0005761784269,
-	0.0005710584228,0.0003128465032,-8.017803339e-05,-0.0004313796235,-0.0005858588265,
-	-0.0004779671726,-0.000159927411,0.0002241164329, 0.000502588402,0.0005538800033,
-	0.0003585855884,7.468663171e-06,-0.0003415024257,-0.0005333675072,-0.0004857915628,
-	-0.0002234203566,0.0001337176509,0.0004259869165,0.0005245436914,0.0003890647495,
-	8.309858094e-05,-0.0002546815667,-0.0004742465389,-0.000479864364,-0.0002727281244,
-	5.208762013e-05,0.0003484718909,0.0004856317246,0.0004052046279,0.0001464708766,
-	-0.0001730696531,-0.0004105976841,-0.0004623281129,-0.0003081016766,-1.997767504e-05,
-	0.0002724583901,0.0004391683906,0.0004085737455,0.0001972584432,-9.792567289e-05,
-	-0.0003449430806,-0.0004348202492,-0.0003306454455,-8.146851178e-05,0.0001995443745,
-	0.000387550419,0.0004005321825,0.0002359044447,-3.070315142e-05,-0.0002790518047,
-	-0.0003997037129,-0.0003410506761,-0.000132372079,0.0001316134731,0.0003326263977,
-	0.0003830029746,0.0002626494679,2.808214049e-05,-0.0002150979562,-0.0003586206003,
-	-0.0003409468918,-0.0001723527675,6.957513688e-05,0.0002766968973,0.0003574730654,
-	0.0002786327386,7.754858962e-05,-0.0001542516256,-0.0003138890024,-0.0003315091017,
-	-0.000202112089,1.473719658e-05,0.0002210743405,0.0003260565863,0.0002846038551,
-	0.0001180057152,-9.810479969e-05,-0.0002667238005,-0.0003143579524,-0.0002216896246,
-	-3.265124906e-05,0.0001677012915,0.0002900330292, 0.000281935645,0.0001489000133,
-	-4.746826744e-05,-0.0002195009147,-0.0002909590839,-0.0002325519163,-7.19225136e-05,
-	0.000117322299,0.0002515311644,0.0002715678129,0.0001713147358,-3.236534894e-06,
-	-0.0001729319774,-0.0002630532836,-0.0002349725401,-0.0001034575471,7.153919432e-05,
-	0.0002114067611,0.0002553761879,0.0001851818379,3.455443584e-05,-0.0001286819606,
-	-0.0002317697799,-0.0002304705413,-0.0001269311178,3.053466207e-05,0.0001717207633,
-	0.0002340673673,0.0001917733753,6.520697934e-05,-8.750700363e-05,-0.0001987855503,
-	-0.0002197838767,-0.0001432739082,-4.610359156e-06,0.0001331260573,0.0002094694646,
-	0.0001914770401,8.934488869e-05,-5.056557347e-05,-0.0001651233906,-0.000204541022,
-	-0.0001524696563,-3.424254828e-05, 9.69976827e-05,0.0001825247164,0.0001858302712,
-	0.0001066259792,-1.793563024e-05,-0.0001322342578,-0.0001854924049,-0.0001558691001,
-	-5.773541852e-05,6.370832853e-05,0.0001547281718,0.0001752631506,0.0001180827458,
-	9.662621778e-06,-0.0001005533923,-0.0001641851704,-0.0001536774216,-7.564736734e-05,
-	3.434870086e-05,0.0001266242034,0.0001610802719,0.0001233517978,3.191463111e-05,
-	-7.191208715e-05,-0.0001417409367,-0.0001475358877,-8.804674144e-05,9.035754374e-06,
-	9.994430729e-05,0.0001446225651, 0.000124601167,4.945983892e-05,-4.506157711e-05,
-	-0.0001186774607,-0.0001370883547,-9.52998671e-05,-1.200888892e-05,7.477377949e-05,
-	0.0001266050531,0.0001207621826,6.244808174e-05,-2.269664401e-05,-9.574073192e-05,
-	-0.00012490667,-9.765482537e-05,-2.84575799e-05,5.201295426e-05,0.0001074729807,
-	0.0001145637216,7.027819083e-05,-3.833209576e-06,-7.480133354e-05,-0.0001105568881,
-	-9.693764878e-05,-4.045387323e-05, 3.22951455e-05,8.949892072e-05,0.0001054167587,
-	7.451701822e-05,1.083634834e-05,-5.586837506e-05,-9.652970039e-05,-9.297698853e-05,
-	-4.852228449e-05,1.680318746e-05,7.279527927e-05,9.546772344e-05,7.476258179e-05,
-	2.150155888e-05,-4.059863568e-05,-8.292183338e-05,-8.75763435e-05,-5.244969725e-05,
-	5.29441968e-06,5.996334949e-05,8.621933375e-05,7.325474144e-05,2.674452662e-05,
-	-3.10987125e-05,-7.44347708e-05,-8.273906133e-05, -5.2853753e-05,2.277710792e-06,
-	5.654100823e-05, 8.50748911e-05,7.276056567e-05,2.421041063e-05,-4.026281022e-05,
-	-8.989333583e-05,-9.893185052e-05,-5.476215301e-05,3.377647954e-05,0.0001405156218,
-	0.0002423894039, 0.000212169427,0.0009049997316, 0.000100693891
-};
+// halve the rate with half-band stages while that leaves at least twice the output rate,
+// each one protects the final passband 0 .. outputRate / 2 from its aliases; returns the
+// rate after the last stage
+double SSEInterpolator::createHalfBands(double inputRate, double outputRate)
+{
+	// existing stages are redesigned in place and keep their buffers, surplus ones stay
+	// around for later configurations
+	m_stages = 0;
+	while((outputRate > 0.0) && (inputRate >= 4.0 * outputRate)) {
+		if(m_halfBands.size() <= (size_t)m_stages)
+			m_halfBands.push_back(HalfBandDecimator());
+		m_halfBands[m_stages++].create(outputRate * 0.5 / inputRate, HistoryChunk, m_backend);
+		inputRate *= 0.5;
+	}
+	if(m_stages > 0) {
+		qDebug("%d half-band stages down to %f", m_stages, inputRate);
+		m_stageI.resize(HistoryChunk);
+		m_stageQ.resize(HistoryChunk);
+	}
+	return inputRate;
+}
 
-static const float H24[1024] = {
-	-0.0002723355137,0.0007254052907, 0.000451198197,0.0003473183897,0.0002451227629,
-	0.0001183656859,-3.768530178e-06,-8.410990267e-05,-9.948918159e-05,-5.69590884e-05,
-	1.361633076e-05,7.087857375e-05,8.586477634e-05,5.189189324e-05,-9.743102055e-06,
-	-6.555550499e-05,-8.425418491e-05,-5.68796022e-05, 2.37802783e-06,6.032766396e-05,
-	8.630347293e-05,6.497823779e-05, 8.35177616e-06,-5.422414324e-05,-8.797105693e-05,
-	-7.508738054e-05,-2.078321631e-05,4.540236478e-05,8.892072947e-05,8.486328443e-05,
-	3.53966534e-05,-3.479843144e-05,-8.73580284e-05,-9.460339061e-05,-5.051833432e-05,
-	2.128551205e-05,8.387388516e-05,0.0001023826917, 6.64021718e-05,-5.928378869e-06,
-	-7.73589345e-05,-0.0001082461968,-8.17752225e-05,-1.158574469e-05,6.719766679e-05,
-	0.0001116193962,9.740546375e-05,3.013947753e-05,-5.441690155e-05,-0.0001121398818,
-	-0.0001107357166,-5.037658775e-05,3.879290671e-05,0.0001088554782,0.0001226370368,
-	7.062950317e-05,-1.99958431e-05,-0.0001024095254,-0.0001314597757,-9.120898903e-05,
-	-8.006770713e-07,9.166220843e-05,0.0001375776774,0.0001104770345,2.407580178e-05,
-	-7.757730782e-05,-0.000139568554,-0.0001287055056,-4.830322359e-05,5.928684186e-05,
-	0.0001379923488,0.0001441549102,7.379756426e-05,-3.804886728e-05,-0.000131516601,
-	-0.0001571095927,-9.884745668e-05,1.323225933e-05,0.0001208488247,0.0001660019188,
-	0.0001235799718,1.383437302e-05,-0.000105175357,-0.0001710095821,-0.0001464341331,
-	-4.330703086e-05,8.552833606e-05,0.0001708849304,0.0001670986967,7.355600246e-05,
-	-6.08826158e-05,-0.0001660128473,-0.0001841917983,-0.0001046799807,3.283421756e-05,
-	0.0001552372996,0.0001976007188,0.0001348397927,-8.597517649e-07,-0.0001392774429,
-	-0.0002056954254,-0.0001639659313,-3.338281022e-05,0.0001172670381,0.0002087139583,
-	0.0001901006326,6.999747711e-05,-9.026838234e-05,-0.0002050417243,-0.0002129629283,
-	-0.0001068712882,5.789510396e-05,0.0001952932653,0.0002305065427,0.0001435480081,
-	-2.227508776e-05,-0.0001792118273,-0.0002438632364,-0.0001792934199,-1.810080175e-05,
-	0.0001562196558,0.0002499971015,0.0002124562598,6.034959733e-05,-0.000126544197,
-	-0.0002497482346,-0.0002414935589,-0.0001045435492,9.118561866e-05,0.0002415539493,
-	0.000266149902,0.0001486772235,-4.999303201e-05,-0.0002260330366,-0.0002842592949,
-	-0.0001921773364,4.601544333e-06,0.0002021783876, 0.000295836915,0.0002328791743,
-	4.481731958e-05,-0.0001709958306,-0.0002990637731,-0.000270180346,-9.613797738e-05,
-	0.0001319988223,0.0002941866405,0.0003018575953,0.0001489282586,-8.66484479e-05,
-	-0.0002797846682,-0.0003274201881,-0.0002007343137,3.499184822e-05,0.0002565838513,
-	0.0003448208154,0.0002508799953,2.103555016e-05,-0.0002237329172,-0.0003537611628,
-	-0.0002968506597,-8.087191236e-05,0.0001823996863,0.0003525743086,0.0003378860129,
-	0.0001422348723,-0.0001323347678,-0.0003413950035,-0.0003715194471,-0.0002042316046,
-	7.531903975e-05,0.0003191022843,0.0003971208935,0.0002641944448,-1.162268836e-05,
-	-0.0002863121626,-0.000412531459,-0.000321103842,-5.639797382e-05,0.0002425266139,
-	0.000417448784,0.0003722042311,0.0001279483113,-0.0001890545245,-0.0004101381346,
-	-0.0004164479615,-0.0002002769761,0.0001260024437,0.0003908782965,0.0004512376909,
-	0.0002722065256,-5.539838457e-05,-0.0003585382365,-0.0004757306306,-0.0003407165932,
-	-2.20024649e-05,0.0003140359477,0.0004877146566,0.0004043966765,0.0001036048125,
-	-0.0002570490178,-0.0004867930256,-0.0004602617992,-0.0001880749624,0.0001892359724,
-	0.0004713860108,0.0005069758627,0.0002723463695,-0.0001110597659,-0.0004417660821,
-	-0.0005417951616,-0.0003547269152,2.492789281e-05,0.0003970829421,0.0005637419526,
-	0.0004319992731,6.798981485e-05,-0.000338480022,-0.0005705780932,-0.0005023582489,
-	-0.000164738376,0.0002658334852,0.0005618245923,0.0005625225022,0.0002635210694,
-	-0.0001811269176,-0.0005358534981,-0.0006106891669,-0.0003605831007,8.552605868e-05,
-	0.000493428146, 0.000644280517,0.0004541606759,1.848270404e-05,-0.0004336266429,
-	-0.0006618789048,-0.0005403547548,-0.0001290119399,0.0003579405311,0.0006613174337,
-	0.0006170126144,0.0002425931889,-0.0002668004017,-0.0006421903963,-0.0006806107122,
-	-0.0003569031833,0.0001625384175,0.0006031126832,0.0007291860529,0.0004679813574,
-	-4.66199599e-05,-0.0005446816795,-0.0007596998475,-0.0005731603596,-7.769274089e-05,
-	0.0004666424065,0.0007708432968,0.0006683260435,0.0002080365375,-0.0003706761927,
-	-0.0007603958948,-0.0007508955896, -0.00034043091,0.0002576942788,0.0007279671845,
-	0.0008169536595,0.0004718773125,-0.0001305536425,-0.0006724142586,-0.0008643241599,
-	-0.0005979175912,-8.731110938e-06,0.0005945333396,0.0008897685912,0.0007152800099,
-	0.0001562674443,-0.0004944927059,-0.0008918863023,-0.0008194555412,-0.0003090778191,
-	0.0003743601555,0.0008684569621,0.0009072770481,0.0004624802677,-0.000235651707,
-	-0.0008192125242,-0.0009746175492,-0.0006128449459,8.172642993e-05,0.0007432567072,
-	0.001018887502,0.0007550641894,8.462039841e-05,-0.0006416898104,-0.001036787406,
-	-0.0008852574974,-0.0002588829084,0.0005151252262, 0.001026714803,0.0009983691853,
-	0.0004372497788,-0.0003661881783,-0.000986630097,-0.001090751146,-0.0006143713836,
-	0.0001969920559,0.0009163048235, 0.001157881808,0.0007858028985,-1.161589444e-05,
-	-0.0008152152877,-0.001196863945,-0.0009457902052,-0.0001863904909,0.0006847677869,
-	0.001204202999, 0.001089676516,0.0003917113354,-0.0005261615734,-0.001178218517,
-	-0.001211840543,-0.0005996586406,0.0003425434115, 0.001116892206, 0.001307990751,
-	0.0008040167741,-0.0001368864614,-0.001020201016,-0.001373213832,-0.0009994013235,
-	-8.597277338e-05,0.0008880029782,  0.00140423188, 0.001179311075,0.0003215570177,
-	-0.0007221147534,-0.001397382468,-0.001338247908,-0.0005637116265,0.0005242901971,
-	0.001350735663, 0.001469769515,0.0008065244183,-0.000298511266,-0.001262519625,
-	-0.001569035812,-0.001042979071,4.850261394e-05, 0.001132766367,  0.00163053826,
-	0.001266541425,0.0002199955779,-0.0009617012693,-0.001650448539,-0.001469692914,
-	-0.0005013338523,0.0007516516489, 0.001624878612, 0.001645914279, 0.000788268575,
-	-0.0005051377811,-0.001551749068,-0.001788000111,-0.001073785126,0.0002267545497,
-	0.001429202734,  0.00189005665, 0.001349542057,7.865764928e-05, -0.00125741784,
-	-0.00194593647,-0.001607734011,-0.0004043264489, 0.001037031994, 0.001951160142,
-	0.00183965906,0.0007433813298,-0.0007707484765,-0.001901319833,-0.002037445316,
-	-0.001087242854,0.0004618757521, 0.001793964999, 0.002192737767, 0.001427454758,
-	-0.0001157883526,-0.001627079677,-0.002298410749,-0.001754168072,-0.0002615422127,
-	0.001400783192, 0.002347307047, 0.002057988429,0.0006622452638,-0.001115888241,
-	-0.002333821496,-0.002328558592,-0.001077940804, 0.000775444787, 0.002252762206,
-	0.002556308405, 0.001498608035,-0.0003833233786,-0.002100774786,-0.002731183311,
-	-0.001913950546,-5.437136497e-05, 0.001875274815, 0.002844273346, 0.002312360564,
-	0.0005306923413,-0.001575752278,-0.002886658767,-0.002682249295,-0.001036570291,
-	0.00120274059, 0.002850928809, 0.003011140274, 0.001562206075,-0.0007589715533,
-	-0.002730093896,-0.003286937252,-0.002095903037,0.0002483321005, 0.002518959809,
-	0.003497060155, 0.002625422785,0.0003230535949, -0.00221306528, -0.00362963439,
-	-0.003136953572,-0.0009479045402, 0.001809924725, 0.003672694089, 0.003616328584,
-	0.001616824302,-0.001307974802,-0.003615171183,-0.004048107658,-0.002319296123,
-	0.0007076453767, 0.003446148476, 0.004416650161, 0.003042871598,-1.036264348e-05,
-	-0.003155723447,-0.004705328029,-0.003774176817,-0.0007807358052, 0.002734042238,
-	0.004897277802, 0.004498166498, 0.001661825692,-0.002171791391,-0.004974380601,
-	-0.005198794883, -0.00262773945, 0.001459259423, 0.004917895421, 0.005858520046,
-	0.003673325991,-0.000586114882,-0.004706918728,-0.006458697375,-0.004793242086,
-	-0.0004603244306, 0.004318019375, 0.006978573743, 0.005983400159, 0.001696207677,
-	-0.00372282532,-0.007395362481,-0.007241812535, -0.00314485142, 0.002885265741,
-	0.007682195865, 0.008571068756, 0.004841260612,-0.001755457255,-0.007806213573,
-	-0.009981304407,-0.006841629744,0.0002598199062, 0.007723233197,  0.01149686985,
-	0.009240124375, 0.001719524385,-0.007368415128, -0.01316832844, -0.01220471505,
-	-0.004387358204, 0.006634208839,  0.01509985607,  0.01605784334, 0.008137247525,
-	-0.005317476112, -0.01751784049, -0.02149172686, -0.01383375935, 0.002963269129,
-	0.0209828373,   0.0302737914,  0.02380825579, 0.001731259283, -0.02727816813,
-	-0.04855760559, -0.04719856009, -0.01469478104,  0.04639107361,   0.1219727695,
-	0.1907226592,   0.2315880805,   0.2315880805,   0.1907226592,   0.1219727695,
-	0.04639107361, -0.01469478104, -0.04719856009, -0.04855760559, -0.02727816813,
-	0.001731259283,  0.02380825579,   0.0302737914,   0.0209828373, 0.002963269129,
-	-0.01383375935, -0.02149172686, -0.01751784049,-0.005317476112, 0.008137247525,
-	0.01605784334,  0.01509985607, 0.006634208839,-0.004387358204, -0.01220471505,
-	-0.01316832844,-0.007368415128, 0.001719524385, 0.009240124375,  0.01149686985,
-	0.007723233197,0.0002598199062,-0.006841629744,-0.009981304407,-0.007806213573,
-	-0.001755457255, 0.004841260612, 0.008571068756, 0.007682195865, 0.002885265741,
-	-0.00314485142,-0.007241812535,-0.007395362481, -0.00372282532, 0.001696207677,
-	0.005983400159, 0.006978573743, 0.004318019375,-0.0004603244306,-0.004793242086,
-	-0.006458697375,-0.004706918728,-0.000586114882, 0.003673325991, 0.005858520046,
-	0.004917895421, 0.001459259423, -0.00262773945,-0.005198794883,-0.004974380601,
-	-0.002171791391, 0.001661825692, 0.004498166498, 0.004897277802, 0.002734042238,
-	-0.0007807358052,-0.003774176817,-0.004705328029,-0.003155723447,-1.036264348e-05,
-	0.003042871598, 0.004416650161, 0.003446148476,0.0007076453767,-0.002319296123,
-	-0.004048107658,-0.003615171183,-0.001307974802, 0.001616824302, 0.003616328584,
-	0.003672694089, 0.001809924725,-0.0009479045402,-0.003136953572, -0.00362963439,
-	-0.00221306528,0.0003230535949, 0.002625422785, 0.003497060155, 0.002518959809,
-	0.0002483321005,-0.002095903037,-0.003286937252,-0.002730093896,-0.0007589715533,
-	0.001562206075, 0.003011140274, 0.002850928809,  0.00120274059,-0.001036570291,
-	-0.002682249295,-0.002886658767,-0.001575752278,0.0005306923413, 0.002312360564,
-	0.002844273346, 0.001875274815,-5.437136497e-05,-0.001913950546,-0.002731183311,
-	-0.002100774786,-0.0003833233786, 0.001498608035, 0.002556308405, 0.002252762206,
-	0.000775444787,-0.001077940804,-0.002328558592,-0.002333821496,-0.001115888241,
-	0.0006622452638, 0.002057988429, 0.002347307047, 0.001400783192,-0.0002615422127,
-	-0.001754168072,-0.002298410749,-0.001627079677,-0.0001157883526, 0.001427454758,
-	0.002192737767, 0.001793964999,0.0004618757521,-0.001087242854,-0.002037445316,
-	-0.001901319833,-0.0007707484765,0.0007433813298,  0.00183965906, 0.001951160142,
-	0.001037031994,-0.0004043264489,-0.001607734011, -0.00194593647, -0.00125741784,
-	7.865764928e-05, 0.001349542057,  0.00189005665, 0.001429202734,0.0002267545497,
-	-0.001073785126,-0.001788000111,-0.001551749068,-0.0005051377811, 0.000788268575,
-	0.001645914279, 0.001624878612,0.0007516516489,-0.0005013338523,-0.001469692914,
-	-0.001650448539,-0.0009617012693,0.0002199955779, 0.001266541425,  0.00163053826,
-	0.001132766367,4.850261394e-05,-0.001042979071,-0.001569035812,-0.001262519625,
-	-0.000298511266,0.0008065244183, 0.001469769515, 0.001350735663,0.0005242901971,
-	-0.0005637116265,-0.001338247908,-0.001397382468,-0.0007221147534,0.0003215570177,
-	0.001179311075,  0.00140423188,0.0008880029782,-8.597277338e-05,-0.0009994013235,
-	-0.001373213832,-0.001020201016,-0.0001368864614,0.0008040167741, 0.001307990751,
-	0.001116892206,0.0003425434115,-0.0005996586406,-0.001211840543,-0.001178218517,
-	-0.0005261615734,0.0003917113354, 0.001089676516, 0.001204202999,0.0006847677869,
-	-0.0001863904909,-0.0009457902052,-0.001196863945,-0.0008152152877,-1.161589444e-05,
-	0.0007858028985, 0.001157881808,0.0009163048235,0.0001969920559,-0.0006143713836,
-	-0.001090751146,-0.000986630097,-0.0003661881783,0.0004372497788,0.0009983691853,
-	0.001026714803,0.0005151252262,-0.0002588829084,-0.0008852574974,-0.001036787406,
-	-0.0006416898104,8.462039841e-05,0.0007550641894, 0.001018887502,0.0007432567072,
-	8.172642993e-05,-0.0006128449459,-0.0009746175492,-0.0008192125242,-0.000235651707,
-	0.0004624802677,0.0009072770481,0.0008684569621,0.0003743601555,-0.0003090778191,
-	-0.0008194555412,-0.0008918863023,-0.0004944927059,0.0001562674443,0.0007152800099,
-	0.0008897685912,0.0005945333396,-8.731110938e-06,-0.0005979175912,-0.0008643241599,
-	-0.0006724142586,-0.0001305536425,0.0004718773125,0.0008169536595,0.0007279671845,
-	0.0002576942788, -0.00034043091,-0.0007508955896,-0.0007603958948,-0.0003706761927,
-	0.0002080365375,0.0006683260435,0.0007708432968,0.0004666424065,-7.769274089e-05,
-	-0.0005731603596,-0.0007596998475,-0.0005446816795,-4.66199599e-05,0.0004679813574,
-	0.0007291860529,0.0006031126832,0.0001625384175,-0.0003569031833,-0.0006806107122,
-	-0.0006421903963,-0.0002668004017,0.0002425931889,0.0006170126144,0.0006613174337,
-	0.0003579405311,-0.0001290119399,-0.0005403547548,-0.0006618789048,-0.0004336266429,
-	1.848270404e-05,0.0004541606759, 0.000644280517, 0.000493428146,8.552605868e-05,
-	-0.0003605831007,-0.0006106891669,-0.0005358534981,-0.0001811269176,0.0002635210694,
-	0.0005625225022,0.0005618245923,0.0002658334852,-0.000164738376,-0.0005023582489,
-	-0.0005705780932,-0.000338480022,6.798981485e-05,0.0004319992731,0.0005637419526,
-	0.0003970829421,2.492789281e-05,-0.0003547269152,-0.0005417951616,-0.0004417660821,
-	-0.0001110597659,0.0002723463695,0.0005069758627,0.0004713860108,0.0001892359724,
-	-0.0001880749624,-0.0004602617992,-0.0004867930256,-0.0002570490178,0.0001036048125,
-	0.0004043966765,0.0004877146566,0.0003140359477,-2.20024649e-05,-0.0003407165932,
-	-0.0004757306306,-0.0003585382365,-5.539838457e-05,0.0002722065256,0.0004512376909,
-	0.0003908782965,0.0001260024437,-0.0002002769761,-0.0004164479615,-0.0004101381346,
-	-0.0001890545245,0.0001279483113,0.0003722042311, 0.000417448784,0.0002425266139,
-	-5.639797382e-05,-0.000321103842,-0.000412531459,-0.0002863121626,-1.162268836e-05,
-	0.0002641944448,0.0003971208935,0.0003191022843,7.531903975e-05,-0.0002042316046,
-	-0.0003715194471,-0.0003413950035,-0.0001323347678,0.0001422348723,0.0003378860129,
-	0.0003525743086,0.0001823996863,-8.087191236e-05,-0.0002968506597,-0.0003537611628,
-	-0.0002237329172,2.103555016e-05,0.0002508799953,0.0003448208154,0.0002565838513,
-	3.499184822e-05,-0.0002007343137,-0.0003274201881,-0.0002797846682,-8.66484479e-05,
-	0.0001489282586,0.0003018575953,0.0002941866405,0.0001319988223,-9.613797738e-05,
-	-0.000270180346,-0.0002990637731,-0.0001709958306,4.481731958e-05,0.0002328791743,
-	0.000295836915,0.0002021783876,4.601544333e-06,-0.0001921773364,-0.0002842592949,
-	-0.0002260330366,-4.999303201e-05,0.0001486772235, 0.000266149902,0.0002415539493,
-	9.118561866e-05,-0.0001045435492,-0.0002414935589,-0.0002497482346,-0.000126544197,
-	6.034959733e-05,0.0002124562598,0.0002499971015,0.0001562196558,-1.810080175e-05,
-	-0.0001792934199,-0.0002438632364,-0.0001792118273,-2.227508776e-05,0.0001435480081,
-	0.0002305065427,0.0001952932653,5.789510396e-05,-0.0001068712882,-0.0002129629283,
-	-0.0002050417243,-9.026838234e-05,6.999747711e-05,0.0001901006326,0.0002087139583,
-	0.0001172670381,-3.338281022e-05,-0.0001639659313,-0.0002056954254,-0.0001392774429,
-	-8.597517649e-07,0.0001348397927,0.0001976007188,0.0001552372996,3.283421756e-05,
-	-0.0001046799807,-0.0001841917983,-0.0001660128473,-6.08826158e-05,7.355600246e-05,
-	0.0001670986967,0.0001708849304,8.552833606e-05,-4.330703086e-05,-0.0001464341331,
-	-0.0001710095821,-0.000105175357,1.383437302e-05,0.0001235799718,0.0001660019188,
-	0.0001208488247,1.323225933e-05,-9.884745668e-05,-0.0001571095927,-0.000131516601,
-	-3.804886728e-05,7.379756426e-05,0.0001441549102,0.0001379923488,5.928684186e-05,
-	-4.830322359e-05,-0.0001287055056,-0.000139568554,-7.757730782e-05,2.407580178e-05,
-	0.0001104770345,0.0001375776774,9.166220843e-05,-8.006770713e-07,-9.120898903e-05,
-	-0.0001314597757,-0.0001024095254,-1.99958431e-05,7.062950317e-05,0.0001226370368,
-	0.0001088554782,3.879290671e-05,-5.037658775e-05,-0.0001107357166,-0.0001121398818,
-	-5.441690155e-05,3.013947753e-05,9.740546375e-05,0.0001116193962,6.719766679e-05,
-	-1.158574469e-05,-8.17752225e-05,-0.0001082461968,-7.73589345e-05,-5.928378869e-06,
-	6.64021718e-05,0.0001023826917,8.387388516e-05,2.128551205e-05,-5.051833432e-05,
-	-9.460339061e-05,-8.73580284e-05,-3.479843144e-05, 3.53966534e-05,8.486328443e-05,
-	8.892072947e-05,4.540236478e-05,-2.078321631e-05,-7.508738054e-05,-8.797105693e-05,
-	-5.422414324e-05, 8.35177616e-06,6.497823779e-05,8.630347293e-05,6.032766396e-05,
-	2.37802783e-06,-5.68796022e-05,-8.425418491e-05,-6.555550499e-05,-9.743102055e-06,
-	5.189189324e-05,8.586477634e-05,7.087857375e-05,1.361633076e-05,-5.69590884e-05,
-	-9.948918159e-05,-8.410990267e-05,-3.768530178e-06,0.0001183656859,0.0002451227629,
-	0.0003473183897, 0.000451198197,0.0007254052907,-0.0002723355137
-};
+// cubic Lagrange interpolation between the two middle samples of a four sample window, only
+// used for upsampling where the whole input band passes
+void SSEInterpolator::createCubic(double inputRate, double outputRate, double gain)
+{
+	inputRate = createHalfBands(inputRate, outputRate);
+	m_historyRate = inputRate;
 
-static const float H26[1024] = {
-	-0.0005091891508,0.0004449133703,0.0004326986382,0.0004291314108,0.0003714177292,
-	0.0002506244346,0.0001006641323,-2.240145477e-05,-7.683074364e-05,-5.460740431e-05,
-	1.180309482e-05,7.275657845e-05,8.657710714e-05,4.617805462e-05,-2.258813402e-05,
-	-7.487744006e-05,-7.883518265e-05,-3.155113518e-05,3.581890633e-05,8.146533219e-05,
-	7.530185394e-05, 2.16833505e-05,-4.709172936e-05,-8.668690134e-05,-7.272465155e-05,
-	-1.174960562e-05,5.704268915e-05,9.241808584e-05,6.884069444e-05,2.404817906e-06,
-	-6.709144509e-05,-9.623124788e-05,-6.569259858e-05,7.227688002e-06,7.698500849e-05,
-	0.000100316669,6.094750643e-05,-1.721636727e-05,-8.677136066e-05,-0.0001032623986,
-	-5.582525773e-05,2.804916767e-05,9.599270561e-05,0.0001058469134,4.933830496e-05,
-	-3.900066804e-05,  -0.0001054319,-0.0001071196675,-4.225959492e-05,  5.0967672e-05,
-	0.0001141171888,0.0001078536807,3.357196692e-05,-6.29278511e-05,-0.0001228400506,
-	-0.0001069479258,-2.423886508e-05,7.566610293e-05,0.0001305281185,0.0001053959932,
-	1.347782108e-05,-8.858063666e-05,-0.0001379550667,-0.0001020210475,-1.959219617e-06,
-	0.000101920501,0.0001441810455,9.776236402e-05,-1.104065541e-05,-0.0001150149401,
-	-0.0001498846541,-9.166086966e-05,2.466641672e-05,0.0001285152539,0.0001541024103,
-	8.448614244e-05,-3.97054755e-05,-0.0001414430153,-0.0001575297356,-7.534395991e-05,
-	5.521292042e-05,0.0001544752304,0.0001592135231,6.504276098e-05,-7.192098565e-05,
-	-0.000166701866,-0.000159858304,-5.27987213e-05,8.904795686e-05,0.0001786616194,
-	0.0001584426936,3.937444853e-05,-0.0001070784565,-0.0001894761808,-0.0001558010263,
-	-2.39584042e-05,0.0001251895592,0.0001997158834,0.0001509388094,7.430813639e-06,
-	-0.0001439865591,-0.0002083988657,-0.0001445905364,1.095932021e-05,0.0001624663128,
-	0.0002161262237,0.0001358609443,-3.03238412e-05,-0.0001812352129,-0.000221934446,
-	-0.000125467559,5.134289677e-05,0.0001993070473,0.0002263474307,0.0001125316412,
-	-7.320420991e-05,-0.0002172348613,-0.0002283852664,-9.78197495e-05,9.654186579e-05,
-	0.0002341242507,0.0002287948155,8.047036681e-05,-0.0001204821092,-0.0002505499288,
-	-0.0002266659721,-6.14515011e-05,0.0001455398306,0.0002654831333,0.0002226942452,
-	4.007953976e-05,-0.0001705971226,-0.0002793283202,-0.0002158567513,-1.715173494e-05,
-	0.0001961827074,0.0002909528557,0.0002065937588,-8.276564586e-06,-0.0002215498389,
-	-0.000301080232,-0.0001941645751,3.529987225e-05,0.0002473242348,0.0003089057573,
-	0.000179601906,-6.424255116e-05,-0.0002721899364,-0.0003147902316,-0.0001618986134,
-	9.413070075e-05,0.0002964152663,0.0003173984296,0.0001414578583,-0.0001260127174,
-	-0.0003194356395,-0.0003177151666,-0.0001178054445,0.0001587017323,0.0003416653781,
-	0.0003149005643,9.201978537e-05,-0.0001923012023,-0.0003615100868,-0.0003089282545,
-	-6.277523062e-05,0.0002263760398,0.0003799624683,0.0002993269009,3.127534001e-05,
-	-0.0002612287062,-0.0003959134629,-0.0002868815791,2.838681894e-06,0.0002953325456,
-	0.0004092329473,0.0002699717879,-3.943440242e-05,-0.000329949311,-0.0004197865201,
-	-0.0002502654097,7.812995318e-05,0.0003630589927,0.0004270954814,0.0002260472684,
-	-0.0001187802191,-0.0003958129382,-0.0004308730131,-0.0001987199066,0.0001612619089,
-	0.0004265382886,0.0004310999066,0.0001671224745,-0.0002049080795,-0.0004559233785,
-	-0.0004270727513,-0.0001323074684,0.0002499418624,0.0004826439254,0.0004191562475,
-	9.348917229e-05,-0.0002953727089,-0.0005071109044,-0.0004064737295,-5.159212014e-05,
-	0.000341487932,0.0005281865015,0.0003895852715,6.035827937e-06,-0.0003871777444,
-	-0.0005461605033,-0.0003676027409,4.225021985e-05,0.0004327273055, 0.000559959095,
-	0.0003411536454,-9.372740169e-05,-0.000476965768,-0.0005699119065,-0.0003094658023,
-	0.0001473780285, 0.000520129397, 0.000574944308,0.0002732167486,-0.0002035887883,
-	-0.000561035471,-0.0005754235899,-0.0002317500621,0.0002612718381,0.0005998632405,
-	0.0005703549832,0.0001858434262,-0.0003206660622,-0.000635410368,-0.0005601176526,
-	-0.0001349020167,0.0003806553432,0.0006678208592,0.0005437825457,7.980006922e-05,
-	-0.0004414000723,-0.0006959070452,-0.0005217803991,-2.004816088e-05,0.0005017289077,
-	0.0007198404055,0.0004932820448,-4.341355816e-05,-0.0005617652787,-0.0007384883938,
-	-0.0004588334996,0.0001108950892,0.0006202681107,0.0007520202198,0.0004177506198,
-	-0.0001813304843,-0.000677214528,-0.0007592936163,-0.0003705965064,0.0002549492638,
-	0.0007313630776,0.0007604924613,0.0003167452232,-0.0003306592989,-0.0007826882647,
-	-0.0007545875269,-0.0002569034696,0.0004085884138,0.0008299820474, 0.000741872529,
-	0.0001906354446,-0.0004874998413,-0.0008731686394,-0.0007214114885,-0.0001187785747,
-	0.0005673432606,0.0009109516395,0.0006934723351, 4.09893255e-05,-0.0006468610372,
-	-0.0009432354709,-0.0006571901613,4.189152969e-05,0.0007260220591,0.0009688970167,
-	0.0006130447146,-0.0001299684809,-0.0008034633938,-0.0009878583951,-0.0005603518221,
-	0.0002221661562,0.0008789126878,0.0009988893289, 0.000499558344,-0.0003185803362,
-	-0.0009510582313,-0.001001967932,-0.0004300812434,0.0004181093245, 0.001019701944,
-	0.0009961144533,0.0003526562359, -0.00052052713,-0.001083362615,-0.0009812592762,
-	-0.0002668309608,0.0006246284465,  0.00114173023,0.0009564058273, 0.000173302964,
-	-0.0007302296581,-0.001193502918,-0.0009217316401,-7.191453187e-05,0.0008359455387,
-	0.001238325611,0.0008763971273,-3.639782517e-05,-0.0009413166554,-0.001274742535,
-	-0.0008204786573,0.0001518449717, 0.001045095036, 0.001302574878,0.0007534244214,
-	-0.000273242913,-0.001146660652,  -0.0013204352,-0.0006754879723,0.0004005062219,
-	0.001244545332, 0.001327985665,0.0005860842648,-0.0005325351958,-0.001338258735,
-	-0.00132410787,-0.0004857873428,0.0006689084694, 0.001426147181, 0.001308426959,
-	0.0003741292458,-0.0008084067958,-0.001507628709,-0.001279862132, -0.00025173623,
-	0.0009505674825, 0.001581190387, 0.001238288474,0.0001185118526,-0.001093857805,
-	-0.001645994955, -0.00118256337,2.492894782e-05, 0.001237811986, 0.001700687222,
-	0.001112780301,-0.000178375456,-0.001380691654,-0.001744337496,-0.001027894323,
-	0.0003410777135, 0.001521899598, 0.001775590004,0.0009281021776,-0.0005126433098,
-	-0.001659606001,-0.001793538453,-0.0008125350578,0.0006921339082, 0.001793043222,
-	0.001796815312,0.0006814459921,-0.0008790400461,-0.001920396928,-0.001784629538,
-	-0.0005342451041, 0.001072154031, 0.002040659543, 0.001755579375,0.0003712410107,
-	-0.001270837383,-0.002152010333,-0.001708941534,-0.0001920632349, 0.001473669312,
-	0.002253273502, 0.001643316122,-2.896028718e-06,-0.001679865178, -0.00234256126,
-	-0.001558000688,0.0002138699056, 0.001887904713, 0.002418658929, 0.001451714197,
-	-0.0004402918566,-0.002096777083,-0.002479583025,-0.001323764329,0.0006822179421,
-	0.002304782625, 0.002523944946, 0.001172848744,-0.0009390320629,-0.002510764869,
-	-0.002549700206,-0.0009982621996, 0.001210676273, 0.002712908899, 0.002555320505,
-	0.0007986905985,-0.001496468787,-0.002909897827,-0.002538652858,-0.0005733689759,
-	0.001796259428, 0.003099763766, 0.002497971291,0.0003209162096,-0.002109326888,
-	-0.003280957229,-0.002430857392,-4.031740173e-05, 0.002435543109,  0.00345136039,
-	0.002335258294,-0.0002700781333,-0.002774319379,-0.003609264037,-0.002208457561,
-	0.0006115975557, 0.003125557676, 0.003752279328, 0.002047841204,-0.0009863955202,
-	-0.003488862421,-0.003878325922,-0.001849952387, 0.001396602369, 0.003864497412,
-	0.00398474792, 0.001611307729,-0.001845283667,-0.004252504557,-0.004068987444,
-	-0.001327306847, 0.002335840836, 0.004653627519, 0.004127683118,0.0009926881175,
-	-0.002873197896,-0.005068813451,-0.004157443065,-0.0006006051553,  0.00346329622,
-	0.005499996711, 0.004153845366,0.0001427316165,-0.004114402924,-0.005949663464,
-	-0.004111785907,0.0003922276082, 0.004837370943, 0.006421974394, 0.004024473019,
-	-0.001019027783,-0.005647570826, -0.00692280801,-0.003883437021, 0.001758195693,
-	0.006566211581, 0.007461105008, 0.003676733468, -0.00263860519,-0.007624414749,
-	-0.008050125092,-0.003387771547, 0.003702867776, 0.008868393488, 0.008710601367,
-	0.002991659567,-0.005015837029, -0.01037034392,-0.009475387633,-0.002449635882,
-	0.006682046689,  0.01224827487,  0.01039983332, 0.001696583233,-0.008880651556,
-	-0.01470938139,  -0.0115833953,-0.0006146978121,  0.01194636244,  0.01815105975,
-	0.01322301105,-0.001035729772, -0.01658430696, -0.02344394475, -0.01576934382,
-	0.003827116918,  0.02457528934,  0.03292677179,    0.020523021,-0.009553666227,
-	-0.04208630696, -0.05574646965, -0.03341244161,  0.02821186744,   0.1147604212,
-	0.1986313462,   0.2501002848,   0.2501002848,   0.1986313462,   0.1147604212,
-	0.02821186744, -0.03341244161, -0.05574646965, -0.04208630696,-0.009553666227,
-	0.020523021,  0.03292677179,  0.02457528934, 0.003827116918, -0.01576934382,
-	-0.02344394475, -0.01658430696,-0.001035729772,  0.01322301105,  0.01815105975,
-	0.01194636244,-0.0006146978121,  -0.0115833953, -0.01470938139,-0.008880651556,
-	0.001696583233,  0.01039983332,  0.01224827487, 0.006682046689,-0.002449635882,
-	-0.009475387633, -0.01037034392,-0.005015837029, 0.002991659567, 0.008710601367,
-	0.008868393488, 0.003702867776,-0.003387771547,-0.008050125092,-0.007624414749,
-	-0.00263860519, 0.003676733468, 0.007461105008, 0.006566211581, 0.001758195693,
-	-0.003883437021, -0.00692280801,-0.005647570826,-0.001019027783, 0.004024473019,
-	0.006421974394, 0.004837370943,0.0003922276082,-0.004111785907,-0.005949663464,
-	-0.004114402924,0.0001427316165, 0.004153845366, 0.005499996711,  0.00346329622,
-	-0.0006006051553,-0.004157443065,-0.005068813451,-0.002873197896,0.0009926881175,
-	0.004127683118, 0.004653627519, 0.002335840836,-0.001327306847,-0.004068987444,
-	-0.004252504557,-0.001845283667, 0.001611307729,  0.00398474792, 0.003864497412,
-	0.001396602369,-0.001849952387,-0.003878325922,-0.003488862421,-0.0009863955202,
-	0.002047841204, 0.003752279328, 0.003125557676,0.0006115975557,-0.002208457561,
-	-0.003609264037,-0.002774319379,-0.0002700781333, 0.002335258294,  0.00345136039,
-	0.002435543109,-4.031740173e-05,-0.002430857392,-0.003280957229,-0.002109326888,
-	0.0003209162096, 0.002497971291, 0.003099763766, 0.001796259428,-0.0005733689759,
-	-0.002538652858,-0.002909897827,-0.001496468787,0.0007986905985, 0.002555320505,
-	0.002712908899, 0.001210676273,-0.0009982621996,-0.002549700206,-0.002510764869,
-	-0.0009390320629, 0.001172848744, 0.002523944946, 0.002304782625,0.0006822179421,
-	-0.001323764329,-0.002479583025,-0.002096777083,-0.0004402918566, 0.001451714197,
-	0.002418658929, 0.001887904713,0.0002138699056,-0.001558000688, -0.00234256126,
-	-0.001679865178,-2.896028718e-06, 0.001643316122, 0.002253273502, 0.001473669312,
-	-0.0001920632349,-0.001708941534,-0.002152010333,-0.001270837383,0.0003712410107,
-	0.001755579375, 0.002040659543, 0.001072154031,-0.0005342451041,-0.001784629538,
-	-0.001920396928,-0.0008790400461,0.0006814459921, 0.001796815312, 0.001793043222,
-	0.0006921339082,-0.0008125350578,-0.001793538453,-0.001659606001,-0.0005126433098,
-	0.0009281021776, 0.001775590004, 0.001521899598,0.0003410777135,-0.001027894323,
-	-0.001744337496,-0.001380691654,-0.000178375456, 0.001112780301, 0.001700687222,
-	0.001237811986,2.492894782e-05, -0.00118256337,-0.001645994955,-0.001093857805,
-	0.0001185118526, 0.001238288474, 0.001581190387,0.0009505674825, -0.00025173623,
-	-0.001279862132,-0.001507628709,-0.0008084067958,0.0003741292458, 0.001308426959,
-	0.001426147181,0.0006689084694,-0.0004857873428, -0.00132410787,-0.001338258735,
-	-0.0005325351958,0.0005860842648, 0.001327985665, 0.001244545332,0.0004005062219,
-	-0.0006754879723,  -0.0013204352,-0.001146660652,-0.000273242913,0.0007534244214,
-	0.001302574878, 0.001045095036,0.0001518449717,-0.0008204786573,-0.001274742535,
-	-0.0009413166554,-3.639782517e-05,0.0008763971273, 0.001238325611,0.0008359455387,
-	-7.191453187e-05,-0.0009217316401,-0.001193502918,-0.0007302296581, 0.000173302964,
-	0.0009564058273,  0.00114173023,0.0006246284465,-0.0002668309608,-0.0009812592762,
-	-0.001083362615, -0.00052052713,0.0003526562359,0.0009961144533, 0.001019701944,
-	0.0004181093245,-0.0004300812434,-0.001001967932,-0.0009510582313,-0.0003185803362,
-	0.000499558344,0.0009988893289,0.0008789126878,0.0002221661562,-0.0005603518221,
-	-0.0009878583951,-0.0008034633938,-0.0001299684809,0.0006130447146,0.0009688970167,
-	0.0007260220591,4.189152969e-05,-0.0006571901613,-0.0009432354709,-0.0006468610372,
-	4.09893255e-05,0.0006934723351,0.0009109516395,0.0005673432606,-0.0001187785747,
-	-0.0007214114885,-0.0008731686394,-0.0004874998413,0.0001906354446, 0.000741872529,
-	0.0008299820474,0.0004085884138,-0.0002569034696,-0.0007545875269,-0.0007826882647,
-	-0.0003306592989,0.0003167452232,0.0007604924613,0.0007313630776,0.0002549492638,
-	-0.0003705965064,-0.0007592936163,-0.000677214528,-0.0001813304843,0.0004177506198,
-	0.0007520202198,0.0006202681107,0.0001108950892,-0.0004588334996,-0.0007384883938,
-	-0.0005617652787,-4.341355816e-05,0.0004932820448,0.0007198404055,0.0005017289077,
-	-2.004816088e-05,-0.0005217803991,-0.0006959070452,-0.0004414000723,7.980006922e-05,
-	0.0005437825457,0.0006678208592,0.0003806553432,-0.0001349020167,-0.0005601176526,
-	-0.000635410368,-0.0003206660622,0.0001858434262,0.0005703549832,0.0005998632405,
-	0.0002612718381,-0.0002317500621,-0.0005754235899,-0.000561035471,-0.0002035887883,
-	0.0002732167486, 0.000574944308, 0.000520129397,0.0001473780285,-0.0003094658023,
-	-0.0005699119065,-0.000476965768,-9.372740169e-05,0.0003411536454, 0.000559959095,
-	0.0004327273055,4.225021985e-05,-0.0003676027409,-0.0005461605033,-0.0003871777444,
-	6.035827937e-06,0.0003895852715,0.0005281865015, 0.000341487932,-5.159212014e-05,
-	-0.0004064737295,-0.0005071109044,-0.0002953727089,9.348917229e-05,0.0004191562475,
-	0.0004826439254,0.0002499418624,-0.0001323074684,-0.0004270727513,-0.0004559233785,
-	-0.0002049080795,0.0001671224745,0.0004310999066,0.0004265382886,0.0001612619089,
-	-0.0001987199066,-0.0004308730131,-0.0003958129382,-0.0001187802191,0.0002260472684,
-	0.0004270954814,0.0003630589927,7.812995318e-05,-0.0002502654097,-0.0004197865201,
-	-0.000329949311,-3.943440242e-05,0.0002699717879,0.0004092329473,0.0002953325456,
-	2.838681894e-06,-0.0002868815791,-0.0003959134629,-0.0002612287062,3.127534001e-05,
-	0.0002993269009,0.0003799624683,0.0002263760398,-6.277523062e-05,-0.0003089282545,
-	-0.0003615100868,-0.0001923012023,9.201978537e-05,0.0003149005643,0.0003416653781,
-	0.0001587017323,-0.0001178054445,-0.0003177151666,-0.0003194356395,-0.0001260127174,
-	0.0001414578583,0.0003173984296,0.0002964152663,9.413070075e-05,-0.0001618986134,
-	-0.0003147902316,-0.0002721899364,-6.424255116e-05, 0.000179601906,0.0003089057573,
-	0.0002473242348,3.529987225e-05,-0.0001941645751,-0.000301080232,-0.0002215498389,
-	-8.276564586e-06,0.0002065937588,0.0002909528557,0.0001961827074,-1.715173494e-05,
-	-0.0002158567513,-0.0002793283202,-0.0001705971226,4.007953976e-05,0.0002226942452,
-	0.0002654831333,0.0001455398306,-6.14515011e-05,-0.0002266659721,-0.0002505499288,
-	-0.0001204821092,8.047036681e-05,0.0002287948155,0.0002341242507,9.654186579e-05,
-	-9.78197495e-05,-0.0002283852664,-0.0002172348613,-7.320420991e-05,0.0001125316412,
-	0.0002263474307,0.0001993070473,5.134289677e-05,-0.000125467559,-0.000221934446,
-	-0.0001812352129,-3.03238412e-05,0.0001358609443,0.0002161262237,0.0001624663128,
-	1.095932021e-05,-0.0001445905364,-0.0002083988657,-0.0001439865591,7.430813639e-06,
-	0.0001509388094,0.0001997158834,0.0001251895592,-2.39584042e-05,-0.0001558010263,
-	-0.0001894761808,-0.0001070784565,3.937444853e-05,0.0001584426936,0.0001786616194,
-	8.904795686e-05,-5.27987213e-05,-0.000159858304,-0.000166701866,-7.192098565e-05,
-	6.504276098e-05,0.0001592135231,0.0001544752304,5.521292042e-05,-7.534395991e-05,
-	-0.0001575297356,-0.0001414430153,-3.97054755e-05,8.448614244e-05,0.0001541024103,
-	0.0001285152539,2.466641672e-05,-9.166086966e-05,-0.0001498846541,-0.0001150149401,
-	-1.104065541e-05,9.776236402e-05,0.0001441810455, 0.000101920501,-1.959219617e-06,
-	-0.0001020210475,-0.0001379550667,-8.858063666e-05,1.347782108e-05,0.0001053959932,
-	0.0001305281185,7.566610293e-05,-2.423886508e-05,-0.0001069479258,-0.0001228400506,
-	-6.29278511e-05,3.357196692e-05,0.0001078536807,0.0001141171888,  5.0967672e-05,
-	-4.225959492e-05,-0.0001071196675,  -0.0001054319,-3.900066804e-05,4.933830496e-05,
-	0.0001058469134,9.599270561e-05,2.804916767e-05,-5.582525773e-05,-0.0001032623986,
-	-8.677136066e-05,-1.721636727e-05,6.094750643e-05, 0.000100316669,7.698500849e-05,
-	7.227688002e-06,-6.569259858e-05,-9.623124788e-05,-6.709144509e-05,2.404817906e-06,
-	6.884069444e-05,9.241808584e-05,5.704268915e-05,-1.174960562e-05,-7.272465155e-05,
-	-8.668690134e-05,-4.709172936e-05, 2.16833505e-05,7.530185394e-05,8.146533219e-05,
-	3.581890633e-05,-3.155113518e-05,-7.883518265e-05,-7.487744006e-05,-2.258813402e-05,
-	4.617805462e-05,8.657710714e-05,7.275657845e-05,1.180309482e-05,-5.460740431e-05,
-	-7.683074364e-05,-2.240145477e-05,0.0001006641323,0.0002506244346,0.0003714177292,
-	0.0004291314108,0.0004326986382,0.0004449133703,-0.0005091891508
-};
+	double distance = 1.0;
+	if(outputRate > 0.0)
+		distance = inputRate / outputRate;
+	m_step = (quint64)llround(distance * FixedPointOne);
+	if(m_step == 0)
+		m_step = 1;
+	m_position = m_step;
+	qDebug("cubic interpolator distance %f", distance);
 
-static const float H28[1024] = {
-	-0.0007371808751,4.880931738e-05,0.0001791400573,0.0003183592344,0.0003911434032,
-	0.0003607383405,0.0002468634048,0.0001146628929,3.104805728e-05,2.689023131e-05,
-	7.863016799e-05,0.0001309368672,0.0001333662512,7.708086196e-05,-3.909872248e-06,
-	-5.537558172e-05,-4.550509038e-05,1.516476914e-05,7.755560364e-05,9.513885016e-05,
-	5.206494825e-05,-2.337051228e-05,-7.699178968e-05,-7.128751167e-05,-1.004799287e-05,
-	6.260610098e-05, 9.35614371e-05,5.929927283e-05,-1.733605131e-05,-8.184528997e-05,
-	-8.776802133e-05,-2.939357182e-05,5.204719855e-05,9.838815458e-05,7.502371591e-05,
-	-2.538554554e-06,-8.00605776e-05,-0.0001013946385,-4.985868145e-05,3.894263136e-05,
-	0.0001017940667,9.309923189e-05,1.690842146e-05,-7.294572424e-05,-0.0001126153657,
-	-7.183506386e-05,2.141895129e-05,0.0001016976894,0.0001104430121,4.017966421e-05,
-	-6.08431219e-05,-0.000120230965,-9.473682439e-05,-2.552173157e-07,9.635727474e-05,
-	0.0001260871068,6.566755474e-05,-4.309766882e-05,-0.0001236779644,-0.0001168391973,
-	-2.617646351e-05,8.563457232e-05,0.0001381642651,9.281685925e-05,-2.04770713e-05,
-	-0.0001213712167,-0.0001375448192,-5.501206033e-05,6.867159391e-05,0.0001459819032,
-	0.0001198794635,7.302191079e-06,-0.0001132492689,-0.0001549155859,-8.644819172e-05,
-	4.587976946e-05,0.0001478853665, 0.000146163613,3.922870383e-05,-9.801726992e-05,
-	-0.0001680409769,-0.0001187654707,1.663290095e-05,0.0001431647543,0.0001694108505,
-	7.48215607e-05,-7.562906831e-05,-0.0001747164206,-0.0001506598492,-1.776006866e-05,
-	0.0001304264151,0.0001882125507,0.0001118567088,-4.615942817e-05,-0.0001744954207,
-	-0.0001800152386,-5.656959183e-05,0.0001102052775,0.0002011474426,0.0001497892372,
-	-1.030872772e-05,  -0.0001660618,-0.0002060490369,-9.883651364e-05,8.120345592e-05,
-	0.0002067668975,0.0001862810022,3.196914258e-05,-0.0001484839886,-0.0002257371671,
-	-0.0001427363313,4.452498251e-05,0.0002033308701,0.0002195489069, 7.83766518e-05,
-	-0.0001216147502,-0.0002385110129,-0.0001864171209,1.465871691e-07,0.0001904067176,
-	0.0002475608781,0.0001284765312,-8.518226969e-05,-0.0002415770432,-0.0002278394386,
-	-5.021705874e-05,0.0001666180324,0.0002682505292,0.0001792138355,-3.984986688e-05,
-	-0.0002346570691,-0.0002646907815,-0.0001057009358,0.0001322081516,0.0002795122273,
-	0.0002293102298,1.358163354e-05,-0.000215649532,-0.0002945938613,-0.000163548917,
-	8.7031578e-05,0.0002799928479,0.0002755742753,7.367526996e-05,-0.0001848772663,
-	-0.0003154046135,-0.0002223698975,3.189090421e-05,0.0002676576842,0.0003158999607,
-	0.0001383414201,-0.0001414129947,-0.0003249656002,-0.0002786793921,-3.195426325e-05,
-	0.0002422168473,0.0003475012782,0.0002057537931,-8.608499775e-05,-0.0003211477015,
-	-0.0003302832192,-0.0001026831524,0.0002023202978,0.0003677780624,0.0002723363868,
-	-1.982311915e-05,-0.0003030228545,-0.0003738246742,-0.0001781296596,  0.00014871842,
-	0.0003744219721,0.0003357858805,5.568111737e-05,-0.0002689808025,-0.0004065660178,
-	-0.000254956045,8.182095917e-05,0.0003658925125,0.0003924795601,0.0001384601637,
-	-0.0002191895474,-0.0004256349639,-0.0003306911385,2.954984438e-06,0.0003399376874,
-	0.0004391172552,0.0002251439873,-0.0001536140335,-0.0004287879856,-0.0004012022982,
-	-8.585883188e-05,0.0002963457373, 0.000472377491,0.0003129791294,-7.346930215e-05,
-	-0.0004135414783,-0.0004630587937,-0.0001814869465,0.0002346351102,0.0004896389437,
-	0.0003979364701,1.979777517e-05,-0.0003787898459,-0.0005123436567,-0.0002811141603,
-	0.0001554146875,0.0004875875893,0.0004759629373,0.0001230422204,-0.0003236272605,
-	-0.0005458092783,-0.0003804605221,5.998512643e-05,0.0004646485904,0.0005428381264,
-	0.0002334998571,-0.0002482141426,-0.0005597601412,-0.0004754440743,-4.910100324e-05,
-	0.0004191075277,0.0005946785095,0.0003469558433,-0.0001531324815,-0.0005515764933,
-	-0.0005611144588,-0.0001689338824,0.0003506349458,0.0006272245664,0.0004590591416,
-	-4.065178655e-05,-0.0005190214724,-0.0006332561024,-0.0002955785312,0.0002590517688,
-	0.0006369791809, 0.000564504182,8.664671623e-05,-0.0004608955642,-0.0006868266501,
-	-0.0004244594311,0.0001461299253,0.0006208859268,0.0006584345247,0.0002248395031,
-	-0.0003765237925,-0.0007177265361,-0.0005501268897,1.401560348e-05,0.0005770035787,
-	0.0007353987894,0.0003696244094,-0.0002666866931,-0.0007218100363,-0.0006670982111,
-	-0.0001336161367,0.0005038311356,0.0007904576487,0.0005153538077,-0.0001330247032,
-	-0.0006962463376, -0.00076943147,-0.000292705663,0.0004011722922,0.0008184324834,
-	0.0006560603506,2.120064892e-05,-0.0006386236637,-0.0008513588109,-0.0004575455387,
-	0.0002700205077,0.0008155347896,0.0007853147108,0.0001921963558,-0.000547870819,
-	-0.0009069712833,-0.0006221179501,0.0001127859141,0.0007782172761,0.0008966097375,
-	0.0003745412978,-0.0004238722613,-0.0009311779868,-0.0007793679833,-6.705620763e-05,
-	0.0007043938967,0.0009832197102,0.0005621711607,-0.0002681584156,-0.0009192796424,
-	-0.0009221210494,-0.0002644292545,0.0005928886239, 0.001038975781,0.0007477757172,
-	-8.352425357e-05,-0.0008680182509,-0.001042935182,-0.0004735564871,0.0004440187477,
-	0.001057871617,0.0009236288024,0.0001256176765,-0.000774843269,-0.001134433551,
-	-0.0006869672798,0.0002596281702, 0.001035215566, 0.001081405208,0.0003536907607,
-	-0.0006389461923,-0.001189508825,-0.0008966824971,4.321208689e-05,0.0009670216241,
-	0.001212752075,0.0005934882793,-0.000460824318,-0.001201872365,-0.001093668048,
-	-0.0002002293913,0.0008509956533,  0.00130930671,0.0008368847775,-0.0002428362059,
-	-0.001165963942,-0.001268626656,-0.0004639206163,0.0006862051087, 0.001363334944,
-	0.001074535539,1.107914886e-05,-0.001077705645,-0.001411990263,-0.0007399400929,
-	0.0004734313698, 0.001367462915, 0.001296281116,0.0002949038462,-0.0009343727143,
-	-0.0015144184,-0.001018690993,0.0002154000395, 0.001315780915, 0.001491515432,
-	0.000601195381,-0.0007350263186,-0.001566884574,-0.001289651147,-8.320066263e-05,
-	0.001203432796,  0.00164938753, 0.000920577615,-0.0004806364886,-0.001561382436,
-	-0.001541330013,-0.0004158783995, 0.001027321676, 0.001759072882, 0.001242369879,
-	-0.0001742192981,-0.001490770723,-0.001761579071,-0.000773949665,0.0007862169878,
-	0.001810385031,  0.00155451335,0.0001791823597,-0.001349476865,-0.001937890309,
-	-0.001147042029,0.0004809971724, 0.001793798525,  0.00184398389,0.0005722694914,
-	-0.00113354763,-0.002057901351,-0.001523087849,0.0001145222195, 0.001700837165,
-	0.002096748911,0.0009956125868,-0.0008410727605, -0.00210947264,-0.001888495404,
-	-0.0003078699228, 0.001524493564,  0.00229849224, 0.001437806524,-0.0004720732104,
-	-0.002081112703, -0.00222829124,-0.000778632646, 0.001259399811, 0.002434561029,
-	0.001885525067,-2.890473297e-05,-0.001962242415,-0.002526570577,-0.001287998399,
-	0.0009018481942, 0.002490303712, 0.002323596738,0.0004838676832,  -0.0017433865,
-	-0.002766470658,-0.001824003295,0.0004501242074, 0.002451305045, 0.002735351911,
-	0.001059486531,-0.001416187035, -0.00293044094,-0.002372618299,-9.572316776e-05,
-	0.002303385409,    0.003102527, 0.001689060708,-0.0009734625928,-0.003000193508,
-	-0.002917813137,-0.0007337839925, 0.002032654826, 0.003405544441, 0.002361803083,
-	-0.0004089144059,-0.002956735203,-0.003441836685,-0.001460963394, 0.001624862547,
-	0.003623039229, 0.003065140685,0.0002833014587,-0.002779774601,-0.003925029654,
-	-0.002273197984, 0.001064903336,  0.00373174157, 0.003785211127, 0.001109732548,
-	-0.002446698025,-0.004345558584,-0.003166375449,0.0003353384382, 0.003705400275,
-	0.004507185426, 0.002079198835,-0.001930770464, -0.00467899302,-0.004137905315,
-	-0.0005865056301, 0.003512592055, 0.005215496756,  0.00320565328,-0.001197593869,
-	-0.004896792583,-0.005188896786,-0.001733177924, 0.003113008803, 0.005894477013,
-	0.004513628781,-0.0001982180984,-0.004963316489,-0.006328275893,-0.003156432649,
-	0.002449560678, 0.006528711878, 0.006048339419, 0.001144351554,  -0.0048295632,
-	-0.00758078089,-0.004946190864, 0.001431804267, 0.007103525102, 0.007897112519,
-	0.002964686137, -0.00441864226,-0.009003927931,-0.007272953168,-0.0001023355944,
-	0.007605378982,  0.01023965143, 0.005526192486,-0.003589786123, -0.01073068939,
-	-0.01049758401,-0.002488431986, 0.008022237569,  0.01348777954, 0.009425879456,
-	-0.002030717675, -0.01309797727, -0.01551628765,-0.006568497978, 0.008344115689,
-	0.01877987012,  0.01635337621, 0.001161969965, -0.01717420481,   -0.025264645,
-	-0.01524106227, 0.008563211188,  0.03065825999,  0.03359878436,   0.0102531258,
-	-0.02869254909, -0.05770312995, -0.04947658256, 0.008674102835,   0.1047224924,
-	0.2047769278,    0.268365413,    0.268365413,   0.2047769278,   0.1047224924,
-	0.008674102835, -0.04947658256, -0.05770312995, -0.02869254909,   0.0102531258,
-	0.03359878436,  0.03065825999, 0.008563211188, -0.01524106227,   -0.025264645,
-	-0.01717420481, 0.001161969965,  0.01635337621,  0.01877987012, 0.008344115689,
-	-0.006568497978, -0.01551628765, -0.01309797727,-0.002030717675, 0.009425879456,
-	0.01348777954, 0.008022237569,-0.002488431986, -0.01049758401, -0.01073068939,
-	-0.003589786123, 0.005526192486,  0.01023965143, 0.007605378982,-0.0001023355944,
-	-0.007272953168,-0.009003927931, -0.00441864226, 0.002964686137, 0.007897112519,
-	0.007103525102, 0.001431804267,-0.004946190864, -0.00758078089,  -0.0048295632,
-	0.001144351554, 0.006048339419, 0.006528711878, 0.002449560678,-0.003156432649,
-	-0.006328275893,-0.004963316489,-0.0001982180984, 0.004513628781, 0.005894477013,
-	0.003113008803,-0.001733177924,-0.005188896786,-0.004896792583,-0.001197593869,
-	0.00320565328, 0.005215496756, 0.003512592055,-0.0005865056301,-0.004137905315,
-	-0.00467899302,-0.001930770464, 0.002079198835, 0.004507185426, 0.003705400275,
-	0.0003353384382,-0.003166375449,-0.004345558584,-0.002446698025, 0.001109732548,
-	0.003785211127,  0.00373174157, 0.001064903336,-0.002273197984,-0.003925029654,
-	-0.002779774601,0.0002833014587, 0.003065140685, 0.003623039229, 0.001624862547,
-	-0.001460963394,-0.003441836685,-0.002956735203,-0.0004089144059, 0.002361803083,
-	0.003405544441, 0.002032654826,-0.0007337839925,-0.002917813137,-0.003000193508,
-	-0.0009734625928, 0.001689060708,    0.003102527, 0.002303385409,-9.572316776e-05,
-	-0.002372618299, -0.00293044094,-0.001416187035, 0.001059486531, 0.002735351911,
-	0.002451305045,0.0004501242074,-0.001824003295,-0.002766470658,  -0.0017433865,
-	0.0004838676832, 0.002323596738, 0.002490303712,0.0009018481942,-0.001287998399,
-	-0.002526570577,-0.001962242415,-2.890473297e-05, 0.001885525067, 0.002434561029,
-	0.001259399811,-0.000778632646, -0.00222829124,-0.002081112703,-0.0004720732104,
-	0.001437806524,  0.00229849224, 0.001524493564,-0.0003078699228,-0.001888495404,
-	-0.00210947264,-0.0008410727605,0.0009956125868, 0.002096748911, 0.001700837165,
-	0.0001145222195,-0.001523087849,-0.002057901351, -0.00113354763,0.0005722694914,
-	0.00184398389, 0.001793798525,0.0004809971724,-0.001147042029,-0.001937890309,
-	-0.001349476865,0.0001791823597,  0.00155451335, 0.001810385031,0.0007862169878,
-	-0.000773949665,-0.001761579071,-0.001490770723,-0.0001742192981, 0.001242369879,
-	0.001759072882, 0.001027321676,-0.0004158783995,-0.001541330013,-0.001561382436,
-	-0.0004806364886, 0.000920577615,  0.00164938753, 0.001203432796,-8.320066263e-05,
-	-0.001289651147,-0.001566884574,-0.0007350263186, 0.000601195381, 0.001491515432,
-	0.001315780915,0.0002154000395,-0.001018690993,  -0.0015144184,-0.0009343727143,
-	0.0002949038462, 0.001296281116, 0.001367462915,0.0004734313698,-0.0007399400929,
-	-0.001411990263,-0.001077705645,1.107914886e-05, 0.001074535539, 0.001363334944,
-	0.0006862051087,-0.0004639206163,-0.001268626656,-0.001165963942,-0.0002428362059,
-	0.0008368847775,  0.00130930671,0.0008509956533,-0.0002002293913,-0.001093668048,
-	-0.001201872365,-0.000460824318,0.0005934882793, 0.001212752075,0.0009670216241,
-	4.321208689e-05,-0.0008966824971,-0.001189508825,-0.0006389461923,0.0003536907607,
-	0.001081405208, 0.001035215566,0.0002596281702,-0.0006869672798,-0.001134433551,
-	-0.000774843269,0.0001256176765,0.0009236288024, 0.001057871617,0.0004440187477,
-	-0.0004735564871,-0.001042935182,-0.0008680182509,-8.352425357e-05,0.0007477757172,
-	0.001038975781,0.0005928886239,-0.0002644292545,-0.0009221210494,-0.0009192796424,
-	-0.0002681584156,0.0005621711607,0.0009832197102,0.0007043938967,-6.705620763e-05,
-	-0.0007793679833,-0.0009311779868,-0.0004238722613,0.0003745412978,0.0008966097375,
-	0.0007782172761,0.0001127859141,-0.0006221179501,-0.0009069712833,-0.000547870819,
-	0.0001921963558,0.0007853147108,0.0008155347896,0.0002700205077,-0.0004575455387,
-	-0.0008513588109,-0.0006386236637,2.120064892e-05,0.0006560603506,0.0008184324834,
-	0.0004011722922,-0.000292705663, -0.00076943147,-0.0006962463376,-0.0001330247032,
-	0.0005153538077,0.0007904576487,0.0005038311356,-0.0001336161367,-0.0006670982111,
-	-0.0007218100363,-0.0002666866931,0.0003696244094,0.0007353987894,0.0005770035787,
-	1.401560348e-05,-0.0005501268897,-0.0007177265361,-0.0003765237925,0.0002248395031,
-	0.0006584345247,0.0006208859268,0.0001461299253,-0.0004244594311,-0.0006868266501,
-	-0.0004608955642,8.664671623e-05, 0.000564504182,0.0006369791809,0.0002590517688,
-	-0.0002955785312,-0.0006332561024,-0.0005190214724,-4.065178655e-05,0.0004590591416,
-	0.0006272245664,0.0003506349458,-0.0001689338824,-0.0005611144588,-0.0005515764933,
-	-0.0001531324815,0.0003469558433,0.0005946785095,0.0004191075277,-4.910100324e-05,
-	-0.0004754440743,-0.0005597601412,-0.0002482141426,0.0002334998571,0.0005428381264,
-	0.0004646485904,5.998512643e-05,-0.0003804605221,-0.0005458092783,-0.0003236272605,
-	0.0001230422204,0.0004759629373,0.0004875875893,0.0001554146875,-0.0002811141603,
-	-0.0005123436567,-0.0003787898459,1.979777517e-05,0.0003979364701,0.0004896389437,
-	0.0002346351102,-0.0001814869465,-0.0004630587937,-0.0004135414783,-7.346930215e-05,
-	0.0003129791294, 0.000472377491,0.0002963457373,-8.585883188e-05,-0.0004012022982,
-	-0.0004287879856,-0.0001536140335,0.0002251439873,0.0004391172552,0.0003399376874,
-	2.954984438e-06,-0.0003306911385,-0.0004256349639,-0.0002191895474,0.0001384601637,
-	0.0003924795601,0.0003658925125,8.182095917e-05,-0.000254956045,-0.0004065660178,
-	-0.0002689808025,5.568111737e-05,0.0003357858805,0.0003744219721,  0.00014871842,
-	-0.0001781296596,-0.0003738246742,-0.0003030228545,-1.982311915e-05,0.0002723363868,
-	0.0003677780624,0.0002023202978,-0.0001026831524,-0.0003302832192,-0.0003211477015,
-	-8.608499775e-05,0.0002057537931,0.0003475012782,0.0002422168473,-3.195426325e-05,
-	-0.0002786793921,-0.0003249656002,-0.0001414129947,0.0001383414201,0.0003158999607,
-	0.0002676576842,3.189090421e-05,-0.0002223698975,-0.0003154046135,-0.0001848772663,
-	7.367526996e-05,0.0002755742753,0.0002799928479,  8.7031578e-05,-0.000163548917,
-	-0.0002945938613,-0.000215649532,1.358163354e-05,0.0002293102298,0.0002795122273,
-	0.0001322081516,-0.0001057009358,-0.0002646907815,-0.0002346570691,-3.984986688e-05,
-	0.0001792138355,0.0002682505292,0.0001666180324,-5.021705874e-05,-0.0002278394386,
-	-0.0002415770432,-8.518226969e-05,0.0001284765312,0.0002475608781,0.0001904067176,
-	1.465871691e-07,-0.0001864171209,-0.0002385110129,-0.0001216147502, 7.83766518e-05,
-	0.0002195489069,0.0002033308701,4.452498251e-05,-0.0001427363313,-0.0002257371671,
-	-0.0001484839886,3.196914258e-05,0.0001862810022,0.0002067668975,8.120345592e-05,
-	-9.883651364e-05,-0.0002060490369,  -0.0001660618,-1.030872772e-05,0.0001497892372,
-	0.0002011474426,0.0001102052775,-5.656959183e-05,-0.0001800152386,-0.0001744954207,
-	-4.615942817e-05,0.0001118567088,0.0001882125507,0.0001304264151,-1.776006866e-05,
-	-0.0001506598492,-0.0001747164206,-7.562906831e-05, 7.48215607e-05,0.0001694108505,
-	0.0001431647543,1.663290095e-05,-0.0001187654707,-0.0001680409769,-9.801726992e-05,
-	3.922870383e-05, 0.000146163613,0.0001478853665,4.587976946e-05,-8.644819172e-05,
-	-0.0001549155859,-0.0001132492689,7.302191079e-06,0.0001198794635,0.0001459819032,
-	6.867159391e-05,-5.501206033e-05,-0.0001375448192,-0.0001213712167,-2.04770713e-05,
-	9.281685925e-05,0.0001381642651,8.563457232e-05,-2.617646351e-05,-0.0001168391973,
-	-0.0001236779644,-4.309766882e-05,6.566755474e-05,0.0001260871068,9.635727474e-05,
-	-2.552173157e-07,-9.473682439e-05,-0.000120230965,-6.08431219e-05,4.017966421e-05,
-	0.0001104430121,0.0001016976894,2.141895129e-05,-7.183506386e-05,-0.0001126153657,
-	-7.294572424e-05,1.690842146e-05,9.309923189e-05,0.0001017940667,3.894263136e-05,
-	-4.985868145e-05,-0.0001013946385,-8.00605776e-05,-2.538554554e-06,7.502371591e-05,
-	9.838815458e-05,5.204719855e-05,-2.939357182e-05,-8.776802133e-05,-8.184528997e-05,
-	-1.733605131e-05,5.929927283e-05, 9.35614371e-05,6.260610098e-05,-1.004799287e-05,
-	-7.128751167e-05,-7.699178968e-05,-2.337051228e-05,5.206494825e-05,9.513885016e-05,
-	7.755560364e-05,1.516476914e-05,-4.550509038e-05,-5.537558172e-05,-3.909872248e-06,
-	7.708086196e-05,0.0001333662512,0.0001309368672,7.863016799e-05,2.689023131e-05,
-	3.104805728e-05,0.0001146628929,0.0002468634048,0.0003607383405,0.0003911434032,
-	0.0003183592344,0.0001791400573,4.880931738e-05,-0.0007371808751
-};
+	m_mode = ModeCubic;
+	m_gain = gain;
+	m_fixedPoint = false;
+	m_useFFT = false;
+	m_phases = 0;
+	m_nTaps = 0;
+	selectKernels();
+	m_schedule.clear();
+	m_historyKeep = 4;
+	m_historyI.assign(m_historyKeep + HistoryChunk, 0);
+	m_historyQ.assign(m_historyKeep + HistoryChunk, 0);
+}
 
-static const float H30[1024] = {
-	-0.0005550688365,-0.0008135512471,-2.577158011e-05,-0.0002784080862,0.0001377547451,
-	6.163041689e-05,0.0001157436054,-3.307844963e-05,-7.206950977e-05,-8.535844972e-05,
-	-2.916724497e-06,6.371719064e-05,8.313141007e-05,2.708357715e-05,-4.795237692e-05,
-	-8.428286674e-05,-4.896206883e-05, 2.67562209e-05,8.116848767e-05, 6.84360275e-05,
-	-1.124620781e-06,-7.091950101e-05,-8.319841436e-05,-2.684715764e-05,5.295175288e-05,
-	9.065631457e-05,5.414701809e-05,-2.785717334e-05,-8.855161286e-05,-7.760032895e-05,
-	-2.661687404e-06,7.620837277e-05,9.435737593e-05,3.528126035e-05,-5.429376688e-05,
-	-0.0001012140638,-6.608938565e-05,2.394739749e-05,9.654332098e-05, 9.18423757e-05,
-	1.149215132e-05,-8.022580005e-05,-0.0001080694929,-4.797812653e-05,5.283401333e-05,
-	0.0001130799574,8.219024312e-05,-1.665687159e-05,-0.0001037326438,-0.0001076937697,
-	-2.345551366e-05,8.230964158e-05,0.0001230016351,6.374902296e-05,-4.894359881e-05,
-	-0.0001243594888,-9.978938033e-05,7.222137356e-06,0.0001105972988,0.0001259069541,
-	3.861670484e-05,-8.241012256e-05,-0.000138567324,-8.266051736e-05,4.195836664e-05,
-	0.000135287919,0.0001198714453,6.035890692e-06,-0.0001151394972,-0.0001449590345,
-	-5.675186185e-05,7.976040797e-05,0.0001539626392,0.0001040725328,-3.224363536e-05,
-	-0.000145047743,-0.0001416345185,-2.249568388e-05,0.0001177795712,0.0001646661403,
-	7.793386612e-05,-7.431804261e-05,-0.0001691894868,-0.000127582287,1.903676639e-05,
-	0.0001532780443,0.0001650675986,4.199380055e-05,-0.0001178007005,-0.000184815086,
-	-0.0001021888165,6.570766709e-05,  0.00018322299,0.0001534867915,-2.524512183e-06,
-	-0.00015957086,-0.0001895794412,-6.530868995e-05,0.0001149627351,0.0002047925227,
-	0.0001293020468,-5.346161925e-05,-0.000196167297,-0.0001813780109,-1.824150058e-05,
-	0.0001631684572,0.0002147399064,9.201644571e-05,-0.0001084544128,-0.0002241766633,
-	-0.0001590509783,3.718471271e-05,0.0002070511255,0.0002109234629,4.272697697e-05,
-	-0.0001637179084,-0.0002404379629,-0.000122222802, 9.80041732e-05,0.0002425423445,
-	0.0001916285109,-1.662051181e-05,-0.0002154206159,-0.000241942631,-7.151379396e-05,
-	0.0001605975558,0.0002660005994,0.0001560297096,-8.324709779e-05,-0.0002591831726,
-	-0.0002266711817,-8.547062862e-06,0.0002206887002,0.0002739639312,0.0001045419995,
-	-0.0001533193717,-0.0002908168244,-0.0001932703162,6.372367352e-05,0.0002736079914,
-	0.0002637740981,3.861500591e-05,-0.0002222973853,-0.0003063813201,-0.0001418840693,
-	0.0001413660648,0.0003143604263,0.0002337840269,-3.90500536e-05,-0.0002849784505,
-	-0.0003025688638,-7.36421207e-05,0.0002196510759,0.0003387162578,0.0001835448493,
-	-0.0001242738217,-0.0003360335832,-0.0002772939333,8.775420611e-06,  0.00029276649,
-	0.0003426894255,0.0001138986481,-0.0002119346173,-0.0003703629482,-0.0002294187871,
-	0.0001013566143,0.0003549533722,0.0003234812757,2.723275429e-05,-0.0002960886632,
-	-0.0003835647949,-0.0001593598863,0.0001985763374,0.0004007307871,0.0002791871957,
-	-7.209514297e-05,-0.0003706823918,-0.0003717297222,-6.960601604e-05,0.0002945443266,
-	0.0004243837902,0.0002102423023,-0.0001791582035,-0.0004288743075,-0.000332896976,
-	3.630507854e-05,0.0003820479324,0.0004218706163,0.0001181058688,-0.0002870177559,
-	-0.0004647716996,-0.0002662222832,0.0001527835266, 0.000454121182,0.0003899424919,
-	6.5669592e-06,-0.0003884517064,-0.0004730843357,-0.0001731697557,0.0002729603439,
-	0.0005036906223,0.0003273055772,-0.0001189884715,-0.0004754664842,-0.0004499106726,
-	-5.686977966e-05,0.0003889220534,0.0005247035879,0.0002346656111,-0.0002515221422,
-	-0.0005403610412,-0.0003931095125,7.720012945e-05,0.0004921266227,0.0005122691509,
-	0.0001149267628,-0.0003825829481,-0.000575963466,-0.0003026659251,0.0002219081507,
-	0.0005738542532,0.0004633471544,-2.683295133e-05,-0.0005029533058,-0.0005763925728,
-	-0.0001808753877,0.0003684650874,0.0006260052905,0.0003770402982,-0.0001833758433,
-	-0.0006030962686,-0.0005375262699,-3.254502008e-05,0.0005070171901,0.0006415178068,
-	0.000254936167,-0.0003456541745,-0.0006738041411,-0.0004575423081,0.0001352563704,
-	0.0006270669983, 0.000615156081,0.0001013472574,-0.0005031488254,-0.0007067826227,
-	-0.0003371290222,0.0003132311977,0.0007183300331,0.0005438833614,-7.682788419e-05,
-	-0.0006445998442,-0.0006955017452,-0.0001799854217,0.0004903543158,0.0007712310762,
-	0.0004274957173,-0.0002702182974,-0.0007584230625,-0.0006356692757,7.393674423e-06,
-	0.0006544432254,0.0007778016152,0.0002687313827,-0.0004673783551,-0.0008337954641,
-	-0.0005258463207,0.0002156858536,0.0007928588311,0.0007323494647,7.363432087e-05,
-	-0.0006553577841,-0.0008611787343,-0.000367871311, 0.000433114823,0.0008932927158,
-	0.0006320629036,-0.000148697276,-0.0008203156758,-0.0008333344012,-0.0001669262856,
-	0.0006459802389,0.0009446501499,0.0004775392881,-0.0003862882731,-0.0009485083283,
-	-0.0007458510809,6.823506556e-05,0.0008393639582,0.0009378727409,0.0002730317356,
-	-0.000624891487,-0.001027107937,-0.000597905193,0.0003256573982,0.0009980183095,
-	0.0008668601513,2.663512532e-05,-0.0008484561695,-0.001045197248,-0.0003925164056,
-	0.0005905432627, 0.001107327291,0.0007290241192,-0.000249880628,-0.001040322823,
-	-0.0009946615901,-0.0001369305683,0.0008459960227,  0.00115435163,0.0005259762402,
-	-0.0005413919571,-0.001184002613,-0.0008709993563,0.0001575054339, 0.001073818188,
-	0.001128769829,0.0002637486323,-0.000830171397,-0.001264346763,-0.0006739953533,
-	0.000475635461, 0.001255674055, 0.001023813267,-4.700527279e-05,-0.001096735243,
-	-0.0012686064,-0.0004082540399,0.0007991053862, 0.001374036307,0.0008372351294,
-	-0.0003914158151,-0.001320731011,-0.001187560381,-8.326470561e-05, 0.001107116695,
-	0.001413611928,0.0005716969026,-0.0007506419788,-0.001482262393,-0.001016436145,
-	0.0002865982533, 0.001377413049, 0.001362333191,0.0002351853618,-0.001102769049,
-	-0.001563202939,-0.0007555547054,0.0006823684671, 0.001587697654, 0.001212479896,
-	-0.000158761628,-0.001423820504,-0.001548288506,-0.0004110574955, 0.001081297058,
-	0.001716697472,0.0009616636671,-0.0005915453658,-0.001688882709,-0.001426542294,
-	5.075228273e-06, 0.001457727514, 0.001745781046,0.0006134737632,-0.001039869851,
-	-0.00187357876,-0.001192242722,0.0004749291693, 0.001784301014, 0.001660162932,
-	0.0001779094746,-0.001476673759,-0.001955453539,-0.0008458131342,0.0009751665057,
-	0.002033343771, 0.001450186945,-0.0003285546845,-0.001872262335,-0.001915466622,
-	-0.00039449826, 0.001477741054, 0.002178310649, 0.001112365513,-0.0008831493906,
-	-0.002195648616,-0.001739340369, 0.000147471801,  0.00195089553, 0.002195420675,
-	0.0006502260221,-0.001457411563,-0.002416019328,-0.001418783097,0.0007587284199,
-	0.002360444516, 0.002064980334,7.478508633e-05,-0.002018042607,-0.002504268195,
-	-0.0009524936322,  0.00141131843, 0.002671154449, 0.001772879739,-0.0005952715874,
-	-0.002527988981,-0.002434572903,-0.0003468540381, 0.002071177121, 0.002848262433,
-	0.001311566681,-0.001333685359, -0.00294773886,-0.002185675083,0.0003837181139,
-	0.002699173987, 0.002858897904,0.0006809356855, -0.00210712757,-0.003236637916,
-	-0.001742086373, 0.001216713572, 0.003252086462, 0.002673357259,-0.000111203386,
-	-0.002875793958, -0.00335410866,-0.001094763982,  0.00212178682, 0.003683663206,
-	0.002265988849,-0.001049069338,  -0.0035942588, -0.00326053449,-0.0002415072522,
-	0.003061247291, 0.003945370205, 0.001615565154,-0.002109276596,-0.004212005995,
-	-0.002917573322,0.0008134835516, 0.003990733065, 0.003986609634,0.0007047671243,
-	-0.003261543578,-0.004673752002,-0.002287364332, 0.002060692525, 0.004859570879,
-	0.003753716592,-0.0004816522123, -0.00446986407, -0.00491838064,-0.001329867751,
-	0.003487779992, 0.005610628519, 0.003186656628,-0.001961077098,-0.005693987943,
-	-0.004875851795,3.335586598e-06, 0.005083869677, 0.006178481039, 0.002211184008,
-	-0.003761464963,-0.006891133264,-0.004458943848, 0.001782384119,  0.00684767589,
-	0.006483848207,0.0007210213807,-0.005938961636, -0.00801792182,-0.003543809522,
-	0.004128686618, 0.008803868666, 0.006418901961, -0.00146385422,-0.008617452346,
-	-0.009032373317,-0.001921163057, 0.007286804263,  0.01104148477, 0.005806804169,
-	-0.004706352483, -0.01209206786,-0.009895901196, 0.000842124864,   0.0118299257,
-	0.0138236098,  0.00427501183,-0.009897420183, -0.01716405898, -0.01057507191,
-	0.005896455608,  0.01941999793,  0.01800918207,0.0007292297087, -0.01996039599,
-	-0.02669263259, -0.01104333531,   0.0177867189,  0.03731707484,  0.02782552503,
-	-0.01057860069,  -0.0528370589, -0.06161220372, -0.01128220279,  0.09210553765,
-	0.2091050893,   0.2863663435,   0.2863663435,   0.2091050893,  0.09210553765,
-	-0.01128220279, -0.06161220372,  -0.0528370589, -0.01057860069,  0.02782552503,
-	0.03731707484,   0.0177867189, -0.01104333531, -0.02669263259, -0.01996039599,
-	0.0007292297087,  0.01800918207,  0.01941999793, 0.005896455608, -0.01057507191,
-	-0.01716405898,-0.009897420183,  0.00427501183,   0.0138236098,   0.0118299257,
-	0.000842124864,-0.009895901196, -0.01209206786,-0.004706352483, 0.005806804169,
-	0.01104148477, 0.007286804263,-0.001921163057,-0.009032373317,-0.008617452346,
-	-0.00146385422, 0.006418901961, 0.008803868666, 0.004128686618,-0.003543809522,
-	-0.00801792182,-0.005938961636,0.0007210213807, 0.006483848207,  0.00684767589,
-	0.001782384119,-0.004458943848,-0.006891133264,-0.003761464963, 0.002211184008,
-	0.006178481039, 0.005083869677,3.335586598e-06,-0.004875851795,-0.005693987943,
-	-0.001961077098, 0.003186656628, 0.005610628519, 0.003487779992,-0.001329867751,
-	-0.00491838064, -0.00446986407,-0.0004816522123, 0.003753716592, 0.004859570879,
-	0.002060692525,-0.002287364332,-0.004673752002,-0.003261543578,0.0007047671243,
-	0.003986609634, 0.003990733065,0.0008134835516,-0.002917573322,-0.004212005995,
-	-0.002109276596, 0.001615565154, 0.003945370205, 0.003061247291,-0.0002415072522,
-	-0.00326053449,  -0.0035942588,-0.001049069338, 0.002265988849, 0.003683663206,
-	0.00212178682,-0.001094763982, -0.00335410866,-0.002875793958,-0.000111203386,
-	0.002673357259, 0.003252086462, 0.001216713572,-0.001742086373,-0.003236637916,
-	-0.00210712757,0.0006809356855, 0.002858897904, 0.002699173987,0.0003837181139,
-	-0.002185675083, -0.00294773886,-0.001333685359, 0.001311566681, 0.002848262433,
-	0.002071177121,-0.0003468540381,-0.002434572903,-0.002527988981,-0.0005952715874,
-	0.001772879739, 0.002671154449,  0.00141131843,-0.0009524936322,-0.002504268195,
-	-0.002018042607,7.478508633e-05, 0.002064980334, 0.002360444516,0.0007587284199,
-	-0.001418783097,-0.002416019328,-0.001457411563,0.0006502260221, 0.002195420675,
-	0.00195089553, 0.000147471801,-0.001739340369,-0.002195648616,-0.0008831493906,
-	0.001112365513, 0.002178310649, 0.001477741054, -0.00039449826,-0.001915466622,
-	-0.001872262335,-0.0003285546845, 0.001450186945, 0.002033343771,0.0009751665057,
-	-0.0008458131342,-0.001955453539,-0.001476673759,0.0001779094746, 0.001660162932,
-	0.001784301014,0.0004749291693,-0.001192242722, -0.00187357876,-0.001039869851,
-	0.0006134737632, 0.001745781046, 0.001457727514,5.075228273e-06,-0.001426542294,
-	-0.001688882709,-0.0005915453658,0.0009616636671, 0.001716697472, 0.001081297058,
-	-0.0004110574955,-0.001548288506,-0.001423820504,-0.000158761628, 0.001212479896,
-	0.001587697654,0.0006823684671,-0.0007555547054,-0.001563202939,-0.001102769049,
-	0.0002351853618, 0.001362333191, 0.001377413049,0.0002865982533,-0.001016436145,
-	-0.001482262393,-0.0007506419788,0.0005716969026, 0.001413611928, 0.001107116695,
-	-8.326470561e-05,-0.001187560381,-0.001320731011,-0.0003914158151,0.0008372351294,
-	0.001374036307,0.0007991053862,-0.0004082540399,  -0.0012686064,-0.001096735243,
-	-4.700527279e-05, 0.001023813267, 0.001255674055, 0.000475635461,-0.0006739953533,
-	-0.001264346763,-0.000830171397,0.0002637486323, 0.001128769829, 0.001073818188,
-	0.0001575054339,-0.0008709993563,-0.001184002613,-0.0005413919571,0.0005259762402,
-	0.00115435163,0.0008459960227,-0.0001369305683,-0.0009946615901,-0.001040322823,
-	-0.000249880628,0.0007290241192, 0.001107327291,0.0005905432627,-0.0003925164056,
-	-0.001045197248,-0.0008484561695,2.663512532e-05,0.0008668601513,0.0009980183095,
-	0.0003256573982,-0.000597905193,-0.001027107937,-0.000624891487,0.0002730317356,
-	0.0009378727409,0.0008393639582,6.823506556e-05,-0.0007458510809,-0.0009485083283,
-	-0.0003862882731,0.0004775392881,0.0009446501499,0.0006459802389,-0.0001669262856,
-	-0.0008333344012,-0.0008203156758,-0.000148697276,0.0006320629036,0.0008932927158,
-	0.000433114823,-0.000367871311,-0.0008611787343,-0.0006553577841,7.363432087e-05,
-	0.0007323494647,0.0007928588311,0.0002156858536,-0.0005258463207,-0.0008337954641,
-	-0.0004673783551,0.0002687313827,0.0007778016152,0.0006544432254,7.393674423e-06,
-	-0.0006356692757,-0.0007584230625,-0.0002702182974,0.0004274957173,0.0007712310762,
-	0.0004903543158,-0.0001799854217,-0.0006955017452,-0.0006445998442,-7.682788419e-05,
-	0.0005438833614,0.0007183300331,0.0003132311977,-0.0003371290222,-0.0007067826227,
-	-0.0005031488254,0.0001013472574, 0.000615156081,0.0006270669983,0.0001352563704,
-	-0.0004575423081,-0.0006738041411,-0.0003456541745, 0.000254936167,0.0006415178068,
-	0.0005070171901,-3.254502008e-05,-0.0005375262699,-0.0006030962686,-0.0001833758433,
-	0.0003770402982,0.0006260052905,0.0003684650874,-0.0001808753877,-0.0005763925728,
-	-0.0005029533058,-2.683295133e-05,0.0004633471544,0.0005738542532,0.0002219081507,
-	-0.0003026659251,-0.000575963466,-0.0003825829481,0.0001149267628,0.0005122691509,
-	0.0004921266227,7.720012945e-05,-0.0003931095125,-0.0005403610412,-0.0002515221422,
-	0.0002346656111,0.0005247035879,0.0003889220534,-5.686977966e-05,-0.0004499106726,
-	-0.0004754664842,-0.0001189884715,0.0003273055772,0.0005036906223,0.0002729603439,
-	-0.0001731697557,-0.0004730843357,-0.0003884517064,  6.5669592e-06,0.0003899424919,
-	0.000454121182,0.0001527835266,-0.0002662222832,-0.0004647716996,-0.0002870177559,
-	0.0001181058688,0.0004218706163,0.0003820479324,3.630507854e-05,-0.000332896976,
-	-0.0004288743075,-0.0001791582035,0.0002102423023,0.0004243837902,0.0002945443266,
-	-6.960601604e-05,-0.0003717297222,-0.0003706823918,-7.209514297e-05,0.0002791871957,
-	0.0004007307871,0.0001985763374,-0.0001593598863,-0.0003835647949,-0.0002960886632,
-	2.723275429e-05,0.0003234812757,0.0003549533722,0.0001013566143,-0.0002294187871,
-	-0.0003703629482,-0.0002119346173,0.0001138986481,0.0003426894255,  0.00029276649,
-	8.775420611e-06,-0.0002772939333,-0.0003360335832,-0.0001242738217,0.0001835448493,
-	0.0003387162578,0.0002196510759,-7.36421207e-05,-0.0003025688638,-0.0002849784505,
-	-3.90500536e-05,0.0002337840269,0.0003143604263,0.0001413660648,-0.0001418840693,
-	-0.0003063813201,-0.0002222973853,3.861500591e-05,0.0002637740981,0.0002736079914,
-	6.372367352e-05,-0.0001932703162,-0.0002908168244,-0.0001533193717,0.0001045419995,
-	0.0002739639312,0.0002206887002,-8.547062862e-06,-0.0002266711817,-0.0002591831726,
-	-8.324709779e-05,0.0001560297096,0.0002660005994,0.0001605975558,-7.151379396e-05,
-	-0.000241942631,-0.0002154206159,-1.662051181e-05,0.0001916285109,0.0002425423445,
-	9.80041732e-05,-0.000122222802,-0.0002404379629,-0.0001637179084,4.272697697e-05,
-	0.0002109234629,0.0002070511255,3.718471271e-05,-0.0001590509783,-0.0002241766633,
-	-0.0001084544128,9.201644571e-05,0.0002147399064,0.0001631684572,-1.824150058e-05,
-	-0.0001813780109,-0.000196167297,-5.346161925e-05,0.0001293020468,0.0002047925227,
-	0.0001149627351,-6.530868995e-05,-0.0001895794412, -0.00015957086,-2.524512183e-06,
-	0.0001534867915,  0.00018322299,6.570766709e-05,-0.0001021888165,-0.000184815086,
-	-0.0001178007005,4.199380055e-05,0.0001650675986,0.0001532780443,1.903676639e-05,
-	-0.000127582287,-0.0001691894868,-7.431804261e-05,7.793386612e-05,0.0001646661403,
-	0.0001177795712,-2.249568388e-05,-0.0001416345185,-0.000145047743,-3.224363536e-05,
-	0.0001040725328,0.0001539626392,7.976040797e-05,-5.675186185e-05,-0.0001449590345,
-	-0.0001151394972,6.035890692e-06,0.0001198714453, 0.000135287919,4.195836664e-05,
-	-8.266051736e-05,-0.000138567324,-8.241012256e-05,3.861670484e-05,0.0001259069541,
-	0.0001105972988,7.222137356e-06,-9.978938033e-05,-0.0001243594888,-4.894359881e-05,
-	6.374902296e-05,0.0001230016351,8.230964158e-05,-2.345551366e-05,-0.0001076937697,
-	-0.0001037326438,-1.665687159e-05,8.219024312e-05,0.0001130799574,5.283401333e-05,
-	-4.797812653e-05,-0.0001080694929,-8.022580005e-05,1.149215132e-05, 9.18423757e-05,
-	9.654332098e-05,2.394739749e-05,-6.608938565e-05,-0.0001012140638,-5.429376688e-05,
-	3.528126035e-05,9.435737593e-05,7.620837277e-05,-2.661687404e-06,-7.760032895e-05,
-	-8.855161286e-05,-2.785717334e-05,5.414701809e-05,9.065631457e-05,5.295175288e-05,
-	-2.684715764e-05,-8.319841436e-05,-7.091950101e-05,-1.124620781e-06, 6.84360275e-05,
-	8.116848767e-05, 2.67562209e-05,-4.896206883e-05,-8.428286674e-05,-4.795237692e-05,
-	2.708357715e-05,8.313141007e-05,6.371719064e-05,-2.916724497e-06,-8.535844972e-05,
-	-7.206950977e-05,-3.307844963e-05,0.0001157436054,6.163041689e-05,0.0001377547451,
-	-0.0002784080862,-2.577158011e-05,-0.0008135512471,-0.0005550688365
-};
+// cutoff frequency for a designed filter with tapsPerPhase taps at the input rate:
+// the transition band is placed just below the Nyquist frequency of the slower side
+double SSEInterpolator::designCutoff(double inputRate, double minRate, int tapsPerPhase)
+{
+	double transition = (KaiserAttenuation - 7.95) / (14.36 * tapsPerPhase) * inputRate;
+	double cutoff = minRate * 0.5 - transition * 0.5;
+	if(cutoff < minRate * 0.2)
+		cutoff = minRate * 0.2;
+	return cutoff;
+}
 
-static const float H32[1024] = {
-	-1.659109512e-05,-0.0009544560453,-0.000369700283,-0.0002387792774,-3.727990043e-05,
-	0.0001029849882,0.0001117500433,2.008670344e-05,-7.440889749e-05,-8.780070493e-05,
-	-1.800784776e-05,6.458584539e-05, 8.22799193e-05,2.207875514e-05,-5.816356133e-05,
-	-8.251800318e-05,-2.94261099e-05,5.180200969e-05,  8.4665553e-05,3.879515862e-05,
-	-4.432068454e-05,-8.691649418e-05,-4.929464558e-05,3.536697113e-05,8.834632899e-05,
-	6.034634498e-05,-2.474208122e-05,-8.825784607e-05,-7.13601039e-05,1.252071979e-05,
-	8.628331852e-05,8.194265683e-05,1.229457098e-06,-8.212005923e-05,-9.163701907e-05,
-	-1.61932312e-05,7.572135655e-05,0.0001000661796,3.201034633e-05,-6.701544044e-05,
-	-0.0001066831537,-4.817215085e-05,5.594147297e-05,0.0001110220473,6.441972073e-05,
-	-4.235340384e-05,-0.0001128666117,-8.053841884e-05, 2.66721654e-05,0.0001123472102,
-	9.570102702e-05,-9.53928793e-06,-0.0001085329422,-0.0001091276936,-9.902372767e-06,
-	0.0001018804032, 0.000121359808,2.962214603e-05,-9.161343769e-05,-0.0001311848318,
-	-5.047806917e-05,7.864940562e-05,0.0001381166658,7.155592175e-05,-6.267428398e-05,
-	-0.0001419815089,-9.22219333e-05,4.391068796e-05,0.0001424188231,0.0001119483059,
-	-2.25985259e-05,-0.0001390291145,-0.0001299089636,-4.440343275e-07,0.0001322947792,
-	0.0001464393135,2.597502862e-05,-0.0001205641602,-0.0001590938482,-5.144454917e-05,
-	0.0001057369227,0.0001689254277,7.742968592e-05,-8.723745123e-05,-0.0001752257231,
-	-0.0001033661028,6.509733066e-05,0.0001773685362,0.0001283332385,-3.983023998e-05,
-	-0.0001750211231,-0.0001515064214,1.190214334e-05,0.0001678840199,0.0001721709559,
-	1.813866584e-05,-0.0001559779485,-0.0001897698967,-4.957400233e-05,0.0001393619168,
-	0.0002034642675,8.158999117e-05,-0.0001180488471,-0.0002127868211,-0.0001136209685,
-	9.246646368e-05,0.0002172372333,0.0001444802183,-6.288361328e-05,-0.000216313565,
-	-0.0001737204584,3.002972517e-05,0.0002097386168,0.0002001403336,5.660095667e-06,
-	-0.0001975319174,-0.000222995106,-4.333479592e-05,0.0001794837735,0.0002414819901,
-	8.206422353e-05,-0.000155788759,-0.0002549117489,-0.0001209931215,0.0001266930922,
-	0.000262598187,0.0001590732136,-9.271541785e-05,-0.0002640642051,-0.0001953012252,
-	5.439615779e-05,0.0002588382631,0.0002285802038,-1.251797858e-05,-0.0002467366285,
-	-0.0002579705324,-3.209634451e-05,0.0002276635787,0.0002824352996,7.835216093e-05,
-	-0.000201773757,-0.0003010952787,-0.0001252369548,0.0001692341903,0.0003130681289,
-	0.0001714574028,-0.0001307586354,-0.0003179626656,-0.000216069413,8.661451284e-05,
-	0.0003147395619, 0.000257351785,-3.811693023e-05,-0.0003036501876,-0.0002945647575,
-	-1.400314795e-05,0.0002842698304,  0.00032634323,6.870736252e-05,-0.0002565797477,
-	-0.0003516093711,-0.0001245641179,  0.00022088892,0.0003692350874,0.0001802797051,
-	-0.0001777910365,-0.0003785223817,-0.0002343257365,0.0001278893033,0.0003787919995,
-	0.0002852960024,-7.217014354e-05,-0.0003695173946,-0.0003317823575,1.172365774e-05,
-	0.0003504613123,0.0003723560367,5.215669444e-05,-0.0003216163313,-0.0004056625476,
-	-0.000118023665,0.0002831998281,0.0004304863396,0.0001843224891,-0.0002356886398,
-	-0.0004457787727,-0.0002493946813,0.0001798526064,0.0004506775585,0.0003115221916,
-	-0.0001166594302, -0.00044450321,-0.0003689845616,4.734668983e-05,0.0004268995835,
-	0.0004201210977, 2.66345105e-05,-0.0003977140004,-0.0004632815253,-0.0001036507019,
-	0.0003571032139,0.0004970353912,0.0001819474855,-0.0003055479319,-0.0005200286396,
-	-0.0002595416445,0.0002438017109,0.0005311755813,0.0003345327568,-0.0001729065989,
-	-0.0005296072341,-0.0004048196133,9.421198047e-05,0.0005147441989,0.0004685214953,
-	-9.288130968e-06,-0.0004863040522,-0.0005235696444, -7.9975056e-05,0.0004444341466,
-	0.0005683749914,0.0001716746774,-0.0003892940586,-0.0006010687794,-0.0002634338744,
-	0.0003219351929,0.0006204828387,0.0003531785333,-0.0002432608017,-0.0006253709435,
-	-0.0004384759231, 0.000154704001,0.0006149047986,0.0005169542274,-5.803396198e-05,
-	-0.0005886285799,-0.0005863130209,-4.466312384e-05,0.0005465024151, 0.000644447282,
-	0.000151188302,-0.0004887746181,-0.0006893638056,-0.0002590475779,0.0004161747638,
-	0.0007193277124,0.0003656264453,-0.0003297653166,-0.0007328422507,-0.0004682030703,
-	0.0002310608688,0.0007288366323,0.0005640551681,-0.0001219369515,-0.0007065524696,
-	-0.0006504510529,  4.6091277e-06,0.0006657107733,0.0007248379407,0.0001183847999,
-	-0.0006064298213,-0.0007847622037,-0.0002442772675,0.0005293168942,0.0008281058399,
-	0.0003700673697,-0.0004354606499,-0.0008529736078,-0.0004926502588,0.0003263904073,
-	0.0008579227142,0.0006088147638,-0.0002040774561,-0.0008418612997,-0.0007154271007,
-	7.095729234e-05,0.0008042062982,0.0008093668148,7.021294005e-05,-0.0007449041004,
-	-0.000887729344,-0.0002163341123,0.0006643733359,0.0009478509892,0.0003640070208,
-	-0.000563618727,-0.0009874037933,-0.0005096764071,0.0004441417987, 0.001004402409,
-	0.000649632304,-0.0003080638999,-0.0009974521818,-0.0007802417967,0.0001578528463,
-	0.000965458632,0.0008977020043,3.322398925e-06,-0.0009081704193,-0.0009986538207,
-	-0.0001721460139,0.0008257012232, 0.001079748967,0.0003447790223,-0.0007188927848,
-	-0.001138055697,-0.0005171611556,0.0005892356858, 0.001171067124,0.0006850179052,
-	-0.0004388365487,-0.001176796737,-0.0008440991514,0.0002703397186, 0.001153766876,
-	0.0009900309378,-8.702667401e-05,-0.001101155882,-0.001118637738,-0.0001073506937,
-	0.00101881742, 0.001225887565, 0.000308546907,-0.0009073356632,-0.001308177249,
-	-0.0005119881826,0.0007680004346, 0.001362223644,0.0007128183497,-0.0006028764183,
-	-0.001385366777,-0.0009060152224,0.0004146773135, 0.001375502907, 0.001086470205,
-	-0.0002068889153, -0.00133123924,-0.001249178895,-1.642931784e-05, 0.001251914888,
-	0.001389287179,0.0002506085439,-0.001137728104,-0.001502259285,-0.0004905263195,
-	0.000989661552, 0.001583954319,0.0007306288462,-0.0008096018573,-0.001630808925,
-	-0.0009651118307,0.0006002649898,   0.0016398835, 0.001188002876,-0.0003651981242,
-	-0.00160900387,-0.001393308514,0.0001087530327, 0.001536814845, 0.001575124799,
-	0.0001640080882,-0.001422868343,-0.001727822586,-0.0004473422596, 0.001267719199,
-	0.001846179599, 0.000735050533, -0.00107280747,-0.001925418968, -0.00102035061,
-	0.0008407532005, 0.001961574191, 0.001296342118,-0.0005749982665,-0.001951339655,
-	-0.001555824187,0.0002800706134,  0.00189234456, 0.001791659044,3.860915604e-05,
-	-0.001783259329,-0.001996841747,-0.000374787458, 0.001623815857, 0.002164735692,
-	0.0007214681827, -0.00141482288, -0.00228910055,-0.001070995117, 0.001158348052,
-	0.002364389366, 0.001415232895,-0.0008576187538,-0.002385823289,-0.001745670103,
-	0.00051706878, 0.002349607646, 0.002053647069,-0.0001422490459,-0.002252953127,
-	-0.002330448711,-0.0002601484302, 0.002094293945, 0.002567572985,0.0006824678858,
-	-0.001873298315,-0.002756820992, -0.00111608021, 0.001591021661,  0.00289057591,
-	0.001551639754,-0.001249874476,-0.002961903578,-0.001979097491,0.0008537310641,
-	0.002964784391, 0.002387992106,-0.0004078306083, -0.00289422553,-0.002767488128,
-	-8.113020158e-05, 0.002746478654,   0.0031067112,0.0006051628734,-0.002519093687,
-	-0.003394808387, -0.00115497713, 0.002211076207, 0.003621242475, 0.001720150467,
-	-0.001822958468,-0.003775890684,-0.002289172495, 0.001356892171, 0.003849348053,
-	0.002849635668,-0.000816640968,-0.003832991933,-0.003388400422,0.0002076092351,
-	0.003719159169,  0.00389162451,0.0004631046613,-0.003501398489,-0.004345123656,
-	-0.001186891575, 0.003174392274, 0.004734321497, 0.001953522442,-0.002734168898,
-	-0.005044496618,-0.002751302905, 0.002178129042,  0.00526088383,  0.00356718991,
-	-0.001504987245,-0.005368697457,-0.004386813845,0.0007147380384, 0.005353146698,
-	0.00519457832,0.0001914283348,-0.005199389998,-0.005973712541,-0.001211367198,
-	0.004892296623, 0.006706306711, 0.002342282096,-0.004416075535,-0.007373199333,
-	-0.003581155324, 0.003753590863, 0.007953782566, 0.004925350659, -0.00288536353,
-	-0.008425567299,-0.006373574026, 0.001787824789, 0.008763388731, 0.007927193306,
-	-0.0004306346818,-0.008938023821,-0.009592399001,-0.001227905392, 0.008913679048,
-	0.01138357446, 0.003248535097,-0.008643524721, -0.01332930196,-0.005725077819,
-	0.008061261848,  0.01548315678, 0.008811259642,-0.007064372767, -0.01794577762,
-	-0.01277688798, 0.005477522034,  0.02091353573,  0.01813862287,-0.002963346895,
-	-0.02480343916, -0.02601489983,-0.001236276003,  0.03064168617,  0.03933208808,
-	0.009275398217, -0.04172346368, -0.06885483861, -0.03069497086,  0.07722064108,
-	0.2115771621,   0.3040846288,   0.3040846288,   0.2115771621,  0.07722064108,
-	-0.03069497086, -0.06885483861, -0.04172346368, 0.009275398217,  0.03933208808,
-	0.03064168617,-0.001236276003, -0.02601489983, -0.02480343916,-0.002963346895,
-	0.01813862287,  0.02091353573, 0.005477522034, -0.01277688798, -0.01794577762,
-	-0.007064372767, 0.008811259642,  0.01548315678, 0.008061261848,-0.005725077819,
-	-0.01332930196,-0.008643524721, 0.003248535097,  0.01138357446, 0.008913679048,
-	-0.001227905392,-0.009592399001,-0.008938023821,-0.0004306346818, 0.007927193306,
-	0.008763388731, 0.001787824789,-0.006373574026,-0.008425567299, -0.00288536353,
-	0.004925350659, 0.007953782566, 0.003753590863,-0.003581155324,-0.007373199333,
-	-0.004416075535, 0.002342282096, 0.006706306711, 0.004892296623,-0.001211367198,
-	-0.005973712541,-0.005199389998,0.0001914283348,  0.00519457832, 0.005353146698,
-	0.0007147380384,-0.004386813845,-0.005368697457,-0.001504987245,  0.00356718991,
-	0.00526088383, 0.002178129042,-0.002751302905,-0.005044496618,-0.002734168898,
-	0.001953522442, 0.004734321497, 0.003174392274,-0.001186891575,-0.004345123656,
-	-0.003501398489,0.0004631046613,  0.00389162451, 0.003719159169,0.0002076092351,
-	-0.003388400422,-0.003832991933,-0.000816640968, 0.002849635668, 0.003849348053,
-	0.001356892171,-0.002289172495,-0.003775890684,-0.001822958468, 0.001720150467,
-	0.003621242475, 0.002211076207, -0.00115497713,-0.003394808387,-0.002519093687,
-	0.0006051628734,   0.0031067112, 0.002746478654,-8.113020158e-05,-0.002767488128,
-	-0.00289422553,-0.0004078306083, 0.002387992106, 0.002964784391,0.0008537310641,
-	-0.001979097491,-0.002961903578,-0.001249874476, 0.001551639754,  0.00289057591,
-	0.001591021661, -0.00111608021,-0.002756820992,-0.001873298315,0.0006824678858,
-	0.002567572985, 0.002094293945,-0.0002601484302,-0.002330448711,-0.002252953127,
-	-0.0001422490459, 0.002053647069, 0.002349607646,  0.00051706878,-0.001745670103,
-	-0.002385823289,-0.0008576187538, 0.001415232895, 0.002364389366, 0.001158348052,
-	-0.001070995117, -0.00228910055, -0.00141482288,0.0007214681827, 0.002164735692,
-	0.001623815857,-0.000374787458,-0.001996841747,-0.001783259329,3.860915604e-05,
-	0.001791659044,  0.00189234456,0.0002800706134,-0.001555824187,-0.001951339655,
-	-0.0005749982665, 0.001296342118, 0.001961574191,0.0008407532005, -0.00102035061,
-	-0.001925418968, -0.00107280747, 0.000735050533, 0.001846179599, 0.001267719199,
-	-0.0004473422596,-0.001727822586,-0.001422868343,0.0001640080882, 0.001575124799,
-	0.001536814845,0.0001087530327,-0.001393308514, -0.00160900387,-0.0003651981242,
-	0.001188002876,   0.0016398835,0.0006002649898,-0.0009651118307,-0.001630808925,
-	-0.0008096018573,0.0007306288462, 0.001583954319, 0.000989661552,-0.0004905263195,
-	-0.001502259285,-0.001137728104,0.0002506085439, 0.001389287179, 0.001251914888,
-	-1.642931784e-05,-0.001249178895, -0.00133123924,-0.0002068889153, 0.001086470205,
-	0.001375502907,0.0004146773135,-0.0009060152224,-0.001385366777,-0.0006028764183,
-	0.0007128183497, 0.001362223644,0.0007680004346,-0.0005119881826,-0.001308177249,
-	-0.0009073356632, 0.000308546907, 0.001225887565,  0.00101881742,-0.0001073506937,
-	-0.001118637738,-0.001101155882,-8.702667401e-05,0.0009900309378, 0.001153766876,
-	0.0002703397186,-0.0008440991514,-0.001176796737,-0.0004388365487,0.0006850179052,
-	0.001171067124,0.0005892356858,-0.0005171611556,-0.001138055697,-0.0007188927848,
-	0.0003447790223, 0.001079748967,0.0008257012232,-0.0001721460139,-0.0009986538207,
-	-0.0009081704193,3.322398925e-06,0.0008977020043, 0.000965458632,0.0001578528463,
-	-0.0007802417967,-0.0009974521818,-0.0003080638999, 0.000649632304, 0.001004402409,
-	0.0004441417987,-0.0005096764071,-0.0009874037933,-0.000563618727,0.0003640070208,
-	0.0009478509892,0.0006643733359,-0.0002163341123,-0.000887729344,-0.0007449041004,
-	7.021294005e-05,0.0008093668148,0.0008042062982,7.095729234e-05,-0.0007154271007,
-	-0.0008418612997,-0.0002040774561,0.0006088147638,0.0008579227142,0.0003263904073,
-	-0.0004926502588,-0.0008529736078,-0.0004354606499,0.0003700673697,0.0008281058399,
-	0.0005293168942,-0.0002442772675,-0.0007847622037,-0.0006064298213,0.0001183847999,
-	0.0007248379407,0.0006657107733,  4.6091277e-06,-0.0006504510529,-0.0007065524696,
-	-0.0001219369515,0.0005640551681,0.0007288366323,0.0002310608688,-0.0004682030703,
-	-0.0007328422507,-0.0003297653166,0.0003656264453,0.0007193277124,0.0004161747638,
-	-0.0002590475779,-0.0006893638056,-0.0004887746181, 0.000151188302, 0.000644447282,
-	0.0005465024151,-4.466312384e-05,-0.0005863130209,-0.0005886285799,-5.803396198e-05,
-	0.0005169542274,0.0006149047986, 0.000154704001,-0.0004384759231,-0.0006253709435,
-	-0.0002432608017,0.0003531785333,0.0006204828387,0.0003219351929,-0.0002634338744,
-	-0.0006010687794,-0.0003892940586,0.0001716746774,0.0005683749914,0.0004444341466,
-	-7.9975056e-05,-0.0005235696444,-0.0004863040522,-9.288130968e-06,0.0004685214953,
-	0.0005147441989,9.421198047e-05,-0.0004048196133,-0.0005296072341,-0.0001729065989,
-	0.0003345327568,0.0005311755813,0.0002438017109,-0.0002595416445,-0.0005200286396,
-	-0.0003055479319,0.0001819474855,0.0004970353912,0.0003571032139,-0.0001036507019,
-	-0.0004632815253,-0.0003977140004, 2.66345105e-05,0.0004201210977,0.0004268995835,
-	4.734668983e-05,-0.0003689845616, -0.00044450321,-0.0001166594302,0.0003115221916,
-	0.0004506775585,0.0001798526064,-0.0002493946813,-0.0004457787727,-0.0002356886398,
-	0.0001843224891,0.0004304863396,0.0002831998281,-0.000118023665,-0.0004056625476,
-	-0.0003216163313,5.215669444e-05,0.0003723560367,0.0003504613123,1.172365774e-05,
-	-0.0003317823575,-0.0003695173946,-7.217014354e-05,0.0002852960024,0.0003787919995,
-	0.0001278893033,-0.0002343257365,-0.0003785223817,-0.0001777910365,0.0001802797051,
-	0.0003692350874,  0.00022088892,-0.0001245641179,-0.0003516093711,-0.0002565797477,
-	6.870736252e-05,  0.00032634323,0.0002842698304,-1.400314795e-05,-0.0002945647575,
-	-0.0003036501876,-3.811693023e-05, 0.000257351785,0.0003147395619,8.661451284e-05,
-	-0.000216069413,-0.0003179626656,-0.0001307586354,0.0001714574028,0.0003130681289,
-	0.0001692341903,-0.0001252369548,-0.0003010952787,-0.000201773757,7.835216093e-05,
-	0.0002824352996,0.0002276635787,-3.209634451e-05,-0.0002579705324,-0.0002467366285,
-	-1.251797858e-05,0.0002285802038,0.0002588382631,5.439615779e-05,-0.0001953012252,
-	-0.0002640642051,-9.271541785e-05,0.0001590732136, 0.000262598187,0.0001266930922,
-	-0.0001209931215,-0.0002549117489,-0.000155788759,8.206422353e-05,0.0002414819901,
-	0.0001794837735,-4.333479592e-05,-0.000222995106,-0.0001975319174,5.660095667e-06,
-	0.0002001403336,0.0002097386168,3.002972517e-05,-0.0001737204584,-0.000216313565,
-	-6.288361328e-05,0.0001444802183,0.0002172372333,9.246646368e-05,-0.0001136209685,
-	-0.0002127868211,-0.0001180488471,8.158999117e-05,0.0002034642675,0.0001393619168,
-	-4.957400233e-05,-0.0001897698967,-0.0001559779485,1.813866584e-05,0.0001721709559,
-	0.0001678840199,1.190214334e-05,-0.0001515064214,-0.0001750211231,-3.983023998e-05,
-	0.0001283332385,0.0001773685362,6.509733066e-05,-0.0001033661028,-0.0001752257231,
-	-8.723745123e-05,7.742968592e-05,0.0001689254277,0.0001057369227,-5.144454917e-05,
-	-0.0001590938482,-0.0001205641602,2.597502862e-05,0.0001464393135,0.0001322947792,
-	-4.440343275e-07,-0.0001299089636,-0.0001390291145,-2.25985259e-05,0.0001119483059,
-	0.0001424188231,4.391068796e-05,-9.22219333e-05,-0.0001419815089,-6.267428398e-05,
-	7.155592175e-05,0.0001381166658,7.864940562e-05,-5.047806917e-05,-0.0001311848318,
-	-9.161343769e-05,2.962214603e-05, 0.000121359808,0.0001018804032,-9.902372767e-06,
-	-0.0001091276936,-0.0001085329422,-9.53928793e-06,9.570102702e-05,0.0001123472102,
-	2.66721654e-05,-8.053841884e-05,-0.0001128666117,-4.235340384e-05,6.441972073e-05,
-	0.0001110220473,5.594147297e-05,-4.817215085e-05,-0.0001066831537,-6.701544044e-05,
-	3.201034633e-05,0.0001000661796,7.572135655e-05,-1.61932312e-05,-9.163701907e-05,
-	-8.212005923e-05,1.229457098e-06,8.194265683e-05,8.628331852e-05,1.252071979e-05,
-	-7.13601039e-05,-8.825784607e-05,-2.474208122e-05,6.034634498e-05,8.834632899e-05,
-	3.536697113e-05,-4.929464558e-05,-8.691649418e-05,-4.432068454e-05,3.879515862e-05,
-	8.4665553e-05,5.180200969e-05,-2.94261099e-05,-8.251800318e-05,-5.816356133e-05,
-	2.207875514e-05, 8.22799193e-05,6.458584539e-05,-1.800784776e-05,-8.780070493e-05,
-	-7.440889749e-05,2.008670344e-05,0.0001117500433,0.0001029849882,-3.727990043e-05,
-	-0.0002387792774,-0.000369700283,-0.0009544560453,-1.659109512e-05
-};
+// polyphase bank for the given layout and cutoff (relative to the input rate), designed on
+// first use and cached for the whole process, so switching back and forth between rates and
+// further interpolators cost nothing; banks stay alive as long as an interpolator uses them,
+// even when the cache drops them. The Q15 taps and the FFT spectrum (fftSize > 0) are added
+// when first asked for; the FFT size follows from the taps and the decimation, which are
+// both fixed for a bank, so a spectrum once built is never replaced.
+std::shared_ptr<const SSEInterpolator::FilterBank> SSEInterpolator::filterBank(int phases, int tapsPerPhase, double cutoff, double gain, bool fixedPoint, int fftSize)
+{
+	typedef std::pair<std::pair<int, int>, std::pair<double, double> > Key;
+	static std::map<Key, std::shared_ptr<FilterBank> > cache;
+	static std::mutex cacheLock;
+	std::lock_guard<std::mutex> locker(cacheLock);
 
-static const float H34[1024] = {
-	0.0003018065181,-0.0007434131112,-0.0005584472092,-0.0004052484874,-0.0001766575297,
-	3.463240137e-05, 0.000113223643,4.928695853e-05,-5.792004595e-05,-9.208038682e-05,
-	-2.733066322e-05,6.220543582e-05,8.167732449e-05,1.479197726e-05,-6.680670776e-05,
-	-7.686833123e-05,-6.455386938e-06,7.130847371e-05,7.443539653e-05,3.843005203e-08,
-	-7.57561138e-05,-7.312464004e-05,5.507630249e-06,8.025109855e-05,7.239021215e-05,
-	-1.062129923e-05,-8.471385809e-05,-7.183541311e-05,1.556018287e-05,8.911717305e-05,
-	7.137397188e-05,-2.027633491e-05,-9.340313409e-05,-7.101948722e-05,2.491441955e-05,
-	9.770593169e-05,7.123598334e-05,-3.019506767e-05,-0.0001022866782,-7.02503894e-05,
-	3.481351087e-05,0.0001067859484, 6.97872747e-05,-3.992474012e-05,-0.0001113060207,
-	-6.903601752e-05,4.522931704e-05,0.0001158300438,6.812512584e-05,-5.071102714e-05,
-	-0.0001203156353,-6.696074706e-05,5.642570613e-05,0.0001247891487,6.557630695e-05,
-	-6.231933367e-05,-0.0001292019297,-6.393698277e-05,6.843431038e-05,0.0001335982379,
-	6.205588579e-05,-7.477419422e-05,-0.0001379527384,-5.987097393e-05,8.136279212e-05,
-	0.000142220757,5.735130253e-05,-8.815035108e-05,-0.0001463651279,-5.454655548e-05,
-	9.513076657e-05,0.0001503916428,5.158810745e-05,-0.0001024756275,-0.000154407142,
-	-4.801275281e-05,0.0001098367356,0.0001582505647,4.426003579e-05,-0.0001174999998,
-	-0.0001619739196,-4.013234502e-05,0.0001253413211,0.0001655267552,3.565295265e-05,
-	-0.0001333885593,-0.0001689252967,-3.082264448e-05,0.0001416059386,0.0001721199369,
-	2.562204281e-05,-0.0001499644568,-0.0001750738302,-2.006195064e-05,0.0001584025449,
-	0.0001777021971,1.405893363e-05,-0.0001669594203,-0.0001799516031,-7.45288844e-06,
-	0.0001758187427,0.0001819192548, 2.06058786e-07,-0.0001851722482,-0.0001840177138,
-	7.061936685e-06,0.0001944268297,0.0001858610631,-1.428916494e-05,-0.0002031747717,
-	-0.0001865567756,2.303913243e-05,0.0002128815977,0.0001877475734,-3.138663305e-05,
-	-0.0002220508322,-0.0001880422642, 4.06081781e-05,0.0002315642778,0.0001881471544,
-	-5.01190807e-05,-0.000241016096,-0.0001877760369,6.011262303e-05,0.0002504996373,
-	0.0001869614789,-7.057295443e-05,-0.0002599920554,-0.0001856914459,8.146800974e-05,
-	0.0002694345021,0.0001839208853,-9.282197425e-05,-0.0002788465936,-0.000181680909,
-	0.0001045981189,0.0002881739929,0.0001788922964,-0.0001168614617,-0.0002974301169,
-	-0.0001755709673, 0.000129532491,0.0003065322817,0.0001716401894,-0.0001426238887,
-	-0.0003155547602,-0.0001671947393,0.0001561860263,0.0003243388783,0.0001621018164,
-	-0.0001701563742,-0.0003329780302,-0.0001564223639,0.0001845257793,0.0003413529193,
-	0.0001500650251,-0.0001993238257,-0.0003495090641,-0.0001430873235,0.0002144803293,
-	0.0003573554859,0.0001354074193,-0.0002300497727, -0.00036492254,-0.0001270611829,
-	0.000245954725,0.0003721132525,0.0001179836181,-0.0002622169559,-0.0003789353941,
-	-0.0001082033923,0.0002787924896,0.0003853408562,9.767353185e-05,-0.0002957039105,
-	-0.0003913124092,-8.639022417e-05,0.0003128919925,0.0003967874509,7.430924597e-05,
-	-0.0003303379635,-0.0004017829779,-6.14856981e-05,0.0003480695304,0.0004062000371,
-	4.784178964e-05,-0.0003660250222,-0.0004100773367,-3.341398042e-05,0.0003842037986,
-	0.0004133581533,1.819204226e-05,-0.0004025537346,-0.0004160211538,-2.204377779e-06,
-	0.0004210077168,0.0004179879325,-1.458452971e-05,-0.0004395430733,-0.0004191976041,
-	3.223211388e-05,0.0004581652465,0.0004196080845,-5.079250695e-05,-0.0004769377992,
-	-0.0004193139321,7.013280992e-05,0.0004957435303,0.0004182770208,-9.018863784e-05,
-	-0.000514421321,-0.0004162719415,0.0001111643141,0.0005330856657,0.0004133559414,
-	-0.0001330570085,-0.000551773177,-0.0004096953198,0.0001555586059,0.0005701565533,
-	0.0004048493283,-0.0001790959795,-0.000588550407,-0.0003991963458,0.0002032891061,
-	0.0006066213246,0.0003924054909,-0.0002283777285,-0.0006245054537,-0.000384599989,
-	0.0002542283037,0.0006420744467,0.0003756847582,-0.000280870765,-0.0006593175931,
-	-0.0003656538902,0.0003082825278,0.0006761797122,0.0003544628271,-0.0003364490694,
-	-0.0006926031783,-0.0003420677967, 0.000365357555,0.0007085499819,0.0003284606501,
-	-0.0003949740203,-0.0007239647093,-0.0003135889419,0.0004253101069,0.0007388156373,
-	0.0002974526142,-0.0004563138937,-0.0007529996219,-0.0002799905196,0.0004879737098,
-	0.0007665341254, 0.000261193898,-0.0005202516331,-0.000779293594,-0.0002410138404,
-	0.0005531506031,0.0007912929868,0.0002194589761,-0.0005866056308,-0.0008024188573,
-	-0.0001964594558,0.0006206299295,0.0008126684697,0.0001720451692,-0.0006551311817,
-	-0.0008219316369,-0.0001461470965, 0.000690128596,0.0008301984053,0.0001187782982,
-	-0.0007255504606,-0.0008373754099,-8.988939953e-05, 0.000761370291,0.0008434128831,
-	5.948016042e-05,-0.000797531975,-0.0008482438279,-2.751440479e-05,0.0008340137429,
-	0.000851810968,-6.018006843e-06,-0.000870764663,-0.0008540219278,4.116308264e-05,
-	0.0009077590075, 0.000854881946, -7.7908393e-05,-0.0009449405479,-0.000854289101,
-	0.0001162550252,0.0009822435677,0.0008522014832,-0.000156208931,-0.001019596704,
-	-0.0008485080907,0.0001978130458, 0.001056960551,0.0008431417518,-0.0002411001915,
-	-0.001094302628,-0.0008360585198,0.0002860673703, 0.001131589408,0.0008272423875,
-	-0.0003326581791,-0.001168681425,-0.0008165438194,0.0003809457412, 0.001205545501,
-	0.0008038874366,-0.0004309645446,-0.001242173486,-0.000789282145,0.0004826473887,
-	0.001278442098,0.0007726091426, -0.00053601322,-0.001314269379,-0.0007537341444,
-	0.0005911538028, 0.001349686296,0.0007327427156,-0.0006479181466,-0.001384460367,
-	-0.00070935447,0.0007064820384, 0.001418679953,0.0006836679531,-0.0007667121827,
-	-0.001452155411,-0.0006554916617,0.0008286978118,  0.00148487906,0.0006248056889,
-	-0.0008923941059,-0.001516722492,-0.0005914875073,0.0009578253957, 0.001547628315,
-	0.0005554707604,-0.001024988946,-0.001577506308,-0.0005166593473, 0.001093898434,
-	0.001606272766,0.0004749612999,-0.001164550311,-0.001633835607,-0.0004302939633,
-	0.001236937474,  0.00166008994,0.0003825357417,-0.001311082626, -0.00168496056,
-	-0.0003315947542, 0.001386975404, 0.001708313008,0.0002773491724,-0.001464658184,
-	-0.001730085467,-0.0002196945279,  0.00154410582, 0.001750127412,0.0001584874699,
-	-0.001625374774,-0.001768377027,-9.36353099e-05, 0.001708436292, 0.001784667955,
-	2.494822911e-05,-0.001793373725, -0.00179893279,4.766907659e-05, 0.001880153315,
-	0.001811000286,-0.0001244096202,-0.001968842931,-0.001820765901,0.0002054213983,
-	0.002059463179,  0.00182807073,-0.0002909065515,-0.002152058529,-0.001832755632,
-	0.0003810758935, 0.002246696269, 0.001834672061,-0.0004761603195,-0.002343457425,
-	-0.001833683695,0.0005763734225, 0.002442389727, 0.001829579473,-0.0006819861592,
-	-0.00254359399,-0.001822186052,0.0007932967274, 0.002647149609, 0.001811261871,
-	-0.0009106442449,-0.002753197215,-0.001796597964, 0.001034400659, 0.002861887682,
-	0.001777967671,-0.001164951711,-0.002973376075,-0.001755096717, 0.001302746357,
-	0.003087812569, 0.001727645635,-0.001448346535,-0.003205472138,-0.001695330604,
-	0.001602304284, 0.003326596459,  0.00165778189,-0.001765281428,-0.003451465629,
-	-0.00161456177, 0.001938060974, 0.003580458462, 0.001565233339,-0.002121502534,
-	-0.003713978687,-0.001509282738, 0.002316587837, 0.003852466354, 0.001446036971,
-	-0.00252455892,-0.003996590618,-0.001374920364,  0.00274668471, 0.004146919586,
-	0.001295024995,-0.002984643448,-0.004304338247,-0.001205498818, 0.003240256337,
-	0.004469737411, 0.001105183968,-0.003515817225,-0.004644319415,-0.0009928083746,
-	0.003813995281, 0.004829446319,0.0008667922812,-0.004138051532,-0.005026837811,
-	-0.0007252687356,  0.00449192524, 0.005238564685,0.0005659251474,-0.004880496301,
-	-0.005467209965,-0.0003859114076, 0.005309825763, 0.005716013722,0.0001816722652,
-	-0.005787545349,-0.005989068188,5.132392835e-05, 0.006323427893, 0.006291674916,
-	-0.0003188865376,-0.006930108182,-0.006630715914,0.0006286673015,  0.00762435561,
-	0.007015413139,-0.0009908579523,-0.008428696543,-0.007458235137, 0.001419482287,
-	0.009374375455,  0.00797669217,  -0.0019341429, -0.01050565951,-0.008595816791,
-	0.002563480986,  0.01188785024, 0.009353064932,-0.003350609215, -0.01362093445,
-	-0.01030670013, 0.004364016932,  0.01586659998,  0.01155289821,-0.005719096866,
-	-0.01890413649, -0.01326233149,  0.00762672862,  0.02326109633,  0.01576952077,
-	-0.01051788963, -0.03006805107, -0.01983158849,  0.01543204021,  0.04226461425,
-	0.02760356106, -0.02567654662,  -0.0706294328, -0.04862914979,  0.06043436378,
-	0.2121712118,   0.3215026855,   0.3215026855,   0.2121712118,  0.06043436378,
-	-0.04862914979,  -0.0706294328, -0.02567654662,  0.02760356106,  0.04226461425,
-	0.01543204021, -0.01983158849, -0.03006805107, -0.01051788963,  0.01576952077,
-	0.02326109633,  0.00762672862, -0.01326233149, -0.01890413649,-0.005719096866,
-	0.01155289821,  0.01586659998, 0.004364016932, -0.01030670013, -0.01362093445,
-	-0.003350609215, 0.009353064932,  0.01188785024, 0.002563480986,-0.008595816791,
-	-0.01050565951,  -0.0019341429,  0.00797669217, 0.009374375455, 0.001419482287,
-	-0.007458235137,-0.008428696543,-0.0009908579523, 0.007015413139,  0.00762435561,
-	0.0006286673015,-0.006630715914,-0.006930108182,-0.0003188865376, 0.006291674916,
-	0.006323427893,5.132392835e-05,-0.005989068188,-0.005787545349,0.0001816722652,
-	0.005716013722, 0.005309825763,-0.0003859114076,-0.005467209965,-0.004880496301,
-	0.0005659251474, 0.005238564685,  0.00449192524,-0.0007252687356,-0.005026837811,
-	-0.004138051532,0.0008667922812, 0.004829446319, 0.003813995281,-0.0009928083746,
-	-0.004644319415,-0.003515817225, 0.001105183968, 0.004469737411, 0.003240256337,
-	-0.001205498818,-0.004304338247,-0.002984643448, 0.001295024995, 0.004146919586,
-	0.00274668471,-0.001374920364,-0.003996590618, -0.00252455892, 0.001446036971,
-	0.003852466354, 0.002316587837,-0.001509282738,-0.003713978687,-0.002121502534,
-	0.001565233339, 0.003580458462, 0.001938060974, -0.00161456177,-0.003451465629,
-	-0.001765281428,  0.00165778189, 0.003326596459, 0.001602304284,-0.001695330604,
-	-0.003205472138,-0.001448346535, 0.001727645635, 0.003087812569, 0.001302746357,
-	-0.001755096717,-0.002973376075,-0.001164951711, 0.001777967671, 0.002861887682,
-	0.001034400659,-0.001796597964,-0.002753197215,-0.0009106442449, 0.001811261871,
-	0.002647149609,0.0007932967274,-0.001822186052, -0.00254359399,-0.0006819861592,
-	0.001829579473, 0.002442389727,0.0005763734225,-0.001833683695,-0.002343457425,
-	-0.0004761603195, 0.001834672061, 0.002246696269,0.0003810758935,-0.001832755632,
-	-0.002152058529,-0.0002909065515,  0.00182807073, 0.002059463179,0.0002054213983,
-	-0.001820765901,-0.001968842931,-0.0001244096202, 0.001811000286, 0.001880153315,
-	4.766907659e-05, -0.00179893279,-0.001793373725,2.494822911e-05, 0.001784667955,
-	0.001708436292,-9.36353099e-05,-0.001768377027,-0.001625374774,0.0001584874699,
-	0.001750127412,  0.00154410582,-0.0002196945279,-0.001730085467,-0.001464658184,
-	0.0002773491724, 0.001708313008, 0.001386975404,-0.0003315947542, -0.00168496056,
-	-0.001311082626,0.0003825357417,  0.00166008994, 0.001236937474,-0.0004302939633,
-	-0.001633835607,-0.001164550311,0.0004749612999, 0.001606272766, 0.001093898434,
-	-0.0005166593473,-0.001577506308,-0.001024988946,0.0005554707604, 0.001547628315,
-	0.0009578253957,-0.0005914875073,-0.001516722492,-0.0008923941059,0.0006248056889,
-	0.00148487906,0.0008286978118,-0.0006554916617,-0.001452155411,-0.0007667121827,
-	0.0006836679531, 0.001418679953,0.0007064820384, -0.00070935447,-0.001384460367,
-	-0.0006479181466,0.0007327427156, 0.001349686296,0.0005911538028,-0.0007537341444,
-	-0.001314269379, -0.00053601322,0.0007726091426, 0.001278442098,0.0004826473887,
-	-0.000789282145,-0.001242173486,-0.0004309645446,0.0008038874366, 0.001205545501,
-	0.0003809457412,-0.0008165438194,-0.001168681425,-0.0003326581791,0.0008272423875,
-	0.001131589408,0.0002860673703,-0.0008360585198,-0.001094302628,-0.0002411001915,
-	0.0008431417518, 0.001056960551,0.0001978130458,-0.0008485080907,-0.001019596704,
-	-0.000156208931,0.0008522014832,0.0009822435677,0.0001162550252,-0.000854289101,
-	-0.0009449405479, -7.7908393e-05, 0.000854881946,0.0009077590075,4.116308264e-05,
-	-0.0008540219278,-0.000870764663,-6.018006843e-06, 0.000851810968,0.0008340137429,
-	-2.751440479e-05,-0.0008482438279,-0.000797531975,5.948016042e-05,0.0008434128831,
-	0.000761370291,-8.988939953e-05,-0.0008373754099,-0.0007255504606,0.0001187782982,
-	0.0008301984053, 0.000690128596,-0.0001461470965,-0.0008219316369,-0.0006551311817,
-	0.0001720451692,0.0008126684697,0.0006206299295,-0.0001964594558,-0.0008024188573,
-	-0.0005866056308,0.0002194589761,0.0007912929868,0.0005531506031,-0.0002410138404,
-	-0.000779293594,-0.0005202516331, 0.000261193898,0.0007665341254,0.0004879737098,
-	-0.0002799905196,-0.0007529996219,-0.0004563138937,0.0002974526142,0.0007388156373,
-	0.0004253101069,-0.0003135889419,-0.0007239647093,-0.0003949740203,0.0003284606501,
-	0.0007085499819, 0.000365357555,-0.0003420677967,-0.0006926031783,-0.0003364490694,
-	0.0003544628271,0.0006761797122,0.0003082825278,-0.0003656538902,-0.0006593175931,
-	-0.000280870765,0.0003756847582,0.0006420744467,0.0002542283037,-0.000384599989,
-	-0.0006245054537,-0.0002283777285,0.0003924054909,0.0006066213246,0.0002032891061,
-	-0.0003991963458,-0.000588550407,-0.0001790959795,0.0004048493283,0.0005701565533,
-	0.0001555586059,-0.0004096953198,-0.000551773177,-0.0001330570085,0.0004133559414,
-	0.0005330856657,0.0001111643141,-0.0004162719415,-0.000514421321,-9.018863784e-05,
-	0.0004182770208,0.0004957435303,7.013280992e-05,-0.0004193139321,-0.0004769377992,
-	-5.079250695e-05,0.0004196080845,0.0004581652465,3.223211388e-05,-0.0004191976041,
-	-0.0004395430733,-1.458452971e-05,0.0004179879325,0.0004210077168,-2.204377779e-06,
-	-0.0004160211538,-0.0004025537346,1.819204226e-05,0.0004133581533,0.0003842037986,
-	-3.341398042e-05,-0.0004100773367,-0.0003660250222,4.784178964e-05,0.0004062000371,
-	0.0003480695304,-6.14856981e-05,-0.0004017829779,-0.0003303379635,7.430924597e-05,
-	0.0003967874509,0.0003128919925,-8.639022417e-05,-0.0003913124092,-0.0002957039105,
-	9.767353185e-05,0.0003853408562,0.0002787924896,-0.0001082033923,-0.0003789353941,
-	-0.0002622169559,0.0001179836181,0.0003721132525, 0.000245954725,-0.0001270611829,
-	-0.00036492254,-0.0002300497727,0.0001354074193,0.0003573554859,0.0002144803293,
-	-0.0001430873235,-0.0003495090641,-0.0001993238257,0.0001500650251,0.0003413529193,
-	0.0001845257793,-0.0001564223639,-0.0003329780302,-0.0001701563742,0.0001621018164,
-	0.0003243388783,0.0001561860263,-0.0001671947393,-0.0003155547602,-0.0001426238887,
-	0.0001716401894,0.0003065322817, 0.000129532491,-0.0001755709673,-0.0002974301169,
-	-0.0001168614617,0.0001788922964,0.0002881739929,0.0001045981189,-0.000181680909,
-	-0.0002788465936,-9.282197425e-05,0.0001839208853,0.0002694345021,8.146800974e-05,
-	-0.0001856914459,-0.0002599920554,-7.057295443e-05,0.0001869614789,0.0002504996373,
-	6.011262303e-05,-0.0001877760369,-0.000241016096,-5.01190807e-05,0.0001881471544,
-	0.0002315642778, 4.06081781e-05,-0.0001880422642,-0.0002220508322,-3.138663305e-05,
-	0.0001877475734,0.0002128815977,2.303913243e-05,-0.0001865567756,-0.0002031747717,
-	-1.428916494e-05,0.0001858610631,0.0001944268297,7.061936685e-06,-0.0001840177138,
-	-0.0001851722482, 2.06058786e-07,0.0001819192548,0.0001758187427,-7.45288844e-06,
-	-0.0001799516031,-0.0001669594203,1.405893363e-05,0.0001777021971,0.0001584025449,
-	-2.006195064e-05,-0.0001750738302,-0.0001499644568,2.562204281e-05,0.0001721199369,
-	0.0001416059386,-3.082264448e-05,-0.0001689252967,-0.0001333885593,3.565295265e-05,
-	0.0001655267552,0.0001253413211,-4.013234502e-05,-0.0001619739196,-0.0001174999998,
-	4.426003579e-05,0.0001582505647,0.0001098367356,-4.801275281e-05,-0.000154407142,
-	-0.0001024756275,5.158810745e-05,0.0001503916428,9.513076657e-05,-5.454655548e-05,
-	-0.0001463651279,-8.815035108e-05,5.735130253e-05, 0.000142220757,8.136279212e-05,
-	-5.987097393e-05,-0.0001379527384,-7.477419422e-05,6.205588579e-05,0.0001335982379,
-	6.843431038e-05,-6.393698277e-05,-0.0001292019297,-6.231933367e-05,6.557630695e-05,
-	0.0001247891487,5.642570613e-05,-6.696074706e-05,-0.0001203156353,-5.071102714e-05,
-	6.812512584e-05,0.0001158300438,4.522931704e-05,-6.903601752e-05,-0.0001113060207,
-	-3.992474012e-05, 6.97872747e-05,0.0001067859484,3.481351087e-05,-7.02503894e-05,
-	-0.0001022866782,-3.019506767e-05,7.123598334e-05,9.770593169e-05,2.491441955e-05,
-	-7.101948722e-05,-9.340313409e-05,-2.027633491e-05,7.137397188e-05,8.911717305e-05,
-	1.556018287e-05,-7.183541311e-05,-8.471385809e-05,-1.062129923e-05,7.239021215e-05,
-	8.025109855e-05,5.507630249e-06,-7.312464004e-05,-7.57561138e-05,3.843005203e-08,
-	7.443539653e-05,7.130847371e-05,-6.455386938e-06,-7.686833123e-05,-6.680670776e-05,
-	1.479197726e-05,8.167732449e-05,6.220543582e-05,-2.733066322e-05,-9.208038682e-05,
-	-5.792004595e-05,4.928695853e-05, 0.000113223643,3.463240137e-05,-0.0001766575297,
-	-0.0004052484874,-0.0005584472092,-0.0007434131112,0.0003018065181
-};
+	Key key(std::make_pair(phases, tapsPerPhase), std::make_pair(cutoff, gain));
+	std::map<Key, std::shared_ptr<FilterBank> >::const_iterator it = cache.find(key);
+	if(it != cache.end()) {
+		if(fixedPoint && it->second->fixedTaps.empty())
+			createFixedTaps(phases, tapsPerPhase, gain, it->second.get());
+		if((fftSize > 0) && !it->second->spectrum)
+			it->second->spectrum = FFTFilter::createSpectrum(it->second->taps, tapsPerPhase, fftSize);
+		return it->second;
+	}
 
-static const float H36[1024] = {
-	0.0005905388971,-0.0003641271614,-0.000499689253,-0.0005347579136,-0.0003850177745,
-	-0.0001450531709,1.641529889e-05,1.627423262e-05,-7.170504978e-05, -0.00011122258,
-	-4.505738616e-05, 5.29406534e-05,7.557011122e-05, 2.84257294e-06,-7.54884968e-05,
-	-6.805841986e-05,1.749719377e-05,8.183252794e-05,5.170571239e-05,-3.952931365e-05,
-	-8.607961354e-05,-3.425783871e-05,5.883491758e-05,8.441921091e-05,1.414795315e-05,
-	-7.452661521e-05,-7.895200542e-05,7.394547993e-06,8.728737885e-05,6.831986684e-05,
-	-2.944242806e-05,-9.586538363e-05,-5.334779416e-05,5.119756315e-05,9.967325605e-05,
-	3.454418038e-05,-7.145996642e-05,-9.827371832e-05,-1.266563868e-05,8.921299741e-05,
-	9.154690633e-05,-1.140228323e-05,-0.0001034044981,-7.933899906e-05,3.659988215e-05,
-	0.0001128610675,6.209711137e-05,-6.138085155e-05,-0.000117183743,-4.025908856e-05,
-	8.475525101e-05,0.0001154139682,1.488289035e-05,-0.0001052793887,-0.0001074057072,
-	1.308951869e-05,0.0001216516685,9.318898083e-05,-4.22685589e-05,-0.0001327423088,
-	-7.308136264e-05,7.128496509e-05,0.0001376743749,4.772210013e-05,-9.855493408e-05,
-	-0.0001356507564,-1.808929119e-05,0.0001224726147, 0.000126442188,-1.446924125e-05,
-	-0.0001417053281,-0.0001099177025,4.851854101e-05,0.0001547508873,8.661160246e-05,
-	-8.234714915e-05,-0.0001605661964,-5.720230547e-05,0.0001140948152,0.0001583960548,
-	2.290409429e-05,-0.0001419598848,-0.0001478009799,1.484474251e-05,0.0001642168791,
-	0.0001287335763,-5.428454097e-05,-0.000179314331,-0.0001016987298,9.344553109e-05,
-	0.0001860957709,6.759718963e-05,-0.0001303743629,-0.000183688564,-2.788083475e-05,
-	0.0001628338796,0.0001717245468,-1.569002598e-05,-0.0001887601247,-0.0001500806393,
-	6.104739441e-05, 0.000206365512,0.0001191771225,-0.0001061262592,-0.0002143096935,
-	-8.003920084e-05,0.0001486655819,0.0002117796976,3.446616756e-05,-0.0001861083438,
-	-0.0001982687536, 1.54520385e-05,0.0002160195145,0.0001735493424,-6.757833034e-05,
-	-0.0002363853564,-0.0001381572947,0.0001195363802,0.0002459540556,9.358904936e-05,
-	-0.00016836953,-0.0002434787893,-4.177490337e-05,0.0002111386275,0.0002280607587,
-	-1.535800038e-05,-0.0002454669739,-0.000199827191,7.521353837e-05,0.0002693216084,
-	0.000159898409,-0.0001344265038,-0.0002805306576,-0.0001094410836,0.0001899531635,
-	0.0002776384063,5.019177479e-05,-0.0002390755981,-0.0002604829206,1.482611242e-05,
-	0.0002785819233,0.0002289581898,-8.252338739e-05,-0.0003056730784,-0.0001835852017,
-	0.00015002492,0.0003187385446,0.0001263941522,-0.0002134230308,-0.0003161136119,
-	-5.967751713e-05,0.0002690597903,0.0002967792389,-1.407313448e-05,-0.0003141633642,
-	-0.0002613585675,9.090836829e-05,0.0003453820245, 0.000210535145,-0.000167128077,
-	-0.0003603222431,-0.0001458943443,0.0002391243615,0.0003577954194,7.061313954e-05,
-	-0.0003023722093,-0.0003364739532,1.248932222e-05,0.0003534919233, 0.000296701648,
-	-9.940290329e-05,-0.0003892770328,-0.0002398064244,0.0001854518487,0.0004065718094,
-	0.0001672309299,-0.0002667963854,-0.000404177903,-8.258577145e-05,0.0003383370931,
-	0.0003806313907,-1.086426437e-05,-0.000396258547,-0.0003362993011,0.0001086370685,
-	0.0004368962254,0.0002725976519,-0.0002056122321,-0.0004568669247,-0.0001912988228,
-	0.0002973127121,0.0004547682765,9.649268031e-05,-0.0003779193794,-0.0004287156044,
-	8.508684004e-06,0.0004435960727,0.0003796961391,-0.0001179771571,-0.0004894019221,
-	-0.0003083291231,0.0002272248385,0.0005127064651,0.0002178682334,-0.0003299608361,
-	-0.0005105888704,-0.0001115096602,0.0004210147017,0.0004822996852,-5.712817256e-06,
-	-0.0004947896232,-0.000427681196,0.0001285630715,0.0005469092866,0.0003485073685,
-	-0.0002508066536,-0.0005734758452,-0.0002475582587, 0.000366158114,0.0005718821194,
-	0.0001289768115,-0.0004683177685,-0.0005408081342,2.042673486e-06,0.0005514519289,
-	0.0004804766504,-0.0001393187413,-0.0006103418418,-0.0003925946658, 0.000276052655,
-	0.0006407342153,0.0002802888339,-0.0004052138247,-0.0006396963727,-0.0001481662766,
-	0.0005198307917,0.0006058021099,2.065210083e-06,-0.000613315322,-0.0005392582971,
-	0.0001510962611,0.0006797497044,0.0004418127355,-0.0003038829309,-0.0007145125419,
-	-0.0003170476994,0.0004484059464,0.0007143075345,0.0001700939174,-0.000576819526,
-	-0.0006774647627,-7.447743428e-06,0.0006817151443,0.0006040474982,-0.0001633786014,
-	-0.00075670355,-0.0004962142557,0.0003339164541,0.0007964404067,0.0003578094475,
-	-0.0004954068572,-0.0007972134626,-0.0001944753021,0.0006391507341,0.0007571419119,
-	1.339950359e-05,-0.0007569794543,-0.0006764191203,0.0001768749207,0.0008415178163,
-	0.0005571660004,-0.0003671041923,-0.0008869009907,-0.0004036777827,0.0005475585931,
-	0.0008890092722,0.0002222944604,-0.0007084404933,-0.0008456074283,-2.090373891e-05,
-	0.0008406336419,0.0007567906869,-0.0001911149884,-0.0009360486292,-0.0006250247243,
-	0.0004033269943,0.0009879759746,0.0004549630103,-0.0006049134536,-0.0009916984709,
-	-0.0002534657251,0.0007851117407,0.0009448226774,2.944488915e-05,-0.0009335903451,
-	-0.000847262796,0.0002067612659, 0.001041284064,0.0007016185555,-0.000443675468,
-	-0.001100802328,-0.0005131381331, 0.000669074594, 0.001106646028,0.0002892634948,
-	-0.0008710362017,-0.001056071604,-3.983190254e-05, 0.001038067392,0.0009489650256,
-	-0.0002235962311,-0.001159889274,-0.0007880077465,0.0004883052898, 0.001228164067,
-	0.0005788810086,-0.0007407838129,-0.001236785785,-0.0003299331001,0.0009675303008,
-	0.001182381879,5.187221541e-05,-0.001155798323,-0.001064760727,0.0002423979313,
-	0.001293976209,0.0008867324213,-0.000538732158,-0.001372592174,-0.0006544245407,
-	0.0008221214521, 0.001384736039, 0.000377058197,-0.001077401219,-0.001326420344,
-	-6.647661939e-05, 0.001290212269, 0.001197165926,-0.0002630731906,-0.001447515562,
-	-0.0009999552276,0.0005957788089, 0.001538499957,0.0007413844578,-0.0009148811223,
-	-0.001555230701,-0.0004316150444, 0.001203303225, 0.001492922544, 8.36648469e-05,
-	-0.001444894471,-0.001350781182,0.0002866339055,  0.00162486895, 0.001131855533,
-	-0.0006616056198,-0.001730836579,-0.0008432450122, 0.001022444805, 0.001753553515,
-	0.0004960221122,-0.001349957543,-0.001687328564,-0.0001045960671,  0.00162582437,
-	0.001530875568,-0.0003133767168,-0.001833091374,-0.001287124818,0.0007382102776,
-	0.001957555534,0.0009637268377,-0.001148651354,-0.001988281263,-0.0005726593663,
-	0.001523066196, 0.001918450231, 0.000129958964,-0.001840433106,-0.001745938323,
-	0.0003447927011, 0.002081294311, 0.001473467448,-0.0008295281441,-0.002229171339,
-	-0.001109211356, 0.001300049014, 0.002270869445,0.0006659660139, -0.00173190143,
-	-0.002198139671,-0.0001616175141, 0.002100706799, 0.002007542877,-0.0003822029394,
-	-0.002384084044,-0.001701569883,0.0009403197328, 0.002562224166, 0.001288282685,
-	-0.001485588029,-0.002619570354,-0.0007817904698, 0.001989562064, 0.002545309253,
-	0.0002014775964,-0.002424175618,-0.002334521385, 0.000428289437, 0.002762842225,
-	0.001988544827,-0.001079240115,-0.002981999889,-0.001515484182,  0.00172009063,
-	0.003062224714,0.0009300786769,-0.002317989944,-0.002989534521,-0.0002535584208,
-	0.002839836292, 0.002756326925,-0.000486955134,-0.003253791248, -0.00236207433,
-	0.001259410055, 0.003530945396, 0.001813986572,-0.002027763054,-0.003646643367,
-	-0.001127047115, 0.002753461245, 0.003581953235,0.0003239081125,-0.003396957414,
-	-0.003324889112,0.0005655817222, 0.003919401206, 0.002871476347,-0.001505046035,
-	-0.004284160677,-0.002226231853,  0.00245297607, 0.004458896816, 0.001402969821,
-	-0.003363665892,-0.004416740034,-0.0004244652227, 0.004189161118, 0.004138123244,
-	-0.0006774966023,-0.004880710971,-0.003611826338, 0.001862897305, 0.005390705075,
-	0.002836106345,-0.003084227676,-0.005674282089,-0.001819175319, 0.004287891556,
-	0.005691296887,0.0005798603524,-0.005415233783,-0.005407541525,0.0008526612073,
-	0.006404225715, 0.004796164576,-0.002439051867,-0.007190833334,-0.003838591743,
-	0.004130289424, 0.007710102946, 0.002524744021,-0.005868668668,-0.007897258736,
-	-0.000853134261, 0.007588334382, 0.007687563542,-0.001170316595,-0.009216158651,
-	-0.007015462499, 0.003534046235,  0.01067169383, 0.005811426323,-0.006224326324,
-	-0.01186609548,-0.003995344508, 0.009231099859,  0.01269864663, 0.001463482273,
-	-0.01255791355, -0.01304805931, 0.001938030473,  0.01624074206,  0.01275285706,
-	-0.006469146814,  -0.0203865096,   -0.011564455,  0.01262711827,  0.02526470274,
-	0.009024103172, -0.02150200307,  -0.0315682292,-0.004075495992,  0.03598403558,
-	0.04139101878,-0.006593876984, -0.06679518521,  -0.0642208457,  0.04216020554,
-	0.210882023,   0.3386032581,   0.3386032581,    0.210882023,  0.04216020554,
-	-0.0642208457, -0.06679518521,-0.006593876984,  0.04139101878,  0.03598403558,
-	-0.004075495992,  -0.0315682292, -0.02150200307, 0.009024103172,  0.02526470274,
-	0.01262711827,   -0.011564455,  -0.0203865096,-0.006469146814,  0.01275285706,
-	0.01624074206, 0.001938030473, -0.01304805931, -0.01255791355, 0.001463482273,
-	0.01269864663, 0.009231099859,-0.003995344508, -0.01186609548,-0.006224326324,
-	0.005811426323,  0.01067169383, 0.003534046235,-0.007015462499,-0.009216158651,
-	-0.001170316595, 0.007687563542, 0.007588334382,-0.000853134261,-0.007897258736,
-	-0.005868668668, 0.002524744021, 0.007710102946, 0.004130289424,-0.003838591743,
-	-0.007190833334,-0.002439051867, 0.004796164576, 0.006404225715,0.0008526612073,
-	-0.005407541525,-0.005415233783,0.0005798603524, 0.005691296887, 0.004287891556,
-	-0.001819175319,-0.005674282089,-0.003084227676, 0.002836106345, 0.005390705075,
-	0.001862897305,-0.003611826338,-0.004880710971,-0.0006774966023, 0.004138123244,
-	0.004189161118,-0.0004244652227,-0.004416740034,-0.003363665892, 0.001402969821,
-	0.004458896816,  0.00245297607,-0.002226231853,-0.004284160677,-0.001505046035,
-	0.002871476347, 0.003919401206,0.0005655817222,-0.003324889112,-0.003396957414,
-	0.0003239081125, 0.003581953235, 0.002753461245,-0.001127047115,-0.003646643367,
-	-0.002027763054, 0.001813986572, 0.003530945396, 0.001259410055, -0.00236207433,
-	-0.003253791248,-0.000486955134, 0.002756326925, 0.002839836292,-0.0002535584208,
-	-0.002989534521,-0.002317989944,0.0009300786769, 0.003062224714,  0.00172009063,
-	-0.001515484182,-0.002981999889,-0.001079240115, 0.001988544827, 0.002762842225,
-	0.000428289437,-0.002334521385,-0.002424175618,0.0002014775964, 0.002545309253,
-	0.001989562064,-0.0007817904698,-0.002619570354,-0.001485588029, 0.001288282685,
-	0.002562224166,0.0009403197328,-0.001701569883,-0.002384084044,-0.0003822029394,
-	0.002007542877, 0.002100706799,-0.0001616175141,-0.002198139671, -0.00173190143,
-	0.0006659660139, 0.002270869445, 0.001300049014,-0.001109211356,-0.002229171339,
-	-0.0008295281441, 0.001473467448, 0.002081294311,0.0003447927011,-0.001745938323,
-	-0.001840433106, 0.000129958964, 0.001918450231, 0.001523066196,-0.0005726593663,
-	-0.001988281263,-0.001148651354,0.0009637268377, 0.001957555534,0.0007382102776,
-	-0.001287124818,-0.001833091374,-0.0003133767168, 0.001530875568,  0.00162582437,
-	-0.0001045960671,-0.001687328564,-0.001349957543,0.0004960221122, 0.001753553515,
-	0.001022444805,-0.0008432450122,-0.001730836579,-0.0006616056198, 0.001131855533,
-	0.00162486895,0.0002866339055,-0.001350781182,-0.001444894471, 8.36648469e-05,
-	0.001492922544, 0.001203303225,-0.0004316150444,-0.001555230701,-0.0009148811223,
-	0.0007413844578, 0.001538499957,0.0005957788089,-0.0009999552276,-0.001447515562,
-	-0.0002630731906, 0.001197165926, 0.001290212269,-6.647661939e-05,-0.001326420344,
-	-0.001077401219, 0.000377058197, 0.001384736039,0.0008221214521,-0.0006544245407,
-	-0.001372592174,-0.000538732158,0.0008867324213, 0.001293976209,0.0002423979313,
-	-0.001064760727,-0.001155798323,5.187221541e-05, 0.001182381879,0.0009675303008,
-	-0.0003299331001,-0.001236785785,-0.0007407838129,0.0005788810086, 0.001228164067,
-	0.0004883052898,-0.0007880077465,-0.001159889274,-0.0002235962311,0.0009489650256,
-	0.001038067392,-3.983190254e-05,-0.001056071604,-0.0008710362017,0.0002892634948,
-	0.001106646028, 0.000669074594,-0.0005131381331,-0.001100802328,-0.000443675468,
-	0.0007016185555, 0.001041284064,0.0002067612659,-0.000847262796,-0.0009335903451,
-	2.944488915e-05,0.0009448226774,0.0007851117407,-0.0002534657251,-0.0009916984709,
-	-0.0006049134536,0.0004549630103,0.0009879759746,0.0004033269943,-0.0006250247243,
-	-0.0009360486292,-0.0001911149884,0.0007567906869,0.0008406336419,-2.090373891e-05,
-	-0.0008456074283,-0.0007084404933,0.0002222944604,0.0008890092722,0.0005475585931,
-	-0.0004036777827,-0.0008869009907,-0.0003671041923,0.0005571660004,0.0008415178163,
-	0.0001768749207,-0.0006764191203,-0.0007569794543,1.339950359e-05,0.0007571419119,
-	0.0006391507341,-0.0001944753021,-0.0007972134626,-0.0004954068572,0.0003578094475,
-	0.0007964404067,0.0003339164541,-0.0004962142557, -0.00075670355,-0.0001633786014,
-	0.0006040474982,0.0006817151443,-7.447743428e-06,-0.0006774647627,-0.000576819526,
-	0.0001700939174,0.0007143075345,0.0004484059464,-0.0003170476994,-0.0007145125419,
-	-0.0003038829309,0.0004418127355,0.0006797497044,0.0001510962611,-0.0005392582971,
-	-0.000613315322,2.065210083e-06,0.0006058021099,0.0005198307917,-0.0001481662766,
-	-0.0006396963727,-0.0004052138247,0.0002802888339,0.0006407342153, 0.000276052655,
-	-0.0003925946658,-0.0006103418418,-0.0001393187413,0.0004804766504,0.0005514519289,
-	2.042673486e-06,-0.0005408081342,-0.0004683177685,0.0001289768115,0.0005718821194,
-	0.000366158114,-0.0002475582587,-0.0005734758452,-0.0002508066536,0.0003485073685,
-	0.0005469092866,0.0001285630715,-0.000427681196,-0.0004947896232,-5.712817256e-06,
-	0.0004822996852,0.0004210147017,-0.0001115096602,-0.0005105888704,-0.0003299608361,
-	0.0002178682334,0.0005127064651,0.0002272248385,-0.0003083291231,-0.0004894019221,
-	-0.0001179771571,0.0003796961391,0.0004435960727,8.508684004e-06,-0.0004287156044,
-	-0.0003779193794,9.649268031e-05,0.0004547682765,0.0002973127121,-0.0001912988228,
-	-0.0004568669247,-0.0002056122321,0.0002725976519,0.0004368962254,0.0001086370685,
-	-0.0003362993011,-0.000396258547,-1.086426437e-05,0.0003806313907,0.0003383370931,
-	-8.258577145e-05,-0.000404177903,-0.0002667963854,0.0001672309299,0.0004065718094,
-	0.0001854518487,-0.0002398064244,-0.0003892770328,-9.940290329e-05, 0.000296701648,
-	0.0003534919233,1.248932222e-05,-0.0003364739532,-0.0003023722093,7.061313954e-05,
-	0.0003577954194,0.0002391243615,-0.0001458943443,-0.0003603222431,-0.000167128077,
-	0.000210535145,0.0003453820245,9.090836829e-05,-0.0002613585675,-0.0003141633642,
-	-1.407313448e-05,0.0002967792389,0.0002690597903,-5.967751713e-05,-0.0003161136119,
-	-0.0002134230308,0.0001263941522,0.0003187385446,  0.00015002492,-0.0001835852017,
-	-0.0003056730784,-8.252338739e-05,0.0002289581898,0.0002785819233,1.482611242e-05,
-	-0.0002604829206,-0.0002390755981,5.019177479e-05,0.0002776384063,0.0001899531635,
-	-0.0001094410836,-0.0002805306576,-0.0001344265038, 0.000159898409,0.0002693216084,
-	7.521353837e-05,-0.000199827191,-0.0002454669739,-1.535800038e-05,0.0002280607587,
-	0.0002111386275,-4.177490337e-05,-0.0002434787893, -0.00016836953,9.358904936e-05,
-	0.0002459540556,0.0001195363802,-0.0001381572947,-0.0002363853564,-6.757833034e-05,
-	0.0001735493424,0.0002160195145, 1.54520385e-05,-0.0001982687536,-0.0001861083438,
-	3.446616756e-05,0.0002117796976,0.0001486655819,-8.003920084e-05,-0.0002143096935,
-	-0.0001061262592,0.0001191771225, 0.000206365512,6.104739441e-05,-0.0001500806393,
-	-0.0001887601247,-1.569002598e-05,0.0001717245468,0.0001628338796,-2.788083475e-05,
-	-0.000183688564,-0.0001303743629,6.759718963e-05,0.0001860957709,9.344553109e-05,
-	-0.0001016987298,-0.000179314331,-5.428454097e-05,0.0001287335763,0.0001642168791,
-	1.484474251e-05,-0.0001478009799,-0.0001419598848,2.290409429e-05,0.0001583960548,
-	0.0001140948152,-5.720230547e-05,-0.0001605661964,-8.234714915e-05,8.661160246e-05,
-	0.0001547508873,4.851854101e-05,-0.0001099177025,-0.0001417053281,-1.446924125e-05,
-	0.000126442188,0.0001224726147,-1.808929119e-05,-0.0001356507564,-9.855493408e-05,
-	4.772210013e-05,0.0001376743749,7.128496509e-05,-7.308136264e-05,-0.0001327423088,
-	-4.22685589e-05,9.318898083e-05,0.0001216516685,1.308951869e-05,-0.0001074057072,
-	-0.0001052793887,1.488289035e-05,0.0001154139682,8.475525101e-05,-4.025908856e-05,
-	-0.000117183743,-6.138085155e-05,6.209711137e-05,0.0001128610675,3.659988215e-05,
-	-7.933899906e-05,-0.0001034044981,-1.140228323e-05,9.154690633e-05,8.921299741e-05,
-	-1.266563868e-05,-9.827371832e-05,-7.145996642e-05,3.454418038e-05,9.967325605e-05,
-	5.119756315e-05,-5.334779416e-05,-9.586538363e-05,-2.944242806e-05,6.831986684e-05,
-	8.728737885e-05,7.394547993e-06,-7.895200542e-05,-7.452661521e-05,1.414795315e-05,
-	8.441921091e-05,5.883491758e-05,-3.425783871e-05,-8.607961354e-05,-3.952931365e-05,
-	5.170571239e-05,8.183252794e-05,1.749719377e-05,-6.805841986e-05,-7.54884968e-05,
-	2.84257294e-06,7.557011122e-05, 5.29406534e-05,-4.505738616e-05, -0.00011122258,
-	-7.170504978e-05,1.627423262e-05,1.641529889e-05,-0.0001450531709,-0.0003850177745,
-	-0.0005347579136,-0.000499689253,-0.0003641271614,0.0005905388971
-};
+	qDebug("designing filter with %d phases x %d taps, cutoff %f", phases, tapsPerPhase, cutoff);
+	std::vector<Real> taps;
+	createTaps(phases * tapsPerPhase, phases, cutoff, &taps);
+	for(size_t i = 1; i < taps.size(); ++i) {
+		if(taps[i] != taps[taps.size() - i])
+			qWarning("SSEInterpolator: prototype filter is not symmetric at tap %u", (uint)i);
+	}
 
-static const float H38[1024] = {
-	0.00096172333,0.0003813452495,0.0001490127179,-0.0001035427704,-0.0001843571517,
-	-8.438104851e-05, 3.75177151e-05,3.619483687e-05,-6.655700417e-05,-0.0001323328179,
-	-8.001248352e-05,1.702311965e-05,3.614216985e-05,-4.431238631e-05,-0.000119467637,
-	-9.23929183e-05,2.511447974e-06,4.578796143e-05,-1.734108446e-05,-0.0001065969191,
-	-0.0001079113354, -1.7928136e-05, 5.16119253e-05,1.275871364e-05,-8.643660112e-05,
-	-0.0001206186062,-4.437091411e-05,4.865460869e-05,4.178728705e-05,-5.804152897e-05,
-	-0.0001254189992, -7.4106385e-05,3.477992868e-05,6.505964848e-05,-2.233605301e-05,
-	-0.0001192910204,-0.000102502825,9.598833458e-06,7.843365165e-05,1.601119584e-05,
-	-0.0001008783729,-0.0001258179545,-2.390295958e-05, 7.94587977e-05,5.491615593e-05,
-	-6.942930486e-05,-0.0001381355542,-6.314468192e-05, 6.51422888e-05,8.616645209e-05,
-	-2.820316877e-05,-0.0001368883386,-0.0001018377225,3.612305591e-05,0.0001061881485,
-	1.851668276e-05,-0.0001192596465, -0.00013448752,-4.386589808e-06, 0.000110456429,
-	6.570416735e-05,-8.584599709e-05,-0.0001548430009,-5.237677033e-05,9.701606177e-05,
-	0.0001062056035,-3.883823956e-05,-0.0001587419683,-0.0001011841305,6.526187644e-05,
-	0.0001340284362,1.629456347e-05,-0.000143044439,-0.0001442520006,1.828938548e-05,
-	0.0001433801517,7.333846588e-05,-0.0001078636124,-0.0001737487182,-3.896989438e-05,
-	0.000131691806,0.0001239342528,-5.566308027e-05,-0.0001847654494,-9.91378547e-05,
-	9.78478929e-05,0.0001611725893, 8.21130925e-06,-0.0001723882015,-0.0001539814548,
-	4.503790842e-05,0.0001777664147,7.636254304e-05,-0.000136492934,-0.0001945951954,
-	-2.174492511e-05,0.0001697781263,0.0001391742408,-7.902795915e-05,-0.000214147949,
-	-9.389661136e-05,0.0001354093838,0.0001879168267,-6.136674983e-06,-0.0002069810871,
-	-0.0001621334231,7.736908447e-05,0.0002138978743,7.411937986e-05,-0.0001716916304,
-	-0.0002158263378,1.056032147e-06,0.0002117003751,0.0001508175337, -0.00010980972,
-	-0.0002463571727,-8.41957517e-05, 0.000178265982,0.0002132648078,-2.777670124e-05,
-	-0.0002464619756,-0.0001674740342,0.0001159834792,0.0002510730119,6.549920363e-05,
-	-0.0002136189141,-0.0002365702821,3.014401045e-05,0.0002569693315, 0.000157679111,
-	-0.0001485329558,-0.0002806531265,-6.885645416e-05, 0.000226714139,0.0002363452513,
-	-5.75558588e-05,-0.0002906079462,-0.0001688158081,0.0001616100781,0.0002888187009,
-	4.954136239e-05,-0.0002622459142,-0.0002554379753, 6.70151785e-05,0.0003057929571,
-	0.0001589800086,-0.0001954359759,-0.0003157872707,-4.618815001e-05,0.0002812196035,
-	0.00025621854,-9.625581879e-05,-0.0003385709133,-0.0001643297728,0.0002151858207,
-	0.0003263504186,2.503024007e-05,-0.0003174696758,-0.0002709992987,0.0001126517236,
-	0.0003574905277,0.0001531225134,-0.0002510729537,-0.0003507274378,-1.49432035e-05,
-	0.0003415968386,0.0002714519796,-0.0001447979594,-0.0003896379785,-0.000152596258,
-	0.0002770267893,0.0003623832017,-9.388840226e-06,-0.0003790838236,-0.0002817502827,
-	0.0001680529822,0.0004113453033,0.0001386819204,-0.0003157356696,-0.0003841277794,
-	2.626700734e-05,0.0004076162295,0.0002805091208,-0.000204064534,-0.0004429150431,
-	-0.0001319749426,0.0003475131525,0.0003956860746,-5.490627882e-05,-0.0004465782549,
-	-0.0002859430679,0.0002341457439,0.0004664243606,0.0001140875756,-0.0003895894915,
-	-0.0004144510021,7.888027176e-05, 0.000478930684,0.0002817978384,-0.0002748232801,
-	-0.0004972479073,-0.0001007387182,0.0004269074998,0.0004247440665,-0.000112911388,
-	-0.0005194807891,-0.0002818119247,0.0003118010645,0.0005216161371,7.764999464e-05,
-	-0.0004726902116,-0.0004399182799,0.0001444458321,0.0005550213973,0.0002734600275,
-	-0.000357826415,-0.0005511983181,-5.687673547e-05,0.0005154125975,0.0004478508199,
-	-0.0001847064705,-0.0005968398764,-0.0002671168477,0.0004019497137,0.0005755189341,
-	2.753567605e-05,-0.0005649319501,-0.0004585282877,0.0002243673225,0.0006349516334,
-	0.0002533750667,-0.0004537384666,-0.0006031480152,1.481372919e-06,0.0006127743982,
-	0.0004628715687, -0.00027175594,-0.0006777321105,-0.0002397913195,0.0005051113549,
-	0.0006263514515,-3.828044646e-05,-0.0006661448861,-0.000468198763,  0.00032003448,
-	0.0007176320069,0.0002192638203,-0.0005632623797,-0.0006513759727,7.630141045e-05,
-	0.0007187100709,0.0004675326054,-0.0003755354846,-0.0007609759341,-0.0001974031184,
-	0.0006220073556,0.0006722374819,-0.000121892328,-0.0007759677246,-0.0004664428416,
-	0.0004330587108,0.0008018491208,0.0001686425385,-0.0006869637873,-0.0006936845602,
-	0.0001699883724,0.0008329687407,0.0004593596968,-0.0004975598422,-0.0008451073081,
-	-0.0001372011029,0.0007533266908,0.0007109652506,-0.000225657408,-0.000893937482,
-	-0.0004504734534,0.0005651302054,0.0008860961534,9.864040476e-05,-0.0008255190914,
-	-0.0007276734104,0.0002850554592,0.0009550246177,0.0004353489203,-0.0006396381068,
-	-0.0009284898988,-5.608283391e-05,  0.00089980755,0.0007399931201,-0.0003522495099,
-	-0.001019459567,-0.0004170810862,0.0007181726396,0.0009686165722,5.985014923e-06,
-	-0.000979633769,-0.0007505234098,0.0004244410375, 0.001084321178,0.0003921296448,
-	-0.0008037665975,-0.001009194064,4.950173752e-05, 0.001062260824,0.0007563147228,
-	-0.0005048337043, -0.00115197117,-0.0003626080288,0.0008944297442, 0.001047419966,
-	-0.0001131736717,-0.001150277094,-0.0007590613095,0.0005915957736,  0.00122027332,
-	0.0003256764903,-0.0009925272316,-0.001085150056,0.0001837786695, 0.001241812017,
-	0.0007564448169,-0.0006873200764,-0.001290950226,-0.0002826430718, 0.001096798573,
-	0.001120213652,-0.0002636313147,-0.001338862348,-0.0007494795136,0.0007909330307,
-	0.001362423063,0.0002311076532, -0.00120922213,-0.001153868972,0.0003521516337,
-	0.001440181979,0.0007362181786,-0.0009046974592,-0.001435964368,-0.0001716698607,
-	0.001329201506, 0.001184406923,-0.0004514366447,-0.001547427964,-0.0007170925383,
-	0.001028276747, 0.001510499977,0.0001021741555,-0.001458526705, -0.00121258595,
-	0.0005615911214,  0.00165994186,0.0006903549074,-0.001163836685,-0.001586991944,
-	-2.255180516e-05, 0.001597193535, 0.001236922224,-0.0006848317571,-0.001779291662,
-	-0.0006559486501, 0.001311740372, 0.001664674259,-6.947489601e-05,-0.001747187227,
-	-0.001257884782,0.0008218794246, 0.001905268407,0.0006119749742,-0.001474506105,
-	-0.0017444978, 0.000174590692, 0.001909097657, 0.001274013659,-0.0009754577186,
-	-0.002039672108,-0.0005579115241, 0.001653294894, 0.001825924497,-0.0002955752134,
-	-0.00208545546,-0.001285481849, 0.001147225033,  0.00218292349,0.0004914858728,
-	-0.001851391396,-0.001909968094,0.0004341006279, 0.002277862281, 0.001290808199,
-	-0.001340834657,-0.002337295096,-0.0004113797331, 0.002071336145, 0.001996510662,
-	-0.000593844743,-0.002489809878,-0.001289689913, 0.001559569966, 0.002504249336,
-	0.0003145731462,-0.002317892853,-0.002086766995,0.0007781742024, 0.002724653808,
-	0.001280468889, -0.00180893857, -0.00268708542,-0.0001983669063, 0.002596078441,
-	0.002181272488,-0.0009926824132,-0.002987942426,-0.001262136619, 0.002095223637,
-	0.002889152151, 5.81838176e-05,-0.002913690871,-0.002281738911, 0.001243931125,
-	0.003286353778, 0.001232456532, -0.00242782291,-0.003115974599, 0.000111385838,
-	0.003280621488, 0.002389849396,-0.001541725593,-0.003629888408,-0.001189127914,
-	0.002819168381, 0.003374646418,-0.0003185314999,-0.003711531172,-0.002508697798,
-	0.001899298746, 0.004032264464, 0.001128315344,-0.003287692787,-0.003676072694,
-	0.0005745116505, 0.004227202386, 0.002642314881,-0.002336676698,-0.004514364991,
-	-0.001044971985, 0.003860372119, 0.004036153201,-0.0008967437316,-0.004859704524,
-	-0.002797478577, 0.002883940237, 0.005107903387,0.0009308565641,-0.004579731729,
-	-0.004480393138, 0.001312186476, 0.005659549497, 0.002984642517,-0.003589999396,
-	-0.005864861421,-0.0007729831268, 0.005515485071, 0.005050874315, -0.00186632527,
-	-0.006712525617,-0.003222102532, 0.004538624082, 0.006875284016, 0.000548338925,
-	-0.006791516207,-0.005823391024, 0.002641208936, 0.008175618015, 0.003543637227,
-	-0.005887374748,-0.008310862817,-0.0002129282075, 0.008649926633, 0.006948304828,
-	-0.003802480642, -0.01037095208,-0.004020032473, 0.007970612496,  0.01054307446,
-	-0.0003305674763, -0.01163710933,-0.008772836067, 0.005741191097,  0.01407891512,
-	0.004827428143, -0.01164500695, -0.01455356926, 0.001347524929,  0.01729872264,
-	0.01231780555,-0.009655945934, -0.02180270106,-0.006559856236,  0.01996052824,
-	0.02405599877,-0.003912120126, -0.03238756955, -0.02244775183,  0.02185972966,
-	0.04837008938,  0.01326816902, -0.05765677989, -0.07671914995,  0.02284820564,
-	0.207721144,   0.3553694785,   0.3553694785,    0.207721144,  0.02284820564,
-	-0.07671914995, -0.05765677989,  0.01326816902,  0.04837008938,  0.02185972966,
-	-0.02244775183, -0.03238756955,-0.003912120126,  0.02405599877,  0.01996052824,
-	-0.006559856236, -0.02180270106,-0.009655945934,  0.01231780555,  0.01729872264,
-	0.001347524929, -0.01455356926, -0.01164500695, 0.004827428143,  0.01407891512,
-	0.005741191097,-0.008772836067, -0.01163710933,-0.0003305674763,  0.01054307446,
-	0.007970612496,-0.004020032473, -0.01037095208,-0.003802480642, 0.006948304828,
-	0.008649926633,-0.0002129282075,-0.008310862817,-0.005887374748, 0.003543637227,
-	0.008175618015, 0.002641208936,-0.005823391024,-0.006791516207, 0.000548338925,
-	0.006875284016, 0.004538624082,-0.003222102532,-0.006712525617, -0.00186632527,
-	0.005050874315, 0.005515485071,-0.0007729831268,-0.005864861421,-0.003589999396,
-	0.002984642517, 0.005659549497, 0.001312186476,-0.004480393138,-0.004579731729,
-	0.0009308565641, 0.005107903387, 0.002883940237,-0.002797478577,-0.004859704524,
-	-0.0008967437316, 0.004036153201, 0.003860372119,-0.001044971985,-0.004514364991,
-	-0.002336676698, 0.002642314881, 0.004227202386,0.0005745116505,-0.003676072694,
-	-0.003287692787, 0.001128315344, 0.004032264464, 0.001899298746,-0.002508697798,
-	-0.003711531172,-0.0003185314999, 0.003374646418, 0.002819168381,-0.001189127914,
-	-0.003629888408,-0.001541725593, 0.002389849396, 0.003280621488, 0.000111385838,
-	-0.003115974599, -0.00242782291, 0.001232456532, 0.003286353778, 0.001243931125,
-	-0.002281738911,-0.002913690871, 5.81838176e-05, 0.002889152151, 0.002095223637,
-	-0.001262136619,-0.002987942426,-0.0009926824132, 0.002181272488, 0.002596078441,
-	-0.0001983669063, -0.00268708542, -0.00180893857, 0.001280468889, 0.002724653808,
-	0.0007781742024,-0.002086766995,-0.002317892853,0.0003145731462, 0.002504249336,
-	0.001559569966,-0.001289689913,-0.002489809878,-0.000593844743, 0.001996510662,
-	0.002071336145,-0.0004113797331,-0.002337295096,-0.001340834657, 0.001290808199,
-	0.002277862281,0.0004341006279,-0.001909968094,-0.001851391396,0.0004914858728,
-	0.00218292349, 0.001147225033,-0.001285481849, -0.00208545546,-0.0002955752134,
-	0.001825924497, 0.001653294894,-0.0005579115241,-0.002039672108,-0.0009754577186,
-	0.001274013659, 0.001909097657, 0.000174590692,  -0.0017444978,-0.001474506105,
-	0.0006119749742, 0.001905268407,0.0008218794246,-0.001257884782,-0.001747187227,
-	-6.947489601e-05, 0.001664674259, 0.001311740372,-0.0006559486501,-0.001779291662,
-	-0.0006848317571, 0.001236922224, 0.001597193535,-2.255180516e-05,-0.001586991944,
-	-0.001163836685,0.0006903549074,  0.00165994186,0.0005615911214, -0.00121258595,
-	-0.001458526705,0.0001021741555, 0.001510499977, 0.001028276747,-0.0007170925383,
-	-0.001547427964,-0.0004514366447, 0.001184406923, 0.001329201506,-0.0001716698607,
-	-0.001435964368,-0.0009046974592,0.0007362181786, 0.001440181979,0.0003521516337,
-	-0.001153868972, -0.00120922213,0.0002311076532, 0.001362423063,0.0007909330307,
-	-0.0007494795136,-0.001338862348,-0.0002636313147, 0.001120213652, 0.001096798573,
-	-0.0002826430718,-0.001290950226,-0.0006873200764,0.0007564448169, 0.001241812017,
-	0.0001837786695,-0.001085150056,-0.0009925272316,0.0003256764903,  0.00122027332,
-	0.0005915957736,-0.0007590613095,-0.001150277094,-0.0001131736717, 0.001047419966,
-	0.0008944297442,-0.0003626080288, -0.00115197117,-0.0005048337043,0.0007563147228,
-	0.001062260824,4.950173752e-05,-0.001009194064,-0.0008037665975,0.0003921296448,
-	0.001084321178,0.0004244410375,-0.0007505234098,-0.000979633769,5.985014923e-06,
-	0.0009686165722,0.0007181726396,-0.0004170810862,-0.001019459567,-0.0003522495099,
-	0.0007399931201,  0.00089980755,-5.608283391e-05,-0.0009284898988,-0.0006396381068,
-	0.0004353489203,0.0009550246177,0.0002850554592,-0.0007276734104,-0.0008255190914,
-	9.864040476e-05,0.0008860961534,0.0005651302054,-0.0004504734534,-0.000893937482,
-	-0.000225657408,0.0007109652506,0.0007533266908,-0.0001372011029,-0.0008451073081,
-	-0.0004975598422,0.0004593596968,0.0008329687407,0.0001699883724,-0.0006936845602,
-	-0.0006869637873,0.0001686425385,0.0008018491208,0.0004330587108,-0.0004664428416,
-	-0.0007759677246,-0.000121892328,0.0006722374819,0.0006220073556,-0.0001974031184,
-	-0.0007609759341,-0.0003755354846,0.0004675326054,0.0007187100709,7.630141045e-05,
-	-0.0006513759727,-0.0005632623797,0.0002192638203,0.0007176320069,  0.00032003448,
-	-0.000468198763,-0.0006661448861,-3.828044646e-05,0.0006263514515,0.0005051113549,
-	-0.0002397913195,-0.0006777321105, -0.00027175594,0.0004628715687,0.0006127743982,
-	1.481372919e-06,-0.0006031480152,-0.0004537384666,0.0002533750667,0.0006349516334,
-	0.0002243673225,-0.0004585282877,-0.0005649319501,2.753567605e-05,0.0005755189341,
-	0.0004019497137,-0.0002671168477,-0.0005968398764,-0.0001847064705,0.0004478508199,
-	0.0005154125975,-5.687673547e-05,-0.0005511983181,-0.000357826415,0.0002734600275,
-	0.0005550213973,0.0001444458321,-0.0004399182799,-0.0004726902116,7.764999464e-05,
-	0.0005216161371,0.0003118010645,-0.0002818119247,-0.0005194807891,-0.000112911388,
-	0.0004247440665,0.0004269074998,-0.0001007387182,-0.0004972479073,-0.0002748232801,
-	0.0002817978384, 0.000478930684,7.888027176e-05,-0.0004144510021,-0.0003895894915,
-	0.0001140875756,0.0004664243606,0.0002341457439,-0.0002859430679,-0.0004465782549,
-	-5.490627882e-05,0.0003956860746,0.0003475131525,-0.0001319749426,-0.0004429150431,
-	-0.000204064534,0.0002805091208,0.0004076162295,2.626700734e-05,-0.0003841277794,
-	-0.0003157356696,0.0001386819204,0.0004113453033,0.0001680529822,-0.0002817502827,
-	-0.0003790838236,-9.388840226e-06,0.0003623832017,0.0002770267893,-0.000152596258,
-	-0.0003896379785,-0.0001447979594,0.0002714519796,0.0003415968386,-1.49432035e-05,
-	-0.0003507274378,-0.0002510729537,0.0001531225134,0.0003574905277,0.0001126517236,
-	-0.0002709992987,-0.0003174696758,2.503024007e-05,0.0003263504186,0.0002151858207,
-	-0.0001643297728,-0.0003385709133,-9.625581879e-05,  0.00025621854,0.0002812196035,
-	-4.618815001e-05,-0.0003157872707,-0.0001954359759,0.0001589800086,0.0003057929571,
-	6.70151785e-05,-0.0002554379753,-0.0002622459142,4.954136239e-05,0.0002888187009,
-	0.0001616100781,-0.0001688158081,-0.0002906079462,-5.75558588e-05,0.0002363452513,
-	0.000226714139,-6.885645416e-05,-0.0002806531265,-0.0001485329558, 0.000157679111,
-	0.0002569693315,3.014401045e-05,-0.0002365702821,-0.0002136189141,6.549920363e-05,
-	0.0002510730119,0.0001159834792,-0.0001674740342,-0.0002464619756,-2.777670124e-05,
-	0.0002132648078, 0.000178265982,-8.41957517e-05,-0.0002463571727, -0.00010980972,
-	0.0001508175337,0.0002117003751,1.056032147e-06,-0.0002158263378,-0.0001716916304,
-	7.411937986e-05,0.0002138978743,7.736908447e-05,-0.0001621334231,-0.0002069810871,
-	-6.136674983e-06,0.0001879168267,0.0001354093838,-9.389661136e-05,-0.000214147949,
-	-7.902795915e-05,0.0001391742408,0.0001697781263,-2.174492511e-05,-0.0001945951954,
-	-0.000136492934,7.636254304e-05,0.0001777664147,4.503790842e-05,-0.0001539814548,
-	-0.0001723882015, 8.21130925e-06,0.0001611725893, 9.78478929e-05,-9.91378547e-05,
-	-0.0001847654494,-5.566308027e-05,0.0001239342528, 0.000131691806,-3.896989438e-05,
-	-0.0001737487182,-0.0001078636124,7.333846588e-05,0.0001433801517,1.828938548e-05,
-	-0.0001442520006,-0.000143044439,1.629456347e-05,0.0001340284362,6.526187644e-05,
-	-0.0001011841305,-0.0001587419683,-3.883823956e-05,0.0001062056035,9.701606177e-05,
-	-5.237677033e-05,-0.0001548430009,-8.584599709e-05,6.570416735e-05, 0.000110456429,
-	-4.386589808e-06, -0.00013448752,-0.0001192596465,1.851668276e-05,0.0001061881485,
-	3.612305591e-05,-0.0001018377225,-0.0001368883386,-2.820316877e-05,8.616645209e-05,
-	6.51422888e-05,-6.314468192e-05,-0.0001381355542,-6.942930486e-05,5.491615593e-05,
-	7.94587977e-05,-2.390295958e-05,-0.0001258179545,-0.0001008783729,1.601119584e-05,
-	7.843365165e-05,9.598833458e-06,-0.000102502825,-0.0001192910204,-2.233605301e-05,
-	6.505964848e-05,3.477992868e-05, -7.4106385e-05,-0.0001254189992,-5.804152897e-05,
-	4.178728705e-05,4.865460869e-05,-4.437091411e-05,-0.0001206186062,-8.643660112e-05,
-	1.275871364e-05, 5.16119253e-05, -1.7928136e-05,-0.0001079113354,-0.0001065969191,
-	-1.734108446e-05,4.578796143e-05,2.511447974e-06,-9.23929183e-05,-0.000119467637,
-	-4.431238631e-05,3.614216985e-05,1.702311965e-05,-8.001248352e-05,-0.0001323328179,
-	-6.655700417e-05,3.619483687e-05, 3.75177151e-05,-8.438104851e-05,-0.0001843571517,
-	-0.0001035427704,0.0001490127179,0.0003813452495,  0.00096172333
-};
+	// normalize phase filter, the gain comes for free with it
+	{
+		Real sum = 0;
+		for(size_t i = 0; i < taps.size(); ++i)
+			sum += taps[i];
+		sum = phases * gain / sum;
+		for(size_t i = 0; i < taps.size(); ++i)
+			taps[i] *= sum;
+	}
 
-static const float H40[1024] = {
-	0.0003314204514,  0.00103325618, 0.000153591769,0.0001027968829,-0.0001596148213,
-	-8.268489182e-05,5.611659071e-05,9.957944712e-05,-2.382455051e-07,-8.793183224e-05,
-	-4.735067341e-05,5.699418034e-05,7.781881141e-05,-1.066037657e-05,-8.297727618e-05,
-	-3.880725853e-05,5.957081521e-05,7.515846664e-05,-1.399253779e-05,-8.461898688e-05,
-	-3.832653965e-05,6.200422649e-05,7.780930173e-05,-1.426144809e-05,-8.834098844e-05,
-	-4.127871944e-05,6.411886716e-05,8.284978685e-05,-1.296548817e-05,-9.300179227e-05,
-	-4.591190009e-05, 6.58802237e-05,8.896036161e-05,-1.060492286e-05,-9.776504885e-05,
-	-5.173356112e-05,6.690587907e-05,9.587175737e-05,-7.011101843e-06,-0.0001027641047,
-	-5.873862028e-05,6.762731937e-05, 0.000103502156,-2.898888397e-06,-0.0001077211418,
-	-6.619768101e-05,6.760327233e-05,0.0001112065147,2.334213832e-06,-0.0001125491617,
-	-7.491351425e-05,6.686666893e-05,0.0001191846095,7.737861779e-06,-0.0001173152123,
-	-8.397848433e-05,6.561994815e-05,0.0001281303266,1.524681375e-05,-0.0001210470145,
-	-9.304411651e-05,6.385654706e-05,0.0001362028852,2.230185783e-05,-0.0001252084621,
-	-0.000103251863,6.169870176e-05,0.0001451548305,3.054413901e-05,-0.0001289178763,
-	-0.0001142148685,5.846384738e-05,0.0001541418169,3.956144792e-05,-0.0001320663141,
-	-0.0001254947856,5.442013935e-05,0.0001629657636,4.942836676e-05,-0.0001347500511,
-	-0.00013723546, 4.95700624e-05,0.0001718217391,6.008307173e-05,-0.0001369952661,
-	-0.0001493485179,4.387975787e-05,0.0001805407373,7.155175263e-05,-0.0001386039366,
-	-0.0001618337119, 3.71041715e-05,0.0001893727604,8.357354818e-05,-0.0001392632548,
-	-0.0001750114898, 2.97578099e-05, 0.000197590387,  9.6802607e-05,-0.0001394457358,
-	-0.0001883092773,2.126435356e-05,0.0002058452665,0.0001106687778,-0.0001386745716,
-	-0.000201901581,1.177252034e-05,0.0002135997929,0.0001253356168,-0.000137281022,
-	-0.0002160127624,1.112464474e-06,0.0002208949154,0.0001407764066,-0.0001347755315,
-	-0.0002301000932,-1.034784236e-05,0.0002279237378,0.0001570076711,-0.0001314312976,
-	-0.0002445165301,-2.316196333e-05,0.0002343554806,0.0001741243032,-0.0001269109052,
-	-0.0002589128271,-3.701489914e-05,0.0002400244703,0.0001918672351,-0.0001213293363,
-	-0.0002733141591,-5.194335245e-05, 0.000245064788,0.0002102878352,-0.0001146078575,
-	-0.0002877372899,-6.801709242e-05,0.0002493195061,0.0002294125443,-0.0001066284676,
-	-0.0003020568693,-8.533138316e-05,0.0002527558245,0.0002491624327,-9.738028893e-05,
-	-0.000316185964,-0.0001037954644,0.0002551831421,0.0002695209987,-8.678067388e-05,
-	-0.0003300629905,-0.0001235086384, 0.000256616273, 0.000290399912,-7.481882494e-05,
-	-0.0003436190309,-0.0001444013178,0.0002569114149,0.0003118378227,-6.138275785e-05,
-	-0.0003566770465,-0.0001664247829,0.0002560985449,0.0003337365633,-4.640779298e-05,
-	-0.0003692699247,-0.0001897225884,0.0002539075795,0.0003559150209,-2.998145101e-05,
-	-0.0003812330833,-0.0002141735749,0.0002504464937,0.0003784802102,-1.187426551e-05,
-	-0.0003925413766,-0.0002397583885,0.0002453957859,0.0004012090794,7.853727766e-06,
-	-0.0004030007112,-0.0002664146596,0.0002388467692, 0.000424153608,2.914247307e-05,
-	-0.0004125510168,-0.0002942600404,0.0002307420946,0.0004471413558,5.222666005e-05,
-	-0.0004211052728,-0.0003231818264,0.0002208390215,0.0004701443831,7.702995208e-05,
-	-0.0004285052128,-0.0003530997783,0.0002091143542,0.0004930231371,0.0001035854366,
-	-0.0004346505448,-0.0003840133722,0.0001955401531,0.0005156709813, 0.000131942259,
-	-0.0004394464195,-0.0004158296215,0.0001799624006,0.0005380150396,0.0001620717958,
-	-0.0004427694657,-0.0004485739337,0.0001623107964,0.0005598636344,0.0001940064103,
-	-0.0004445216327,-0.0004821002367,0.0001425397932,0.0005812208401,0.0002277791355,
-	-0.0004444629303,-0.0005163532915, 0.000120546887,0.0006018677377,0.0002633508993,
-	-0.0004426479281,-0.0005512743373,9.624649101e-05,0.0006217404734, 0.000300760963,
-	-0.0004387811932,-0.0005867736763,6.958898302e-05,0.0006406442262,0.0003399465058,
-	-0.0004328612122,-0.0006227506092,4.049394556e-05,0.0006585289375,0.0003809371265,
-	-0.0004246868484,-0.0006591548445,8.867893484e-06,0.0006751727778,0.0004237203975,
-	-0.000414151611,-0.0006957910955,-2.533235784e-05,0.0006904340698,0.0004682097933,
-	-0.0004011253186,-0.0007326193736,-6.213322195e-05,0.0007041849894,0.0005144181778,
-	-0.0003855102987,-0.0007694989326,-0.0001016563692,0.0007162955008,0.0005622813478,
-	-0.0003671120794,-0.0008062947309,-0.0001439202024,0.0007265863824,0.0006117944722,
-	-0.0003457993735,-0.0008428831352,-0.0001889904961,0.0007348764921, 0.000662831706,
-	-0.0003214718308,-0.000879175961,-0.0002369232534,0.0007409547106,0.0007154418272,
-	-0.0002940015693,-0.0009149145917,-0.0002877649677,0.0007447399548,0.0007694634842,
-	-0.0002631864627,-0.0009500893066,-0.000341564737,0.0007459549815,0.0008248987142,
-	-0.0002289339609,-0.0009844227461,-0.0003983534989,0.0007444804069,0.0008816281916,
-	-0.0001910900319,-0.001017826609,-0.0004581949906, 0.000740080839,0.0009396183887,
-	-0.0001494944881,  -0.0010500832,-0.0005211184034,0.0007325647748,0.0009987275116,
-	-0.0001040049465,-0.001081031398,-0.000587134331,0.0007217464736, 0.001058909693,
-	-5.448003867e-05,-0.001110489829,-0.0006563382922,0.0007074066671, 0.001120066503,
-	-7.315524044e-07,-0.001138252323,-0.0007287535118,0.0006892686943, 0.001182077918,
-	5.737912579e-05,-0.001164120389,-0.0008044096758,0.0006671422743,  0.00124483963,
-	0.0001200550541,-0.001187852584,-0.0008833255852,0.0006407827022, 0.001308281557,
-	0.0001874552545,-0.001209256006,-0.000965597108,0.0006099102902, 0.001372227212,
-	0.000259782566, -0.00122807757,-0.001051236875, 0.000574276899, 0.001436620951,
-	0.0003372457286, -0.00124405825,-0.001140339533,0.0005335661699, 0.001501286402,
-	0.0004200589319,-0.001256952411, -0.00123293139,0.0004874865699,  0.00156614196,
-	0.0005084810546, -0.00126647763,-0.001329121296,0.0004356864374, 0.001631025225,
-	0.0006027808413,-0.001272335183,-0.001428970369,0.0003777962702, 0.001695834333,
-	0.0007032204885,-0.001274205628,-0.001532632043,0.0003134449944, 0.001760433777,
-	0.0008101714775,-0.001271740883,-0.001640210743,0.0002421627141, 0.001824672567,
-	0.0009240143117,-0.001264571212,-0.001751839649,0.0001634945656,  0.00188842963,
-	0.001045118901,-0.001252307557,-0.001867759274,7.688321784e-05, 0.001951560494,
-	0.001173991477,-0.001234510797,-0.001988184871,-1.826136759e-05, 0.002013947582,
-	0.001311216387, -0.00121067022,-0.002113383729,-0.0001226588793, 0.002075435827,
-	0.001457389561,-0.001180260209,-0.002243715571,-0.0002370780567, 0.002135904273,
-	0.001613311586,-0.001142647467,-0.002379565965,-0.0003624483361,  0.00219520228,
-	0.001779838931,-0.001097143628,-0.002521476941,-0.0004998238292, 0.002253208309,
-	0.001958052162,-0.001042928896,-0.002670033602,-0.0006504804478, 0.002309790812,
-	0.002149190754,-0.0009790521581,-0.002826018492,-0.0008158848505, 0.002364818705,
-	0.002354797209,-0.0009044327307,-0.002990360605,-0.0009978588205, 0.002418155549,
-	0.002576715546,-0.0008177309064,-0.003164230846,-0.001198547194, 0.002469669329,
-	0.002817205153,-0.0007173768827,-0.003349067178,-0.001420604065, 0.002519282978,
-	0.003079116344,-0.0006014124374, -0.00354671781,-0.001667343196, 0.002566837007,
-	0.0033659623,-0.0004674532975,-0.003759496612,-0.001942908973,  0.00261222804,
-	0.003682218958,-0.0003124483046,-0.003990381025, -0.00225253799, 0.002655352233,
-	0.004033650272,-0.0001325771445,-0.004243290052,-0.002603072673, 0.002696091542,
-	0.004427792039,7.721393922e-05,-0.004523336422,-0.003003474558, 0.002734368434,
-	0.004874655046,0.0003235679469,-0.004837451968,-0.003465828951, 0.002770076972,
-	0.005387837999,0.0006155622541,-0.005195157137,-0.004006704316, 0.002803119598,
-	0.005986296106,0.0009658018243,-0.005609846208,-0.004649576731, 0.002833435545,
-	0.006697166711, 0.001392496517,-0.006101042964,-0.005428730045, 0.002860939363,
-	0.007560737431, 0.001922779949,-0.006698191166,-0.006396311801, 0.002885567723,
-	0.008639443666, 0.002599092899,-0.007447935175,-0.007635666989, 0.002907247515,
-	0.01003549621, 0.003491757903,-0.008428545669,-0.009288660251, 0.002925933572,
-	0.01192827616, 0.004726209212,-0.009782399051, -0.01161802374, 0.002941571642,
-	0.0146642467,  0.00655030692, -0.01179796737, -0.01517061889,  0.00295414147,
-	0.01901000552,  0.00953182485, -0.01516179182, -0.02130373195, 0.002963586478,
-	0.02706553228,  0.01532004215, -0.02200600691, -0.03456838802, 0.002969901543,
-	0.04739287496,  0.03156192973, -0.04393942282, -0.08552248776, 0.002973061753,
-	0.2027163953,   0.3717854321,   0.3717854321,   0.2027163953, 0.002973061753,
-	-0.08552248776, -0.04393942282,  0.03156192973,  0.04739287496, 0.002969901543,
-	-0.03456838802, -0.02200600691,  0.01532004215,  0.02706553228, 0.002963586478,
-	-0.02130373195, -0.01516179182,  0.00953182485,  0.01901000552,  0.00295414147,
-	-0.01517061889, -0.01179796737,  0.00655030692,   0.0146642467, 0.002941571642,
-	-0.01161802374,-0.009782399051, 0.004726209212,  0.01192827616, 0.002925933572,
-	-0.009288660251,-0.008428545669, 0.003491757903,  0.01003549621, 0.002907247515,
-	-0.007635666989,-0.007447935175, 0.002599092899, 0.008639443666, 0.002885567723,
-	-0.006396311801,-0.006698191166, 0.001922779949, 0.007560737431, 0.002860939363,
-	-0.005428730045,-0.006101042964, 0.001392496517, 0.006697166711, 0.002833435545,
-	-0.004649576731,-0.005609846208,0.0009658018243, 0.005986296106, 0.002803119598,
-	-0.004006704316,-0.005195157137,0.0006155622541, 0.005387837999, 0.002770076972,
-	-0.003465828951,-0.004837451968,0.0003235679469, 0.004874655046, 0.002734368434,
-	-0.003003474558,-0.004523336422,7.721393922e-05, 0.004427792039, 0.002696091542,
-	-0.002603072673,-0.004243290052,-0.0001325771445, 0.004033650272, 0.002655352233,
-	-0.00225253799,-0.003990381025,-0.0003124483046, 0.003682218958,  0.00261222804,
-	-0.001942908973,-0.003759496612,-0.0004674532975,   0.0033659623, 0.002566837007,
-	-0.001667343196, -0.00354671781,-0.0006014124374, 0.003079116344, 0.002519282978,
-	-0.001420604065,-0.003349067178,-0.0007173768827, 0.002817205153, 0.002469669329,
-	-0.001198547194,-0.003164230846,-0.0008177309064, 0.002576715546, 0.002418155549,
-	-0.0009978588205,-0.002990360605,-0.0009044327307, 0.002354797209, 0.002364818705,
-	-0.0008158848505,-0.002826018492,-0.0009790521581, 0.002149190754, 0.002309790812,
-	-0.0006504804478,-0.002670033602,-0.001042928896, 0.001958052162, 0.002253208309,
-	-0.0004998238292,-0.002521476941,-0.001097143628, 0.001779838931,  0.00219520228,
-	-0.0003624483361,-0.002379565965,-0.001142647467, 0.001613311586, 0.002135904273,
-	-0.0002370780567,-0.002243715571,-0.001180260209, 0.001457389561, 0.002075435827,
-	-0.0001226588793,-0.002113383729, -0.00121067022, 0.001311216387, 0.002013947582,
-	-1.826136759e-05,-0.001988184871,-0.001234510797, 0.001173991477, 0.001951560494,
-	7.688321784e-05,-0.001867759274,-0.001252307557, 0.001045118901,  0.00188842963,
-	0.0001634945656,-0.001751839649,-0.001264571212,0.0009240143117, 0.001824672567,
-	0.0002421627141,-0.001640210743,-0.001271740883,0.0008101714775, 0.001760433777,
-	0.0003134449944,-0.001532632043,-0.001274205628,0.0007032204885, 0.001695834333,
-	0.0003777962702,-0.001428970369,-0.001272335183,0.0006027808413, 0.001631025225,
-	0.0004356864374,-0.001329121296, -0.00126647763,0.0005084810546,  0.00156614196,
-	0.0004874865699, -0.00123293139,-0.001256952411,0.0004200589319, 0.001501286402,
-	0.0005335661699,-0.001140339533, -0.00124405825,0.0003372457286, 0.001436620951,
-	0.000574276899,-0.001051236875, -0.00122807757, 0.000259782566, 0.001372227212,
-	0.0006099102902,-0.000965597108,-0.001209256006,0.0001874552545, 0.001308281557,
-	0.0006407827022,-0.0008833255852,-0.001187852584,0.0001200550541,  0.00124483963,
-	0.0006671422743,-0.0008044096758,-0.001164120389,5.737912579e-05, 0.001182077918,
-	0.0006892686943,-0.0007287535118,-0.001138252323,-7.315524044e-07, 0.001120066503,
-	0.0007074066671,-0.0006563382922,-0.001110489829,-5.448003867e-05, 0.001058909693,
-	0.0007217464736,-0.000587134331,-0.001081031398,-0.0001040049465,0.0009987275116,
-	0.0007325647748,-0.0005211184034,  -0.0010500832,-0.0001494944881,0.0009396183887,
-	0.000740080839,-0.0004581949906,-0.001017826609,-0.0001910900319,0.0008816281916,
-	0.0007444804069,-0.0003983534989,-0.0009844227461,-0.0002289339609,0.0008248987142,
-	0.0007459549815,-0.000341564737,-0.0009500893066,-0.0002631864627,0.0007694634842,
-	0.0007447399548,-0.0002877649677,-0.0009149145917,-0.0002940015693,0.0007154418272,
-	0.0007409547106,-0.0002369232534,-0.000879175961,-0.0003214718308, 0.000662831706,
-	0.0007348764921,-0.0001889904961,-0.0008428831352,-0.0003457993735,0.0006117944722,
-	0.0007265863824,-0.0001439202024,-0.0008062947309,-0.0003671120794,0.0005622813478,
-	0.0007162955008,-0.0001016563692,-0.0007694989326,-0.0003855102987,0.0005144181778,
-	0.0007041849894,-6.213322195e-05,-0.0007326193736,-0.0004011253186,0.0004682097933,
-	0.0006904340698,-2.533235784e-05,-0.0006957910955,-0.000414151611,0.0004237203975,
-	0.0006751727778,8.867893484e-06,-0.0006591548445,-0.0004246868484,0.0003809371265,
-	0.0006585289375,4.049394556e-05,-0.0006227506092,-0.0004328612122,0.0003399465058,
-	0.0006406442262,6.958898302e-05,-0.0005867736763,-0.0004387811932, 0.000300760963,
-	0.0006217404734,9.624649101e-05,-0.0005512743373,-0.0004426479281,0.0002633508993,
-	0.0006018677377, 0.000120546887,-0.0005163532915,-0.0004444629303,0.0002277791355,
-	0.0005812208401,0.0001425397932,-0.0004821002367,-0.0004445216327,0.0001940064103,
-	0.0005598636344,0.0001623107964,-0.0004485739337,-0.0004427694657,0.0001620717958,
-	0.0005380150396,0.0001799624006,-0.0004158296215,-0.0004394464195, 0.000131942259,
-	0.0005156709813,0.0001955401531,-0.0003840133722,-0.0004346505448,0.0001035854366,
-	0.0004930231371,0.0002091143542,-0.0003530997783,-0.0004285052128,7.702995208e-05,
-	0.0004701443831,0.0002208390215,-0.0003231818264,-0.0004211052728,5.222666005e-05,
-	0.0004471413558,0.0002307420946,-0.0002942600404,-0.0004125510168,2.914247307e-05,
-	0.000424153608,0.0002388467692,-0.0002664146596,-0.0004030007112,7.853727766e-06,
-	0.0004012090794,0.0002453957859,-0.0002397583885,-0.0003925413766,-1.187426551e-05,
-	0.0003784802102,0.0002504464937,-0.0002141735749,-0.0003812330833,-2.998145101e-05,
-	0.0003559150209,0.0002539075795,-0.0001897225884,-0.0003692699247,-4.640779298e-05,
-	0.0003337365633,0.0002560985449,-0.0001664247829,-0.0003566770465,-6.138275785e-05,
-	0.0003118378227,0.0002569114149,-0.0001444013178,-0.0003436190309,-7.481882494e-05,
-	0.000290399912, 0.000256616273,-0.0001235086384,-0.0003300629905,-8.678067388e-05,
-	0.0002695209987,0.0002551831421,-0.0001037954644,-0.000316185964,-9.738028893e-05,
-	0.0002491624327,0.0002527558245,-8.533138316e-05,-0.0003020568693,-0.0001066284676,
-	0.0002294125443,0.0002493195061,-6.801709242e-05,-0.0002877372899,-0.0001146078575,
-	0.0002102878352, 0.000245064788,-5.194335245e-05,-0.0002733141591,-0.0001213293363,
-	0.0001918672351,0.0002400244703,-3.701489914e-05,-0.0002589128271,-0.0001269109052,
-	0.0001741243032,0.0002343554806,-2.316196333e-05,-0.0002445165301,-0.0001314312976,
-	0.0001570076711,0.0002279237378,-1.034784236e-05,-0.0002301000932,-0.0001347755315,
-	0.0001407764066,0.0002208949154,1.112464474e-06,-0.0002160127624,-0.000137281022,
-	0.0001253356168,0.0002135997929,1.177252034e-05,-0.000201901581,-0.0001386745716,
-	0.0001106687778,0.0002058452665,2.126435356e-05,-0.0001883092773,-0.0001394457358,
-	9.6802607e-05, 0.000197590387, 2.97578099e-05,-0.0001750114898,-0.0001392632548,
-	8.357354818e-05,0.0001893727604, 3.71041715e-05,-0.0001618337119,-0.0001386039366,
-	7.155175263e-05,0.0001805407373,4.387975787e-05,-0.0001493485179,-0.0001369952661,
-	6.008307173e-05,0.0001718217391, 4.95700624e-05, -0.00013723546,-0.0001347500511,
-	4.942836676e-05,0.0001629657636,5.442013935e-05,-0.0001254947856,-0.0001320663141,
-	3.956144792e-05,0.0001541418169,5.846384738e-05,-0.0001142148685,-0.0001289178763,
-	3.054413901e-05,0.0001451548305,6.169870176e-05,-0.000103251863,-0.0001252084621,
-	2.230185783e-05,0.0001362028852,6.385654706e-05,-9.304411651e-05,-0.0001210470145,
-	1.524681375e-05,0.0001281303266,6.561994815e-05,-8.397848433e-05,-0.0001173152123,
-	7.737861779e-06,0.0001191846095,6.686666893e-05,-7.491351425e-05,-0.0001125491617,
-	2.334213832e-06,0.0001112065147,6.760327233e-05,-6.619768101e-05,-0.0001077211418,
-	-2.898888397e-06, 0.000103502156,6.762731937e-05,-5.873862028e-05,-0.0001027641047,
-	-7.011101843e-06,9.587175737e-05,6.690587907e-05,-5.173356112e-05,-9.776504885e-05,
-	-1.060492286e-05,8.896036161e-05, 6.58802237e-05,-4.591190009e-05,-9.300179227e-05,
-	-1.296548817e-05,8.284978685e-05,6.411886716e-05,-4.127871944e-05,-8.834098844e-05,
-	-1.426144809e-05,7.780930173e-05,6.200422649e-05,-3.832653965e-05,-8.461898688e-05,
-	-1.399253779e-05,7.515846664e-05,5.957081521e-05,-3.880725853e-05,-8.297727618e-05,
-	-1.066037657e-05,7.781881141e-05,5.699418034e-05,-4.735067341e-05,-8.793183224e-05,
-	-2.382455051e-07,9.957944712e-05,5.611659071e-05,-8.268489182e-05,-0.0001596148213,
-	0.0001027968829, 0.000153591769,  0.00103325618,0.0003314204514
-};
+	// reorder into polyphase; phase p is the time reverse of phase "phases" - p, so only
+	// phases 0 .. phases / 2 are stored (phase "phases" is phase 0 one input sample later,
+	// the mirror of phase 0, so blending past the last phase needs no special case);
+	// aligned for 256 bit loads, each phase is a multiple of 16 taps
+	std::shared_ptr<FilterBank> bank = std::make_shared<FilterBank>();
+	size_t size = (phases / 2 + 1) * tapsPerPhase;
+	bank->storage.assign(size + 8, 0);
+	float* polyphase = &bank->storage[0];
+	polyphase += ((32 - ((quint64)polyphase & 31)) & 31) / sizeof(float);
+	for(int phase = 0; phase <= phases / 2; phase++) {
+		for(int i = 0; i < tapsPerPhase; i++) {
+			size_t tap = i * phases + phase;
+			polyphase[phase * tapsPerPhase + i] = (tap < taps.size()) ? taps[tap] : 0;
+		}
+	}
+	bank->taps = polyphase;
+	if(fixedPoint)
+		createFixedTaps(phases, tapsPerPhase, gain, bank.get());
+	if(fftSize > 0)
+		bank->spectrum = FFTFilter::createSpectrum(bank->taps, tapsPerPhase, fftSize);
+	cache[key] = bank;
 
-static const float H45[1024] = {
-	0.0005753284786,-0.0004562124377,-0.0006478383439,-0.0005575935938,-0.0002206767385,
-	1.196056564e-05,-2.517419489e-05,-0.0001258139091,-6.902174209e-05,6.023365859e-05,
-	5.713488645e-05,-5.464083006e-05,-7.632540655e-05,2.873551784e-05,8.150283247e-05,
-	-6.13006614e-06,-8.418872312e-05,-1.948217687e-05,7.886737876e-05,4.383684427e-05,
-	-6.626782852e-05,-6.528083759e-05,4.614461068e-05,8.186769264e-05,-2.122860133e-05,
-	-9.009735368e-05,-7.709993952e-06, 8.95373887e-05, 3.72059294e-05,-7.937070768e-05,
-	-6.41554434e-05,6.004586248e-05,8.552427607e-05,-3.320426185e-05,-9.854918608e-05,
-	1.323077072e-06,0.0001013458532,3.230325456e-05,-9.297520592e-05,-6.40623839e-05,
-	7.384132914e-05,9.026573389e-05,-4.550539961e-05,-0.0001076505578, 1.07480455e-05,
-	0.0001136512437,2.715745541e-05,-0.0001073447129,-6.366441812e-05,8.854801854e-05,
-	9.48113011e-05,-5.884592611e-05,-0.0001167320079,2.112217044e-05,0.0001264935418,
-	2.081814637e-05,-0.0001224107255,-6.233699969e-05,0.0001042848744,9.874340321e-05,
-	-7.355987327e-05,-0.0001256166579,3.307446605e-05,0.0001394945284,1.296720711e-05,
-	-0.0001382187183,-5.963153671e-05,0.0001213699798,0.0001015341404,-8.998924022e-05,
-	-0.0001339710143,4.716212061e-05,0.0001527834538,3.005391136e-06,-0.0001552604226,
-	-5.521988351e-05, 0.000140204691,0.0001036299727,-0.0001083905518,-0.0001422769128,
-	6.280140224e-05,0.0001662555878,-8.355294085e-06,-0.0001724305475,-4.912621444e-05,
-	0.0001597217924,0.0001036449539,-0.0001284759055,-0.0001490719296,8.107384201e-05,
-	0.0001794516284,-2.242396295e-05,-0.000190503808,-4.089438153e-05,0.0001806712826,
-	0.0001021915887,-0.0001503082312,-0.0001547969005,0.0001013822985,0.0001920205978,
-	-3.891079177e-05,-0.000208739817,-3.017572817e-05,0.0002028736344,9.869073256e-05,
-	-0.0001739564905,-0.000159164294,0.0001239237317,0.0002037814556,-5.800408326e-05,
-	-0.0002271380508,-1.676815737e-05,0.0002261055633, 9.30430906e-05,-0.0001993216138,
-	-0.0001616656809,0.0001488622365,0.0002145331237,-8.004170377e-05,-0.0002456174698,
-	-8.061033441e-07,0.0002500795526,8.467928274e-05,-0.0002263122442,-0.0001619579853,
-	0.0001765276684,0.0002242825576,-0.0001046433899,-0.0002635783167,1.826568041e-05,
-	0.0002744755184,7.317958807e-05,-0.0002552679507,-0.0001601916592,0.0002062112471,
-	0.0002321373613,-0.0001322837779,-0.0002806208213,4.086046829e-05,0.0002996008843,
-	5.885127393e-05,-0.0002851475438,-0.000155223388,0.0002385230182,0.0002379401121,
-	-0.000163160832,-0.0002969053749,6.666623813e-05,0.0003244335821,4.061461368e-05,
-	-0.0003168523544,-0.0001476023026,0.0002728720428, 0.000241408794,-0.0001970380254,
-	-0.000311677868,9.612179565e-05,0.0003493140102,1.905640602e-05,-0.0003489849914,
-	-0.0001360605966,0.0003097546287,0.0002422657126,-0.0002338924533,-0.0003245646367,
-	0.0001295557595,0.0003737417865,-6.491604381e-06,-0.0003821105347,-0.000120970486,
-	0.0003484290501,0.0002397955832,-0.0002740411437,-0.0003354178625,0.0001666563039,
-	0.000397052645,-3.652968371e-05,-0.0004158657393,-0.0001018368348,0.0003889246145,
-	0.0002336809412,-0.0003172949655,-0.0003436879779, 0.000207760022,0.0004190025793,
-	-7.104070392e-05,-0.0004497284535,-7.811733667e-05,0.0004311045341,0.0002235601714,
-	-0.0003635534958,-0.0003488281218, 0.000252957514,0.0004392327392,-0.0001102487658,
-	-0.0004833033017,-4.950408402e-05,0.0004747159546,0.0002090012858,-0.0004126556159,
-	-0.0003504144552,0.0003022724122,0.0004571996687,-0.0001543241524,-0.0005162242451,
-	-1.570113091e-05,0.0005193653051,0.0001895538153,-0.0004644561559,-0.0003479109728,
-	0.0003556298907,0.0004723730381,-0.0002034909994,-0.0005479765241,2.364737702e-05,
-	0.0005647165235,0.0001647164463,-0.0005187259521,-0.0003407369077,0.0004131390306,
-	0.0004842211492,-0.0002579483844,-0.0005781872314,6.882894377e-05,0.0006104101194,
-	0.0001340957388,-0.000575260201,-0.0003284305858,0.0004746379273,0.0004922406515,
-	-0.0003176856844,-0.0006061819731,0.0001201330233,0.0006558755413,9.708409198e-05,
-	-0.0006337946397,-0.0003103964846,0.0005400895607,0.0004957660567,-0.0003828853951,
-	-0.0006314562634, 0.000177933136, 0.000700792647,5.340140342e-05,-0.0006939600571,
-	-0.0002861071553,0.0006091888645,0.0004940785584,-0.000453692337,-0.0006533868145,
-	0.0002424695267,0.0007446004893,2.531388873e-06,-0.0007553091855,-0.0002548566845,
-	0.0006819674163,0.0004866452364,-0.0005300129415,-0.0006712859031,0.0003139992186,
-	0.0007865887601,-5.613688336e-05,-0.000817592314,-0.0002161180309,0.0007580633974,
-	0.0004726760089,-0.0006119629834,-0.0006844114978,0.0003928740916,0.0008263117052,
-	-0.0001229220215,-0.0008801539079,-0.0001691493671,0.0008373208693,0.0004514281754,
-	-0.0006995450822,-0.0006921316381,0.0004792007385,0.0008628975484,-0.0001984377159,
-	-0.0009426173056,-0.000113351969,0.0009193488513,0.0004221686395,-0.0007926381077,
-	-0.0006934495177,0.0005733669386,0.0008957878454,-0.0002830569865,-0.001004221383,
-	-4.79232076e-05, 0.001003895537,0.0003839731507,-0.0008912904887,-0.0006876715343,
-	0.0006755295908,0.0009240408544,-0.000377451157,-0.001064593554,2.774670065e-05,
-	0.001090481761,0.0003360048868,-0.0009954143316,-0.0006737945951,0.0007859613397,
-	0.0009468974313,-0.0004820740432,-0.001122824149,0.0001146521972, 0.001178888255,
-	0.0002773244632,-0.001104887226,-0.0006507700891,0.0009050632943,0.0009634488961,
-	-0.0005975858076,-0.001178361475,0.0002135453833, 0.001268524327,0.0002068041649,
-	-0.001219751663,-0.0006175684975, 0.001033017645,0.0009725757991,-0.0007247846806,
-	-0.001230400871,0.0003254224721, 0.001358997193,0.0001232658396,-0.001339901821,
-	-0.0005729374243,  0.00117029273, 0.000973207003,-0.000864359783, -0.00127801206,
-	0.0004515079781, 0.001449814066,2.538467015e-05,-0.001465349924,-0.0005154446699,
-	0.001317400252,0.0009641556535,-0.001017258153,-0.001320211333,0.0005931201158,
-	0.001540539786,-8.836500638e-05,-0.001596108079,-0.0004435534356,  0.00147492555,
-	0.0009439525311,-0.001184656983,-0.001356031629,0.0007517826743, 0.001630607061,
-	-0.0002197791327,-0.001732301549,-0.0003554237774, 0.001643634634,0.0009109771927,
-	-0.001367977122,-0.001384289004,0.0009293605108, 0.001719460823,-0.0003710751771,
-	-0.001874171197,-0.0002488548052, 0.001824633218,0.0008633804391,-0.001568968524,
-	-0.001403653761, 0.001128245494, 0.001806611079,-0.000544862356,-0.002022160916,
-	-0.0001212930729, 0.002019210253,0.0007988494472,-0.001789941685,-0.001412572456,
-	0.001351388753, 0.001891509397,-0.0007444813382,-0.002176867565,3.062711403e-05,
-	0.002229353646,0.0007146526477, -0.00203392189,-0.001409280463, 0.001602609176,
-	0.001973599661,-0.0009742319235,-0.002339370316, 0.000210974642, 0.002457571216,
-	0.0006072968245,-0.002304886235,-0.001391463098, 0.001887076069, 0.002052451018,
-	-0.001239645062,-0.002511085942,0.0004252538201, 0.002707487904,0.0004723016173,
-	-0.002608312061,-0.001356359571, 0.002211575629, 0.002127439482, -0.00154836406,
-	-0.002694268012,0.0006807591417, 0.002984143328,  0.00030365985,-0.002951799892,
-	-0.001300233533, 0.002585712122, 0.002198151546,-0.001910809544,-0.002892184071,
-	0.0009875795804, 0.003294751281,9.304098057e-05,-0.003346252488,-0.001218130696,
-	0.003023054218, 0.002264066832,-0.002341960324,-0.003109811805, 0.001360174268,
-	0.003649995895,-0.0001713684469,-0.003807596397,-0.001102862647, 0.003543720348,
-	0.00232480024, -0.00286391587,-0.003354702378, 0.001820110483, 0.004066149704,
-	-0.0005073227221, -0.00436026603,-0.0009438893758, 0.004178490024, 0.002379889367,
-	-0.003510983661,-0.003639078233, 0.002400831087, 0.004568929784,-0.0009426597971,
-	-0.005043227226,-0.000724498299, 0.004977028817, 0.002428965876,-0.004338952247,
-	-0.003983001225, 0.003157802857, 0.005201636348,-0.001523818122,-0.005922479555,
-	-0.0004164585262, 0.006024846341,  0.00247169775,-0.005445367191,-0.004422449041,
-	0.00418924354, 0.006042018067, -0.00233488949, -0.00711927237,3.205845132e-05,
-	0.007481857203, 0.002507765312,-0.007016981486,-0.005027316045, 0.005688024219,
-	0.007245274726,-0.003545171581,-0.008881838061,0.0007284504245,  0.00968584232,
-	0.002536922228,-0.009461370297,-0.005953381304, 0.008090994321, 0.009170431644,
-	-0.005554065108, -0.01180973463, 0.001937847119,  0.01349286269, 0.002558984328,
-	-0.01386948768,-0.007630864158,  0.01264196075,  0.01287623122,-0.009582909755,
-	-0.01781187952, 0.004540967755,  0.02188576385,  0.00257379259,  -0.0244756192,
-	-0.01183792017,   0.0248505827,  0.02343528718, -0.02202683501, -0.03796307743,
-	0.01429635752,  0.05737506971, 0.002581203822, -0.08907219768,  -0.0459626615,
-	0.1824689209,   0.4111852646,   0.4111852646,   0.1824689209,  -0.0459626615,
-	-0.08907219768, 0.002581203822,  0.05737506971,  0.01429635752, -0.03796307743,
-	-0.02202683501,  0.02343528718,   0.0248505827, -0.01183792017,  -0.0244756192,
-	0.00257379259,  0.02188576385, 0.004540967755, -0.01781187952,-0.009582909755,
-	0.01287623122,  0.01264196075,-0.007630864158, -0.01386948768, 0.002558984328,
-	0.01349286269, 0.001937847119, -0.01180973463,-0.005554065108, 0.009170431644,
-	0.008090994321,-0.005953381304,-0.009461370297, 0.002536922228,  0.00968584232,
-	0.0007284504245,-0.008881838061,-0.003545171581, 0.007245274726, 0.005688024219,
-	-0.005027316045,-0.007016981486, 0.002507765312, 0.007481857203,3.205845132e-05,
-	-0.00711927237, -0.00233488949, 0.006042018067,  0.00418924354,-0.004422449041,
-	-0.005445367191,  0.00247169775, 0.006024846341,-0.0004164585262,-0.005922479555,
-	-0.001523818122, 0.005201636348, 0.003157802857,-0.003983001225,-0.004338952247,
-	0.002428965876, 0.004977028817,-0.000724498299,-0.005043227226,-0.0009426597971,
-	0.004568929784, 0.002400831087,-0.003639078233,-0.003510983661, 0.002379889367,
-	0.004178490024,-0.0009438893758, -0.00436026603,-0.0005073227221, 0.004066149704,
-	0.001820110483,-0.003354702378, -0.00286391587,  0.00232480024, 0.003543720348,
-	-0.001102862647,-0.003807596397,-0.0001713684469, 0.003649995895, 0.001360174268,
-	-0.003109811805,-0.002341960324, 0.002264066832, 0.003023054218,-0.001218130696,
-	-0.003346252488,9.304098057e-05, 0.003294751281,0.0009875795804,-0.002892184071,
-	-0.001910809544, 0.002198151546, 0.002585712122,-0.001300233533,-0.002951799892,
-	0.00030365985, 0.002984143328,0.0006807591417,-0.002694268012, -0.00154836406,
-	0.002127439482, 0.002211575629,-0.001356359571,-0.002608312061,0.0004723016173,
-	0.002707487904,0.0004252538201,-0.002511085942,-0.001239645062, 0.002052451018,
-	0.001887076069,-0.001391463098,-0.002304886235,0.0006072968245, 0.002457571216,
-	0.000210974642,-0.002339370316,-0.0009742319235, 0.001973599661, 0.001602609176,
-	-0.001409280463, -0.00203392189,0.0007146526477, 0.002229353646,3.062711403e-05,
-	-0.002176867565,-0.0007444813382, 0.001891509397, 0.001351388753,-0.001412572456,
-	-0.001789941685,0.0007988494472, 0.002019210253,-0.0001212930729,-0.002022160916,
-	-0.000544862356, 0.001806611079, 0.001128245494,-0.001403653761,-0.001568968524,
-	0.0008633804391, 0.001824633218,-0.0002488548052,-0.001874171197,-0.0003710751771,
-	0.001719460823,0.0009293605108,-0.001384289004,-0.001367977122,0.0009109771927,
-	0.001643634634,-0.0003554237774,-0.001732301549,-0.0002197791327, 0.001630607061,
-	0.0007517826743,-0.001356031629,-0.001184656983,0.0009439525311,  0.00147492555,
-	-0.0004435534356,-0.001596108079,-8.836500638e-05, 0.001540539786,0.0005931201158,
-	-0.001320211333,-0.001017258153,0.0009641556535, 0.001317400252,-0.0005154446699,
-	-0.001465349924,2.538467015e-05, 0.001449814066,0.0004515079781, -0.00127801206,
-	-0.000864359783, 0.000973207003,  0.00117029273,-0.0005729374243,-0.001339901821,
-	0.0001232658396, 0.001358997193,0.0003254224721,-0.001230400871,-0.0007247846806,
-	0.0009725757991, 0.001033017645,-0.0006175684975,-0.001219751663,0.0002068041649,
-	0.001268524327,0.0002135453833,-0.001178361475,-0.0005975858076,0.0009634488961,
-	0.0009050632943,-0.0006507700891,-0.001104887226,0.0002773244632, 0.001178888255,
-	0.0001146521972,-0.001122824149,-0.0004820740432,0.0009468974313,0.0007859613397,
-	-0.0006737945951,-0.0009954143316,0.0003360048868, 0.001090481761,2.774670065e-05,
-	-0.001064593554,-0.000377451157,0.0009240408544,0.0006755295908,-0.0006876715343,
-	-0.0008912904887,0.0003839731507, 0.001003895537,-4.79232076e-05,-0.001004221383,
-	-0.0002830569865,0.0008957878454,0.0005733669386,-0.0006934495177,-0.0007926381077,
-	0.0004221686395,0.0009193488513,-0.000113351969,-0.0009426173056,-0.0001984377159,
-	0.0008628975484,0.0004792007385,-0.0006921316381,-0.0006995450822,0.0004514281754,
-	0.0008373208693,-0.0001691493671,-0.0008801539079,-0.0001229220215,0.0008263117052,
-	0.0003928740916,-0.0006844114978,-0.0006119629834,0.0004726760089,0.0007580633974,
-	-0.0002161180309,-0.000817592314,-5.613688336e-05,0.0007865887601,0.0003139992186,
-	-0.0006712859031,-0.0005300129415,0.0004866452364,0.0006819674163,-0.0002548566845,
-	-0.0007553091855,2.531388873e-06,0.0007446004893,0.0002424695267,-0.0006533868145,
-	-0.000453692337,0.0004940785584,0.0006091888645,-0.0002861071553,-0.0006939600571,
-	5.340140342e-05, 0.000700792647, 0.000177933136,-0.0006314562634,-0.0003828853951,
-	0.0004957660567,0.0005400895607,-0.0003103964846,-0.0006337946397,9.708409198e-05,
-	0.0006558755413,0.0001201330233,-0.0006061819731,-0.0003176856844,0.0004922406515,
-	0.0004746379273,-0.0003284305858,-0.000575260201,0.0001340957388,0.0006104101194,
-	6.882894377e-05,-0.0005781872314,-0.0002579483844,0.0004842211492,0.0004131390306,
-	-0.0003407369077,-0.0005187259521,0.0001647164463,0.0005647165235,2.364737702e-05,
-	-0.0005479765241,-0.0002034909994,0.0004723730381,0.0003556298907,-0.0003479109728,
-	-0.0004644561559,0.0001895538153,0.0005193653051,-1.570113091e-05,-0.0005162242451,
-	-0.0001543241524,0.0004571996687,0.0003022724122,-0.0003504144552,-0.0004126556159,
-	0.0002090012858,0.0004747159546,-4.950408402e-05,-0.0004833033017,-0.0001102487658,
-	0.0004392327392, 0.000252957514,-0.0003488281218,-0.0003635534958,0.0002235601714,
-	0.0004311045341,-7.811733667e-05,-0.0004497284535,-7.104070392e-05,0.0004190025793,
-	0.000207760022,-0.0003436879779,-0.0003172949655,0.0002336809412,0.0003889246145,
-	-0.0001018368348,-0.0004158657393,-3.652968371e-05, 0.000397052645,0.0001666563039,
-	-0.0003354178625,-0.0002740411437,0.0002397955832,0.0003484290501,-0.000120970486,
-	-0.0003821105347,-6.491604381e-06,0.0003737417865,0.0001295557595,-0.0003245646367,
-	-0.0002338924533,0.0002422657126,0.0003097546287,-0.0001360605966,-0.0003489849914,
-	1.905640602e-05,0.0003493140102,9.612179565e-05,-0.000311677868,-0.0001970380254,
-	0.000241408794,0.0002728720428,-0.0001476023026,-0.0003168523544,4.061461368e-05,
-	0.0003244335821,6.666623813e-05,-0.0002969053749,-0.000163160832,0.0002379401121,
-	0.0002385230182,-0.000155223388,-0.0002851475438,5.885127393e-05,0.0002996008843,
-	4.086046829e-05,-0.0002806208213,-0.0001322837779,0.0002321373613,0.0002062112471,
-	-0.0001601916592,-0.0002552679507,7.317958807e-05,0.0002744755184,1.826568041e-05,
-	-0.0002635783167,-0.0001046433899,0.0002242825576,0.0001765276684,-0.0001619579853,
-	-0.0002263122442,8.467928274e-05,0.0002500795526,-8.061033441e-07,-0.0002456174698,
-	-8.004170377e-05,0.0002145331237,0.0001488622365,-0.0001616656809,-0.0001993216138,
-	9.30430906e-05,0.0002261055633,-1.676815737e-05,-0.0002271380508,-5.800408326e-05,
-	0.0002037814556,0.0001239237317,-0.000159164294,-0.0001739564905,9.869073256e-05,
-	0.0002028736344,-3.017572817e-05,-0.000208739817,-3.891079177e-05,0.0001920205978,
-	0.0001013822985,-0.0001547969005,-0.0001503082312,0.0001021915887,0.0001806712826,
-	-4.089438153e-05,-0.000190503808,-2.242396295e-05,0.0001794516284,8.107384201e-05,
-	-0.0001490719296,-0.0001284759055,0.0001036449539,0.0001597217924,-4.912621444e-05,
-	-0.0001724305475,-8.355294085e-06,0.0001662555878,6.280140224e-05,-0.0001422769128,
-	-0.0001083905518,0.0001036299727, 0.000140204691,-5.521988351e-05,-0.0001552604226,
-	3.005391136e-06,0.0001527834538,4.716212061e-05,-0.0001339710143,-8.998924022e-05,
-	0.0001015341404,0.0001213699798,-5.963153671e-05,-0.0001382187183,1.296720711e-05,
-	0.0001394945284,3.307446605e-05,-0.0001256166579,-7.355987327e-05,9.874340321e-05,
-	0.0001042848744,-6.233699969e-05,-0.0001224107255,2.081814637e-05,0.0001264935418,
-	2.112217044e-05,-0.0001167320079,-5.884592611e-05, 9.48113011e-05,8.854801854e-05,
-	-6.366441812e-05,-0.0001073447129,2.715745541e-05,0.0001136512437, 1.07480455e-05,
-	-0.0001076505578,-4.550539961e-05,9.026573389e-05,7.384132914e-05,-6.40623839e-05,
-	-9.297520592e-05,3.230325456e-05,0.0001013458532,1.323077072e-06,-9.854918608e-05,
-	-3.320426185e-05,8.552427607e-05,6.004586248e-05,-6.41554434e-05,-7.937070768e-05,
-	3.72059294e-05, 8.95373887e-05,-7.709993952e-06,-9.009735368e-05,-2.122860133e-05,
-	8.186769264e-05,4.614461068e-05,-6.528083759e-05,-6.626782852e-05,4.383684427e-05,
-	7.886737876e-05,-1.948217687e-05,-8.418872312e-05,-6.13006614e-06,8.150283247e-05,
-	2.873551784e-05,-7.632540655e-05,-5.464083006e-05,5.713488645e-05,6.023365859e-05,
-	-6.902174209e-05,-0.0001258139091,-2.517419489e-05,1.196056564e-05,-0.0002206767385,
-	-0.0005575935938,-0.0006478383439,-0.0004562124377,0.0005753284786
-};
+	// banks in use cost their memory anyway, only the unused ones are dropped when they
+	// grow too large
+	size_t unused = 0;
+	for(it = cache.begin(); it != cache.end(); ++it) {
+		if(it->second.use_count() == 1)
+			unused += it->second->bytes();
+	}
+	if(unused > FilterBankCacheBytes) {
+		qDebug("dropping %u KB of unused filter banks", (uint)(unused >> 10));
+		std::map<Key, std::shared_ptr<FilterBank> >::iterator drop = cache.begin();
+		while(drop != cache.end()) {
+			if(drop->second.use_count() == 1)
+				cache.erase(drop++);
+			else ++drop;
+		}
+	}
+	return bank;
+}
 
-static const float H50[1024] = {
-	-0.0002201683965,-0.001124234404,-0.0002519988047, 4.18822965e-05,0.0001644095028,
-	-4.46531958e-05,-0.0001077375346,4.275911488e-05,8.707397501e-05,-4.416876982e-05,
-	-7.700103743e-05,4.580613677e-05,7.190064935e-05,-4.729136708e-05,-6.942736945e-05,
-	4.862881906e-05,6.855074753e-05,-4.976667333e-05,-6.865929026e-05,5.077893002e-05,
-	6.947135989e-05,-5.161690933e-05,-7.07442814e-05,5.233447155e-05,7.239126717e-05,
-	-5.288500324e-05,-7.431298582e-05,5.331666762e-05,7.649328472e-05,-5.359013812e-05,
-	-7.888133405e-05,5.377943671e-05,8.148055349e-05,-5.385737677e-05,-8.422875544e-05,
-	5.390071237e-05,8.710402471e-05,-5.385146142e-05,-9.003950254e-05,5.372981104e-05,
-	9.302133549e-05,-5.343723024e-05,-9.607585525e-05,5.299067925e-05, 9.92580899e-05,
-	-5.237601363e-05,-0.0001026094687,5.172823148e-05,0.0001060731884,-5.104521915e-05,
-	-0.0001095265543,5.034428614e-05,0.0001130066812,-4.91878709e-05,-0.0001162126136,
-	4.845962394e-05,0.0001206014567,-4.642389467e-05,-0.0001235969248,4.594980055e-05,
-	0.0001274486713,-4.471285501e-05,-0.0001315006666,4.261581853e-05,0.0001353945554,
-	-4.081060251e-05,-0.0001389547688,3.923485565e-05,0.0001423512876,-3.719221786e-05,
-	-0.0001465419919,3.562271013e-05,0.0001502662781,-3.335601286e-05,-0.0001544562401,
-	3.120724068e-05,0.0001584076963,-2.874941856e-05,-0.0001624438009, 2.61914065e-05,
-	0.0001664294687,-2.34735362e-05,-0.0001704363822,2.061099258e-05,0.0001744418114,
-	-1.762802822e-05,-0.0001784773922,1.450659056e-05,0.0001824851788,-1.12539974e-05,
-	-0.0001865083614,7.836811164e-06,0.0001904953242,-4.256826287e-06,-0.0001945169934,
-	5.177141134e-07,0.0001985221897,3.356942671e-06,-0.0002025409485,-7.365285001e-06,
-	0.0002064825094,1.152872119e-05,-0.0002104116575,-1.588577288e-05,0.0002142778394,
-	2.040378422e-05,-0.000218209083,-2.51220863e-05,0.0002219788148,2.982230399e-05,
-	-0.0002259189059,-3.497765647e-05,0.0002294303413,3.997455133e-05,-0.0002332902804,
-	-4.537210043e-05,0.0002369600697,5.091955245e-05,-0.0002404215338,-5.64807342e-05,
-	0.0002438989613,6.227963604e-05,-0.0002474751673, -6.8329653e-05,0.0002508637554,
-	7.451411511e-05,-0.0002540706773,-8.086166054e-05,0.0002572188096,8.733062714e-05,
-	-0.0002604051842,-9.392971697e-05,  0.00026342005,0.0001008247127,-0.0002664282511,
-	-0.0001079098802,0.0002692939306,0.0001150924436,-0.0002719514014,-0.0001225513697,
-	0.0002745741222,0.0001300453878,-0.0002769836865,-0.0001378051529,0.0002793380409,
-	0.000145675338,-0.0002815633197,-0.0001537354983,0.0002836465428,0.0001619598333,
-	-0.000285614864,-0.0001703530288,0.0002873861522,0.0001789444505,-0.0002890507458,
-	-0.000187693804,0.0002905290166,0.0001966245909,-0.0002918713144,-0.0002056859375,
-	0.0002930120681,0.0002149590146,-0.0002939656551,-0.0002243264171,0.0002947993053,
-	0.0002339828497,-0.0002953502408,-0.0002436212671, 0.000295813632,0.0002535696549,
-	-0.0002960074926,-0.0002636357385,0.0002959644771,0.0002738090698,-0.0002958333935,
-	-0.0002841635724,0.0002954138617,0.0002947088506,-0.0002947266039,-0.0003053376859,
-	0.0002938343678,0.0003161231871,-0.000292774319,-0.000327054091,0.0002914137149,
-	0.0003381797287,-0.0002897940867,-0.0003493894765,0.0002879189269,0.0003607122926,
-	-0.0002857971995,-0.0003721443063,0.0002834017214,0.0003837820841,-0.0002807764977,
-	-0.0003954995482,0.0002778165799,0.0004073538585,-0.0002745638485,-0.0004192966444,
-	0.0002710335248,0.0004313282552,-0.0002671922266,-0.0004434544244,0.0002630582894,
-	0.0004557292268,-0.0002586564224,-0.0004680308048, 0.000253884733,0.0004805136414,
-	-0.0002488436294,-0.0004930050927,0.0002434082126,0.0005056444206,-0.0002376889897,
-	-0.0005183088942,0.0002315836027, 0.000531044032,-0.0002251774713,-0.0005438649096,
-	0.0002183449542,0.0005566939362,-0.0002112409275,-0.0005696254084, 0.000203723248,
-	0.0005825780099,-0.0001958385692,-0.0005955225788,0.0001876099413,0.0006085796631,
-	-0.0001789575617,-0.0006216229522,0.0001699213317,0.0006346692098,-0.0001605263387,
-	-0.0006477304851,0.0001507211127,0.0006608360563,-0.0001404870418,-0.0006738861557,
-	0.0001298522693,0.0006869242643,-0.0001188188398,-0.0006999520701, 0.000107357846,
-	0.0007129873266,-9.547027003e-05,-0.0007259495324,  8.3139239e-05, 0.000738863775,
-	-7.037058094e-05,-0.0007517165504,5.718685497e-05,0.0007645369624,-4.355648707e-05,
-	-0.0007772738463,2.944906009e-05,0.0007899493212,-1.488941325e-05,-0.0008025143179,
-	-1.314797515e-07,0.0008149703499, 1.56193455e-05,-0.0008273346466,-3.156356979e-05,
-	0.0008395868354,4.798095688e-05,-0.0008516974631,-6.490501255e-05,0.0008637129795,
-	8.231179527e-05,-0.0008755432791,-0.0001002088247, 0.000887254253,0.0001186303998,
-	-0.0008987466572,-0.0001374944695,0.0009100874886,0.0001569275773,-0.0009212383302,
-	-0.0001768352959,0.0009321672842,0.0001972476603,-0.0009429349448,-0.0002182046301,
-	0.0009534443961,0.0002396732598,-0.0009637214825,-0.0002616682905, 0.000973784714,
-	0.0002842022222,-0.0009835731471,-0.0003073020489,0.0009930782253,0.0003309069434,
-	-0.001002315548,-0.0003550709516, 0.001011276967,0.0003797848767,-0.001019906835,
-	-0.0004050761054, 0.001028216095,0.0004308989446,-0.001036204165,-0.0004573014448,
-	0.001043852535,0.0004842589551,-0.001051139203,-0.000511830789,  0.00105804659,
-	0.0005399545771,-0.001064564451,-0.0005686640507, 0.001070688013,0.0005979517591,
-	-0.001076399698,-0.0006278592627,  0.00108168798,0.0006583527429,-0.001086511416,
-	-0.0006894750986, 0.001090877107,0.0007211765042,-0.001094776671,-0.0007535091718,
-	0.00109816913,0.0007864364306,-0.001101070433,-0.0008200475713, 0.001103432383,
-	0.0008542352007,-0.001105267089,-0.0008891254547, 0.001106522977, 0.000924616761,
-	-0.001107195858,-0.0009607638931,  0.00110728771,0.0009975875728,-0.001106754295,
-	-0.001035069232, 0.001105590607, 0.001073214342, -0.00110378454,-0.001112086349,
-	0.001101303147, 0.001151619479,-0.001098101959,-0.001191878342, 0.001094222767,
-	0.001232831739,-0.001089574303,-0.001274549752, 0.001084168209, 0.001316960901,
-	-0.001077975379,-0.001360129681, 0.001070989063, 0.001404063194,-0.001063157222,
-	-0.001448778552, 0.001054474153, 0.001494270167,-0.001044894219,-0.001540561556,
-	0.001034409623, 0.001587674138,-0.001022981131,-0.001635642955, 0.001010576379,
-	0.001684453222,-0.0009971598629, -0.00173413672,0.0009827136528, 0.001784708584,
-	-0.0009671979351,-0.001836203155,0.0009505824419, 0.001888652216,-0.0009327969747,
-	-0.001942063915,0.0009138541063,  0.00199647597,-0.0008936578524,-0.002051888499,
-	0.0008722249768, 0.002108391374,-0.0008494537324,-0.002165969694,0.0008253374835,
-	0.002224683762,-0.0007998011424,-0.002284585964,0.0007727895281, 0.002345683752,
-	-0.0007442527567,-0.002408033237,0.0007141465903, 0.002471720567,-0.0006823795266,
-	-0.00253674807,0.0006489004008, 0.002603217494,-0.0006136307493,-0.002671182388,
-	0.0005764906527, 0.002740706317,-0.0005373685854,-0.002811853308, 0.000496236491,
-	0.002884728601,-0.0004529416619,-0.002959409496,0.0004074009485, 0.003035987029,
-	-0.0003595036396,-0.003114558989,0.0003091252001, 0.003195285797,-0.0002561429865,
-	-0.003278247779,0.0002004024136, 0.003363619791,-0.000141732351,-0.003451509634,
-	7.999739319e-05, 0.003542126855,-1.497959147e-05,-0.003635634435,-5.349992716e-05,
-	0.003732247045,0.0001256920223,-0.003832173068,-0.000201814415, 0.003935661633,
-	0.0002821452799,-0.004043006338,-0.0003669938305, 0.004154501483,0.0004566883435,
-	-0.004270503763,-0.000551607227, 0.004391362891,0.0006521602045,-0.004517530557,
-	-0.0007587926229, 0.004649500828,0.0008720586775,-0.004787785001,-0.0009925118648,
-	0.004933031276, 0.001120841247,-0.005085934419,-0.001257802709, 0.005247266963,
-	0.0014042533,-0.005417968147,-0.001561167417, 0.005599095952, 0.001729708049,
-	-0.005791857839, -0.00191118475, 0.005997670814, 0.002107135719,-0.006218216848,
-	-0.002319378778, 0.006455411669, 0.002550051548,-0.006711589172,-0.002801637398,
-	0.006989502814, 0.003077209229,-0.007292487193,-0.003380412003, 0.007624547929,
-	0.00371570792,-0.007990649901,-0.004088609014, 0.008396904916, 0.004505935125,
-	-0.008851016872,-0.004976382945, 0.009362722747, 0.005511010531,-0.009944658726,
-	-0.006124241743,  0.01061335951, 0.006835223641, -0.01139108744,-0.007669886108,
-	0.01230829488, 0.008664326742, -0.01340798847,-0.009870192967,  0.01475281268,
-	0.01136422344, -0.01643777452, -0.01326548122,  0.01861416176,  0.01576922648,
-	-0.02153852955, -0.01921954006,  0.02568341978,  0.02428423427, -0.03202557564,
-	-0.03245319426,  0.04296230897,  0.04786489159, -0.06637062132, -0.08790100366,
-	0.1521381587,   0.4480499327,   0.4480499327,   0.1521381587, -0.08790100366,
-	-0.06637062132,  0.04786489159,  0.04296230897, -0.03245319426, -0.03202557564,
-	0.02428423427,  0.02568341978, -0.01921954006, -0.02153852955,  0.01576922648,
-	0.01861416176, -0.01326548122, -0.01643777452,  0.01136422344,  0.01475281268,
-	-0.009870192967, -0.01340798847, 0.008664326742,  0.01230829488,-0.007669886108,
-	-0.01139108744, 0.006835223641,  0.01061335951,-0.006124241743,-0.009944658726,
-	0.005511010531, 0.009362722747,-0.004976382945,-0.008851016872, 0.004505935125,
-	0.008396904916,-0.004088609014,-0.007990649901,  0.00371570792, 0.007624547929,
-	-0.003380412003,-0.007292487193, 0.003077209229, 0.006989502814,-0.002801637398,
-	-0.006711589172, 0.002550051548, 0.006455411669,-0.002319378778,-0.006218216848,
-	0.002107135719, 0.005997670814, -0.00191118475,-0.005791857839, 0.001729708049,
-	0.005599095952,-0.001561167417,-0.005417968147,   0.0014042533, 0.005247266963,
-	-0.001257802709,-0.005085934419, 0.001120841247, 0.004933031276,-0.0009925118648,
-	-0.004787785001,0.0008720586775, 0.004649500828,-0.0007587926229,-0.004517530557,
-	0.0006521602045, 0.004391362891,-0.000551607227,-0.004270503763,0.0004566883435,
-	0.004154501483,-0.0003669938305,-0.004043006338,0.0002821452799, 0.003935661633,
-	-0.000201814415,-0.003832173068,0.0001256920223, 0.003732247045,-5.349992716e-05,
-	-0.003635634435,-1.497959147e-05, 0.003542126855,7.999739319e-05,-0.003451509634,
-	-0.000141732351, 0.003363619791,0.0002004024136,-0.003278247779,-0.0002561429865,
-	0.003195285797,0.0003091252001,-0.003114558989,-0.0003595036396, 0.003035987029,
-	0.0004074009485,-0.002959409496,-0.0004529416619, 0.002884728601, 0.000496236491,
-	-0.002811853308,-0.0005373685854, 0.002740706317,0.0005764906527,-0.002671182388,
-	-0.0006136307493, 0.002603217494,0.0006489004008, -0.00253674807,-0.0006823795266,
-	0.002471720567,0.0007141465903,-0.002408033237,-0.0007442527567, 0.002345683752,
-	0.0007727895281,-0.002284585964,-0.0007998011424, 0.002224683762,0.0008253374835,
-	-0.002165969694,-0.0008494537324, 0.002108391374,0.0008722249768,-0.002051888499,
-	-0.0008936578524,  0.00199647597,0.0009138541063,-0.001942063915,-0.0009327969747,
-	0.001888652216,0.0009505824419,-0.001836203155,-0.0009671979351, 0.001784708584,
-	0.0009827136528, -0.00173413672,-0.0009971598629, 0.001684453222, 0.001010576379,
-	-0.001635642955,-0.001022981131, 0.001587674138, 0.001034409623,-0.001540561556,
-	-0.001044894219, 0.001494270167, 0.001054474153,-0.001448778552,-0.001063157222,
-	0.001404063194, 0.001070989063,-0.001360129681,-0.001077975379, 0.001316960901,
-	0.001084168209,-0.001274549752,-0.001089574303, 0.001232831739, 0.001094222767,
-	-0.001191878342,-0.001098101959, 0.001151619479, 0.001101303147,-0.001112086349,
-	-0.00110378454, 0.001073214342, 0.001105590607,-0.001035069232,-0.001106754295,
-	0.0009975875728,  0.00110728771,-0.0009607638931,-0.001107195858, 0.000924616761,
-	0.001106522977,-0.0008891254547,-0.001105267089,0.0008542352007, 0.001103432383,
-	-0.0008200475713,-0.001101070433,0.0007864364306,  0.00109816913,-0.0007535091718,
-	-0.001094776671,0.0007211765042, 0.001090877107,-0.0006894750986,-0.001086511416,
-	0.0006583527429,  0.00108168798,-0.0006278592627,-0.001076399698,0.0005979517591,
-	0.001070688013,-0.0005686640507,-0.001064564451,0.0005399545771,  0.00105804659,
-	-0.000511830789,-0.001051139203,0.0004842589551, 0.001043852535,-0.0004573014448,
-	-0.001036204165,0.0004308989446, 0.001028216095,-0.0004050761054,-0.001019906835,
-	0.0003797848767, 0.001011276967,-0.0003550709516,-0.001002315548,0.0003309069434,
-	0.0009930782253,-0.0003073020489,-0.0009835731471,0.0002842022222, 0.000973784714,
-	-0.0002616682905,-0.0009637214825,0.0002396732598,0.0009534443961,-0.0002182046301,
-	-0.0009429349448,0.0001972476603,0.0009321672842,-0.0001768352959,-0.0009212383302,
-	0.0001569275773,0.0009100874886,-0.0001374944695,-0.0008987466572,0.0001186303998,
-	0.000887254253,-0.0001002088247,-0.0008755432791,8.231179527e-05,0.0008637129795,
-	-6.490501255e-05,-0.0008516974631,4.798095688e-05,0.0008395868354,-3.156356979e-05,
-	-0.0008273346466, 1.56193455e-05,0.0008149703499,-1.314797515e-07,-0.0008025143179,
-	-1.488941325e-05,0.0007899493212,2.944906009e-05,-0.0007772738463,-4.355648707e-05,
-	0.0007645369624,5.718685497e-05,-0.0007517165504,-7.037058094e-05, 0.000738863775,
-	8.3139239e-05,-0.0007259495324,-9.547027003e-05,0.0007129873266, 0.000107357846,
-	-0.0006999520701,-0.0001188188398,0.0006869242643,0.0001298522693,-0.0006738861557,
-	-0.0001404870418,0.0006608360563,0.0001507211127,-0.0006477304851,-0.0001605263387,
-	0.0006346692098,0.0001699213317,-0.0006216229522,-0.0001789575617,0.0006085796631,
-	0.0001876099413,-0.0005955225788,-0.0001958385692,0.0005825780099, 0.000203723248,
-	-0.0005696254084,-0.0002112409275,0.0005566939362,0.0002183449542,-0.0005438649096,
-	-0.0002251774713, 0.000531044032,0.0002315836027,-0.0005183088942,-0.0002376889897,
-	0.0005056444206,0.0002434082126,-0.0004930050927,-0.0002488436294,0.0004805136414,
-	0.000253884733,-0.0004680308048,-0.0002586564224,0.0004557292268,0.0002630582894,
-	-0.0004434544244,-0.0002671922266,0.0004313282552,0.0002710335248,-0.0004192966444,
-	-0.0002745638485,0.0004073538585,0.0002778165799,-0.0003954995482,-0.0002807764977,
-	0.0003837820841,0.0002834017214,-0.0003721443063,-0.0002857971995,0.0003607122926,
-	0.0002879189269,-0.0003493894765,-0.0002897940867,0.0003381797287,0.0002914137149,
-	-0.000327054091,-0.000292774319,0.0003161231871,0.0002938343678,-0.0003053376859,
-	-0.0002947266039,0.0002947088506,0.0002954138617,-0.0002841635724,-0.0002958333935,
-	0.0002738090698,0.0002959644771,-0.0002636357385,-0.0002960074926,0.0002535696549,
-	0.000295813632,-0.0002436212671,-0.0002953502408,0.0002339828497,0.0002947993053,
-	-0.0002243264171,-0.0002939656551,0.0002149590146,0.0002930120681,-0.0002056859375,
-	-0.0002918713144,0.0001966245909,0.0002905290166,-0.000187693804,-0.0002890507458,
-	0.0001789444505,0.0002873861522,-0.0001703530288,-0.000285614864,0.0001619598333,
-	0.0002836465428,-0.0001537354983,-0.0002815633197, 0.000145675338,0.0002793380409,
-	-0.0001378051529,-0.0002769836865,0.0001300453878,0.0002745741222,-0.0001225513697,
-	-0.0002719514014,0.0001150924436,0.0002692939306,-0.0001079098802,-0.0002664282511,
-	0.0001008247127,  0.00026342005,-9.392971697e-05,-0.0002604051842,8.733062714e-05,
-	0.0002572188096,-8.086166054e-05,-0.0002540706773,7.451411511e-05,0.0002508637554,
-	-6.8329653e-05,-0.0002474751673,6.227963604e-05,0.0002438989613,-5.64807342e-05,
-	-0.0002404215338,5.091955245e-05,0.0002369600697,-4.537210043e-05,-0.0002332902804,
-	3.997455133e-05,0.0002294303413,-3.497765647e-05,-0.0002259189059,2.982230399e-05,
-	0.0002219788148,-2.51220863e-05,-0.000218209083,2.040378422e-05,0.0002142778394,
-	-1.588577288e-05,-0.0002104116575,1.152872119e-05,0.0002064825094,-7.365285001e-06,
-	-0.0002025409485,3.356942671e-06,0.0001985221897,5.177141134e-07,-0.0001945169934,
-	-4.256826287e-06,0.0001904953242,7.836811164e-06,-0.0001865083614,-1.12539974e-05,
-	0.0001824851788,1.450659056e-05,-0.0001784773922,-1.762802822e-05,0.0001744418114,
-	2.061099258e-05,-0.0001704363822,-2.34735362e-05,0.0001664294687, 2.61914065e-05,
-	-0.0001624438009,-2.874941856e-05,0.0001584076963,3.120724068e-05,-0.0001544562401,
-	-3.335601286e-05,0.0001502662781,3.562271013e-05,-0.0001465419919,-3.719221786e-05,
-	0.0001423512876,3.923485565e-05,-0.0001389547688,-4.081060251e-05,0.0001353945554,
-	4.261581853e-05,-0.0001315006666,-4.471285501e-05,0.0001274486713,4.594980055e-05,
-	-0.0001235969248,-4.642389467e-05,0.0001206014567,4.845962394e-05,-0.0001162126136,
-	-4.91878709e-05,0.0001130066812,5.034428614e-05,-0.0001095265543,-5.104521915e-05,
-	0.0001060731884,5.172823148e-05,-0.0001026094687,-5.237601363e-05, 9.92580899e-05,
-	5.299067925e-05,-9.607585525e-05,-5.343723024e-05,9.302133549e-05,5.372981104e-05,
-	-9.003950254e-05,-5.385146142e-05,8.710402471e-05,5.390071237e-05,-8.422875544e-05,
-	-5.385737677e-05,8.148055349e-05,5.377943671e-05,-7.888133405e-05,-5.359013812e-05,
-	7.649328472e-05,5.331666762e-05,-7.431298582e-05,-5.288500324e-05,7.239126717e-05,
-	5.233447155e-05,-7.07442814e-05,-5.161690933e-05,6.947135989e-05,5.077893002e-05,
-	-6.865929026e-05,-4.976667333e-05,6.855074753e-05,4.862881906e-05,-6.942736945e-05,
-	-4.729136708e-05,7.190064935e-05,4.580613677e-05,-7.700103743e-05,-4.416876982e-05,
-	8.707397501e-05,4.275911488e-05,-0.0001077375346,-4.46531958e-05,0.0001644095028,
-	4.18822965e-05,-0.0002519988047,-0.001124234404,-0.0002201683965
-};
+// every phase in Q15, stored in window order so no phase is read backwards; the taps of one
+// phase stay well below 1.0 and their absolute sum close to it, so 16 bit samples times
+// taps accumulate in 32 bit without overflow. Each full octave of attenuation moves the
+// fixed point up by one bit instead, so attenuated taps keep their resolution.
+void SSEInterpolator::createFixedTaps(int phases, int tapsPerPhase, double gain, FilterBank* bank)
+{
+	double scale = 32768.0;
+	bank->fixedShift = 15;
+	while((gain <= 0.5) && (bank->fixedShift < 30)) {
+		gain *= 2.0;
+		scale *= 2.0;
+		bank->fixedShift++;
+	}
 
-static const float H55[1024] = {
-	-0.0009004492313,-1.893673289e-05,0.0004828149977,0.0004930134164,0.0001852398273,
-	0.0001511411829,0.0002780786599, 0.000174249406,2.994705574e-05,0.0001116242129,
-	0.000164318335,2.576535189e-05,-1.125209747e-05,0.0001072124724,8.068193711e-05,
-	-4.767960127e-05,5.381106348e-06, 0.000104013081,8.341132343e-06,-6.950239913e-05,
-	4.498613634e-05, 8.24140443e-05,-5.060120748e-05,-5.105387754e-05, 8.14287414e-05,
-	3.86060965e-05,-8.575514221e-05,-5.51021094e-06,9.561829211e-05,-1.83465163e-05,
-	-8.809089923e-05,4.888905096e-05,7.816818106e-05,-7.139471563e-05,-5.658389637e-05,
-	9.162109927e-05,3.163773727e-05,-0.0001023086152,-8.461082075e-07,0.0001056512119,
-	-3.015808943e-05,-9.863414016e-05,6.063064939e-05, 8.29669807e-05,-8.658492152e-05,
-	-5.854361734e-05,0.0001064694952,2.809720354e-05,-0.0001177124068,6.264508556e-06,
-	0.0001189601171,-4.134925257e-05,-0.0001091835293,7.471287972e-05,8.917460946e-05,
-	-0.0001032806686,-6.058057261e-05,0.0001238059194,2.544295967e-05,-0.0001339199953,
-	1.398510813e-05,0.0001327147911,-5.400606824e-05,-0.0001199492835,9.068747022e-05,
-	9.561591287e-05,-0.0001210097689,-6.153466529e-05,0.0001422372152,2.078491889e-05,
-	-0.0001515361946,2.364313514e-05,0.0001475908066,-6.827280595e-05,-0.0001307328348,
-	0.0001084858013,0.0001014060399,-0.0001407913223,-6.156178279e-05,0.0001622800628,
-	1.484578024e-05,-0.0001701600704,3.526857472e-05,0.0001631114428,-8.464912389e-05,
-	-0.0001416887244,0.0001283582242,0.0001065593096,-0.0001625609148,-6.043448229e-05,
-	0.0001840269833,7.258233836e-06, -0.00018974251,4.906487811e-05,0.0001790831302,
-	-0.0001034105226,-0.0001522659877,0.0001505499531,0.0001106152922,-0.0001865090453,
-	-5.754885206e-05,0.0002073080832,-2.755839432e-06,-0.0002105449967, 6.55027543e-05,
-	0.0001955288317,-0.0001245915628,-0.0001623496646,0.0001752216922,0.0001134315244,
-	-0.0002124684688, -5.2815245e-05,0.0002321571228,-1.514426913e-05,-0.0002322444343,
-	8.425251872e-05,0.0002117146214,-0.0001486976835,-0.0001716278784,0.0002025546273,
-	0.0001150127209,-0.0002403637627,-4.572772741e-05, 0.000258597167,-3.006065162e-05,
-	-0.0002546591568, 0.000106031257,0.0002278033498,-0.0001757614955,-0.000180113886,
-	0.0002323879162,0.0001144712369,-0.0002706906816,-3.632853986e-05,0.0002865517454,
-	-4.792499021e-05,-0.0002775563335,0.0001311622909,0.0002438637748,-0.0002057388629,
-	-0.0001871189743,0.0002650975075,0.0001119638619,-0.0003031376982,-2.41322814e-05,
-	0.0003156746388,-6.916299753e-05,-0.0003010158252, 0.000159515359,0.0002589384385,
-	-0.0002392470487,-0.0001926529367,0.0003006924526,0.0001069772479,-0.0003376422974,
-	-8.67194467e-06,0.0003462580789,-9.380051779e-05,-0.0003244444088, 0.000191744155,
-	0.0002733820584,-0.0002760749194,-0.000196203473, 0.000339091639,9.906585183e-05,
-	-0.0003743892594, 1.01867272e-05,0.0003777445236,-0.0001224761945,-0.0003480666201,
-	0.0002276548184,0.0002863841364,-0.0003165670787,-0.0001974732295,0.0003805290908,
-	8.80633379e-05, -0.00041296173,3.305704377e-05,0.0004103263491,-0.0001551498281,
-	-0.0003711162426,0.0002679224417,0.0002980398131,-0.0003607133694,-0.0001960198424,
-	0.0004249298945,7.337926945e-05,-0.0004537245841,5.995587344e-05,0.0004434773582,
-	-0.0001924868411,-0.0003938260488,0.0003123953065,0.0003076625871,-0.0004088268906,
-	-0.000191588013,0.0004723007441,5.462476838e-05,-0.0004963063984,9.160875925e-05,
-	0.0004772984248,-0.0002345763787,-0.0004154498747,0.0003617019102,0.0003151226847,
-	-0.0004608657327, -0.00018342986,0.0005228782538,3.148629912e-05,-0.0005406127311,
-	0.0001283226302,0.0005112842191,-0.0002820082009,-0.0004359302402,0.0004157842195,
-	0.000319638144,-0.0005172538804,-0.0001714453247,0.0005763172521,3.240469141e-06,
-	-0.0005865654093,0.0001705278846,0.0005452809273,-0.0003349840699,-0.0004546868731,
-	0.0004750581575,0.0003209972638,-0.0005778206396,-0.0001547783904,0.0006328714662,
-	-3.03840352e-05,-0.0006338329404,0.0002188509097,0.0005790298455,-0.0003938722075,
-	-0.0004712651134,0.0005399096408,0.0003186974209,-0.0006427936023,-0.0001330503874,
-	0.0006923844921,-7.013826689e-05,-0.000682466547,0.0002735036833,0.0006119577447,
-	-0.0004593453486,-0.0004854408035,0.0006103476626, 0.000311975542,-0.0007124618278,
-	-0.0001056842957,0.0007548058638,-0.0001165641152,-0.0007321167504,0.0003353481588,
-	0.0006439759163,-0.0005315988674,-0.0004964700784,0.0006869944627,0.0003004253085,
-	-0.0007867818931,-7.182810805e-05,0.0008203072939,-0.0001702790323,-0.0007825250505,
-	0.0004049859999,0.0006746563013,-0.0006112442934,-0.0005037856754,0.0007702042349,
-	0.0002833432227,-0.0008660591557,-3.082713374e-05,0.0008887049626,-0.0002321434731,
-	-0.0008335895254, 0.000483001204,0.0007033403381,-0.0006990294787,-0.0005069782492,
-	0.0008601928712,0.0002597087005,-0.0009506294737,1.806677574e-05,0.0009599531768,
-	-0.0003031136584,-0.0008850550512,0.0005702275666,0.0007296854747,-0.0007955330075,
-	-0.0005051473854,0.0009576908196,0.0002289742115, -0.00104057393,7.602204278e-05,
-	0.001034219749,-0.0003839736455,-0.0009365627193,0.0006677033962,0.0007531472947,
-	-0.0009015435935,-0.0004975617048, 0.001063295174,0.0001900455682, -0.00113630644,
-	0.0001440487686, 0.001111533842,-0.0004759427684,-0.0009878011188,0.0007765399641,
-	0.0007731734077,-0.001018076553,-0.0004833249259, 0.001177678234,0.0001417482272,
-	-0.001238380792,0.0002234162093, 0.001191884745,-0.0005805028486,-0.001038693939,
-	0.0008979482809,0.0007889484987,-0.001146403141,-0.0004615279031, 0.001301768003,
-	8.271588013e-05,-0.001347379293,0.0003156305465, 0.001275495626,-0.0006992673152,
-	-0.001088813297,  0.00103366503,0.0007998309447,-0.001287946245,-0.0004308088101,
-	0.00143686519,1.145565057e-05,-0.001464034547,0.0004227226309, 0.001362720737,
-	-0.000834244187,-0.001137908082,   0.0011857606,0.0008049063617,-0.001444593188,
-	-0.0003897471179, 0.001584526151,-7.402923075e-05,-0.001589374966,0.0005470617907,
-	0.001454053563,-0.0009879759746,-0.001185589819, 0.001356928609,0.0008032250917,
-	-0.001618721988,-0.000336468016, 0.001746795839,-0.0001762136962,-0.001724899863,
-	0.0006915593985, 0.001549983281,-0.001163906651,-0.001231697155, 0.001550456509,
-	0.0007933255401,-0.001813694602,-0.0002688392997, 0.001926301047,-0.0002983611193,
-	-0.001872594701,0.0008600890287, 0.001651452156,-0.001366402139,-0.001275943825,
-	0.001770847826,0.0007736529806,-0.002033732133,-0.0001838590833, 0.002126753563,
-	-0.0004445738159,-0.002035084646, 0.001057864167, 0.001759813866,-0.001601273543,
-	-0.001318004332, 0.002024252666, 0.000742139644,-0.002284721239,-7.765407645e-05,
-	0.002353246324,-0.0006204726524,-0.002216162626, 0.001291917171,  0.00187701697,
-	-0.001876610797,-0.001357633038, 0.002319169231,0.0006960376631,-0.002574901097,
-	5.515527664e-05,  0.00261306297,-0.0008338141488,-0.002421209589, 0.001572254463,
-	0.002006050898,-0.002203793731,-0.001394520514, 0.002667837776,0.0006315583596,
-	-0.002916154917,0.0002221834147, 0.002916716505,-0.001095940708, -0.00265833037,
-	0.001913241809, 0.002151188208,-0.002599766711, -0.00142849551, 0.003088271944,
-	0.0005430702586,-0.003326384118,0.0004346917849,  0.00328018656,-0.001423673937,
-	-0.002939721104, 0.002336862497, 0.002319317777,-0.003090219572,-0.001459282357,
-	0.003608432366,0.0004220990813,-0.003833389143,0.0007102353266, 0.003728650743,
-	-0.001843608799,-0.003284968669, 0.002877984662, 0.002521513496,-0.003716645529,
-	-0.001486665569, 0.004273776431,0.0002548525808,-0.004483118188, 0.001077666995,
-	0.004304078408, -0.00240020128,-0.003727277275, 0.003595666727, 0.002776776208,
-	-0.004550380167,-0.001510511269, 0.005163564812,1.727579001e-05,-0.005356882699,
-	0.00158823526, 0.005082041025,-0.003173764795,-0.004327333532, 0.004598598927,
-	0.003120715264,-0.005724977236,-0.001530609443, 0.006429273635,-0.0003367074532,
-	-0.006613110192, 0.002342886524, 0.006213185377,-0.004325880669,-0.005208985414,
-	0.006110946648, 0.003627848579,-0.007523090113, -0.00154688675, 0.008400356397,
-	-0.0009088202496,-0.008607184514,  0.00357104768, 0.008046345785,-0.006237098947,
-	-0.006669448689, 0.008680461906, 0.004484243225, -0.01066407468,-0.001559167518,
-	0.01195396204,-0.001975891413, -0.01233304571, 0.005932107102,  0.01161326934,
-	-0.01006689947,-0.009644469246,  0.01409137249, 0.006318881642,  -0.0176767204,
-	-0.001567400643,  0.02045783587,-0.004655161873, -0.02202553488,  0.01240632776,
-	0.02189410664, -0.02183463052, -0.01940510608,  0.03336493671,  0.01345182024,
-	-0.0482098721,-0.001571549801,  0.07021234185, -0.02410824597,  -0.1164572537,
-	0.1134001687,    0.482152313,    0.482152313,   0.1134001687,  -0.1164572537,
-	-0.02410824597,  0.07021234185,-0.001571549801,  -0.0482098721,  0.01345182024,
-	0.03336493671, -0.01940510608, -0.02183463052,  0.02189410664,  0.01240632776,
-	-0.02202553488,-0.004655161873,  0.02045783587,-0.001567400643,  -0.0176767204,
-	0.006318881642,  0.01409137249,-0.009644469246, -0.01006689947,  0.01161326934,
-	0.005932107102, -0.01233304571,-0.001975891413,  0.01195396204,-0.001559167518,
-	-0.01066407468, 0.004484243225, 0.008680461906,-0.006669448689,-0.006237098947,
-	0.008046345785,  0.00357104768,-0.008607184514,-0.0009088202496, 0.008400356397,
-	-0.00154688675,-0.007523090113, 0.003627848579, 0.006110946648,-0.005208985414,
-	-0.004325880669, 0.006213185377, 0.002342886524,-0.006613110192,-0.0003367074532,
-	0.006429273635,-0.001530609443,-0.005724977236, 0.003120715264, 0.004598598927,
-	-0.004327333532,-0.003173764795, 0.005082041025,  0.00158823526,-0.005356882699,
-	1.727579001e-05, 0.005163564812,-0.001510511269,-0.004550380167, 0.002776776208,
-	0.003595666727,-0.003727277275, -0.00240020128, 0.004304078408, 0.001077666995,
-	-0.004483118188,0.0002548525808, 0.004273776431,-0.001486665569,-0.003716645529,
-	0.002521513496, 0.002877984662,-0.003284968669,-0.001843608799, 0.003728650743,
-	0.0007102353266,-0.003833389143,0.0004220990813, 0.003608432366,-0.001459282357,
-	-0.003090219572, 0.002319317777, 0.002336862497,-0.002939721104,-0.001423673937,
-	0.00328018656,0.0004346917849,-0.003326384118,0.0005430702586, 0.003088271944,
-	-0.00142849551,-0.002599766711, 0.002151188208, 0.001913241809, -0.00265833037,
-	-0.001095940708, 0.002916716505,0.0002221834147,-0.002916154917,0.0006315583596,
-	0.002667837776,-0.001394520514,-0.002203793731, 0.002006050898, 0.001572254463,
-	-0.002421209589,-0.0008338141488,  0.00261306297,5.515527664e-05,-0.002574901097,
-	0.0006960376631, 0.002319169231,-0.001357633038,-0.001876610797,  0.00187701697,
-	0.001291917171,-0.002216162626,-0.0006204726524, 0.002353246324,-7.765407645e-05,
-	-0.002284721239, 0.000742139644, 0.002024252666,-0.001318004332,-0.001601273543,
-	0.001759813866, 0.001057864167,-0.002035084646,-0.0004445738159, 0.002126753563,
-	-0.0001838590833,-0.002033732133,0.0007736529806, 0.001770847826,-0.001275943825,
-	-0.001366402139, 0.001651452156,0.0008600890287,-0.001872594701,-0.0002983611193,
-	0.001926301047,-0.0002688392997,-0.001813694602,0.0007933255401, 0.001550456509,
-	-0.001231697155,-0.001163906651, 0.001549983281,0.0006915593985,-0.001724899863,
-	-0.0001762136962, 0.001746795839,-0.000336468016,-0.001618721988,0.0008032250917,
-	0.001356928609,-0.001185589819,-0.0009879759746, 0.001454053563,0.0005470617907,
-	-0.001589374966,-7.402923075e-05, 0.001584526151,-0.0003897471179,-0.001444593188,
-	0.0008049063617,   0.0011857606,-0.001137908082,-0.000834244187, 0.001362720737,
-	0.0004227226309,-0.001464034547,1.145565057e-05,  0.00143686519,-0.0004308088101,
-	-0.001287946245,0.0007998309447,  0.00103366503,-0.001088813297,-0.0006992673152,
-	0.001275495626,0.0003156305465,-0.001347379293,8.271588013e-05, 0.001301768003,
-	-0.0004615279031,-0.001146403141,0.0007889484987,0.0008979482809,-0.001038693939,
-	-0.0005805028486, 0.001191884745,0.0002234162093,-0.001238380792,0.0001417482272,
-	0.001177678234,-0.0004833249259,-0.001018076553,0.0007731734077,0.0007765399641,
-	-0.0009878011188,-0.0004759427684, 0.001111533842,0.0001440487686, -0.00113630644,
-	0.0001900455682, 0.001063295174,-0.0004975617048,-0.0009015435935,0.0007531472947,
-	0.0006677033962,-0.0009365627193,-0.0003839736455, 0.001034219749,7.602204278e-05,
-	-0.00104057393,0.0002289742115,0.0009576908196,-0.0005051473854,-0.0007955330075,
-	0.0007296854747,0.0005702275666,-0.0008850550512,-0.0003031136584,0.0009599531768,
-	1.806677574e-05,-0.0009506294737,0.0002597087005,0.0008601928712,-0.0005069782492,
-	-0.0006990294787,0.0007033403381, 0.000483001204,-0.0008335895254,-0.0002321434731,
-	0.0008887049626,-3.082713374e-05,-0.0008660591557,0.0002833432227,0.0007702042349,
-	-0.0005037856754,-0.0006112442934,0.0006746563013,0.0004049859999,-0.0007825250505,
-	-0.0001702790323,0.0008203072939,-7.182810805e-05,-0.0007867818931,0.0003004253085,
-	0.0006869944627,-0.0004964700784,-0.0005315988674,0.0006439759163,0.0003353481588,
-	-0.0007321167504,-0.0001165641152,0.0007548058638,-0.0001056842957,-0.0007124618278,
-	0.000311975542,0.0006103476626,-0.0004854408035,-0.0004593453486,0.0006119577447,
-	0.0002735036833,-0.000682466547,-7.013826689e-05,0.0006923844921,-0.0001330503874,
-	-0.0006427936023,0.0003186974209,0.0005399096408,-0.0004712651134,-0.0003938722075,
-	0.0005790298455,0.0002188509097,-0.0006338329404,-3.03840352e-05,0.0006328714662,
-	-0.0001547783904,-0.0005778206396,0.0003209972638,0.0004750581575,-0.0004546868731,
-	-0.0003349840699,0.0005452809273,0.0001705278846,-0.0005865654093,3.240469141e-06,
-	0.0005763172521,-0.0001714453247,-0.0005172538804, 0.000319638144,0.0004157842195,
-	-0.0004359302402,-0.0002820082009,0.0005112842191,0.0001283226302,-0.0005406127311,
-	3.148629912e-05,0.0005228782538, -0.00018342986,-0.0004608657327,0.0003151226847,
-	0.0003617019102,-0.0004154498747,-0.0002345763787,0.0004772984248,9.160875925e-05,
-	-0.0004963063984,5.462476838e-05,0.0004723007441,-0.000191588013,-0.0004088268906,
-	0.0003076625871,0.0003123953065,-0.0003938260488,-0.0001924868411,0.0004434773582,
-	5.995587344e-05,-0.0004537245841,7.337926945e-05,0.0004249298945,-0.0001960198424,
-	-0.0003607133694,0.0002980398131,0.0002679224417,-0.0003711162426,-0.0001551498281,
-	0.0004103263491,3.305704377e-05, -0.00041296173, 8.80633379e-05,0.0003805290908,
-	-0.0001974732295,-0.0003165670787,0.0002863841364,0.0002276548184,-0.0003480666201,
-	-0.0001224761945,0.0003777445236, 1.01867272e-05,-0.0003743892594,9.906585183e-05,
-	0.000339091639,-0.000196203473,-0.0002760749194,0.0002733820584, 0.000191744155,
-	-0.0003244444088,-9.380051779e-05,0.0003462580789,-8.67194467e-06,-0.0003376422974,
-	0.0001069772479,0.0003006924526,-0.0001926529367,-0.0002392470487,0.0002589384385,
-	0.000159515359,-0.0003010158252,-6.916299753e-05,0.0003156746388,-2.41322814e-05,
-	-0.0003031376982,0.0001119638619,0.0002650975075,-0.0001871189743,-0.0002057388629,
-	0.0002438637748,0.0001311622909,-0.0002775563335,-4.792499021e-05,0.0002865517454,
-	-3.632853986e-05,-0.0002706906816,0.0001144712369,0.0002323879162,-0.000180113886,
-	-0.0001757614955,0.0002278033498, 0.000106031257,-0.0002546591568,-3.006065162e-05,
-	0.000258597167,-4.572772741e-05,-0.0002403637627,0.0001150127209,0.0002025546273,
-	-0.0001716278784,-0.0001486976835,0.0002117146214,8.425251872e-05,-0.0002322444343,
-	-1.514426913e-05,0.0002321571228, -5.2815245e-05,-0.0002124684688,0.0001134315244,
-	0.0001752216922,-0.0001623496646,-0.0001245915628,0.0001955288317, 6.55027543e-05,
-	-0.0002105449967,-2.755839432e-06,0.0002073080832,-5.754885206e-05,-0.0001865090453,
-	0.0001106152922,0.0001505499531,-0.0001522659877,-0.0001034105226,0.0001790831302,
-	4.906487811e-05, -0.00018974251,7.258233836e-06,0.0001840269833,-6.043448229e-05,
-	-0.0001625609148,0.0001065593096,0.0001283582242,-0.0001416887244,-8.464912389e-05,
-	0.0001631114428,3.526857472e-05,-0.0001701600704,1.484578024e-05,0.0001622800628,
-	-6.156178279e-05,-0.0001407913223,0.0001014060399,0.0001084858013,-0.0001307328348,
-	-6.827280595e-05,0.0001475908066,2.364313514e-05,-0.0001515361946,2.078491889e-05,
-	0.0001422372152,-6.153466529e-05,-0.0001210097689,9.561591287e-05,9.068747022e-05,
-	-0.0001199492835,-5.400606824e-05,0.0001327147911,1.398510813e-05,-0.0001339199953,
-	2.544295967e-05,0.0001238059194,-6.058057261e-05,-0.0001032806686,8.917460946e-05,
-	7.471287972e-05,-0.0001091835293,-4.134925257e-05,0.0001189601171,6.264508556e-06,
-	-0.0001177124068,2.809720354e-05,0.0001064694952,-5.854361734e-05,-8.658492152e-05,
-	8.29669807e-05,6.063064939e-05,-9.863414016e-05,-3.015808943e-05,0.0001056512119,
-	-8.461082075e-07,-0.0001023086152,3.163773727e-05,9.162109927e-05,-5.658389637e-05,
-	-7.139471563e-05,7.816818106e-05,4.888905096e-05,-8.809089923e-05,-1.83465163e-05,
-	9.561829211e-05,-5.51021094e-06,-8.575514221e-05, 3.86060965e-05, 8.14287414e-05,
-	-5.105387754e-05,-5.060120748e-05, 8.24140443e-05,4.498613634e-05,-6.950239913e-05,
-	8.341132343e-06, 0.000104013081,5.381106348e-06,-4.767960127e-05,8.068193711e-05,
-	0.0001072124724,-1.125209747e-05,2.576535189e-05, 0.000164318335,0.0001116242129,
-	2.994705574e-05, 0.000174249406,0.0002780786599,0.0001511411829,0.0001852398273,
-	0.0004930134164,0.0004828149977,-1.893673289e-05,-0.0009004492313
-};
+	bank->fixedTaps.resize(phases * tapsPerPhase);
+	for(int phase = 0; phase < phases; ++phase) {
+		// see phaseCoefficients()
+		bool reversed = (2 * phase < phases);
+		const float* coeff = &bank->taps[(reversed ? phase : phases - phase) * tapsPerPhase];
+		for(int i = 0; i < tapsPerPhase; ++i) {
+			long tap = lrint((reversed ? coeff[tapsPerPhase - 1 - i] : coeff[i]) * scale);
+			if(tap > 32767)
+				tap = 32767;
+			else if(tap < -32768)
+				tap = -32768;
+			bank->fixedTaps[phase * tapsPerPhase + i] = (qint16)tap;
+		}
+	}
+}
 
-static const float H60[1024] = {
-	0.0001355133863, 0.001188795897,0.0003105644137,-0.0001587886072,-8.380683721e-05,
-	0.0001358812733,-2.462879456e-05,-8.882745897e-05,7.836006262e-05,2.671258153e-05,
-	-8.936505037e-05,3.345785444e-05, 6.39934151e-05,-7.409853424e-05,-1.536815398e-05,
-	8.345826063e-05,-3.775584628e-05,-5.999196947e-05,7.590324822e-05,1.303017052e-05,
-	-8.517277456e-05,3.988907702e-05,6.185443635e-05,-7.907168765e-05,-1.410454297e-05,
-	8.940642147e-05,-4.080084545e-05,-6.619773194e-05,8.241020259e-05,1.700982102e-05,
-	-9.468932694e-05,4.061141226e-05,7.197785453e-05,-8.557004185e-05,-2.139245771e-05,
-	0.000100639445,-3.951952021e-05,-7.897379692e-05,8.865285781e-05,2.680243415e-05,
-	-0.0001071526713,3.788154208e-05, 8.65986658e-05,-9.152777784e-05,-3.29028735e-05,
-	0.0001136259016,-3.536503573e-05,-9.484538896e-05,9.380483243e-05, 4.01639918e-05,
-	-0.0001205438093, 3.21968655e-05,0.0001038076953,-9.609937842e-05,-4.774657646e-05,
-	0.0001270364155,-2.819910696e-05,-0.0001134353661, 9.72628477e-05,5.592613888e-05,
-	-0.0001345458586,2.311325443e-05,0.0001228183974,-9.829296323e-05,-6.544902135e-05,
-	0.0001408407406,-1.83101547e-05,-0.0001332357351,9.910100198e-05,7.612276386e-05,
-	-0.0001470890275,1.150611115e-05,0.0001431045675,-9.866305481e-05,-8.627466013e-05,
-	0.0001532458991,-4.819548394e-06,-0.0001537503267,9.818535182e-05, 9.76319061e-05,
-	-0.000159501913,-3.099299647e-06,0.0001648195757,-9.667276754e-05,-0.0001097487766,
-	0.0001651864732,1.202660314e-05,-0.0001759393199,9.430144564e-05,0.0001225086598,
-	-0.0001704767637,-2.17723973e-05,0.0001872195426,-9.119966126e-05,-0.0001357959409,
-	0.0001753175166,3.240038859e-05,-0.0001985049021,8.716119191e-05,0.0001497797639,
-	-0.0001796384458,-4.400799298e-05,0.0002099454723,-8.226678619e-05,-0.0001642841526,
-	0.0001833806891,5.654775305e-05,-0.0002212578111,7.631406334e-05,0.0001794622221,
-	-0.0001864974911,-7.00027158e-05,0.0002325340611,-6.931095413e-05,-0.0001950408623,
-	0.0001889202395,8.463750419e-05,-0.0002435418428,6.146595842e-05,0.0002112866787,
-	-0.0001903649827,-0.0001000351986,0.0002544769377,-5.227922156e-05,-0.0002277666499,
-	0.000191123996,0.0001165031645,-0.0002651188988,4.185425132e-05,0.0002446915314,
-	-0.0001908321865,-0.0001337670838,0.0002754524467,-3.040616502e-05,-0.0002621332533,
-	0.0001895512687,0.0001522243838,-0.0002851237368,1.761846943e-05, 0.000279679487,
-	-0.0001872455614,-0.0001714735408,0.0002945136221,-3.633380629e-06,-0.000297672028,
-	0.0001838152239,0.0001918525668,-0.0003031917731,-1.18427306e-05,0.0003157757747,
-	-0.000178988601,-0.000213097228,0.0003111368278,2.859488995e-05,-0.0003339234099,
-	0.0001729570649,0.0002351814182,-0.0003183180525,-4.670604903e-05,0.0003521852486,
-	-0.000165572681,-0.0002581705921, 0.000324684137,6.621513603e-05,-0.0003703810798,
-	0.0001566989231, 0.000282031222,-0.0003300753306,-8.718322351e-05,0.0003884779871,
-	-0.0001463408262,-0.0003066742793, 0.000334351178,0.0001095521584,-0.0004064202949,
-	0.0001343289914,0.0003319730749,-0.0003375412489,-0.0001334652479,0.0004239899863,
-	-0.0001207187233,-0.0003580581979,0.0003394288942,0.0001587683219,-0.000441198441,
-	0.0001053990127,0.0003847792977,-0.0003399288689,-0.0001855431619,0.0004578694061,
-	-8.831203013e-05,-0.0004120976955,0.0003390134661,0.0002138417622,-0.000473943277,
-	6.93308175e-05,0.0004398281453,-0.0003365396988,-0.000243535309,0.0004893629812,
-	-4.842762064e-05,-0.0004680856073,0.0003323165292,0.0002747020335,-0.0005038746167,
-	2.559002132e-05,0.0004965968546,-0.000326371548,-0.000307287788, 0.000517510809,
-	-7.155831554e-07,-0.0005254529533, 0.000318494509,0.0003412786173,-0.0005299978657,
-	-2.624360422e-05,0.0005543695297,-0.0003086189681,-0.0003765998408,0.0005413225153,
-	5.523143045e-05,-0.000583382498, 0.000296696584,0.0004132673203,-0.0005513671204,
-	-8.640219312e-05,0.0006123829517,-0.0002825454576,-0.0004512275336,0.0005599208525,
-	0.0001198071841,-0.0006411928916,0.0002661047329,0.0004904473899,-0.0005668433732,
-	-0.0001553589682,0.0006697414792,-0.0002472258057,-0.0005307990359,0.0005720522604,
-	0.0001931681327,-0.0006978785386,0.0002258381282,0.0005722707137, -0.00057541352,
-	-0.0002332617878,0.0007254675147,-0.0002018309024,-0.0006147798267,0.0005767414114,
-	0.0002756309405,-0.0007524159737,0.0001750783122,0.0006582505885,-0.000575884711,
-	-0.0003202722583,0.0007785374764,-0.0001455220481,-0.0007026477251,0.0005726694362,
-	0.0003672547755,-0.0008036736981,0.0001130541568,0.0007477903855,-0.0005670153769,
-	-0.0004165375431, 0.000827703916,-7.752234524e-05,-0.0007936580805,0.0005586656043,
-	0.0004681230057,-0.000850431039,3.890492371e-05,0.0008401027881,-0.0005475516082,
-	-0.0005220376188,0.0008717458113,2.953447392e-06,-0.0008870494203,0.0005334148882,
-	0.000578244566,-0.0008914062055,-4.813644409e-05,0.0009343537386,-0.0005161805893,
-	-0.0006367359892,0.0009092815453,9.671771113e-05,-0.000981958583,0.0004955906188,
-	0.000697513402,-0.0009251853335,-0.0001488874259, 0.001029638806,-0.0004714957613,
-	-0.0007605497958,0.0009388574399,0.0002046425943,-0.001077289693,0.0004437172902,
-	0.0008258044836,-0.0009501577006,-0.0002640993334, 0.001124806935,-0.0004120662925,
-	-0.0008932568599,0.0009588600951, 0.000327386515,-0.001172010438,0.0003763301647,
-	0.0009629154229,-0.0009647291154,-0.0003946112993, 0.001218739897,-0.0003363192955,
-	-0.001034686691,0.0009675569017,0.0004658935941, -0.00126481778,0.0002918005921,
-	0.001108558732,-0.0009670966538,-0.0005413098843, 0.001310116728,-0.000242540802,
-	-0.001184509136,0.0009630827699,0.0006210040301,-0.001354402164,0.0001883546938,
-	0.001262491802,-0.0009552678093,-0.0007051217253, 0.001397541608,-0.0001289173524,
-	-0.00134246808, 0.000943362189,0.0007937840419,-0.001439278712,6.402190775e-05,
-	0.001424446469,-0.0009270735318,-0.0008871617028, 0.001479465282,6.697305707e-06,
-	-0.001508339774,0.0009060840821, 0.000985438237,-0.001517810626,-8.347503172e-05,
-	0.001594186993,-0.0008800320793, -0.00108877616, 0.001554177492,0.0001667188044,
-	-0.001681933762,0.0008485655999, 0.001197426231,-0.001588242361,-0.0002567928168,
-	0.001771567622,-0.0008112807991,-0.001311609987, 0.001619806746,0.0003540973412,
-	-0.001863115467,0.0007677736576,  0.00143164699,-0.001648590434,-0.0004591497418,
-	0.001956614433,-0.0007175105857,-0.001557859476, 0.001674288069,0.0005724767689,
-	-0.002052089665,0.0006599606713, 0.001690636622,-0.001696576364,-0.0006946609938,
-	0.002149594948,-0.0005945473677,-0.001830439433, 0.001715132152,0.0008264336502,
-	-0.002249238547,0.0005205890047, 0.001977798762,-0.001729588374,-0.0009686155827,
-	0.002351153642,-0.0004372778349,-0.002133375034, 0.001739511499, 0.001122115413,
-	-0.002455512295,0.0003437380074, 0.002297915751,-0.001744469395,-0.001288106199,
-	0.002562526148,-0.0002389106376,-0.002472360851, 0.001743899193, 0.001467844471,
-	-0.002672531875,0.0001215773227, 0.002657792764,-0.001737249666,-0.001662982046,
-	0.002785862423,9.714022781e-06,  -0.0028555959, 0.001723797177, 0.001875381102,
-	-0.002903050277,-0.0001567040308, 0.003067422891,-0.001702756039,-0.002107399981,
-	0.003024721052,0.0003215261095,-0.003295355942, 0.001673131599, 0.002361896215,
-	-0.003151679877,-0.0005067868042,  0.00354195619,-0.001633782871,-0.002642461564,
-	0.003284984501,0.0007157183136,-0.003810515627, 0.001583243953, 0.002953643445,
-	-0.003425986739,-0.000952449278, 0.004105157219,-0.001519713318,-0.003301197197,
-	0.003576453542, 0.001222215709,-0.004431322217, 0.001440892927, 0.003692644183,
-	-0.003738774918,-0.001531857764, 0.004796138033, -0.00134378369,-0.004137977492,
-	0.003916106187, 0.001890531159,-0.005209173542, 0.001224380569,  0.00465066405,
-	-0.004112783354,-0.002310637152, 0.005683566909,-0.001077201334,-0.005249290261,
-	0.004334891681, 0.002809518715,-0.006237819791,0.0008945890004, 0.005960419308,
-	-0.004591176286, -0.00341215753,  0.00689883437,-0.0006652993034,-0.006823052187,
-	0.004894675221, 0.004155876115,-0.007707200479,0.0003723549598, 0.007897154428,
-	-0.00526561914,-0.005099082831, 0.008727100678,1.138564949e-05,-0.009279614314,
-	0.00573715847, 0.006338495295, -0.01006635372,-0.0005320649361,   0.0111379046,
-	-0.006367551629,-0.008046756499,  0.01192091685,  0.00127509539, -0.01378844306,
-	0.007269307505,   0.0105650099, -0.01468785666,-0.002418200253,  0.01790948026,
-	-0.008691494353, -0.01467466354,  0.01931215264, 0.004402406048, -0.02526466735,
-	0.01131639443,   0.0226457864, -0.02872842364,-0.008706454188,  0.04232108593,
-	-0.01792598702, -0.04500348493,  0.05891486257,   0.0252592098,  -0.1272838563,
-	0.06839580834,   0.5132819414,   0.5132819414,  0.06839580834,  -0.1272838563,
-	0.0252592098,  0.05891486257, -0.04500348493, -0.01792598702,  0.04232108593,
-	-0.008706454188, -0.02872842364,   0.0226457864,  0.01131639443, -0.02526466735,
-	0.004402406048,  0.01931215264, -0.01467466354,-0.008691494353,  0.01790948026,
-	-0.002418200253, -0.01468785666,   0.0105650099, 0.007269307505, -0.01378844306,
-	0.00127509539,  0.01192091685,-0.008046756499,-0.006367551629,   0.0111379046,
-	-0.0005320649361, -0.01006635372, 0.006338495295,  0.00573715847,-0.009279614314,
-	1.138564949e-05, 0.008727100678,-0.005099082831, -0.00526561914, 0.007897154428,
-	0.0003723549598,-0.007707200479, 0.004155876115, 0.004894675221,-0.006823052187,
-	-0.0006652993034,  0.00689883437, -0.00341215753,-0.004591176286, 0.005960419308,
-	0.0008945890004,-0.006237819791, 0.002809518715, 0.004334891681,-0.005249290261,
-	-0.001077201334, 0.005683566909,-0.002310637152,-0.004112783354,  0.00465066405,
-	0.001224380569,-0.005209173542, 0.001890531159, 0.003916106187,-0.004137977492,
-	-0.00134378369, 0.004796138033,-0.001531857764,-0.003738774918, 0.003692644183,
-	0.001440892927,-0.004431322217, 0.001222215709, 0.003576453542,-0.003301197197,
-	-0.001519713318, 0.004105157219,-0.000952449278,-0.003425986739, 0.002953643445,
-	0.001583243953,-0.003810515627,0.0007157183136, 0.003284984501,-0.002642461564,
-	-0.001633782871,  0.00354195619,-0.0005067868042,-0.003151679877, 0.002361896215,
-	0.001673131599,-0.003295355942,0.0003215261095, 0.003024721052,-0.002107399981,
-	-0.001702756039, 0.003067422891,-0.0001567040308,-0.002903050277, 0.001875381102,
-	0.001723797177,  -0.0028555959,9.714022781e-06, 0.002785862423,-0.001662982046,
-	-0.001737249666, 0.002657792764,0.0001215773227,-0.002672531875, 0.001467844471,
-	0.001743899193,-0.002472360851,-0.0002389106376, 0.002562526148,-0.001288106199,
-	-0.001744469395, 0.002297915751,0.0003437380074,-0.002455512295, 0.001122115413,
-	0.001739511499,-0.002133375034,-0.0004372778349, 0.002351153642,-0.0009686155827,
-	-0.001729588374, 0.001977798762,0.0005205890047,-0.002249238547,0.0008264336502,
-	0.001715132152,-0.001830439433,-0.0005945473677, 0.002149594948,-0.0006946609938,
-	-0.001696576364, 0.001690636622,0.0006599606713,-0.002052089665,0.0005724767689,
-	0.001674288069,-0.001557859476,-0.0007175105857, 0.001956614433,-0.0004591497418,
-	-0.001648590434,  0.00143164699,0.0007677736576,-0.001863115467,0.0003540973412,
-	0.001619806746,-0.001311609987,-0.0008112807991, 0.001771567622,-0.0002567928168,
-	-0.001588242361, 0.001197426231,0.0008485655999,-0.001681933762,0.0001667188044,
-	0.001554177492, -0.00108877616,-0.0008800320793, 0.001594186993,-8.347503172e-05,
-	-0.001517810626, 0.000985438237,0.0009060840821,-0.001508339774,6.697305707e-06,
-	0.001479465282,-0.0008871617028,-0.0009270735318, 0.001424446469,6.402190775e-05,
-	-0.001439278712,0.0007937840419, 0.000943362189, -0.00134246808,-0.0001289173524,
-	0.001397541608,-0.0007051217253,-0.0009552678093, 0.001262491802,0.0001883546938,
-	-0.001354402164,0.0006210040301,0.0009630827699,-0.001184509136,-0.000242540802,
-	0.001310116728,-0.0005413098843,-0.0009670966538, 0.001108558732,0.0002918005921,
-	-0.00126481778,0.0004658935941,0.0009675569017,-0.001034686691,-0.0003363192955,
-	0.001218739897,-0.0003946112993,-0.0009647291154,0.0009629154229,0.0003763301647,
-	-0.001172010438, 0.000327386515,0.0009588600951,-0.0008932568599,-0.0004120662925,
-	0.001124806935,-0.0002640993334,-0.0009501577006,0.0008258044836,0.0004437172902,
-	-0.001077289693,0.0002046425943,0.0009388574399,-0.0007605497958,-0.0004714957613,
-	0.001029638806,-0.0001488874259,-0.0009251853335, 0.000697513402,0.0004955906188,
-	-0.000981958583,9.671771113e-05,0.0009092815453,-0.0006367359892,-0.0005161805893,
-	0.0009343537386,-4.813644409e-05,-0.0008914062055, 0.000578244566,0.0005334148882,
-	-0.0008870494203,2.953447392e-06,0.0008717458113,-0.0005220376188,-0.0005475516082,
-	0.0008401027881,3.890492371e-05,-0.000850431039,0.0004681230057,0.0005586656043,
-	-0.0007936580805,-7.752234524e-05, 0.000827703916,-0.0004165375431,-0.0005670153769,
-	0.0007477903855,0.0001130541568,-0.0008036736981,0.0003672547755,0.0005726694362,
-	-0.0007026477251,-0.0001455220481,0.0007785374764,-0.0003202722583,-0.000575884711,
-	0.0006582505885,0.0001750783122,-0.0007524159737,0.0002756309405,0.0005767414114,
-	-0.0006147798267,-0.0002018309024,0.0007254675147,-0.0002332617878, -0.00057541352,
-	0.0005722707137,0.0002258381282,-0.0006978785386,0.0001931681327,0.0005720522604,
-	-0.0005307990359,-0.0002472258057,0.0006697414792,-0.0001553589682,-0.0005668433732,
-	0.0004904473899,0.0002661047329,-0.0006411928916,0.0001198071841,0.0005599208525,
-	-0.0004512275336,-0.0002825454576,0.0006123829517,-8.640219312e-05,-0.0005513671204,
-	0.0004132673203, 0.000296696584,-0.000583382498,5.523143045e-05,0.0005413225153,
-	-0.0003765998408,-0.0003086189681,0.0005543695297,-2.624360422e-05,-0.0005299978657,
-	0.0003412786173, 0.000318494509,-0.0005254529533,-7.155831554e-07, 0.000517510809,
-	-0.000307287788,-0.000326371548,0.0004965968546,2.559002132e-05,-0.0005038746167,
-	0.0002747020335,0.0003323165292,-0.0004680856073,-4.842762064e-05,0.0004893629812,
-	-0.000243535309,-0.0003365396988,0.0004398281453, 6.93308175e-05,-0.000473943277,
-	0.0002138417622,0.0003390134661,-0.0004120976955,-8.831203013e-05,0.0004578694061,
-	-0.0001855431619,-0.0003399288689,0.0003847792977,0.0001053990127,-0.000441198441,
-	0.0001587683219,0.0003394288942,-0.0003580581979,-0.0001207187233,0.0004239899863,
-	-0.0001334652479,-0.0003375412489,0.0003319730749,0.0001343289914,-0.0004064202949,
-	0.0001095521584, 0.000334351178,-0.0003066742793,-0.0001463408262,0.0003884779871,
-	-8.718322351e-05,-0.0003300753306, 0.000282031222,0.0001566989231,-0.0003703810798,
-	6.621513603e-05, 0.000324684137,-0.0002581705921,-0.000165572681,0.0003521852486,
-	-4.670604903e-05,-0.0003183180525,0.0002351814182,0.0001729570649,-0.0003339234099,
-	2.859488995e-05,0.0003111368278,-0.000213097228,-0.000178988601,0.0003157757747,
-	-1.18427306e-05,-0.0003031917731,0.0001918525668,0.0001838152239,-0.000297672028,
-	-3.633380629e-06,0.0002945136221,-0.0001714735408,-0.0001872455614, 0.000279679487,
-	1.761846943e-05,-0.0002851237368,0.0001522243838,0.0001895512687,-0.0002621332533,
-	-3.040616502e-05,0.0002754524467,-0.0001337670838,-0.0001908321865,0.0002446915314,
-	4.185425132e-05,-0.0002651188988,0.0001165031645, 0.000191123996,-0.0002277666499,
-	-5.227922156e-05,0.0002544769377,-0.0001000351986,-0.0001903649827,0.0002112866787,
-	6.146595842e-05,-0.0002435418428,8.463750419e-05,0.0001889202395,-0.0001950408623,
-	-6.931095413e-05,0.0002325340611,-7.00027158e-05,-0.0001864974911,0.0001794622221,
-	7.631406334e-05,-0.0002212578111,5.654775305e-05,0.0001833806891,-0.0001642841526,
-	-8.226678619e-05,0.0002099454723,-4.400799298e-05,-0.0001796384458,0.0001497797639,
-	8.716119191e-05,-0.0001985049021,3.240038859e-05,0.0001753175166,-0.0001357959409,
-	-9.119966126e-05,0.0001872195426,-2.17723973e-05,-0.0001704767637,0.0001225086598,
-	9.430144564e-05,-0.0001759393199,1.202660314e-05,0.0001651864732,-0.0001097487766,
-	-9.667276754e-05,0.0001648195757,-3.099299647e-06,-0.000159501913, 9.76319061e-05,
-	9.818535182e-05,-0.0001537503267,-4.819548394e-06,0.0001532458991,-8.627466013e-05,
-	-9.866305481e-05,0.0001431045675,1.150611115e-05,-0.0001470890275,7.612276386e-05,
-	9.910100198e-05,-0.0001332357351,-1.83101547e-05,0.0001408407406,-6.544902135e-05,
-	-9.829296323e-05,0.0001228183974,2.311325443e-05,-0.0001345458586,5.592613888e-05,
-	9.72628477e-05,-0.0001134353661,-2.819910696e-05,0.0001270364155,-4.774657646e-05,
-	-9.609937842e-05,0.0001038076953, 3.21968655e-05,-0.0001205438093, 4.01639918e-05,
-	9.380483243e-05,-9.484538896e-05,-3.536503573e-05,0.0001136259016,-3.29028735e-05,
-	-9.152777784e-05, 8.65986658e-05,3.788154208e-05,-0.0001071526713,2.680243415e-05,
-	8.865285781e-05,-7.897379692e-05,-3.951952021e-05, 0.000100639445,-2.139245771e-05,
-	-8.557004185e-05,7.197785453e-05,4.061141226e-05,-9.468932694e-05,1.700982102e-05,
-	8.241020259e-05,-6.619773194e-05,-4.080084545e-05,8.940642147e-05,-1.410454297e-05,
-	-7.907168765e-05,6.185443635e-05,3.988907702e-05,-8.517277456e-05,1.303017052e-05,
-	7.590324822e-05,-5.999196947e-05,-3.775584628e-05,8.345826063e-05,-1.536815398e-05,
-	-7.409853424e-05, 6.39934151e-05,3.345785444e-05,-8.936505037e-05,2.671258153e-05,
-	7.836006262e-05,-8.882745897e-05,-2.462879456e-05,0.0001358812733,-8.380683721e-05,
-	-0.0001587886072,0.0003105644137, 0.001188795897,0.0001355133863
-};
+// zeroth order modified Bessel function of the first kind
+static double besselI0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+	for(int k = 1; k < 50; ++k) {
+		term *= (x * 0.5 / k) * (x * 0.5 / k);
+		sum += term;
+		if(term < sum * 1e-12)
+			break;
+	}
+	return sum;
+}
 
-static const float H65[1024] = {
-	0.0009643432568,0.0007515865145,-0.0003163349465, 5.07317709e-05,1.992854232e-05,
-	4.794877168e-05,-0.000142995108,0.0001649894839,-9.171713464e-05,-1.036701087e-05,
-	5.012009206e-05,9.990037597e-07,-8.122038707e-05,0.0001008144318,-3.464286056e-05,
-	-5.090708873e-05, 6.73225004e-05,1.141668463e-06,-7.893393922e-05,  7.9376754e-05,
-	8.103388041e-07,-7.611637557e-05,6.433967064e-05,2.246462827e-05,-8.905760478e-05,
-	6.049796139e-05,3.399164052e-05,-9.133686399e-05,4.648149115e-05,  5.1486546e-05,
-	-9.651849541e-05,3.391242353e-05,6.617954205e-05,-9.454508836e-05,1.802032239e-05,
-	8.140255522e-05,-9.226090333e-05,-2.175387408e-07,9.427686746e-05,-8.448802691e-05,
-	-2.016986582e-05,0.0001046343095,-7.40760006e-05,-4.003585855e-05,0.0001120507513,
-	-6.029054202e-05,-6.033564205e-05,0.0001162744957,-4.317172352e-05,-8.011799946e-05,
-	0.0001164469431,-2.295415652e-05,-9.853937809e-05,0.0001123635448,-4.661086166e-07,
-	-0.0001145094502,0.0001037607508,2.372442577e-05,-0.0001272512309,9.068259533e-05,
-	4.882165013e-05,-0.0001364030613,7.313003152e-05,7.356746937e-05,-0.0001412650745,
-	5.191114178e-05,9.761988622e-05,-0.0001408427925,2.718196993e-05,0.0001194119031,
-	-0.0001353824337,-2.164619701e-07,0.0001386818913,-0.0001246278407,-2.951788883e-05,
-	0.0001538568031,-0.0001083696552,-5.95263482e-05,0.0001642697316,-8.710841939e-05,
-	-8.93975448e-05,0.0001695111569,-6.128101813e-05,-0.0001180312902,0.0001688446355,
-	-3.148570977e-05,-0.0001440999331, 0.000161674674,1.527111294e-06,-0.0001665735908,
-	0.0001481964282, 3.65873675e-05,-0.0001841881603,0.0001284957252, 7.24086276e-05,
-	-0.0001962090755,0.0001026282043,0.0001078143105,-0.0002017694787,7.155592903e-05,
-	0.0001415475854,-0.0002003396949,3.584893057e-05, 0.000172034037,-0.0001912879234,
-	-3.385955779e-06,0.0001982001268,-0.0001748637005,-4.485875979e-05, 0.000218689238,
-	-0.0001509472786,-8.716572484e-05,0.0002322473156,-0.0001199682811,-0.0001288449275,
-	0.0002382439416,-8.286733646e-05,-0.000168273109,0.0002359111531,-4.057698243e-05,
-	-0.0002038635721,0.0002246275835,5.789325314e-06,-0.0002341658692,0.0002046297741,
-	5.458483429e-05,-0.0002575267572,0.0001759898441,0.0001041334835,-0.0002729226253,
-	0.0001392685372,0.0001528146968,-0.0002792588202,9.546271031e-05,0.0001986135321,
-	-0.000275786384,4.561665992e-05,0.0002398769138,-0.0002620682062,-8.690360119e-06,
-	0.0002746806713,-0.000238112596,-6.560662587e-05,0.0003013711248,-0.0002040838153,
-	-0.0001234524389, 0.000318701088,-0.0001608366583,-0.000179881652,0.0003253715113,
-	-0.0001093788451,-0.0002328188275, 0.000320592866,-5.111992141e-05,-0.0002803607495,
-	0.0003040163429,1.204832461e-05,-0.0003201953659,0.0002754810848, 7.82653442e-05,
-	-0.0003506077919,0.0002354455355,0.0001451364078,-0.0003700052912,0.0001848705142,
-	0.0002102859435,-0.0003769969917,0.0001248212793,0.0002713582362,-0.0003708259028,
-	5.720526315e-05, 0.000325802539,-0.0003508980153,-1.60760992e-05, 0.000371344242,
-	-0.0003172579454,-9.256460908e-05,0.0004058449413,-0.0002705076477,-0.0001696498512,
-	0.0004274758394,-0.0002115439711,-0.0002446593717,0.0004349148367,-0.0001419888285,
-	-0.0003146019299,0.0004270148347,-6.377224054e-05,-0.0003768478346,0.0004033592122,
-	2.077095087e-05,-0.0004287548072,0.0003641003859,0.0001087395067,-0.0004677659599,
-	0.000309628027,0.0001973364851,-0.0004920083447,0.0002414149058,0.0002832121681,
-	-0.0004997947835,0.0001610952604,0.0003632279404,-0.000490005943,7.097222988e-05,
-	0.0004342206521,-0.0004622046254,-2.610144838e-05,0.0004931189469,-0.0004163794219,
-	-0.0001270911016,0.0005372720188,-0.0003534474235,-0.0002284480433,0.0005643172772,
-	-0.0002747640538,-0.0003265994892, 0.000572508492,-0.0001823576167,-0.0004178886884,
-	0.0005606174236,-7.898954937e-05,-0.0004985982669,0.0005280272453,3.232685413e-05,
-	-0.0005654873094,0.0004750753287,0.0001477531041,-0.0006152755814,0.0004024534428,
-	0.0002636022982,-0.000645558408,0.0003120405599,0.0003754991631,-0.0006541792536,
-	0.00020610512,0.0004793895641,-0.0006398683763,8.770032582e-05, 0.000571161625,
-	-0.0006020537112,-3.942705007e-05,0.0006468771608,-0.0005408657016,-0.000171293228,
-	0.000703174388,-0.0004575243802,-0.000303283945,0.0007370251697,-0.0003538841265,
-	-0.0004307155032,0.0007462007925,-0.0002326705871,-0.0005489044706,0.0007292358787,
-	-9.745077114e-05,-0.000653060386,0.0006854173262,4.769990119e-05,-0.0007389343809,
-	0.0006151547423,0.0001979405934,-0.0008024547133,0.0005195710692,0.0003483486653,
-	-0.0008405062836,0.0004010760458,0.0004933301243,-0.0008502902347, 0.000262596528,
-	0.0006276886561,-0.0008303828072,0.0001082991221,0.0007459942135,-0.0007799167652,
-	-5.716736268e-05,0.0008433504845,-0.0006993014249,-0.0002284383809,0.0009153222782,
-	-0.0005900471588,-0.0003996184096,0.0009580655606,-0.0004545589036,-0.0005647360231,
-	0.0009688251303,-0.0002965827007,-0.0007175216451,0.0009455812396,-0.0001205027511,
-	-0.00085207948, 0.000887649192,6.816323003e-05,-0.000962696271,0.0007953864406,
-	0.000263367634,-0.001044340082,  0.00067045982,0.0004585145798,-0.001092785969,
-	0.0005157959531,0.0006466414779,-0.001104654395,0.0003353670763,0.0008208052022,
-	-0.001077890513,0.0001344366465,0.0009741080576,-0.001011490356,-8.097236423e-05,
-	0.001100229681,-0.0009060212178,-0.0003038096183, 0.001193257747,-0.0007632018533,
-	-0.0005266882945, 0.001248476678,-0.0005864272243,-0.0007415963919, 0.001261957921,
-	-0.0003801810381,-0.0009406658937, 0.001231324743,-0.0001503794483,  -0.0011160539,
-	0.001155454665,9.601953207e-05,-0.001260384219, 0.001034759916,0.0003512111725,
-	-0.001367149409,0.0008714184514,0.0006064908812,-0.001430576667,0.0006689371075,
-	0.0008530354244,-0.001446429756,0.0004326043418, 0.001081594499,-0.001411659643,
-	0.0001689722703, 0.001283306046,-0.001325019752,-0.0001139982705, 0.001449659467,
-	-0.001186870155,-0.0004074109602, 0.001573067158,-0.0009994971333,-0.0007014087751,
-	0.00164692488,-0.0007668989128,-0.0009857759578, 0.001666133991,-0.0004949320573,
-	-0.001249984489, 0.001627155347,-0.000191067913,-0.001483720378, 0.001528274617,
-	0.0001357673755,-0.001677215332, 0.001369814388,0.0004752765817,-0.001821474638,
-	0.001154050115,0.0008163530729,-0.001908880542,0.0008855449269, 0.001147026429,
-	-0.001933147665,0.0005706188967, 0.001455351827,-0.001890112064,0.0002178938594,
-	0.001729110489, -0.00177730713,-0.0001626502926, 0.001957008382,-0.001594914007,
-	-0.0005591501249, 0.002128318185,-0.001345110009,-0.0009588830872, 0.002233936684,
-	-0.001032818574,-0.001347997808, 0.002266198862,-0.0006650539581,-0.001712488243,
-	0.002219743561,-0.0002513988293,-0.002038066741, 0.002091252478,0.0001967872522,
-	-0.00231125392, 0.001880291384,0.0006659276551,-0.002519119065, 0.001588775543,
-	0.001141349087,-0.002650537295, 0.001221822691, 0.001606846228,-0.002695845906,
-	0.0007869785768, 0.002045926405,-0.002647958929,0.0002948314068, 0.002441572025,
-	-0.002502088901,-0.0002417559153, 0.002777362708,-0.002256596461,-0.0008073747158,
-	0.003037523245,-0.001912742388,-0.001384876319, 0.003207836067,-0.001475227415,
-	-0.001955359476, 0.003275810741,-0.000951897935, -0.00249901833, 0.003231504932,
-	-0.0003540327598,-0.002995296847, 0.003067627316,0.0003040949523,-0.003423798596,
-	0.00278020883, 0.001005157479,-0.003764551831, 0.002368675312, 0.001729292213,
-	-0.003998815082, 0.001836212119, 0.002454364207, -0.00410954887, 0.001189868315,
-	0.003156448714,-0.004081967287,0.0004405491054, 0.003810340306,-0.003904048121,
-	-0.00039698201, 0.004390086513,-0.003566980595,-0.001304224017, 0.004869533703,
-	-0.003065523924,-0.002259189961, 0.005222874228,-0.002398244571,-0.003236717312,
-	0.005425203126,-0.001567791798,-0.004208716564, 0.005452914163,-0.0005808740389,
-	-0.005144589581,  0.00528407516,0.0005517493119,-0.006011620164,  0.00489874417,
-	0.001815308351,-0.006775070447, 0.004278785549, 0.003191486234,-0.007398604415,
-	0.003407912096, 0.004658523947,   -0.007843934, 0.002270853147, 0.006191848312,
-	-0.00807050243,0.0008522465359, 0.007764590904,-0.008034376428,-0.0008652578108,
-	0.009348028339, -0.00768582942,-0.002904627239,  0.01091252547,-0.006965507288,
-	-0.00529989507,   0.0124279391,-0.005796469748,-0.008106629364,  0.01386459544,
-	-0.004069928546, -0.01142055541,  0.01519382279,-0.001615970046, -0.01541575231,
-	0.0163887497, 0.001859675278, -0.02042928524,  0.01742498763, 0.006930400152,
-	-0.02717757598,  0.01828111149,  0.01489707734, -0.03742993623,  0.01893939823,
-	0.02947730571, -0.05688338727,   0.0193860624,  0.06718237698,  -0.1187326834,
-	0.01961177029,   0.5412471294,   0.5412471294,  0.01961177029,  -0.1187326834,
-	0.06718237698,   0.0193860624, -0.05688338727,  0.02947730571,  0.01893939823,
-	-0.03742993623,  0.01489707734,  0.01828111149, -0.02717757598, 0.006930400152,
-	0.01742498763, -0.02042928524, 0.001859675278,   0.0163887497, -0.01541575231,
-	-0.001615970046,  0.01519382279, -0.01142055541,-0.004069928546,  0.01386459544,
-	-0.008106629364,-0.005796469748,   0.0124279391, -0.00529989507,-0.006965507288,
-	0.01091252547,-0.002904627239, -0.00768582942, 0.009348028339,-0.0008652578108,
-	-0.008034376428, 0.007764590904,0.0008522465359, -0.00807050243, 0.006191848312,
-	0.002270853147,   -0.007843934, 0.004658523947, 0.003407912096,-0.007398604415,
-	0.003191486234, 0.004278785549,-0.006775070447, 0.001815308351,  0.00489874417,
-	-0.006011620164,0.0005517493119,  0.00528407516,-0.005144589581,-0.0005808740389,
-	0.005452914163,-0.004208716564,-0.001567791798, 0.005425203126,-0.003236717312,
-	-0.002398244571, 0.005222874228,-0.002259189961,-0.003065523924, 0.004869533703,
-	-0.001304224017,-0.003566980595, 0.004390086513, -0.00039698201,-0.003904048121,
-	0.003810340306,0.0004405491054,-0.004081967287, 0.003156448714, 0.001189868315,
-	-0.00410954887, 0.002454364207, 0.001836212119,-0.003998815082, 0.001729292213,
-	0.002368675312,-0.003764551831, 0.001005157479,  0.00278020883,-0.003423798596,
-	0.0003040949523, 0.003067627316,-0.002995296847,-0.0003540327598, 0.003231504932,
-	-0.00249901833,-0.000951897935, 0.003275810741,-0.001955359476,-0.001475227415,
-	0.003207836067,-0.001384876319,-0.001912742388, 0.003037523245,-0.0008073747158,
-	-0.002256596461, 0.002777362708,-0.0002417559153,-0.002502088901, 0.002441572025,
-	0.0002948314068,-0.002647958929, 0.002045926405,0.0007869785768,-0.002695845906,
-	0.001606846228, 0.001221822691,-0.002650537295, 0.001141349087, 0.001588775543,
-	-0.002519119065,0.0006659276551, 0.001880291384, -0.00231125392,0.0001967872522,
-	0.002091252478,-0.002038066741,-0.0002513988293, 0.002219743561,-0.001712488243,
-	-0.0006650539581, 0.002266198862,-0.001347997808,-0.001032818574, 0.002233936684,
-	-0.0009588830872,-0.001345110009, 0.002128318185,-0.0005591501249,-0.001594914007,
-	0.001957008382,-0.0001626502926, -0.00177730713, 0.001729110489,0.0002178938594,
-	-0.001890112064, 0.001455351827,0.0005706188967,-0.001933147665, 0.001147026429,
-	0.0008855449269,-0.001908880542,0.0008163530729, 0.001154050115,-0.001821474638,
-	0.0004752765817, 0.001369814388,-0.001677215332,0.0001357673755, 0.001528274617,
-	-0.001483720378,-0.000191067913, 0.001627155347,-0.001249984489,-0.0004949320573,
-	0.001666133991,-0.0009857759578,-0.0007668989128,  0.00164692488,-0.0007014087751,
-	-0.0009994971333, 0.001573067158,-0.0004074109602,-0.001186870155, 0.001449659467,
-	-0.0001139982705,-0.001325019752, 0.001283306046,0.0001689722703,-0.001411659643,
-	0.001081594499,0.0004326043418,-0.001446429756,0.0008530354244,0.0006689371075,
-	-0.001430576667,0.0006064908812,0.0008714184514,-0.001367149409,0.0003512111725,
-	0.001034759916,-0.001260384219,9.601953207e-05, 0.001155454665,  -0.0011160539,
-	-0.0001503794483, 0.001231324743,-0.0009406658937,-0.0003801810381, 0.001261957921,
-	-0.0007415963919,-0.0005864272243, 0.001248476678,-0.0005266882945,-0.0007632018533,
-	0.001193257747,-0.0003038096183,-0.0009060212178, 0.001100229681,-8.097236423e-05,
-	-0.001011490356,0.0009741080576,0.0001344366465,-0.001077890513,0.0008208052022,
-	0.0003353670763,-0.001104654395,0.0006466414779,0.0005157959531,-0.001092785969,
-	0.0004585145798,  0.00067045982,-0.001044340082, 0.000263367634,0.0007953864406,
-	-0.000962696271,6.816323003e-05, 0.000887649192, -0.00085207948,-0.0001205027511,
-	0.0009455812396,-0.0007175216451,-0.0002965827007,0.0009688251303,-0.0005647360231,
-	-0.0004545589036,0.0009580655606,-0.0003996184096,-0.0005900471588,0.0009153222782,
-	-0.0002284383809,-0.0006993014249,0.0008433504845,-5.716736268e-05,-0.0007799167652,
-	0.0007459942135,0.0001082991221,-0.0008303828072,0.0006276886561, 0.000262596528,
-	-0.0008502902347,0.0004933301243,0.0004010760458,-0.0008405062836,0.0003483486653,
-	0.0005195710692,-0.0008024547133,0.0001979405934,0.0006151547423,-0.0007389343809,
-	4.769990119e-05,0.0006854173262,-0.000653060386,-9.745077114e-05,0.0007292358787,
-	-0.0005489044706,-0.0002326705871,0.0007462007925,-0.0004307155032,-0.0003538841265,
-	0.0007370251697,-0.000303283945,-0.0004575243802, 0.000703174388,-0.000171293228,
-	-0.0005408657016,0.0006468771608,-3.942705007e-05,-0.0006020537112, 0.000571161625,
-	8.770032582e-05,-0.0006398683763,0.0004793895641,  0.00020610512,-0.0006541792536,
-	0.0003754991631,0.0003120405599,-0.000645558408,0.0002636022982,0.0004024534428,
-	-0.0006152755814,0.0001477531041,0.0004750753287,-0.0005654873094,3.232685413e-05,
-	0.0005280272453,-0.0004985982669,-7.898954937e-05,0.0005606174236,-0.0004178886884,
-	-0.0001823576167, 0.000572508492,-0.0003265994892,-0.0002747640538,0.0005643172772,
-	-0.0002284480433,-0.0003534474235,0.0005372720188,-0.0001270911016,-0.0004163794219,
-	0.0004931189469,-2.610144838e-05,-0.0004622046254,0.0004342206521,7.097222988e-05,
-	-0.000490005943,0.0003632279404,0.0001610952604,-0.0004997947835,0.0002832121681,
-	0.0002414149058,-0.0004920083447,0.0001973364851, 0.000309628027,-0.0004677659599,
-	0.0001087395067,0.0003641003859,-0.0004287548072,2.077095087e-05,0.0004033592122,
-	-0.0003768478346,-6.377224054e-05,0.0004270148347,-0.0003146019299,-0.0001419888285,
-	0.0004349148367,-0.0002446593717,-0.0002115439711,0.0004274758394,-0.0001696498512,
-	-0.0002705076477,0.0004058449413,-9.256460908e-05,-0.0003172579454, 0.000371344242,
-	-1.60760992e-05,-0.0003508980153, 0.000325802539,5.720526315e-05,-0.0003708259028,
-	0.0002713582362,0.0001248212793,-0.0003769969917,0.0002102859435,0.0001848705142,
-	-0.0003700052912,0.0001451364078,0.0002354455355,-0.0003506077919, 7.82653442e-05,
-	0.0002754810848,-0.0003201953659,1.204832461e-05,0.0003040163429,-0.0002803607495,
-	-5.111992141e-05, 0.000320592866,-0.0002328188275,-0.0001093788451,0.0003253715113,
-	-0.000179881652,-0.0001608366583, 0.000318701088,-0.0001234524389,-0.0002040838153,
-	0.0003013711248,-6.560662587e-05,-0.000238112596,0.0002746806713,-8.690360119e-06,
-	-0.0002620682062,0.0002398769138,4.561665992e-05,-0.000275786384,0.0001986135321,
-	9.546271031e-05,-0.0002792588202,0.0001528146968,0.0001392685372,-0.0002729226253,
-	0.0001041334835,0.0001759898441,-0.0002575267572,5.458483429e-05,0.0002046297741,
-	-0.0002341658692,5.789325314e-06,0.0002246275835,-0.0002038635721,-4.057698243e-05,
-	0.0002359111531,-0.000168273109,-8.286733646e-05,0.0002382439416,-0.0001288449275,
-	-0.0001199682811,0.0002322473156,-8.716572484e-05,-0.0001509472786, 0.000218689238,
-	-4.485875979e-05,-0.0001748637005,0.0001982001268,-3.385955779e-06,-0.0001912879234,
-	0.000172034037,3.584893057e-05,-0.0002003396949,0.0001415475854,7.155592903e-05,
-	-0.0002017694787,0.0001078143105,0.0001026282043,-0.0001962090755, 7.24086276e-05,
-	0.0001284957252,-0.0001841881603, 3.65873675e-05,0.0001481964282,-0.0001665735908,
-	1.527111294e-06, 0.000161674674,-0.0001440999331,-3.148570977e-05,0.0001688446355,
-	-0.0001180312902,-6.128101813e-05,0.0001695111569,-8.93975448e-05,-8.710841939e-05,
-	0.0001642697316,-5.95263482e-05,-0.0001083696552,0.0001538568031,-2.951788883e-05,
-	-0.0001246278407,0.0001386818913,-2.164619701e-07,-0.0001353824337,0.0001194119031,
-	2.718196993e-05,-0.0001408427925,9.761988622e-05,5.191114178e-05,-0.0001412650745,
-	7.356746937e-05,7.313003152e-05,-0.0001364030613,4.882165013e-05,9.068259533e-05,
-	-0.0001272512309,2.372442577e-05,0.0001037607508,-0.0001145094502,-4.661086166e-07,
-	0.0001123635448,-9.853937809e-05,-2.295415652e-05,0.0001164469431,-8.011799946e-05,
-	-4.317172352e-05,0.0001162744957,-6.033564205e-05,-6.029054202e-05,0.0001120507513,
-	-4.003585855e-05,-7.40760006e-05,0.0001046343095,-2.016986582e-05,-8.448802691e-05,
-	9.427686746e-05,-2.175387408e-07,-9.226090333e-05,8.140255522e-05,1.802032239e-05,
-	-9.454508836e-05,6.617954205e-05,3.391242353e-05,-9.651849541e-05,  5.1486546e-05,
-	4.648149115e-05,-9.133686399e-05,3.399164052e-05,6.049796139e-05,-8.905760478e-05,
-	2.246462827e-05,6.433967064e-05,-7.611637557e-05,8.103388041e-07,  7.9376754e-05,
-	-7.893393922e-05,1.141668463e-06, 6.73225004e-05,-5.090708873e-05,-3.464286056e-05,
-	0.0001008144318,-8.122038707e-05,9.990037597e-07,5.012009206e-05,-1.036701087e-05,
-	-9.171713464e-05,0.0001649894839,-0.000142995108,4.794877168e-05,1.992854232e-05,
-	5.07317709e-05,-0.0003163349465,0.0007515865145,0.0009643432568
-};
+// Kaiser windowed sinc lowpass, exactly symmetric around nTaps / 2 (taps[i] == taps[nTaps - i])
+// with taps[0] = 0, nTaps has to be even
+void SSEInterpolator::createTaps(int nTaps, double sampleRate, double cutoff, std::vector<Real>* taps)
+{
+	double beta = 0.1102 * (KaiserAttenuation - 8.7);
+	double fc = cutoff / sampleRate;
+	int center = nTaps / 2;
+	double norm = 1.0 / besselI0(beta);
 
-static const float H70[1024] = {
-	-2.547668555e-05,-0.001239642617,-0.0003697825014,0.0002228509111,-4.400994658e-05,
-	-7.985809498e-05,0.0001162238186,-6.963900523e-05,-1.660131238e-05,8.138001431e-05,
-	-8.154078387e-05,2.048533133e-05,5.411783786e-05,-8.476156654e-05,4.791124593e-05,
-	2.719708027e-05,-8.042330592e-05,6.849909551e-05,-2.886477546e-07,-6.899988512e-05,
-	8.226437785e-05,-2.743628102e-05,-5.119340494e-05, 8.85910049e-05,-5.259134559e-05,
-	-2.821631642e-05, 8.70417789e-05,-7.390193787e-05,-1.771998996e-06,7.769215881e-05,
-	-8.976565732e-05, 2.62904432e-05,6.095926801e-05,-9.875083924e-05,5.393685205e-05,
-	3.761189146e-05,-9.951294487e-05,7.867768727e-05,9.250865332e-06,-9.13158583e-05,
-	9.782314737e-05,-2.140282231e-05,-7.506970724e-05,0.0001102379829,-5.274264913e-05,
-	-5.082100688e-05,0.0001136649516,-8.145600441e-05,-2.069736001e-05,0.0001077055276,
-	-0.000105288229,1.338471793e-05,9.206373943e-05,-0.0001217809913, 4.87487232e-05,
-	6.740829122e-05,-0.0001289985812,8.242770855e-05,3.524071508e-05,-0.0001256638498,
-	0.0001114189654,-2.087828079e-06,-0.0001111889069,0.0001333281398,-4.123977124e-05,
-	-8.603051538e-05,0.0001446916576,-8.133277879e-05,-5.323707956e-05,0.0001449635311,
-	-0.000115342853,-1.245181829e-05,0.0001322832832,-0.0001426585222,3.226614717e-05,
-	0.0001080473594,-0.0001598013332,7.693486987e-05,7.316200936e-05,-0.0001644297154,
-	0.0001179837345,2.966049396e-05,-0.0001552560861,0.0001516206248,-1.913981578e-05,
-	-0.0001324031909,0.0001747014903,-6.95622366e-05,-9.684291581e-05,0.0001844937215,
-	-0.0001173553974,-5.080994015e-05,0.0001793039555,-0.0001582499681,2.408747378e-06,
-	0.0001586652215,-0.0001883780351, 5.87880204e-05,0.0001233188523,-0.0002044672874,
-	0.000113693015,7.539956277e-05,-0.0002043475251,0.0001624556171,1.811275069e-05,
-	-0.0001869358966,0.0002004661656,-4.417206947e-05,-0.0001527245622,0.0002239151654,
-	-0.0001065428733,-0.0001035434252,0.0002298792242,-0.0001636745001,-4.269557394e-05,
-	0.0002168444626,-0.0002104486193,2.540328023e-05,0.0001847218518,-0.0002422014513,
-	9.531302203e-05,0.0001352250983,-0.0002555168176, 0.000161351214,7.132355677e-05,
-	-0.00024809147,0.0002174887049,-2.294257229e-06,-0.0002193594701,0.0002588387288,
-	-7.964365795e-05,-0.000170244457,0.0002806205594,-0.0001551141177,-0.0001044138771,
-	0.0002801216906,-0.0002215118293,-2.58897071e-05,0.0002558189735,-0.0002731904387,
-	5.929636973e-05,0.0002088357578,-0.0003048672806,0.0001441492204,0.0001417034364,
-	-0.0003125894582,0.0002215381101,5.891405453e-05,-0.0002944551816,0.0002846249554,
-	-3.343560093e-05,-0.000250562618,0.0003272499598, -0.00012798424,-0.0001832927956,
-	0.0003447538766,-0.0002169304644,-9.698963549e-05,0.0003342461423,-0.0002924453584,
-	2.093515377e-06,0.0002951097267,-0.0003474521218,0.0001062986121,0.0002291172132,
-	-0.0003762306587,0.0002071252675,0.0001403936039,-0.0003749732859,0.0002959168341,
-	3.519594975e-05,-0.0003421798756,0.0003645355464,-7.845951768e-05,-0.0002789761638,
-	0.0004061855434,-0.0001914851455,-0.0001890650892,0.0004159199307,-0.0002943074796,
-	-7.865392399e-05,0.0003913030378,-0.0003777916718,4.407327287e-05,0.0003325853031,
-	-0.0004338498984,0.0001693981176,0.0002430230234,-0.000456392474,0.0002869569871,
-	0.0001285072794,-0.0004418724566, 0.000386322441,-2.699160632e-06,-0.0003896503476,
-	0.0004584288399,-0.0001401366899,-0.0003019874566,0.0004957171041,-0.0002728616237,
-	-0.0001847573294,0.0004934212775,-0.0003892759851,-4.613857891e-05,0.0004495554604,
-	-0.0004789193335,0.0001032741784,0.0003659548529,-0.0005329482956,0.0002513999352,
-	0.0002475742658,-0.0005449542077,0.0003857554111,0.0001026027749,-0.000511928054,
-	0.0004944638931,-5.811414667e-05,-0.0004344267363,0.0005671138642,-0.0002218139853,
-	-0.0003167933028,   0.0005958447,-0.000374921161,-0.0001669105695,0.0005760856438,
-	-0.000504082127,4.225567409e-06,0.0005071499036,-0.0005973295192,  0.00018331717,
-	0.0003924266784,-0.0006450877991,0.0003557086748,0.0002393440664,-0.0006411880604,
-	0.0005066589802,5.885650171e-05,-0.000583448098,0.0006224606186,-0.0001352191757,
-	-0.0004741182493,0.0006917385617,-0.0003272820904,-0.000319888728,0.0007064591045,
-	-0.0005011453759,-0.0001315314585,0.0006627835683,-0.000641400984,7.680193085e-05,
-	0.0005615617265,-0.0007346840575,0.0002886275179,0.0004085716791,-0.0007709157653,
-	0.0004864452349,0.0002141707519, -0.00074437086,0.0006529013044,-7.448465567e-06,
-	-0.0006543822819,0.0007726706681,-0.000238888184,-0.000505316013,0.0008334516315,
-	-0.0004613586061,-0.0003069755912,0.0008274588617,-0.0006557327579,-7.356881542e-05,
-	0.0007519112551,-0.0008044777205,0.0001770594536,0.0006099467864,-0.0008930079639,
-	0.0004247159522,0.0004102580424,-0.0009109944804, 0.000648547546,0.0001668043551,
-	-0.0008536602254,0.0008287722012,-0.0001021487406,-0.0007222188869,0.0009482085006,
-	-0.0003752664197,-0.0005241791951, 0.000994016882,-0.0006299541565,-0.000272889476,
-	0.0009588402463,-0.0008440301172,1.314837755e-05,0.0008418129873,-0.0009977206355,
-	0.0003117109009,0.0006488043582,-0.001075272798,0.0005984077579,0.0003923478653,
-	-0.001066598692,0.0008487491868,9.082002362e-05,-0.0009682921809, 0.001040060539,
-	-0.000232735445,-0.0007842822233, 0.001153562218,-0.0005523742875,-0.0005258097663,
-	0.001176019316,-0.0008411742747,-0.0002108914487, 0.001101197791,-0.001073572435,
-	0.0001369034871,0.0009305898566,-0.001227430417,0.0004900959902,0.0006738143275,
-	-0.001286071725,0.0008195436094,0.0003481620806,-0.001239926205,  0.00109651871,
-	-2.263531314e-05,-0.001087788609, 0.001295360969,-0.0004097770725,-0.0008370602736,
-	0.001395579893,-0.0007818237646,-0.0005038275849,  0.00138399133,-0.001106924727,
-	-0.0001117901193, 0.001255910029,-0.001355633023,0.0003093016567, 0.001016238588,
-	-0.001503386302,0.0007257589605,0.0006793166976,-0.001532691065,  0.00110260176,
-	0.0002683048369,-0.001435109531, 0.001406412572,-0.0001863135258,-0.001212266274,
-	0.001608066494,-0.0006488493527,-0.0008762691868, 0.001685451949,-0.001081158407,
-	-0.0004492145963, 0.001625609118,-0.001445604837,3.807072062e-05, 0.001426304574,
-	-0.001708238502,0.0005481714034, 0.001096716267,-0.001841700403, 0.001039764262,
-	0.0006573109422,-0.001827894943, 0.001470902702,0.0001387215889,-0.001659931964,
-	0.001802326762,-0.0004201792763,-0.001343307551, 0.002000915818,-0.0009750933968,
-	-0.0008961004787, 0.002042667242,-0.001479532453,-0.0003481664171, 0.001915220288,
-	-0.001888607512,0.0002606307971, 0.001619431656,-0.002162760124,0.0008830992156,
-	0.001170075731,-0.002271258971, 0.001468262053,0.0005955244415,-0.002195173409,
-	0.00196515792,-6.397537072e-05,-0.001929722494, 0.002327088965,-0.0007587031578,
-	-0.001485324115, 0.002515565138,-0.001433098805,-0.0008877606597,  0.00250405632,
-	-0.002029750263,-0.0001769837982,  0.00228066626,-0.002494049724,0.0005952870706,
-	0.001850144356, -0.00277872826, 0.001368921716, 0.001234457362,-0.002848054748,
-	0.002079755999,0.0004721251316,-0.002681519603, 0.002664445899,-0.0003837590921,
-	-0.002276415238, 0.003065540688,-0.001268839464,-0.001649209764, 0.003236480523,
-	-0.002111864276,-0.0008355411701,  0.00314600463,-0.002839811845,0.0001112602913,
-	0.002781685209,-0.003383564996, 0.001123161521, 0.002152201021,-0.003683539107,
-	0.002121652011, 0.001288180472,-0.003695048625, 0.003023153869,0.0002414444316,
-	-0.003392870072, 0.003745007562,-0.000917364785, -0.00277462136, 0.004211918917,
-	-0.002102808328,-0.001862737117, 0.004362198524,-0.003219838254,-0.0007046896499,
-	0.004153539892,-0.004170221742,0.0006285092095, 0.003567676293,-0.004859488923,
-	0.002045513131, 0.002613695571,-0.005204174668, 0.003439641092, 0.001329782768,
-	-0.005138572305, 0.004695029929,-0.0002170440566,-0.004621012136, 0.005693940911,
-	-0.001932961866, -0.00363869057,  0.00632439414,-0.003701291047,-0.002211099025,
-	0.006488089915,-0.005387847312,-0.0003916032729, 0.006107505877,-0.006847631186,
-	0.001732879435, 0.005132245831,-0.007932175882, 0.004043936729, 0.003543733386,
-	-0.008496797644, 0.006395296659, 0.001358161797,-0.008407261223, 0.008617429063,
-	-0.001372686704,-0.007544566412,  0.01052213926,-0.004562844057,-0.005806746893,
-	0.0119058555,-0.008095772006,-0.003105544252,  0.01254884806, -0.01182991546,
-	0.0006457004929,  0.01220555604, -0.01560606807, 0.005560913123,  0.01057501975,
-	-0.01925593242,  0.01184651628, 0.007223313209, -0.02261146344,  0.01996038109,
-	0.001372541185, -0.02551444247,  0.03106603026,-0.008769231848, -0.02782548964,
-	0.04872964323,  -0.0288821198, -0.02943226509,  0.08930552006, -0.09210555255,
-	-0.03025595844,   0.5658752918,   0.5658752918, -0.03025595844, -0.09210555255,
-	0.08930552006, -0.02943226509,  -0.0288821198,  0.04872964323, -0.02782548964,
-	-0.008769231848,  0.03106603026, -0.02551444247, 0.001372541185,  0.01996038109,
-	-0.02261146344, 0.007223313209,  0.01184651628, -0.01925593242,  0.01057501975,
-	0.005560913123, -0.01560606807,  0.01220555604,0.0006457004929, -0.01182991546,
-	0.01254884806,-0.003105544252,-0.008095772006,   0.0119058555,-0.005806746893,
-	-0.004562844057,  0.01052213926,-0.007544566412,-0.001372686704, 0.008617429063,
-	-0.008407261223, 0.001358161797, 0.006395296659,-0.008496797644, 0.003543733386,
-	0.004043936729,-0.007932175882, 0.005132245831, 0.001732879435,-0.006847631186,
-	0.006107505877,-0.0003916032729,-0.005387847312, 0.006488089915,-0.002211099025,
-	-0.003701291047,  0.00632439414, -0.00363869057,-0.001932961866, 0.005693940911,
-	-0.004621012136,-0.0002170440566, 0.004695029929,-0.005138572305, 0.001329782768,
-	0.003439641092,-0.005204174668, 0.002613695571, 0.002045513131,-0.004859488923,
-	0.003567676293,0.0006285092095,-0.004170221742, 0.004153539892,-0.0007046896499,
-	-0.003219838254, 0.004362198524,-0.001862737117,-0.002102808328, 0.004211918917,
-	-0.00277462136,-0.000917364785, 0.003745007562,-0.003392870072,0.0002414444316,
-	0.003023153869,-0.003695048625, 0.001288180472, 0.002121652011,-0.003683539107,
-	0.002152201021, 0.001123161521,-0.003383564996, 0.002781685209,0.0001112602913,
-	-0.002839811845,  0.00314600463,-0.0008355411701,-0.002111864276, 0.003236480523,
-	-0.001649209764,-0.001268839464, 0.003065540688,-0.002276415238,-0.0003837590921,
-	0.002664445899,-0.002681519603,0.0004721251316, 0.002079755999,-0.002848054748,
-	0.001234457362, 0.001368921716, -0.00277872826, 0.001850144356,0.0005952870706,
-	-0.002494049724,  0.00228066626,-0.0001769837982,-0.002029750263,  0.00250405632,
-	-0.0008877606597,-0.001433098805, 0.002515565138,-0.001485324115,-0.0007587031578,
-	0.002327088965,-0.001929722494,-6.397537072e-05,  0.00196515792,-0.002195173409,
-	0.0005955244415, 0.001468262053,-0.002271258971, 0.001170075731,0.0008830992156,
-	-0.002162760124, 0.001619431656,0.0002606307971,-0.001888607512, 0.001915220288,
-	-0.0003481664171,-0.001479532453, 0.002042667242,-0.0008961004787,-0.0009750933968,
-	0.002000915818,-0.001343307551,-0.0004201792763, 0.001802326762,-0.001659931964,
-	0.0001387215889, 0.001470902702,-0.001827894943,0.0006573109422, 0.001039764262,
-	-0.001841700403, 0.001096716267,0.0005481714034,-0.001708238502, 0.001426304574,
-	3.807072062e-05,-0.001445604837, 0.001625609118,-0.0004492145963,-0.001081158407,
-	0.001685451949,-0.0008762691868,-0.0006488493527, 0.001608066494,-0.001212266274,
-	-0.0001863135258, 0.001406412572,-0.001435109531,0.0002683048369,  0.00110260176,
-	-0.001532691065,0.0006793166976,0.0007257589605,-0.001503386302, 0.001016238588,
-	0.0003093016567,-0.001355633023, 0.001255910029,-0.0001117901193,-0.001106924727,
-	0.00138399133,-0.0005038275849,-0.0007818237646, 0.001395579893,-0.0008370602736,
-	-0.0004097770725, 0.001295360969,-0.001087788609,-2.263531314e-05,  0.00109651871,
-	-0.001239926205,0.0003481620806,0.0008195436094,-0.001286071725,0.0006738143275,
-	0.0004900959902,-0.001227430417,0.0009305898566,0.0001369034871,-0.001073572435,
-	0.001101197791,-0.0002108914487,-0.0008411742747, 0.001176019316,-0.0005258097663,
-	-0.0005523742875, 0.001153562218,-0.0007842822233,-0.000232735445, 0.001040060539,
-	-0.0009682921809,9.082002362e-05,0.0008487491868,-0.001066598692,0.0003923478653,
-	0.0005984077579,-0.001075272798,0.0006488043582,0.0003117109009,-0.0009977206355,
-	0.0008418129873,1.314837755e-05,-0.0008440301172,0.0009588402463,-0.000272889476,
-	-0.0006299541565, 0.000994016882,-0.0005241791951,-0.0003752664197,0.0009482085006,
-	-0.0007222188869,-0.0001021487406,0.0008287722012,-0.0008536602254,0.0001668043551,
-	0.000648547546,-0.0009109944804,0.0004102580424,0.0004247159522,-0.0008930079639,
-	0.0006099467864,0.0001770594536,-0.0008044777205,0.0007519112551,-7.356881542e-05,
-	-0.0006557327579,0.0008274588617,-0.0003069755912,-0.0004613586061,0.0008334516315,
-	-0.000505316013,-0.000238888184,0.0007726706681,-0.0006543822819,-7.448465567e-06,
-	0.0006529013044, -0.00074437086,0.0002141707519,0.0004864452349,-0.0007709157653,
-	0.0004085716791,0.0002886275179,-0.0007346840575,0.0005615617265,7.680193085e-05,
-	-0.000641400984,0.0006627835683,-0.0001315314585,-0.0005011453759,0.0007064591045,
-	-0.000319888728,-0.0003272820904,0.0006917385617,-0.0004741182493,-0.0001352191757,
-	0.0006224606186,-0.000583448098,5.885650171e-05,0.0005066589802,-0.0006411880604,
-	0.0002393440664,0.0003557086748,-0.0006450877991,0.0003924266784,  0.00018331717,
-	-0.0005973295192,0.0005071499036,4.225567409e-06,-0.000504082127,0.0005760856438,
-	-0.0001669105695,-0.000374921161,   0.0005958447,-0.0003167933028,-0.0002218139853,
-	0.0005671138642,-0.0004344267363,-5.811414667e-05,0.0004944638931,-0.000511928054,
-	0.0001026027749,0.0003857554111,-0.0005449542077,0.0002475742658,0.0002513999352,
-	-0.0005329482956,0.0003659548529,0.0001032741784,-0.0004789193335,0.0004495554604,
-	-4.613857891e-05,-0.0003892759851,0.0004934212775,-0.0001847573294,-0.0002728616237,
-	0.0004957171041,-0.0003019874566,-0.0001401366899,0.0004584288399,-0.0003896503476,
-	-2.699160632e-06, 0.000386322441,-0.0004418724566,0.0001285072794,0.0002869569871,
-	-0.000456392474,0.0002430230234,0.0001693981176,-0.0004338498984,0.0003325853031,
-	4.407327287e-05,-0.0003777916718,0.0003913030378,-7.865392399e-05,-0.0002943074796,
-	0.0004159199307,-0.0001890650892,-0.0001914851455,0.0004061855434,-0.0002789761638,
-	-7.845951768e-05,0.0003645355464,-0.0003421798756,3.519594975e-05,0.0002959168341,
-	-0.0003749732859,0.0001403936039,0.0002071252675,-0.0003762306587,0.0002291172132,
-	0.0001062986121,-0.0003474521218,0.0002951097267,2.093515377e-06,-0.0002924453584,
-	0.0003342461423,-9.698963549e-05,-0.0002169304644,0.0003447538766,-0.0001832927956,
-	-0.00012798424,0.0003272499598,-0.000250562618,-3.343560093e-05,0.0002846249554,
-	-0.0002944551816,5.891405453e-05,0.0002215381101,-0.0003125894582,0.0001417034364,
-	0.0001441492204,-0.0003048672806,0.0002088357578,5.929636973e-05,-0.0002731904387,
-	0.0002558189735,-2.58897071e-05,-0.0002215118293,0.0002801216906,-0.0001044138771,
-	-0.0001551141177,0.0002806205594,-0.000170244457,-7.964365795e-05,0.0002588387288,
-	-0.0002193594701,-2.294257229e-06,0.0002174887049, -0.00024809147,7.132355677e-05,
-	0.000161351214,-0.0002555168176,0.0001352250983,9.531302203e-05,-0.0002422014513,
-	0.0001847218518,2.540328023e-05,-0.0002104486193,0.0002168444626,-4.269557394e-05,
-	-0.0001636745001,0.0002298792242,-0.0001035434252,-0.0001065428733,0.0002239151654,
-	-0.0001527245622,-4.417206947e-05,0.0002004661656,-0.0001869358966,1.811275069e-05,
-	0.0001624556171,-0.0002043475251,7.539956277e-05, 0.000113693015,-0.0002044672874,
-	0.0001233188523, 5.87880204e-05,-0.0001883780351,0.0001586652215,2.408747378e-06,
-	-0.0001582499681,0.0001793039555,-5.080994015e-05,-0.0001173553974,0.0001844937215,
-	-9.684291581e-05,-6.95622366e-05,0.0001747014903,-0.0001324031909,-1.913981578e-05,
-	0.0001516206248,-0.0001552560861,2.966049396e-05,0.0001179837345,-0.0001644297154,
-	7.316200936e-05,7.693486987e-05,-0.0001598013332,0.0001080473594,3.226614717e-05,
-	-0.0001426585222,0.0001322832832,-1.245181829e-05,-0.000115342853,0.0001449635311,
-	-5.323707956e-05,-8.133277879e-05,0.0001446916576,-8.603051538e-05,-4.123977124e-05,
-	0.0001333281398,-0.0001111889069,-2.087828079e-06,0.0001114189654,-0.0001256638498,
-	3.524071508e-05,8.242770855e-05,-0.0001289985812,6.740829122e-05, 4.87487232e-05,
-	-0.0001217809913,9.206373943e-05,1.338471793e-05,-0.000105288229,0.0001077055276,
-	-2.069736001e-05,-8.145600441e-05,0.0001136649516,-5.082100688e-05,-5.274264913e-05,
-	0.0001102379829,-7.506970724e-05,-2.140282231e-05,9.782314737e-05,-9.13158583e-05,
-	9.250865332e-06,7.867768727e-05,-9.951294487e-05,3.761189146e-05,5.393685205e-05,
-	-9.875083924e-05,6.095926801e-05, 2.62904432e-05,-8.976565732e-05,7.769215881e-05,
-	-1.771998996e-06,-7.390193787e-05, 8.70417789e-05,-2.821631642e-05,-5.259134559e-05,
-	8.85910049e-05,-5.119340494e-05,-2.743628102e-05,8.226437785e-05,-6.899988512e-05,
-	-2.886477546e-07,6.849909551e-05,-8.042330592e-05,2.719708027e-05,4.791124593e-05,
-	-8.476156654e-05,5.411783786e-05,2.048533133e-05,-8.154078387e-05,8.138001431e-05,
-	-1.660131238e-05,-6.963900523e-05,0.0001162238186,-7.985809498e-05,-4.400994658e-05,
-	0.0002228509111,-0.0003697825014,-0.001239642617,-2.547668555e-05
-};
+	taps->resize(nTaps);
+	(*taps)[0] = 0;
+	for(int i = 1; i <= center; ++i) {
+		double t = center - i;
+		double r = t / center;
+		double sinc = (t == 0.0) ? 2.0 * fc : sin(2.0 * M_PI * fc * t) / (M_PI * t);
+		(*taps)[i] = sinc * besselI0(beta * sqrt(1.0 - r * r)) * norm;
+		(*taps)[nTaps - i] = (*taps)[i];
+	}
+}
 
-static const float H75[1024] = {
-	-0.000866600778,-0.000923007261,0.0004388026136,-0.0001386724762,-1.742970744e-05,
-	6.405049498e-05,-3.647237099e-05,-2.616242818e-05, 8.42079462e-05,-0.0001066198747,
-	8.157099364e-05,-2.120726094e-05,-4.392081973e-05, 8.02757786e-05,-6.912302342e-05,
-	1.740438529e-05,4.538151188e-05,-8.305725351e-05,7.332587847e-05,-2.093533294e-05,
-	-4.429027103e-05, 8.43184971e-05,-7.502733934e-05,2.093712101e-05,4.676288518e-05,
-	-8.799001807e-05,7.752291276e-05,-2.038280763e-05,-5.01929826e-05, 9.24299311e-05,
-	-7.958550123e-05,1.953292121e-05,5.529719783e-05,-9.661208605e-05, 8.22423317e-05,
-	-1.742820132e-05,-6.015915642e-05,0.0001023633595,-8.375782636e-05,1.474574765e-05,
-	6.512096297e-05,-0.0001079351496,8.615876868e-05,-1.137353411e-05,-7.183873822e-05,
-	0.0001132392208,-8.717383025e-05,7.945802281e-06,7.802621258e-05,-0.0001189851973,
-	8.885992429e-05,-3.978372206e-06,-8.545698802e-05,0.0001251318172,-8.97273494e-05,
-	-9.356299415e-07, 9.30356473e-05,-0.0001307646453,9.008774214e-05,5.995870652e-06,
-	-0.0001006489329,0.0001363010088,-9.048379434e-05,-1.15407729e-05,0.0001084271498,
-	-0.0001421873167,9.033341485e-05, 1.75101577e-05,-0.0001169374082,0.0001479261555,
-	-8.991864161e-05,-2.408041837e-05,0.0001258693519,-0.0001535703195,8.894294297e-05,
-	3.106613076e-05,-0.0001349797094,0.0001592482004,-8.747679385e-05,-3.874309186e-05,
-	0.000144141668,-0.0001645310404,8.564368181e-05,4.690304922e-05,-0.0001538422075,
-	0.0001697212283,-8.30704812e-05,-5.568845154e-05,0.0001636097295,-0.0001747143542,
-	8.023535338e-05,6.492314424e-05,-0.0001737294224,0.0001796366996,-7.665811427e-05,
-	-7.466782699e-05,0.0001839557808,-0.0001839425677,7.252956129e-05,8.495645307e-05,
-	-0.0001943074021,0.0001881280623,-6.783798744e-05,-9.592571587e-05,0.0002049538598,
-	-0.0001920539653,6.248411955e-05,0.0001074506145,-0.0002156423434,0.0001954454492,
-	-5.65416376e-05,-0.0001193391945,0.0002263416536,-0.0001983756374,4.981102757e-05,
-	0.0001317861897,-0.0002371981536,0.0002010583266,-4.248059849e-05,-0.0001448834519,
-	0.0002481181291,-0.0002032081393,3.443065725e-05,0.0001583602862,-0.0002590640797,
-	0.0002047485759,-2.556360414e-05,-0.0001725381444,0.0002698560711,-0.0002057016391,
-	1.590772081e-05, 0.000187141457,-0.0002807318815,0.0002062042768,-5.573042017e-06,
-	-0.000202172072,0.0002913693024,-0.0002058994141,-5.65315213e-06,0.0002176571725,
-	-0.0003018875141,0.0002049812028,1.770032941e-05,-0.000233734143,0.0003123302595,
-	-0.0002034303179,-3.051590829e-05, 0.000250177487,-0.0003224306565, 0.000200986804,
-	4.416746015e-05,-0.0002669957466, 0.000332325435,-0.0001977853972,-5.873284317e-05,
-	0.0002843334805,-0.0003419562127,0.0001938825881,7.409007958e-05,-0.0003019217402,
-	0.0003511281393,-0.0001888790866,-9.044686885e-05,0.0003199238563,-0.0003599989286,
-	0.0001831339905,  0.00010756345,-0.0003382480645,0.0003684219846,-0.0001764228218,
-	-0.0001255384122,0.0003567780368,-0.0003762787092, 0.000168643106,0.0001445309608,
-	-0.0003757142404,0.0003837007971,-0.0001598813105,-0.0001643432188,  0.00039471325,
-	-0.0003904018959,0.0001500283397,0.0001850681729,-0.0004139480297,0.0003964749048,
-	-0.0001391052065,-0.0002067020687,0.0004333335964,-0.0004018956679,0.0001270573266,
-	0.00022908143,-0.0004526786797,0.0004064304521,-0.0001137361251,-0.0002525421733,
-	0.000472302112,-0.0004103147949,9.938539006e-05,0.0002766677062,-0.000491692801,
-	0.0004131185997,-8.358332707e-05,-0.0003018388234,0.0005111974897,-0.0004151481262,
-	6.672448944e-05,0.0003276735079,-0.0005304740043,0.0004160482495,-4.83703916e-05,
-	-0.0003545003128,0.0005497189704,-0.0004159828823,  2.8826782e-05, 0.000381984486,
-	-0.0005686125369,0.0004147303989,-7.791975804e-06,-0.0004103366809,0.0005873197806,
-	-0.0004123319814,-1.451793469e-05,0.0004394156858,-0.0006056558341,0.0004086749104,
-	3.829625348e-05,-0.0004692645161,0.0006236338522,-0.0004037292383,-6.349683099e-05,
-	0.0004997561336,-0.0006410455098,0.0003973644343,  9.0174246e-05,-0.0005309545668,
-	0.000658005767,-0.0003896114649,-0.0001183094573,0.0005627618521,-0.0006743214326,
-	0.0003803695145,0.0001479316707,-0.0005951690837,0.0006899691653,-0.000369565736,
-	-0.0001790592214,0.0006281196256,-0.0007048724219,0.0003571121488,0.0002117454715,
-	-0.0006616327446,0.0007189462194,-0.0003429793578,-0.0002459527168,0.0006955427816,
-	-0.0007320913137,0.0003271128226,0.0002817282511,-0.0007299046265,0.0007442622446,
-	-0.0003094075655,-0.0003190636344,0.0007646297454,-0.0007553639589,0.0002898218227,
-	0.0003579655313,-0.0007996485219,0.0007652977365,-0.0002682817576,-0.0003984557407,
-	0.0008349211421,-0.0007739714929,0.0002447159786, 0.000440526288,-0.0008704042411,
-	0.0007813651464,-0.0002190966479,-0.0004841861082,  0.00090601173,-0.0007872728747,
-	0.0001913033775,0.0005294517032,-0.0009416768444,0.0007916744798,-0.0001612932538,
-	-0.0005762994988,0.0009773438796,-0.0007944707759,0.0001290035725, 0.000624725013,
-	-0.001012953115,0.0007955523906,-9.43580817e-05,-0.000674742274,  0.00104838307,
-	-0.0007947966224,5.727893949e-05,0.0007263723528,-0.001083654119,0.0007921447395,
-	-1.771223106e-05,-0.0007795610582, 0.001118569868,-0.0007874235162,-2.44508592e-05,
-	0.0008343236404,-0.001153113553, 0.000780560018,6.923589535e-05,-0.0008906673174,
-	0.001187189366,-0.0007714569801,-0.0001167660957,0.0009485449409,-0.001220696373,
-	0.0007599583478,0.0001670948986,-0.001008006861, 0.001253565773,-0.0007459555636,
-	-0.0002203074837, 0.001068988699,-0.001285669161,0.0007293188246,0.0002764769306,
-	-0.001131506986, 0.001316920388,-0.0007098983042,-0.0003357567475, 0.001195590827,
-	-0.001347265556,0.0006876084371,0.0003981578629,-0.001261163736, 0.001376490458,
-	-0.0006622158689,-0.000463841483, 0.001328272279,-0.001404582174,0.0006336392835,
-	0.0005329040578,-0.001396900392, 0.001431389363,-0.000601681706,-0.0006054358091,
-	0.001467035618,-0.001456781989,0.0005661628093,0.0006816007663,-0.001538719167,
-	0.001480666688,-0.0005269272951,-0.0007615243085, 0.001611907268,-0.001502856147,
-	0.0004837421002,0.0008453434566,-0.001686638803, 0.001523260376,-0.0004364201741,
-	-0.0009332355694, 0.001762937172,-0.001541727339,0.0003847427724, 0.001025349135,
-	-0.001840794459, 0.001558078453,-0.0003284084669,-0.001121965586, 0.001920305192,
-	-0.001572205918,0.0002672219125,  0.00122320524,-0.002001438988, 0.001583852223,
-	-0.0002008106821, -0.00132939592, 0.002084303647,-0.001592907705,0.0001289089851,
-	0.001440805499, -0.00216895435, 0.001599143492,-5.111143037e-05,-0.001557720592,
-	0.002255447442,-0.001602317789,-3.298680895e-05, 0.001680553425,-0.002343926579,
-	0.001602257253,0.0001237989345, -0.00180966733, 0.002434474649,-0.001598624047,
-	-0.0002218889131, 0.001945589902, -0.00252728723, 0.001591224456,0.0003277802607,
-	-0.002088807058, 0.002622507745,-0.001579632983,-0.0004422086349, 0.002240034752,
-	-0.002720391378, 0.001563608297,0.0005658540758,-0.002399916062, 0.002821157686,
-	-0.001542657032,-0.0006996503216, 0.002569380216, -0.00292518409, 0.001516393735,
-	0.0008445832646,-0.002749394625,  0.00303281215, -0.00148423377,-0.001001875615,
-	0.002941213315,-0.003144559218, 0.001445621485, 0.001172916731,-0.003146184376,
-	0.003260934725,-0.001399795292,-0.001359398477,  0.00336607662,-0.003382685361,
-	0.001345968689,  0.00156330585,-0.003602916608,  0.00351062743,-0.001283088466,
-	-0.001787107089, 0.003859231947,-0.003645830089, 0.001209983369, 0.002033728175,
-	-0.004138080403, 0.003789598122,-0.001125140581,-0.002306862269,  0.00444331672,
-	-0.003943553194, 0.001026759506, 0.002611069242,-0.004779739305, 0.004109794274,
-	-0.0009125287179,-0.002952152863, 0.005153473467,-0.004290966783,0.0007795203128,
-	0.003337559057,-0.005572426599, 0.004490534775,-0.0006239409558,-0.003776978934,
-	0.006046967581,-0.004713089205,0.0004407837114, 0.004283382092, -0.00659102248,
-	0.004964831285,-0.0002233014238,-0.004874316044, 0.007223611698,-0.005254271906,
-	-3.790587652e-05, 0.005574390292,-0.007971568964, 0.005593547132,0.0003561546037,
-	-0.006418923847, 0.008873745799,-0.006000408903,-0.0007511820295, 0.007460668683,
-	-0.009988855571, 0.006501976401, 0.001253399998,-0.008782090619,  0.01140980609,
-	-0.007141781505,-0.001912291395,  0.01051941048, -0.01329275407, 0.007994302548,
-	0.002814194188, -0.01291536726,  0.01592212357,-0.009198557585,-0.004124357831,
-	0.01644798741, -0.01987598091,  0.01104692835, 0.006203894038, -0.02220736444,
-	0.02653672174, -0.01427748054, -0.01002217084,  0.03333562985, -0.04023614898,
-	0.02144510671,  0.01936847717, -0.06414701045,  0.08510859311, -0.05145620927,
-	-0.07845172286,   0.5870146751,   0.5870146751, -0.07845172286, -0.05145620927,
-	0.08510859311, -0.06414701045,  0.01936847717,  0.02144510671, -0.04023614898,
-	0.03333562985, -0.01002217084, -0.01427748054,  0.02653672174, -0.02220736444,
-	0.006203894038,  0.01104692835, -0.01987598091,  0.01644798741,-0.004124357831,
-	-0.009198557585,  0.01592212357, -0.01291536726, 0.002814194188, 0.007994302548,
-	-0.01329275407,  0.01051941048,-0.001912291395,-0.007141781505,  0.01140980609,
-	-0.008782090619, 0.001253399998, 0.006501976401,-0.009988855571, 0.007460668683,
-	-0.0007511820295,-0.006000408903, 0.008873745799,-0.006418923847,0.0003561546037,
-	0.005593547132,-0.007971568964, 0.005574390292,-3.790587652e-05,-0.005254271906,
-	0.007223611698,-0.004874316044,-0.0002233014238, 0.004964831285, -0.00659102248,
-	0.004283382092,0.0004407837114,-0.004713089205, 0.006046967581,-0.003776978934,
-	-0.0006239409558, 0.004490534775,-0.005572426599, 0.003337559057,0.0007795203128,
-	-0.004290966783, 0.005153473467,-0.002952152863,-0.0009125287179, 0.004109794274,
-	-0.004779739305, 0.002611069242, 0.001026759506,-0.003943553194,  0.00444331672,
-	-0.002306862269,-0.001125140581, 0.003789598122,-0.004138080403, 0.002033728175,
-	0.001209983369,-0.003645830089, 0.003859231947,-0.001787107089,-0.001283088466,
-	0.00351062743,-0.003602916608,  0.00156330585, 0.001345968689,-0.003382685361,
-	0.00336607662,-0.001359398477,-0.001399795292, 0.003260934725,-0.003146184376,
-	0.001172916731, 0.001445621485,-0.003144559218, 0.002941213315,-0.001001875615,
-	-0.00148423377,  0.00303281215,-0.002749394625,0.0008445832646, 0.001516393735,
-	-0.00292518409, 0.002569380216,-0.0006996503216,-0.001542657032, 0.002821157686,
-	-0.002399916062,0.0005658540758, 0.001563608297,-0.002720391378, 0.002240034752,
-	-0.0004422086349,-0.001579632983, 0.002622507745,-0.002088807058,0.0003277802607,
-	0.001591224456, -0.00252728723, 0.001945589902,-0.0002218889131,-0.001598624047,
-	0.002434474649, -0.00180966733,0.0001237989345, 0.001602257253,-0.002343926579,
-	0.001680553425,-3.298680895e-05,-0.001602317789, 0.002255447442,-0.001557720592,
-	-5.111143037e-05, 0.001599143492, -0.00216895435, 0.001440805499,0.0001289089851,
-	-0.001592907705, 0.002084303647, -0.00132939592,-0.0002008106821, 0.001583852223,
-	-0.002001438988,  0.00122320524,0.0002672219125,-0.001572205918, 0.001920305192,
-	-0.001121965586,-0.0003284084669, 0.001558078453,-0.001840794459, 0.001025349135,
-	0.0003847427724,-0.001541727339, 0.001762937172,-0.0009332355694,-0.0004364201741,
-	0.001523260376,-0.001686638803,0.0008453434566,0.0004837421002,-0.001502856147,
-	0.001611907268,-0.0007615243085,-0.0005269272951, 0.001480666688,-0.001538719167,
-	0.0006816007663,0.0005661628093,-0.001456781989, 0.001467035618,-0.0006054358091,
-	-0.000601681706, 0.001431389363,-0.001396900392,0.0005329040578,0.0006336392835,
-	-0.001404582174, 0.001328272279,-0.000463841483,-0.0006622158689, 0.001376490458,
-	-0.001261163736,0.0003981578629,0.0006876084371,-0.001347265556, 0.001195590827,
-	-0.0003357567475,-0.0007098983042, 0.001316920388,-0.001131506986,0.0002764769306,
-	0.0007293188246,-0.001285669161, 0.001068988699,-0.0002203074837,-0.0007459555636,
-	0.001253565773,-0.001008006861,0.0001670948986,0.0007599583478,-0.001220696373,
-	0.0009485449409,-0.0001167660957,-0.0007714569801, 0.001187189366,-0.0008906673174,
-	6.923589535e-05, 0.000780560018,-0.001153113553,0.0008343236404,-2.44508592e-05,
-	-0.0007874235162, 0.001118569868,-0.0007795610582,-1.771223106e-05,0.0007921447395,
-	-0.001083654119,0.0007263723528,5.727893949e-05,-0.0007947966224,  0.00104838307,
-	-0.000674742274,-9.43580817e-05,0.0007955523906,-0.001012953115, 0.000624725013,
-	0.0001290035725,-0.0007944707759,0.0009773438796,-0.0005762994988,-0.0001612932538,
-	0.0007916744798,-0.0009416768444,0.0005294517032,0.0001913033775,-0.0007872728747,
-	0.00090601173,-0.0004841861082,-0.0002190966479,0.0007813651464,-0.0008704042411,
-	0.000440526288,0.0002447159786,-0.0007739714929,0.0008349211421,-0.0003984557407,
-	-0.0002682817576,0.0007652977365,-0.0007996485219,0.0003579655313,0.0002898218227,
-	-0.0007553639589,0.0007646297454,-0.0003190636344,-0.0003094075655,0.0007442622446,
-	-0.0007299046265,0.0002817282511,0.0003271128226,-0.0007320913137,0.0006955427816,
-	-0.0002459527168,-0.0003429793578,0.0007189462194,-0.0006616327446,0.0002117454715,
-	0.0003571121488,-0.0007048724219,0.0006281196256,-0.0001790592214,-0.000369565736,
-	0.0006899691653,-0.0005951690837,0.0001479316707,0.0003803695145,-0.0006743214326,
-	0.0005627618521,-0.0001183094573,-0.0003896114649, 0.000658005767,-0.0005309545668,
-	9.0174246e-05,0.0003973644343,-0.0006410455098,0.0004997561336,-6.349683099e-05,
-	-0.0004037292383,0.0006236338522,-0.0004692645161,3.829625348e-05,0.0004086749104,
-	-0.0006056558341,0.0004394156858,-1.451793469e-05,-0.0004123319814,0.0005873197806,
-	-0.0004103366809,-7.791975804e-06,0.0004147303989,-0.0005686125369, 0.000381984486,
-	2.8826782e-05,-0.0004159828823,0.0005497189704,-0.0003545003128,-4.83703916e-05,
-	0.0004160482495,-0.0005304740043,0.0003276735079,6.672448944e-05,-0.0004151481262,
-	0.0005111974897,-0.0003018388234,-8.358332707e-05,0.0004131185997,-0.000491692801,
-	0.0002766677062,9.938539006e-05,-0.0004103147949, 0.000472302112,-0.0002525421733,
-	-0.0001137361251,0.0004064304521,-0.0004526786797,  0.00022908143,0.0001270573266,
-	-0.0004018956679,0.0004333335964,-0.0002067020687,-0.0001391052065,0.0003964749048,
-	-0.0004139480297,0.0001850681729,0.0001500283397,-0.0003904018959,  0.00039471325,
-	-0.0001643432188,-0.0001598813105,0.0003837007971,-0.0003757142404,0.0001445309608,
-	0.000168643106,-0.0003762787092,0.0003567780368,-0.0001255384122,-0.0001764228218,
-	0.0003684219846,-0.0003382480645,  0.00010756345,0.0001831339905,-0.0003599989286,
-	0.0003199238563,-9.044686885e-05,-0.0001888790866,0.0003511281393,-0.0003019217402,
-	7.409007958e-05,0.0001938825881,-0.0003419562127,0.0002843334805,-5.873284317e-05,
-	-0.0001977853972, 0.000332325435,-0.0002669957466,4.416746015e-05, 0.000200986804,
-	-0.0003224306565, 0.000250177487,-3.051590829e-05,-0.0002034303179,0.0003123302595,
-	-0.000233734143,1.770032941e-05,0.0002049812028,-0.0003018875141,0.0002176571725,
-	-5.65315213e-06,-0.0002058994141,0.0002913693024,-0.000202172072,-5.573042017e-06,
-	0.0002062042768,-0.0002807318815, 0.000187141457,1.590772081e-05,-0.0002057016391,
-	0.0002698560711,-0.0001725381444,-2.556360414e-05,0.0002047485759,-0.0002590640797,
-	0.0001583602862,3.443065725e-05,-0.0002032081393,0.0002481181291,-0.0001448834519,
-	-4.248059849e-05,0.0002010583266,-0.0002371981536,0.0001317861897,4.981102757e-05,
-	-0.0001983756374,0.0002263416536,-0.0001193391945,-5.65416376e-05,0.0001954454492,
-	-0.0002156423434,0.0001074506145,6.248411955e-05,-0.0001920539653,0.0002049538598,
-	-9.592571587e-05,-6.783798744e-05,0.0001881280623,-0.0001943074021,8.495645307e-05,
-	7.252956129e-05,-0.0001839425677,0.0001839557808,-7.466782699e-05,-7.665811427e-05,
-	0.0001796366996,-0.0001737294224,6.492314424e-05,8.023535338e-05,-0.0001747143542,
-	0.0001636097295,-5.568845154e-05,-8.30704812e-05,0.0001697212283,-0.0001538422075,
-	4.690304922e-05,8.564368181e-05,-0.0001645310404, 0.000144141668,-3.874309186e-05,
-	-8.747679385e-05,0.0001592482004,-0.0001349797094,3.106613076e-05,8.894294297e-05,
-	-0.0001535703195,0.0001258693519,-2.408041837e-05,-8.991864161e-05,0.0001479261555,
-	-0.0001169374082, 1.75101577e-05,9.033341485e-05,-0.0001421873167,0.0001084271498,
-	-1.15407729e-05,-9.048379434e-05,0.0001363010088,-0.0001006489329,5.995870652e-06,
-	9.008774214e-05,-0.0001307646453, 9.30356473e-05,-9.356299415e-07,-8.97273494e-05,
-	0.0001251318172,-8.545698802e-05,-3.978372206e-06,8.885992429e-05,-0.0001189851973,
-	7.802621258e-05,7.945802281e-06,-8.717383025e-05,0.0001132392208,-7.183873822e-05,
-	-1.137353411e-05,8.615876868e-05,-0.0001079351496,6.512096297e-05,1.474574765e-05,
-	-8.375782636e-05,0.0001023633595,-6.015915642e-05,-1.742820132e-05, 8.22423317e-05,
-	-9.661208605e-05,5.529719783e-05,1.953292121e-05,-7.958550123e-05, 9.24299311e-05,
-	-5.01929826e-05,-2.038280763e-05,7.752291276e-05,-8.799001807e-05,4.676288518e-05,
-	2.093712101e-05,-7.502733934e-05, 8.43184971e-05,-4.429027103e-05,-2.093533294e-05,
-	7.332587847e-05,-8.305725351e-05,4.538151188e-05,1.740438529e-05,-6.912302342e-05,
-	8.02757786e-05,-4.392081973e-05,-2.120726094e-05,8.157099364e-05,-0.0001066198747,
-	8.42079462e-05,-2.616242818e-05,-3.647237099e-05,6.405049498e-05,-1.742970744e-05,
-	-0.0001386724762,0.0004388026136,-0.000923007261,-0.000866600778
-};
+HalfBandDecimator::HalfBandDecimator() :
+	m_keep(0),
+	m_havePending(false),
+	m_pendingI(0),
+	m_pendingQ(0),
+	m_backend(SIMD::BackendScalar)
+{
+}
 
-static const float H80[1024] = {
-	-0.0002591478697, 0.001208678237,0.0005645374767,-0.0001438382315,0.0001439282787,
-	-5.627432256e-05,-9.369889085e-06,6.253508036e-05,-8.987089677e-05, 8.70268268e-05,
-	-5.623194011e-05,7.823024134e-06,4.199779141e-05,-7.627445302e-05,8.280923066e-05,
-	-5.906627848e-05,1.326068286e-05,3.789212496e-05,-7.537344209e-05,8.466608415e-05,
-	-6.171959831e-05,1.457525104e-05,3.907392238e-05,-7.866001397e-05,8.841533418e-05,
-	-6.389347254e-05, 1.37919169e-05,  4.2820011e-05,-8.394021279e-05,9.297321958e-05,
-	-6.561305054e-05,1.170118685e-05, 4.80907438e-05,-9.033918468e-05,9.785215661e-05,
-	-6.6845314e-05,8.590440302e-06,5.445696661e-05,-9.746331489e-05,0.0001028356419,
-	-6.756049697e-05,4.602193258e-06, 6.16823163e-05,-0.0001050786595,0.0001077585621,
-	-6.770716573e-05,-2.18331536e-07,6.964931526e-05,-0.0001130452074,0.0001125139825,
-	-6.724040577e-05,-5.83445717e-06,7.827389345e-05,-0.0001212789357, 0.000117040312,
-	-6.616154133e-05,-1.224148309e-05,8.758425247e-05,-0.0001297197305,0.0001210501359,
-	-6.412671792e-05,-1.918762064e-05,9.667403356e-05,-0.0001381046168,0.0001258231932,
-	-6.242765085e-05,-2.749802115e-05,0.0001076535045,-0.0001469072304,0.0001292861416,
-	-5.906295701e-05,-3.622579607e-05,0.0001183821951,-0.0001561011304,0.0001323396718,
-	-5.482397319e-05,-4.513600288e-05,   0.0001302163,-0.0001649932383,0.0001345399942,
-	-5.085102021e-05,-5.610962762e-05, 0.000141723096,-0.0001739930158,0.0001367911755,
-	-4.512943269e-05,-6.691271847e-05,0.0001543682447,-0.0001824760693,0.0001384992793,
-	-3.859531353e-05,-7.875441224e-05,0.0001672223443,-0.0001910306019,0.0001394020364,
-	-3.128037133e-05,-9.145505464e-05, 0.000180366158,-0.0001993619662, 0.000139518088,
-	-2.298454274e-05,-0.0001050147403,0.0001938767091,-0.0002074456715,0.0001388738165,
-	-1.371542567e-05,-0.0001193548233, 0.000207656587,-0.0002151589142,0.0001373291598,
-	-3.36636981e-06, -0.00013454484, 0.000221727445,-0.0002224877826,0.0001348906226,
-	8.021465874e-06,-0.0001504829706,0.0002359624923,-0.0002293320431,0.0001314586989,
-	2.060343104e-05,-0.0001673606166,0.0002503589203,-0.0002354194439,0.0001268494671,
-	3.407993427e-05,-0.0001846001978,0.0002647819929,-0.0002411841851,0.0001212983261,
-	4.889640695e-05,-0.0002028151357,0.0002792467712,-0.0002461292897,0.0001145775605,
-	6.478340947e-05,-0.0002216891007,0.0002936409146,-0.0002501846757,0.0001065850884,
-	8.181377052e-05,-0.0002412729373,0.0003079172748,-0.0002533519291,9.741766553e-05,
-	0.0001000474367,-0.0002614648838,0.0003218324855,-0.0002556556137, 8.68464922e-05,
-	0.0001196102094,-0.0002820622176,0.0003356400412,-0.0002569158969,7.475966413e-05,
-	0.0001401061745,-0.0003033672983,0.0003489566443,-0.000256940024,6.139990001e-05,
-	0.000162079843,-0.0003249304427,0.0003619693161,-0.0002557476982,4.648980394e-05,
-	0.0001850828412,-0.0003470301453,0.0003742589615,-0.0002533528605,2.994934584e-05,
-	0.0002092484647,-0.0003694921324,0.0003859481949,-0.0002495665394, 1.18713715e-05,
-	0.0002345877147,-0.0003921830503, 0.000396892603,-0.0002442644618,-7.811861906e-06,
-	0.0002610658994,-0.0004150891909,0.0004070844443,-0.0002374521864,-2.923734792e-05,
-	0.0002887599694,-0.0004380590981,0.0004161481338,-0.0002289022959,-5.226084613e-05,
-	0.0003174203448,-0.0004610832257,0.0004242579744,-0.0002186472266,-7.704873133e-05,
-	0.0003471168457, -0.00048401198,0.0004311862867,-0.000206565499,-0.0001036145113,
-	0.0003778435639,-0.0005067630555,0.0004368105438,-0.0001925937104,-0.0001319516159,
-	0.0004095149343,-0.0005292129936,0.0004410146212,-0.0001766254136,-0.0001621047413,
-	0.0004420764744,-0.000551268342,0.0004437207535,-0.0001585821446,-0.0001940840593,
-	0.0004754156107,-0.0005728343967,0.0004447869433,-0.0001383262861,-0.0002278451575,
-	0.0005095247761,-0.0005938289687,0.0004440158955,-0.0001158858431,-0.000263404625,
-	0.0005443725386,-0.000613980752,0.0004413865972,-9.113072883e-05,-0.0003008542699,
-	0.0005797207123,-0.000633326883,0.0004367225629,-6.395709352e-05,-0.0003400103888,
-	0.0006156516029,-0.000651583774,0.0004299176508,-3.434832252e-05,-0.0003810401831,
-	0.000651902461,-0.0006687486311,0.0004207729362,-2.298980917e-06,-0.000423779944,
-	0.0006885062903,-0.0006846347824, 0.000409278291, 3.24700668e-05,-0.0004683037696,
-	0.0007253065705,-0.0006989914691,   0.0003952478,6.983904314e-05,-0.0005145040341,
-	0.0007621842669,-0.0007117456989,0.0003785071312,0.0001099068177,-0.0005623832694,
-	0.0007990266895,-0.0007227700553,0.0003589619882,0.0001527335698,-0.0006118739257,
-	0.0008356795297,-0.0007318529533,0.0003364613221,0.0001983939874,-0.0006629588315,
-	0.0008720234619,-0.0007388541708,0.0003108931414,0.0002469143365,-0.0007155341445,
-	0.0009079027805,-0.0007435721927,0.0002820781374,0.0002983580926,-0.0007695693057,
-	0.0009432005463,-0.0007458534092,0.0002499070542, 0.000352738105,-0.000824976014,
-	0.0009777336381,-0.0007454640581,0.0002142235899,0.0004101286177,-0.0008817435009,
-	0.001011337154,-0.0007422508206,0.0001749256044,0.0004705898464,-0.0009397090762,
-	0.001043816563,-0.0007360219606, 0.000131770139,0.0005341387005,-0.0009988200618,
-	0.001075087348,-0.0007265296299,8.467459702e-05,0.0006008027704, -0.00105900038,
-	0.001104793162,-0.0007136036293,3.349684266e-05,0.0006706443382,-0.001120147994,
-	0.001132949488,-0.0006969999522,-2.198339462e-05,0.0007436771411,-0.001182166394,
-	0.001159179257,-0.0006765197613,-8.193504618e-05,0.0008199898293,-0.001244928455,
-	0.0011833756,-0.0006518702139,-0.0001464504458,  0.00089960068, -0.00130833115,
-	0.001205257839,-0.000622822321,-0.0002157988492,0.0009825462475,-0.001372299506,
-	0.001224608626,-0.0005891358014,-0.0002901624248, 0.001068864134,-0.001436681137,
-	0.001241168124,-0.000550490804,-0.0003697565699, 0.001158651779,-0.001501358929,
-	0.001254704897,-0.000506589131,-0.0004547867866, 0.001251949347, -0.00156621018,
-	0.001264909748,-0.0004570995807,-0.0005455198116, 0.001348862192,-0.001631107298,
-	0.00127151655,-0.0004016947933,-0.0006422356237, 0.001449472969,-0.001695911167,
-	0.001274196664,-0.0003399805282,-0.0007452622522, 0.001553904731,-0.001760489773,
-	0.001272635651,-0.0002715320152,-0.0008549219347,  0.00166227133,-0.001824752428,
-	0.001266441308,-0.0001958425855,-0.0009716043132,  0.00177475391,-0.001888495171,
-	0.001255221665,-0.0001125040581,-0.001095768996, 0.001891561435,-0.001951614977,
-	0.001238570898,-2.084098742e-05,-0.001227912609, 0.002012905432, -0.00201401813,
-	0.001215962926,7.976733468e-05,-0.001368627301, 0.002139104297,-0.002075497294,
-	0.001186915208,0.0001900867792,-0.001518606674, 0.002270489931,-0.002135963645,
-	0.001150782453,0.0003109496611, -0.00167865376, 0.002407517517,-0.002195247915,
-	0.001106920186,0.0004433979339,-0.001849710825, 0.002550697885,-0.002253255574,
-	0.001054504071,0.0005885740393,-0.002032933058, 0.002700668294,-0.002309840173,
-	0.000992635265, 0.000747883576,-0.002229671227, 0.002858236665,-0.002364856424,
-	0.0009202523506,0.0009229877032,-0.002441553399, 0.003024386242,-0.002418173011,
-	0.0008360919892, 0.001115900581, -0.00267060101, 0.003200314706,-0.002469704719,
-	0.0007386070793, 0.001329066232,-0.002919281833, 0.003387541976, -0.00251930207,
-	0.000625949644,  0.00156549376,-0.003190696938, 0.003588016611, -0.00256685284,
-	0.0004957810743, 0.001828954555,-0.003488688264, 0.003804149339,-0.002612230135,
-	0.0003452698293, 0.002124236431,-0.003818242811,  0.00403907802,-0.002655355027,
-	0.0001707396004, 0.002457478782, -0.00418572221, 0.004296942614,-0.002696098993,
-	-3.260829908e-05, 0.002836676314,-0.004599583335, 0.004583187867,-0.002734358888,
-	-0.0002710115223, 0.003272546921,-0.005071091466,  0.00490514189,-0.002770065796,
-	-0.0005530092749, 0.003779650433, -0.00561573077, 0.005273013376,-0.002803107258,
-	-0.0008903523558, 0.004378334153,-0.006255290471, 0.005701191258,-0.002833419247,
-	-0.001299942262, 0.005097922403,-0.007021428552, 0.006210817955,-0.002860917477,
-	-0.00180671853, 0.005982290022,-0.007961861789, 0.006834012922,-0.002885543508,
-	-0.00244936836, 0.007100058254,-0.009152087383, 0.007622238714,-0.002907229355,
-	-0.003291069064, 0.008564899676, -0.01071886718, 0.008663133718,-0.002925908426,
-	-0.004442797042,  0.01057974529, -0.01289256848,  0.01011903118,-0.002941554412,
-	-0.006118684541,  0.01354562212,  -0.0161400307,   0.0123278331,-0.002954118652,
-	-0.008792567067,  0.01838112995, -0.02157211676,  0.01612836868,-0.002963563194,
-	-0.01376232784,     0.02775486, -0.03263871744,  0.02433331497,-0.002969885012,
-	-0.02631963789,  0.05403982848, -0.06812330335,  0.05582848564,-0.002973040566,
-	-0.1223123148,    0.604534924,    0.604534924,  -0.1223123148,-0.002973040566,
-	0.05582848564, -0.06812330335,  0.05403982848, -0.02631963789,-0.002969885012,
-	0.02433331497, -0.03263871744,     0.02775486, -0.01376232784,-0.002963563194,
-	0.01612836868, -0.02157211676,  0.01838112995,-0.008792567067,-0.002954118652,
-	0.0123278331,  -0.0161400307,  0.01354562212,-0.006118684541,-0.002941554412,
-	0.01011903118, -0.01289256848,  0.01057974529,-0.004442797042,-0.002925908426,
-	0.008663133718, -0.01071886718, 0.008564899676,-0.003291069064,-0.002907229355,
-	0.007622238714,-0.009152087383, 0.007100058254, -0.00244936836,-0.002885543508,
-	0.006834012922,-0.007961861789, 0.005982290022, -0.00180671853,-0.002860917477,
-	0.006210817955,-0.007021428552, 0.005097922403,-0.001299942262,-0.002833419247,
-	0.005701191258,-0.006255290471, 0.004378334153,-0.0008903523558,-0.002803107258,
-	0.005273013376, -0.00561573077, 0.003779650433,-0.0005530092749,-0.002770065796,
-	0.00490514189,-0.005071091466, 0.003272546921,-0.0002710115223,-0.002734358888,
-	0.004583187867,-0.004599583335, 0.002836676314,-3.260829908e-05,-0.002696098993,
-	0.004296942614, -0.00418572221, 0.002457478782,0.0001707396004,-0.002655355027,
-	0.00403907802,-0.003818242811, 0.002124236431,0.0003452698293,-0.002612230135,
-	0.003804149339,-0.003488688264, 0.001828954555,0.0004957810743, -0.00256685284,
-	0.003588016611,-0.003190696938,  0.00156549376, 0.000625949644, -0.00251930207,
-	0.003387541976,-0.002919281833, 0.001329066232,0.0007386070793,-0.002469704719,
-	0.003200314706, -0.00267060101, 0.001115900581,0.0008360919892,-0.002418173011,
-	0.003024386242,-0.002441553399,0.0009229877032,0.0009202523506,-0.002364856424,
-	0.002858236665,-0.002229671227, 0.000747883576, 0.000992635265,-0.002309840173,
-	0.002700668294,-0.002032933058,0.0005885740393, 0.001054504071,-0.002253255574,
-	0.002550697885,-0.001849710825,0.0004433979339, 0.001106920186,-0.002195247915,
-	0.002407517517, -0.00167865376,0.0003109496611, 0.001150782453,-0.002135963645,
-	0.002270489931,-0.001518606674,0.0001900867792, 0.001186915208,-0.002075497294,
-	0.002139104297,-0.001368627301,7.976733468e-05, 0.001215962926, -0.00201401813,
-	0.002012905432,-0.001227912609,-2.084098742e-05, 0.001238570898,-0.001951614977,
-	0.001891561435,-0.001095768996,-0.0001125040581, 0.001255221665,-0.001888495171,
-	0.00177475391,-0.0009716043132,-0.0001958425855, 0.001266441308,-0.001824752428,
-	0.00166227133,-0.0008549219347,-0.0002715320152, 0.001272635651,-0.001760489773,
-	0.001553904731,-0.0007452622522,-0.0003399805282, 0.001274196664,-0.001695911167,
-	0.001449472969,-0.0006422356237,-0.0004016947933,  0.00127151655,-0.001631107298,
-	0.001348862192,-0.0005455198116,-0.0004570995807, 0.001264909748, -0.00156621018,
-	0.001251949347,-0.0004547867866,-0.000506589131, 0.001254704897,-0.001501358929,
-	0.001158651779,-0.0003697565699,-0.000550490804, 0.001241168124,-0.001436681137,
-	0.001068864134,-0.0002901624248,-0.0005891358014, 0.001224608626,-0.001372299506,
-	0.0009825462475,-0.0002157988492,-0.000622822321, 0.001205257839, -0.00130833115,
-	0.00089960068,-0.0001464504458,-0.0006518702139,   0.0011833756,-0.001244928455,
-	0.0008199898293,-8.193504618e-05,-0.0006765197613, 0.001159179257,-0.001182166394,
-	0.0007436771411,-2.198339462e-05,-0.0006969999522, 0.001132949488,-0.001120147994,
-	0.0006706443382,3.349684266e-05,-0.0007136036293, 0.001104793162, -0.00105900038,
-	0.0006008027704,8.467459702e-05,-0.0007265296299, 0.001075087348,-0.0009988200618,
-	0.0005341387005, 0.000131770139,-0.0007360219606, 0.001043816563,-0.0009397090762,
-	0.0004705898464,0.0001749256044,-0.0007422508206, 0.001011337154,-0.0008817435009,
-	0.0004101286177,0.0002142235899,-0.0007454640581,0.0009777336381,-0.000824976014,
-	0.000352738105,0.0002499070542,-0.0007458534092,0.0009432005463,-0.0007695693057,
-	0.0002983580926,0.0002820781374,-0.0007435721927,0.0009079027805,-0.0007155341445,
-	0.0002469143365,0.0003108931414,-0.0007388541708,0.0008720234619,-0.0006629588315,
-	0.0001983939874,0.0003364613221,-0.0007318529533,0.0008356795297,-0.0006118739257,
-	0.0001527335698,0.0003589619882,-0.0007227700553,0.0007990266895,-0.0005623832694,
-	0.0001099068177,0.0003785071312,-0.0007117456989,0.0007621842669,-0.0005145040341,
-	6.983904314e-05,   0.0003952478,-0.0006989914691,0.0007253065705,-0.0004683037696,
-	3.24700668e-05, 0.000409278291,-0.0006846347824,0.0006885062903,-0.000423779944,
-	-2.298980917e-06,0.0004207729362,-0.0006687486311, 0.000651902461,-0.0003810401831,
-	-3.434832252e-05,0.0004299176508,-0.000651583774,0.0006156516029,-0.0003400103888,
-	-6.395709352e-05,0.0004367225629,-0.000633326883,0.0005797207123,-0.0003008542699,
-	-9.113072883e-05,0.0004413865972,-0.000613980752,0.0005443725386,-0.000263404625,
-	-0.0001158858431,0.0004440158955,-0.0005938289687,0.0005095247761,-0.0002278451575,
-	-0.0001383262861,0.0004447869433,-0.0005728343967,0.0004754156107,-0.0001940840593,
-	-0.0001585821446,0.0004437207535,-0.000551268342,0.0004420764744,-0.0001621047413,
-	-0.0001766254136,0.0004410146212,-0.0005292129936,0.0004095149343,-0.0001319516159,
-	-0.0001925937104,0.0004368105438,-0.0005067630555,0.0003778435639,-0.0001036145113,
-	-0.000206565499,0.0004311862867, -0.00048401198,0.0003471168457,-7.704873133e-05,
-	-0.0002186472266,0.0004242579744,-0.0004610832257,0.0003174203448,-5.226084613e-05,
-	-0.0002289022959,0.0004161481338,-0.0004380590981,0.0002887599694,-2.923734792e-05,
-	-0.0002374521864,0.0004070844443,-0.0004150891909,0.0002610658994,-7.811861906e-06,
-	-0.0002442644618, 0.000396892603,-0.0003921830503,0.0002345877147, 1.18713715e-05,
-	-0.0002495665394,0.0003859481949,-0.0003694921324,0.0002092484647,2.994934584e-05,
-	-0.0002533528605,0.0003742589615,-0.0003470301453,0.0001850828412,4.648980394e-05,
-	-0.0002557476982,0.0003619693161,-0.0003249304427, 0.000162079843,6.139990001e-05,
-	-0.000256940024,0.0003489566443,-0.0003033672983,0.0001401061745,7.475966413e-05,
-	-0.0002569158969,0.0003356400412,-0.0002820622176,0.0001196102094, 8.68464922e-05,
-	-0.0002556556137,0.0003218324855,-0.0002614648838,0.0001000474367,9.741766553e-05,
-	-0.0002533519291,0.0003079172748,-0.0002412729373,8.181377052e-05,0.0001065850884,
-	-0.0002501846757,0.0002936409146,-0.0002216891007,6.478340947e-05,0.0001145775605,
-	-0.0002461292897,0.0002792467712,-0.0002028151357,4.889640695e-05,0.0001212983261,
-	-0.0002411841851,0.0002647819929,-0.0001846001978,3.407993427e-05,0.0001268494671,
-	-0.0002354194439,0.0002503589203,-0.0001673606166,2.060343104e-05,0.0001314586989,
-	-0.0002293320431,0.0002359624923,-0.0001504829706,8.021465874e-06,0.0001348906226,
-	-0.0002224877826, 0.000221727445, -0.00013454484,-3.36636981e-06,0.0001373291598,
-	-0.0002151589142, 0.000207656587,-0.0001193548233,-1.371542567e-05,0.0001388738165,
-	-0.0002074456715,0.0001938767091,-0.0001050147403,-2.298454274e-05, 0.000139518088,
-	-0.0001993619662, 0.000180366158,-9.145505464e-05,-3.128037133e-05,0.0001394020364,
-	-0.0001910306019,0.0001672223443,-7.875441224e-05,-3.859531353e-05,0.0001384992793,
-	-0.0001824760693,0.0001543682447,-6.691271847e-05,-4.512943269e-05,0.0001367911755,
-	-0.0001739930158, 0.000141723096,-5.610962762e-05,-5.085102021e-05,0.0001345399942,
-	-0.0001649932383,   0.0001302163,-4.513600288e-05,-5.482397319e-05,0.0001323396718,
-	-0.0001561011304,0.0001183821951,-3.622579607e-05,-5.906295701e-05,0.0001292861416,
-	-0.0001469072304,0.0001076535045,-2.749802115e-05,-6.242765085e-05,0.0001258231932,
-	-0.0001381046168,9.667403356e-05,-1.918762064e-05,-6.412671792e-05,0.0001210501359,
-	-0.0001297197305,8.758425247e-05,-1.224148309e-05,-6.616154133e-05, 0.000117040312,
-	-0.0001212789357,7.827389345e-05,-5.83445717e-06,-6.724040577e-05,0.0001125139825,
-	-0.0001130452074,6.964931526e-05,-2.18331536e-07,-6.770716573e-05,0.0001077585621,
-	-0.0001050786595, 6.16823163e-05,4.602193258e-06,-6.756049697e-05,0.0001028356419,
-	-9.746331489e-05,5.445696661e-05,8.590440302e-06, -6.6845314e-05,9.785215661e-05,
-	-9.033918468e-05, 4.80907438e-05,1.170118685e-05,-6.561305054e-05,9.297321958e-05,
-	-8.394021279e-05,  4.2820011e-05, 1.37919169e-05,-6.389347254e-05,8.841533418e-05,
-	-7.866001397e-05,3.907392238e-05,1.457525104e-05,-6.171959831e-05,8.466608415e-05,
-	-7.537344209e-05,3.789212496e-05,1.326068286e-05,-5.906627848e-05,8.280923066e-05,
-	-7.627445302e-05,4.199779141e-05,7.823024134e-06,-5.623194011e-05, 8.70268268e-05,
-	-8.987089677e-05,6.253508036e-05,-9.369889085e-06,-5.627432256e-05,0.0001439282787,
-	-0.0001438382315,0.0005645374767, 0.001208678237,-0.0002591478697
-};
+void HalfBandDecimator::create(double passband, int maxCount, SIMD::Backend backend)
+{
+	// Kaiser window length for the transition passband .. 0.5 - passband, rounded up to
+	// 4 * K - 1 taps: the center tap and K non-zero taps on each side
+	double transition = 0.5 - 2.0 * passband;
+	int nTaps = (int)ceil((KaiserAttenuation - 7.95) / (14.36 * transition)) + 1;
+	int k = (nTaps + 1 + 3) / 4;
+	if(k < 2)
+		k = 2;
+	qDebug("half-band decimator with %d taps", 4 * k - 1);
 
-static const float H85[1024] = {
-	0.000893485907,0.0009355185903,-0.0005184939364,0.0002533947991,-8.744387014e-05,
-	-1.272175996e-05,6.762836711e-05,-8.984271699e-05,8.746955427e-05,-6.679978105e-05,
-	3.388378536e-05,4.643071861e-06,-4.17098563e-05,7.044547237e-05,-8.534175868e-05,
-	8.327823161e-05,-6.438763376e-05,3.216684127e-05, 6.97355199e-06,-4.497928967e-05,
-	7.372530672e-05,-8.684334898e-05,8.111853094e-05,-5.739421977e-05,2.046284135e-05,
-	2.178099021e-05,-6.008178389e-05,8.571620856e-05,-9.279205551e-05,7.876780728e-05,
-	-4.74703229e-05,3.175604888e-06,4.071102376e-05,-7.854105206e-05,9.834742377e-05,
-	-9.579438483e-05,7.253236254e-05,-3.18299135e-05,-1.782865183e-05,6.408141053e-05,
-	-9.636181494e-05,0.0001078484274,-9.532655531e-05,6.036597551e-05,-1.040537154e-05,
-	-4.295213148e-05, 8.73869285e-05,-0.0001128806543,0.0001134233898,-8.814819012e-05,
-	4.190371692e-05,1.526229426e-05,-7.028495747e-05,0.0001102901952,-0.0001257923432,
-	0.0001128589429,-7.391079271e-05,1.723911555e-05,4.478848496e-05,-9.801280976e-05,
-	0.0001302674937,-0.0001330285595,0.0001056789988,-5.286740634e-05,-1.283863094e-05,
-	7.716035179e-05,-0.0001252760849,0.0001454045123,-0.0001328619255,8.972947398e-05,
-	-2.487575512e-05,-4.70365012e-05,0.0001096658234,-0.0001487393456, 0.000154632784,
-	-0.0001249992201,6.599255721e-05,9.360445802e-06,-8.425768465e-05,0.0001415559964,
-	-0.0001675349486,0.0001554905903,-0.0001075145192,3.394790838e-05, 4.89677077e-05,
-	-0.0001224709267,0.0001694213861,-0.0001784278138,0.0001466642279,-8.072734636e-05,
-	-5.105311175e-06,9.145263175e-05,-0.0001588507876,0.0001910165593,-0.0001801911712,
-	0.000127685722,-4.488549166e-05,-4.975824777e-05,0.0001350703824,-0.0001911156869,
-	0.0002044818393,-0.0001713056845,9.807750757e-05,-8.439644716e-07,-9.841038263e-05,
-	0.000177107082,-0.0002168250066,0.0002076027304,-0.0001506180124,5.804008106e-05,
-	4.973834439e-05,-0.0001483105589, 0.000214789703,-0.0002332817094,0.0001987229334,
-	-0.0001179841929,8.641286513e-06,0.0001048090562,-0.0001963743125,0.0002447590523,
-	-0.0002380020596,0.0001766668429,-7.352846296e-05,-4.833199273e-05,0.0001615172077,
-	-0.0002397198259,0.0002645481145,-0.0002292714053,0.0001407481468,-1.837447053e-05,
-	-0.0001105086558,0.0002165108745,-0.0002748723782,0.0002714703151,-0.0002058532118,
-	9.18092046e-05,4.536590495e-05,-0.000174656423,0.0002663625055,-0.0002987323678,
-	0.0002632966498,-0.0001669731573,3.066975114e-05,0.0001151739198,-0.000237257409,
-	0.0003071982064,-0.0003081052855,0.0002385271364,-0.0001130875389,-4.051464566e-05,
-	0.0001875834569, -0.00029442698,0.0003357780515,-0.0003010588116, 0.000196737863,
-	-4.562616232e-05,-0.0001186007503,0.0002585932089,-0.0003418604028,0.0003483862674,
-	-0.0002752309956,0.0001378205343,3.351030318e-05,-0.0002002068068,0.0003239826183,
-	-0.000375762349,0.0003425025789,-0.0002303107321,6.352148193e-05,0.0001206559609,
-	-0.0002804464602,0.0003788421163,-0.0003922168689,0.0003161030181,-0.0001663984876,
-	-2.393212708e-05,0.0002120411082,-0.0003548352979,0.0004189230385,-0.0003882779856,
-	0.0002683172061,-8.494337817e-05,-0.0001208994872,0.0003026230261,-0.0004181689583,
-	0.0004400411271,-0.0003615867754, 0.000199152084, 1.15123994e-05,-0.0002230858372,
-	0.0003871442459,-0.000465424062,0.0004385907378,-0.0003110218095,0.0001102375099,
-	0.0001191006813,-0.0003249956062,0.0004599411332,-0.0004919757484,0.0004120714148,
-	-0.0002366243425,4.202713626e-06,0.0002329778072,-0.0004207744787,0.0005154222599,
-	-0.0004938024795, 0.000358971447,-0.0001398910972,-0.0001147420044,0.0003472460667,
-	-0.0005041679833,0.0005483864225,-0.0004679867707,0.0002792658925,-2.371232949e-05,
-	-0.0002414026385,0.0004555764026,-0.0005690811086,0.0005543436855,-0.0004126805579,
-	0.0001744445472,0.0001075001564,-0.0003693696053,0.0005509761977,-0.0006095887511,
-	0.0005298251053,-0.0003277255455,4.751631786e-05,0.0002480078547,-0.0004915376776,
-	0.0006266116397,-0.0006206636317,0.0004727699852,-0.0002145029721,-9.684995894e-05,
-	0.0003909942752,-0.0006004344323,0.0006759576499,-0.0005982150906, 0.000382574799,
-	-7.612715854e-05,-0.0002525113523,0.0005286391242,-0.0006883153692,0.0006932385731,
-	-0.0005398149951,0.0002606885682,8.236175927e-05,-0.0004119689693, 0.000652600429,
-	-0.0007479048218,0.0006738154916,-0.000444652338,0.0001103195536,0.0002544394229,
-	-0.0005667463411,0.0007544553373,-0.0007727345801,0.0006147502572,-0.0003138784377,
-	-6.338767707e-05,0.0004320474691,-0.0007077435148,0.0008260452887,-0.0007574711344,
-	0.0005147873308,-0.000150766864,-0.0002533581574,0.0006058983272,-0.0008255123976,
-	0.000859946711,-0.0006984940264,  0.00037495172,3.925241253e-05,-0.0004509353312,
-	0.0007659816183,-0.0009109635139,0.0008500868571,-0.0005940914853,0.0001984129194,
-	0.0002487550373,-0.0006460406585,0.0009019346326, -0.00095578935, 0.000792164763,
-	-0.0004450449196,-9.151330232e-06,0.0004683088046,-0.0008276376757, 0.001003529993,
-	-0.0009529321105,0.0006838733098,-0.0002544006275,-0.0002398988581,0.0006871162332,
-	-0.0009843594162, 0.001061400282,-0.0008971855277, 0.000525473326,-2.790243525e-05,
-	-0.000483841286,0.0008930988261,-0.001104762196, 0.001067426289,-0.0007856555167,
-	0.0003199840721,0.0002261295012,-0.000729177671, 0.001073611667,-0.001178238424,
-	0.001015363843,-0.0006179665215,7.308841305e-05,0.0004971299786,-0.0009628366679,
-	0.001216008095,-0.001195420278, 0.000901424326,-0.0003967986559,-0.000206536919,
-	0.0007723467425,-0.001170792617, 0.001308156759,-0.001148856827,0.0007245390443,
-	-0.0001278506825,-0.0005076922826, 0.001037533279,-0.001338929054,  0.00133930915,
-	-0.001033702982,0.0004869376426, 0.000180013827,-0.0008167634369, 0.001277319971,
-	-0.00145359803, 0.001300631673,-0.0008479539538,0.0001940417133, 0.000515033782,
-	-0.001118198386, 0.001475894707,-0.001502275118, 0.001185808913,-0.000593053177,
-	-0.0001451897842,0.0008626863128,-0.001395144616, 0.001617767964,-0.001474438002,
-	0.0009916973067,-0.0002740590426,-0.0005184964393,  0.00120615738,-0.001629960141,
-	0.001688502263,-0.001362101641,0.0007186908042,0.0001002281278,-0.0009105353383,
-	0.001526907668, -0.00180505577,  0.00167546689,-0.001160526532,0.0003711153695,
-	0.0005172407255,-0.001303217257,  0.00180534902,-0.001903733006, 0.001568586449,
-	-0.000868652889,-4.268703196e-05,0.0009609509725,-0.001676342566, 0.002021554392,
-	-0.001910822117, 0.001361002331,-0.0004895945895,-0.0005101627903, 0.001412083046,
-	-0.00200807373, 0.002156042028,-0.001813598559, 0.001049646875,-3.078861482e-05,
-	-0.001014880836, 0.001848724554,-0.002275879495, 0.002190648578,-0.001602415578,
-	0.0006357273669,0.0004958072677,-0.001536637545, 0.002246803837,-0.002457124181,
-	0.002109248191, -0.00127133471,0.0001249907073, 0.001073848573,-0.002051943447,
-	0.002580809407,-0.002529888181, 0.001898485352,-0.0008186805644,-0.000472019281,
-	0.001682739239,-0.002534538973, 0.002824486699,-0.002473753877, 0.001548327855,
-	-0.0002471948974,-0.001140190288, 0.002298057545,-0.002955925418, 0.002951510483,
-	-0.002270344412, 0.001052540261, 0.000435638678,-0.001859695418, 0.002891779644,
-	-0.003285817802, 0.002935855882,-0.001903657219,0.0004087757261, 0.001217788085,
-	-0.00260648015, 0.003432800528,-0.003492662683, 0.002752278466,-0.001360278926,
-	-0.0003814697266, 0.002082864288,-0.003352478147, 0.003887094557,-0.003543573432,
-	0.002376017859,-0.0006289434386,-0.001313315937, 0.003010545392,-0.004065815359,
-	0.004217664246,-0.003403936513, 0.001782014384,0.0003005024628,-0.002379567595,
-	0.003977298271,-0.004710991867, 0.004383792635, -0.00303583988,0.0009428354097,
-	0.001439204789,-0.003572349437, 0.004957075696,-0.005248120986, 0.004338943399,
-	-0.002394763287,-0.0001754125988, 0.002803410171,-0.004886121955, 0.005922262091,
-	-0.005631227978, 0.004026089329,-0.001422457397,-0.001621373696, 0.004422182683,
-	-0.006323000416, 0.006844745018,-0.005803838838, 0.003367624711,-3.227452908e-05,
-	-0.003475345904, 0.006352948491,-0.007902825251, 0.007696785033,-0.005688077305,
-	0.002242310671, 0.001923834556,-0.005886972416, 0.008716279641,-0.009685731493,
-	0.00845231209,-0.005158059765, 0.000428699248, 0.004737193231,-0.009170216508,
-	0.01178430207, -0.01182956155, 0.009087757207,-0.003963122144,-0.002558785491,
-	0.009084796533, -0.01409213152,  0.01625833288,   -0.014775916, 0.009583023377,
-	-0.00145440537,-0.008078059182,  0.01697288081, -0.02305796184,  0.02447562292,
-	-0.02011129074, 0.009922331199,  0.00490046246, -0.02197452076,  0.03796298802,
-	-0.04894897714,  0.05082362518, -0.03945580125,  0.01009475812,   0.0459625423,
-	-0.1594137549,   0.6183279753,   0.6183279753,  -0.1594137549,   0.0459625423,
-	0.01009475812, -0.03945580125,  0.05082362518, -0.04894897714,  0.03796298802,
-	-0.02197452076,  0.00490046246, 0.009922331199, -0.02011129074,  0.02447562292,
-	-0.02305796184,  0.01697288081,-0.008078059182, -0.00145440537, 0.009583023377,
-	-0.014775916,  0.01625833288, -0.01409213152, 0.009084796533,-0.002558785491,
-	-0.003963122144, 0.009087757207, -0.01182956155,  0.01178430207,-0.009170216508,
-	0.004737193231, 0.000428699248,-0.005158059765,  0.00845231209,-0.009685731493,
-	0.008716279641,-0.005886972416, 0.001923834556, 0.002242310671,-0.005688077305,
-	0.007696785033,-0.007902825251, 0.006352948491,-0.003475345904,-3.227452908e-05,
-	0.003367624711,-0.005803838838, 0.006844745018,-0.006323000416, 0.004422182683,
-	-0.001621373696,-0.001422457397, 0.004026089329,-0.005631227978, 0.005922262091,
-	-0.004886121955, 0.002803410171,-0.0001754125988,-0.002394763287, 0.004338943399,
-	-0.005248120986, 0.004957075696,-0.003572349437, 0.001439204789,0.0009428354097,
-	-0.00303583988, 0.004383792635,-0.004710991867, 0.003977298271,-0.002379567595,
-	0.0003005024628, 0.001782014384,-0.003403936513, 0.004217664246,-0.004065815359,
-	0.003010545392,-0.001313315937,-0.0006289434386, 0.002376017859,-0.003543573432,
-	0.003887094557,-0.003352478147, 0.002082864288,-0.0003814697266,-0.001360278926,
-	0.002752278466,-0.003492662683, 0.003432800528, -0.00260648015, 0.001217788085,
-	0.0004087757261,-0.001903657219, 0.002935855882,-0.003285817802, 0.002891779644,
-	-0.001859695418, 0.000435638678, 0.001052540261,-0.002270344412, 0.002951510483,
-	-0.002955925418, 0.002298057545,-0.001140190288,-0.0002471948974, 0.001548327855,
-	-0.002473753877, 0.002824486699,-0.002534538973, 0.001682739239,-0.000472019281,
-	-0.0008186805644, 0.001898485352,-0.002529888181, 0.002580809407,-0.002051943447,
-	0.001073848573,0.0001249907073, -0.00127133471, 0.002109248191,-0.002457124181,
-	0.002246803837,-0.001536637545,0.0004958072677,0.0006357273669,-0.001602415578,
-	0.002190648578,-0.002275879495, 0.001848724554,-0.001014880836,-3.078861482e-05,
-	0.001049646875,-0.001813598559, 0.002156042028, -0.00200807373, 0.001412083046,
-	-0.0005101627903,-0.0004895945895, 0.001361002331,-0.001910822117, 0.002021554392,
-	-0.001676342566,0.0009609509725,-4.268703196e-05,-0.000868652889, 0.001568586449,
-	-0.001903733006,  0.00180534902,-0.001303217257,0.0005172407255,0.0003711153695,
-	-0.001160526532,  0.00167546689, -0.00180505577, 0.001526907668,-0.0009105353383,
-	0.0001002281278,0.0007186908042,-0.001362101641, 0.001688502263,-0.001629960141,
-	0.00120615738,-0.0005184964393,-0.0002740590426,0.0009916973067,-0.001474438002,
-	0.001617767964,-0.001395144616,0.0008626863128,-0.0001451897842,-0.000593053177,
-	0.001185808913,-0.001502275118, 0.001475894707,-0.001118198386, 0.000515033782,
-	0.0001940417133,-0.0008479539538, 0.001300631673, -0.00145359803, 0.001277319971,
-	-0.0008167634369, 0.000180013827,0.0004869376426,-0.001033702982,  0.00133930915,
-	-0.001338929054, 0.001037533279,-0.0005076922826,-0.0001278506825,0.0007245390443,
-	-0.001148856827, 0.001308156759,-0.001170792617,0.0007723467425,-0.000206536919,
-	-0.0003967986559, 0.000901424326,-0.001195420278, 0.001216008095,-0.0009628366679,
-	0.0004971299786,7.308841305e-05,-0.0006179665215, 0.001015363843,-0.001178238424,
-	0.001073611667,-0.000729177671,0.0002261295012,0.0003199840721,-0.0007856555167,
-	0.001067426289,-0.001104762196,0.0008930988261,-0.000483841286,-2.790243525e-05,
-	0.000525473326,-0.0008971855277, 0.001061400282,-0.0009843594162,0.0006871162332,
-	-0.0002398988581,-0.0002544006275,0.0006838733098,-0.0009529321105, 0.001003529993,
-	-0.0008276376757,0.0004683088046,-9.151330232e-06,-0.0004450449196, 0.000792164763,
-	-0.00095578935,0.0009019346326,-0.0006460406585,0.0002487550373,0.0001984129194,
-	-0.0005940914853,0.0008500868571,-0.0009109635139,0.0007659816183,-0.0004509353312,
-	3.925241253e-05,  0.00037495172,-0.0006984940264, 0.000859946711,-0.0008255123976,
-	0.0006058983272,-0.0002533581574,-0.000150766864,0.0005147873308,-0.0007574711344,
-	0.0008260452887,-0.0007077435148,0.0004320474691,-6.338767707e-05,-0.0003138784377,
-	0.0006147502572,-0.0007727345801,0.0007544553373,-0.0005667463411,0.0002544394229,
-	0.0001103195536,-0.000444652338,0.0006738154916,-0.0007479048218, 0.000652600429,
-	-0.0004119689693,8.236175927e-05,0.0002606885682,-0.0005398149951,0.0006932385731,
-	-0.0006883153692,0.0005286391242,-0.0002525113523,-7.612715854e-05, 0.000382574799,
-	-0.0005982150906,0.0006759576499,-0.0006004344323,0.0003909942752,-9.684995894e-05,
-	-0.0002145029721,0.0004727699852,-0.0006206636317,0.0006266116397,-0.0004915376776,
-	0.0002480078547,4.751631786e-05,-0.0003277255455,0.0005298251053,-0.0006095887511,
-	0.0005509761977,-0.0003693696053,0.0001075001564,0.0001744445472,-0.0004126805579,
-	0.0005543436855,-0.0005690811086,0.0004555764026,-0.0002414026385,-2.371232949e-05,
-	0.0002792658925,-0.0004679867707,0.0005483864225,-0.0005041679833,0.0003472460667,
-	-0.0001147420044,-0.0001398910972, 0.000358971447,-0.0004938024795,0.0005154222599,
-	-0.0004207744787,0.0002329778072,4.202713626e-06,-0.0002366243425,0.0004120714148,
-	-0.0004919757484,0.0004599411332,-0.0003249956062,0.0001191006813,0.0001102375099,
-	-0.0003110218095,0.0004385907378,-0.000465424062,0.0003871442459,-0.0002230858372,
-	1.15123994e-05, 0.000199152084,-0.0003615867754,0.0004400411271,-0.0004181689583,
-	0.0003026230261,-0.0001208994872,-8.494337817e-05,0.0002683172061,-0.0003882779856,
-	0.0004189230385,-0.0003548352979,0.0002120411082,-2.393212708e-05,-0.0001663984876,
-	0.0003161030181,-0.0003922168689,0.0003788421163,-0.0002804464602,0.0001206559609,
-	6.352148193e-05,-0.0002303107321,0.0003425025789,-0.000375762349,0.0003239826183,
-	-0.0002002068068,3.351030318e-05,0.0001378205343,-0.0002752309956,0.0003483862674,
-	-0.0003418604028,0.0002585932089,-0.0001186007503,-4.562616232e-05, 0.000196737863,
-	-0.0003010588116,0.0003357780515, -0.00029442698,0.0001875834569,-4.051464566e-05,
-	-0.0001130875389,0.0002385271364,-0.0003081052855,0.0003071982064,-0.000237257409,
-	0.0001151739198,3.066975114e-05,-0.0001669731573,0.0002632966498,-0.0002987323678,
-	0.0002663625055,-0.000174656423,4.536590495e-05, 9.18092046e-05,-0.0002058532118,
-	0.0002714703151,-0.0002748723782,0.0002165108745,-0.0001105086558,-1.837447053e-05,
-	0.0001407481468,-0.0002292714053,0.0002645481145,-0.0002397198259,0.0001615172077,
-	-4.833199273e-05,-7.352846296e-05,0.0001766668429,-0.0002380020596,0.0002447590523,
-	-0.0001963743125,0.0001048090562,8.641286513e-06,-0.0001179841929,0.0001987229334,
-	-0.0002332817094, 0.000214789703,-0.0001483105589,4.973834439e-05,5.804008106e-05,
-	-0.0001506180124,0.0002076027304,-0.0002168250066, 0.000177107082,-9.841038263e-05,
-	-8.439644716e-07,9.807750757e-05,-0.0001713056845,0.0002044818393,-0.0001911156869,
-	0.0001350703824,-4.975824777e-05,-4.488549166e-05, 0.000127685722,-0.0001801911712,
-	0.0001910165593,-0.0001588507876,9.145263175e-05,-5.105311175e-06,-8.072734636e-05,
-	0.0001466642279,-0.0001784278138,0.0001694213861,-0.0001224709267, 4.89677077e-05,
-	3.394790838e-05,-0.0001075145192,0.0001554905903,-0.0001675349486,0.0001415559964,
-	-8.425768465e-05,9.360445802e-06,6.599255721e-05,-0.0001249992201, 0.000154632784,
-	-0.0001487393456,0.0001096658234,-4.70365012e-05,-2.487575512e-05,8.972947398e-05,
-	-0.0001328619255,0.0001454045123,-0.0001252760849,7.716035179e-05,-1.283863094e-05,
-	-5.286740634e-05,0.0001056789988,-0.0001330285595,0.0001302674937,-9.801280976e-05,
-	4.478848496e-05,1.723911555e-05,-7.391079271e-05,0.0001128589429,-0.0001257923432,
-	0.0001102901952,-7.028495747e-05,1.526229426e-05,4.190371692e-05,-8.814819012e-05,
-	0.0001134233898,-0.0001128806543, 8.73869285e-05,-4.295213148e-05,-1.040537154e-05,
-	6.036597551e-05,-9.532655531e-05,0.0001078484274,-9.636181494e-05,6.408141053e-05,
-	-1.782865183e-05,-3.18299135e-05,7.253236254e-05,-9.579438483e-05,9.834742377e-05,
-	-7.854105206e-05,4.071102376e-05,3.175604888e-06,-4.74703229e-05,7.876780728e-05,
-	-9.279205551e-05,8.571620856e-05,-6.008178389e-05,2.178099021e-05,2.046284135e-05,
-	-5.739421977e-05,8.111853094e-05,-8.684334898e-05,7.372530672e-05,-4.497928967e-05,
-	6.97355199e-06,3.216684127e-05,-6.438763376e-05,8.327823161e-05,-8.534175868e-05,
-	7.044547237e-05,-4.17098563e-05,4.643071861e-06,3.388378536e-05,-6.679978105e-05,
-	8.746955427e-05,-8.984271699e-05,6.762836711e-05,-1.272175996e-05,-8.744387014e-05,
-	0.0002533947991,-0.0005184939364,0.0009355185903, 0.000893485907
-};
+	double beta = 0.1102 * (KaiserAttenuation - 8.7);
+	double norm = 1.0 / besselI0(beta);
+	double sum = 0;
+	m_coeff.resize(k);
+	for(int j = 0; j < k; ++j) {
+		double t = 2 * j + 1;
+		double r = t / (2 * k);
+		m_coeff[j] = sin(M_PI * t / 2.0) / (M_PI * t) * besselI0(beta * sqrt(1.0 - r * r)) * norm;
+		sum += m_coeff[j];
+	}
+	// unity gain at DC: 0.5 + 2 * sum = 1
+	for(int j = 0; j < k; ++j)
+		m_coeff[j] *= 0.25 / sum;
 
-static const float H90[1024] = {
-	0.001360524911,0.0002020814281,-0.0001894109882,0.0001779660815,-0.0001666486351,
-	0.0001542872924,-0.0001398598251,0.0001226232562,-0.0001022875949,  7.9059173e-05,
-	-5.369988867e-05,2.744346602e-05,-1.918812586e-06,-2.105376734e-05,   3.962552e-05,
-	-5.21778129e-05,5.748773765e-05,-5.494089783e-05,4.460686978e-05,-2.732757457e-05,
-	4.549409368e-06,2.079471778e-05,-4.906433242e-05,7.212701166e-05,-9.222379595e-05,
-	0.0001061174116,-0.0001112559985,0.0001067109624, -9.2900249e-05,7.116607594e-05,
-	-4.357191574e-05,1.271194014e-05, 1.84374785e-05,-4.678868208e-05, 6.94072296e-05,
-	-8.385092224e-05,8.842934039e-05,-8.244246419e-05,6.626686081e-05,-4.137782889e-05,
-	1.019841966e-05,2.412846516e-05,-5.792516458e-05,8.801853983e-05,-0.0001101166708,
-	0.0001230574126,-0.0001242410799,0.0001132442339,-9.125900397e-05,6.033194586e-05,
-	-2.330796451e-05,-1.619217255e-05,5.406264245e-05,-8.623189933e-05,0.0001091674858,
-	-0.0001202874919,0.0001182139749,-0.0001029218693,7.574096526e-05,-3.926652789e-05,
-	-2.880652346e-06,4.638527389e-05,-8.668901137e-05,0.0001194115976,-0.0001410241821,
-	0.0001486614638,-0.0001417177118,0.0001199889739,-8.572445222e-05,4.233744039e-05,
-	5.995632819e-06,-5.434858031e-05,9.755078645e-05,-0.0001309082727,0.0001507571869,
-	-0.0001547809952,0.0001422299392,-0.0001140417589,7.283356535e-05,-2.267356831e-05,
-	-3.131436824e-05,8.350233838e-05,-0.0001283441379,0.0001609715691,-0.0001776802674,
-	0.0001764163317,-0.0001567985164,0.0001207193563,-7.128098514e-05,1.368653011e-05,
-	4.627169983e-05,-0.0001024301309,0.0001487201371,-0.0001800225873, 0.000192810985,
-	-0.0001854003349,0.0001581412071,-0.0001134653503,5.574016541e-05,9.197938198e-06,
-	-7.464734517e-05, 0.000133751455,-0.0001801764156,0.0002087885805,-0.000216199187,
-	0.0002011870674,-0.0001648874022,0.0001106548589,-4.394182906e-05,-2.865401984e-05,
-	9.942644829e-05,-0.0001610436011,0.0002068608592, -0.00023166553, 0.000232488077,
-	-0.0002088103356,0.0001626210433,-9.830878116e-05,2.232182123e-05,5.755291204e-05,
-	-0.0001329939259,0.0001960181544,-0.0002397598437,0.0002592482197,-0.0002519551199,
-	0.0002181500604,-0.0001608812163,8.573888044e-05,-2.377047963e-07,-8.678678569e-05,
-	0.000166332582,-0.0002297574538,0.0002702314814,-0.0002830046287,0.0002662086918,
-	-0.0002211206884,0.0001519564539,-6.549066893e-05,-2.949155532e-05,0.0001231559872,
-	-0.0002056508965,0.0002681349579,-0.0003036663402,0.0003080099414,-0.0002801401715,
-	0.0002224217023,-0.000140375807,4.217390961e-05,6.218143244e-05,-0.0001618554961,
-	0.0002462783887,-0.0003063611803,0.0003352914064,-0.0003295792849,0.0002891415788,
-	-0.0002176165435, 0.000121997793,-1.184833491e-05,-0.0001015257149,0.0002062525018,
-	-0.0002911908086,0.0003471119562,-0.0003676355118,0.0003499824088,-0.0002953409276,
-	0.0002088188921,-9.89300388e-05,-2.321252759e-05,0.0001450175914,-0.0002536884567,
-	0.0003376055392,-0.0003875278635,0.0003976819862,-0.0003662715026,0.0002959521371,
-	-0.0001933547901,6.873356324e-05,6.521215255e-05,-0.0001946245175,0.0003058388247,
-	-0.0003868748026,0.0004287533811,-0.0004264239687,0.0003793651413,-0.000291759643,
-	0.0001721283916,-3.247892528e-05,-0.0001128959266,0.0002488541359,-0.0003609815903,
-	0.0004371309478,-0.0004687355831,0.0004517410125,-0.000387135573,0.0002808642457,
-	-0.00014342551,-1.134195736e-05,0.0001674506348,-0.0003085848293,0.0004197285452,
-	-0.0004887208925,0.0005076462403,-0.0004737198178,0.0003896152775,-0.0002633246768,
-	0.0001074089669,6.227403355e-05,-0.0002281862835,0.0003728869488,-0.0004808626545,
-	0.0005402041716,-0.0005439188099,0.0004907235852,-0.0003852677473,0.0002377640049,
-	-6.297440996e-05,-0.0001211985946,0.0002956574317,-0.000441938726,0.0005442960537,
-	-0.0005913032801,0.0005771243596,-0.0005022925907, 0.000373679999,-0.0002038920356,
-	1.005834383e-05,0.0001878915355,-0.0003693104954,0.0005149366334,-0.0006089466624,
-	0.0006406701286,-0.0006058165454,0.0005069839535,-0.0003535092983,0.0001605910657,
-	5.217677608e-05,-0.0002628422517, 0.000449290761,-0.0005916583468,  0.00067430333,
-	-0.0006876702537,0.0006292533362,-0.0005040463875,0.0003241250233,-0.0001074610409,
-	-0.000123853737,0.0003458130814,-0.0005350369029,0.0006712080212,-0.0007392400294,
-	0.0007309422363,-0.0006460054428,0.0004921297659,-0.0002843423863,4.354698103e-05,
-	0.0002055549267,-0.0004370135721,0.0006263351534,-0.0007530422299,0.0008029141463,
-	-0.0007695105742,0.0006550593534,-0.0004702675506,0.0002333839511,3.159324115e-05,
-	-0.0002973856463,0.0005361776566,-0.0007225511945,0.0008361954242,-0.0008640977903,
-	0.0008019953966,-0.0006549964892,0.0004371694522,-0.0001702126901,-0.0001187046073,
-	0.0003996753949,-0.0006431716029,0.0008231331012,-0.0009197558393,0.0009216193575,
-	-0.0008270724793,0.0006444907631,-0.000391645357,9.387843602e-05,0.0002183360775,
-	-0.0005125523312,0.0007577111246,-0.0009273881442, 0.001002653269,-0.0009741738904,
-	0.0008433088078,-0.000622150721,0.0003324451973,-3.438896556e-06,-0.0003310590691,
-	0.0006361354608,-0.0008794044843, 0.001034451183,-0.001083676354, 0.001020270982,
-	-0.0008490969776,0.0005863929982,-0.0002582026355,-0.0001021451899,0.0004574765626,
-	-0.0007705188473, 0.001007855637, -0.00114346738, 0.001161553897,-0.001058373018,
-	0.0008428111323,-0.0005356352776,0.0001675396779,0.0002239200549,-0.0005981617142,
-	0.000915758952,-0.001142575056, 0.001253431779, -0.00123488612, 0.001086813747,
-	-0.0008226338541,0.0004681301361,-5.895564755e-05,-0.0003629699349,0.0007536962512,
-	-0.001071850769, 0.001282955287,-0.001363199553, 0.001302077551,-0.001103683026,
-	0.000786554534,-0.000381935708,-6.926443893e-05,0.0005205941852,-0.000924824446,
-	0.001238899538,-0.001428464777, 0.001471636002,-0.001361479517, 0.001106995507,
-	-0.0007324120379,0.0002749339619,0.0002189497027,-0.0006981586339, 0.001112318016,
-	-0.001416980987, 0.001578441821,-0.001577376504, 0.001411171164, -0.00109441008,
-	0.0006576816086,-0.0001446468668,-0.0003923042386, 0.000897394435,-0.001317208516,
-	0.001606352278,-0.001732308883, 0.001679064473,-0.001449075295,  0.00106333592,
-	-0.0005594883696,-1.180868094e-05,0.0005919480463,-0.001120361267, 0.001540829195,
-	-0.00180742552, 0.001889490057,-0.001775135053, 0.001472792588,-0.001010721666,
-	0.0004343896871,0.0001979551162,-0.0008211284876, 0.001369738951,-0.001784980414,
-	0.002020919463,-0.002049524104, 0.001863936312,-0.001479564235,0.0009329235763,
-	-0.0002781763615,-0.0004181760596, 0.001084021991,-0.001649050973, 0.002052166266,
-	-0.002248022705, 0.002212086227,-0.001943577896, 0.001466065412,-0.0008254147251,
-	8.5492582e-05,0.0006782031269,-0.001386155374, 0.001963096438,-0.002345944988,
-	0.002490640618,-0.002377132419, 0.002011986682,-0.001428225776,0.0006824351149,
-	0.0001506597764,-0.0009856338147, 0.001735051046,-0.002318555722, 0.002671430353,
-	-0.002751696389, 0.002544984221,-0.002066634595, 0.001360753318,-0.0004962424864,
-	-0.0004398741294, 0.001351102837,-0.002141371602, 0.002725061728,-0.003036204027,
-	0.003035821486,-0.002716609975, 0.002104470739,-0.001256574295,0.0002561286674,
-	0.0007956839981,-0.001789828297, 0.002620630665,-0.003196877195, 0.003451714525,
-	-0.003350237384, 0.002893940778,-0.002121479949, 0.001105607953, 5.35385625e-05,
-	-0.001238168217, 0.002324685687,-0.003196395701, 0.003755912185, -0.00393581856,
-	0.003706550924,-0.003080519382,   0.0021120077,-0.0008927140734,-0.0004567484139,
-	0.001798584242,-0.002991672605, 0.003906176891,-0.004437445663, 0.004517662805,
-	-0.004124083556, 0.003282798221,-0.002067579422, 0.000593724777,0.0009925779887,
-	-0.00252846838, 0.003850799752,  -0.0048131207, 0.005301458761,-0.005247357301,
-	0.004636576865,-0.003512558527,  0.00197400921,-0.0001667251199,-0.001729776035,
-	0.003519591643,-0.005010120105, 0.006032150239,-0.006458369084, 0.006218277384,
-	-0.005307868123, 0.003792902222,-0.001805154723,-0.0004682633735, 0.002801700495,
-	-0.004952456802, 0.006684985943,-0.007795486599, 0.008134419098,-0.007624604739,
-	0.006272905972,-0.004173946101, 0.001505211811, 0.001486445311,-0.004505997524,
-	0.007237382233, -0.00937428046,  0.01065164153, -0.01087501924,  0.00994468201,
-	-0.007871951908, 0.004785723984,-0.0009281293023,-0.003361005103, 0.007669927087,
-	-0.01154926047,  0.01455208287,  -0.0162765719,  0.01640748233, -0.01475284901,
-	0.01127249468,-0.006095668767,-0.0004740759032, 0.007967215031, -0.01576925628,
-	0.02315206826, -0.02931182645,  0.03340772167, -0.03459310159,  0.03202558681,
-	-0.02483195066,  0.01197475009,  0.00811859034, -0.03861430287,  0.08790099621,
-	-0.1877061576,   0.6283088326,   0.6283088326,  -0.1877061576,  0.08790099621,
-	-0.03861430287,  0.00811859034,  0.01197475009, -0.02483195066,  0.03202558681,
-	-0.03459310159,  0.03340772167, -0.02931182645,  0.02315206826, -0.01576925628,
-	0.007967215031,-0.0004740759032,-0.006095668767,  0.01127249468, -0.01475284901,
-	0.01640748233,  -0.0162765719,  0.01455208287, -0.01154926047, 0.007669927087,
-	-0.003361005103,-0.0009281293023, 0.004785723984,-0.007871951908,  0.00994468201,
-	-0.01087501924,  0.01065164153, -0.00937428046, 0.007237382233,-0.004505997524,
-	0.001486445311, 0.001505211811,-0.004173946101, 0.006272905972,-0.007624604739,
-	0.008134419098,-0.007795486599, 0.006684985943,-0.004952456802, 0.002801700495,
-	-0.0004682633735,-0.001805154723, 0.003792902222,-0.005307868123, 0.006218277384,
-	-0.006458369084, 0.006032150239,-0.005010120105, 0.003519591643,-0.001729776035,
-	-0.0001667251199,  0.00197400921,-0.003512558527, 0.004636576865,-0.005247357301,
-	0.005301458761,  -0.0048131207, 0.003850799752, -0.00252846838,0.0009925779887,
-	0.000593724777,-0.002067579422, 0.003282798221,-0.004124083556, 0.004517662805,
-	-0.004437445663, 0.003906176891,-0.002991672605, 0.001798584242,-0.0004567484139,
-	-0.0008927140734,   0.0021120077,-0.003080519382, 0.003706550924, -0.00393581856,
-	0.003755912185,-0.003196395701, 0.002324685687,-0.001238168217, 5.35385625e-05,
-	0.001105607953,-0.002121479949, 0.002893940778,-0.003350237384, 0.003451714525,
-	-0.003196877195, 0.002620630665,-0.001789828297,0.0007956839981,0.0002561286674,
-	-0.001256574295, 0.002104470739,-0.002716609975, 0.003035821486,-0.003036204027,
-	0.002725061728,-0.002141371602, 0.001351102837,-0.0004398741294,-0.0004962424864,
-	0.001360753318,-0.002066634595, 0.002544984221,-0.002751696389, 0.002671430353,
-	-0.002318555722, 0.001735051046,-0.0009856338147,0.0001506597764,0.0006824351149,
-	-0.001428225776, 0.002011986682,-0.002377132419, 0.002490640618,-0.002345944988,
-	0.001963096438,-0.001386155374,0.0006782031269,  8.5492582e-05,-0.0008254147251,
-	0.001466065412,-0.001943577896, 0.002212086227,-0.002248022705, 0.002052166266,
-	-0.001649050973, 0.001084021991,-0.0004181760596,-0.0002781763615,0.0009329235763,
-	-0.001479564235, 0.001863936312,-0.002049524104, 0.002020919463,-0.001784980414,
-	0.001369738951,-0.0008211284876,0.0001979551162,0.0004343896871,-0.001010721666,
-	0.001472792588,-0.001775135053, 0.001889490057, -0.00180742552, 0.001540829195,
-	-0.001120361267,0.0005919480463,-1.180868094e-05,-0.0005594883696,  0.00106333592,
-	-0.001449075295, 0.001679064473,-0.001732308883, 0.001606352278,-0.001317208516,
-	0.000897394435,-0.0003923042386,-0.0001446468668,0.0006576816086, -0.00109441008,
-	0.001411171164,-0.001577376504, 0.001578441821,-0.001416980987, 0.001112318016,
-	-0.0006981586339,0.0002189497027,0.0002749339619,-0.0007324120379, 0.001106995507,
-	-0.001361479517, 0.001471636002,-0.001428464777, 0.001238899538,-0.000924824446,
-	0.0005205941852,-6.926443893e-05,-0.000381935708, 0.000786554534,-0.001103683026,
-	0.001302077551,-0.001363199553, 0.001282955287,-0.001071850769,0.0007536962512,
-	-0.0003629699349,-5.895564755e-05,0.0004681301361,-0.0008226338541, 0.001086813747,
-	-0.00123488612, 0.001253431779,-0.001142575056, 0.000915758952,-0.0005981617142,
-	0.0002239200549,0.0001675396779,-0.0005356352776,0.0008428111323,-0.001058373018,
-	0.001161553897, -0.00114346738, 0.001007855637,-0.0007705188473,0.0004574765626,
-	-0.0001021451899,-0.0002582026355,0.0005863929982,-0.0008490969776, 0.001020270982,
-	-0.001083676354, 0.001034451183,-0.0008794044843,0.0006361354608,-0.0003310590691,
-	-3.438896556e-06,0.0003324451973,-0.000622150721,0.0008433088078,-0.0009741738904,
-	0.001002653269,-0.0009273881442,0.0007577111246,-0.0005125523312,0.0002183360775,
-	9.387843602e-05,-0.000391645357,0.0006444907631,-0.0008270724793,0.0009216193575,
-	-0.0009197558393,0.0008231331012,-0.0006431716029,0.0003996753949,-0.0001187046073,
-	-0.0001702126901,0.0004371694522,-0.0006549964892,0.0008019953966,-0.0008640977903,
-	0.0008361954242,-0.0007225511945,0.0005361776566,-0.0002973856463,3.159324115e-05,
-	0.0002333839511,-0.0004702675506,0.0006550593534,-0.0007695105742,0.0008029141463,
-	-0.0007530422299,0.0006263351534,-0.0004370135721,0.0002055549267,4.354698103e-05,
-	-0.0002843423863,0.0004921297659,-0.0006460054428,0.0007309422363,-0.0007392400294,
-	0.0006712080212,-0.0005350369029,0.0003458130814,-0.000123853737,-0.0001074610409,
-	0.0003241250233,-0.0005040463875,0.0006292533362,-0.0006876702537,  0.00067430333,
-	-0.0005916583468, 0.000449290761,-0.0002628422517,5.217677608e-05,0.0001605910657,
-	-0.0003535092983,0.0005069839535,-0.0006058165454,0.0006406701286,-0.0006089466624,
-	0.0005149366334,-0.0003693104954,0.0001878915355,1.005834383e-05,-0.0002038920356,
-	0.000373679999,-0.0005022925907,0.0005771243596,-0.0005913032801,0.0005442960537,
-	-0.000441938726,0.0002956574317,-0.0001211985946,-6.297440996e-05,0.0002377640049,
-	-0.0003852677473,0.0004907235852,-0.0005439188099,0.0005402041716,-0.0004808626545,
-	0.0003728869488,-0.0002281862835,6.227403355e-05,0.0001074089669,-0.0002633246768,
-	0.0003896152775,-0.0004737198178,0.0005076462403,-0.0004887208925,0.0004197285452,
-	-0.0003085848293,0.0001674506348,-1.134195736e-05, -0.00014342551,0.0002808642457,
-	-0.000387135573,0.0004517410125,-0.0004687355831,0.0004371309478,-0.0003609815903,
-	0.0002488541359,-0.0001128959266,-3.247892528e-05,0.0001721283916,-0.000291759643,
-	0.0003793651413,-0.0004264239687,0.0004287533811,-0.0003868748026,0.0003058388247,
-	-0.0001946245175,6.521215255e-05,6.873356324e-05,-0.0001933547901,0.0002959521371,
-	-0.0003662715026,0.0003976819862,-0.0003875278635,0.0003376055392,-0.0002536884567,
-	0.0001450175914,-2.321252759e-05,-9.89300388e-05,0.0002088188921,-0.0002953409276,
-	0.0003499824088,-0.0003676355118,0.0003471119562,-0.0002911908086,0.0002062525018,
-	-0.0001015257149,-1.184833491e-05, 0.000121997793,-0.0002176165435,0.0002891415788,
-	-0.0003295792849,0.0003352914064,-0.0003063611803,0.0002462783887,-0.0001618554961,
-	6.218143244e-05,4.217390961e-05,-0.000140375807,0.0002224217023,-0.0002801401715,
-	0.0003080099414,-0.0003036663402,0.0002681349579,-0.0002056508965,0.0001231559872,
-	-2.949155532e-05,-6.549066893e-05,0.0001519564539,-0.0002211206884,0.0002662086918,
-	-0.0002830046287,0.0002702314814,-0.0002297574538, 0.000166332582,-8.678678569e-05,
-	-2.377047963e-07,8.573888044e-05,-0.0001608812163,0.0002181500604,-0.0002519551199,
-	0.0002592482197,-0.0002397598437,0.0001960181544,-0.0001329939259,5.755291204e-05,
-	2.232182123e-05,-9.830878116e-05,0.0001626210433,-0.0002088103356, 0.000232488077,
-	-0.00023166553,0.0002068608592,-0.0001610436011,9.942644829e-05,-2.865401984e-05,
-	-4.394182906e-05,0.0001106548589,-0.0001648874022,0.0002011870674,-0.000216199187,
-	0.0002087885805,-0.0001801764156, 0.000133751455,-7.464734517e-05,9.197938198e-06,
-	5.574016541e-05,-0.0001134653503,0.0001581412071,-0.0001854003349, 0.000192810985,
-	-0.0001800225873,0.0001487201371,-0.0001024301309,4.627169983e-05,1.368653011e-05,
-	-7.128098514e-05,0.0001207193563,-0.0001567985164,0.0001764163317,-0.0001776802674,
-	0.0001609715691,-0.0001283441379,8.350233838e-05,-3.131436824e-05,-2.267356831e-05,
-	7.283356535e-05,-0.0001140417589,0.0001422299392,-0.0001547809952,0.0001507571869,
-	-0.0001309082727,9.755078645e-05,-5.434858031e-05,5.995632819e-06,4.233744039e-05,
-	-8.572445222e-05,0.0001199889739,-0.0001417177118,0.0001486614638,-0.0001410241821,
-	0.0001194115976,-8.668901137e-05,4.638527389e-05,-2.880652346e-06,-3.926652789e-05,
-	7.574096526e-05,-0.0001029218693,0.0001182139749,-0.0001202874919,0.0001091674858,
-	-8.623189933e-05,5.406264245e-05,-1.619217255e-05,-2.330796451e-05,6.033194586e-05,
-	-9.125900397e-05,0.0001132442339,-0.0001242410799,0.0001230574126,-0.0001101166708,
-	8.801853983e-05,-5.792516458e-05,2.412846516e-05,1.019841966e-05,-4.137782889e-05,
-	6.626686081e-05,-8.244246419e-05,8.842934039e-05,-8.385092224e-05, 6.94072296e-05,
-	-4.678868208e-05, 1.84374785e-05,1.271194014e-05,-4.357191574e-05,7.116607594e-05,
-	-9.2900249e-05,0.0001067109624,-0.0001112559985,0.0001061174116,-9.222379595e-05,
-	7.212701166e-05,-4.906433242e-05,2.079471778e-05,4.549409368e-06,-2.732757457e-05,
-	4.460686978e-05,-5.494089783e-05,5.748773765e-05,-5.21778129e-05,   3.962552e-05,
-	-2.105376734e-05,-1.918812586e-06,2.744346602e-05,-5.369988867e-05,  7.9059173e-05,
-	-0.0001022875949,0.0001226232562,-0.0001398598251,0.0001542872924,-0.0001666486351,
-	0.0001779660815,-0.0001894109882,0.0002020814281, 0.001360524911
-};
+	m_keep = 2 * k - 1;
+	m_evenI.assign(m_keep + maxCount / 2 + 1, 0);
+	m_evenQ.assign(m_keep + maxCount / 2 + 1, 0);
+	m_oddI.assign(m_keep + maxCount / 2 + 1, 0);
+	m_oddQ.assign(m_keep + maxCount / 2 + 1, 0);
+	m_havePending = false;
+	m_backend = backend;
+}
 
-static const float H95[1024] = {
-	-0.001086232602, -0.00074045785, 0.000528931967,-0.0003769073228, 0.000267298281,
-	-0.0001877703035,0.0001294929389,-8.61084045e-05,5.312864596e-05,-2.735108319e-05,
-	6.584723906e-06,1.069936025e-05,-2.546929863e-05,3.836183896e-05,-4.970101145e-05,
-	5.966093158e-05,-6.824209413e-05,7.540055958e-05,-8.10006386e-05,8.492192137e-05,
-	-8.700964827e-05,8.716346201e-05,-8.52792873e-05,8.133878146e-05,-7.528188871e-05,
-	6.741758989e-05,-5.708393292e-05, 4.64308032e-05,-3.200243009e-05,1.903562952e-05,
-	-3.715004823e-06,-1.248145418e-05,2.750240128e-05,-4.231378989e-05,5.720288755e-05,
-	-7.074342284e-05,8.204941696e-05,-9.135973232e-05, 9.88874599e-05,-0.0001040931311,
-	0.0001062805459,-0.0001052415319,0.0001012744251,-9.467695781e-05,8.549659833e-05,
-	-7.36455695e-05,5.922991477e-05,-4.265477037e-05,2.453811976e-05,-5.478125786e-06,
-	-1.405553667e-05,3.362774441e-05, -5.2939733e-05,7.115622429e-05,-8.82428285e-05,
-	0.0001026468308,-0.0001149883465,0.0001238839031,-0.0001295152033,0.0001319998992,
-	-0.0001306557679,0.0001256345131,-0.0001172224729,0.0001051810541,-8.965088637e-05,
-	7.129779988e-05,-5.063739445e-05,2.800650145e-05,-4.033255209e-06,-2.044416578e-05,
-	4.475625974e-05,-6.841639697e-05,9.082239558e-05,-0.0001112057871,0.0001288492058,
-	-0.0001432433492,0.0001539796503,-0.0001606258884,0.0001628360333,-0.000160339725,
-	0.0001533521572,-0.0001417849853,0.0001262886217,-0.0001066869081,8.379737119e-05,
-	-5.802026135e-05,2.996472358e-05,-6.506025443e-07,-2.936184683e-05,5.931554188e-05,
-	-8.819535287e-05,0.0001152178011,-0.0001396266744,0.0001605003345,-0.000177189635,
-	0.0001892849978,-0.0001963578834,0.0001979870285,-0.0001940576331,0.0001846180967,
-	-0.0001698052511,0.0001498650381,-0.0001253360097,9.685326222e-05,-6.512181426e-05,
-	3.082359035e-05,5.046935257e-06,-4.158195952e-05, 7.75429653e-05,-0.0001121824826,
-	0.000144237536,-0.0001729493233,   0.0001973045,-0.0002165286423,0.0002301375062,
-	-0.0002375220938,0.0002383086103,-0.0002324267698,0.0002198200382,-0.000200784285,
-	0.0001758196886,-0.0001454599696,0.0001103798495,-7.156576612e-05,3.002792801e-05,
-	1.316090857e-05,-5.681808761e-05, 9.96826202e-05,-0.0001405841467,0.0001783354237,
-	-0.000211759485,0.0002398195065,-0.000261670968,0.0002766666876,-0.0002841483511,
-	0.0002838372602,-0.000275471044, 0.000259286724,-0.0002354627213, 0.000204560085,
-	-0.0001673868537, 0.000124797356,-7.796750288e-05,2.807253259e-05,  2.3563176e-05,
-	-7.542662206e-05,0.0001260767167,-0.000174144021,0.0002181930759,-0.0002569249773,
-	0.0002891652985,-0.0003138470638, 0.000330127863,-0.0003374575463, 0.000335448829,
-	-0.0003239649814,0.0003031891829,-0.0002735940216,0.0002358026395,-0.0001907348778,
-	0.0001394897845,-8.347559196e-05,2.407670218e-05,3.697939246e-05,-9.809475887e-05,
-	0.000157493123,-0.0002135446848,  0.00026462393,-0.0003091160906,0.0003457110433,
-	-0.000373251969, 0.000390796311,-0.0003977121669,0.0003935893474,-0.0003783578286,
-	0.0003523059422,-0.0003159408516,0.0002700796467,-0.0002158816642,0.0001547177671,
-	-8.815029287e-05,1.797856021e-05,5.387776764e-05,-0.0001254317904,0.0001946678385,
-	-0.0002595879487,0.0003183662193,-0.0003692162863,0.0004105969565,-0.0004411068803,
-	0.0004598202941,-0.0004659475817,0.0004591503821,-0.0004393786949,0.0004069777497,
-	-0.0003626722319, 0.000307460461,-0.0002427221043,0.0001701432629,-9.157472959e-05,
-	9.148371646e-06,7.488061237e-05,-0.0001581937249,0.0002384417312, -0.00031332855,
-	0.0003806837194,-0.0004384525819,0.0004848737444,-0.000518504472,0.0005381996743,
-	-0.0005431483733,0.0005329843843,-0.0005077499081,0.0004678835685,-0.0004142928228,
-	0.0003482378961,-0.0002713984868,0.0001857089519,-9.347480955e-05,-2.865507668e-06,
-	0.0001006939201,-0.000197259229,0.0002898605308,-0.0003758205276,0.0004526633711,
-	-0.0005180810113,0.0005700244801,-0.0006068485673,0.0006273044273,-0.0006305327406,
-	0.000616196543,-0.0005844042171,0.0005357645568,-0.0004713716044,0.0003927911748,
-	-0.0003019841097,0.0002013230842,-9.343949205e-05,-1.877133764e-05,0.0001322394382,
-	-0.0002437756193,0.0003502838663,-0.0004486681137,0.0005360688083,-0.0006098229787,
-	0.000667709508,-0.0007078371127,0.0007288196939,-0.000729777792,0.0007103417884,
-	-0.0006707452121,0.0006117887679,-0.0005348090199,0.0004416904121,-0.0003347550228,
-	0.000216798333,-9.095495625e-05,-3.940466195e-05,0.0001706989569,-0.0002992502705,
-	0.0004214373475,-0.0005337597686,0.0006329215248,-0.0007159553934,0.0007802721811,
-	-0.0008237873553,0.0008449635934,-0.0008428781293,0.0008171989466,-0.0007683166186,
-	0.0006972012343,-0.0006055074045,0.0004954580218,-0.0003698739747,0.0002320054919,
-	-8.54906757e-05,-6.568563549e-05, 0.000217374778,-0.0003653481835,0.0005054072244,
-	-0.0006335426588,0.0007459734334,-0.0008393277531,0.0009106965153,-0.0009577423334,
-	0.0009787788149,-0.0009728132864,0.0009395648376,-0.0008795563481,0.0007940607029,
-	-0.0006850552745,0.0005552121438,-0.0004078331694,0.0002467626473,-7.627782179e-05,
-	-9.899458382e-05,0.0002742564247,-0.0004445882514,0.0006051746313,-0.000751386513,
-	0.0008789206622,-0.0009839185514, 0.001063078642,-0.001113815233, 0.001134235412,
-	-0.001123306807, 0.001080849557,-0.001007544226,0.0009049415239,-0.0007754442049,
-	0.0006222399534,-0.0004492471053,0.0002609586809,-6.238823698e-05,-0.0001410878176,
-	0.0003438648127,-0.0005402769311,0.0007247221074,-0.000891891541,  0.00103683176,
-	-0.001155147795, 0.001243094564,-0.001297770184, 0.001317082089,-0.001299947617,
-	0.001246222993,-0.001156839076, 0.001033702283,-0.0008797055925,0.0006986343069,
-	-0.0004950997536,0.0002744286903,-4.249208723e-05,-0.0001944405521,0.0004298202111,
-	-0.0006570729893, 0.000869726704,-0.001061609597,  0.00122702017,-0.001360907336,
-	0.001459014718,-0.001518020057, 0.001535615767,-0.001510630362, 0.001443051384,
-	-0.001334034023, 0.001185918692,-0.001002177247,0.0007873387658,-0.0005468593445,
-	0.0002870299504,-1.473489738e-05,-0.0002626366622,0.0005374419852,-0.0008019636734,
-	0.001048656064,-0.001270342385, 0.001460402505,-0.001612987369,  0.00172318297,
-	-0.001787178568, 0.001802391605,-0.001767517999, 0.001682646573,-0.001549267676,
-	0.001370230922,-0.001149706659,0.0008931002812,-0.0006069138763,0.0002985940082,
-	2.367521847e-05,-0.0003511626273,0.0006748346495,-0.000985608669, 0.001274591661,
-	-0.001533320523, 0.001754018595,-0.001929839724, 0.002055029385,-0.002125152852,
-	0.002137213713,-0.002089770278, 0.001983014168,-0.001818777644, 0.001600536867,
-	-0.001333312015, 0.001023606863,-0.0006792157074,0.0003090474347,7.710310456e-05,
-	-0.0004687939363,0.0008552291547,-0.001225511776, 0.001569026615,-0.001875662012,
-	0.002136134543,-0.002342224354, 0.002487083199,-0.002565393457, 0.002573594218,
-	-0.002509961603, 0.002374766162,-0.002170237247, 0.001900597126,-0.001571924426,
-	0.001192114782,-0.0007705964381,0.0003181978827,0.0001531835005,-0.0006308389129,
-	0.001101631438,-0.001552294591, 0.001969837816,-0.002341868589,  0.00265699462,
-	-0.002905099653, 0.003077724949,-0.003168259282, 0.003172225319,-0.003087416058,
-	0.002914032433,-0.002654717537, 0.002314561512,-0.001900989213, 0.001423653215,
-	-0.0008942035493,0.0003260179947,0.0002661309845,-0.0008664122433, 0.001458354993,
-	-0.002025284804, 0.002550785197,-0.003019138705, 0.003415754298,-0.003727613715,
-	0.003943681251,-0.004055221099, 0.004056133796,-0.003943168093, 0.003716107924,
-	-0.003377838293, 0.002934383461,-0.002394827316, 0.001771148061,-0.001077995403,
-	0.000332370837,0.0004467687104,-0.001238933648, 0.002022635657,-0.002775900299,
-	0.003476854879,-0.004104298074, 0.004638311453, -0.00506080268, 0.005356081296,
-	-0.005511320196, 0.005517011508,-0.005367309786, 0.005060358439,-0.004598431755,
-	0.003988057375,-0.003239977174, 0.002369054826,-0.001394041697, 0.000337213045,
-	0.0007760422886,-0.001917746151, 0.003057936206,-0.004165369086, 0.005208239425,
-	-0.006154942326, 0.006974883378,-0.007639272604, 0.008121901192,-0.008399923332,
-	0.008454526775,-0.008271588944,  0.00784220174,-0.007163147908, 0.006237216294,
-	-0.005073465873, 0.003687268356,-0.002100327285,0.0003404638555, 0.001558612334,
-	-0.003557779128, 0.005612932611,-0.007675680332, 0.009693942033, -0.01161273848,
-	0.01337488834, -0.01492179092,  0.01619406603, -0.01713214815,  0.01767663471,
-	-0.01776846685,  0.01734863594, -0.01635740139,  0.01473257039, -0.01240668353,
-	0.009302114137, -0.00532306917,0.0003421096771, 0.005823009182, -0.01345132384,
-	0.02299928106, -0.03526927531,  0.05180224776, -0.07594259828,   0.1164570153,
-	-0.2056256831,   0.6344159842,   0.6344159842,  -0.2056256831,   0.1164570153,
-	-0.07594259828,  0.05180224776, -0.03526927531,  0.02299928106, -0.01345132384,
-	0.005823009182,0.0003421096771, -0.00532306917, 0.009302114137, -0.01240668353,
-	0.01473257039, -0.01635740139,  0.01734863594, -0.01776846685,  0.01767663471,
-	-0.01713214815,  0.01619406603, -0.01492179092,  0.01337488834, -0.01161273848,
-	0.009693942033,-0.007675680332, 0.005612932611,-0.003557779128, 0.001558612334,
-	0.0003404638555,-0.002100327285, 0.003687268356,-0.005073465873, 0.006237216294,
-	-0.007163147908,  0.00784220174,-0.008271588944, 0.008454526775,-0.008399923332,
-	0.008121901192,-0.007639272604, 0.006974883378,-0.006154942326, 0.005208239425,
-	-0.004165369086, 0.003057936206,-0.001917746151,0.0007760422886, 0.000337213045,
-	-0.001394041697, 0.002369054826,-0.003239977174, 0.003988057375,-0.004598431755,
-	0.005060358439,-0.005367309786, 0.005517011508,-0.005511320196, 0.005356081296,
-	-0.00506080268, 0.004638311453,-0.004104298074, 0.003476854879,-0.002775900299,
-	0.002022635657,-0.001238933648,0.0004467687104, 0.000332370837,-0.001077995403,
-	0.001771148061,-0.002394827316, 0.002934383461,-0.003377838293, 0.003716107924,
-	-0.003943168093, 0.004056133796,-0.004055221099, 0.003943681251,-0.003727613715,
-	0.003415754298,-0.003019138705, 0.002550785197,-0.002025284804, 0.001458354993,
-	-0.0008664122433,0.0002661309845,0.0003260179947,-0.0008942035493, 0.001423653215,
-	-0.001900989213, 0.002314561512,-0.002654717537, 0.002914032433,-0.003087416058,
-	0.003172225319,-0.003168259282, 0.003077724949,-0.002905099653,  0.00265699462,
-	-0.002341868589, 0.001969837816,-0.001552294591, 0.001101631438,-0.0006308389129,
-	0.0001531835005,0.0003181978827,-0.0007705964381, 0.001192114782,-0.001571924426,
-	0.001900597126,-0.002170237247, 0.002374766162,-0.002509961603, 0.002573594218,
-	-0.002565393457, 0.002487083199,-0.002342224354, 0.002136134543,-0.001875662012,
-	0.001569026615,-0.001225511776,0.0008552291547,-0.0004687939363,7.710310456e-05,
-	0.0003090474347,-0.0006792157074, 0.001023606863,-0.001333312015, 0.001600536867,
-	-0.001818777644, 0.001983014168,-0.002089770278, 0.002137213713,-0.002125152852,
-	0.002055029385,-0.001929839724, 0.001754018595,-0.001533320523, 0.001274591661,
-	-0.000985608669,0.0006748346495,-0.0003511626273,2.367521847e-05,0.0002985940082,
-	-0.0006069138763,0.0008931002812,-0.001149706659, 0.001370230922,-0.001549267676,
-	0.001682646573,-0.001767517999, 0.001802391605,-0.001787178568,  0.00172318297,
-	-0.001612987369, 0.001460402505,-0.001270342385, 0.001048656064,-0.0008019636734,
-	0.0005374419852,-0.0002626366622,-1.473489738e-05,0.0002870299504,-0.0005468593445,
-	0.0007873387658,-0.001002177247, 0.001185918692,-0.001334034023, 0.001443051384,
-	-0.001510630362, 0.001535615767,-0.001518020057, 0.001459014718,-0.001360907336,
-	0.00122702017,-0.001061609597, 0.000869726704,-0.0006570729893,0.0004298202111,
-	-0.0001944405521,-4.249208723e-05,0.0002744286903,-0.0004950997536,0.0006986343069,
-	-0.0008797055925, 0.001033702283,-0.001156839076, 0.001246222993,-0.001299947617,
-	0.001317082089,-0.001297770184, 0.001243094564,-0.001155147795,  0.00103683176,
-	-0.000891891541,0.0007247221074,-0.0005402769311,0.0003438648127,-0.0001410878176,
-	-6.238823698e-05,0.0002609586809,-0.0004492471053,0.0006222399534,-0.0007754442049,
-	0.0009049415239,-0.001007544226, 0.001080849557,-0.001123306807, 0.001134235412,
-	-0.001113815233, 0.001063078642,-0.0009839185514,0.0008789206622,-0.000751386513,
-	0.0006051746313,-0.0004445882514,0.0002742564247,-9.899458382e-05,-7.627782179e-05,
-	0.0002467626473,-0.0004078331694,0.0005552121438,-0.0006850552745,0.0007940607029,
-	-0.0008795563481,0.0009395648376,-0.0009728132864,0.0009787788149,-0.0009577423334,
-	0.0009106965153,-0.0008393277531,0.0007459734334,-0.0006335426588,0.0005054072244,
-	-0.0003653481835, 0.000217374778,-6.568563549e-05,-8.54906757e-05,0.0002320054919,
-	-0.0003698739747,0.0004954580218,-0.0006055074045,0.0006972012343,-0.0007683166186,
-	0.0008171989466,-0.0008428781293,0.0008449635934,-0.0008237873553,0.0007802721811,
-	-0.0007159553934,0.0006329215248,-0.0005337597686,0.0004214373475,-0.0002992502705,
-	0.0001706989569,-3.940466195e-05,-9.095495625e-05, 0.000216798333,-0.0003347550228,
-	0.0004416904121,-0.0005348090199,0.0006117887679,-0.0006707452121,0.0007103417884,
-	-0.000729777792,0.0007288196939,-0.0007078371127, 0.000667709508,-0.0006098229787,
-	0.0005360688083,-0.0004486681137,0.0003502838663,-0.0002437756193,0.0001322394382,
-	-1.877133764e-05,-9.343949205e-05,0.0002013230842,-0.0003019841097,0.0003927911748,
-	-0.0004713716044,0.0005357645568,-0.0005844042171, 0.000616196543,-0.0006305327406,
-	0.0006273044273,-0.0006068485673,0.0005700244801,-0.0005180810113,0.0004526633711,
-	-0.0003758205276,0.0002898605308,-0.000197259229,0.0001006939201,-2.865507668e-06,
-	-9.347480955e-05,0.0001857089519,-0.0002713984868,0.0003482378961,-0.0004142928228,
-	0.0004678835685,-0.0005077499081,0.0005329843843,-0.0005431483733,0.0005381996743,
-	-0.000518504472,0.0004848737444,-0.0004384525819,0.0003806837194, -0.00031332855,
-	0.0002384417312,-0.0001581937249,7.488061237e-05,9.148371646e-06,-9.157472959e-05,
-	0.0001701432629,-0.0002427221043, 0.000307460461,-0.0003626722319,0.0004069777497,
-	-0.0004393786949,0.0004591503821,-0.0004659475817,0.0004598202941,-0.0004411068803,
-	0.0004105969565,-0.0003692162863,0.0003183662193,-0.0002595879487,0.0001946678385,
-	-0.0001254317904,5.387776764e-05,1.797856021e-05,-8.815029287e-05,0.0001547177671,
-	-0.0002158816642,0.0002700796467,-0.0003159408516,0.0003523059422,-0.0003783578286,
-	0.0003935893474,-0.0003977121669, 0.000390796311,-0.000373251969,0.0003457110433,
-	-0.0003091160906,  0.00026462393,-0.0002135446848, 0.000157493123,-9.809475887e-05,
-	3.697939246e-05,2.407670218e-05,-8.347559196e-05,0.0001394897845,-0.0001907348778,
-	0.0002358026395,-0.0002735940216,0.0003031891829,-0.0003239649814, 0.000335448829,
-	-0.0003374575463, 0.000330127863,-0.0003138470638,0.0002891652985,-0.0002569249773,
-	0.0002181930759,-0.000174144021,0.0001260767167,-7.542662206e-05,  2.3563176e-05,
-	2.807253259e-05,-7.796750288e-05, 0.000124797356,-0.0001673868537, 0.000204560085,
-	-0.0002354627213, 0.000259286724,-0.000275471044,0.0002838372602,-0.0002841483511,
-	0.0002766666876,-0.000261670968,0.0002398195065,-0.000211759485,0.0001783354237,
-	-0.0001405841467, 9.96826202e-05,-5.681808761e-05,1.316090857e-05,3.002792801e-05,
-	-7.156576612e-05,0.0001103798495,-0.0001454599696,0.0001758196886,-0.000200784285,
-	0.0002198200382,-0.0002324267698,0.0002383086103,-0.0002375220938,0.0002301375062,
-	-0.0002165286423,   0.0001973045,-0.0001729493233, 0.000144237536,-0.0001121824826,
-	7.75429653e-05,-4.158195952e-05,5.046935257e-06,3.082359035e-05,-6.512181426e-05,
-	9.685326222e-05,-0.0001253360097,0.0001498650381,-0.0001698052511,0.0001846180967,
-	-0.0001940576331,0.0001979870285,-0.0001963578834,0.0001892849978,-0.000177189635,
-	0.0001605003345,-0.0001396266744,0.0001152178011,-8.819535287e-05,5.931554188e-05,
-	-2.936184683e-05,-6.506025443e-07,2.996472358e-05,-5.802026135e-05,8.379737119e-05,
-	-0.0001066869081,0.0001262886217,-0.0001417849853,0.0001533521572,-0.000160339725,
-	0.0001628360333,-0.0001606258884,0.0001539796503,-0.0001432433492,0.0001288492058,
-	-0.0001112057871,9.082239558e-05,-6.841639697e-05,4.475625974e-05,-2.044416578e-05,
-	-4.033255209e-06,2.800650145e-05,-5.063739445e-05,7.129779988e-05,-8.965088637e-05,
-	0.0001051810541,-0.0001172224729,0.0001256345131,-0.0001306557679,0.0001319998992,
-	-0.0001295152033,0.0001238839031,-0.0001149883465,0.0001026468308,-8.82428285e-05,
-	7.115622429e-05, -5.2939733e-05,3.362774441e-05,-1.405553667e-05,-5.478125786e-06,
-	2.453811976e-05,-4.265477037e-05,5.922991477e-05,-7.36455695e-05,8.549659833e-05,
-	-9.467695781e-05,0.0001012744251,-0.0001052415319,0.0001062805459,-0.0001040931311,
-	9.88874599e-05,-9.135973232e-05,8.204941696e-05,-7.074342284e-05,5.720288755e-05,
-	-4.231378989e-05,2.750240128e-05,-1.248145418e-05,-3.715004823e-06,1.903562952e-05,
-	-3.200243009e-05, 4.64308032e-05,-5.708393292e-05,6.741758989e-05,-7.528188871e-05,
-	8.133878146e-05,-8.52792873e-05,8.716346201e-05,-8.700964827e-05,8.492192137e-05,
-	-8.10006386e-05,7.540055958e-05,-6.824209413e-05,5.966093158e-05,-4.970101145e-05,
-	3.836183896e-05,-2.546929863e-05,1.069936025e-05,6.584723906e-06,-2.735108319e-05,
-	5.312864596e-05,-8.61084045e-05,0.0001294929389,-0.0001877703035, 0.000267298281,
-	-0.0003769073228, 0.000528931967, -0.00074045785,-0.001086232602
-};
+// split 2 * Lanes samples per step into even and odd ones, returns the pairs split
+template<class V>
+static SIMD_INLINE int splitBlock(const float* in, int count, float* even, float* odd)
+{
+	int pairs = 0;
+	for(; 2 * (pairs + V::Lanes) <= count; pairs += V::Lanes) {
+		typename V::Float evens;
+		typename V::Float odds;
+		V::deinterleave(V::load(in + 2 * pairs), V::load(in + 2 * pairs + V::Lanes), &evens, &odds);
+		V::store(even + pairs, evens);
+		V::store(odd + pairs, odds);
+	}
+	return pairs;
+}
 
-static const float H99[1024] = {
-	0.001675398787,1.244919167e-05,-1.265082301e-05,1.300565418e-05,-1.352463551e-05,
-	1.419634464e-05,-1.502947089e-05,1.600952965e-05,-1.714171958e-05,1.841177254e-05,
-	-1.982545655e-05,2.136947114e-05,-2.304847294e-05,2.484868128e-05,-2.677652628e-05,
-	2.881977343e-05,-3.09836214e-05, 3.32506861e-05,-3.562416532e-05,3.808822294e-05,
-	-4.240580165e-05,4.274157618e-05,-4.553170947e-05,4.837318556e-05,-5.126984615e-05,
-	5.420807065e-05,-5.719270121e-05, 6.02079308e-05,-6.325255526e-05,6.631013093e-05,
-	-6.938075239e-05, 7.24503625e-05,-7.551804447e-05,7.856899902e-05,-8.160285506e-05,
-	8.460623212e-05,-8.757905016e-05,9.050505469e-05,-9.338054952e-05,9.618798504e-05,
-	-9.852655057e-05,0.0001018315452,-0.0001043349039,0.0001067502599,-0.000109073284,
-	0.0001112881364,-0.0001133894912,0.0001153610065,-0.0001171952754,0.0001188778042,
-	-0.0001204026557,0.0001217582249,-0.0001229386689,0.0001239336852,-0.0001247400069,
-	0.0001253501832,-0.0001257604599,0.0001259599812,-0.0001259443961,0.0001257057011,
-	-0.0001253986266,0.0001243988227,-0.000123527876,0.0001223958971,-0.0001210046685,
-	0.0001193550634,-0.0001174495192,0.0001152866025,-0.0001128628428,0.0001101773014,
-	-0.000107228756,0.0001040198113,-0.0001005490412,9.681947995e-05,-9.283127292e-05,
-	8.859050286e-05,-8.409898874e-05,7.936103793e-05,-7.437571912e-05,6.914768164e-05,
-	-6.360508996e-05,5.808253263e-05,-5.210601739e-05,4.593118865e-05,-3.955672219e-05,
-	3.298968659e-05,-2.623116234e-05,1.929072278e-05,-1.216943474e-05,4.879918833e-06,
-	2.574045084e-06,-1.01757978e-05,1.792035073e-05,-2.578920066e-05,3.377440589e-05,
-	-4.18547279e-05,5.002244143e-05,-5.825928019e-05,6.655752077e-05,-7.489666314e-05,
-	8.322500071e-05,-9.171511192e-05,0.0001000485936,-0.0001083849347,0.0001167061564,
-	-0.0001249815105,0.0001331956009,-0.000141323093, 0.000149355983,-0.0001572697802,
-	0.0001650549384,-0.0001726847549,0.0001801506733,-0.0001874269365,0.0001945040422,
-	-0.0002013543708,0.0002079675614,-0.0002143196762,0.0002204044285,-0.0002261989139,
-	0.0002317167236,-0.0002368100104,0.0002416853822,-0.0002461822296,0.0002503027208,
-	-0.0002540306305,0.0002573635429,-0.0002602827153,0.0002627865179,-0.0002648555965,
-	0.00026648739,-0.0002676609438,0.0002683743951,-0.0002686080406,0.0002683596103,
-	-0.0002676100703, 0.000266359566,-0.0002645945933,0.0002623172477,-0.0002595154219,
-	0.0002561763977,-0.000252372236,0.0002479519753,-0.0002430213499,0.0002375745535,
-	-0.0002315960883,0.0002250888938,-0.0002180481097,0.0002104866726,-0.0002024031273,
-	0.0001938105706,-0.0001847077365,0.0001751102973,-0.0001650201593,0.0001544533734,
-	-0.0001434120059,0.0001319127623,-0.0001199640246,0.0001075880718,-9.479581058e-05,
-	8.161525329e-05,-6.800150732e-05,5.409394362e-05,-3.981600821e-05,2.520510134e-05,
-	-1.028506449e-05,-4.915092177e-06,2.037503691e-05,-3.606475366e-05,5.196307393e-05,
-	-6.804041914e-05,8.427639114e-05,-0.0001006404491,0.0001171101612,-0.0001336551213,
-	0.0001502517698,-0.0001668679761,0.0001834754366,-0.0002000410022,0.0002165349433,
-	-0.0002329309791,0.0002491593477,-0.0002652762341,0.0002811705344,-0.0002968245535,
-	0.0003122160851,-0.0003273163456,0.0003420927969,-0.0003565092629,0.0003705328272,
-	-0.0003841303405,0.0003972716513,-0.0004099243088,0.0004220580158,-0.0004336431739,
-	0.0004446525709,-0.0004550589074,0.0004648313916,-0.0004739405122,0.0004823570198,
-	-0.0004900551867,0.0004970360314,-0.0005032079644,0.0005086101592,-0.000513207051,
-	0.0005169680808,-0.0005198743893,0.0005219044397,-0.0005230415263,0.0005232664407,
-	-0.00052256661,0.0005209276569,-0.0005183401518,0.0005147918127,-0.0005102771684,
-	0.0005047873128,-0.0004983198014,0.0004908660194,-0.0004824266944,0.0004729957436,
-	-0.0004625812289,0.0004511619336,-0.0004388011876,0.0004254416563,-0.000411113404,
-	0.0003958299931,-0.0003796103119,0.0003624612582,-0.0003443991591, 0.000325435627,
-	-0.000305593916,0.0002848923032,-0.0002633577969,0.0002410119341,-0.0002178871073,
-	0.0001940105576,-0.0001694187085, 0.000144137317,-0.0001182025153,9.164447692e-05,
-	-6.450683577e-05,3.683733667e-05,-8.639025509e-06,-2.000392669e-05,4.905962123e-05,
-	-7.849372196e-05,0.0001082541203,-0.0001382974879,0.0001685714669,-0.0001990316523,
-	0.0002296229213,-0.0002602963359,0.0002909950272,-0.0003216689511,0.0003522591142,
-	-0.000382713275,0.0004129711597,-0.0004429815745, 0.000472684158,-0.0005020283279,
-	0.0005309510161,-0.0005594087997,0.0005873060436,-0.0006146348896,0.0006413159426,
-	-0.0006672907621,0.0006924984045,-0.0007168901502,0.0007404108183,-0.0007630105247,
-	0.0007846321096,-0.000805224292,0.0008247321239,-0.0008431066526,0.0008602941525,
-	-0.0008762460784,0.0008909119642,-0.0009042511811,0.0009162198403,-0.0009267787682,
-	0.0009358827956,-0.0009434898384,0.0009495872655,-0.0009541081381,0.0009570348775,
-	-0.0009583430947,0.0009580006008,-0.0009559826576,0.0009522665059,-0.0009468347416,
-	0.000939669495,-0.000930755632,0.0009200809291,-0.0009076363058,0.0008934149519,
-	-0.0008774123853,0.0008596275584,-0.0008400639053,0.0008187279454,-0.0007956314366,
-	0.0007707855548,-0.000744209392,0.0007159006782,-0.0006859155837,0.0006542616757,
-	-0.0006209632847,0.0005860535894,-0.0005495700752,0.0005115550011,-0.0004720490251,
-	0.0004310976947,-0.000388745073,0.0003450436052,-0.000300043961,0.0002538039116,
-	-0.0002063783904,0.0001578318333,-0.0001082299277,5.764549496e-05,-6.147113709e-06,
-	-4.61919044e-05,9.929939552e-05,-0.0001530790469,0.0002074777731,-0.0002623936161,
-	0.0003177424951,-0.0003734381462,0.0004293952079,-0.000485517201,0.0005417126813,
-	-0.0005978828412,0.0006539367605,-0.0007097731577,0.0007652982022,-0.0008204086334,
-	0.0008750099805,-0.0009289979935, 0.000982274767,-0.001034732792, 0.001086270786,
-	-0.001136782812, 0.001186170382,-0.001234338968, 0.001281164819,-0.001326559111,
-	0.001370426849,-0.001412661979,  0.00145316706,-0.001491837436, 0.001528581604,
-	-0.001563300495, 0.001595907845,-0.001626307727, 0.001654417254,-0.001680145622,
-	0.001703415997,-0.001724141766, 0.001742246561,-0.001757647842,  0.00177027809,
-	-0.001780065242, 0.001786946901,-0.001790847979, 0.001791731687,-0.001789523521,
-	0.001784177497,-0.001775646349, 0.001763892709,-0.001748870476, 0.001730548451,
-	-0.001708891825,  0.00168388267,-0.001655496424, 0.001623724122,-0.001588551444,
-	0.001549980603,-0.001508008805, 0.001462645829,-0.001413896796,  0.00136177917,
-	-0.001306312159, 0.001247529523,-0.001185466303, 0.001120146248, -0.00105162512,
-	0.0009799567051,-0.0009051907109,0.0008273900603,-0.0007466165698,0.0006629467243,
-	-0.0005764554953,0.0004872324644,-0.000395363284,0.0003009481588,-0.0002040847467,
-	0.0001048851045,-3.457247885e-06,-0.0001000804914,0.0002056103549,-0.0003130009864,
-	0.0004221207346,-0.0005328319385,0.0006449971115,-0.0007584549021,0.0008730689879,
-	-0.0009886781918, 0.001105119009,-0.001222223975, 0.001339829294,-0.001457760809,
-	0.001575843664,-0.001693892176, 0.001811723225,-0.001929145423,  0.00204596878,
-	-0.002161994576, 0.002277025254,-0.002390859881, 0.002503298922,-0.002614138881,
-	0.002723171143,-0.002830180805, 0.002934955759,-0.003037294373, 0.003136968473,
-	-0.003233762458, 0.003327460494,-0.003417844186, 0.003504694439,-0.003587789834,
-	0.003666908713,-0.003741826164, 0.003812319832,-0.003878164105,    0.003939135,
-	-0.003995005973,  0.00404555304,-0.004090553615, 0.004129783716,-0.004163017962,
-	0.004190030508,-0.004210601095,  0.00422450155,-0.004231502302, 0.004231387749,
-	-0.004223929718, 0.004208895378,-0.004186059814, 0.004155195784,-0.004116076976,
-	0.004068469629,-0.004012137651, 0.003946842626,-0.003872344038, 0.003788395552,
-	-0.003694747109, 0.003591140499,-0.003477316583, 0.003353006672,-0.003217937192,
-	0.003071813611,-0.002914332552, 0.002745178295,-0.002564030001, 0.002370523522,
-	-0.002164293546, 0.001944943331,-0.001712052734, 0.001465164591,-0.001203790656,
-	0.0009273947799,-0.0006353971548,0.0003271588648,-1.982700496e-06,-0.0003409059136,
-	0.0007023601793,-0.001083333394, 0.001484882436,-0.001908200327, 0.002354623983,
-	-0.002825672273, 0.003323056735, -0.00384874735, 0.004404985346,-0.004994348623,
-	0.00561982207,-0.006284879986, 0.006993566174,-0.007750639226, 0.008561717346,
-	-0.009433500469,   0.0103740124, -0.01139295939,  0.01250217296, -0.01371623017,
-	0.01505327411, -0.01653618366,  0.01819418557, -0.02006522752,  0.02219945751,
-	-0.02466454171,  0.02755400166, -0.03100080974,  0.03520061448, -0.04045354202,
-	0.04724452645, -0.05641134083,  0.06953664869, -0.09001214802,   0.1266565621,
-	-0.2118059248,   0.6364861727,   0.6364861727,  -0.2118059248,   0.1266565621,
-	-0.09001214802,  0.06953664869, -0.05641134083,  0.04724452645, -0.04045354202,
-	0.03520061448, -0.03100080974,  0.02755400166, -0.02466454171,  0.02219945751,
-	-0.02006522752,  0.01819418557, -0.01653618366,  0.01505327411, -0.01371623017,
-	0.01250217296, -0.01139295939,   0.0103740124,-0.009433500469, 0.008561717346,
-	-0.007750639226, 0.006993566174,-0.006284879986,  0.00561982207,-0.004994348623,
-	0.004404985346, -0.00384874735, 0.003323056735,-0.002825672273, 0.002354623983,
-	-0.001908200327, 0.001484882436,-0.001083333394,0.0007023601793,-0.0003409059136,
-	-1.982700496e-06,0.0003271588648,-0.0006353971548,0.0009273947799,-0.001203790656,
-	0.001465164591,-0.001712052734, 0.001944943331,-0.002164293546, 0.002370523522,
-	-0.002564030001, 0.002745178295,-0.002914332552, 0.003071813611,-0.003217937192,
-	0.003353006672,-0.003477316583, 0.003591140499,-0.003694747109, 0.003788395552,
-	-0.003872344038, 0.003946842626,-0.004012137651, 0.004068469629,-0.004116076976,
-	0.004155195784,-0.004186059814, 0.004208895378,-0.004223929718, 0.004231387749,
-	-0.004231502302,  0.00422450155,-0.004210601095, 0.004190030508,-0.004163017962,
-	0.004129783716,-0.004090553615,  0.00404555304,-0.003995005973,    0.003939135,
-	-0.003878164105, 0.003812319832,-0.003741826164, 0.003666908713,-0.003587789834,
-	0.003504694439,-0.003417844186, 0.003327460494,-0.003233762458, 0.003136968473,
-	-0.003037294373, 0.002934955759,-0.002830180805, 0.002723171143,-0.002614138881,
-	0.002503298922,-0.002390859881, 0.002277025254,-0.002161994576,  0.00204596878,
-	-0.001929145423, 0.001811723225,-0.001693892176, 0.001575843664,-0.001457760809,
-	0.001339829294,-0.001222223975, 0.001105119009,-0.0009886781918,0.0008730689879,
-	-0.0007584549021,0.0006449971115,-0.0005328319385,0.0004221207346,-0.0003130009864,
-	0.0002056103549,-0.0001000804914,-3.457247885e-06,0.0001048851045,-0.0002040847467,
-	0.0003009481588,-0.000395363284,0.0004872324644,-0.0005764554953,0.0006629467243,
-	-0.0007466165698,0.0008273900603,-0.0009051907109,0.0009799567051, -0.00105162512,
-	0.001120146248,-0.001185466303, 0.001247529523,-0.001306312159,  0.00136177917,
-	-0.001413896796, 0.001462645829,-0.001508008805, 0.001549980603,-0.001588551444,
-	0.001623724122,-0.001655496424,  0.00168388267,-0.001708891825, 0.001730548451,
-	-0.001748870476, 0.001763892709,-0.001775646349, 0.001784177497,-0.001789523521,
-	0.001791731687,-0.001790847979, 0.001786946901,-0.001780065242,  0.00177027809,
-	-0.001757647842, 0.001742246561,-0.001724141766, 0.001703415997,-0.001680145622,
-	0.001654417254,-0.001626307727, 0.001595907845,-0.001563300495, 0.001528581604,
-	-0.001491837436,  0.00145316706,-0.001412661979, 0.001370426849,-0.001326559111,
-	0.001281164819,-0.001234338968, 0.001186170382,-0.001136782812, 0.001086270786,
-	-0.001034732792, 0.000982274767,-0.0009289979935,0.0008750099805,-0.0008204086334,
-	0.0007652982022,-0.0007097731577,0.0006539367605,-0.0005978828412,0.0005417126813,
-	-0.000485517201,0.0004293952079,-0.0003734381462,0.0003177424951,-0.0002623936161,
-	0.0002074777731,-0.0001530790469,9.929939552e-05,-4.61919044e-05,-6.147113709e-06,
-	5.764549496e-05,-0.0001082299277,0.0001578318333,-0.0002063783904,0.0002538039116,
-	-0.000300043961,0.0003450436052,-0.000388745073,0.0004310976947,-0.0004720490251,
-	0.0005115550011,-0.0005495700752,0.0005860535894,-0.0006209632847,0.0006542616757,
-	-0.0006859155837,0.0007159006782,-0.000744209392,0.0007707855548,-0.0007956314366,
-	0.0008187279454,-0.0008400639053,0.0008596275584,-0.0008774123853,0.0008934149519,
-	-0.0009076363058,0.0009200809291,-0.000930755632, 0.000939669495,-0.0009468347416,
-	0.0009522665059,-0.0009559826576,0.0009580006008,-0.0009583430947,0.0009570348775,
-	-0.0009541081381,0.0009495872655,-0.0009434898384,0.0009358827956,-0.0009267787682,
-	0.0009162198403,-0.0009042511811,0.0008909119642,-0.0008762460784,0.0008602941525,
-	-0.0008431066526,0.0008247321239,-0.000805224292,0.0007846321096,-0.0007630105247,
-	0.0007404108183,-0.0007168901502,0.0006924984045,-0.0006672907621,0.0006413159426,
-	-0.0006146348896,0.0005873060436,-0.0005594087997,0.0005309510161,-0.0005020283279,
-	0.000472684158,-0.0004429815745,0.0004129711597,-0.000382713275,0.0003522591142,
-	-0.0003216689511,0.0002909950272,-0.0002602963359,0.0002296229213,-0.0001990316523,
-	0.0001685714669,-0.0001382974879,0.0001082541203,-7.849372196e-05,4.905962123e-05,
-	-2.000392669e-05,-8.639025509e-06,3.683733667e-05,-6.450683577e-05,9.164447692e-05,
-	-0.0001182025153, 0.000144137317,-0.0001694187085,0.0001940105576,-0.0002178871073,
-	0.0002410119341,-0.0002633577969,0.0002848923032,-0.000305593916, 0.000325435627,
-	-0.0003443991591,0.0003624612582,-0.0003796103119,0.0003958299931,-0.000411113404,
-	0.0004254416563,-0.0004388011876,0.0004511619336,-0.0004625812289,0.0004729957436,
-	-0.0004824266944,0.0004908660194,-0.0004983198014,0.0005047873128,-0.0005102771684,
-	0.0005147918127,-0.0005183401518,0.0005209276569, -0.00052256661,0.0005232664407,
-	-0.0005230415263,0.0005219044397,-0.0005198743893,0.0005169680808,-0.000513207051,
-	0.0005086101592,-0.0005032079644,0.0004970360314,-0.0004900551867,0.0004823570198,
-	-0.0004739405122,0.0004648313916,-0.0004550589074,0.0004446525709,-0.0004336431739,
-	0.0004220580158,-0.0004099243088,0.0003972716513,-0.0003841303405,0.0003705328272,
-	-0.0003565092629,0.0003420927969,-0.0003273163456,0.0003122160851,-0.0002968245535,
-	0.0002811705344,-0.0002652762341,0.0002491593477,-0.0002329309791,0.0002165349433,
-	-0.0002000410022,0.0001834754366,-0.0001668679761,0.0001502517698,-0.0001336551213,
-	0.0001171101612,-0.0001006404491,8.427639114e-05,-6.804041914e-05,5.196307393e-05,
-	-3.606475366e-05,2.037503691e-05,-4.915092177e-06,-1.028506449e-05,2.520510134e-05,
-	-3.981600821e-05,5.409394362e-05,-6.800150732e-05,8.161525329e-05,-9.479581058e-05,
-	0.0001075880718,-0.0001199640246,0.0001319127623,-0.0001434120059,0.0001544533734,
-	-0.0001650201593,0.0001751102973,-0.0001847077365,0.0001938105706,-0.0002024031273,
-	0.0002104866726,-0.0002180481097,0.0002250888938,-0.0002315960883,0.0002375745535,
-	-0.0002430213499,0.0002479519753,-0.000252372236,0.0002561763977,-0.0002595154219,
-	0.0002623172477,-0.0002645945933, 0.000266359566,-0.0002676100703,0.0002683596103,
-	-0.0002686080406,0.0002683743951,-0.0002676609438,  0.00026648739,-0.0002648555965,
-	0.0002627865179,-0.0002602827153,0.0002573635429,-0.0002540306305,0.0002503027208,
-	-0.0002461822296,0.0002416853822,-0.0002368100104,0.0002317167236,-0.0002261989139,
-	0.0002204044285,-0.0002143196762,0.0002079675614,-0.0002013543708,0.0001945040422,
-	-0.0001874269365,0.0001801506733,-0.0001726847549,0.0001650549384,-0.0001572697802,
-	0.000149355983,-0.000141323093,0.0001331956009,-0.0001249815105,0.0001167061564,
-	-0.0001083849347,0.0001000485936,-9.171511192e-05,8.322500071e-05,-7.489666314e-05,
-	6.655752077e-05,-5.825928019e-05,5.002244143e-05,-4.18547279e-05,3.377440589e-05,
-	-2.578920066e-05,1.792035073e-05,-1.01757978e-05,2.574045084e-06,4.879918833e-06,
-	-1.216943474e-05,1.929072278e-05,-2.623116234e-05,3.298968659e-05,-3.955672219e-05,
-	4.593118865e-05,-5.210601739e-05,5.808253263e-05,-6.360508996e-05,6.914768164e-05,
-	-7.437571912e-05,7.936103793e-05,-8.409898874e-05,8.859050286e-05,-9.283127292e-05,
-	9.681947995e-05,-0.0001005490412,0.0001040198113,-0.000107228756,0.0001101773014,
-	-0.0001128628428,0.0001152866025,-0.0001174495192,0.0001193550634,-0.0001210046685,
-	0.0001223958971,-0.000123527876,0.0001243988227,-0.0001253986266,0.0001257057011,
-	-0.0001259443961,0.0001259599812,-0.0001257604599,0.0001253501832,-0.0001247400069,
-	0.0001239336852,-0.0001229386689,0.0001217582249,-0.0001204026557,0.0001188778042,
-	-0.0001171952754,0.0001153610065,-0.0001133894912,0.0001112881364,-0.000109073284,
-	0.0001067502599,-0.0001043349039,0.0001018315452,-9.852655057e-05,9.618798504e-05,
-	-9.338054952e-05,9.050505469e-05,-8.757905016e-05,8.460623212e-05,-8.160285506e-05,
-	7.856899902e-05,-7.551804447e-05, 7.24503625e-05,-6.938075239e-05,6.631013093e-05,
-	-6.325255526e-05, 6.02079308e-05,-5.719270121e-05,5.420807065e-05,-5.126984615e-05,
-	4.837318556e-05,-4.553170947e-05,4.274157618e-05,-4.240580165e-05,3.808822294e-05,
-	-3.562416532e-05, 3.32506861e-05,-3.09836214e-05,2.881977343e-05,-2.677652628e-05,
-	2.484868128e-05,-2.304847294e-05,2.136947114e-05,-1.982545655e-05,1.841177254e-05,
-	-1.714171958e-05,1.600952965e-05,-1.502947089e-05,1.419634464e-05,-1.352463551e-05,
-	1.300565418e-05,-1.265082301e-05,1.244919167e-05, 0.001675398787
-};
+SIMD_TARGET_AVX2
+static int splitBlockAVX2(const float* in, int count, float* even, float* odd)
+{
+	return splitBlock<SIMD::AVX2>(in, count, even, odd);
+}
 
-struct Filter {
-	float ratio;
-	int numTaps;
-	const float* taps;
-};
+static int splitSamples(SIMD::Backend backend, const float* in, int count, float* even, float* odd)
+{
+	int pairs;
+	switch(backend) {
+		case SIMD::BackendAVX2:
+			pairs = splitBlockAVX2(in, count, even, odd);
+			break;
+		case SIMD::BackendSSE2:
+			pairs = splitBlock<SIMD::SSE2>(in, count, even, odd);
+			break;
+		default:
+			pairs = splitBlock<SIMD::Scalar>(in, count, even, odd);
+			break;
+	}
 
-static const Filter filters[] = {
-	{ 0.99, 1024, H99 },
-	{ 0.95, 1024, H95 },
-	{ 0.90, 1024, H90 },
-	{ 0.85, 1024, H85 },
-	{ 0.80, 1024, H80 },
-	{ 0.75, 1024, H75 },
-	{ 0.70, 1024, H70 },
-	{ 0.65, 1024, H65 },
-	{ 0.60, 1024, H60 },
-	{ 0.55, 1024, H55 },
-	{ 0.50, 1024, H50 },
-	{ 0.45, 1024, H45 },
-	{ 0.40, 1024, H40 },
-	{ 0.38, 1024, H38 },
-	{ 0.36, 1024, H36 },
-	{ 0.34, 1024, H34 },
-	{ 0.32, 1024, H32 },
-	{ 0.30, 1024, H30 },
-	{ 0.28, 1024, H28 },
-	{ 0.26, 1024, H26 },
-	{ 0.24, 1024, H24 },
-	{ 0.22, 1024, H22 },
-	{ 0.20, 1024, H20 },
-	{ 0.19, 1024, H19 },
-	{ 0.18, 1024, H18 },
-	{ 0.17, 1024, H17 },
-	{ 0.16, 1024, H16 },
-	{ 0.15, 1024, H15 },
-	{ 0.14, 1024, H14 },
-	{ 0.13, 1024, H13 },
-	{ 0.12, 1024, H12 },
-	{ 0.11, 1024, H11 },
-	{ 0.10, 1024, H10 },
-	{ 0.09, 1024, H9 },
-	{ 0.08, 1024, H8 },
-	{ 0.07, 1024, H7 },
-	{ 0.0625, 1024, H6_25 },
-	{ 0.062, 1024, H6_2 },
-	{ 0.06, 1024, H6 },
-	{ 0.05, 1024, H5 },
-	{ 0.04, 1024, H4 },
-	{ 0.03, 1024, H3 },
-	{ 0.02, 1024, H2 },
-	{ 0.01, 1024, H1 },
-	{ -1, 0, nullptr }
-};
+	for(; 2 * pairs + 2 <= count; pairs++) {
+		even[pairs] = in[2 * pairs];
+		odd[pairs] = in[2 * pairs + 1];
+	}
+	return pairs;
+}
 
-static std::vector<Real> vectorFromFloatArray(const float* array, int len)
+int HalfBandDecimator::process(const float* inI, const float* inQ, int count, float* outI, float* outQ)
 {
-	std::vector<Real> res(len);
-	for(int i = 0; i < len; ++i)
-		res[i] = array[i];
-	return res;
+	// split the input into even and odd samples behind the history first, so the
+	// output can overwrite the input
+	int pairs = 0;
+	int i = 0;
+
+	if(m_havePending && (count > 0)) {
+		m_evenI[m_keep] = m_pendingI;
+		m_evenQ[m_keep] = m_pendingQ;
+		m_oddI[m_keep] = inI[0];
+		m_oddQ[m_keep] = inQ[0];
+		m_havePending = false;
+		pairs = 1;
+		i = 1;
+	}
+
+	int split = splitSamples(m_backend, inI + i, count - i, &m_evenI[m_keep + pairs], &m_oddI[m_keep + pairs]);
+	splitSamples(m_backend, inQ + i, count - i, &m_evenQ[m_keep + pairs], &m_oddQ[m_keep + pairs]);
+	pairs += split;
+	i += 2 * split;
+
+	if(i < count) {
+		m_pendingI = inI[i];
+		m_pendingQ = inQ[i];
+		m_havePending = true;
+	}
+
+	filter(&m_evenI[0], &m_oddI[0], pairs, outI);
+	filter(&m_evenQ[0], &m_oddQ[0], pairs, outQ);
+
+	memmove(&m_evenI[0], &m_evenI[pairs], m_keep * sizeof(float));
+	memmove(&m_evenQ[0], &m_evenQ[pairs], m_keep * sizeof(float));
+	memmove(&m_oddI[0], &m_oddI[pairs], m_keep * sizeof(float));
+	memmove(&m_oddQ[0], &m_oddQ[pairs], m_keep * sizeof(float));
+	return pairs;
 }
 
-SSEInterpolator::SSEInterpolator() :
-	m_taps(NULL),
-	m_alignedTaps(NULL)
+void HalfBandDecimator::filter(const float* even, const float* odd, int count, float* out) const
 {
+	int r;
+	switch(m_backend) {
+		case SIMD::BackendAVX2:
+			r = filterAVX2(even, odd, count, out);
+			break;
+		case SIMD::BackendSSE2:
+			r = filterBlock<SIMD::SSE2>(even, odd, count, out);
+			break;
+		default:
+			r = filterBlock<SIMD::Scalar>(even, odd, count, out);
+			break;
+	}
+
+	// the tail stays outside the AVX2 entry point, where it would be contracted to FMA
+	int k = m_coeff.size();
+	for(; r < count; ++r) {
+		float sum = 0.5f * even[r + k];
+		for(int j = 0; j < k; ++j)
+			sum += m_coeff[j] * (odd[r + k - 1 - j] + odd[r + k + j]);
+		out[r] = sum;
+	}
 }
 
-SSEInterpolator::~SSEInterpolator()
+// output r is 0.5 * even[r + K] + sum of coeff[j] * (odd[r + K - 1 - j] + odd[r + K + j]),
+// consecutive outputs read consecutive samples, so several are computed per vector; returns
+// the outputs computed
+template<class V>
+int HalfBandDecimator::filterBlock(const float* even, const float* odd, int count, float* out) const
 {
-	free();
+	int k = m_coeff.size();
+	int r = 0;
+
+	const typename V::Float half = V::set1(0.5f);
+	for(; r + V::Lanes <= count; r += V::Lanes) {
+		typename V::Float sum = V::mul(half, V::load(even + r + k));
+		for(int j = 0; j < k; ++j) {
+			typename V::Float pair = V::add(V::load(odd + r + k - 1 - j), V::load(odd + r + k + j));
+			sum = V::madd(V::set1(m_coeff[j]), pair, sum);
+		}
+		V::store(out + r, sum);
+	}
+	return r;
 }
 
-void SSEInterpolator::create(double inputRate, double outputRate)
+SIMD_TARGET_AVX2
+int HalfBandDecimator::filterAVX2(const float* even, const float* odd, int count, float* out) const
 {
-	free();
-	float cutoff;
+	return filterBlock<SIMD::AVX2>(even, odd, count, out);
+}
 
-	if(inputRate < outputRate)
-		cutoff = inputRate;
-	else cutoff = outputRate;
+size_t SSEInterpolator::outputSize(size_t sampleCount) const
+{
+	for(int i = 0; i < m_stages; ++i)
+		sampleCount = sampleCount / 2 + 1;
+	size_t size = (size_t)((((quint64)sampleCount + 1) << 32) / m_step) + 2;
+	if(m_useFFT)
+		size += m_fftFilter.blockSize() / m_decimation + 1;
+	return size;
+}
+
+size_t SSEInterpolator::process(const IQSampleS16* samples, size_t sampleCount, int shift, Complex* output)
+{
+	// the history holds the last m_historyKeep inputs followed by the current chunk in
+	// ascending time order, so outputs of one chunk are computed straight from it
+	Complex* out = output;
 
-	float ratio = cutoff / (1.0 * inputRate * 16.0);
-	const Filter* filter;
-	for(filter = filters; filter->taps != nullptr; ++filter) {
-		if(filter->ratio < ratio)
+	while(sampleCount > 0) {
+		int chunk = (sampleCount < (size_t)HistoryChunk) ? (int)sampleCount : HistoryChunk;
+		int count = loadHistory(samples, chunk, shift);
+		// the FFT filter keeps its own history
+		int last = m_historyKeep - 1 + count;
+		if(m_useFFT)
+			out += m_fftFilter.process(&m_historyI[m_historyKeep], &m_historyQ[m_historyKeep], count, out);
+		else if(m_mode == ModeCubic)
+			out += (this->*m_kernels.processCubic)(last, out);
+		else if(m_mode == ModeDecimate)
+			out += processDecimate(last, out);
+		else if(m_mode == ModeRational)
+			out += processRational(last, out);
+		else out += processLinear(last, out);
+
+		memmove(&m_historyI[0], &m_historyI[count], m_historyKeep * sizeof(Real));
+		memmove(&m_historyQ[0], &m_historyQ[count], m_historyKeep * sizeof(Real));
+		samples += chunk;
+		sampleCount -= chunk;
+	}
+
+	return out - output;
+}
+
+// round 2 * Lanes outputs per step to the 8 bit format, returns the outputs quantised
+template<class V>
+static SIMD_INLINE size_t quantiseBlock(const Complex* in, size_t count, quint8* out)
+{
+	const float* src = (const float*)in;
+	size_t i = 0;
+	for(; i + 2 * V::Lanes <= count; i += 2 * V::Lanes) {
+		const float* p = src + 2 * i;
+		V::storeBytes(out + 2 * i, V::load(p), V::load(p + V::Lanes), V::load(p + 2 * V::Lanes), V::load(p + 3 * V::Lanes));
+	}
+	return i;
+}
+
+SIMD_TARGET_AVX2
+static size_t quantiseBlockAVX2(const Complex* in, size_t count, quint8* out)
+{
+	return quantiseBlock<SIMD::AVX2>(in, count, out);
+}
+
+// one value as SIMD::storeBytes() quantises it
+static inline quint8 quantiseValue(float value)
+{
+	long r = lrintf(value);
+	if(r > 32767)
+		r = 32767;
+	else if(r < -32768)
+		r = -32768;
+	return (quint8)((r & 0xff) ^ 0x80);
+}
+
+static void quantiseOutputs(SIMD::Backend backend, const Complex* in, size_t count, quint8* out)
+{
+	size_t i;
+
+	switch(backend) {
+		case SIMD::BackendAVX2:
+			i = quantiseBlockAVX2(in, count, out);
+			break;
+		case SIMD::BackendSSE2:
+			i = quantiseBlock<SIMD::SSE2>(in, count, out);
+			break;
+		default:
+			i = quantiseBlock<SIMD::Scalar>(in, count, out);
 			break;
 	}
-	if(filter == nullptr)
-		filter = &filters[0];
-	qDebug("selected filter with cutoff ratio %f (perfect ratio is %f)", filter->ratio, ratio);
 
-	std::vector<Real> taps = vectorFromFloatArray(filter->taps, filter->numTaps);
+	for(; i < count; ++i) {
+		out[2 * i] = quantiseValue(in[i].real());
+		out[2 * i + 1] = quantiseValue(in[i].imag());
+	}
+}
 
-	// normalize phase filter
-	{
-		Real sum = 0;
-		for(size_t i = 0; i < taps.size(); ++i)
-			sum += taps[i];
-		sum = 16.0 / sum;
-		for(size_t i = 0; i < taps.size(); ++i)
-			taps[i] *= sum;
+size_t SSEInterpolator::process(const IQSampleS16* samples, size_t sampleCount, int shift, quint8* output)
+{
+	quint8* out = output;
+
+	if(!m_fixedPoint) {
+		// resample in float, then round and quantise like the fixed point path
+		while(sampleCount > 0) {
+			size_t chunk = (sampleCount < (size_t)HistoryChunk) ? sampleCount : HistoryChunk;
+			if(m_quantise.size() < outputSize(chunk))
+				m_quantise.resize(outputSize(chunk));
+			size_t count = process(samples, chunk, shift, m_quantise.data());
+			quantiseOutputs(m_backend, m_quantise.data(), count, out);
+			out += 2 * count;
+			samples += chunk;
+			sampleCount -= chunk;
+		}
+		return (out - output) / 2;
 	}
 
-	// init state
-	m_ptr = 0;
-	m_nTaps = taps.size() / 16.0;
-	m_samples.resize(m_nTaps + 2);
-	for(int i = 0; i < m_nTaps + 2; i++)
-		m_samples[i] = 0;
-
-	// reorder into polyphase
-	std::vector<Real> polyphase(taps.size());
-	for(int phase = 0; phase < 16; phase++) {
-		for(int i = 0; i < m_nTaps; i++)
-			polyphase[phase * m_nTaps + i] = taps[i * 16 + phase];
+	while(sampleCount > 0) {
+		int chunk = (sampleCount < (size_t)HistoryChunk) ? (int)sampleCount : HistoryChunk;
+		int count = loadFixedHistory(samples, chunk, shift);
+		out += 2 * (this->*m_kernels.processFixed)(m_historyKeep - 1 + count, out);
+
+		memmove(&m_fixedHistoryI[0], &m_fixedHistoryI[count], m_historyKeep * sizeof(qint16));
+		memmove(&m_fixedHistoryQ[0], &m_fixedHistoryQ[count], m_historyKeep * sizeof(qint16));
+		samples += chunk;
+		sampleCount -= chunk;
 	}
 
-	// normalize phase filters
-#if 0
-	for(int phase = 0; phase < 16; phase++) {
-		Real sum = 0;
-		for(int i = phase * m_nTaps; i < phase * m_nTaps + m_nTaps; i++)
-			sum += polyphase[i];
-		for(int i = phase * m_nTaps; i < phase * m_nTaps + m_nTaps; i++)
-			polyphase[i] /= sum;
+	return (out - output) / 2;
+}
+
+// split 2 * Lanes I/Q pairs per step into the 16 bit history, returns the pairs converted
+template<class V>
+static SIMD_INLINE int convertFixedBlock(const IQSampleS16* samples, int sampleCount, int shift, qint16* dstI, qint16* dstQ)
+{
+	int i = 0;
+	for(; i + 2 * V::Lanes <= sampleCount; i += 2 * V::Lanes) {
+		typename V::Short valuesI;
+		typename V::Short valuesQ;
+		V::loadIQShort(samples + i, shift, &valuesI, &valuesQ);
+		V::storeShort(dstI + i, valuesI);
+		V::storeShort(dstQ + i, valuesQ);
+	}
+	return i;
+}
+
+SIMD_TARGET_AVX2
+static int convertFixedBlockAVX2(const IQSampleS16* samples, int sampleCount, int shift, qint16* dstI, qint16* dstQ)
+{
+	return convertFixedBlock<SIMD::AVX2>(samples, sampleCount, shift, dstI, dstQ);
+}
+
+int SSEInterpolator::loadFixedHistory(const IQSampleS16* samples, int sampleCount, int shift)
+{
+	qint16* dstI = &m_fixedHistoryI[m_historyKeep];
+	qint16* dstQ = &m_fixedHistoryQ[m_historyKeep];
+	int i;
+
+	switch(m_backend) {
+		case SIMD::BackendAVX2:
+			i = convertFixedBlockAVX2(samples, sampleCount, shift, dstI, dstQ);
+			break;
+		case SIMD::BackendSSE2:
+			i = convertFixedBlock<SIMD::SSE2>(samples, sampleCount, shift, dstI, dstQ);
+			break;
+		default:
+			i = convertFixedBlock<SIMD::Scalar>(samples, sampleCount, shift, dstI, dstQ);
+			break;
 	}
-#endif
-
-	// move taps around to match sse storage requirements
-	m_taps = new float[2 * taps.size() + 8];
-	for(size_t i = 0; i < 2 * taps.size() + 8; ++i)
-		m_taps[i] = 0;
-	m_alignedTaps = (float*)(((quint64)m_taps) + ((16 - ((quint64)m_taps & 15)) & 15));
-	for(size_t i = 0; i < taps.size(); ++i) {
-		m_alignedTaps[2 * i + 0] = polyphase[i];
-		m_alignedTaps[2 * i + 1] = polyphase[i];
+
+	for(; i < sampleCount; i++) {
+		dstI[i] = samples[i].i >> shift;
+		dstQ[i] = samples[i].q >> shift;
 	}
-	m_taps2 = new float[2 * taps.size() + 8];
-	for(size_t i = 0; i < 2 * taps.size() + 8; ++i)
-		m_taps2[i] = 0;
-	m_alignedTaps2 = (float*)(((quint64)m_taps2) + ((16 - ((quint64)m_taps2 & 15)) & 15));
-	for(size_t i = 1; i < taps.size(); ++i) {
-		m_alignedTaps2[2 * (i - 1) + 0] = polyphase[i];
-		m_alignedTaps2[2 * (i - 1) + 1] = polyphase[i];
+	return sampleCount;
+}
+
+template<int Taps, SIMD::Backend Backend>
+int SSEInterpolator::processFixed(int last, quint8* output)
+{
+	// same schedule as processRational(), decimation has a single entry
+	const ScheduleEntry* schedule = m_schedule.data();
+	int scheduleSize = m_schedule.size();
+	int pos = m_schedulePos;
+	int newest = m_historyKeep - 1;
+	size_t advance = m_schedulePending;
+	int produced = 0;
+
+	while((size_t)(last - newest) >= advance) {
+		newest += (int)advance;
+		const qint16* coeff = &m_fixedTaps[schedule[pos].phase * tapCount<Taps>()];
+		int start = newest - tapCount<Taps>() + 1;
+		if(Backend == SIMD::BackendAVX2)
+			doInterpolateFixedAVX2<Taps>(coeff, start, output + 2 * produced++);
+		else if(Backend == SIMD::BackendSSE2)
+			doInterpolateFixed<SIMD::SSE2, Taps>(coeff, start, output + 2 * produced++);
+		else doInterpolateFixed<SIMD::Scalar, Taps>(coeff, start, output + 2 * produced++);
+
+		if(++pos == scheduleSize)
+			pos = 0;
+		advance = schedule[pos].advance;
+	}
+
+	m_schedulePos = pos;
+	m_schedulePending = advance - (last - newest);
+	return produced;
+}
+
+// round a fixed point accumulator to the sample scale and store it as unsigned 8 bit,
+// keeping the low byte like the (qint8) cast of the float path
+static inline quint8 quantiseFixed(qint32 acc, int shift)
+{
+	return (quint8)((qint8)((acc + (1 << (shift - 1))) >> shift) + 128);
+}
+
+template<class V, int Taps>
+void SSEInterpolator::doInterpolateFixed(const qint16* coeff, int start, quint8* result) const
+{
+	// 2 * Lanes taps per multiply-add, products are summed pairwise into 32 bit lanes
+	const qint16* srcI = &m_fixedHistoryI[start];
+	const qint16* srcQ = &m_fixedHistoryQ[start];
+	typename V::Int sumI = V::zeroInt();
+	typename V::Int sumQ = V::zeroInt();
+	const int todo = tapCount<Taps>() / (2 * V::Lanes);
+
+	for(int i = 0; i < todo; i++) {
+		typename V::Short c = V::loadShort(coeff + i * 2 * V::Lanes);
+		sumI = V::addInt(sumI, V::maddShort(V::loadShort(srcI + i * 2 * V::Lanes), c));
+		sumQ = V::addInt(sumQ, V::maddShort(V::loadShort(srcQ + i * 2 * V::Lanes), c));
+	}
+
+	qint32 accI;
+	qint32 accQ;
+	V::sumInt(sumI, sumQ, &accI, &accQ);
+	result[0] = quantiseFixed(accI, m_fixedShift);
+	result[1] = quantiseFixed(accQ, m_fixedShift);
+}
+
+template<int Taps>
+SIMD_TARGET_AVX2
+void SSEInterpolator::doInterpolateFixedAVX2(const qint16* coeff, int start, quint8* result) const
+{
+	doInterpolateFixed<SIMD::AVX2, Taps>(coeff, start, result);
+}
+
+// append a chunk of input samples behind the kept history, through the half-band stages if
+// there are any, returns the number of samples appended
+int SSEInterpolator::loadHistory(const IQSampleS16* samples, int sampleCount, int shift)
+{
+	float* dstI = &m_historyI[m_historyKeep];
+	float* dstQ = &m_historyQ[m_historyKeep];
+
+	if(m_stages == 0) {
+		convertSamples(m_backend, samples, sampleCount, shift, dstI, dstQ);
+		return sampleCount;
+	}
+
+	// every stage works in place, the last one writes into the history
+	convertSamples(m_backend, samples, sampleCount, shift, &m_stageI[0], &m_stageQ[0]);
+	int count = sampleCount;
+	for(int i = 0; i + 1 < m_stages; ++i)
+		count = m_halfBands[i].process(&m_stageI[0], &m_stageQ[0], count, &m_stageI[0], &m_stageQ[0]);
+	return m_halfBands[m_stages - 1].process(&m_stageI[0], &m_stageQ[0], count, dstI, dstQ);
+}
+
+// split Lanes I/Q pairs per step into float, returns the pairs converted
+template<class V>
+static SIMD_INLINE int convertBlock(const IQSampleS16* samples, int sampleCount, int shift, float* dstI, float* dstQ)
+{
+	int i = 0;
+	for(; i + V::Lanes <= sampleCount; i += V::Lanes) {
+		typename V::Float valuesI;
+		typename V::Float valuesQ;
+		V::loadIQ(samples + i, shift, &valuesI, &valuesQ);
+		V::store(dstI + i, valuesI);
+		V::store(dstQ + i, valuesQ);
+	}
+	return i;
+}
+
+SIMD_TARGET_AVX2
+static int convertBlockAVX2(const IQSampleS16* samples, int sampleCount, int shift, float* dstI, float* dstQ)
+{
+	return convertBlock<SIMD::AVX2>(samples, sampleCount, shift, dstI, dstQ);
+}
+
+void SSEInterpolator::convertSamples(SIMD::Backend backend, const IQSampleS16* samples, int sampleCount, int shift, float* dstI, float* dstQ)
+{
+	int i;
+
+	switch(backend) {
+		case SIMD::BackendAVX2:
+			i = convertBlockAVX2(samples, sampleCount, shift, dstI, dstQ);
+			break;
+		case SIMD::BackendSSE2:
+			i = convertBlock<SIMD::SSE2>(samples, sampleCount, shift, dstI, dstQ);
+			break;
+		default:
+			i = convertBlock<SIMD::Scalar>(samples, sampleCount, shift, dstI, dstQ);
+			break;
+	}
+
+	for(; i < sampleCount; i++) {
+		dstI[i] = samples[i].i >> shift;
+		dstQ[i] = samples[i].q >> shift;
 	}
 }
 
+int SSEInterpolator::processLinear(int last, Complex* output)
+{
+	// work on local copies so the state stays in registers
+	Output outputs[OutputBlock];
+	int pending = 0;
+	int produced = 0;
+	int newest = m_historyKeep - 1;
+	quint64 step = m_step;
+	quint64 position = m_position;
+
+	for(;;) {
+		// all outputs that fall before the next input sample, phase and blend factor
+		// come straight from the fraction bits
+		int start = newest - m_nTaps + 1;
+		while(position < FixedPointOne) {
+			quint64 pos = position * m_phases;
+			Output& o = outputs[pending++];
+			o.start = start;
+			o.phase = (int)(pos >> 32);
+			o.frac = (Real)(quint32)pos * (Real)(1.0 / FixedPointOne);
+			if(pending == OutputBlock) {
+				(this->*m_kernels.flushOutputs)(outputs, pending, true, output + produced);
+				produced += pending;
+				pending = 0;
+			}
+			position += step;
+		}
+		// skip the inputs up to the next output at once
+		quint64 advance = position >> 32;
+		if(advance > (quint64)(last - newest)) {
+			position -= (quint64)(last - newest) << 32;
+			break;
+		}
+		newest += (int)advance;
+		position -= advance << 32;
+	}
+
+	(this->*m_kernels.flushOutputs)(outputs, pending, true, output + produced);
+	m_position = position;
+	return produced + pending;
+}
+
+int SSEInterpolator::processRational(int last, Complex* output)
+{
+	// the schedule tells how many inputs to consume before each output and which
+	// phase to use, no fractional bookkeeping at all
+	Output outputs[OutputBlock];
+	int pending = 0;
+	int produced = 0;
+	const ScheduleEntry* schedule = m_schedule.data();
+	int scheduleSize = m_schedule.size();
+	int pos = m_schedulePos;
+	int newest = m_historyKeep - 1;
+	size_t advance = m_schedulePending;
+
+	while((size_t)(last - newest) >= advance) {
+		newest += (int)advance;
+		int start = newest - m_nTaps + 1;
+
+		if(schedule[pos].mirror != 0) {
+			// symmetric phases are computed on their own with the folding kernel
+			(this->*m_kernels.flushOutputs)(outputs, pending, false, output + produced);
+			produced += pending;
+			pending = 0;
+			const float* coeff = &m_alignedTaps[schedule[pos].phase * m_nTaps];
+			if(schedule[pos].phase == 0)
+				(this->*m_kernels.interpolateSymmetric)(coeff, start - 1, schedule[pos].mirror, output + produced++);
+			else (this->*m_kernels.interpolateSymmetric)(coeff, start, schedule[pos].mirror, output + produced++);
+		} else {
+			Output& o = outputs[pending++];
+			o.start = start;
+			o.phase = schedule[pos].phase;
+			o.frac = 0;
+			if(pending == OutputBlock) {
+				(this->*m_kernels.flushOutputs)(outputs, pending, false, output + produced);
+				produced += pending;
+				pending = 0;
+			}
+		}
+
+		if(++pos == scheduleSize)
+			pos = 0;
+		advance = schedule[pos].advance;
+	}
+
+	(this->*m_kernels.flushOutputs)(outputs, pending, false, output + produced);
+	m_schedulePos = pos;
+	m_schedulePending = advance - (last - newest);
+	return produced + pending;
+}
+
+int SSEInterpolator::processDecimate(int last, Complex* output)
+{
+	// the single phase is phase 0 of a one phase bank: symmetric around its center tap,
+	// so only the window starts (one sample early, see doInterpolateSymmetric()) are needed
+	int starts[OutputBlock];
+	int pending = 0;
+	int produced = 0;
+	int newest = m_historyKeep - 1;
+	size_t advance = m_schedulePending;
+
+	while((size_t)(last - newest) >= advance) {
+		newest += (int)advance;
+		advance = m_decimation;
+		starts[pending++] = newest - m_nTaps;
+		if(pending == OutputBlock) {
+			(this->*m_kernels.flushDecimated)(starts, pending, output + produced);
+			produced += pending;
+			pending = 0;
+		}
+	}
+
+	(this->*m_kernels.flushDecimated)(starts, pending, output + produced);
+	m_schedulePending = advance - (last - newest);
+	return produced + pending;
+}
+
+// the four sample window is one vector of the four lane backends
+template<class V>
+int SSEInterpolator::processCubic(int last, Complex* output)
+{
+	// Farrow structure: the weights of the four window samples are polynomials in the
+	// fractional position mu, evaluated with Horner's scheme, rows are mu^0 .. mu^3; the
+	// gain is folded into the polynomials
+	static const float farrow[4][4] = {
+		{ 0.0f, 1.0f, 0.0f, 0.0f },
+		{ -1.0f / 3.0f, -0.5f, 1.0f, -1.0f / 6.0f },
+		{ 0.5f, -1.0f, 0.5f, 0.0f },
+		{ -1.0f / 6.0f, 0.5f, -0.5f, 1.0f / 6.0f }
+	};
+	static_assert(V::Lanes == 4, "cubic interpolation needs four lanes");
+	const typename V::Float gain = V::set1(m_gain);
+	const typename V::Float c0 = V::mul(gain, V::load(farrow[0]));
+	const typename V::Float c1 = V::mul(gain, V::load(farrow[1]));
+	const typename V::Float c2 = V::mul(gain, V::load(farrow[2]));
+	const typename V::Float c3 = V::mul(gain, V::load(farrow[3]));
+	Complex* out = output;
+	int newest = m_historyKeep - 1;
+	quint64 step = m_step;
+	quint64 position = m_position;
+
+	for(;;) {
+		const float* srcI = &m_historyI[newest - 3];
+		const float* srcQ = &m_historyQ[newest - 3];
+		while(position < FixedPointOne) {
+			typename V::Float mu = V::set1((Real)(quint32)position * (Real)(1.0 / FixedPointOne));
+			typename V::Float w = V::madd(V::madd(V::madd(c3, mu, c2), mu, c1), mu, c0);
+			V::storeSum(V::mul(V::load(srcI), w), V::mul(V::load(srcQ), w), out++);
+			position += step;
+		}
+		quint64 advance = position >> 32;
+		if(advance > (quint64)(last - newest)) {
+			position -= (quint64)(last - newest) << 32;
+			break;
+		}
+		newest += (int)advance;
+		position -= advance << 32;
+	}
+
+	m_position = position;
+	return out - output;
+}
+
+// coefficient vector i of the todo vectors of a phase, a mirrored phase is read back to front
+template<class V, bool Reverse>
+static SIMD_INLINE typename V::Float coefficients(const float* coeff, int i, int todo)
+{
+	if(Reverse)
+		return V::reverse(V::loadAligned(coeff + (todo - 1 - i) * V::Lanes));
+	else return V::loadAligned(coeff + i * V::Lanes);
+}
+
+template<class V, int Taps>
+void SSEInterpolator::doInterpolate(int start, int phase, Complex* result)
+{
+	bool reversed;
+	const float* coeff = phaseCoefficients<Taps>(phase, &reversed);
+	if(reversed)
+		doInterpolatePhase<V, Taps, true>(coeff, start, result);
+	else doInterpolatePhase<V, Taps, false>(coeff, start, result);
+}
+
+template<class V, int Taps>
+void SSEInterpolator::doInterpolateLinear(int start, int phase, Real frac, Complex* result)
+{
+	bool reversedA;
+	bool reversedB;
+	const float* coeffA = phaseCoefficients<Taps>(phase, &reversedA);
+	const float* coeffB = phaseCoefficients<Taps>(phase + 1, &reversedB);
+	if(reversedA && reversedB)
+		doInterpolateLinear<V, Taps, true, true>(coeffA, coeffB, start, frac, result);
+	else if(reversedA)
+		doInterpolateLinear<V, Taps, true, false>(coeffA, coeffB, start, frac, result);
+	else doInterpolateLinear<V, Taps, false, false>(coeffA, coeffB, start, frac, result);
+}
+
+template<class V, int Taps, bool Reverse>
+void SSEInterpolator::doInterpolatePhase(const float* coeff, int start, Complex* result) const
+{
+	// one coefficient vector feeds both the I and the Q accumulator
+	const float* srcI = &m_historyI[start];
+	const float* srcQ = &m_historyQ[start];
+	typename V::Float sumI = V::zero();
+	typename V::Float sumQ = V::zero();
+	const int todo = tapCount<Taps>() / V::Lanes;
+
+	for(int i = 0; i < todo; i++) {
+		typename V::Float c = coefficients<V, Reverse>(coeff, i, todo);
+		sumI = V::madd(V::load(srcI), c, sumI);
+		sumQ = V::madd(V::load(srcQ), c, sumQ);
+		srcI += V::Lanes;
+		srcQ += V::Lanes;
+	}
+
+	V::storeSum(sumI, sumQ, result);
+}
+
+template<class V, int Taps, bool ReverseA, bool ReverseB>
+void SSEInterpolator::doInterpolateLinear(const float* coeffA, const float* coeffB, int start, Real frac, Complex* result) const
+{
+	// blend the coefficients of both phases on the fly, then one pass over I and Q
+	const float* srcI = &m_historyI[start];
+	const float* srcQ = &m_historyQ[start];
+	const typename V::Float f = V::set1(frac);
+	typename V::Float sumI = V::zero();
+	typename V::Float sumQ = V::zero();
+	const int todo = tapCount<Taps>() / V::Lanes;
+
+	for(int i = 0; i < todo; i++) {
+		typename V::Float a = coefficients<V, ReverseA>(coeffA, i, todo);
+		typename V::Float c = V::madd(f, V::sub(coefficients<V, ReverseB>(coeffB, i, todo), a), a);
+		sumI = V::madd(V::load(srcI), c, sumI);
+		sumQ = V::madd(V::load(srcQ), c, sumQ);
+		srcI += V::Lanes;
+		srcQ += V::Lanes;
+	}
+
+	V::storeSum(sumI, sumQ, result);
+}
+
+// phase 0 (mirror = m_nTaps, window one sample earlier) and phase m_phases / 2
+// (mirror = m_nTaps - 1) are symmetric themselves: tap i equals tap mirror - i, so the
+// mirrored history samples are added first and only half the multiplies are needed
+template<class V, int Taps>
+void SSEInterpolator::doInterpolateSymmetric(const float* coeff, int start, int mirror, Complex* result)
+{
+	const float* srcI = &m_historyI[start];
+	const float* srcQ = &m_historyQ[start];
+	typename V::Float sumI = V::zero();
+	typename V::Float sumQ = V::zero();
+	const int lanes = V::Lanes;
+	const int todo = tapCount<Taps>() / (2 * lanes);
+
+	for(int i = 0; i < todo; i++) {
+		// samples i*L .. i*L+L-1 and their partners mirror-i*L .. mirror-i*L-L+1
+		typename V::Float c = V::loadAligned(coeff + i * lanes);
+		typename V::Float foldI = V::add(V::load(srcI + i * lanes), V::reverse(V::load(srcI + mirror - i * lanes - (lanes - 1))));
+		typename V::Float foldQ = V::add(V::load(srcQ + i * lanes), V::reverse(V::load(srcQ + mirror - i * lanes - (lanes - 1))));
+		sumI = V::madd(foldI, c, sumI);
+		sumQ = V::madd(foldQ, c, sumQ);
+	}
+
+	V::storeSum(sumI, sumQ, result);
+	addCenterTap<Taps>(coeff, start, mirror, result);
+}
+
+template<int Taps>
+SIMD_TARGET_AVX2
+void SSEInterpolator::doInterpolateSymmetricAVX2(const float* coeff, int start, int mirror, Complex* result)
+{
+	doInterpolateSymmetric<SIMD::AVX2, Taps>(coeff, start, mirror, result);
+}
+
+template<class V, int Taps, int N>
+void SSEInterpolator::doDecimateGroup(const int* starts, Complex* result) const
+{
+	// N folded outputs side by side, one coefficient vector feeds all of them
+	const float* srcI[N];
+	const float* srcQ[N];
+	typename V::Float sumI[N];
+	typename V::Float sumQ[N];
+	const int lanes = V::Lanes;
+	const int nTaps = tapCount<Taps>();
+	const int todo = nTaps / (2 * lanes);
+
+#pragma GCC unroll 4
+	for(int n = 0; n < N; n++) {
+		srcI[n] = &m_historyI[starts[n]];
+		srcQ[n] = &m_historyQ[starts[n]];
+		sumI[n] = V::zero();
+		sumQ[n] = V::zero();
+	}
+
+	for(int i = 0; i < todo; i++) {
+		typename V::Float c = V::loadAligned(m_alignedTaps + i * lanes);
+#pragma GCC unroll 4
+		for(int n = 0; n < N; n++) {
+			// samples i*L .. i*L+L-1 and their partners nTaps-i*L .. nTaps-i*L-L+1
+			typename V::Float foldI = V::add(V::load(srcI[n] + i * lanes), V::reverse(V::load(srcI[n] + nTaps - i * lanes - (lanes - 1))));
+			typename V::Float foldQ = V::add(V::load(srcQ[n] + i * lanes), V::reverse(V::load(srcQ[n] + nTaps - i * lanes - (lanes - 1))));
+			sumI[n] = V::madd(foldI, c, sumI[n]);
+			sumQ[n] = V::madd(foldQ, c, sumQ[n]);
+		}
+	}
+
+	for(int n = 0; n < N; n++) {
+		V::storeSum(sumI[n], sumQ[n], result + n);
+		addCenterTap<Taps>(m_alignedTaps, starts[n], nTaps, result + n);
+	}
+}
+
+// compute a group of outputs one after the other
+template<class V, int Taps>
+void SSEInterpolator::flushOutputs(const Output* outputs, int count, bool linear, Complex* result)
+{
+	for(int i = 0; i < count; i++) {
+		if(linear)
+			doInterpolateLinear<V, Taps>(outputs[i].start, outputs[i].phase, outputs[i].frac, result + i);
+		else doInterpolate<V, Taps>(outputs[i].start, outputs[i].phase, result + i);
+	}
+}
+
+// AVX2 computes the outputs one after the other as well. Kernels running a group side by
+// side to overlap their FMA chains, loading the history once for groups with one window,
+// or once for all windows of a group through zero padded coefficients, all measured
+// slower: 2.4 -> 2.0 MS/s High 19 ns per output against 21 to 24, 0.25 -> 2.048 MS/s 16
+// against 20 to 24. Decimation keeps its groups, one coefficient vector feeds all of
+// them there, see doDecimateGroup().
+template<int Taps>
+SIMD_TARGET_AVX2
+void SSEInterpolator::flushOutputsAVX2(const Output* outputs, int count, bool linear, Complex* result)
+{
+	flushOutputs<SIMD::AVX2, Taps>(outputs, count, linear, result);
+}
+
+template<class V, int Taps>
+void SSEInterpolator::flushDecimated(const int* starts, int count, Complex* result)
+{
+	for(int i = 0; i < count; i++)
+		doInterpolateSymmetric<V, Taps>(m_alignedTaps, starts[i], tapCount<Taps>(), result + i);
+}
+
+template<int Taps>
+SIMD_TARGET_AVX2
+void SSEInterpolator::flushDecimatedAVX2(const int* starts, int count, Complex* result)
+{
+	switch(count) {
+		case 4:
+			doDecimateGroup<SIMD::AVX2, Taps, 4>(starts, result);
+			break;
+		case 3:
+			doDecimateGroup<SIMD::AVX2, Taps, 3>(starts, result);
+			break;
+		case 2:
+			doDecimateGroup<SIMD::AVX2, Taps, 2>(starts, result);
+			break;
+		case 1:
+			doDecimateGroup<SIMD::AVX2, Taps, 1>(starts, result);
+			break;
+		default:
+			break;
+	}
+}
+
+#define KERNELS(V, taps) \
+	{ &SSEInterpolator::flushOutputs<SIMD::V, taps>, &SSEInterpolator::flushDecimated<SIMD::V, taps>, \
+	  &SSEInterpolator::doInterpolateSymmetric<SIMD::V, taps>, &SSEInterpolator::processFixed<taps, SIMD::Backend##V>, \
+	  &SSEInterpolator::processCubic<SIMD::V> }
+
+#define KERNELS_AVX2(taps) \
+	{ &SSEInterpolator::flushOutputsAVX2<taps>, &SSEInterpolator::flushDecimatedAVX2<taps>, \
+	  &SSEInterpolator::doInterpolateSymmetricAVX2<taps>, &SSEInterpolator::processFixed<taps, SIMD::BackendAVX2>, \
+	  &SSEInterpolator::processCubic<SIMD::SSE2> }
+
+#define KERNEL_TABLE_ENTRY(taps) \
+	{ taps, { KERNELS(Scalar, taps), KERNELS(SSE2, taps), KERNELS_AVX2(taps) } }
+
+// the kernels are instantiated for the tap counts of the quality presets, any other count
+// runs the generic ones; the cubic mode runs four lanes on AVX2 as well
+void SSEInterpolator::selectKernels()
+{
+	struct KernelTableEntry {
+		int taps;
+		Kernels backend[3]; // indexed by SIMD::Backend
+	};
+	static const KernelTableEntry kernelTable[] = {
+		KERNEL_TABLE_ENTRY(16),
+		KERNEL_TABLE_ENTRY(32),
+		KERNEL_TABLE_ENTRY(64),
+		KERNEL_TABLE_ENTRY(128),
+		KERNEL_TABLE_ENTRY(512),
+		KERNEL_TABLE_ENTRY(0)
+	};
+
+	const KernelTableEntry* entry = kernelTable;
+	while((entry->taps != 0) && (entry->taps != m_nTaps))
+		++entry;
+	m_kernels = entry->backend[m_backend];
+}
+
+#undef KERNEL_TABLE_ENTRY
+#undef KERNELS_AVX2
+#undef KERNELS
+
 void SSEInterpolator::free()
 {
-	if(m_taps != NULL) {
-		delete[] m_taps;
-		m_taps = NULL;
-		m_alignedTaps = NULL;
-		delete[] m_taps2;
-		m_taps2 = NULL;
-		m_alignedTaps2 = NULL;
+	m_bank.reset();
+	m_alignedTaps = NULL;
+	m_fixedTaps = NULL;
+	// the history is stale from here on
+	m_historyRate = 0;
+}
+
+void SSEInterpolator::continueFrom(const IQSampleS16* samples, size_t sampleCount, int shift)
+{
+	if(m_historyRate <= 0.0)
+		return;
+
+	// the path of process() up to the history
+	while(sampleCount > 0) {
+		int chunk = (sampleCount < (size_t)HistoryChunk) ? (int)sampleCount : HistoryChunk;
+		int count = loadHistory(samples, chunk, shift);
+		memmove(&m_historyI[0], &m_historyI[count], m_historyKeep * sizeof(Real));
+		memmove(&m_historyQ[0], &m_historyQ[count], m_historyKeep * sizeof(Real));
+		samples += chunk;
+		sampleCount -= chunk;
+	}
+
+	if(m_fixedPoint) {
+		for(int i = 0; i < m_historyKeep; ++i) {
+			m_fixedHistoryI[i] = (qint16)lrintf(m_historyI[i]);
+			m_fixedHistoryQ[i] = (qint16)lrintf(m_historyQ[i]);
+		}
 	}
+	if(m_useFFT)
+		m_fftFilter.loadHistory(&m_historyI[0], &m_historyQ[0], m_historyKeep);
 }
@@ -29,128 +29,240 @@
 #ifndef INCLUDE_SSEINTERPOLATOR_H
 #define INCLUDE_SSEINTERPOLATOR_H
 
-#include <immintrin.h>
+#include <memory>
+#include <vector>
 #include "dsptypes.h"
+#include "fftfilter.h"
+#include "simd.h"
 #include <stdio.h>
 #ifndef WIN32
 #include <unistd.h>
 #endif
 
+// decimate by 2 with a half-band filter: every other tap except the center one is zero,
+// so an output costs half the multiplies of a normal FIR and half of them are skipped
+class HalfBandDecimator {
+public:
+	HalfBandDecimator();
+
+	// passband edge relative to the input rate, at most maxCount input samples per process()
+	void create(double passband, int maxCount, SIMD::Backend backend);
+	// returns the number of output samples, output may point to the input
+	int process(const float* inI, const float* inQ, int count, float* outI, float* outQ);
+
+private:
+	std::vector<float> m_coeff; // taps at distance 1, 3, 5, ... from the center tap (0.5)
+	// the input split into even and odd samples, the last m_keep of each are history
+	std::vector<float> m_evenI;
+	std::vector<float> m_evenQ;
+	std::vector<float> m_oddI;
+	std::vector<float> m_oddQ;
+	int m_keep;
+	bool m_havePending; // odd input count, the last sample waits for its partner
+	float m_pendingI;
+	float m_pendingQ;
+	SIMD::Backend m_backend;
+
+	void filter(const float* even, const float* odd, int count, float* out) const;
+	template<class V> SIMD_INLINE int filterBlock(const float* even, const float* odd, int count, float* out) const;
+	int filterAVX2(const float* even, const float* odd, int count, float* out) const;
+};
+
 class SSEInterpolator {
 public:
+	// presets trading taps per phase (CPU per output) for alias rejection
+	enum Quality {
+		QualityLow, // 16 taps per phase
+		QualityMedium, // 32 taps per phase
+		QualityHigh, // 64 taps per phase
+		QualityBest, // 128 taps per phase
+		QualityCubic, // cubic interpolation when upsampling, the Low bank otherwise (waterfall displays)
+		QualityExtreme // 512 taps per phase, integer decimation filters in the frequency domain
+	};
+
 	SSEInterpolator();
 	~SSEInterpolator();
 
-	void create(double inputRate, double outputRate);
+	// large decimation ratios first pass a chain of half-band decimators until the rate is
+	// below four times the output rate, then
+	// integer decimation ratios only compute every M-th output with the single phase (long
+	// filters with small M run as FFT fast convolution when that is cheaper),
+	// exact integer rate ratios L/M with L <= 256 get an exact L phase bank and a precomputed
+	// phase schedule, otherwise the output is blended linearly from the two nearest of the
+	// given number of phases; the filter is designed to match both rates and the gain is
+	// folded into its taps
+	void create(double inputRate, double outputRate, int phases = 16, int tapsPerPhase = 64, double gain = 1.0);
+	void create(double inputRate, double outputRate, Quality quality, double gain = 1.0);
 	void free();
+	// Instruction set of the kernels, SIMD::defaultBackend() unless set here before
+	// create(). The scalar backend is the reference to compare the others against: SSE2
+	// gives bit identical results, AVX2 differs in float rounding (fused multiply-adds, eight
+	// lanes summed in another order, a few 1e-4 on a +-1000 signal), and the 8 bit fixed
+	// point output is bit identical on all of them.
+	void setBackend(SIMD::Backend backend);
+	SIMD::Backend backend() const { return m_backend; }
+	// Take over the newest input samples right after create(), so switching to this
+	// interpolator continues the output without a transient: they run through the half-band
+	// stages into the history, no outputs are computed. Several calls append, oldest samples
+	// first; enough samples fill the history of any filter, longer ones than before as
+	// well. create() reuses the buffers of an earlier configuration, so two interpolators
+	// used in turns stop allocating once both have seen their largest configuration.
+	void continueFrom(const IQSampleS16* samples, size_t sampleCount, int shift);
 
-	bool interpolate(Real* distance, const Complex& next, bool* consumed, Complex* result)
-	{
-		while(*distance >= 1.0) {
-			if(!(*consumed)) {
-				advanceFilter(next);
-				*distance -= 1.0;
-				*consumed = true;
-			} else {
-				return false;
-			}
-		}
-		doInterpolate((int)(*distance * 16.0), result);
-		return true;
-	}
+	// upper bound of output samples process() produces from sampleCount input samples
+	size_t outputSize(size_t sampleCount) const;
 
+	// resample a block of input samples, returns the number of output samples written to output
+	size_t process(const IQSampleS16* samples, size_t sampleCount, int shift, Complex* output);
+	// same, but straight to interleaved unsigned 8 bit I/Q as sent by rtl_tcp; exact ratios
+	// without half-band stages run in 16 bit fixed point from input to output
+	size_t process(const IQSampleS16* samples, size_t sampleCount, int shift, quint8* output);
 
 private:
-	float* m_taps;
-	float* m_alignedTaps;
-	float* m_taps2;
-	float* m_alignedTaps2;
-	std::vector<Complex> m_samples;
-	int m_ptr;
+	enum Mode {
+		ModeLinear,
+		ModeRational,
+		ModeDecimate,
+		ModeCubic
+	};
+
+	struct ScheduleEntry {
+		int advance;
+		int phase;
+		int mirror; // != 0 for phases that are symmetric themselves, see doInterpolateSymmetric()
+	};
+
+	// one pending output: its history window and phase
+	struct Output {
+		int start; // oldest history sample of the window
+		int phase;
+		Real frac; // blend factor towards phase + 1 (linear mode only)
+	};
+
+	// outputs handed to the kernels in one call
+	enum { OutputBlock = 4 };
+
+	typedef void (SSEInterpolator::*FlushOutputs)(const Output* outputs, int count, bool linear, Complex* result);
+	typedef void (SSEInterpolator::*FlushDecimated)(const int* starts, int count, Complex* result);
+	typedef void (SSEInterpolator::*InterpolateSymmetric)(const float* coeff, int start, int mirror, Complex* result);
+	typedef int (SSEInterpolator::*ProcessFixed)(int last, quint8* output);
+	typedef int (SSEInterpolator::*ProcessCubic)(int last, Complex* output);
+
+	// the kernels for the current tap count and backend, picked by selectKernels()
+	struct Kernels {
+		FlushOutputs flushOutputs;
+		FlushDecimated flushDecimated;
+		InterpolateSymmetric interpolateSymmetric;
+		ProcessFixed processFixed;
+		ProcessCubic processCubic;
+	};
+
+	// a designed polyphase bank in the layouts the kernels read, shared by all interpolators
+	// of the process using the same design, see filterBank()
+	struct FilterBank {
+		std::vector<float> storage;
+		const float* taps; // phases 0 .. phases / 2, 32 byte aligned inside storage
+		std::vector<qint16> fixedTaps; // all phases in window order, exact ratios only
+		int fixedShift; // fixed point position of fixedTaps, 15 plus the octaves of attenuation
+		std::shared_ptr<const FFTFilter::Spectrum> spectrum; // integer decimation in the frequency domain only
+
+		size_t bytes() const
+		{
+			size_t size = storage.size() * sizeof(float) + fixedTaps.size() * sizeof(qint16);
+			if(spectrum)
+				size += spectrum->size * (4 * sizeof(float) + sizeof(int));
+			return size;
+		}
+	};
+
+	std::shared_ptr<const FilterBank> m_bank;
+	const float* m_alignedTaps;
+	const qint16* m_fixedTaps;
+	int m_fixedShift;
+	std::vector<HalfBandDecimator> m_halfBands; // may hold unused stages of an earlier configuration
+	int m_stages; // half-band stages in use
+	std::vector<Real> m_stageI;
+	std::vector<Real> m_stageQ;
+	std::vector<Real> m_historyI;
+	std::vector<Real> m_historyQ;
+	int m_historyKeep;
+	double m_historyRate; // sample rate behind the half-band stages
 	int m_nTaps;
+	int m_phases;
+	Kernels m_kernels;
+	Mode m_mode;
+	Real m_gain; // only applied by processCubic(), the filter taps carry it otherwise
+	SIMD::Backend m_backend;
+	bool m_fixedPoint;
+	std::vector<qint16> m_fixedHistoryI;
+	std::vector<qint16> m_fixedHistoryQ;
+	std::vector<Complex> m_quantise; // float output waiting for quantisation
+	quint64 m_step; // input samples per output sample, 32.32 fixed point
+	quint64 m_position; // position of the next output behind the newest input, 32.32 fixed point
+	std::vector<ScheduleEntry> m_schedule;
+	int m_schedulePos;
+	size_t m_schedulePending; // inputs to consume before the next output
+	int m_decimation;
+	bool m_useFFT;
+	FFTFilter m_fftFilter;
+
+	double createHalfBands(double inputRate, double outputRate);
+	void createCubic(double inputRate, double outputRate, double gain);
+	static double designCutoff(double inputRate, double minRate, int tapsPerPhase);
+	static std::shared_ptr<const FilterBank> filterBank(int phases, int tapsPerPhase, double cutoff, double gain, bool fixedPoint, int fftSize);
+	static void createFixedTaps(int phases, int tapsPerPhase, double gain, FilterBank* bank);
+	static void createTaps(int nTaps, double sampleRate, double cutoff, std::vector<Real>* taps);
 
-	void createTaps(int nTaps, double sampleRate, double cutoff, std::vector<Real>* taps);
+	static void convertSamples(SIMD::Backend backend, const IQSampleS16* samples, int sampleCount, int shift, float* dstI, float* dstQ);
+	int loadHistory(const IQSampleS16* samples, int sampleCount, int shift);
+	int processLinear(int last, Complex* output);
+	int processRational(int last, Complex* output);
+	int processDecimate(int last, Complex* output);
+	template<class V> int processCubic(int last, Complex* output);
+	int loadFixedHistory(const IQSampleS16* samples, int sampleCount, int shift);
+	void selectKernels();
 
-	void advanceFilter(const Complex& next)
+	// Every kernel below takes the tap count as template argument Taps so its loops run
+	// over a compile time constant; Taps = 0 is the generic version reading m_nTaps. The
+	// backend V is a template argument as well, the kernels ending in AVX2 are the entry
+	// points that enable its instruction set, see simd.h.
+	template<int Taps> int tapCount() const { return (Taps != 0) ? Taps : m_nTaps; }
+
+	template<int Taps, SIMD::Backend Backend> int processFixed(int last, quint8* output);
+	template<class V, int Taps> SIMD_INLINE void doInterpolateFixed(const qint16* coeff, int start, quint8* result) const;
+	template<int Taps> void doInterpolateFixedAVX2(const qint16* coeff, int start, quint8* result) const;
+	template<class V, int Taps> void flushOutputs(const Output* outputs, int count, bool linear, Complex* result);
+	template<int Taps> void flushOutputsAVX2(const Output* outputs, int count, bool linear, Complex* result);
+	template<class V, int Taps> void flushDecimated(const int* starts, int count, Complex* result);
+	template<int Taps> void flushDecimatedAVX2(const int* starts, int count, Complex* result);
+
+	template<class V, int Taps> void doInterpolate(int start, int phase, Complex* result);
+	template<class V, int Taps> void doInterpolateLinear(int start, int phase, Real frac, Complex* result);
+	template<class V, int Taps, bool Reverse> void doInterpolatePhase(const float* coeff, int start, Complex* result) const;
+	template<class V, int Taps, bool ReverseA, bool ReverseB> void doInterpolateLinear(const float* coeffA, const float* coeffB, int start, Real frac, Complex* result) const;
+	template<class V, int Taps> SIMD_INLINE void doInterpolateSymmetric(const float* coeff, int start, int mirror, Complex* result);
+	template<int Taps> void doInterpolateSymmetricAVX2(const float* coeff, int start, int mirror, Complex* result);
+	template<class V, int Taps, int N> SIMD_INLINE void doDecimateGroup(const int* starts, Complex* result) const;
+
+	// The history runs oldest to newest while the prototype runs newest to oldest, so the
+	// window needs phase p read back to front. The prototype is symmetric, which makes that
+	// the same as phase m_phases - p read front to back. Only phases 0 .. m_phases / 2 are
+	// stored, so one of both is always available.
+	template<int Taps = 0> const float* phaseCoefficients(int phase, bool* reversed) const
 	{
-		m_ptr--;
-		if(m_ptr < 0)
-			m_ptr = m_nTaps - 1;
-		m_samples[m_ptr] = next;
+		*reversed = (2 * phase < m_phases);
+		if(*reversed)
+			return &m_alignedTaps[phase * tapCount<Taps>()];
+		else return &m_alignedTaps[(m_phases - phase) * tapCount<Taps>()];
 	}
 
-	void doInterpolate(int phase, Complex* result)
+	template<int Taps> void addCenterTap(const float* coeff, int start, int mirror, Complex* result) const
 	{
-#if 1
-		// beware of the ringbuffer
-		if(m_ptr == 0) {
-			// only one straight block
-			const float* src = (const float*)&m_samples[0];
-			const __m128* filter = (const __m128*)&m_alignedTaps[phase * m_nTaps * 2];
-			__m128 sum = _mm_setzero_ps();
-			int todo = m_nTaps / 2;
-
-			for(int i = 0; i < todo; i++) {
-				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src), *filter));
-				src += 4;
-				filter += 1;
-			}
-
-			// add upper half to lower half and store
-			_mm_storel_pi((__m64*)result, _mm_add_ps(sum, _mm_shuffle_ps(sum, _mm_setzero_ps(), _MM_SHUFFLE(1, 0, 3, 2))));
-		} else {
-			// two blocks
-			const float* src = (const float*)&m_samples[m_ptr];
-			const __m128* filter = (const __m128*)&m_alignedTaps[phase * m_nTaps * 2];
-			__m128 sum = _mm_setzero_ps();
-
-			// first block
-			int block = m_nTaps - m_ptr;
-			int todo = block / 2;
-			if(block & 1)
-				todo++;
-			for(int i = 0; i < todo; i++) {
-				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src), *filter));
-				src += 4;
-				filter += 1;
-			}
-			if(block & 1) {
-				// one sample beyond the end -> switch coefficient table
-				filter = (const __m128*)&m_alignedTaps2[phase * m_nTaps * 2 + todo * 4 - 4];
-			}
-			// second block
-			src = (const float*)&m_samples[0];
-			block = m_ptr;
-			todo = block / 2;
-			for(int i = 0; i < todo; i++) {
-				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src), *filter));
-				src += 4;
-				filter += 1;
-			}
-			if(block & 1) {
-				// one sample remaining
-				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)src), filter[0]));
-			}
-
-			// add upper half to lower half and store
-			_mm_storel_pi((__m64*)result, _mm_add_ps(sum, _mm_shuffle_ps(sum, _mm_setzero_ps(), _MM_SHUFFLE(1, 0, 3, 2))));
+		if(mirror == tapCount<Taps>()) {
+			// phase 0 has an odd number of taps, the center one has no partner
+			int center = tapCount<Taps>() / 2;
+			*result += Complex(coeff[center] * m_historyI[start + center], coeff[center] * m_historyQ[start + center]);
 		}
-#else
-		// unoptimized textbook implementation
-		int sample = m_ptr;
-		const Real* coeff = &m_alignedTaps[phase * m_nTaps * 2];
-		Real rAcc = 0;
-		Real iAcc = 0;
-
-		for(int i = 0; i < m_nTaps; i++) {
-			rAcc += *coeff * m_samples[sample].real();
-			iAcc += *coeff * m_samples[sample].imag();
-			sample = (sample + 1) % m_nTaps;
-			coeff += 2;
-		}
-		*result = Complex(rAcc, iAcc);
-#endif
-
 	}
 };
 